@@ -0,0 +1,115 @@
+// Host Arduino shim
+// Rob Dobson 2016-2019
+
+// Minimal Arduino core API so that hardware-independent parts of the firmware
+// (motion planning, ramp generation, evaluators) can be built and run on the
+// development machine - only used by the native PlatformIO environment
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <math.h>
+#include <algorithm>
+#include "WString.h"
+
+// Attributes which are meaningful on the target only
+#define IRAM_ATTR
+#define PROGMEM
+
+// Pin levels and modes (values as used by the ESP32 core)
+#define LOW 0x0
+#define HIGH 0x1
+#define INPUT 0x01
+#define OUTPUT 0x02
+#define PULLUP 0x04
+#define INPUT_PULLUP 0x05
+#define PULLDOWN 0x08
+#define INPUT_PULLDOWN 0x09
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+using std::max;
+using std::min;
+
+// Time
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+// CPU cycle counter (for instrumentation - equivalent of XTHAL_GET_CCOUNT on the ESP32)
+uint32_t hostCycleCount();
+uint32_t hostCyclesPerMicrosecond();
+
+// GPIO - pins are simulated as a 64 bit register of levels (bit N = pin N)
+static const int HOST_NUM_PINS = 64;
+void pinMode(int pin, int mode);
+void digitalWrite(int pin, int val);
+int digitalRead(int pin);
+
+// Set the level seen by digitalRead() on an input pin (e.g. to simulate an endstop)
+void hostSetPinLevel(int pin, int level);
+
+// Register level access (equivalent of the ESP32 GPIO in and out_w1ts/out_w1tc registers)
+uint64_t hostReadPinLevels();
+void hostWritePinLevels(uint64_t setMask, uint64_t clearMask);
+
+// Number of hostWritePinLevels() calls (register writes) so far
+uint32_t hostGetPinWriteCount();
+
+// Number formatting
+char* dtostrf(double val, signed char width, unsigned char prec, char* pBuf);
+
+// Chip information
+class EspClass
+{
+public:
+    uint32_t getFreeHeap()
+    {
+        return 0;
+    }
+};
+extern EspClass ESP;
+
+// ESP-IDF high-resolution timer - never fires on the host
+typedef void* esp_timer_handle_t;
+typedef void (*esp_timer_cb_t)(void* arg);
+typedef enum
+{
+    ESP_TIMER_TASK,
+} esp_timer_dispatch_t;
+typedef struct
+{
+    esp_timer_cb_t callback;
+    void* arg;
+    esp_timer_dispatch_t dispatch_method;
+    const char* name;
+} esp_timer_create_args_t;
+inline int esp_timer_create(const esp_timer_create_args_t* pArgs, esp_timer_handle_t* pHandle)
+{
+    *pHandle = NULL;
+    return 0;
+}
+inline int esp_timer_start_periodic(esp_timer_handle_t handle, uint64_t periodUs)
+{
+    return 0;
+}
+inline int esp_timer_stop(esp_timer_handle_t handle)
+{
+    return 0;
+}
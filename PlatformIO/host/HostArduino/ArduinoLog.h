@@ -0,0 +1,52 @@
+// Host Arduino shim - ArduinoLog
+// Rob Dobson 2016-2019
+
+// Same interface and format specifiers as the ArduinoLog library used on the
+// target - output goes to stderr so stdout is free for simulation results
+
+#pragma once
+
+#include <stdarg.h>
+#include "Arduino.h"
+
+#define LOG_LEVEL_SILENT 0
+#define LOG_LEVEL_FATAL 1
+#define LOG_LEVEL_ERROR 2
+#define LOG_LEVEL_WARNING 3
+#define LOG_LEVEL_NOTICE 4
+#define LOG_LEVEL_TRACE 5
+#define LOG_LEVEL_VERBOSE 6
+
+class Print;
+
+class Logging
+{
+public:
+    Logging() : _level(LOG_LEVEL_SILENT) {}
+
+    void begin(int level, Print* pOutput = 0, bool showLevel = true)
+    {
+        _level = level;
+    }
+    void setLevel(int level)
+    {
+        _level = level;
+    }
+    int getLevel()
+    {
+        return _level;
+    }
+
+    void fatal(const char* fmt, ...) { va_list args; va_start(args, fmt); printLevel(LOG_LEVEL_FATAL, fmt, args); va_end(args); }
+    void error(const char* fmt, ...) { va_list args; va_start(args, fmt); printLevel(LOG_LEVEL_ERROR, fmt, args); va_end(args); }
+    void warning(const char* fmt, ...) { va_list args; va_start(args, fmt); printLevel(LOG_LEVEL_WARNING, fmt, args); va_end(args); }
+    void notice(const char* fmt, ...) { va_list args; va_start(args, fmt); printLevel(LOG_LEVEL_NOTICE, fmt, args); va_end(args); }
+    void trace(const char* fmt, ...) { va_list args; va_start(args, fmt); printLevel(LOG_LEVEL_TRACE, fmt, args); va_end(args); }
+    void verbose(const char* fmt, ...) { va_list args; va_start(args, fmt); printLevel(LOG_LEVEL_VERBOSE, fmt, args); va_end(args); }
+
+private:
+    int _level;
+    void printLevel(int level, const char* fmt, va_list args);
+};
+
+extern Logging Log;
@@ -0,0 +1,297 @@
+// Host Arduino shim
+// Rob Dobson 2016-2019
+
+#include "Arduino.h"
+#include "ArduinoLog.h"
+#include <chrono>
+#include <thread>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+Logging Log;
+EspClass ESP;
+
+// Time - relative to first use
+static std::chrono::steady_clock::time_point hostStartTime()
+{
+    static std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    return startTime;
+}
+
+unsigned long millis()
+{
+    return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - hostStartTime()).count();
+}
+
+unsigned long micros()
+{
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - hostStartTime()).count();
+}
+
+void delay(unsigned long ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+uint32_t hostCycleCount()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return uint32_t(__rdtsc());
+#else
+    return uint32_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - hostStartTime()).count());
+#endif
+}
+
+// Measured once against the steady clock
+uint32_t hostCyclesPerMicrosecond()
+{
+    static uint32_t cyclesPerUs = 0;
+    if (cyclesPerUs == 0)
+    {
+        auto startTime = std::chrono::steady_clock::now();
+        uint32_t startCycles = hostCycleCount();
+        while (std::chrono::steady_clock::now() - startTime < std::chrono::milliseconds(20))
+            ;
+        uint32_t elapsedCycles = hostCycleCount() - startCycles;
+        double elapsedUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - startTime).count();
+        cyclesPerUs = std::max(1u, uint32_t(elapsedCycles / elapsedUs + 0.5));
+    }
+    return cyclesPerUs;
+}
+
+// Simulated GPIO
+static uint64_t _hostPinLevels = 0;
+static uint32_t _hostPinWriteCount = 0;
+
+void pinMode(int pin, int mode)
+{
+    if (mode == INPUT_PULLUP)
+        hostSetPinLevel(pin, HIGH);
+    else if (mode == INPUT_PULLDOWN)
+        hostSetPinLevel(pin, LOW);
+}
+
+void digitalWrite(int pin, int val)
+{
+    if ((pin < 0) || (pin >= HOST_NUM_PINS))
+        return;
+    if (val)
+        _hostPinLevels |= (1ULL << pin);
+    else
+        _hostPinLevels &= ~(1ULL << pin);
+}
+
+int digitalRead(int pin)
+{
+    if ((pin >= 0) && (pin < HOST_NUM_PINS))
+        return ((_hostPinLevels >> pin) & 1) ? HIGH : LOW;
+    return LOW;
+}
+
+void hostSetPinLevel(int pin, int level)
+{
+    digitalWrite(pin, level);
+}
+
+uint64_t hostReadPinLevels()
+{
+    return _hostPinLevels;
+}
+
+void hostWritePinLevels(uint64_t setMask, uint64_t clearMask)
+{
+    _hostPinLevels = (_hostPinLevels | setMask) & ~clearMask;
+    _hostPinWriteCount++;
+}
+
+uint32_t hostGetPinWriteCount()
+{
+    return _hostPinWriteCount;
+}
+
+char* dtostrf(double val, signed char width, unsigned char prec, char* pBuf)
+{
+    sprintf(pBuf, "%*.*f", width, prec, val);
+    return pBuf;
+}
+
+// String
+static std::string hostIntToStr(unsigned long val, bool isNeg, unsigned char base)
+{
+    if ((base < 2) || (base > 36))
+        base = 10;
+    std::string digits;
+    do
+    {
+        int digit = (int)(val % base);
+        digits.insert(digits.begin(), (char)(digit < 10 ? '0' + digit : 'a' + digit - 10));
+        val /= base;
+    } while (val != 0);
+    if (isNeg)
+        digits.insert(digits.begin(), '-');
+    return digits;
+}
+
+String::String(unsigned char val, unsigned char base) : _str(hostIntToStr(val, false, base)) {}
+String::String(unsigned int val, unsigned char base) : _str(hostIntToStr(val, false, base)) {}
+String::String(unsigned long val, unsigned char base) : _str(hostIntToStr(val, false, base)) {}
+
+String::String(int val, unsigned char base)
+{
+    // Negative values are only signed in base 10 (as on the target)
+    if ((base == 10) && (val < 0))
+        _str = hostIntToStr(0UL - (unsigned long)(long)val, true, base);
+    else
+        _str = hostIntToStr((unsigned int)val, false, base);
+}
+
+String::String(long val, unsigned char base)
+{
+    if ((base == 10) && (val < 0))
+        _str = hostIntToStr(0UL - (unsigned long)val, true, base);
+    else
+        _str = hostIntToStr((unsigned long)val, false, base);
+}
+
+String::String(float val, unsigned char decimalPlaces) : String((double)val, decimalPlaces) {}
+
+String::String(double val, unsigned char decimalPlaces)
+{
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*f", decimalPlaces, val);
+    _str = buf;
+}
+
+void String::getBytes(unsigned char* pBuf, unsigned int bufSize, unsigned int idx) const
+{
+    if (!pBuf || (bufSize == 0))
+        return;
+    unsigned int toCopy = 0;
+    if (idx < _str.length())
+    {
+        toCopy = (unsigned int)_str.length() - idx;
+        if (toCopy > bufSize - 1)
+            toCopy = bufSize - 1;
+        memcpy(pBuf, _str.c_str() + idx, toCopy);
+    }
+    pBuf[toCopy] = 0;
+}
+
+bool String::equalsIgnoreCase(const String& other) const
+{
+    return (_str.length() == other._str.length()) && (strcasecmp(_str.c_str(), other._str.c_str()) == 0);
+}
+
+String String::substring(unsigned int beginIdx, unsigned int endIdx) const
+{
+    if (beginIdx > endIdx)
+        std::swap(beginIdx, endIdx);
+    if (beginIdx >= _str.length())
+        return String();
+    if (endIdx > _str.length())
+        endIdx = (unsigned int)_str.length();
+    return String(_str.substr(beginIdx, endIdx - beginIdx));
+}
+
+void String::replace(char find, char replaceWith)
+{
+    std::replace(_str.begin(), _str.end(), find, replaceWith);
+}
+
+void String::replace(const String& find, const String& replaceWith)
+{
+    if (find._str.empty())
+        return;
+    size_t pos = 0;
+    while ((pos = _str.find(find._str, pos)) != std::string::npos)
+    {
+        _str.replace(pos, find._str.length(), replaceWith._str);
+        pos += replaceWith._str.length();
+    }
+}
+
+void String::toLowerCase()
+{
+    for (char& c : _str)
+        c = (char)tolower((unsigned char)c);
+}
+
+void String::toUpperCase()
+{
+    for (char& c : _str)
+        c = (char)toupper((unsigned char)c);
+}
+
+void String::trim()
+{
+    size_t first = 0;
+    while ((first < _str.length()) && isspace((unsigned char)_str[first]))
+        first++;
+    size_t last = _str.length();
+    while ((last > first) && isspace((unsigned char)_str[last - 1]))
+        last--;
+    _str = _str.substr(first, last - first);
+}
+
+long String::toInt() const
+{
+    return atol(_str.c_str());
+}
+
+float String::toFloat() const
+{
+    return (float)atof(_str.c_str());
+}
+
+double String::toDouble() const
+{
+    return atof(_str.c_str());
+}
+
+// Logging - handles the ArduinoLog format specifiers
+void Logging::printLevel(int level, const char* fmt, va_list args)
+{
+    if (level > _level)
+        return;
+    for (const char* pCh = fmt; *pCh; pCh++)
+    {
+        if (*pCh != '%')
+        {
+            fputc(*pCh, stderr);
+            continue;
+        }
+        pCh++;
+        switch (*pCh)
+        {
+        case 's': fputs(va_arg(args, const char*), stderr); break;
+        case 'S': fputs(va_arg(args, const char*), stderr); break;
+        case 'd':
+        case 'i': fprintf(stderr, "%d", va_arg(args, int)); break;
+        case 'l': fprintf(stderr, "%ld", va_arg(args, long)); break;
+        case 'u': fprintf(stderr, "%u", va_arg(args, unsigned int)); break;
+        case 'x': fprintf(stderr, "%x", va_arg(args, unsigned int)); break;
+        case 'X': fprintf(stderr, "0x%x", va_arg(args, unsigned int)); break;
+        case 'b': fprintf(stderr, "%s", hostIntToStr(va_arg(args, unsigned int), false, 2).c_str()); break;
+        case 'B': fprintf(stderr, "0b%s", hostIntToStr(va_arg(args, unsigned int), false, 2).c_str()); break;
+        case 'c': fputc((char)va_arg(args, int), stderr); break;
+        case 't': fputc(va_arg(args, int) ? 'T' : 'F', stderr); break;
+        case 'T': fputs(va_arg(args, int) ? "true" : "false", stderr); break;
+        case 'D':
+        case 'F':
+        case 'f': fprintf(stderr, "%f", va_arg(args, double)); break;
+        case 'p': fprintf(stderr, "%p", va_arg(args, void*)); break;
+        case '%': fputc('%', stderr); break;
+        case 0: return;
+        default: break;
+        }
+    }
+}
@@ -0,0 +1,44 @@
+// Host Arduino shim - SPI
+// Rob Dobson 2016-2019
+
+// SPI bus stub - transfers read back zero so SPI-attached drivers configure
+// but find no chip
+
+#pragma once
+
+#include <stdint.h>
+
+#define VSPI 3
+#define HSPI 2
+#define MSBFIRST 1
+#define LSBFIRST 0
+#define SPI_MODE0 0
+#define SPI_MODE1 1
+#define SPI_MODE2 2
+#define SPI_MODE3 3
+
+class SPISettings
+{
+public:
+    SPISettings() {}
+    SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode) {}
+};
+
+class SPIClass
+{
+public:
+    SPIClass(uint8_t spiBus = HSPI) {}
+    void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1) {}
+    void end() {}
+    void beginTransaction(SPISettings settings) {}
+    void endTransaction() {}
+    uint8_t transfer(uint8_t data)
+    {
+        return 0;
+    }
+    void transferBytes(const uint8_t* pData, uint8_t* pOut, uint32_t size)
+    {
+        for (uint32_t i = 0; pOut && (i < size); i++)
+            pOut[i] = 0;
+    }
+};
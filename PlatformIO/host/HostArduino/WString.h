@@ -0,0 +1,241 @@
+// Host Arduino shim - String
+// Rob Dobson 2016-2019
+
+// Subset of the Arduino String class used by the firmware, implemented on
+// std::string so the motion stack can be built and run natively
+
+#pragma once
+
+#include <stddef.h>
+#include <string>
+
+class String
+{
+public:
+    String() {}
+    String(const char* pStr)
+    {
+        if (pStr)
+            _str = pStr;
+    }
+    String(const String& other) : _str(other._str) {}
+    String(String&& other) : _str(std::move(other._str)) {}
+    String(const std::string& str) : _str(str) {}
+    explicit String(char c) : _str(1, c) {}
+    explicit String(unsigned char val, unsigned char base = 10);
+    explicit String(int val, unsigned char base = 10);
+    explicit String(unsigned int val, unsigned char base = 10);
+    explicit String(long val, unsigned char base = 10);
+    explicit String(unsigned long val, unsigned char base = 10);
+    explicit String(float val, unsigned char decimalPlaces = 2);
+    explicit String(double val, unsigned char decimalPlaces = 2);
+
+    String& operator=(const String& rhs)
+    {
+        _str = rhs._str;
+        return *this;
+    }
+    String& operator=(String&& rhs)
+    {
+        _str = std::move(rhs._str);
+        return *this;
+    }
+    String& operator=(const char* pStr)
+    {
+        _str = pStr ? pStr : "";
+        return *this;
+    }
+
+    // Size and access
+    unsigned int length() const
+    {
+        return (unsigned int)_str.length();
+    }
+    bool reserve(unsigned int size)
+    {
+        _str.reserve(size);
+        return true;
+    }
+    const char* c_str() const
+    {
+        return _str.c_str();
+    }
+    char charAt(unsigned int idx) const
+    {
+        return idx < _str.length() ? _str[idx] : 0;
+    }
+    void setCharAt(unsigned int idx, char c)
+    {
+        if (idx < _str.length())
+            _str[idx] = c;
+    }
+    char operator[](unsigned int idx) const
+    {
+        return charAt(idx);
+    }
+    char& operator[](unsigned int idx)
+    {
+        return _str[idx];
+    }
+    void toCharArray(char* pBuf, unsigned int bufSize, unsigned int idx = 0) const
+    {
+        getBytes((unsigned char*)pBuf, bufSize, idx);
+    }
+    void getBytes(unsigned char* pBuf, unsigned int bufSize, unsigned int idx = 0) const;
+
+    // Concatenation
+    bool concat(const String& str)
+    {
+        _str += str._str;
+        return true;
+    }
+    bool concat(const char* pStr)
+    {
+        if (!pStr)
+            return false;
+        _str += pStr;
+        return true;
+    }
+    bool concat(char c)
+    {
+        _str += c;
+        return true;
+    }
+    bool concat(int val) { return concat(String(val)); }
+    bool concat(unsigned int val) { return concat(String(val)); }
+    bool concat(long val) { return concat(String(val)); }
+    bool concat(unsigned long val) { return concat(String(val)); }
+    bool concat(float val) { return concat(String(val)); }
+    bool concat(double val) { return concat(String(val)); }
+    template <typename T>
+    String& operator+=(T rhs)
+    {
+        concat(rhs);
+        return *this;
+    }
+
+    // Comparison
+    int compareTo(const String& other) const
+    {
+        return _str.compare(other._str);
+    }
+    bool equals(const String& other) const
+    {
+        return _str == other._str;
+    }
+    bool equals(const char* pStr) const
+    {
+        return _str == (pStr ? pStr : "");
+    }
+    bool equalsIgnoreCase(const String& other) const;
+    bool startsWith(const String& prefix) const
+    {
+        return _str.compare(0, prefix._str.length(), prefix._str) == 0;
+    }
+    bool startsWith(const String& prefix, unsigned int offset) const
+    {
+        return offset <= _str.length() && _str.compare(offset, prefix._str.length(), prefix._str) == 0;
+    }
+    bool endsWith(const String& suffix) const
+    {
+        return _str.length() >= suffix._str.length() &&
+               _str.compare(_str.length() - suffix._str.length(), suffix._str.length(), suffix._str) == 0;
+    }
+    bool operator==(const String& rhs) const { return equals(rhs); }
+    bool operator==(const char* pStr) const { return equals(pStr); }
+    bool operator!=(const String& rhs) const { return !equals(rhs); }
+    bool operator!=(const char* pStr) const { return !equals(pStr); }
+    bool operator<(const String& rhs) const { return _str < rhs._str; }
+    bool operator>(const String& rhs) const { return _str > rhs._str; }
+
+    // Search
+    int indexOf(char c, unsigned int fromIdx = 0) const
+    {
+        return posToIdx(_str.find(c, fromIdx));
+    }
+    int indexOf(const String& str, unsigned int fromIdx = 0) const
+    {
+        return posToIdx(_str.find(str._str, fromIdx));
+    }
+    int lastIndexOf(char c) const
+    {
+        return posToIdx(_str.rfind(c));
+    }
+    int lastIndexOf(char c, unsigned int fromIdx) const
+    {
+        return posToIdx(_str.rfind(c, fromIdx));
+    }
+    int lastIndexOf(const String& str) const
+    {
+        return posToIdx(_str.rfind(str._str));
+    }
+    String substring(unsigned int beginIdx) const
+    {
+        return substring(beginIdx, length());
+    }
+    String substring(unsigned int beginIdx, unsigned int endIdx) const;
+
+    // Modification
+    void replace(char find, char replaceWith);
+    void replace(const String& find, const String& replaceWith);
+    void remove(unsigned int idx)
+    {
+        if (idx < _str.length())
+            _str.erase(idx);
+    }
+    void remove(unsigned int idx, unsigned int count)
+    {
+        if (idx < _str.length())
+            _str.erase(idx, count);
+    }
+    void toLowerCase();
+    void toUpperCase();
+    void trim();
+
+    // Conversion
+    long toInt() const;
+    float toFloat() const;
+    double toDouble() const;
+
+private:
+    std::string _str;
+
+    static int posToIdx(size_t pos)
+    {
+        return pos == std::string::npos ? -1 : (int)pos;
+    }
+};
+
+// Concatenation operators
+inline String operator+(const String& lhs, const String& rhs)
+{
+    String result(lhs);
+    result.concat(rhs);
+    return result;
+}
+inline String operator+(const String& lhs, const char* pRhs)
+{
+    String result(lhs);
+    result.concat(pRhs);
+    return result;
+}
+inline String operator+(const char* pLhs, const String& rhs)
+{
+    String result(pLhs);
+    result.concat(rhs);
+    return result;
+}
+inline String operator+(const String& lhs, char rhs)
+{
+    String result(lhs);
+    result.concat(rhs);
+    return result;
+}
+inline String operator+(const String& lhs, int rhs) { return lhs + String(rhs); }
+inline String operator+(const String& lhs, unsigned int rhs) { return lhs + String(rhs); }
+inline String operator+(const String& lhs, long rhs) { return lhs + String(rhs); }
+inline String operator+(const String& lhs, unsigned long rhs) { return lhs + String(rhs); }
+inline String operator+(const String& lhs, float rhs) { return lhs + String(rhs); }
+inline String operator+(const String& lhs, double rhs) { return lhs + String(rhs); }
+inline bool operator==(const char* pLhs, const String& rhs) { return rhs.equals(pLhs); }
+inline bool operator!=(const char* pLhs, const String& rhs) { return !rhs.equals(pLhs); }
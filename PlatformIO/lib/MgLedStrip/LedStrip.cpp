@@ -193,6 +193,7 @@ void LedStrip::updateNv()
     _ledNvValues.writeConfig();
     Log.trace("%supdateNv() : wrote %s\n", MODULE_PREFIX, _ledNvValues.getConfigCStrPtr());
     ledConfigChanged = true;
+    _configChangeCount++;
 }
 
 // Get the average sensor reading
@@ -15,6 +15,11 @@ public:
     void service();
     void updateLedFromConfig(const char* pLedJson);
     const char* getConfigStrPtr();
+    // Incremented whenever the stored config changes
+    uint32_t getConfigChangeCount()
+    {
+        return _configChangeCount;
+    }
     void setSleepMode(int sleep);
 
 private:
@@ -35,6 +40,7 @@ private:
     byte _ledValue = -1;
     bool _autoDim = false;
     bool ledConfigChanged = false;
+    uint32_t _configChangeCount = 0;
     
     int sensorReadingCount = 0;
 
@@ -9,27 +9,30 @@
 const char *ConfigPinMap::_pinMapOtherStr[] = {"DAC1", "DAC2", "SCL", "SDA", "RX", "TX", "MISO", "MOSI", "SCK", "SS"};
 int ConfigPinMap::_pinMapOtherPin[] = {DAC1, DAC2, SCL, SDA, RX, TX, MISO, MOSI, SCK, SS};
 int ConfigPinMap::_pinMapOtherLen = sizeof(ConfigPinMap::_pinMapOtherPin) / sizeof(int);
-int ConfigPinMap::_pinMapD[] = {};
-int ConfigPinMap::_pinMapDLen = sizeof(ConfigPinMap::_pinMapD) / sizeof(int);
+// Empty maps have a placeholder entry (zero-length arrays aren't valid C++) and zero length
+int ConfigPinMap::_pinMapD[] = {-1};
+int ConfigPinMap::_pinMapDLen = 0;
 int ConfigPinMap::_pinMapA[] = {A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12};
 int ConfigPinMap::_pinMapALen = sizeof(ConfigPinMap::_pinMapA) / sizeof(int);
 
 #elif defined(ESP8266)
 
-const char *ConfigPinMap::_pinMapOtherStr[] = {};
-int ConfigPinMap::_pinMapOtherPin[] = {};
-int ConfigPinMap::_pinMapOtherLen = sizeof(ConfigPinMap::_pinMapOtherPin) / sizeof(int);
+// Empty maps have a placeholder entry (zero-length arrays aren't valid C++) and zero length
+const char *ConfigPinMap::_pinMapOtherStr[] = {""};
+int ConfigPinMap::_pinMapOtherPin[] = {-1};
+int ConfigPinMap::_pinMapOtherLen = 0;
 int ConfigPinMap::_pinMapD[] = {16,5,4,0,2,14,12,13,15,3,1};
 int ConfigPinMap::_pinMapDLen = sizeof(ConfigPinMap::_pinMapD) / sizeof(int);
-int ConfigPinMap::_pinMapA[] = {};
-int ConfigPinMap::_pinMapALen = sizeof(ConfigPinMap::_pinMapA) / sizeof(int);
+int ConfigPinMap::_pinMapA[] = {-1};
+int ConfigPinMap::_pinMapALen = 0;
 
 
 #else
 
-int ConfigPinMap::_pinMapOtherStr[] = {};
-int ConfigPinMap::_pinMapOtherPin[] = {};
-int ConfigPinMap::_pinMapOtherLen = sizeof(ConfigPinMap::_pinMapOther) / sizeof(int);
+// Empty maps have a placeholder entry (zero-length arrays aren't valid C++) and zero length
+const char *ConfigPinMap::_pinMapOtherStr[] = {""};
+int ConfigPinMap::_pinMapOtherPin[] = {-1};
+int ConfigPinMap::_pinMapOtherLen = 0;
 
 #if PLATFORM_ID == 6    // Photon
 int ConfigPinMap::_pinMapD[] = {D0, D1, D2, D3, D4, D5, D6, D7};
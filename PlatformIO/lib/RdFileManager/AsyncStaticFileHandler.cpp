@@ -102,6 +102,8 @@ bool AsyncStaticFileHandler::canHandle(AsyncWebServerRequest *request){
     if(_cache_control.length())
       request->addInterestingHeader("If-None-Match");
 
+    request->addInterestingHeader("Range");
+
     DEBUGF("[AsyncStaticFileHandler::canHandle] TRUE\n");
     return true;
   }
@@ -156,6 +158,41 @@ size_t AsyncStaticFileHandler::fileSizeInBytes(const String& fileName)
     return st.st_size;
 }
 
+int AsyncStaticFileHandler::parseRange(const String& rangeHeader, size_t fileLen, size_t& rangeStart, size_t& rangeLen)
+{
+    // Whole file unless the header is a single range (e.g. bytes=0-1023, bytes=1024- or bytes=-512)
+    rangeStart = 0;
+    rangeLen = fileLen;
+    int dashIdx = rangeHeader.indexOf('-');
+    if (!rangeHeader.startsWith("bytes=") || (dashIdx < 0) || (rangeHeader.indexOf(',') >= 0))
+        return 200;
+    String firstStr = rangeHeader.substring(6, dashIdx);
+    firstStr.trim();
+    String lastStr = rangeHeader.substring(dashIdx + 1);
+    lastStr.trim();
+    size_t first = 0, last = fileLen - 1;
+    if (firstStr.length() == 0)
+    {
+        // Suffix range - the last N bytes
+        long suffixLen = lastStr.toInt();
+        if (suffixLen <= 0)
+            return 416;
+        if ((size_t)suffixLen < fileLen)
+            first = fileLen - suffixLen;
+    }
+    else
+    {
+        first = firstStr.toInt();
+        if ((lastStr.length() != 0) && ((size_t)lastStr.toInt() < last))
+            last = lastStr.toInt();
+    }
+    if ((fileLen == 0) || (first >= fileLen) || (first > last))
+        return 416;
+    rangeStart = first;
+    rangeLen = last - first + 1;
+    return 206;
+}
+
 bool AsyncStaticFileHandler::_fileExists(AsyncWebServerRequest *request, const String& path)
 {
   bool fileFound = false;
@@ -214,7 +251,7 @@ void AsyncStaticFileHandler::handleRequest(AsyncWebServerRequest *request)
   if((_username != "" && _password != "") && !request->authenticate(_username.c_str(), _password.c_str()))
       return request->requestAuthentication();
 
-  size_t fileSize = fileSizeInBytes(filename);
+  size_t fileSize = fileSizeInBytes(_foundFileName);
   if (fileSize > 0) {
     String etag = String(fileSize);
     if (_last_modified.length() && _last_modified == request->header("If-Modified-Since")) {
@@ -225,8 +262,21 @@ void AsyncStaticFileHandler::handleRequest(AsyncWebServerRequest *request)
       response->addHeader("ETag", etag);
       request->send(response);
     } else {
+      // Byte range (not when templates change the length)
+      size_t rangeStart = 0, rangeLen = fileSize;
+      int rangeCode = 200;
+      if (!_callback && request->hasHeader("Range"))
+        rangeCode = parseRange(request->header("Range"), fileSize, rangeStart, rangeLen);
+      if (rangeCode == 416) {
+        AsyncWebServerResponse * response = new AsyncBasicResponse(416);
+        response->addHeader("Content-Range", "bytes */" + String(fileSize));
+        request->send(response);
+        return;
+      }
       String origUrl = request->url().substring(_uri.length());
-      AsyncWebServerResponse * response = new AsyncStaticFileResponse(_foundFileName, filename, String(), false, _callback);
+      AsyncStaticFileResponse * response = new AsyncStaticFileResponse(_foundFileName, filename, String(), false, _callback);
+      if (rangeCode == 206)
+        response->setRange(rangeStart, rangeLen, fileSize);
       if (_last_modified.length())
         response->addHeader("Last-Modified", _last_modified);
       if (_cache_control.length()){
@@ -318,8 +368,12 @@ AsyncStaticFileResponse::AsyncStaticFileResponse(const String& foundFileName, co
     _chunked = false;
   }
 
-  _contentLength = AsyncStaticFileHandler::fileSizeInBytes(_path);
-  _pFile = fopen(_path.c_str(), "rb");
+  // Content is from the file found (which may be the .gz version)
+  _contentLength = AsyncStaticFileHandler::fileSizeInBytes(foundFileName);
+  _remaining = _contentLength;
+  _pFile = fopen(foundFileName.c_str(), "rb");
+  if(!_callback)
+    addHeader("Accept-Ranges", "bytes");
 
   if(contentType == "")
     _setContentType(path);
@@ -338,9 +392,23 @@ AsyncStaticFileResponse::AsyncStaticFileResponse(const String& foundFileName, co
   addHeader("Content-Disposition", buf);
 }
 
+void AsyncStaticFileResponse::setRange(size_t rangeStart, size_t rangeLen, size_t fileLen){
+  _code = 206;
+  _contentLength = rangeLen;
+  _remaining = rangeLen;
+  if (_pFile)
+    fseek(_pFile, rangeStart, SEEK_SET);
+  addHeader("Content-Range", "bytes " + String(rangeStart) + "-" + String(rangeStart + rangeLen - 1) + "/" + String(fileLen));
+}
+
 size_t AsyncStaticFileResponse::_fillBuffer(uint8_t *data, size_t len){
     if (!_pFile)
         return 0;
-  return fread(data, 1, len, _pFile);
+  // Don't read past the end of a range
+  if (len > _remaining)
+    len = _remaining;
+  size_t readLen = fread(data, 1, len, _pFile);
+  _remaining -= readLen;
+  return readLen;
 }
 
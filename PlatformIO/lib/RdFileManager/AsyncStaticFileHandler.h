@@ -35,10 +35,12 @@ class AsyncStaticFileResponse: public AsyncAbstractResponse {
   private:
     FILE* _pFile;
     String _path;
+    size_t _remaining;
     void _setContentType(const String& path);
   public:
     AsyncStaticFileResponse(const String& foundFileName, const String& path, const String& contentType=String(), bool download=false, AwsTemplateProcessor callback=nullptr);
     ~AsyncStaticFileResponse();
+    void setRange(size_t rangeStart, size_t rangeLen, size_t fileLen);
     bool _sourceValid() const { return !!(_pFile); }
     virtual size_t _fillBuffer(uint8_t *buf, size_t maxLen) override;
 };
@@ -77,4 +79,8 @@ class AsyncStaticFileHandler: public AsyncWebHandler {
 
     static bool existsAndIsAFile(const String& fileName);
     static size_t fileSizeInBytes(const String& fileName);
+
+    // Single byte range from an HTTP Range header - returns the response code (200 for the
+    // whole file, 206 for the range or 416 if it isn't satisfiable)
+    static int parseRange(const String& rangeHeader, size_t fileLen, size_t& rangeStart, size_t& rangeLen);
 };
@@ -0,0 +1,189 @@
+// FileDirIndex
+// Rob Dobson 2018-2019
+
+#include "FileDirIndex.h"
+#include <sys/stat.h>
+#include <algorithm>
+
+FileDirIndex::FileDirIndex()
+{
+    _namePoolUnused = 0;
+    _bySizeValid = false;
+    _flatNames = false;
+    _pDir = NULL;
+}
+
+FileDirIndex::~FileDirIndex()
+{
+    clear();
+}
+
+bool FileDirIndex::buildStart(const String& folder, bool flatNames)
+{
+    clear();
+    String folderPath = folder.endsWith("/") ? folder : folder + "/";
+    _pDir = opendir(folderPath.c_str());
+    if (!_pDir)
+        return false;
+    _folder = folderPath;
+    _flatNames = flatNames;
+    return true;
+}
+
+bool FileDirIndex::buildSome(int maxEntries)
+{
+    if (!_pDir)
+        return _folder.length() != 0;
+    for (int i = 0; i < maxEntries; i++)
+    {
+        struct dirent* ent = readdir(_pDir);
+        if (!ent)
+        {
+            closedir(_pDir);
+            _pDir = NULL;
+            return true;
+        }
+        if (isExcluded(ent->d_name))
+            continue;
+
+        // A file deleted since the folder was opened can't be stat'd (and has already
+        // been removed from the index)
+        struct stat st;
+        String filePath = _folder + ent->d_name;
+        if (stat(filePath.c_str(), &st) != 0)
+            continue;
+        update(ent->d_name, st.st_size);
+    }
+    return false;
+}
+
+void FileDirIndex::clear()
+{
+    if (_pDir)
+        closedir(_pDir);
+    _pDir = NULL;
+    _entries.clear();
+    _namePool.clear();
+    _namePoolUnused = 0;
+    _bySize.clear();
+    _bySizeValid = false;
+    _folder = "";
+}
+
+bool FileDirIndex::fileChanged(const char* pPath, bool removed, uint32_t size)
+{
+    // Check the file is in the folder (and not a sub-folder)
+    if ((_folder.length() == 0) || (strncmp(pPath, _folder.c_str(), _folder.length()) != 0))
+        return false;
+    const char* pName = pPath + _folder.length();
+    if ((*pName == 0) || (!_flatNames && strchr(pName, '/')))
+        return false;
+    return removed ? remove(pName) : update(pName, size);
+}
+
+bool FileDirIndex::getEntry(uint32_t posn, SortKey sortKey, bool descending, const char*& pName, uint32_t& size)
+{
+    uint32_t numEntries = _entries.size();
+    if (posn >= numEntries)
+        return false;
+    uint32_t entryIdx = descending ? numEntries - 1 - posn : posn;
+    if (sortKey == SORT_SIZE)
+    {
+        // Entries are in name order so a stable sort gives size then name order
+        if (!_bySizeValid)
+        {
+            _bySize.resize(numEntries);
+            for (uint32_t i = 0; i < numEntries; i++)
+                _bySize[i] = i;
+            std::stable_sort(_bySize.begin(), _bySize.end(), [this](uint32_t a, uint32_t b) {
+                return _entries[a].size < _entries[b].size;
+            });
+            _bySizeValid = true;
+        }
+        entryIdx = _bySize[entryIdx];
+    }
+    pName = getName(_entries[entryIdx]);
+    size = _entries[entryIdx].size;
+    return true;
+}
+
+bool FileDirIndex::update(const char* pName, uint32_t size)
+{
+    if (isExcluded(pName))
+        return false;
+    bool found = false;
+    uint32_t posn = findPosn(pName, found);
+    if (found)
+    {
+        if (_entries[posn].size == size)
+            return false;
+        _entries[posn].size = size;
+    }
+    else
+    {
+        Entry entry;
+        entry.nameOff = _namePool.size();
+        entry.size = size;
+        _namePool.insert(_namePool.end(), pName, pName + strlen(pName) + 1);
+        _entries.insert(_entries.begin() + posn, entry);
+    }
+    _bySizeValid = false;
+    return true;
+}
+
+bool FileDirIndex::remove(const char* pName)
+{
+    bool found = false;
+    uint32_t posn = findPosn(pName, found);
+    if (!found)
+        return false;
+    _namePoolUnused += strlen(getName(_entries[posn])) + 1;
+    _entries.erase(_entries.begin() + posn);
+    _bySizeValid = false;
+    if ((_namePoolUnused >= NAME_POOL_COMPACT_MIN) && (_namePoolUnused * 2 >= _namePool.size()))
+        compactNamePool();
+    return true;
+}
+
+// Position of the name (or where it would be inserted)
+uint32_t FileDirIndex::findPosn(const char* pName, bool& found)
+{
+    uint32_t lo = 0, hi = _entries.size();
+    while (lo < hi)
+    {
+        uint32_t mid = (lo + hi) / 2;
+        if (compareNames(getName(_entries[mid]), pName) < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    found = (lo < _entries.size()) && (compareNames(getName(_entries[lo]), pName) == 0);
+    return lo;
+}
+
+void FileDirIndex::compactNamePool()
+{
+    std::vector<char> namePool;
+    namePool.reserve(_namePool.size() - _namePoolUnused);
+    for (Entry& entry : _entries)
+    {
+        const char* pName = getName(entry);
+        entry.nameOff = namePool.size();
+        namePool.insert(namePool.end(), pName, pName + strlen(pName) + 1);
+    }
+    _namePool.swap(namePool);
+    _namePoolUnused = 0;
+}
+
+// Case-insensitive order (names which differ only in case are ordered case-sensitively)
+int FileDirIndex::compareNames(const char* pName1, const char* pName2)
+{
+    int rslt = strcasecmp(pName1, pName2);
+    return rslt != 0 ? rslt : strcmp(pName1, pName2);
+}
+
+bool FileDirIndex::isExcluded(const char* pName)
+{
+    return (strcmp(pName, ".") == 0) || (strcmp(pName, "..") == 0) ||
+            (strcasecmp(pName, "System Volume Information") == 0) || (strcasecmp(pName, "thumbs.db") == 0);
+}
@@ -0,0 +1,97 @@
+// FileDirIndex
+// Rob Dobson 2018-2019
+
+// In-memory index of the files in one folder (name and size) so that a file list doesn't
+// need a readdir and a stat of every file - the index is built once (a few entries at a
+// time so it can be done in the background) and then kept up to date as files are
+// written and deleted
+// Names are held in a single pool and the entries are kept sorted by name - the order by
+// size is generated when first asked for after a change
+// Not thread-safe - the owner serialises access (FileManager holds its file system mutex)
+
+#pragma once
+
+#include <Arduino.h>
+#include <dirent.h>
+#include <vector>
+
+class FileDirIndex
+{
+public:
+    enum SortKey
+    {
+        SORT_NAME,
+        SORT_SIZE
+    };
+
+    FileDirIndex();
+    ~FileDirIndex();
+
+    // Clear and start building the index of a folder (full path e.g. /sd/ or /sd/music/) - if
+    // flatNames is set names may contain / (SPIFFS has no real folders) - returns false if
+    // the folder can't be opened
+    bool buildStart(const String& folder, bool flatNames);
+
+    // Read up to maxEntries more entries - returns true when the index is complete
+    bool buildSome(int maxEntries);
+
+    // Discard the index
+    void clear();
+
+    // Folder indexed (ends with /) - empty if not in use
+    const String& getFolder()
+    {
+        return _folder;
+    }
+    bool isComplete()
+    {
+        return (_folder.length() != 0) && (_pDir == NULL);
+    }
+
+    // Apply a change to a file (given by its full path) - ignored if the file isn't in the
+    // folder - returns true if the index changed
+    bool fileChanged(const char* pPath, bool removed, uint32_t size);
+
+    // Number of entries
+    uint32_t count()
+    {
+        return _entries.size();
+    }
+
+    // Entry at a position in the sort order - the name is valid until the index changes
+    bool getEntry(uint32_t posn, SortKey sortKey, bool descending, const char*& pName, uint32_t& size);
+
+private:
+    // Entry - the name is null terminated in the pool
+    struct Entry
+    {
+        uint32_t nameOff;
+        uint32_t size;
+    };
+    std::vector<Entry> _entries;
+    std::vector<char> _namePool;
+    uint32_t _namePoolUnused;
+
+    // Positions in _entries ordered by size (then name) - generated when needed
+    std::vector<uint32_t> _bySize;
+    bool _bySizeValid;
+
+    // Folder and build state (the folder is open while building)
+    String _folder;
+    bool _flatNames;
+    DIR* _pDir;
+
+    // Compact the name pool when this much (and at least half) is unused
+    static const uint32_t NAME_POOL_COMPACT_MIN = 1024;
+
+    bool update(const char* pName, uint32_t size);
+    bool remove(const char* pName);
+    uint32_t findPosn(const char* pName, bool& found);
+    const char* getName(const Entry& entry)
+    {
+        return _namePool.data() + entry.nameOff;
+    }
+    void compactNamePool();
+    static int compareNames(const char* pName1, const char* pName2);
+    static bool isExcluded(const char* pName);
+};
@@ -24,7 +24,6 @@ void FileManager::setup(ConfigBase& config, const char* pConfigPath)
     // Init
     _spiffsIsOk = false;
     _sdIsOk = false;
-    _cachedFileListValid = false;
 
     // Get config
     String pathStr = "fileManager";
@@ -145,6 +144,11 @@ void FileManager::setup(ConfigBase& config, const char* pConfigPath)
             }
         }
     }
+
+    // Index the root folder of the default file system in the background
+    String nameOfFS;
+    if (checkFileSystem("", nameOfFS))
+        getDirIndex(getFilePath(nameOfFS, "/"), nameOfFS == "spiffs", false);
 }
     
 void FileManager::reformat(const String& fileSystemStr, String& respStr)
@@ -160,10 +164,18 @@ void FileManager::reformat(const String& fileSystemStr, String& respStr)
     // Reformat - need to disable Watchdog timer while formatting
     // Watchdog is not enabled on core 1 in Arduino according to this
     // https://www.bountysource.com/issues/44690700-watchdog-with-system-reset
-    _cachedFileListValid = false;
+    xSemaphoreTake(_fileSysMutex, portMAX_DELAY);
+    for (int i = 0; i < NUM_DIR_INDEXES; i++)
+    {
+        _dirIndexes[i].clear();
+        _dirIndexUsedMs[i] = 0;
+    }
     disableCore0WDT();
     esp_err_t ret = esp_spiffs_format(NULL);
     enableCore0WDT();
+    _fileListChangeCount++;
+    _fileListChangedFolder = "/spiffs/";
+    xSemaphoreGive(_fileSysMutex);
     Utils::setJsonBoolResult(respStr, ret == ESP_OK);
     Log.warning("%sReformat SPIFFS result %s\n", MODULE_PREFIX, (ret == ESP_OK ? "OK" : "FAIL"));
 }
@@ -200,7 +212,54 @@ bool FileManager::getFileInfo(const String& fileSystemStr, const String& filenam
     return true;
 }
 
-bool FileManager::getFilesJSON(const String& fileSystemStr, const String& folderStr, String& respStr)
+bool FileManager::getFilesJSON(const String& fileSystemStr, const String& folderStr, String& respStr,
+            const FileListPage& page)
+{
+    FileListStream stream;
+    if (!fileListStart(fileSystemStr, folderStr, page, respStr, stream))
+        return false;
+
+    // Generate the whole list
+    respStr = "";
+    respStr.reserve(stream.pending.length() + stream.sizes.size() * FILE_LIST_ENTRY_EST_LEN + 2);
+    uint8_t buf[256];
+    while (true)
+    {
+        size_t len = fileListFill(stream, buf, sizeof(buf) - 1);
+        if (len == 0)
+            break;
+        buf[len] = 0;
+        respStr += (const char*)buf;
+    }
+    return true;
+}
+
+FileResponseFiller FileManager::getFilesJSONFiller(const String& fileSystemStr, const String& folderStr,
+            const FileListPage& page, String& respStr)
+{
+    std::shared_ptr<FileListStream> pStream = std::make_shared<FileListStream>();
+    if (!fileListStart(fileSystemStr, folderStr, page, respStr, *pStream))
+        return NULL;
+    return [this, pStream](uint8_t* pBuf, size_t maxLen, size_t index) {
+        return fileListFill(*pStream, pBuf, maxLen);
+    };
+}
+
+bool FileManager::getFileListChangeJSON(String& jsonStr)
+{
+    if (_fileListChangeCount == _fileListNotifiedCount)
+        return false;
+    if (xSemaphoreTake(_fileSysMutex, 0) != pdTRUE)
+        return false;
+    jsonStr = "{\"folder\":\"" + _fileListChangedFolder + "\",\"changes\":" +
+                String(_fileListChangeCount - _fileListNotifiedCount) + "}";
+    _fileListNotifiedCount = _fileListChangeCount;
+    xSemaphoreGive(_fileSysMutex);
+    return true;
+}
+
+bool FileManager::fileListStart(const String& fileSystemStr, const String& folderStr, const FileListPage& page,
+            String& respStr, FileListStream& stream)
 {
     // Check file system supported
     String nameOfFS;
@@ -210,15 +269,8 @@ bool FileManager::getFilesJSON(const String& fileSystemStr, const String& folder
         return false;
     }
 
-    // Check if cached version can be used
-    if ((_cachedFileListValid) && (_cachedFileListResponse.length() != 0))
-    {
-        respStr = _cachedFileListResponse;
-        return true;
-        
-    }
     // Take mutex
-    if (xSemaphoreTake(_fileSysMutex, 0) != pdTRUE)
+    if (xSemaphoreTake(_fileSysMutex, RESPONSE_MUTEX_WAIT_MS / portTICK_PERIOD_MS) != pdTRUE)
     {
         respStr = "{\"rslt\":\"fail\",\"error\":\"fsbusy\",\"files\":[]}";
         return false;
@@ -271,15 +323,16 @@ bool FileManager::getFilesJSON(const String& fileSystemStr, const String& folder
     // Check file system is valid
     if (fsSizeBytes == 0)
     {
+        xSemaphoreGive(_fileSysMutex);
         Log.warning("%sgetFilesJSON No valid file system\n", MODULE_PREFIX);
         respStr = "{\"rslt\":\"fail\",\"error\":\"NOFS\",\"files\":[]}";
         return false;
     }
 
-    // Open directory
+    // Index of the folder (built now if it isn't already)
     String rootFolder = (folderStr.startsWith("/") ? baseFolderForFS + folderStr : (baseFolderForFS + "/" + folderStr));
-    DIR* dir = opendir(rootFolder.c_str());
-    if (!dir)
+    FileDirIndex* pIndex = getDirIndex(rootFolder, nameOfFS == "spiffs", true);
+    if (!pIndex)
     {
         xSemaphoreGive(_fileSysMutex);
         Log.warning("%sgetFilesJSON Failed to open base folder %s\n", MODULE_PREFIX, rootFolder.c_str());
@@ -287,52 +340,133 @@ bool FileManager::getFilesJSON(const String& fileSystemStr, const String& folder
         return false;
     }
 
-    // Start response JSON
-    respStr = "{\"rslt\":\"ok\",\"fsName\":\"" + nameOfFS + "\",\"fsBase\":\"" + baseFolderForFS + 
+    // Copy the page of the list
+    uint32_t total = pIndex->count();
+    uint32_t startPosn = page.offset < total ? page.offset : total;
+    uint32_t endPosn = ((page.count == 0) || (total - startPosn < page.count)) ? total : startPosn + page.count;
+    stream.sizes.reserve(endPosn - startPosn);
+    for (uint32_t posn = startPosn; posn < endPosn; posn++)
+    {
+        const char* pName = NULL;
+        uint32_t fileSize = 0;
+        if (!pIndex->getEntry(posn, page.sortKey, page.descending, pName, fileSize))
+            break;
+        stream.names.insert(stream.names.end(), pName, pName + strlen(pName) + 1);
+        stream.sizes.push_back(fileSize);
+    }
+    xSemaphoreGive(_fileSysMutex);
+    stream.entryIdx = 0;
+    stream.nameOff = 0;
+    stream.pendingPos = 0;
+    stream.isDone = false;
+
+    // Start of response JSON (sent before the files)
+    stream.pending = "{\"rslt\":\"ok\",\"fsName\":\"" + nameOfFS + "\",\"fsBase\":\"" + baseFolderForFS + 
                 "\",\"diskSize\":" + String(fsSizeBytes) + ",\"diskUsed\":" + fsUsedBytes +
-                ",\"folder\":\"" + String(rootFolder) + "\",\"files\":[";
-    bool firstFile = true;
+                ",\"folder\":\"" + String(rootFolder) + "\",\"total\":" + String(total) +
+                ",\"offset\":" + String(startPosn) + ",\"files\":[";
+    return true;
+}
 
-    // Read directory entries
-    struct dirent* ent = NULL;
-    while ((ent = readdir(dir)) != NULL) 
+size_t FileManager::fileListFill(FileListStream& stream, uint8_t* pBuf, size_t maxLen)
+{
+    size_t len = 0;
+    while (len < maxLen)
     {
-        // Check for unwanted files
-        String fName = ent->d_name;
-        if (fName.equalsIgnoreCase("System Volume Information"))
-            continue;
-        if (fName.equalsIgnoreCase("thumbs.db"))
+        // Text already generated goes first
+        if (stream.pendingPos < stream.pending.length())
+        {
+            size_t copyLen = stream.pending.length() - stream.pendingPos;
+            if (copyLen > maxLen - len)
+                copyLen = maxLen - len;
+            memcpy(pBuf + len, stream.pending.c_str() + stream.pendingPos, copyLen);
+            len += copyLen;
+            stream.pendingPos += copyLen;
             continue;
+        }
+        if (stream.isDone)
+            break;
 
-        // Get file info including size
-        size_t fileSize = 0;
-        struct stat st;
-        String filePath = (rootFolder.endsWith("/") ? rootFolder + fName : rootFolder + "/" + fName);
-        if (stat(filePath.c_str(), &st) == 0) 
+        // Next file (or the end of the list)
+        stream.pendingPos = 0;
+        if (stream.entryIdx < stream.sizes.size())
+        {
+            const char* pName = stream.names.data() + stream.nameOff;
+            stream.pending = (stream.entryIdx == 0) ? "{\"name\":\"" : ",{\"name\":\"";
+            if (strpbrk(pName, "\"\\"))
+            {
+                for (const char* pCh = pName; *pCh; pCh++)
+                {
+                    if ((*pCh == '"') || (*pCh == '\\'))
+                        stream.pending += '\\';
+                    stream.pending += *pCh;
+                }
+            }
+            else
+            {
+                stream.pending += pName;
+            }
+            stream.pending += "\",\"size\":";
+            stream.pending += String(stream.sizes[stream.entryIdx]);
+            stream.pending += "}";
+            stream.nameOff += strlen(pName) + 1;
+            stream.entryIdx++;
+        }
+        else
         {
-            fileSize = st.st_size;
+            stream.pending = "]}";
+            stream.isDone = true;
         }
-
-        // Form the JSON list
-        if (!firstFile)
-            respStr += ",";
-        firstFile = false;
-        respStr += "{\"name\":\"";
-        respStr += ent->d_name;
-        respStr += "\",\"size\":";
-        respStr += String(fileSize);
-        respStr += "}";
     }
+    return len;
+}
 
-    // Finished with file list
-    closedir(dir);
-    xSemaphoreGive(_fileSysMutex);
+FileDirIndex* FileManager::findDirIndex(const String& folder)
+{
+    String folderPath = folder.endsWith("/") ? folder : folder + "/";
+    for (int i = 0; i < NUM_DIR_INDEXES; i++)
+        if (_dirIndexes[i].getFolder() == folderPath)
+            return &_dirIndexes[i];
+    return NULL;
+}
 
-    // Complete string and replenish cache
-    respStr += "]}";
-    _cachedFileListResponse = respStr;
-    _cachedFileListValid = true;
-    return true;
+// Index of a folder - a folder not already indexed replaces the least recently used index
+// and if mustComplete is set it is built now (otherwise it is built by service)
+FileDirIndex* FileManager::getDirIndex(const String& folder, bool flatNames, bool mustComplete)
+{
+    FileDirIndex* pIndex = findDirIndex(folder);
+    if (!pIndex)
+    {
+        int lruIdx = 0;
+        for (int i = 1; i < NUM_DIR_INDEXES; i++)
+            if (_dirIndexUsedMs[i] < _dirIndexUsedMs[lruIdx])
+                lruIdx = i;
+        pIndex = &_dirIndexes[lruIdx];
+        if (!pIndex->buildStart(folder, flatNames))
+        {
+            _dirIndexUsedMs[lruIdx] = 0;
+            return NULL;
+        }
+    }
+    _dirIndexUsedMs[pIndex - _dirIndexes] = millis();
+    if (mustComplete && !pIndex->isComplete())
+    {
+        unsigned long startMs = millis();
+        while (!pIndex->buildSome(DIR_INDEX_ENTRIES_PER_SERVICE))
+            ;
+        Log.trace("%sindexed %s %d files %dms\n", MODULE_PREFIX, pIndex->getFolder().c_str(),
+                    pIndex->count(), millis() - startMs);
+    }
+    return pIndex;
+}
+
+// Keep folder indexes up to date and note the change for clients
+void FileManager::dirIndexFileChanged(const String& path, bool removed, uint32_t size)
+{
+    for (int i = 0; i < NUM_DIR_INDEXES; i++)
+        _dirIndexes[i].fileChanged(path.c_str(), removed, size);
+    _fileListChangeCount++;
+    _fileListChangedFolder = path.substring(0, path.lastIndexOf('/') + 1);
 }
 
 String FileManager::getFileContents(const String& fileSystemStr, const String& filename, int maxLen)
@@ -406,6 +540,188 @@ String FileManager::getFileContents(const String& fileSystemStr, const String& f
     return readData;
 }
 
+FileResponseFiller FileManager::getFileFiller(const String& fileSystemStr, const String& filename, int& fileLen)
+{
+    // Check file system supported
+    String nameOfFS;
+    if (!checkFileSystem(fileSystemStr, nameOfFS))
+    {
+        Log.trace("%sgetFileFiller %s invalid file system %s\n", MODULE_PREFIX, filename.c_str(), fileSystemStr.c_str());
+        return NULL;
+    }
+
+    // Take mutex
+    if (xSemaphoreTake(_fileSysMutex, RESPONSE_MUTEX_WAIT_MS / portTICK_PERIOD_MS) != pdTRUE)
+    {
+        Log.trace("%sgetFileFiller %s file system busy\n", MODULE_PREFIX, filename.c_str());
+        return NULL;
+    }
+
+    // Check it is a file and open
+    String rootFilename = getFilePath(nameOfFS, filename);
+    struct stat st;
+    if ((stat(rootFilename.c_str(), &st) != 0) || !S_ISREG(st.st_mode))
+    {
+        xSemaphoreGive(_fileSysMutex);
+        Log.trace("%sgetFileFiller %s not a file\n", MODULE_PREFIX, rootFilename.c_str());
+        return NULL;
+    }
+    FILE* pFile = fopen(rootFilename.c_str(), "rb");
+    xSemaphoreGive(_fileSysMutex);
+    if (!pFile)
+    {
+        Log.trace("%sgetFileFiller failed to open file to read %s\n", MODULE_PREFIX, rootFilename.c_str());
+        return NULL;
+    }
+
+    // The file is closed when the filler is destroyed (at the end of the response)
+    fileLen = st.st_size;
+    std::shared_ptr<FileReadStream> pStream = std::make_shared<FileReadStream>(*this, pFile, fileLen);
+    return [pStream](uint8_t* pBuf, size_t maxLen, size_t index) {
+        return pStream->read(pBuf, maxLen, index);
+    };
+}
+
+FileManager::FileReadStream::FileReadStream(FileManager& fileManager, FILE* pFile, uint32_t fileLen) :
+            _fileManager(fileManager)
+{
+    _pFile = pFile;
+    _fileLen = fileLen;
+    _filePos = 0;
+}
+
+FileManager::FileReadStream::~FileReadStream()
+{
+    if (xSemaphoreTake(_fileManager._fileSysMutex, FILE_STREAM_MUTEX_WAIT_MS / portTICK_PERIOD_MS) == pdTRUE)
+    {
+        fclose(_pFile);
+        xSemaphoreGive(_fileManager._fileSysMutex);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_fileManager._filesToCloseMutex);
+    _fileManager._filesToClose.push_back(_pFile);
+}
+
+size_t FileManager::FileReadStream::read(uint8_t* pBuf, size_t maxLen, size_t filePos)
+{
+    if (filePos >= _fileLen)
+        return 0;
+    if (maxLen > FILE_READ_ALIGN)
+        maxLen -= maxLen % FILE_READ_ALIGN;
+    if (xSemaphoreTake(_fileManager._fileSysMutex, FILE_STREAM_MUTEX_WAIT_MS / portTICK_PERIOD_MS) != pdTRUE)
+        return FILE_FILL_TRY_AGAIN;
+    if ((filePos != _filePos) && (fseek(_pFile, filePos, SEEK_SET) != 0))
+    {
+        xSemaphoreGive(_fileManager._fileSysMutex);
+        return 0;
+    }
+    size_t bytesRead = fread(pBuf, 1, maxLen, _pFile);
+    _filePos = filePos + bytesRead;
+    xSemaphoreGive(_fileManager._fileSysMutex);
+    return bytesRead;
+}
+
+// Close files left open by streamed responses (called with the file system mutex held)
+void FileManager::closeFilesToClose()
+{
+    std::lock_guard<std::mutex> lock(_filesToCloseMutex);
+    for (FILE* pFile : _filesToClose)
+        fclose(pFile);
+    _filesToClose.clear();
+}
+
+String FileManager::getFileSection(const String& fileSystemStr, const String& filename, int filePos, int len)
+{
+    // Check file system supported
+    String nameOfFS;
+    if (!checkFileSystem(fileSystemStr, nameOfFS) || (filePos < 0) || (len <= 0))
+        return "";
+
+    // Take mutex
+    xSemaphoreTake(_fileSysMutex, portMAX_DELAY);
+
+    // Open file and seek
+    String rootFilename = getFilePath(nameOfFS, filename);
+    FILE* pFile = fopen(rootFilename.c_str(), "rb");
+    if (!pFile)
+    {
+        xSemaphoreGive(_fileSysMutex);
+        Log.trace("%sgetSection failed to open file to read %s\n", MODULE_PREFIX, rootFilename.c_str());
+        return "";
+    }
+    if (fseek(pFile, filePos, SEEK_SET) != 0)
+    {
+        fclose(pFile);
+        xSemaphoreGive(_fileSysMutex);
+        Log.trace("%sgetSection failed to seek %s pos %d\n", MODULE_PREFIX, rootFilename.c_str(), filePos);
+        return "";
+    }
+
+    // Buffer
+    uint8_t* pBuf = new uint8_t[len+1];
+    if (!pBuf)
+    {
+        fclose(pFile);
+        xSemaphoreGive(_fileSysMutex);
+        Log.trace("%sgetSection failed to allocate %d\n", MODULE_PREFIX, len);
+        return "";
+    }
+
+    // Read
+    size_t bytesRead = fread((char*)pBuf, 1, len, pFile);
+    fclose(pFile);
+    xSemaphoreGive(_fileSysMutex);
+    pBuf[bytesRead] = 0;
+    String readData = (char*)pBuf;
+    delete [] pBuf;
+    return readData;
+}
+
+bool FileManager::readFileLines(const String& fileSystemStr, const String& filename, FileLineCallback lineCallback)
+{
+    // Check file system supported
+    String nameOfFS;
+    if (!checkFileSystem(fileSystemStr, nameOfFS))
+        return false;
+
+    // Reader (buffer is too big for the stack)
+    FileStreamReader* pReader = new FileStreamReader();
+    if (!pReader)
+        return false;
+
+    // Take mutex
+    xSemaphoreTake(_fileSysMutex, portMAX_DELAY);
+
+    // Open
+    String rootFilename = getFilePath(nameOfFS, filename);
+    if (!pReader->open(rootFilename.c_str(), true))
+    {
+        xSemaphoreGive(_fileSysMutex);
+        delete pReader;
+        Log.trace("%sreadLines failed to open file to read %s\n", MODULE_PREFIX, rootFilename.c_str());
+        return false;
+    }
+
+    // Lines
+    while (true)
+    {
+        int filePos = pReader->getPos();
+        const char* pLine = NULL;
+        int lineLen = 0;
+        if (pReader->nextLine(pLine, lineLen))
+        {
+            lineCallback(pLine, lineLen, filePos);
+            continue;
+        }
+        if (!pReader->fill() && pReader->isAtEnd())
+            break;
+    }
+    pReader->close();
+    xSemaphoreGive(_fileSysMutex);
+    delete pReader;
+    return true;
+}
+
 bool FileManager::setFileContents(const String& fileSystemStr, const String& filename, String& fileContents)
 {
     // Check file system supported
@@ -425,7 +741,7 @@ bool FileManager::setFileContents(const String& fileSystemStr, const String& fil
     {
         xSemaphoreGive(_fileSysMutex);
         Log.trace("%ssetContents failed to open file to write %s\n", MODULE_PREFIX, rootFilename.c_str());
-        return "";
+        return false;
     }
 
     // Write
@@ -433,21 +749,20 @@ bool FileManager::setFileContents(const String& fileSystemStr, const String& fil
     fclose(pFile);
 
     // Clean up
-    _cachedFileListValid = false;
+    dirIndexFileChanged(rootFilename, false, bytesWritten);
     xSemaphoreGive(_fileSysMutex);
     return bytesWritten == fileContents.length();
 }
 
 void FileManager::uploadAPIBlocksComplete()
 {
-    // Cached file list now invalid
-    _cachedFileListValid = false;
+    // File list is updated when the final block is renamed
 }
 
 void FileManager::uploadAPIBlockHandler(const char* fileSystem, const String& req, const String& filename, 
                     int fileLength, size_t index, uint8_t *data, size_t len, bool finalBlock)
 {
-    Log.trace("%suploadAPIBlockHandler fileSys %s, filename %s, total %d, idx %d, len %d, final %d\n", MODULE_PREFIX, 
+    Log.verbose("%suploadAPIBlockHandler fileSys %s, filename %s, total %d, idx %d, len %d, final %d\n", MODULE_PREFIX, 
                 fileSystem, filename.c_str(), fileLength, index, len, finalBlock);
 
     // Check file system supported
@@ -457,46 +772,76 @@ void FileManager::uploadAPIBlockHandler(const char* fileSystem, const String& re
 
     // Take mutex
     xSemaphoreTake(_fileSysMutex, portMAX_DELAY);
-    String tempFileName = "/__tmp__";
-    String tmpRootFilename = getFilePath(nameOfFS, tempFileName);
-    FILE* pFile = NULL;
 
-    // Check if we should overwrite or append
-    if (index > 0)
-        pFile = fopen(tmpRootFilename.c_str(), "ab");
-    else
-        pFile = fopen(tmpRootFilename.c_str(), "wb");
-    if (!pFile)
+    // Start the session on the first block (abandoning any upload which didn't complete)
+    if (index == 0)
+    {
+        if (_uploadWriter.isOpen())
+        {
+            Log.notice("%supload restarted - previous upload abandoned\n", MODULE_PREFIX);
+            _uploadWriter.close();
+        }
+        _uploadTmpFilename = getFilePath(nameOfFS, "/__tmp__");
+        _uploadWriteFailed = false;
+        if (!_uploadWriter.open(_uploadTmpFilename.c_str()))
+        {
+            xSemaphoreGive(_fileSysMutex);
+            Log.trace("%suploadBlock failed to open file to write %s\n", MODULE_PREFIX, _uploadTmpFilename.c_str());
+            return;
+        }
+    }
+    else if (!_uploadWriter.isOpen())
     {
         xSemaphoreGive(_fileSysMutex);
-        Log.trace("%suploadBlock failed to open file to write %s\n", MODULE_PREFIX, tmpRootFilename.c_str());
+        Log.trace("%suploadBlock no upload in progress (idx %d)\n", MODULE_PREFIX, index);
         return;
     }
+    _uploadLastBlockMs = millis();
 
-    // Write file block to temporary file
-    size_t bytesWritten = fwrite(data, 1, len, pFile);
-    fclose(pFile);
-    if (bytesWritten != len)
+    // Write file block to temporary file (remembering a failure for the final block)
+    if (!_uploadWriter.write(data, len))
     {
-        Log.trace("%suploadBlock write failed %s (written %d != len %d)\n", MODULE_PREFIX, tmpRootFilename.c_str(), bytesWritten, len);
+        _uploadWriteFailed = true;
+        Log.trace("%suploadBlock write failed %s idx %d len %d\n", MODULE_PREFIX, _uploadTmpFilename.c_str(), index, len);
     }
 
-    // Rename if last block
+    // Close and rename if last block
     if (finalBlock)
     {
+        // (buffered data is written on close so a full file system may only show up here)
+        bool writeOk = _uploadWriter.close() && !_uploadWriteFailed;
+        Log.notice("%supload %s %s bytes %d writes %d %dms %FMB/s\n", MODULE_PREFIX, filename.c_str(),
+                    writeOk ? "ok" : "WRITE FAILED", _uploadWriter.getBytesWritten(), _uploadWriter.getFileWrites(),
+                    _uploadWriter.getElapsedMs(), _uploadWriter.getMBPerSec());
+
+        // Discard a failed upload leaving any existing file (and its index entry) as it was
+        if (!writeOk)
+        {
+            unlink(_uploadTmpFilename.c_str());
+            xSemaphoreGive(_fileSysMutex);
+            return;
+        }
+
         // Check if destination file exists before renaming
         struct stat st;
         String rootFilename = getFilePath(nameOfFS, filename);
+        bool destRemoved = false;
         if (stat(rootFilename.c_str(), &st) == 0) 
         {
             // Remove in case filename already exists
-            unlink(rootFilename.c_str());
+            destRemoved = unlink(rootFilename.c_str()) == 0;
         }
 
         // Rename
-        if (rename(tmpRootFilename.c_str(), rootFilename.c_str()) != 0)
+        if (rename(_uploadTmpFilename.c_str(), rootFilename.c_str()) != 0)
         {
-            Log.trace("%sfailed rename %s to %s\n", MODULE_PREFIX, tmpRootFilename.c_str(), rootFilename.c_str());
+            Log.trace("%sfailed rename %s to %s\n", MODULE_PREFIX, _uploadTmpFilename.c_str(), rootFilename.c_str());
+            if (destRemoved)
+                dirIndexFileChanged(rootFilename, true, 0);
+        }
+        else
+        {
+            dirIndexFileChanged(rootFilename, false, _uploadWriter.getBytesWritten());
         }
     }
 
@@ -504,6 +849,42 @@ void FileManager::uploadAPIBlockHandler(const char* fileSystem, const String& re
     xSemaphoreGive(_fileSysMutex);
 }
 
+void FileManager::service()
+{
+    // Check for a stalled upload, an index being built or files to close
+    bool indexBuilding = false;
+    for (int i = 0; i < NUM_DIR_INDEXES; i++)
+        if ((_dirIndexes[i].getFolder().length() != 0) && !_dirIndexes[i].isComplete())
+            indexBuilding = true;
+    bool filesToClose = false;
+    {
+        std::lock_guard<std::mutex> lock(_filesToCloseMutex);
+        filesToClose = !_filesToClose.empty();
+    }
+    if (!indexBuilding && !filesToClose &&
+                (!_uploadWriter.isOpen() || !Utils::isTimeout(millis(), _uploadLastBlockMs, UPLOAD_BLOCK_TIMEOUT_MS)))
+        return;
+    if (xSemaphoreTake(_fileSysMutex, 0) != pdTRUE)
+        return;
+
+    // Files left open by streamed responses
+    if (filesToClose)
+        closeFilesToClose();
+
+    // Discard an upload which has stalled
+    if (_uploadWriter.isOpen() && Utils::isTimeout(millis(), _uploadLastBlockMs, UPLOAD_BLOCK_TIMEOUT_MS))
+    {
+        _uploadWriter.close();
+        unlink(_uploadTmpFilename.c_str());
+        Log.notice("%supload timed out after %d bytes\n", MODULE_PREFIX, _uploadWriter.getBytesWritten());
+    }
+
+    // Build indexes a few entries at a time
+    for (int i = 0; i < NUM_DIR_INDEXES; i++)
+        _dirIndexes[i].buildSome(DIR_INDEX_ENTRIES_PER_SERVICE);
+    xSemaphoreGive(_fileSysMutex);
+}
+
 bool FileManager::deleteFile(const String& fileSystemStr, const String& filename)
 {
     // Check file system supported
@@ -521,10 +902,10 @@ bool FileManager::deleteFile(const String& fileSystemStr, const String& filename
     String rootFilename = getFilePath(nameOfFS, filename);
     if (stat(rootFilename.c_str(), &st) == 0) 
     {
-        unlink(rootFilename.c_str());
+        if (unlink(rootFilename.c_str()) == 0)
+            dirIndexFileChanged(rootFilename, true, 0);
     }
 
-    _cachedFileListValid = false;
     xSemaphoreGive(_fileSysMutex);   
     return true;
 }
@@ -551,6 +932,14 @@ bool FileManager::chunkedFileStart(const String& fileSystemStr, const String& fi
         return false;
     }
     _chunkedFileLen = st.st_size;
+
+    // Open the file - it stays open until the final chunk
+    if (!_chunkedFileReader.open(rootFilename.c_str(), !readByLine))
+    {
+        Log.trace("%schunked file failed open %s\n", MODULE_PREFIX, rootFilename.c_str());
+        xSemaphoreGive(_fileSysMutex);
+        return false;
+    }
     xSemaphoreGive(_fileSysMutex);  
     
     // Setup access
@@ -563,6 +952,14 @@ bool FileManager::chunkedFileStart(const String& fileSystemStr, const String& fi
     return true; 
 }
 
+void FileManager::chunkedFileEnd()
+{
+    xSemaphoreTake(_fileSysMutex, portMAX_DELAY);
+    _chunkedFileReader.close();
+    xSemaphoreGive(_fileSysMutex);
+    _chunkedFileInProgress = false;
+}
+
 char* FileManager::readLineFromFile(char* pBuf, int maxLen, FILE* pFile)
 {
     // Iterate over chars
@@ -591,6 +988,31 @@ char* FileManager::readLineFromFile(char* pBuf, int maxLen, FILE* pFile)
     return pBuf;
 }
 
+bool FileManager::chunkFileNextLine(const char*& pLine, int& lineLen, bool& finalChunk)
+{
+    // Check valid
+    lineLen = 0;
+    if (!_chunkedFileInProgress)
+        return false;
+
+    // The file system is only accessed when the buffer runs out of complete lines
+    while (!_chunkedFileReader.nextLine(pLine, lineLen))
+    {
+        if (_chunkedFileReader.isAtEnd())
+        {
+            Log.verbose("%schunkNextLine filename %s finished\n", MODULE_PREFIX, _chunkedFilename.c_str());
+            finalChunk = true;
+            chunkedFileEnd();
+            return false;
+        }
+        xSemaphoreTake(_fileSysMutex, portMAX_DELAY);
+        _chunkedFileReader.fill();
+        xSemaphoreGive(_fileSysMutex);
+    }
+    _chunkedFilePos = _chunkedFileReader.getPos();
+    return true;
+}
+
 uint8_t* FileManager::chunkFileNext(String& filename, int& fileLen, int& chunkPos, int& chunkLen, bool& finalChunk)
 {
     // Check valid
@@ -603,71 +1025,38 @@ uint8_t* FileManager::chunkFileNext(String& filename, int& fileLen, int& chunkPo
     fileLen = _chunkedFileLen;
     chunkPos = _chunkedFilePos;
 
-    // Take mutex
-    xSemaphoreTake(_fileSysMutex, portMAX_DELAY);
-
-    // Open file and seek
-    FILE* pFile = NULL;
-    if (_chunkOnLineEndings)
-        pFile = fopen(_chunkedFilename.c_str(), "r");
-    else
-        pFile = fopen(_chunkedFilename.c_str(), "rb");
-    if (!pFile)
-    {
-            xSemaphoreGive(_fileSysMutex);  
-            Log.trace("%schunkNext failed open %s\n", MODULE_PREFIX, _chunkedFilename.c_str());
-            return NULL;
-    }    
-    if ((_chunkedFilePos != 0) && (fseek(pFile, _chunkedFilePos, SEEK_SET) != 0))
-    {
-        xSemaphoreGive(_fileSysMutex);  
-        Log.trace("%schunkNext failed seek in filename %s to %d\n", MODULE_PREFIX, 
-                        _chunkedFilename.c_str(), _chunkedFilePos);
-        fclose(pFile);
-        return NULL;
-    }
-
     // Handle data type
     if (_chunkOnLineEndings)
     {
-        // Read a line
-        char* pReadLine = readLineFromFile((char*)_chunkedFileBuffer, CHUNKED_BUF_MAXLEN-1, pFile);
-        // Ensure line is terminated
-        if (!pReadLine)
-        {
-            finalChunk = true;
-            _chunkedFileInProgress = false;
-            chunkLen = 0;
-        }
-        else
+        // Copy the next line
+        const char* pLine = NULL;
+        int lineLen = 0;
+        if (chunkFileNextLine(pLine, lineLen, finalChunk))
         {
-            chunkLen = strlen((char*)_chunkedFileBuffer);
+            chunkLen = std::min(lineLen, CHUNKED_BUF_MAXLEN-1);
+            memcpy(_chunkedFileBuffer, pLine, chunkLen);
         }
-        // Record position
-        _chunkedFilePos = ftell(pFile);
+        _chunkedFileBuffer[chunkLen] = 0;
     }
     else
     {
         // Fill the buffer with file data
-        chunkLen = fread((char*)_chunkedFileBuffer, 1, CHUNKED_BUF_MAXLEN, pFile);
+        xSemaphoreTake(_fileSysMutex, portMAX_DELAY);
+        chunkLen = _chunkedFileReader.readBlock(_chunkedFileBuffer, CHUNKED_BUF_MAXLEN);
+        xSemaphoreGive(_fileSysMutex);  
 
         // Record position and check if this was the final block
-        _chunkedFilePos = ftell(pFile);
+        _chunkedFilePos = _chunkedFileReader.getPos();
         if ((chunkLen != CHUNKED_BUF_MAXLEN) || (_chunkedFileLen <= _chunkedFilePos))
         {
             finalChunk = true;
-            _chunkedFileInProgress = false;
+            chunkedFileEnd();
         }
-
     }
 
     Log.verbose("%schunkNext filename %s chunklen %d filePos %d fileLen %d inprog %d final %d byLine %s\n", MODULE_PREFIX, 
                     _chunkedFilename.c_str(), chunkLen, _chunkedFilePos, _chunkedFileLen, 
                     _chunkedFileInProgress, finalChunk, (_chunkOnLineEndings ? "Y" : "N"));
-
-    // Close
-    fclose(pFile);
-    xSemaphoreGive(_fileSysMutex);  
     return _chunkedFileBuffer;
 }
 
@@ -4,7 +4,40 @@
 #pragma once
 
 #include <Arduino.h>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include "ConfigBase.h"
+#include "FileStreamReader.h"
+#include "FileUploadWriter.h"
+#include "FileDirIndex.h"
+
+// Callback for each line of a file - the line is null terminated (without line ending) and
+// filePos is the position of its start in the file
+typedef std::function<void(const char* pLine, int lineLen, int filePos)> FileLineCallback;
+
+// Fills the next part of a streamed response - returns the length filled (0 at the end) or
+// FILE_FILL_TRY_AGAIN if the file system is busy (the web server's RESPONSE_TRY_AGAIN so the
+// filler is called again later)
+typedef std::function<size_t(uint8_t* pBuf, size_t maxLen, size_t index)> FileResponseFiller;
+static const size_t FILE_FILL_TRY_AGAIN = 0xFFFFFFFF;
+
+// Page of a file list - count 0 for all files from offset
+class FileListPage
+{
+public:
+    FileListPage()
+    {
+        offset = 0;
+        count = 0;
+        sortKey = FileDirIndex::SORT_NAME;
+        descending = false;
+    }
+    uint32_t offset;
+    uint32_t count;
+    FileDirIndex::SortKey sortKey;
+    bool descending;
+};
 
 class FileManager
 {
@@ -15,7 +48,6 @@ private:
     bool _enableSD;
     bool _defaultToSPIFFS;
     bool _sdIsOk;
-    bool _cachedFileListValid;
 
     // SD card
     void* _pSDCard;
@@ -29,8 +61,72 @@ private:
     int _chunkedFileLen;
     bool _chunkOnLineEndings;
 
-    // Cached file list response
-    String _cachedFileListResponse;
+    // File is kept open while chunked access is in progress
+    FileStreamReader _chunkedFileReader;
+
+    // Upload session - the temporary file is kept open between blocks and is discarded if
+    // no block arrives for UPLOAD_BLOCK_TIMEOUT_MS or any block fails to write (the destination
+    // file is then left as it was)
+    FileUploadWriter _uploadWriter;
+    String _uploadTmpFilename;
+    unsigned long _uploadLastBlockMs;
+    bool _uploadWriteFailed;
+    static const unsigned long UPLOAD_BLOCK_TIMEOUT_MS = 20000;
+
+    // Indexes of the folders most recently listed - kept up to date as files are written
+    // and deleted (the default file system's root is indexed in the background on setup)
+    static const int NUM_DIR_INDEXES = 2;
+    FileDirIndex _dirIndexes[NUM_DIR_INDEXES];
+    unsigned long _dirIndexUsedMs[NUM_DIR_INDEXES];
+    static const int DIR_INDEX_ENTRIES_PER_SERVICE = 8;
+
+    // File list changes (for notifying clients) and the folder last changed
+    uint32_t _fileListChangeCount;
+    uint32_t _fileListNotifiedCount;
+    String _fileListChangedFolder;
+
+    // State of a file list being generated (a streamed response is filled in parts) - the page
+    // of entries is copied from the folder index at the start so filling doesn't need the file
+    // system mutex and the list is consistent if files change while it is sent
+    struct FileListStream
+    {
+        std::vector<char> names;
+        std::vector<uint32_t> sizes;
+        uint32_t entryIdx;
+        uint32_t nameOff;
+        String pending;
+        uint32_t pendingPos;
+        bool isDone;
+    };
+    static const int FILE_LIST_ENTRY_EST_LEN = 40;
+
+    // File being streamed in a response - open until the response ends - reads and the close
+    // are in the web server task which mustn't block so the file system mutex is only waited
+    // for briefly (a read returns FILE_FILL_TRY_AGAIN and the close is left to service())
+    class FileReadStream
+    {
+    public:
+        FileReadStream(FileManager& fileManager, FILE* pFile, uint32_t fileLen);
+        ~FileReadStream();
+        size_t read(uint8_t* pBuf, size_t maxLen, size_t filePos);
+    private:
+        FileManager& _fileManager;
+        FILE* _pFile;
+        uint32_t _fileLen;
+        uint32_t _filePos;
+    };
+    // Reads are whole multiples of this (when longer) so they stay aligned to SD sectors
+    static const int FILE_READ_ALIGN = 512;
+
+    // Waits for the file system mutex in web server callbacks - to start a response (which
+    // fails if the file system stays busy) and for each part of a streamed file
+    static const int RESPONSE_MUTEX_WAIT_MS = 100;
+    static const int FILE_STREAM_MUTEX_WAIT_MS = 5;
+
+    // Files of streamed responses which ended while the file system was busy - closed by service()
+    std::vector<FILE*> _filesToClose;
+    std::mutex _filesToCloseMutex;
+    void closeFilesToClose();
 
     // Mutex controlling access to file system
     SemaphoreHandle_t _fileSysMutex;
@@ -42,29 +138,58 @@ public:
         _spiffsIsOk = false;
         _enableSD = false;
         _sdIsOk = false;
-        _cachedFileListValid = false;
         _defaultToSPIFFS = true;
         _chunkedFileLen = 0;
         _chunkedFilePos = 0;
         _chunkedFileInProgress = false;
         _pSDCard = NULL;
+        _uploadLastBlockMs = 0;
+        _uploadWriteFailed = false;
+        for (int i = 0; i < NUM_DIR_INDEXES; i++)
+            _dirIndexUsedMs[i] = 0;
+        _fileListChangeCount = 0;
+        _fileListNotifiedCount = 0;
         _fileSysMutex = xSemaphoreCreateMutex();
     }
 
     // Configure
     void setup(ConfigBase& config, const char* pConfigPath = NULL);
 
+    // Service (times out uploads and builds folder indexes in the background)
+    void service();
+
     // Reformat
     void reformat(const String& fileSystemStr, String& respStr);
 
-    // Get a list of files on the file system as a JSON format string
-    // {"rslt":"ok","diskSize":123456,"diskUsed":1234,"folder":"/","files":[{"name":"file1.txt","size":223},{"name":"file2.txt","size":234}]}
-    bool getFilesJSON(const String& fileSystemStr, const String& folderStr, String& respStr);
+    // Get a list of files on the file system as a JSON format string - total is the number of
+    // files in the folder and offset the position of the first file listed
+    // {"rslt":"ok","diskSize":123456,"diskUsed":1234,"folder":"/","total":2,"offset":0,"files":[{"name":"file1.txt","size":223},{"name":"file2.txt","size":234}]}
+    bool getFilesJSON(const String& fileSystemStr, const String& folderStr, String& respStr,
+                const FileListPage& page = FileListPage());
+
+    // Get a filler which streams the same list - returns NULL (and the error in respStr) if
+    // the list can't be generated
+    FileResponseFiller getFilesJSONFiller(const String& fileSystemStr, const String& folderStr,
+                const FileListPage& page, String& respStr);
+
+    // Check if the file list has changed since last called - JSON gives the folder changed
+    // {"folder":"/sd/","changes":3}
+    bool getFileListChangeJSON(String& jsonStr);
 
     // Get/Set file contents as a string
     String getFileContents(const String& fileSystemStr, const String& filename, int maxLen=0);
     bool setFileContents(const String& fileSystemStr, const String& filename, String& fileContents);
 
+    // Get a filler which streams a file from any position - returns NULL if the file can't
+    // be opened
+    FileResponseFiller getFileFiller(const String& fileSystemStr, const String& filename, int& fileLen);
+
+    // Read part of a file as a string
+    String getFileSection(const String& fileSystemStr, const String& filename, int filePos, int len);
+
+    // Read a file line by line (without holding it in memory)
+    bool readFileLines(const String& fileSystemStr, const String& filename, FileLineCallback lineCallback);
+
     // Handle a file upload block - same API as ESPAsyncWebServer file handler
     void uploadAPIBlockHandler(const char* fileSystem, const String& req, const String& filename, int fileLength, size_t index, uint8_t *data, size_t len, bool finalBlock);
     void uploadAPIBlocksComplete();
@@ -81,6 +206,13 @@ public:
     // Get next chunk of file
     uint8_t* chunkFileNext(String& filename, int& fileLen, int& chunkPos, int& chunkLen, bool& finalChunk);
 
+    // Get next line of file (started with readByLine) without copying - the line
+    // is only valid until the next call
+    bool chunkFileNextLine(const char*& pLine, int& lineLen, bool& finalChunk);
+
+    // End chunked file access early
+    void chunkedFileEnd();
+
     // Get file name extension
     static String getFileExtension(String& filename);
 
@@ -93,5 +225,11 @@ public:
 private:
     bool checkFileSystem(const String& fileSystemStr, String& fsName);
     String getFilePath(const String& nameOfFS, const String& filename);
+    FileDirIndex* findDirIndex(const String& folder);
+    FileDirIndex* getDirIndex(const String& folder, bool flatNames, bool mustComplete);
+    void dirIndexFileChanged(const String& path, bool removed, uint32_t size);
+    bool fileListStart(const String& fileSystemStr, const String& folderStr, const FileListPage& page,
+                String& respStr, FileListStream& stream);
+    size_t fileListFill(FileListStream& stream, uint8_t* pBuf, size_t maxLen);
 
 };
@@ -0,0 +1,115 @@
+// FileStreamReader
+// Rob Dobson 2018-2019
+
+#include "FileStreamReader.h"
+
+FileStreamReader::FileStreamReader()
+{
+    _pFile = NULL;
+    _dataStart = 0;
+    _dataEnd = 0;
+    _fileReadPos = 0;
+    _fileEnded = true;
+}
+
+FileStreamReader::~FileStreamReader()
+{
+    close();
+}
+
+bool FileStreamReader::open(const char* pFilename, bool binaryMode)
+{
+    close();
+    _pFile = fopen(pFilename, binaryMode ? "rb" : "r");
+    if (!_pFile)
+        return false;
+    _fileEnded = false;
+    return true;
+}
+
+void FileStreamReader::close()
+{
+    if (_pFile)
+        fclose(_pFile);
+    _pFile = NULL;
+    _dataStart = 0;
+    _dataEnd = 0;
+    _fileReadPos = 0;
+    _fileEnded = true;
+}
+
+bool FileStreamReader::nextLine(const char*& pLine, int& lineLen)
+{
+    // Look for the end of a line in the buffered data
+    char* pStart = _buffer + _dataStart;
+    char* pEnd = (char*)memchr(pStart, '\n', _dataEnd - _dataStart);
+    if (pEnd)
+    {
+        _dataStart = pEnd + 1 - _buffer;
+    }
+    else if ((_fileEnded && (_dataStart != _dataEnd)) || ((_dataStart == 0) && (_dataEnd == STREAM_BUF_SIZE)))
+    {
+        // Final line without line ending or line is longer than the buffer (split it)
+        pEnd = _buffer + _dataEnd;
+        _dataStart = _dataEnd;
+    }
+    else
+    {
+        return false;
+    }
+
+    // Terminate in place and remove carriage return
+    *pEnd = 0;
+    if ((pEnd > pStart) && (*(pEnd - 1) == '\r'))
+        *(--pEnd) = 0;
+    pLine = pStart;
+    lineLen = pEnd - pStart;
+    return true;
+}
+
+bool FileStreamReader::fill()
+{
+    if (!_pFile || _fileEnded)
+        return false;
+
+    // Move any partial line down to make room for at least a block
+    if ((_dataStart != 0) && (STREAM_BUF_SIZE - _dataEnd < STREAM_BLOCK_SIZE))
+    {
+        memmove(_buffer, _buffer + _dataStart, _dataEnd - _dataStart);
+        _dataEnd -= _dataStart;
+        _dataStart = 0;
+    }
+
+    // Read as much as will fit
+    int toRead = STREAM_BUF_SIZE - _dataEnd;
+    if (toRead <= 0)
+        return true;
+    int numRead = fread(_buffer + _dataEnd, 1, toRead, _pFile);
+    if (numRead < toRead)
+        _fileEnded = true;
+    _dataEnd += numRead;
+    _fileReadPos += numRead;
+    return numRead > 0;
+}
+
+int FileStreamReader::readBlock(uint8_t* pBuf, int maxLen)
+{
+    // Use up buffered data first
+    int numCopied = std::min(maxLen, _dataEnd - _dataStart);
+    if (numCopied > 0)
+    {
+        memcpy(pBuf, _buffer + _dataStart, numCopied);
+        _dataStart += numCopied;
+    }
+
+    // Read the remainder directly
+    if ((numCopied < maxLen) && _pFile && !_fileEnded)
+    {
+        int numRead = fread(pBuf + numCopied, 1, maxLen - numCopied, _pFile);
+        if (numRead < maxLen - numCopied)
+            _fileEnded = true;
+        _fileReadPos += numRead;
+        numCopied += numRead;
+    }
+    return numCopied;
+}
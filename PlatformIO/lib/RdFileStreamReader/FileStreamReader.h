@@ -0,0 +1,62 @@
+// FileStreamReader
+// Rob Dobson 2018-2019
+
+// Keeps a file open and reads it in large blocks so that sequential access
+// (e.g. playing a pattern file line by line) doesn't need an open/seek/close
+// per line. Lines are split in place in the buffer and handed out as
+// (pointer, length) views which remain valid until the next call.
+
+#pragma once
+
+#include <Arduino.h>
+#include <stdio.h>
+
+class FileStreamReader
+{
+public:
+    // Buffer is two blocks - a block is read whenever at least one is free
+    static const int STREAM_BLOCK_SIZE = 1024;
+    static const int STREAM_BUF_SIZE = STREAM_BLOCK_SIZE * 2;
+
+    FileStreamReader();
+    ~FileStreamReader();
+
+    // Open/close
+    bool open(const char* pFilename, bool binaryMode);
+    void close();
+    bool isOpen()
+    {
+        return _pFile != NULL;
+    }
+
+    // Get the next line (without line ending) - returns false if a complete line
+    // isn't buffered, in which case fill() is needed unless isAtEnd()
+    bool nextLine(const char*& pLine, int& lineLen);
+
+    // Read more of the file into the buffer - returns false if at end of file
+    // (this is the only method which accesses the file system)
+    bool fill();
+
+    // Read raw data (not mixed with line access)
+    int readBlock(uint8_t* pBuf, int maxLen);
+
+    // All data has been returned
+    bool isAtEnd()
+    {
+        return _fileEnded && (_dataStart == _dataEnd);
+    }
+
+    // Position in file of next data to be returned
+    int getPos()
+    {
+        return _fileReadPos - (_dataEnd - _dataStart);
+    }
+
+private:
+    FILE* _pFile;
+    char _buffer[STREAM_BUF_SIZE + 1];
+    int _dataStart;
+    int _dataEnd;
+    int _fileReadPos;
+    bool _fileEnded;
+};
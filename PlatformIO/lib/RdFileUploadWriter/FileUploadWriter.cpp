@@ -0,0 +1,86 @@
+// FileUploadWriter
+// Rob Dobson 2018-2019
+
+#include "FileUploadWriter.h"
+
+FileUploadWriter::FileUploadWriter()
+{
+    _pFile = NULL;
+    _bufLen = 0;
+    _bytesWritten = 0;
+    _fileWrites = 0;
+    _writeFailed = false;
+    _openMs = 0;
+    _closeMs = 0;
+}
+
+FileUploadWriter::~FileUploadWriter()
+{
+    close();
+}
+
+bool FileUploadWriter::open(const char* pFilename)
+{
+    close();
+    _pFile = fopen(pFilename, "wb");
+    if (!_pFile)
+        return false;
+    // Writes are already whole blocks so don't buffer them again
+    setvbuf(_pFile, NULL, _IONBF, 0);
+    _bufLen = 0;
+    _bytesWritten = 0;
+    _fileWrites = 0;
+    _writeFailed = false;
+    _openMs = millis();
+    return true;
+}
+
+bool FileUploadWriter::write(const uint8_t* pData, int len)
+{
+    if (!_pFile)
+        return false;
+    _bytesWritten += len;
+
+    // Top up a partly filled buffer
+    if (_bufLen > 0)
+    {
+        int toCopy = std::min(len, UPLOAD_BLOCK_SIZE - _bufLen);
+        memcpy(_buffer + _bufLen, pData, toCopy);
+        _bufLen += toCopy;
+        pData += toCopy;
+        len -= toCopy;
+        if (_bufLen < UPLOAD_BLOCK_SIZE)
+            return !_writeFailed;
+        writeToFile(_buffer, UPLOAD_BLOCK_SIZE);
+        _bufLen = 0;
+    }
+
+    // Whole blocks are written directly and the remainder buffered
+    int directLen = len - (len % UPLOAD_BLOCK_SIZE);
+    if (directLen > 0)
+        writeToFile(pData, directLen);
+    memcpy(_buffer, pData + directLen, len - directLen);
+    _bufLen = len - directLen;
+    return !_writeFailed;
+}
+
+bool FileUploadWriter::close()
+{
+    if (!_pFile)
+        return false;
+    if (_bufLen > 0)
+        writeToFile(_buffer, _bufLen);
+    _bufLen = 0;
+    if (fclose(_pFile) != 0)
+        _writeFailed = true;
+    _pFile = NULL;
+    _closeMs = millis();
+    return !_writeFailed;
+}
+
+void FileUploadWriter::writeToFile(const uint8_t* pData, int len)
+{
+    _fileWrites++;
+    if (fwrite(pData, 1, len, _pFile) != (size_t)len)
+        _writeFailed = true;
+}
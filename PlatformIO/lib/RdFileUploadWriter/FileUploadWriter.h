@@ -0,0 +1,67 @@
+// FileUploadWriter
+// Rob Dobson 2018-2019
+
+// Keeps a file open for the whole of an upload and coalesces the blocks (which
+// arrive in whatever size the network delivers them) into writes of whole
+// sectors - so an upload doesn't need an open/append/close per block and the
+// file system doesn't do a read-modify-write of a partial sector on every write
+
+#pragma once
+
+#include <Arduino.h>
+#include <stdio.h>
+
+class FileUploadWriter
+{
+public:
+    // Size of each write - a multiple of the SD sector (512) and SPIFFS page (256)
+    static const int UPLOAD_BLOCK_SIZE = 4096;
+
+    FileUploadWriter();
+    ~FileUploadWriter();
+
+    // Open (truncating) - any file already open is closed first
+    bool open(const char* pFilename);
+
+    // Write data - returns false if a write to the file failed
+    bool write(const uint8_t* pData, int len);
+
+    // Write any buffered data and close - returns false if any write failed
+    bool close();
+
+    bool isOpen()
+    {
+        return _pFile != NULL;
+    }
+
+    // Stats for the current (or last) file
+    uint32_t getBytesWritten()
+    {
+        return _bytesWritten;
+    }
+    uint32_t getFileWrites()
+    {
+        return _fileWrites;
+    }
+    uint32_t getElapsedMs()
+    {
+        return (_pFile ? millis() : _closeMs) - _openMs;
+    }
+    double getMBPerSec()
+    {
+        uint32_t elapsedMs = getElapsedMs();
+        return elapsedMs > 0 ? _bytesWritten / (elapsedMs * 1000.0) : 0;
+    }
+
+private:
+    FILE* _pFile;
+    uint8_t _buffer[UPLOAD_BLOCK_SIZE];
+    int _bufLen;
+    uint32_t _bytesWritten;
+    uint32_t _fileWrites;
+    bool _writeFailed;
+    unsigned long _openMs;
+    unsigned long _closeMs;
+
+    void writeToFile(const uint8_t* pData, int len);
+};
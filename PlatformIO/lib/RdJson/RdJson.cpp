@@ -21,21 +21,32 @@ bool RdJson::getElement(const char* dataPath,
         return false;
     }
 
+    // Find element
+    bool isValid = getElement(dataPath, startPos, strLen, objType, objSize,
+                              pSourceStr, pTokens, numTokens);
+    delete [] pTokens;
+    return isValid;
+}
+
+// Get location of element using tokens already parsed from the JSON string
+bool RdJson::getElement(const char* dataPath,
+                       int& startPos, int& strLen,
+                       jsmnrtype_t& objType, int& objSize,
+                       const char* pSourceStr,
+                       jsmnrtok_t* pTokens, int numTokens)
+{
     // Find token
     int startTokenIdx, endTokenIdx;
     bool isValid = getTokenByDataPath(pSourceStr, dataPath,
                                       pTokens, numTokens, startTokenIdx, endTokenIdx);
-    if (!isValid) {
-        delete[] pTokens;
+    if (!isValid)
         return false;
-    }
 
     // Extract information on element
     objType = pTokens[startTokenIdx].type;
     objSize = pTokens[startTokenIdx].size;
     startPos = pTokens[startTokenIdx].start;
     strLen = pTokens[startTokenIdx].end - startPos;
-    delete [] pTokens;
     return true;
 }
 
@@ -50,7 +61,14 @@ String RdJson::getString(const char* dataPath,
     isValid = getElement(dataPath, startPos, strLen, objType, objSize, pSourceStr);
     if (!isValid)
         return defaultValue;
+    return getElementString(pSourceStr, startPos, strLen, objType, objSize);
+}
 
+// Get the string for an element
+String RdJson::getElementString(const char* pSourceStr,
+                               int startPos, int strLen,
+                               jsmnrtype_t objType, int& objSize)
+{
     // Extract string
     String outStr;
     char* pStr = safeStringDup(pSourceStr + startPos, strLen,
@@ -158,7 +176,9 @@ const jsmnrtype_t RdJson::getType(int& arrayLen, const char* pSourceStr)
 
     // Get the type of the first token
     arrayLen = pTokens->size;
-    return pTokens->type;
+    jsmnrtype_t objType = pTokens->type;
+    delete[] pTokens;
+    return objType;
 }
 
 jsmnrtok_t* RdJson::parseJson(const char* jsonStr, int& numTokens,
@@ -22,6 +22,16 @@ public:
                            int& startPos, int& strLen,
                            jsmnrtype_t& objType, int& objSize,
                            const char* pSourceStr);
+    // Get location of element using tokens already parsed from the JSON string (see RdJsonDoc)
+    static bool getElement(const char* dataPath,
+                           int& startPos, int& strLen,
+                           jsmnrtype_t& objType, int& objSize,
+                           const char* pSourceStr,
+                           jsmnrtok_t* pTokens, int numTokens);
+    // Get the string for an element (objSize is set to the length for strings and primitives)
+    static String getElementString(const char* pSourceStr,
+                                   int startPos, int strLen,
+                                   jsmnrtype_t objType, int& objSize);
     // Get a string from the JSON
     static String getString(const char* dataPath,
                             const char* defaultValue, bool& isValid,
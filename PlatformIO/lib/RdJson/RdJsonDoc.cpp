@@ -0,0 +1,116 @@
+// RdJson
+// Rob Dobson 2017-2019
+
+#include "RdJsonDoc.h"
+
+RdJsonDoc::RdJsonDoc()
+{
+    _pTokens = NULL;
+    _numTokens = 0;
+}
+
+RdJsonDoc::RdJsonDoc(const char* pSourceStr)
+{
+    _pTokens = NULL;
+    _numTokens = 0;
+    parse(pSourceStr);
+}
+
+RdJsonDoc::~RdJsonDoc()
+{
+    delete [] _pTokens;
+}
+
+// Parse JSON
+bool RdJsonDoc::parse(const char* pSourceStr)
+{
+    // Clear previous
+    delete [] _pTokens;
+    _pTokens = NULL;
+    _numTokens = 0;
+    if (!pSourceStr)
+    {
+        _sourceStr = "";
+        return false;
+    }
+
+    // Keep the source as tokens refer to positions in it
+    _sourceStr = pSourceStr;
+    _pTokens = RdJson::parseJson(_sourceStr.c_str(), _numTokens);
+    return _pTokens != NULL;
+}
+
+// Get location of element in JSON string
+bool RdJsonDoc::getElement(const char* dataPath,
+                           int& startPos, int& strLen,
+                           jsmnrtype_t& objType, int& objSize)
+{
+    if (!_pTokens)
+        return false;
+    return RdJson::getElement(dataPath, startPos, strLen, objType, objSize,
+                              _sourceStr.c_str(), _pTokens, _numTokens);
+}
+
+// Get a string from the JSON
+String RdJsonDoc::getString(const char* dataPath,
+                            const char* defaultValue, bool& isValid,
+                            jsmnrtype_t& objType, int& objSize)
+{
+    // Find the element in the JSON
+    int startPos = 0, strLen = 0;
+    isValid = getElement(dataPath, startPos, strLen, objType, objSize);
+    if (!isValid)
+        return defaultValue;
+    return RdJson::getElementString(_sourceStr.c_str(), startPos, strLen, objType, objSize);
+}
+
+// Alternate form of getString with fewer parameters
+String RdJsonDoc::getString(const char* dataPath, const char* defaultValue, bool& isValid)
+{
+    jsmnrtype_t objType = JSMNR_UNDEFINED;
+    int objSize = 0;
+    return getString(dataPath, defaultValue, isValid, objType, objSize);
+}
+
+// Alternate form of getString with fewer parameters
+String RdJsonDoc::getString(const char* dataPath, const char* defaultValue)
+{
+    bool isValid = false;
+    return getString(dataPath, defaultValue, isValid);
+}
+
+double RdJsonDoc::getDouble(const char* dataPath, double defaultValue, bool& isValid)
+{
+    // Find the element in the JSON
+    int startPos = 0, strLen = 0;
+    jsmnrtype_t objType = JSMNR_UNDEFINED;
+    int objSize = 0;
+    isValid = getElement(dataPath, startPos, strLen, objType, objSize);
+    if (!isValid)
+        return defaultValue;
+    return strtod(_sourceStr.c_str() + startPos, NULL);
+}
+
+double RdJsonDoc::getDouble(const char* dataPath, double defaultValue)
+{
+    bool isValid = false;
+    return getDouble(dataPath, defaultValue, isValid);
+}
+
+long RdJsonDoc::getLong(const char* dataPath, long defaultValue, bool& isValid)
+{
+    // Find the element in the JSON
+    int startPos = 0, strLen = 0;
+    jsmnrtype_t objType = JSMNR_UNDEFINED;
+    int objSize = 0;
+    isValid = getElement(dataPath, startPos, strLen, objType, objSize);
+    if (!isValid)
+        return defaultValue;
+    return strtol(_sourceStr.c_str() + startPos, NULL, 10);
+}
+
+long RdJsonDoc::getLong(const char* dataPath, long defaultValue)
+{
+    bool isValid = false;
+    return getLong(dataPath, defaultValue, isValid);
+}
@@ -0,0 +1,60 @@
+// RdJson
+// Rob Dobson 2017-2019
+
+// Parsed JSON document - the source is tokenized once and each get... call then only
+// searches the token array. Use this when several values are read from the same JSON
+// (e.g. when configuring from a robot config). Data paths are the same as for RdJson
+
+#pragma once
+#include "RdJson.h"
+
+class RdJsonDoc {
+public:
+    RdJsonDoc();
+    RdJsonDoc(const char* pSourceStr);
+    ~RdJsonDoc();
+
+    // Parse JSON (a copy of the source is kept)
+    bool parse(const char* pSourceStr);
+
+    // Check the source was parsed
+    bool isValid()
+    {
+        return _pTokens != NULL;
+    }
+
+    // Get the source JSON
+    const char* getSource()
+    {
+        return _sourceStr.c_str();
+    }
+
+    // Get location of element in JSON string
+    bool getElement(const char* dataPath,
+                    int& startPos, int& strLen,
+                    jsmnrtype_t& objType, int& objSize);
+
+    // Get a string from the JSON
+    String getString(const char* dataPath,
+                     const char* defaultValue, bool& isValid,
+                     jsmnrtype_t& objType, int& objSize);
+
+    // Alternate forms of getString with fewer parameters
+    String getString(const char* dataPath, const char* defaultValue, bool& isValid);
+    String getString(const char* dataPath, const char* defaultValue);
+
+    double getDouble(const char* dataPath, double defaultValue, bool& isValid);
+    double getDouble(const char* dataPath, double defaultValue);
+
+    long getLong(const char* dataPath, long defaultValue, bool& isValid);
+    long getLong(const char* dataPath, long defaultValue);
+
+private:
+    String _sourceStr;
+    jsmnrtok_t* _pTokens;
+    int _numTokens;
+
+    // Not copyable as the tokens are owned
+    RdJsonDoc(const RdJsonDoc&);
+    RdJsonDoc& operator=(const RdJsonDoc&);
+};
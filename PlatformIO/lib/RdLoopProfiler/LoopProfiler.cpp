@@ -0,0 +1,346 @@
+// Loop profiler
+// Rob Dobson 2017-19
+
+#include "ArduinoLog.h"
+#include "LoopProfiler.h"
+
+thread_local LoopProfiler* LoopProfiler::_pCurrent = NULL;
+LoopProfiler* LoopProfiler::_pProfilers[LoopProfiler::MAX_PROFILERS];
+
+LoopProfiler::LoopProfiler(const char* name, long reportingPeriodMs, LoopProfiler_InfoStrCb infoStrCallback)
+{
+    _name = name;
+    _numSections = 0;
+    _writeSeq = 0;
+    _clearReqd = false;
+    _curSectionIdx = -1;
+    _lastLoopStartUs = 0;
+    _lastLoopUs = 0;
+    _lastLoopStartValid = false;
+    _lastReportMs = 0;
+    _reportingPeriodMs = reportingPeriodMs;
+    _infoStrCallback = infoStrCallback;
+    clearVals();
+    for (int i = 0; i < MAX_PROFILERS; i++)
+    {
+        if (!_pProfilers[i])
+        {
+            _pProfilers[i] = this;
+            break;
+        }
+    }
+}
+
+LoopProfiler::~LoopProfiler()
+{
+    if (_pCurrent == this)
+        _pCurrent = NULL;
+    for (int i = 0; i < MAX_PROFILERS; i++)
+        if (_pProfilers[i] == this)
+            _pProfilers[i] = NULL;
+}
+
+void LoopProfiler::attachToThisThread()
+{
+    _pCurrent = this;
+}
+
+void LoopProfiler::loopStart()
+{
+    // Clear if another thread asked (the loop time spans the clear so isn't recorded)
+    unsigned long nowUs = micros();
+    if (_clearReqd.exchange(false))
+    {
+        clearVals();
+        _lastLoopStartValid = false;
+    }
+
+    // Loop time and jitter (change in loop time)
+    if (_lastLoopStartValid)
+    {
+        uint32_t loopUs = nowUs - _lastLoopStartUs;
+        beginWrite();
+        _loopStats.add(loopUs);
+        _jitterStats.add(loopUs > _lastLoopUs ? loopUs - _lastLoopUs : _lastLoopUs - loopUs);
+        endWrite();
+        _lastLoopUs = loopUs;
+    }
+    _lastLoopStartUs = nowUs;
+    _lastLoopStartValid = true;
+    _curSectionIdx = -1;
+
+    // Every reporting period log a summary
+    if ((_reportingPeriodMs > 0) && (millis() - _lastReportMs > (unsigned long)_reportingPeriodMs))
+    {
+        logSummary();
+        _lastReportMs = millis();
+        clearVals();
+    }
+}
+
+int LoopProfiler::enter(const char* name)
+{
+    // Find the section in the current section - the name is usually the same literal as
+    // when the section was added so compare pointers before strings
+    int sectionIdx = -1;
+    int numSections = _numSections.load(std::memory_order_relaxed);
+    for (int i = 0; i < numSections; i++)
+    {
+        if ((_sections[i].parentIdx == _curSectionIdx) && (_sections[i].name == name))
+        {
+            sectionIdx = i;
+            break;
+        }
+    }
+    for (int i = 0; (sectionIdx < 0) && (i < numSections); i++)
+    {
+        if ((_sections[i].parentIdx == _curSectionIdx) && (strcmp(_sections[i].name, name) == 0))
+            sectionIdx = i;
+    }
+
+    // Add if new
+    if (sectionIdx < 0)
+    {
+        if (numSections >= MAX_SECTIONS)
+            return -1;
+        sectionIdx = numSections;
+        Section& section = _sections[sectionIdx];
+        section.name = name;
+        section.parentIdx = _curSectionIdx;
+        section.depth = (_curSectionIdx < 0) ? 0 : _sections[_curSectionIdx].depth + 1;
+        section.stats.clear();
+        _numSections.store(numSections + 1, std::memory_order_release);
+    }
+
+    _curSectionIdx = sectionIdx;
+    _sections[sectionIdx].startUs = micros();
+    return sectionIdx;
+}
+
+void LoopProfiler::leave(int sectionIdx)
+{
+    Section& section = _sections[sectionIdx];
+    uint32_t durUs = micros() - section.startUs;
+    beginWrite();
+    section.stats.add(durUs);
+    endWrite();
+    _curSectionIdx = section.parentIdx;
+}
+
+void LoopProfiler::clearVals()
+{
+    beginWrite();
+    _loopStats.clear();
+    _jitterStats.clear();
+    int numSections = _numSections.load(std::memory_order_relaxed);
+    for (int i = 0; i < numSections; i++)
+        _sections[i].stats.clear();
+    endWrite();
+}
+
+// Copy stats which the owning thread may be changing - retries until the copy wasn't overlapped
+// by a change (giving the owner time to finish if it is part way through one)
+void LoopProfiler::snapshotStats(const Stats& stats, Stats& snapshot) const
+{
+    for (int retries = 0; retries < SNAPSHOT_MAX_RETRIES; retries++)
+    {
+        uint32_t seqBefore = _writeSeq.load(std::memory_order_acquire);
+        if ((seqBefore & 1) == 0)
+        {
+            snapshot = stats;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (_writeSeq.load(std::memory_order_relaxed) == seqBefore)
+                return;
+        }
+        delay(retries == 0 ? 0 : 1);
+    }
+    // The owner is stuck part way through a change - the copy may be inconsistent
+    snapshot = stats;
+}
+
+void LoopProfiler::logSummary()
+{
+    // Two slowest sections (by max time)
+    int slowestIdx = -1, secondIdx = -1;
+    for (int i = 0; i < _numSections; i++)
+    {
+        uint32_t maxUs = _sections[i].stats.maxUs;
+        if ((slowestIdx < 0) || (maxUs > _sections[slowestIdx].stats.maxUs))
+        {
+            secondIdx = slowestIdx;
+            slowestIdx = i;
+        }
+        else if ((secondIdx < 0) || (maxUs > _sections[secondIdx].stats.maxUs))
+        {
+            secondIdx = i;
+        }
+    }
+    String slowestStr;
+    if ((slowestIdx >= 0) && (_sections[slowestIdx].stats.maxUs != 0))
+        slowestStr = " Slowest " + String(_sections[slowestIdx].name) + " " + String(_sections[slowestIdx].stats.maxUs);
+    if ((secondIdx >= 0) && (_sections[secondIdx].stats.maxUs != 0))
+        slowestStr += ", " + String(_sections[secondIdx].name) + " " + String(_sections[secondIdx].stats.maxUs);
+
+    String programInfoStr;
+    if (_infoStrCallback)
+        _infoStrCallback(programInfoStr);
+
+    char millisStr[20];
+    sprintf(millisStr, "%05ld", millis());
+    char loopStr[100];
+    uint32_t avgUs = _loopStats.count ? uint32_t(_loopStats.sumUs / _loopStats.count) : 0;
+    sprintf(loopStr, " Avg %luuS Max %luuS Min %luuS P99 %luuS", (unsigned long)avgUs, (unsigned long)_loopStats.maxUs,
+                (unsigned long)(_loopStats.count ? _loopStats.minUs : 0), (unsigned long)_loopStats.percentileUs(99));
+    String totalStr = millisStr + String(" ") + programInfoStr + loopStr + slowestStr + "\n";
+    Log.notice(totalStr.c_str());
+}
+
+void LoopProfiler::getJSON(String& jsonStr)
+{
+    Stats loopStats, jitterStats;
+    snapshotStats(_loopStats, loopStats);
+    snapshotStats(_jitterStats, jitterStats);
+    jsonStr = "{\"loop\":" + loopStats.toJSON() + ",\"jitter\":" + jitterStats.toJSON() + ",\"sections\":[";
+
+    // Sections in tree order (children follow their parent) - the section names and tree don't
+    // change once a section is added
+    int numSections = _numSections.load(std::memory_order_acquire);
+    int parentStack[MAX_SECTIONS + 1];
+    int nextChildFrom[MAX_SECTIONS + 1];
+    int stackDepth = 0;
+    parentStack[0] = -1;
+    nextChildFrom[0] = 0;
+    bool first = true;
+    while (stackDepth >= 0)
+    {
+        int childIdx = -1;
+        for (int i = nextChildFrom[stackDepth]; i < numSections; i++)
+        {
+            if (_sections[i].parentIdx == parentStack[stackDepth])
+            {
+                childIdx = i;
+                break;
+            }
+        }
+        if (childIdx < 0)
+        {
+            stackDepth--;
+            continue;
+        }
+        nextChildFrom[stackDepth] = childIdx + 1;
+        Section& section = _sections[childIdx];
+        Stats stats;
+        snapshotStats(section.stats, stats);
+        if (!first)
+            jsonStr += ",";
+        first = false;
+        jsonStr += "{\"name\":\"" + String(section.name) + "\",\"depth\":" + String(section.depth) +
+                    ",\"stats\":" + stats.toJSON() + "}";
+        stackDepth++;
+        parentStack[stackDepth] = childIdx;
+        nextChildFrom[stackDepth] = childIdx + 1;
+    }
+    jsonStr += "]}";
+}
+
+void LoopProfiler::getAllJSON(String& jsonStr, bool clearAfter)
+{
+    // Upper bound of each histogram bucket
+    jsonStr = "{\"histBucketsUs\":[";
+    for (int i = 0; i < NUM_HIST_BUCKETS; i++)
+    {
+        if (i != 0)
+            jsonStr += ",";
+        jsonStr += String(histBucketUpperUs(i));
+    }
+    jsonStr += "]";
+    for (int i = 0; i < MAX_PROFILERS; i++)
+    {
+        if (!_pProfilers[i])
+            continue;
+        String profilerJson;
+        _pProfilers[i]->getJSON(profilerJson);
+        jsonStr += ",\"" + String(_pProfilers[i]->_name) + "\":" + profilerJson;
+        if (clearAfter)
+            _pProfilers[i]->requestClear();
+    }
+    jsonStr += "}";
+}
+
+// Bucket for a duration - 0, 1 then two buckets per power of two
+int LoopProfiler::histBucket(uint32_t durUs)
+{
+    if (durUs < 2)
+        return durUs;
+    int octave = 31 - __builtin_clz(durUs);
+    int bucketIdx = octave * 2 + ((durUs >> (octave - 1)) & 1);
+    return (bucketIdx < NUM_HIST_BUCKETS) ? bucketIdx : NUM_HIST_BUCKETS - 1;
+}
+
+// Largest duration in a bucket (the last bucket is unbounded)
+uint32_t LoopProfiler::histBucketUpperUs(int bucketIdx)
+{
+    if (bucketIdx < 2)
+        return bucketIdx;
+    if (bucketIdx >= NUM_HIST_BUCKETS - 1)
+        return 0xffffffff;
+    int octave = bucketIdx / 2;
+    return (1u << octave) + (bucketIdx % 2 + 1) * (1u << (octave - 1)) - 1;
+}
+
+void LoopProfiler::Stats::clear()
+{
+    count = 0;
+    sumUs = 0;
+    minUs = 0xffffffff;
+    maxUs = 0;
+    for (int i = 0; i < NUM_HIST_BUCKETS; i++)
+        hist[i] = 0;
+}
+
+void LoopProfiler::Stats::add(uint32_t durUs)
+{
+    count++;
+    sumUs += durUs;
+    if (minUs > durUs)
+        minUs = durUs;
+    if (maxUs < durUs)
+        maxUs = durUs;
+    hist[histBucket(durUs)]++;
+}
+
+// Percentile from the histogram - the upper bound of the bucket it is in (but not over the max)
+uint32_t LoopProfiler::Stats::percentileUs(uint32_t percent) const
+{
+    if (count == 0)
+        return 0;
+    uint32_t target = uint32_t((uint64_t(count) * percent + 99) / 100);
+    uint32_t cumulative = 0;
+    for (int i = 0; i < NUM_HIST_BUCKETS; i++)
+    {
+        cumulative += hist[i];
+        if (cumulative >= target)
+            return (histBucketUpperUs(i) < maxUs) ? histBucketUpperUs(i) : maxUs;
+    }
+    return maxUs;
+}
+
+String LoopProfiler::Stats::toJSON() const
+{
+    String jsonStr = "{\"n\":" + String(count) +
+                ",\"minUs\":" + String(count ? minUs : 0) +
+                ",\"avgUs\":" + String(count ? double(sumUs) / count : 0, 1) +
+                ",\"maxUs\":" + String(maxUs) +
+                ",\"p99Us\":" + String(percentileUs(99)) + ",\"hist\":[";
+    // Histogram up to the last non-empty bucket
+    int lastBucket = NUM_HIST_BUCKETS - 1;
+    while ((lastBucket > 0) && (hist[lastBucket] == 0))
+        lastBucket--;
+    for (int i = 0; i <= lastBucket; i++)
+    {
+        if (i != 0)
+            jsonStr += ",";
+        jsonStr += String(hist[i]);
+    }
+    return jsonStr + "]}";
+}
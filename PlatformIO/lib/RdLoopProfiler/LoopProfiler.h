@@ -0,0 +1,153 @@
+// Loop profiler
+// Times named sections of code which can be nested (each section is a node in a tree under
+// the loop) - min/avg/max and p99 (from a log scale histogram) are kept for each section and
+// for the loop time along with a histogram of loop-to-loop jitter
+// A profiler is attached to the thread (task) which runs its loop so that sections can be
+// timed anywhere in code called from that loop with LOOP_PROFILE_SCOPE("name") - code run
+// from a thread without a profiler isn't timed
+// Only the owning thread updates the values - other threads (e.g. the REST API) read them through
+// a sequence counter and ask for them to be cleared which the owner does at the next loop start
+// Rob Dobson 2017-19
+
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+typedef void (*LoopProfiler_InfoStrCb)(String &infoStr);
+
+class LoopProfiler
+{
+public:
+    // Histogram buckets - 0, 1 then two per power of two from 2uS (so p99 is within about 40%) - the
+    // last bucket holds everything from about 49ms
+    static const int NUM_HIST_BUCKETS = 32;
+    // Sections (including the loop) - sections beyond this aren't timed
+    static const int MAX_SECTIONS = 24;
+    // Profilers which can be queried together
+    static const int MAX_PROFILERS = 4;
+
+    // reportingPeriodMs of 0 means don't log a summary
+    LoopProfiler(const char* name, long reportingPeriodMs = 0, LoopProfiler_InfoStrCb infoStrCallback = NULL);
+    ~LoopProfiler();
+
+    // Time sections on the calling thread (task) with this profiler
+    void attachToThisThread();
+    static LoopProfiler* current()
+    {
+        return _pCurrent;
+    }
+
+    // Call at the start of each loop - times the loop and logs a summary periodically
+    void loopStart();
+
+    // Enter and leave a section (nested in the section currently entered) - returns the
+    // section index to pass to leave (or -1 if there is no room for the section)
+    int enter(const char* name);
+    void leave(int sectionIdx);
+
+    // Clear all accumulated values - clearVals() only from the owning thread, other threads
+    // use requestClear() and the values are cleared at the next loopStart()
+    void clearVals();
+    void requestClear()
+    {
+        _clearReqd = true;
+    }
+
+    // JSON - sections are listed in tree order with their depth - can be called from any thread
+    void getJSON(String& jsonStr);
+    // All profilers as a JSON object keyed by profiler name
+    static void getAllJSON(String& jsonStr, bool clearAfter);
+
+private:
+    // Duration statistics
+    struct Stats
+    {
+        uint32_t count;
+        uint64_t sumUs;
+        uint32_t minUs;
+        uint32_t maxUs;
+        uint32_t hist[NUM_HIST_BUCKETS];
+        void clear();
+        void add(uint32_t durUs);
+        uint32_t percentileUs(uint32_t percent) const;
+        String toJSON() const;
+    };
+
+    // Section (node in the tree) - sections are never removed so indices stay valid
+    struct Section
+    {
+        const char* name;
+        int parentIdx;
+        int depth;
+        uint32_t startUs;
+        Stats stats;
+    };
+
+    const char* _name;
+    Section _sections[MAX_SECTIONS];
+    std::atomic<int> _numSections;
+    int _curSectionIdx;
+
+    // Sequence counter - odd while the owning thread is changing the stats - readers copy the
+    // stats and retry if the counter was odd or changed while copying
+    std::atomic<uint32_t> _writeSeq;
+    std::atomic<bool> _clearReqd;
+    void beginWrite()
+    {
+        _writeSeq.store(_writeSeq.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+    void endWrite()
+    {
+        _writeSeq.store(_writeSeq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+    void snapshotStats(const Stats& stats, Stats& snapshot) const;
+    static const int SNAPSHOT_MAX_RETRIES = 20;
+
+    // Loop timing
+    Stats _loopStats;
+    Stats _jitterStats;
+    unsigned long _lastLoopStartUs;
+    uint32_t _lastLoopUs;
+    bool _lastLoopStartValid;
+
+    // Summary logging
+    unsigned long _lastReportMs;
+    long _reportingPeriodMs;
+    LoopProfiler_InfoStrCb _infoStrCallback;
+    void logSummary();
+
+    // Profiler used by the current thread
+    static thread_local LoopProfiler* _pCurrent;
+
+    // All profilers
+    static LoopProfiler* _pProfilers[MAX_PROFILERS];
+
+    static int histBucket(uint32_t durUs);
+    static uint32_t histBucketUpperUs(int bucketIdx);
+};
+
+// Time a section from here to the end of the enclosing scope
+class LoopProfilerScope
+{
+public:
+    LoopProfilerScope(const char* name)
+    {
+        _pProfiler = LoopProfiler::current();
+        _sectionIdx = _pProfiler ? _pProfiler->enter(name) : -1;
+    }
+    ~LoopProfilerScope()
+    {
+        if (_sectionIdx >= 0)
+            _pProfiler->leave(_sectionIdx);
+    }
+
+private:
+    LoopProfiler* _pProfiler;
+    int _sectionIdx;
+};
+
+#define LOOP_PROFILE_CONCAT_INNER(a, b) a##b
+#define LOOP_PROFILE_CONCAT(a, b) LOOP_PROFILE_CONCAT_INNER(a, b)
+#define LOOP_PROFILE_SCOPE(name) LoopProfilerScope LOOP_PROFILE_CONCAT(_loopProfilerScope, __LINE__)(name)
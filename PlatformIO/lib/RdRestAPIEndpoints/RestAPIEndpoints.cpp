@@ -41,7 +41,8 @@ void RestAPIEndpoints::addEndpoint(const char *pEndpointStr, RestAPIEndpointDef:
                     bool pNoCache,
                     const char *pExtraHeaders,
                     RestAPIFnBody callbackBody,
-                    RestAPIFnUpload callbackUpload)
+                    RestAPIFnUpload callbackUpload,
+                    RestAPIFnStream callbackStream)
 {
     // Check for overflow
     if (_numEndpoints >= MAX_WEB_SERVER_ENDPOINTS)
@@ -56,7 +57,8 @@ void RestAPIEndpoints::addEndpoint(const char *pEndpointStr, RestAPIEndpointDef:
                                 pDescription,
                                 pContentType, pContentEncoding,
                                 pNoCache, pExtraHeaders,
-                                callbackBody, callbackUpload);
+                                callbackBody, callbackUpload,
+                                callbackStream);
     _pEndpoints[_numEndpoints] = pNewEndpointDef;
     _numEndpoints++;
 }
@@ -190,6 +192,28 @@ const char* RestAPIEndpoints::getArgPtrAndLen(const char *argStr, int argIdx, in
     return NULL;
 }
 
+// Get the value of a query argument
+String RestAPIEndpoints::getQueryArgStr(const char *argStr, const char *argName, const char *defaultStr)
+{
+    const char *pCh = strchr(argStr, '?');
+    int nameLen = strlen(argName);
+    while (pCh)
+    {
+        // Each argument starts after ? or &
+        pCh++;
+        const char *pEnd = strchr(pCh, '&');
+        if ((strncmp(pCh, argName, nameLen) == 0) && (pCh[nameLen] == '='))
+        {
+            String oStr;
+            const char *pVal = pCh + nameLen + 1;
+            formStringFromCharBuf(oStr, pVal, pEnd ? pEnd - pVal : strlen(pVal));
+            return unencodeHTTPChars(oStr);
+        }
+        pCh = pEnd;
+    }
+    return String(defaultStr);
+}
+
 // Num args from an argStr
 int RestAPIEndpoints::getNumArgs(const char *argStr)
 {
@@ -11,6 +11,14 @@ typedef std::function<void(String &reqStr, String &respStr)> RestAPIFunction;
 typedef std::function<void(String &reqStr, uint8_t *pData, size_t len, size_t index, size_t total)> RestAPIFnBody;
 typedef std::function<void(String &reqStr, String& filename, size_t contentLen, size_t index, uint8_t *data, size_t len, bool finalBlock)> RestAPIFnUpload;
 
+// Streamed responses - the filler is called for each part of the response with its position
+// in the response (index) and returns the length it put in pBuf (0 at the end) - an endpoint
+// which can stream its response returns a filler (or NULL to send respStr instead)
+// If the endpoint sets contentLength the filler must fill from any index so that a byte range
+// (HTTP Range header) can be sent - otherwise the response is sent chunked
+typedef std::function<size_t(uint8_t *pBuf, size_t maxLen, size_t index)> RestAPIRespFiller;
+typedef std::function<RestAPIRespFiller(String &reqStr, String &respStr, int &contentLength)> RestAPIFnStream;
+
 // Definition of an endpoint
 class RestAPIEndpointDef
 {
@@ -38,7 +46,8 @@ public:
                        bool noCache,
                        const char *pExtraHeaders,
                        RestAPIFnBody callbackBody,
-                       RestAPIFnUpload callbackUpload
+                       RestAPIFnUpload callbackUpload,
+                       RestAPIFnStream callbackStream
                        )
     {
         _endpointStr = pStr;
@@ -47,6 +56,7 @@ public:
         _callback = callback;
         _callbackBody = callbackBody;
         _callbackUpload = callbackUpload;
+        _callbackStream = callbackStream;
         _description = pDescription;
         if (pContentType)
             _contentType = pContentType;
@@ -66,6 +76,7 @@ public:
     RestAPIFunction _callback;
     RestAPIFnBody _callbackBody;
     RestAPIFnUpload _callbackUpload;
+    RestAPIFnStream _callbackStream;
     bool _noCache;
     String _extraHeaders;
 
@@ -88,6 +99,13 @@ public:
             _callbackUpload(req, filename, contentLen, index, data, len, finalBlock);
     }
 
+    RestAPIRespFiller callbackStream(String &req, String &resp, int &contentLength)
+    {
+        if (_callbackStream)
+            return _callbackStream(req, resp, contentLength);
+        return NULL;
+    }
+
 };
 
 // Collection of endpoints
@@ -120,7 +138,8 @@ public:
                      bool pNoCache = true,
                      const char *pExtraHeaders = NULL,
                      RestAPIFnBody callbackBody = NULL,
-                     RestAPIFnUpload callbackUpload = NULL);
+                     RestAPIFnUpload callbackUpload = NULL,
+                     RestAPIFnStream callbackStream = NULL);
 
     // Get the endpoint definition corresponding to a requested endpoint
     RestAPIEndpointDef *getEndpoint(const char *pEndpointStr);
@@ -140,6 +159,9 @@ public:
     // Get position and length of nth arg
     static const char *getArgPtrAndLen(const char *argStr, int argIdx, int &argLen);
 
+    // Get the value of a query argument (e.g. name=val in ...?name=val&...) - defaultStr if absent
+    static String getQueryArgStr(const char *argStr, const char *argName, const char *defaultStr = "");
+
     // Num args from an argStr
     static int getNumArgs(const char *argStr);
 
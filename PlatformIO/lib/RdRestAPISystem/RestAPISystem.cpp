@@ -84,10 +84,17 @@ void RestAPISystem::setup(RestAPIEndpoints &endpoints)
                     "Reformat file system e.g. /spiffs");
     endpoints.addEndpoint("filelist", RestAPIEndpointDef::ENDPOINT_CALLBACK, RestAPIEndpointDef::ENDPOINT_GET, 
                     std::bind(&RestAPISystem::apiFileList, this, std::placeholders::_1, std::placeholders::_2), 
-                    "List files in folder e.g. /spiffs/folder ... ~ for / in folder");
+                    "List files in folder e.g. /spiffs/folder ... ~ for / in folder ... "
+                    "?offset=N&count=N&sort=name|size&order=asc|desc for a page",
+                    NULL, NULL, true, NULL, NULL, NULL,
+                    std::bind(&RestAPISystem::apiFileListStream, this, std::placeholders::_1, std::placeholders::_2,
+                            std::placeholders::_3));
     endpoints.addEndpoint("fileread", RestAPIEndpointDef::ENDPOINT_CALLBACK, RestAPIEndpointDef::ENDPOINT_GET, 
                     std::bind(&RestAPISystem::apiFileRead, this, std::placeholders::_1, std::placeholders::_2), 
-                    "Read file ... name", "text/plain");
+                    "Read file ... name (HTTP Range supported)", "text/plain",
+                    NULL, true, NULL, NULL, NULL,
+                    std::bind(&RestAPISystem::apiFileReadStream, this, std::placeholders::_1, std::placeholders::_2,
+                            std::placeholders::_3));
     endpoints.addEndpoint("deleteFile", RestAPIEndpointDef::ENDPOINT_CALLBACK, RestAPIEndpointDef::ENDPOINT_GET, 
                     std::bind(&RestAPISystem::apiDeleteFile, this, std::placeholders::_1, std::placeholders::_2), 
                     "Delete file e.g. /spiffs/filename ... ~ for / in filename");
@@ -434,16 +441,43 @@ void RestAPISystem::apiReformatFS(String &reqStr, String& respStr)
 // Uses FileManager.h
 // In the reqStr the first part of the path is the file system name (e.g. sd or spiffs, can be blank to default)
 // The second part of the path is the folder - note that / must be replaced with ~ in folder
+// The query selects a page of the list e.g. ?offset=100&count=50&sort=size&order=desc (all files
+// in name order by default)
 void RestAPISystem::apiFileList(String &reqStr, String& respStr)
 {
+    String fileSystemStr, folderStr;
+    FileListPage page;
+    getFileListArgs(reqStr, fileSystemStr, folderStr, page);
+    _fileManager.getFilesJSON(fileSystemStr, folderStr, respStr, page);
+}
+
+// Same list streamed to the web server
+RestAPIRespFiller RestAPISystem::apiFileListStream(String &reqStr, String& respStr, int& contentLength)
+{
+    String fileSystemStr, folderStr;
+    FileListPage page;
+    getFileListArgs(reqStr, fileSystemStr, folderStr, page);
+    return _fileManager.getFilesJSONFiller(fileSystemStr, folderStr, page, respStr);
+}
+
+void RestAPISystem::getFileListArgs(String &reqStr, String& fileSystemStr, String& folderStr, FileListPage& page)
+{
+    // Path without the query
+    int queryIdx = reqStr.indexOf('?');
+    String pathStr = queryIdx < 0 ? reqStr : reqStr.substring(0, queryIdx);
     // File system
-    String fileSystemStr = RestAPIEndpoints::getNthArgStr(reqStr.c_str(), 1);
+    fileSystemStr = RestAPIEndpoints::getNthArgStr(pathStr.c_str(), 1);
     // Folder
-    String folderStr = RestAPIEndpoints::getNthArgStr(reqStr.c_str(), 2);
+    folderStr = RestAPIEndpoints::getNthArgStr(pathStr.c_str(), 2);
     folderStr.replace("~", "/");
     if (folderStr.length() == 0)
         folderStr = "/";
-    _fileManager.getFilesJSON(fileSystemStr, folderStr, respStr);
+    // Page
+    page.offset = RestAPIEndpoints::getQueryArgStr(reqStr.c_str(), "offset", "0").toInt();
+    page.count = RestAPIEndpoints::getQueryArgStr(reqStr.c_str(), "count", "0").toInt();
+    page.sortKey = RestAPIEndpoints::getQueryArgStr(reqStr.c_str(), "sort").equalsIgnoreCase("size") ?
+                FileDirIndex::SORT_SIZE : FileDirIndex::SORT_NAME;
+    page.descending = RestAPIEndpoints::getQueryArgStr(reqStr.c_str(), "order").equalsIgnoreCase("desc");
 }
 
 // Read file contents
@@ -460,6 +494,17 @@ void RestAPISystem::apiFileRead(String &reqStr, String& respStr)
     respStr = _fileManager.getFileContents(fileSystemStr, fileNameStr);
 }
 
+// Same file streamed to the web server in blocks (so it isn't held in memory)
+RestAPIRespFiller RestAPISystem::apiFileReadStream(String &reqStr, String& respStr, int& contentLength)
+{
+    // File system
+    String fileSystemStr = RestAPIEndpoints::getNthArgStr(reqStr.c_str(), 1);
+    // Filename
+    String fileNameStr = RestAPIEndpoints::getNthArgStr(reqStr.c_str(), 2);
+    fileNameStr.replace("~", "/");
+    return _fileManager.getFileFiller(fileSystemStr, fileNameStr, contentLength);
+}
+
 // Delete file on the file system
 // Uses FileManager.h
 // In the reqStr the first part of the path is the file system name (e.g. sd or spiffs)
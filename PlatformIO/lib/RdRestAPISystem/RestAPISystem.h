@@ -99,12 +99,15 @@ public:
     // In the reqStr the first part of the path is the file system name (e.g. sd or spiffs, can be blank to default)
     // The second part of the path is the folder - note that / must be replaced with ~ in folder
     void apiFileList(String &reqStr, String& respStr);
+    RestAPIRespFiller apiFileListStream(String &reqStr, String& respStr, int& contentLength);
+    void getFileListArgs(String &reqStr, String& fileSystemStr, String& folderStr, FileListPage& page);
 
     // Read file contents
     // Uses FileManager.h
     // In the reqStr the first part of the path is the file system name (e.g. sd or spiffs)
     // The second part of the path is the folder and filename - note that / must be replaced with ~ in folder
     void apiFileRead(String &reqStr, String& respStr);
+    RestAPIRespFiller apiFileReadStream(String &reqStr, String& respStr, int& contentLength);
 
     // Delete file on the file system
     // Uses FileManager.h
@@ -58,6 +58,49 @@ String WebServer::recreatedReqUrl(AsyncWebServerRequest *request)
     return reqUrl;
 }
 
+// Streamed response - chunked if the length isn't known, otherwise the whole content or the
+// byte range requested
+void WebServer::sendStreamResponse(AsyncWebServerRequest *request, const String& contentType,
+            RestAPIRespFiller respFiller, int contentLength)
+{
+    if (contentLength < 0)
+    {
+        request->send(request->beginChunkedResponse(contentType, respFiller));
+        return;
+    }
+
+    // Byte range
+    size_t rangeStart = 0, rangeLen = contentLength;
+    int rangeCode = 200;
+    if (request->hasHeader("Range"))
+        rangeCode = AsyncStaticFileHandler::parseRange(request->header("Range"), contentLength, rangeStart, rangeLen);
+    if (rangeCode == 416)
+    {
+        AsyncWebServerResponse *response = request->beginResponse(416);
+        response->addHeader("Content-Range", "bytes */" + String(contentLength));
+        request->send(response);
+        return;
+    }
+
+    // Fill from the start of the range
+    AsyncWebServerResponse *response = request->beginResponse(contentType, rangeLen,
+            [respFiller, rangeStart, rangeLen](uint8_t *pBuf, size_t maxLen, size_t index) -> size_t {
+                if (index >= rangeLen)
+                    return 0;
+                if (maxLen > rangeLen - index)
+                    maxLen = rangeLen - index;
+                return respFiller(pBuf, maxLen, rangeStart + index);
+            });
+    response->addHeader("Accept-Ranges", "bytes");
+    if (rangeCode == 206)
+    {
+        response->setCode(206);
+        response->addHeader("Content-Range", "bytes " + String(rangeStart) + "-" +
+                    String(rangeStart + rangeLen - 1) + "/" + String(contentLength));
+    }
+    request->send(response);
+}
+
 void WebServer::addEndpoints(RestAPIEndpoints &endpoints)
 {
     // Check enabled
@@ -105,21 +148,37 @@ void WebServer::addEndpoints(RestAPIEndpoints &endpoints)
                 // Default response
                 String respStr("{ \"rslt\": \"unknown\" }");
 
+                // Use the content type from endpoint definition, default to application/json
+                String contentType = pEndpoint->_contentType.length() > 0 ? pEndpoint->_contentType : "application/json";
+
                 // Make the required action
                 if (pEndpoint->_endpointType == RestAPIEndpointDef::ENDPOINT_CALLBACK)
                 {
                     String reqUrl = recreatedReqUrl(request);
                     Log.verbose("%sCalling %s url %s\n", MODULE_PREFIX,
                                     pEndpoint->_endpointStr.c_str(), request->url().c_str());
-                    pEndpoint->callback(reqUrl, respStr);
+
+                    // Stream the response if the endpoint can
+                    if (pEndpoint->_callbackStream)
+                    {
+                        int contentLength = -1;
+                        RestAPIRespFiller respFiller = pEndpoint->callbackStream(reqUrl, respStr, contentLength);
+                        if (respFiller)
+                        {
+                            sendStreamResponse(request, contentType, respFiller, contentLength);
+                            return;
+                        }
+                    }
+                    else
+                    {
+                        pEndpoint->callback(reqUrl, respStr);
+                    }
                 }
                 else
                 {
                     Log.trace("%sUnknown type %s url %s\n", MODULE_PREFIX,
                                     pEndpoint->_endpointStr.c_str(), request->url().c_str());
                 }
-                // Use the content type from endpoint definition, default to application/json
-                String contentType = pEndpoint->_contentType.length() > 0 ? pEndpoint->_contentType : "application/json";
                 request->send(200, contentType.c_str(), respStr.c_str());
             },
             
@@ -213,13 +272,34 @@ void WebServer::addStaticResource(const WebServerResource *pResource, const char
 
     // Static pages
     _pServer->on(pPath, HTTP_GET, [pResource](AsyncWebServerRequest *request) {
-        AsyncWebServerResponse *response = request->beginResponse_P(200, "text/html", pResource->_pData, pResource->_dataLen);
+        bool hasETag = (pResource->_pETag != NULL) && (strlen(pResource->_pETag) != 0);
+
+        // Not modified if the client has the same version
+        if (hasETag && request->hasHeader("If-None-Match") &&
+                    (request->header("If-None-Match").indexOf(pResource->_pETag) >= 0))
+        {
+            AsyncWebServerResponse *response = request->beginResponse(304);
+            response->addHeader("ETag", pResource->_pETag);
+            response->addHeader("Cache-Control", "no-cache");
+            request->send(response);
+            return;
+        }
+
+        AsyncWebServerResponse *response = request->beginResponse_P(200, pResource->_pMimeType, pResource->_pData, pResource->_dataLen);
         if ((pResource->_pContentEncoding != NULL) && (strlen(pResource->_pContentEncoding) != 0))
             response->addHeader("Content-Encoding", pResource->_pContentEncoding);
         if ((pResource->_pAccessControlAllowOrigin != NULL) && (strlen(pResource->_pAccessControlAllowOrigin) != 0))
             response->addHeader("Access-Control-Allow-Origin", pResource->_pAccessControlAllowOrigin);
         if (pResource->_noCache)
+        {
             response->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+        }
+        else if (hasETag)
+        {
+            // Cached but revalidated on each use (so a firmware update is picked up)
+            response->addHeader("ETag", pResource->_pETag);
+            response->addHeader("Cache-Control", "no-cache");
+        }
         if ((pResource->_pExtraHeaders != NULL) && (strlen(pResource->_pExtraHeaders) != 0))
             parseAndAddHeaders(response, pResource->_pExtraHeaders);
         request->send(response);
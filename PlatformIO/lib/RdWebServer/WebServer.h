@@ -33,6 +33,8 @@ public:
     void addStaticResources(const WebServerResource *pResources, int numResources);
     static void parseAndAddHeaders(AsyncWebServerResponse *response, const char *pHeaders);
     static String recreatedReqUrl(AsyncWebServerRequest *request);
+    static void sendStreamResponse(AsyncWebServerRequest *request, const String& contentType,
+                RestAPIRespFiller respFiller, int contentLength);
     void serveStaticFiles(const char* baseUrl, const char* baseFolder, const char* cache_control = NULL);
     // Async event handler (one-way text to browser)
     void enableAsyncEvents(const String& eventsURL);
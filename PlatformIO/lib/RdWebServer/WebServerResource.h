@@ -11,7 +11,8 @@ public:
                       const char *pAccessControlAllowOrigin,
                       const unsigned char *pData, int dataLen,
                       bool noCache = false,
-                      const char *pExtraHeaders = NULL)
+                      const char *pExtraHeaders = NULL,
+                      const char *pETag = NULL)
     {
         _pResId = pResId;
         _pMimeType = pMimeType;
@@ -21,6 +22,7 @@ public:
         _dataLen = dataLen;
         _noCache = noCache;
         _pExtraHeaders = pExtraHeaders;
+        _pETag = pETag;
     }
     const char *_pResId;
     const char *_pMimeType;
@@ -30,4 +32,7 @@ public:
     int _dataLen;
     bool _noCache;
     const char *_pExtraHeaders;
+    // Strong ETag (with quotes) of the data - resources with one are revalidated by clients
+    // and answered with 304 if unchanged
+    const char *_pETag;
 };
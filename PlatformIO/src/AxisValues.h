@@ -19,6 +19,37 @@ public:
     static double d2r(double angleDegrees);
     static bool isApprox(double v1, double v2, double withinRng = 0.0001);
     static bool isApproxWrap(double v1, double v2, double wrapSize=360.0, double withinRng = 0.0001);
+
+    // Single precision polynomial approximations for kinematics on the main loop
+    // fastAtan2 max error 2.0e-6 rad (octant reduction + 11th order odd polynomial)
+    // fastAcos max error 4.3e-7 rad (Abramowitz & Stegun 4.4.46)
+    static inline float fastAtan2(float y, float x)
+    {
+        float absX = fabsf(x);
+        float absY = fabsf(y);
+        float maxXY = absX > absY ? absX : absY;
+        if (maxXY == 0)
+            return 0;
+        float a = (absX > absY ? absY : absX) / maxXY;
+        float s = a * a;
+        float r = a * (0.99997726f + s * (-0.33262347f + s * (0.19354346f +
+                    s * (-0.11643287f + s * (0.05265332f + s * -0.01172120f)))));
+        if (absY > absX)
+            r = float(M_PI_2) - r;
+        if (x < 0)
+            r = float(M_PI) - r;
+        return y < 0 ? -r : r;
+    }
+    static inline float fastAcos(float x)
+    {
+        if (x > 1) x = 1;
+        if (x < -1) x = -1;
+        float absX = fabsf(x);
+        float r = sqrtf(1 - absX) * (1.5707963050f + absX * (-0.2145988016f + absX * (0.0889789874f +
+                    absX * (-0.0501743046f + absX * (0.0308918810f + absX * (-0.0170881256f +
+                    absX * (0.0066700901f + absX * -0.0012624911f)))))));
+        return x < 0 ? float(M_PI) - r : r;
+    }
 };
 
 class AxisFloats
@@ -0,0 +1,89 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Host benchmark of WorkManager::reconfigure style config lookups on the built-in robot
+// configurations - the keys are those read by MotionHelper::configure and the things it
+// configures (axes, ramp generator, trinamics, homing and motor enabler)
+
+#ifdef RAMPGEN_HOST_SIM
+
+#include <Arduino.h>
+#include <ArduinoLog.h>
+#include <chrono>
+#include "RdJsonDoc.h"
+#include "HostConfigBench.h"
+#include "RobotConfigurations.h"
+#include "RobotMotion/RobotController.h"
+
+static const char* GEOM_KEYS[] = { "pipelineLen", "blockDistanceMM", "allowOutOfBounds", "junctionDeviation",
+            "arcChordErrorMM", "homing/homingSeq", "homing/maxHomingSecs", "stepEnablePin", "stepEnLev",
+            "stepDisableSecs", "fastKinematics" };
+static const char* AXIS_KEYS[] = { "maxSpeed", "maxAcc", "stepsPerRot", "unitsPerRot", "maxRPM", "minVal",
+            "maxVal", "isDominantAxis", "isPrimaryAxis", "isServoAxis", "homeOffsetVal", "homeOffSteps",
+            "stepPin", "dirnPin", "dirnRev", "endStop0", "endStop1", "IRUN", "IHOLD", "IHOLDDELAY",
+            "CHOPCONF", "chipDriverIdx" };
+static const int NUM_GEOM_KEYS = sizeof(GEOM_KEYS) / sizeof(GEOM_KEYS[0]);
+static const int NUM_AXIS_KEYS = sizeof(AXIS_KEYS) / sizeof(AXIS_KEYS[0]);
+
+// Lookups as they were made - each one tokenizes the string it is given
+static uint32_t lookupsPerCall(const char* robotConfig)
+{
+    uint32_t found = 0;
+    String robotGeom = RdJson::getString("robotGeom", "NONE", robotConfig);
+    for (int keyIdx = 0; keyIdx < NUM_GEOM_KEYS; keyIdx++)
+        found += RdJson::getString(GEOM_KEYS[keyIdx], "", robotGeom.c_str()).length() > 0;
+    for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+    {
+        String axisIdStr = "axis" + String(axisIdx);
+        String axisJSON = RdJson::getString(axisIdStr.c_str(), "{}", robotGeom.c_str());
+        for (int keyIdx = 0; keyIdx < NUM_AXIS_KEYS; keyIdx++)
+            found += RdJson::getString(AXIS_KEYS[keyIdx], "", axisJSON.c_str()).length() > 0;
+    }
+    return found;
+}
+
+// Same lookups through parsed documents
+static uint32_t lookupsDoc(const char* robotConfig)
+{
+    uint32_t found = 0;
+    RdJsonDoc robotGeomDoc(RdJson::getString("robotGeom", "NONE", robotConfig).c_str());
+    for (int keyIdx = 0; keyIdx < NUM_GEOM_KEYS; keyIdx++)
+        found += robotGeomDoc.getString(GEOM_KEYS[keyIdx], "").length() > 0;
+    RdJsonDoc axisDoc;
+    for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+    {
+        String axisIdStr = "axis" + String(axisIdx);
+        axisDoc.parse(robotGeomDoc.getString(axisIdStr.c_str(), "{}").c_str());
+        for (int keyIdx = 0; keyIdx < NUM_AXIS_KEYS; keyIdx++)
+            found += axisDoc.getString(AXIS_KEYS[keyIdx], "").length() > 0;
+    }
+    return found;
+}
+
+template<typename Fn> static double timeUs(uint32_t iterations, Fn fn)
+{
+    auto startTime = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++)
+        fn();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count() * 1e6 / iterations;
+}
+
+void hostConfigBench(uint32_t iterations)
+{
+    for (int configIdx = 0; configIdx < RobotConfigurations::_numRobotConfigurations; configIdx++)
+    {
+        const char* robotConfig = RobotConfigurations::_robotConfigs[configIdx];
+        String robotType = RdJson::getString("robotType", "", robotConfig);
+        uint32_t foundPerCall = lookupsPerCall(robotConfig);
+        uint32_t foundDoc = lookupsDoc(robotConfig);
+        double perCallUs = timeUs(iterations, [&]() { lookupsPerCall(robotConfig); });
+        double docUs = timeUs(iterations, [&]() { lookupsDoc(robotConfig); });
+        RobotController robotController;
+        double initUs = timeUs(iterations, [&]() { robotController.init(robotConfig); });
+        printf("config %s len %d lookups %d found %u/%u perCall %.1fus doc %.1fus RobotController::init %.1fus\n",
+                    robotType.c_str(), int(strlen(robotConfig)), NUM_GEOM_KEYS + NUM_AXIS_KEYS * RobotConsts::MAX_AXES,
+                    foundPerCall, foundDoc, perCallUs, docUs, initUs);
+    }
+}
+
+#endif // RAMPGEN_HOST_SIM
@@ -0,0 +1,8 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+#pragma once
+
+// Time the configuration lookups made when the robot is reconfigured - per-call RdJson
+// (tokenizing the source every time) against RdJsonDoc - for each RobotConfigurations entry
+void hostConfigBench(uint32_t iterations);
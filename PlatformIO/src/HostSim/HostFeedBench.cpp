@@ -0,0 +1,106 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Host model of the main loop feeding points to the robot - shared by the theta-rho and pattern
+// feed benchmarks (see HostFeedBench.h)
+
+#ifdef RAMPGEN_HOST_SIM
+
+#include <Arduino.h>
+#include <ArduinoLog.h>
+#include <chrono>
+#include "HostFeedBench.h"
+
+// Limit on virtual time and ticks run at a time when draining
+static const uint32_t MAX_TICKS = 3600 * 100000;
+static const uint32_t DRAIN_TICKS = MotionBlock::TICKS_PER_RATE_UPDATE;
+
+static bool blockCanExecute(MotionPipeline& motionPipeline)
+{
+    MotionBlockSteps* pSteps = motionPipeline.peekGetSteps();
+    return pSteps && (pSteps->_canExecute || pSteps->_isExecuting);
+}
+
+static bool runFeed(const char* robotConfig, const HostFeedSetupFn& setupFn, bool pullPoints,
+            bool drainEachLoop, uint32_t ticksPerLoop, HostFeedResult& result)
+{
+    RobotController robotController;
+    robotController.init(robotConfig);
+    MotionHelper& motionHelper = robotController.simGetMotionHelper();
+    RampGenerator& rampGenerator = motionHelper.simGetRampGenerator();
+    RampGenIO& rampGenIO = rampGenerator.simGetRampGenIO();
+    MotionPipeline& motionPipeline = motionHelper.simGetMotionPipeline();
+    rampGenIO.simSetRecordEdges(false);
+    HostFeed* pFeed = setupFn(robotController, pullPoints);
+    if (!pFeed)
+        return false;
+
+    // Main loop
+    bool motionStarted = false;
+    std::chrono::steady_clock::duration loopTime(0);
+    result.loops = 0;
+    result.starvedLoops = 0;
+    while (rampGenIO.simGetTickCount() < MAX_TICKS)
+    {
+        bool feedDone = pFeed->isDone();
+        if (feedDone && robotController.canAcceptCommand() && motionHelper.isIdle())
+            break;
+        auto startTime = std::chrono::steady_clock::now();
+
+        // Work manager and evaluator then robot and ISR
+        pFeed->loop();
+        robotController.service();
+        loopTime += std::chrono::steady_clock::now() - startTime;
+        result.loops++;
+        bool pipelineEmpty = !blockCanExecute(motionPipeline);
+        if (drainEachLoop)
+        {
+            while (blockCanExecute(motionPipeline) && (rampGenIO.simGetTickCount() < MAX_TICKS))
+                rampGenerator.simRunTicks(DRAIN_TICKS);
+        }
+        else
+        {
+            rampGenerator.simRunTicks(ticksPerLoop);
+            pipelineEmpty = !blockCanExecute(motionPipeline);
+        }
+        motionStarted |= !pipelineEmpty;
+        if (motionStarted && !feedDone && pipelineEmpty)
+            result.starvedLoops++;
+    }
+    result.secs = std::chrono::duration<double>(loopTime).count();
+    result.points = pFeed->getNumPoints();
+    result.virtualSecs = rampGenIO.simGetTickCount() * (MotionBlock::TICK_INTERVAL_NS / 1e9);
+    result.stepTotals[0] = rampGenIO.simGetStepCount(0);
+    result.stepTotals[1] = rampGenIO.simGetStepCount(1);
+    delete pFeed;
+    return true;
+}
+
+bool hostFeedBench(const char* robotConfig, const HostFeedSetupFn& setupFn, uint32_t ticksPerLoop,
+            HostFeedResult results[2][2], bool& stepsOk)
+{
+    const char* methodNames[2] = { "push", "pull" };
+    stepsOk = true;
+    for (int drain = 0; drain < 2; drain++)
+    {
+        if (drain)
+            printf("pipeline drained every loop\n");
+        else
+            printf("loop %.1fms\n", ticksPerLoop * (MotionBlock::TICK_INTERVAL_NS / 1e6));
+        for (int method = 0; method < 2; method++)
+        {
+            HostFeedResult& result = results[drain][method];
+            if (!runFeed(robotConfig, setupFn, method == 1, drain == 1, ticksPerLoop, result))
+                return false;
+            printf("%-4s points %u %.0fk points/s loops %u starvedLoops %u virtualSecs %.1f steps %u %u\n",
+                        methodNames[method], result.points, result.points / result.secs / 1000, result.loops,
+                        result.starvedLoops, result.virtualSecs, result.stepTotals[0], result.stepTotals[1]);
+            stepsOk &= (result.points == results[0][0].points) &&
+                        (result.stepTotals[0] == results[0][0].stepTotals[0]) &&
+                        (result.stepTotals[1] == results[0][0].stepTotals[1]);
+        }
+    }
+    return true;
+}
+
+#endif // RAMPGEN_HOST_SIM
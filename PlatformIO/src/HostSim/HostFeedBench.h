@@ -0,0 +1,46 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+#pragma once
+
+#include <functional>
+#include "RobotMotion/RobotController.h"
+
+// Model of the work manager main loop feeding points to the robot - each loop runs the feed
+// (dispatching at most one work item, as WorkManager::service, and servicing the evaluator), services
+// the robot and then runs the ISR - either for the ticks of the loop period or until the pipeline has
+// no block which can execute (so the rate points are fed at is the limit) - a loop which leaves no
+// block to execute before the feed is finished starves the motion
+class HostFeed
+{
+public:
+    virtual ~HostFeed()
+    {
+    }
+    // Work manager and evaluator part of a main loop
+    virtual void loop() = 0;
+    // Nothing left to feed
+    virtual bool isDone() = 0;
+    virtual uint32_t getNumPoints() = 0;
+};
+
+// Makes the feed for a run once the robot is set up - with the points pushed as move work items or
+// pulled by MotionHelper from a point source - NULL if the feed can't be made
+typedef std::function<HostFeed*(RobotController& robotController, bool pullPoints)> HostFeedSetupFn;
+
+struct HostFeedResult
+{
+    double secs;
+    uint32_t points;
+    uint32_t loops;
+    uint32_t starvedLoops;
+    double virtualSecs;
+    uint32_t stepTotals[2];
+};
+
+// Run the feed pushed and pulled, each with ticksPerLoop ISR ticks between loops and with the pipeline
+// drained between loops (results[drain][pull]) - prints points/s (CPU time of the loop excluding the
+// ISR), loops and loops which left the pipeline with nothing to execute - stepsOk is set if all runs
+// made the same points and steps - false if the feed can't be made
+bool hostFeedBench(const char* robotConfig, const HostFeedSetupFn& setupFn, uint32_t ticksPerLoop,
+            HostFeedResult results[2][2], bool& stepsOk);
@@ -0,0 +1,175 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Host benchmark of line by line file playback - on the host the file system calls are cheap
+// (the file is in the page cache) so the operation counts matter as much as the time (on the
+// ESP32 each open walks the path and, on SD, the FAT chain to the seek position)
+
+#ifdef RAMPGEN_HOST_SIM
+
+#include <Arduino.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <dirent.h>
+#include <sys/stat.h>
+#include "HostFileStreamBench.h"
+#include "FileStreamReader.h"
+
+// Line buffer length as FileManager's chunk buffer
+static const int FILE_STREAM_BENCH_LINE_MAXLEN = 1000;
+static const int FILE_STREAM_BENCH_RUNS = 20;
+
+struct FileStreamBenchResult
+{
+    double secs;
+    uint32_t lines;
+    uint32_t bytes;
+    uint32_t fileOpens;
+    uint32_t fileReads;
+    uint64_t checksum;
+};
+
+// Line contents and order
+static void addToChecksum(uint64_t& checksum, const char* pLine, int lineLen)
+{
+    for (int i = 0; i < lineLen; i++)
+        checksum = (checksum ^ uint8_t(pLine[i])) * 0x100000001b3ULL;
+    checksum = (checksum ^ '\n') * 0x100000001b3ULL;
+}
+
+// As FileManager::readLineFromFile
+static char* readLineFromFile(char* pBuf, int maxLen, FILE* pFile)
+{
+    pBuf[0] = 0;
+    char* pCurPtr = pBuf;
+    int curLen = 0;
+    while (true)
+    {
+        if (curLen >= maxLen-1)
+            break;
+        int ch = fgetc(pFile);
+        if (ch == EOF)
+        {
+            if (curLen != 0)
+                break;
+            return NULL;
+        }
+        if (ch == '\n')
+            break;
+        if (ch == '\r')
+            continue;
+        *pCurPtr++ = ch;
+        *pCurPtr = 0;
+        curLen++;
+    }
+    return pBuf;
+}
+
+// Open, seek, read a line and close for every line
+static bool readPerLine(const char* pFilename, FileStreamBenchResult& result)
+{
+    char lineBuf[FILE_STREAM_BENCH_LINE_MAXLEN];
+    long filePos = 0;
+    while (true)
+    {
+        FILE* pFile = fopen(pFilename, "r");
+        if (!pFile)
+            return false;
+        result.fileOpens++;
+        if ((filePos != 0) && (fseek(pFile, filePos, SEEK_SET) != 0))
+        {
+            fclose(pFile);
+            return false;
+        }
+        result.fileReads++;
+        char* pLine = readLineFromFile(lineBuf, FILE_STREAM_BENCH_LINE_MAXLEN-1, pFile);
+        filePos = ftell(pFile);
+        fclose(pFile);
+        if (!pLine)
+            break;
+        int lineLen = strlen(pLine);
+        addToChecksum(result.checksum, pLine, lineLen);
+        result.lines++;
+        result.bytes += lineLen;
+    }
+    return true;
+}
+
+// Stream
+static bool readStream(const char* pFilename, FileStreamBenchResult& result)
+{
+    FileStreamReader reader;
+    if (!reader.open(pFilename, false))
+        return false;
+    result.fileOpens++;
+    const char* pLine = NULL;
+    int lineLen = 0;
+    while (true)
+    {
+        if (reader.nextLine(pLine, lineLen))
+        {
+            addToChecksum(result.checksum, pLine, lineLen);
+            result.lines++;
+            result.bytes += lineLen;
+            continue;
+        }
+        if (reader.isAtEnd())
+            break;
+        result.fileReads++;
+        reader.fill();
+    }
+    reader.close();
+    return true;
+}
+
+int hostFileStreamBench(const char* dirPath)
+{
+    // Files in the directory
+    std::vector<std::string> filenames;
+    DIR* pDir = opendir(dirPath);
+    if (!pDir)
+    {
+        printf("fileStream can't open %s\n", dirPath);
+        return 1;
+    }
+    while (struct dirent* pEnt = readdir(pDir))
+    {
+        std::string filename = std::string(dirPath) + "/" + pEnt->d_name;
+        struct stat st;
+        if ((stat(filename.c_str(), &st) == 0) && S_ISREG(st.st_mode))
+            filenames.push_back(filename);
+    }
+    closedir(pDir);
+    printf("fileStream %zu files in %s x%d\n", filenames.size(), dirPath, FILE_STREAM_BENCH_RUNS);
+
+    // Best of a few runs of each
+    bool allOk = true;
+    double bestSecs[2] = { 0, 0 };
+    uint64_t checksums[2] = { 0, 0 };
+    const char* methodNames[2] = { "perLine", "stream" };
+    for (int method = 0; method < 2; method++)
+    {
+        FileStreamBenchResult result;
+        for (int run = 0; run < FILE_STREAM_BENCH_RUNS; run++)
+        {
+            result = { 0, 0, 0, 0, 0, 0xcbf29ce484222325ULL };
+            auto startTime = std::chrono::steady_clock::now();
+            for (const std::string& filename : filenames)
+                allOk &= (method == 0) ? readPerLine(filename.c_str(), result) : readStream(filename.c_str(), result);
+            result.secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+            if ((run == 0) || (result.secs < bestSecs[method]))
+                bestSecs[method] = result.secs;
+        }
+        checksums[method] = result.checksum;
+        bool linesMatch = (checksums[method] == checksums[0]);
+        allOk &= linesMatch;
+        printf("%-7s lines %u bytes %u %.0fk lines/s opens %u reads %u %s\n", methodNames[method],
+                    result.lines, result.bytes, result.lines / bestSecs[method] / 1000, result.fileOpens,
+                    result.fileReads, linesMatch ? "OK" : "MISMATCH");
+    }
+    printf("stream x%.1f\n", bestSecs[0] / bestSecs[1]);
+    return allOk ? 0 : 1;
+}
+
+#endif // RAMPGEN_HOST_SIM
@@ -0,0 +1,9 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+#pragma once
+
+// Read every file in dirPath line by line - once with an open/seek/read line/close per line (as
+// FileManager::chunkFileNext used to) and once through FileStreamReader - checks both give the same
+// lines and reports lines/s and the file operations used
+int hostFileStreamBench(const char* dirPath);
@@ -0,0 +1,217 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Host check of the register level GPIO used by the stepping ISR (RampGenGPIO) - the pin masks
+// and combined writes are checked directly and then moves are run through the robot with the
+// step, direction and endstop pins spread over both 32 bit GPIO registers
+
+#ifdef RAMPGEN_HOST_SIM
+
+#include <Arduino.h>
+#include <ArduinoLog.h>
+#include <set>
+#include "HostGpioMaskCheck.h"
+#include "RobotMotion/RobotController.h"
+#include "RobotMotion/MotionControl/RampGenerator/RampGenGPIO.h"
+#include "WorkManager/Evaluators/EvaluatorGCode.h"
+
+// Pins - axis1 steps on the second register and its direction is reversed, the axis0 endstop
+// is active low on the second register and the axis1 endstop is active high on the first
+static const int AXIS0_STEP_PIN = 27;
+static const int AXIS0_DIRN_PIN = 33;
+static const int AXIS0_ENDSTOP_PIN = 39;
+static const int AXIS1_STEP_PIN = 32;
+static const int AXIS1_DIRN_PIN = 16;
+static const int AXIS1_ENDSTOP_PIN = 5;
+
+// Steps for each 2mm move (200 steps per mm)
+static const uint32_t MOVE_STEPS = 400;
+
+// Main loop period and limit on virtual time for each move
+static const uint32_t LOOP_TICKS = MotionBlock::TICKS_PER_RATE_UPDATE;
+static const uint32_t MAX_MOVE_TICKS = 60 * 100000;
+
+static const char* GPIO_MASK_CHECK_CONFIG =
+    "{"
+    " \"robotType\": \"GpioMaskCheck\","
+    " \"robotGeom\":"
+    " {"
+    "   \"model\": \"Cartesian\","
+    "   \"blockDistanceMM\": 1,"
+    "   \"allowOutOfBounds\": 0,"
+    "   \"stepEnablePin\": \"21\","
+    "   \"stepEnLev\": 0,"
+    "   \"stepDisableSecs\": 10,"
+    "   \"axis0\":"
+    "   {"
+    "     \"maxSpeed\": 50, \"maxAcc\": 50, \"stepsPerRot\": 3200, \"unitsPerRot\": 16, \"maxRPM\": 200,"
+    "     \"maxVal\": 200, \"stepPin\": \"27\", \"dirnPin\": \"33\","
+    "     \"endStop0\": { \"sensePin\": \"39\", \"actLvl\": 0, \"inputType\": \"INPUT_PULLUP\" }"
+    "   },"
+    "   \"axis1\":"
+    "   {"
+    "     \"maxSpeed\": 50, \"maxAcc\": 50, \"stepsPerRot\": 3200, \"unitsPerRot\": 16, \"maxRPM\": 200,"
+    "     \"maxVal\": 200, \"stepPin\": \"32\", \"dirnPin\": \"16\", \"dirnRev\": 1,"
+    "     \"endStop0\": { \"sensePin\": \"5\", \"actLvl\": 1, \"inputType\": \"INPUT_PULLDOWN\" }"
+    "   }"
+    " }"
+    "}";
+
+static int _checksFailed = 0;
+
+static void checkResult(bool ok, const char* checkName)
+{
+    printf("%s %s\n", ok ? "OK" : "FAIL", checkName);
+    if (!ok)
+        _checksFailed++;
+}
+
+static bool pinLevel(int pin)
+{
+    return (RampGenGPIO::readInputs() & RampGenGPIO::pinMask(pin)) != 0;
+}
+
+// Result of a move
+struct MoveResult
+{
+    uint32_t steps[2];
+    bool dirnFwd[2];
+    bool stepsTogether;
+    uint32_t pinWrites;
+    uint32_t expectedWrites;
+    bool endStopReached;
+};
+
+// Run a G-code move to completion - if endStopPin is given it is set to endStopLevel once the
+// move is a quarter done (and held until the move ends)
+static void runMove(RobotController& robotController, const char* gcode, int endStopPin, int endStopLevel,
+            MoveResult& result)
+{
+    MotionHelper& motionHelper = robotController.simGetMotionHelper();
+    RampGenerator& rampGenerator = motionHelper.simGetRampGenerator();
+    RampGenIO& rampGenIO = rampGenerator.simGetRampGenIO();
+    rampGenIO.simClear();
+    rampGenerator.clearEndstopReached();
+    uint32_t pinWritesStart = hostGetPinWriteCount();
+    uint32_t blocksStart = rampGenerator.getPipelineStats().getBlocksStarted();
+
+    // Run the move
+    WorkItem workItem(gcode);
+    EvaluatorGCode::interpretGcode(workItem, &robotController, true);
+    do
+    {
+        robotController.service();
+        rampGenerator.simRunTicks(LOOP_TICKS);
+        if ((endStopPin >= 0) && (rampGenIO.simGetStepCount(0) + rampGenIO.simGetStepCount(1) >= MOVE_STEPS / 2))
+        {
+            hostSetPinLevel(endStopPin, endStopLevel);
+            endStopPin = -1;
+        }
+    } while ((!robotController.canAcceptCommand() || !motionHelper.isIdle()) &&
+                (rampGenIO.simGetTickCount() < MAX_MOVE_TICKS));
+
+    // Steps and last direction of each axis
+    std::set<uint32_t> stepStartTicks[2];
+    std::set<uint32_t> stepEndTicks;
+    for (int axisIdx = 0; axisIdx < 2; axisIdx++)
+    {
+        result.steps[axisIdx] = rampGenIO.simGetStepCount(axisIdx);
+        result.dirnFwd[axisIdx] = false;
+    }
+    for (const RampGenIO::SimEdge& edge : rampGenIO.simGetEdges())
+    {
+        if (edge.axisIdx > 1)
+            continue;
+        if (edge.isDirn)
+            result.dirnFwd[edge.axisIdx] = edge.level;
+        else if (edge.level)
+            stepStartTicks[edge.axisIdx].insert(edge.tick);
+        else
+            stepEndTicks.insert(edge.tick);
+    }
+
+    // A write per block for the directions and a write per tick on which steps start or end
+    result.stepsTogether = (stepStartTicks[0] == stepStartTicks[1]);
+    result.pinWrites = hostGetPinWriteCount() - pinWritesStart;
+    result.expectedWrites = (rampGenerator.getPipelineStats().getBlocksStarted() - blocksStart) +
+                stepStartTicks[0].size() + stepEndTicks.size();
+    result.endStopReached = rampGenerator.isEndStopReached();
+}
+
+static bool fullMove(const MoveResult& result)
+{
+    return (result.steps[0] == MOVE_STEPS) && (result.steps[1] == MOVE_STEPS) && !result.endStopReached;
+}
+
+int hostGpioMaskCheck()
+{
+    // Pin masks
+    checkResult((RampGenGPIO::pinMask(-1) == 0) && (RampGenGPIO::pinMask(64) == 0), "pinMask invalid pins 0");
+    checkResult((RampGenGPIO::pinMask(0) == 1) && (RampGenGPIO::pinMask(31) == 0x80000000ULL) &&
+                (RampGenGPIO::pinMask(32) == 0x100000000ULL) && (RampGenGPIO::pinMask(39) == 0x8000000000ULL) &&
+                (RampGenGPIO::pinMask(63) == 0x8000000000000000ULL), "pinMask 0 31 32 39 63");
+
+    // Combined writes across both registers - pins in both set and clear masks end up cleared
+    uint64_t levelsStart = RampGenGPIO::readInputs();
+    uint64_t bothRegsMask = RampGenGPIO::pinMask(2) | RampGenGPIO::pinMask(34);
+    uint32_t pinWritesStart = hostGetPinWriteCount();
+    RampGenGPIO::writeOutputs(bothRegsMask, 0);
+    checkResult((RampGenGPIO::readInputs() & bothRegsMask) == bothRegsMask, "writeOutputs set pins 2 and 34");
+    RampGenGPIO::writeOutputs(RampGenGPIO::pinMask(2), bothRegsMask);
+    checkResult((RampGenGPIO::readInputs() & bothRegsMask) == 0, "writeOutputs set and clear pin 2 clears");
+    checkResult(hostGetPinWriteCount() - pinWritesStart == 2, "writeOutputs one write each");
+    RampGenGPIO::writeOutputs(levelsStart, ~levelsStart);
+
+    // Robot
+    RobotController robotController;
+    robotController.init(GPIO_MASK_CHECK_CONFIG);
+    checkResult(pinLevel(AXIS0_ENDSTOP_PIN) && !pinLevel(AXIS1_ENDSTOP_PIN), "endstops idle not hit");
+    char checkName[200];
+
+    // Steps for both axes (one on each register) start and end together with one write per tick
+    MoveResult result;
+    runMove(robotController, "G0 X2 Y2", -1, 0, result);
+    snprintf(checkName, sizeof(checkName), "steps X %u Y %u together %s pinWrites %u (expected %u)",
+                result.steps[0], result.steps[1], result.stepsTogether ? "Y" : "N", result.pinWrites, result.expectedWrites);
+    checkResult(fullMove(result) && result.stepsTogether && (result.pinWrites == result.expectedWrites), checkName);
+    checkResult(!pinLevel(AXIS0_STEP_PIN) && !pinLevel(AXIS1_STEP_PIN), "step pins low after move");
+
+    // Directions - the pin is low for forwards unless the axis is reversed
+    checkResult(result.dirnFwd[0] && result.dirnFwd[1] && !pinLevel(AXIS0_DIRN_PIN) && pinLevel(AXIS1_DIRN_PIN),
+                "direction forwards (axis1 reversed)");
+    runMove(robotController, "G0 X4 Y4", -1, 0, result);
+    runMove(robotController, "G0 X2 Y2", -1, 0, result);
+    checkResult(fullMove(result) && !result.dirnFwd[0] && !result.dirnFwd[1] && pinLevel(AXIS0_DIRN_PIN) &&
+                !pinLevel(AXIS1_DIRN_PIN), "direction backwards (axis1 reversed)");
+
+    // Endstops checked but not hit
+    runMove(robotController, "G0 X4 Y4", -1, 0, result);
+    runMove(robotController, "G0 X2 Y2 S1", -1, 0, result);
+    checkResult(fullMove(result), "endstops checked not hit");
+
+    // Active low endstop on the second register
+    runMove(robotController, "G0 X0 Y0 S1", AXIS0_ENDSTOP_PIN, LOW, result);
+    snprintf(checkName, sizeof(checkName), "endstop pin %d active low hit (stopped after %u steps)",
+                AXIS0_ENDSTOP_PIN, result.steps[0]);
+    checkResult(result.endStopReached && (result.steps[0] < MOVE_STEPS), checkName);
+
+    // Endstop hit but the axis is moving away from it or endstops aren't checked
+    runMove(robotController, "G0 X2 Y2 S1", -1, 0, result);
+    checkResult(fullMove(result), "endstop hit moving away");
+    runMove(robotController, "G0 X0 Y0", -1, 0, result);
+    checkResult(fullMove(result), "endstop hit not checked");
+    hostSetPinLevel(AXIS0_ENDSTOP_PIN, HIGH);
+
+    // Active high endstop on the first register
+    runMove(robotController, "G0 X2 Y2", -1, 0, result);
+    runMove(robotController, "G0 X0 Y0 S1", AXIS1_ENDSTOP_PIN, HIGH, result);
+    snprintf(checkName, sizeof(checkName), "endstop pin %d active high hit (stopped after %u steps)",
+                AXIS1_ENDSTOP_PIN, result.steps[1]);
+    checkResult(result.endStopReached && (result.steps[1] < MOVE_STEPS), checkName);
+    hostSetPinLevel(AXIS1_ENDSTOP_PIN, LOW);
+
+    printf("gpioMasks failed %d %s\n", _checksFailed, _checksFailed == 0 ? "OK" : "FAIL");
+    return (_checksFailed == 0) ? 0 : 1;
+}
+
+#endif // RAMPGEN_HOST_SIM
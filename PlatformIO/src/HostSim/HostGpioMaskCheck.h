@@ -0,0 +1,10 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+#pragma once
+
+// Check the register level GPIO used by the stepping ISR - pin masks, combined set/clear writes,
+// steps for several axes started and ended with one write, direction masks (including a reversed
+// axis) and the endstop mask and hit levels (active low and high, either register) - returns 0 if
+// all cases pass
+int hostGpioMaskCheck();
@@ -0,0 +1,220 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Offline input shaper check - the unshaped steps of each axis are replayed through InputShaper
+// tick by tick and both step streams drive a model of the joint resonance (a mass on a spring
+// towards the commanded position with damping at the shaper's design frequency and damping ratio)
+// The residual vibration is the deviation of the model from the commanded position in the vibration
+// period after each stop (a gap in steps of more than two vibration periods)
+
+#ifdef RAMPGEN_HOST_SIM
+
+#include <Arduino.h>
+#include <ArduinoLog.h>
+#include <math.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "RdJsonDoc.h"
+#include "HostInputShaperCheck.h"
+#include "RobotMotion/AxesParams.h"
+#include "RobotMotion/MotionControl/MotionBlock.h"
+#include "RobotMotion/MotionControl/RampGenerator/InputShaper.h"
+
+struct StepEvent
+{
+    uint32_t tick;
+    int dirn;
+};
+
+struct VibrationResult
+{
+    double peakResidualSteps;
+    double rmsResidualSteps;
+    uint32_t numStops;
+};
+
+// Read step events for each axis from an edge CSV (tick,axis,S|D,level)
+static bool readStepEvents(const char* edgesFile, std::vector<StepEvent> axisSteps[RobotConsts::MAX_AXES])
+{
+    std::ifstream edgesStream(edgesFile);
+    if (!edgesStream)
+        return false;
+    bool dirnFwd[RobotConsts::MAX_AXES];
+    for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+        dirnFwd[axisIdx] = false;
+    std::string line;
+    while (std::getline(edgesStream, line))
+    {
+        unsigned int tick = 0, level = 0;
+        int axisIdx = 0;
+        char edgeType = 0;
+        if ((sscanf(line.c_str(), "%u,%d,%c,%u", &tick, &axisIdx, &edgeType, &level) != 4) ||
+                    (axisIdx < 0) || (axisIdx >= RobotConsts::MAX_AXES))
+            continue;
+        if (edgeType == 'D')
+            dirnFwd[axisIdx] = level != 0;
+        else if ((edgeType == 'S') && level)
+            axisSteps[axisIdx].push_back({ tick, dirnFwd[axisIdx] ? 1 : -1 });
+    }
+    return true;
+}
+
+// Shape a step stream - the steps are fed in on their ticks and the shaper is run on until the
+// last delayed step is out
+static void shapeSteps(InputShaper& shaper, const std::vector<StepEvent>& steps, std::vector<StepEvent>& shapedSteps)
+{
+    shaper.reset();
+    if (steps.empty())
+        return;
+    uint32_t endTick = steps.back().tick + shaper.getDurationTicks() + 10;
+    size_t stepIdx = 0;
+    for (uint32_t tick = steps.front().tick; tick <= endTick; tick++)
+    {
+        int stepIn = 0;
+        if ((stepIdx < steps.size()) && (steps[stepIdx].tick == tick))
+            stepIn = steps[stepIdx++].dirn;
+        if (shaper.process(stepIn, false) == InputShaper::OUTPUT_STEP)
+            shapedSteps.push_back({ tick, shaper.isDirnFwd() ? 1 : -1 });
+    }
+}
+
+// Drive the joint model with a step stream - residuals are only counted for stops (more than two
+// vibration periods with no steps)
+static VibrationResult measureVibration(const std::vector<StepEvent>& steps, double freqHz, double damping, uint32_t endTick)
+{
+    VibrationResult result = { 0, 0, 0 };
+    if (steps.empty())
+        return result;
+    double omega = 2 * M_PI * freqHz;
+    double dt = MotionBlock::TICK_INTERVAL_NS / 1e9;
+    uint32_t periodTicks = uint32_t(MotionBlock::TICKS_PER_SEC / freqHz);
+    double commanded = 0, pos = 0, vel = 0;
+    double sumSq = 0, stopSumSq = 0, stopPeak = 0;
+    uint32_t numSamples = 0;
+    size_t stepIdx = 0;
+    int32_t stepPos = 0;
+    uint32_t lastStepTick = steps.front().tick;
+    for (uint32_t tick = steps.front().tick; tick <= endTick; tick++)
+    {
+        while ((stepIdx < steps.size()) && (steps[stepIdx].tick == tick))
+        {
+            stepPos += steps[stepIdx++].dirn;
+            lastStepTick = tick;
+            stopPeak = 0;
+            stopSumSq = 0;
+        }
+
+        // Commanded position moves linearly to the next step (over at most a period) so that
+        // the joint isn't excited by the step quantisation
+        commanded = stepPos;
+        if (stepIdx < steps.size())
+        {
+            uint32_t rampTicks = std::min(steps[stepIdx].tick - lastStepTick, periodTicks);
+            uint32_t ticksToStep = steps[stepIdx].tick - tick;
+            if (ticksToStep < rampTicks)
+                commanded += steps[stepIdx].dirn * double(rampTicks - ticksToStep) / rampTicks;
+        }
+        vel += (omega * omega * (commanded - pos) - 2 * damping * omega * vel) * dt;
+        pos += vel * dt;
+
+        // Residual in the period after the last step
+        uint32_t ticksSinceStep = tick - lastStepTick;
+        if ((ticksSinceStep == 0) || (ticksSinceStep > periodTicks))
+            continue;
+        double residual = fabs(pos - commanded);
+        stopPeak = std::max(stopPeak, residual);
+        stopSumSq += residual * residual;
+        bool isStop = (stepIdx >= steps.size()) || (steps[stepIdx].tick - lastStepTick > 2 * periodTicks);
+        if ((ticksSinceStep == periodTicks) && isStop)
+        {
+            result.numStops++;
+            result.peakResidualSteps = std::max(result.peakResidualSteps, stopPeak);
+            sumSq += stopSumSq;
+            numSamples += periodTicks;
+        }
+    }
+    result.rmsResidualSteps = numSamples ? sqrt(sumSq / numSamples) : 0;
+    return result;
+}
+
+int hostInputShaperCheck(const char* robotConfig, const char* edgesFile, const char* shaperSpec)
+{
+    std::vector<StepEvent> axisSteps[RobotConsts::MAX_AXES];
+    if (!readStepEvents(edgesFile, axisSteps))
+    {
+        printf("can't read edges %s\n", edgesFile);
+        return 1;
+    }
+
+    // Shaper override
+    InputShaper::ShaperType specType = InputShaper::SHAPER_NONE;
+    double specFreqHz = 0, specDamping = 0.1;
+    if (shaperSpec && shaperSpec[0])
+    {
+        char typeStr[10] = "";
+        sscanf(shaperSpec, "%9[^,],%lf,%lf", typeStr, &specFreqHz, &specDamping);
+        specType = InputShaper::getTypeFromStr(typeStr);
+    }
+
+    // Axes from the robot config
+    AxesParams axesParams;
+    RdJsonDoc robotGeomDoc(RdJson::getString("robotGeom", "NONE", robotConfig).c_str());
+    RdJsonDoc axisDoc;
+    bool allOk = true;
+    int axesShaped = 0;
+    for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+    {
+        if (axisSteps[axisIdx].empty() || !axesParams.configureAxis(robotGeomDoc, axisIdx, axisDoc))
+            continue;
+        InputShaper* pShaper = NULL;
+        if (specType != InputShaper::SHAPER_NONE)
+        {
+            pShaper = new InputShaper();
+            if (!pShaper->setup(specType, specFreqHz, specDamping))
+            {
+                delete pShaper;
+                pShaper = NULL;
+            }
+        }
+        else
+        {
+            pShaper = InputShaper::createFromConfig(axisIdx, axisDoc);
+        }
+        if (!pShaper)
+        {
+            printf("axis%d steps %u no shaper\n", axisIdx, uint32_t(axisSteps[axisIdx].size()));
+            continue;
+        }
+        axesShaped++;
+
+        // Shape and compare
+        std::vector<StepEvent> shapedSteps;
+        shapeSteps(*pShaper, axisSteps[axisIdx], shapedSteps);
+        int32_t unshapedPos = 0, shapedPos = 0;
+        for (const StepEvent& step : axisSteps[axisIdx])
+            unshapedPos += step.dirn;
+        for (const StepEvent& step : shapedSteps)
+            shapedPos += step.dirn;
+        uint32_t endTick = std::max(axisSteps[axisIdx].back().tick, shapedSteps.empty() ? 0 : shapedSteps.back().tick) +
+                    uint32_t(MotionBlock::TICKS_PER_SEC / pShaper->getFreqHz());
+        VibrationResult unshaped = measureVibration(axisSteps[axisIdx], pShaper->getFreqHz(), pShaper->getDamping(), endTick);
+        VibrationResult shaped = measureVibration(shapedSteps, pShaper->getFreqHz(), pShaper->getDamping(), endTick);
+        double ticksPerMs = MotionBlock::TICKS_PER_SEC / 1000;
+        double endDelayMs = shapedSteps.empty() ? 0 : (double(shapedSteps.back().tick) - axisSteps[axisIdx].back().tick) / ticksPerMs;
+        printf("axis%d %s\n", axisIdx, pShaper->getInfoStr().c_str());
+        printf("axis%d steps %u/%u pos %d/%d stops %u/%u residualPeak %.3f/%.3f residualRms %.3f/%.3f (unshaped/shaped steps) "
+                    "reduction %.0f%% latency centroid %.2fms end %.2fms\n",
+                    axisIdx, uint32_t(axisSteps[axisIdx].size()), uint32_t(shapedSteps.size()), unshapedPos, shapedPos,
+                    unshaped.numStops, shaped.numStops, unshaped.peakResidualSteps, shaped.peakResidualSteps,
+                    unshaped.rmsResidualSteps, shaped.rmsResidualSteps,
+                    unshaped.rmsResidualSteps > 0 ? 100 * (1 - shaped.rmsResidualSteps / unshaped.rmsResidualSteps) : 0,
+                    pShaper->getCentroidTicks() / ticksPerMs, endDelayMs);
+        allOk = allOk && (unshapedPos == shapedPos) && (shaped.rmsResidualSteps <= unshaped.rmsResidualSteps);
+        delete pShaper;
+    }
+    return (allOk && (axesShaped > 0)) ? 0 : 1;
+}
+
+#endif // RAMPGEN_HOST_SIM
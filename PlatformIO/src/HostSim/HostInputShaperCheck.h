@@ -0,0 +1,10 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+#pragma once
+
+// Run the input shaper of each axis (from the robot config or shaperSpec "type,freqHz,damping" for
+// all axes) offline over a recorded step stream (edge CSV as output by HostMotionSim -e) - reports
+// the residual vibration of the joint (modelled as a damped resonance at the shaper frequency)
+// with and without shaping and the latency the shaper adds
+int hostInputShaperCheck(const char* robotConfig, const char* edgesFile, const char* shaperSpec);
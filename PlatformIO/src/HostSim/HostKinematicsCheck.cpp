@@ -0,0 +1,226 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Host check of the SandTableScara kinematics against a copy of the original double
+// precision implementation (sqrt/pow, atan2 and AxisUtils::cosineRule) over the whole bed
+
+#ifdef RAMPGEN_HOST_SIM
+
+#include <Arduino.h>
+#include <ArduinoLog.h>
+#include <chrono>
+#include <vector>
+#include "RdJsonDoc.h"
+#include "HostKinematicsCheck.h"
+#include "RobotMotion/AxesParams.h"
+#include "RobotMotion/AxisPosition.h"
+#include "RobotMotion/MotionControl/MotionHelper.h"
+#include "RobotMotion/Robots/RobotSandTableScara.h"
+
+// Original cartesian to polar (degrees)
+static void refCartesianToPolar(AxisFloats& targetPt, AxisFloats& soln1, AxisFloats& soln2, AxesParams& axesParams)
+{
+    float shoulderElbowMM = 100, elbowHandMM = 100;
+    axesParams.getMaxVal(0, shoulderElbowMM);
+    axesParams.getMaxVal(1, elbowHandMM);
+    float thirdSideL3MM = sqrt(pow(targetPt._pt[0], 2) + pow(targetPt._pt[1], 2));
+    float delta1 = atan2(targetPt._pt[0], targetPt._pt[1]);
+    if (delta1 < 0)
+        delta1 += M_PI * 2;
+    float delta2 = AxisUtils::cosineRule(thirdSideL3MM, shoulderElbowMM, elbowHandMM);
+    float innerAngleOppThirdGamma = AxisUtils::cosineRule(shoulderElbowMM, elbowHandMM, thirdSideL3MM);
+    float alpha1rads = delta1 - delta2;
+    float beta1rads = alpha1rads - innerAngleOppThirdGamma + M_PI;
+    float alpha2rads = delta1 + delta2;
+    float beta2rads = alpha2rads + innerAngleOppThirdGamma - M_PI;
+    soln1.setVal(0, AxisUtils::r2d(AxisUtils::wrapRadians(alpha1rads + 2 * M_PI)));
+    soln1.setVal(1, AxisUtils::r2d(AxisUtils::wrapRadians(beta1rads + 2 * M_PI)));
+    soln2.setVal(0, AxisUtils::r2d(AxisUtils::wrapRadians(alpha2rads + 2 * M_PI)));
+    soln2.setVal(1, AxisUtils::r2d(AxisUtils::wrapRadians(beta2rads + 2 * M_PI)));
+}
+
+// Original relative rotation
+static float refCalcRelativePolar(float targetRotation, float curRotation)
+{
+    float diffAngle = targetRotation - curRotation;
+    if (diffAngle <= -180)
+        return 360 + diffAngle;
+    if (diffAngle > 180)
+        return diffAngle - 360;
+    return diffAngle;
+}
+
+// Original point to actuator (in-bounds points away from the origin) with the tie-break of the
+// solutions made as RobotSandTableScara::ptToActuator (in double)
+static void refPtToActuator(AxisFloats& targetPt, AxisFloats& outActuator, AxisPosition& curPos, AxesParams& axesParams)
+{
+    float curPolar0 = AxisUtils::wrapDegrees(curPos._stepsFromHome.getVal(0) * 360 / axesParams.getStepsPerRot(0));
+    float curPolar1 = AxisUtils::wrapDegrees(540 - (curPos._stepsFromHome.getVal(1) * 360 / axesParams.getStepsPerRot(1)));
+    AxisFloats soln1, soln2;
+    refCartesianToPolar(targetPt, soln1, soln2, axesParams);
+    float a1Rel = refCalcRelativePolar(soln1.getVal(0), curPolar0);
+    float b1Rel = refCalcRelativePolar(soln1.getVal(1), curPolar1);
+    float a2Rel = refCalcRelativePolar(soln2.getVal(0), curPolar0);
+    float b2Rel = refCalcRelativePolar(soln2.getVal(1), curPolar1);
+    double soln1Rotation = fabs(a1Rel) + fabs(b1Rel);
+    double soln2Rotation = fabs(a2Rel) + fabs(b2Rel);
+    bool useSoln1 = soln1Rotation <= soln2Rotation;
+    if (fabs(soln1Rotation - soln2Rotation) <= RobotSandTableScara::IK_SOLN_HYSTERESIS_DEGS)
+        useSoln1 = refCalcRelativePolar(curPolar1, curPolar0) >= 0;
+    float aRel = useSoln1 ? a1Rel : a2Rel;
+    float bRel = useSoln1 ? b1Rel : b2Rel;
+    outActuator.setVal(0, curPos._stepsFromHome.getVal(0) + int32_t(roundf(aRel * axesParams.getStepsPerRot(0) / 360)));
+    outActuator.setVal(1, curPos._stepsFromHome.getVal(1) + int32_t(roundf(-bRel * axesParams.getStepsPerRot(1) / 360)));
+}
+
+static double angleDiffDegs(double a, double b)
+{
+    double diff = fabs(a - b);
+    return diff > 180 ? 360 - diff : diff;
+}
+
+// Check (and optionally time) both modes on one grid - returns true if within limits
+static bool checkGrid(RobotSandTableScara& robot, AxesParams& axesParams, float gridMM, bool timeModes)
+{
+    float shoulderElbowMM = 100, elbowHandMM = 100;
+    axesParams.getMaxVal(0, shoulderElbowMM);
+    axesParams.getMaxVal(1, elbowHandMM);
+    float bedRadiusMM = shoulderElbowMM + elbowHandMM;
+
+    // Grid over the bed - excluding the origin which ptToActuator handles separately - in a
+    // raster so that each point starts from the steps of the previous one
+    std::vector<AxisFloats> pts;
+    int gridSteps = int(bedRadiusMM / gridMM);
+    for (int yIdx = -gridSteps; yIdx <= gridSteps; yIdx++)
+    {
+        for (int i = -gridSteps; i <= gridSteps; i++)
+        {
+            int xIdx = (yIdx & 1) ? -i : i;
+            float x = xIdx * gridMM, y = yIdx * gridMM;
+            if ((x * x + y * y > bedRadiusMM * bedRadiusMM) || (fabsf(x) < 1 && fabsf(y) < 1))
+                continue;
+            pts.push_back(AxisFloats(x, y));
+        }
+    }
+    std::vector<AxisPosition> curPositions(pts.size());
+    std::vector<AxisFloats> refActuators(pts.size());
+    AxisPosition curPos;
+    curPos.clear();
+    for (size_t ptIdx = 0; ptIdx < pts.size(); ptIdx++)
+    {
+        curPositions[ptIdx] = curPos;
+        refPtToActuator(pts[ptIdx], refActuators[ptIdx], curPos, axesParams);
+        curPos._stepsFromHome.set(int32_t(refActuators[ptIdx].getVal(0)), int32_t(refActuators[ptIdx].getVal(1)));
+        RobotSandTableScara::correctStepOverflow(curPos, axesParams);
+    }
+    printf("kinematics bed radius %.1fmm grid %.2fmm points %zu\n", bedRadiusMM, gridMM, pts.size());
+
+    // Accuracy of each mode - near full extension (within 1mm of the edge) the arm angles are
+    // ill-conditioned (float rounding of the target alone moves them by ~0.002 degrees) so only
+    // the hand position is checked there - steps are checked everywhere (the tie-break of the
+    // solutions means the arms mustn't flip over even at the edge)
+    bool gridOk = true;
+    std::vector<AxisFloats> modeActuators[2];
+    for (int fast = 0; fast < 2; fast++)
+    {
+        robot.setFastKinematics(fast);
+        modeActuators[fast].resize(pts.size());
+        double maxErrDegs = 0, maxEdgeErrDegs = 0, maxPosErrMM = 0, maxRefPosErrMM = 0;
+        uint32_t stepMismatches = 0;
+        int32_t maxStepErr = 0;
+        for (size_t ptIdx = 0; ptIdx < pts.size(); ptIdx++)
+        {
+            AxisFloats ref1, ref2, soln1, soln2;
+            AxisFloats& actuator = modeActuators[fast][ptIdx];
+            refCartesianToPolar(pts[ptIdx], ref1, ref2, axesParams);
+            robot.cartesianToPolar(pts[ptIdx], soln1, soln2, axesParams);
+            float x = pts[ptIdx]._pt[0], y = pts[ptIdx]._pt[1];
+            bool nearEdge = sqrt(x * x + y * y) > bedRadiusMM - 1;
+            for (int axisIdx = 0; axisIdx < RobotSandTableScara::NUM_ROBOT_AXES; axisIdx++)
+            {
+                double errDegs = std::max(angleDiffDegs(ref1.getVal(axisIdx), soln1.getVal(axisIdx)),
+                            angleDiffDegs(ref2.getVal(axisIdx), soln2.getVal(axisIdx)));
+                if (nearEdge)
+                    maxEdgeErrDegs = std::max(maxEdgeErrDegs, errDegs);
+                else
+                    maxErrDegs = std::max(maxErrDegs, errDegs);
+            }
+            for (AxisFloats* pSoln : { &soln1, &soln2, &ref1, &ref2 })
+            {
+                double handX = shoulderElbowMM * sin(AxisUtils::d2r(pSoln->getVal(0))) +
+                            elbowHandMM * sin(AxisUtils::d2r(pSoln->getVal(1)));
+                double handY = shoulderElbowMM * cos(AxisUtils::d2r(pSoln->getVal(0))) +
+                            elbowHandMM * cos(AxisUtils::d2r(pSoln->getVal(1)));
+                double posErrMM = sqrt((handX - x) * (handX - x) + (handY - y) * (handY - y));
+                double& maxErrMM = ((pSoln == &ref1) || (pSoln == &ref2)) ? maxRefPosErrMM : maxPosErrMM;
+                maxErrMM = std::max(maxErrMM, posErrMM);
+            }
+            robot.ptToActuator(pts[ptIdx], actuator, curPositions[ptIdx], axesParams, false);
+            bool mismatch = false;
+            for (int axisIdx = 0; axisIdx < RobotSandTableScara::NUM_ROBOT_AXES; axisIdx++)
+            {
+                int32_t stepErr = abs(int32_t(actuator.getVal(axisIdx)) - int32_t(refActuators[ptIdx].getVal(axisIdx)));
+                maxStepErr = std::max(maxStepErr, stepErr);
+                mismatch |= stepErr != 0;
+            }
+            stepMismatches += mismatch;
+        }
+        bool ok = (maxErrDegs <= RobotSandTableScara::FAST_KINEMATICS_MAX_ERR_DEGS) && (maxStepErr <= 1) &&
+                    (maxPosErrMM < 0.01);
+        printf("kinematics %s maxAngleErrDegs %.7f (edge %.7f) maxHandErrMM %.6f (original %.6f) stepMismatches %u (%.4f%%) maxStepErr %d %s\n",
+                    fast ? "fast" : "libm", maxErrDegs, maxEdgeErrDegs, maxPosErrMM, maxRefPosErrMM, stepMismatches,
+                    stepMismatches * 100.0 / pts.size(), maxStepErr, ok ? "OK" : "FAIL");
+        gridOk &= ok;
+    }
+
+    // The two modes must pick the same solution
+    int32_t maxModeStepDiff = 0;
+    for (size_t ptIdx = 0; ptIdx < pts.size(); ptIdx++)
+        for (int axisIdx = 0; axisIdx < RobotSandTableScara::NUM_ROBOT_AXES; axisIdx++)
+            maxModeStepDiff = std::max(maxModeStepDiff, abs(int32_t(modeActuators[0][ptIdx].getVal(axisIdx)) -
+                        int32_t(modeActuators[1][ptIdx].getVal(axisIdx))));
+    printf("kinematics libm/fast maxStepDiff %d %s\n", maxModeStepDiff, maxModeStepDiff <= 1 ? "OK" : "FAIL");
+    gridOk &= maxModeStepDiff <= 1;
+
+    // Timing
+    for (int mode = 0; timeModes && (mode < 3); mode++)
+    {
+        robot.setFastKinematics(mode == 2);
+        AxisFloats actuator;
+        double checkSum = 0;
+        auto startTime = std::chrono::steady_clock::now();
+        for (size_t ptIdx = 0; ptIdx < pts.size(); ptIdx++)
+        {
+            if (mode == 0)
+                refPtToActuator(pts[ptIdx], actuator, curPositions[ptIdx], axesParams);
+            else
+                robot.ptToActuator(pts[ptIdx], actuator, curPositions[ptIdx], axesParams, false);
+            checkSum += actuator.getVal(0) + actuator.getVal(1);
+        }
+        double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        printf("kinematics ptToActuator %s %.1fns per point (checksum %.0f)\n",
+                    mode == 0 ? "original" : (mode == 1 ? "libm" : "fast"), secs * 1e9 / pts.size(), checkSum);
+    }
+    return gridOk;
+}
+
+int hostKinematicsCheck(const char* robotConfig, const std::vector<float>& gridsMM)
+{
+    // Axes from the robot config (as MotionHelper::configure)
+    AxesParams axesParams;
+    RdJsonDoc robotGeomDoc(RdJson::getString("robotGeom", "NONE", robotConfig).c_str());
+    RdJsonDoc axisDoc;
+    for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+        axesParams.configureAxis(robotGeomDoc, axisIdx, axisDoc);
+
+    // Robot (the kinematics mode is per robot) - timing is on the first grid
+    MotionHelper motionHelper;
+    RobotSandTableScara robot("SingleArmScara", motionHelper);
+    int failedGrids = 0;
+    for (size_t gridIdx = 0; gridIdx < gridsMM.size(); gridIdx++)
+        failedGrids += !checkGrid(robot, axesParams, gridsMM[gridIdx], gridIdx == 0);
+    printf("kinematics grids %zu failed %d %s\n", gridsMM.size(), failedGrids, failedGrids == 0 ? "OK" : "FAIL");
+    return failedGrids == 0 ? 0 : 1;
+}
+
+#endif // RAMPGEN_HOST_SIM
@@ -0,0 +1,10 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+#pragma once
+
+#include <vector>
+
+// Sweep the whole bed on each grid comparing SandTableScara kinematics (libm and fast modes)
+// with the original double precision implementation and time each - returns 0 if within limits
+int hostKinematicsCheck(const char* robotConfig, const std::vector<float>& gridsMM);
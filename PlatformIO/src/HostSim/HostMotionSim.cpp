@@ -0,0 +1,327 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Host motion simulator - runs G-code through the robot controller, planner and
+// ramp generator with the simulated RampGenIO and reports what the motors would
+// have done at ISR tick resolution
+//
+// Usage: HostMotionSim [-r robotType | -c configFile] [-l loopUs] [-t maxSecs] [-e] [-i] [-v] [-f] < file.gcode
+//        HostMotionSim [-r robotType | -c configFile] -k gridMM[,gridMM...]
+//        HostMotionSim -j iterations
+//        HostMotionSim -p patternFile
+//        HostMotionSim [-r robotType | -c configFile] -b numBlocks
+//        HostMotionSim -q numItems
+//        HostMotionSim [-r robotType | -c configFile] [-f] -n stallMs
+//        HostMotionSim [-r robotType | -c configFile] -s < file.gcode
+//        HostMotionSim [-r robotType | -c configFile] [-y type,freqHz,damping] -x edges.csv
+//        HostMotionSim [-d dir] -u fileKB
+//        HostMotionSim -g
+//        HostMotionSim -w dir
+//        HostMotionSim [-r robotType | -c configFile] -m file.thr
+//        HostMotionSim [-r robotType | -c configFile] [-l loopUs] -a file.thr
+//        HostMotionSim [-r robotType | -c configFile] [-l loopUs] -o file.param
+//   -r  robot configuration (from RobotConfigurations), default SandTableScara (XYBot for -n)
+//   -c  robot configuration JSON file (same format as RobotConfigurations)
+//   -l  virtual main-loop period in uS (ISR ticks run between service calls), default 1000
+//   -t  limit on virtual time in seconds, default 3600
+//   -e  output every step/direction edge as CSV: tick,axis,S|D,level
+//   -i  time the ISR using the CPU cycle counter (reported in the debug line)
+//   -v  log at notice level (to stderr)
+//   -f  output the loop profile (JSON as the profile REST API) of the main loop and planner
+//   -k  check SandTableScara kinematics accuracy over the bed on each grid (e.g. 0.25,1,2,5,10,20)
+//       and time it on the first (no G-code)
+//   -j  time config lookups for each built-in robot configuration (no G-code)
+//   -p  check and time a .param pattern file compiled against tinyexpr (no G-code)
+//   -b  time planning a number of blocks through MotionPlanner::moveTo (no G-code)
+//   -q  stress test the motion pipeline ring with producer and consumer threads (no G-code)
+//   -n  check the pipeline stays filled in real time with the main loop stalling for stallMs,
+//       planning from the loop and from the planner task (no G-code) - the stall must be long
+//       enough for the loop planner to run empty (e.g. 500 for XYBot)
+//   -s  run the G-code with trapezoid and jerk-limited (S-curve) profiles and check the S-curve
+//       step rate and acceleration are continuous
+//   -x  run the axis input shapers (from the robot config or -y for all axes) over the step stream
+//       recorded with -e and report the residual vibration and latency (no G-code)
+//   -u  time writing an uploaded file per block and through FileUploadWriter (no G-code)
+//   -d  directory for -u (use a tmpfs directory), default /dev/shm
+//   -g  check the GPIO pin masks and register writes for steps, directions and endstops (no G-code)
+//   -w  time reading the files in a directory line by line, reopening the file for each line and
+//       through FileStreamReader, e.g. ../Tests/EmulateWebServer/testfiles/sd (no G-code)
+//   -m  time queueing the interpolated points of a theta-rho file to the robot as G-code text work
+//       items and as pre-parsed move work items (no G-code)
+//   -a  time playing a theta-rho file with the interpolated points pushed as work items and pulled
+//       by MotionHelper, with -l as the main-loop period and draining the pipeline every loop
+//       (no G-code)
+//   -o  time playing a .param pattern file with the points pushed as work items and pulled by
+//       MotionHelper, with -l as the main-loop period and draining the pipeline every loop
+//       (no G-code)
+
+#ifdef RAMPGEN_HOST_SIM
+
+#include <Arduino.h>
+#include <ArduinoLog.h>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "RobotConfigurations.h"
+#include "HostKinematicsCheck.h"
+#include "HostConfigBench.h"
+#include "HostPatternBench.h"
+#include "HostPlannerBench.h"
+#include "HostRingStress.h"
+#include "HostPlannerTaskLatency.h"
+#include "HostProfileCheck.h"
+#include "HostInputShaperCheck.h"
+#include "HostUploadBench.h"
+#include "HostGpioMaskCheck.h"
+#include "HostFileStreamBench.h"
+#include "HostWorkItemBench.h"
+#include "HostThetaRhoBench.h"
+#include "HostPatternFeedBench.h"
+#include "RobotMotion/RobotController.h"
+#include "LoopProfiler.h"
+#include "WorkManager/Evaluators/EvaluatorGCode.h"
+
+// Points generated by each method when timing a pattern file
+static const uint32_t PATTERN_BENCH_POINTS = 1000000;
+
+// Run one virtual main-loop iteration - service followed by the ISR ticks
+// which would have occurred in the loop period
+static void simLoop(RobotController& robotController, RampGenerator& rampGenerator, uint32_t ticksPerLoop)
+{
+    LoopProfiler* pLoopProfiler = LoopProfiler::current();
+    if (pLoopProfiler)
+        pLoopProfiler->loopStart();
+    {
+        LOOP_PROFILE_SCOPE("Robot");
+        robotController.service();
+    }
+    LOOP_PROFILE_SCOPE("ISR");
+    rampGenerator.simRunTicks(ticksPerLoop);
+}
+
+int main(int argc, char* argv[])
+{
+    // Args
+    String robotType;
+    String configFile;
+    uint32_t loopUs = 1000;
+    uint32_t maxSecs = 3600;
+    bool outputEdges = false;
+    bool timeISR = false;
+    bool verbose = false;
+    bool outputProfile = false;
+    std::vector<float> kinematicsGridsMM;
+    uint32_t configBenchIterations = 0;
+    String patternFile;
+    uint32_t plannerBenchBlocks = 0;
+    uint32_t ringStressItems = 0;
+    uint32_t plannerTaskStallMs = 0;
+    bool profileCheck = false;
+    String shaperEdgesFile;
+    String shaperSpec;
+    uint32_t uploadBenchKB = 0;
+    String uploadBenchDir = "/dev/shm";
+    bool gpioMaskCheck = false;
+    String fileStreamBenchDir;
+    String workItemBenchFile;
+    String thetaRhoBenchFile;
+    String patternFeedBenchFile;
+    for (int i = 1; i < argc; i++)
+    {
+        String arg = argv[i];
+        if (arg.equals("-r") && (i + 1 < argc))
+            robotType = argv[++i];
+        else if (arg.equals("-c") && (i + 1 < argc))
+            configFile = argv[++i];
+        else if (arg.equals("-l") && (i + 1 < argc))
+            loopUs = strtoul(argv[++i], NULL, 10);
+        else if (arg.equals("-t") && (i + 1 < argc))
+            maxSecs = strtoul(argv[++i], NULL, 10);
+        else if (arg.equals("-e"))
+            outputEdges = true;
+        else if (arg.equals("-i"))
+            timeISR = true;
+        else if (arg.equals("-v"))
+            verbose = true;
+        else if (arg.equals("-f"))
+            outputProfile = true;
+        else if (arg.equals("-k") && (i + 1 < argc))
+        {
+            for (char* pGrid = argv[++i]; *pGrid; pGrid += (*pGrid == ','))
+            {
+                char* pEnd = pGrid;
+                float gridMM = strtof(pGrid, &pEnd);
+                if ((pEnd == pGrid) || (gridMM <= 0))
+                    break;
+                kinematicsGridsMM.push_back(gridMM);
+                pGrid = pEnd;
+            }
+        }
+        else if (arg.equals("-j") && (i + 1 < argc))
+            configBenchIterations = strtoul(argv[++i], NULL, 10);
+        else if (arg.equals("-p") && (i + 1 < argc))
+            patternFile = argv[++i];
+        else if (arg.equals("-b") && (i + 1 < argc))
+            plannerBenchBlocks = strtoul(argv[++i], NULL, 10);
+        else if (arg.equals("-q") && (i + 1 < argc))
+            ringStressItems = strtoul(argv[++i], NULL, 10);
+        else if (arg.equals("-n") && (i + 1 < argc))
+            plannerTaskStallMs = strtoul(argv[++i], NULL, 10);
+        else if (arg.equals("-s"))
+            profileCheck = true;
+        else if (arg.equals("-x") && (i + 1 < argc))
+            shaperEdgesFile = argv[++i];
+        else if (arg.equals("-y") && (i + 1 < argc))
+            shaperSpec = argv[++i];
+        else if (arg.equals("-u") && (i + 1 < argc))
+            uploadBenchKB = strtoul(argv[++i], NULL, 10);
+        else if (arg.equals("-d") && (i + 1 < argc))
+            uploadBenchDir = argv[++i];
+        else if (arg.equals("-g"))
+            gpioMaskCheck = true;
+        else if (arg.equals("-w") && (i + 1 < argc))
+            fileStreamBenchDir = argv[++i];
+        else if (arg.equals("-m") && (i + 1 < argc))
+            workItemBenchFile = argv[++i];
+        else if (arg.equals("-a") && (i + 1 < argc))
+            thetaRhoBenchFile = argv[++i];
+        else if (arg.equals("-o") && (i + 1 < argc))
+            patternFeedBenchFile = argv[++i];
+    }
+    Log.begin(verbose ? LOG_LEVEL_NOTICE : LOG_LEVEL_WARNING);
+    LoopProfiler loopProfiler("main");
+    if (outputProfile)
+        loopProfiler.attachToThisThread();
+
+    // Robot - XYBot is the default for the planner task check as the SandTableScara pipeline holds
+    // more motion than the run time so it never runs empty
+    if (robotType.length() == 0)
+        robotType = (plannerTaskStallMs > 0) ? "XYBot" : "SandTableScara";
+    RobotController robotController;
+    String robotConfig = RobotConfigurations::getConfig(robotType.c_str());
+    if (configFile.length() > 0)
+    {
+        std::ifstream configStream(configFile.c_str());
+        std::stringstream configContents;
+        configContents << configStream.rdbuf();
+        robotConfig = configContents.str().c_str();
+    }
+    if (configBenchIterations > 0)
+    {
+        hostConfigBench(configBenchIterations);
+        return 0;
+    }
+    if (uploadBenchKB > 0)
+        return hostUploadBench(uploadBenchDir.c_str(), uploadBenchKB);
+    if (gpioMaskCheck)
+        return hostGpioMaskCheck();
+    if (fileStreamBenchDir.length() > 0)
+        return hostFileStreamBench(fileStreamBenchDir.c_str());
+    if (ringStressItems > 0)
+        return hostRingStress(ringStressItems);
+    if (patternFile.length() > 0)
+        return hostPatternBench(patternFile.c_str(), PATTERN_BENCH_POINTS);
+    if (kinematicsGridsMM.size() > 0)
+        return hostKinematicsCheck(robotConfig.c_str(), kinematicsGridsMM);
+    if (workItemBenchFile.length() > 0)
+        return hostWorkItemBench(robotConfig.c_str(), workItemBenchFile.c_str());
+    if (plannerBenchBlocks > 0)
+        return hostPlannerBench(robotConfig.c_str(), plannerBenchBlocks);
+    if (plannerTaskStallMs > 0)
+        return hostPlannerTaskLatency(robotConfig.c_str(), plannerTaskStallMs, outputProfile);
+    if (thetaRhoBenchFile.length() > 0)
+        return hostThetaRhoBench(robotConfig.c_str(), thetaRhoBenchFile.c_str(),
+                    std::max(1u, uint32_t(loopUs * 1000ull / MotionBlock::TICK_INTERVAL_NS)));
+    if (patternFeedBenchFile.length() > 0)
+        return hostPatternFeedBench(robotConfig.c_str(), patternFeedBenchFile.c_str(),
+                    std::max(1u, uint32_t(loopUs * 1000ull / MotionBlock::TICK_INTERVAL_NS)));
+    if (shaperEdgesFile.length() > 0)
+        return hostInputShaperCheck(robotConfig.c_str(), shaperEdgesFile.c_str(), shaperSpec.c_str());
+    if (profileCheck)
+    {
+        std::vector<std::string> gcodeLines;
+        std::string gcodeLine;
+        while (std::getline(std::cin, gcodeLine))
+            gcodeLines.push_back(gcodeLine);
+        return hostProfileCheck(robotConfig.c_str(), gcodeLines);
+    }
+    robotController.init(robotConfig.c_str());
+    MotionHelper& motionHelper = robotController.simGetMotionHelper();
+    RampGenerator& rampGenerator = motionHelper.simGetRampGenerator();
+    RampGenIO& rampGenIO = rampGenerator.simGetRampGenIO();
+    rampGenIO.simSetRecordEdges(outputEdges);
+    if (timeISR)
+        motionHelper.setIntrumentationMode("TIMEISR");
+
+    // Virtual timing
+    uint32_t ticksPerLoop = std::max(1u, uint32_t(loopUs * 1000ull / MotionBlock::TICK_INTERVAL_NS));
+    uint32_t maxTicks = uint32_t(std::min(maxSecs * 1000000000ull / MotionBlock::TICK_INTERVAL_NS, 0xffffffffull));
+    auto wallStart = std::chrono::steady_clock::now();
+
+    // Feed lines as the work manager would - only when the robot can accept them (and with
+    // the work manager's work queued flag set while the file is playing)
+    std::string line;
+    uint32_t linesIn = 0;
+    robotController.setWorkQueued(true);
+    while (std::getline(std::cin, line) && (rampGenIO.simGetTickCount() < maxTicks))
+    {
+        while (!robotController.canAcceptCommand() && (rampGenIO.simGetTickCount() < maxTicks))
+            simLoop(robotController, rampGenerator, ticksPerLoop);
+        WorkItem workItem(line.c_str());
+        {
+            LOOP_PROFILE_SCOPE("GCode");
+            EvaluatorGCode::interpretGcode(workItem, &robotController, true);
+        }
+        linesIn++;
+        simLoop(robotController, rampGenerator, ticksPerLoop);
+    }
+
+    robotController.setWorkQueued(false);
+
+    // Run until all motion is complete
+    while ((!robotController.canAcceptCommand() || !motionHelper.isIdle()) &&
+                (rampGenIO.simGetTickCount() < maxTicks))
+        simLoop(robotController, rampGenerator, ticksPerLoop);
+
+    // Shaped steps trail the end of motion by up to the shaper duration
+    uint32_t shaperTicks = 0;
+    for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+        if (rampGenIO.getInputShaper(axisIdx))
+            shaperTicks = std::max(shaperTicks, rampGenIO.getInputShaper(axisIdx)->getDurationTicks());
+    uint32_t shaperEndTick = rampGenIO.simGetTickCount() + shaperTicks;
+    while ((shaperTicks != 0) && (rampGenIO.simGetTickCount() < shaperEndTick + ticksPerLoop))
+        simLoop(robotController, rampGenerator, ticksPerLoop);
+    double wallSecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+    // Edges
+    if (outputEdges)
+    {
+        for (const RampGenIO::SimEdge& edge : rampGenIO.simGetEdges())
+            printf("%u,%d,%c,%d\n", edge.tick, edge.axisIdx, edge.isDirn ? 'D' : 'S', edge.level ? 1 : 0);
+    }
+
+    // Summary
+    uint32_t ticks = rampGenIO.simGetTickCount();
+    AxisInt32s stepPos;
+    rampGenerator.getTotalStepPosition(stepPos);
+    fprintf(outputEdges ? stderr : stdout,
+                "lines %u virtualSecs %.3f ticks %u wallSecs %.3f ticksPerWallSec %.0f timedOut %d\n",
+                linesIn, ticks * (MotionBlock::TICK_INTERVAL_NS / 1e9), ticks, wallSecs,
+                wallSecs > 0 ? ticks / wallSecs : 0, ticks >= maxTicks);
+    for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+        fprintf(outputEdges ? stderr : stdout, "axis%d steps %u stepPos %d\n", axisIdx,
+                    rampGenIO.simGetStepCount(axisIdx), stepPos.getVal(axisIdx));
+    fprintf(outputEdges ? stderr : stdout, "debug %s\n", robotController.getDebugStr().c_str());
+    if (outputProfile)
+    {
+        String profileJson;
+        LoopProfiler::getAllJSON(profileJson, false);
+        fprintf(outputEdges ? stderr : stdout, "profile %s\n", profileJson.c_str());
+    }
+    return (ticks >= maxTicks) ? 1 : 0;
+}
+
+#endif // RAMPGEN_HOST_SIM
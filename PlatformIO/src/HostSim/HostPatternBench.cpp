@@ -0,0 +1,179 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Host benchmark of .param pattern evaluation - the reference is the tinyexpr evaluation which
+// EvaluatorPatterns used (a tree per assignment, values set through EvaluatorPattern_Vars and
+// x, y and stop looked up by name for every point)
+
+#ifdef RAMPGEN_HOST_SIM
+
+#include <Arduino.h>
+#include <ArduinoLog.h>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include "RdJson.h"
+#include "HostPatternBench.h"
+#include "WorkManager/Evaluators/EvaluatorPattern_Program.h"
+#include "WorkManager/Evaluators/EvaluatorPattern_Vars.h"
+#include "WorkManager/Evaluators/tinyexpr.h"
+
+// Robot attributes used when the pattern is started (EvaluatorPatterns defaults)
+static const char* ROBOT_CONSTS[] = { "sizeX", "sizeY", "sizeZ", "originX", "originY", "originZ" };
+static const double ROBOT_CONST_VALS[] = { 100, 100, 100, 0, 0, 0 };
+static const int NUM_ROBOT_CONSTS = sizeof(ROBOT_CONSTS) / sizeof(ROBOT_CONSTS[0]);
+
+// Pattern evaluated with tinyexpr
+class TinyExprPattern
+{
+public:
+    ~TinyExprPattern()
+    {
+        for (Assignment& assignment : _assignments)
+            te_free(assignment._pExpr);
+    }
+    void compile(const char* setupExprs, const char* loopExprs)
+    {
+        for (int i = 0; i < NUM_ROBOT_CONSTS; i++)
+            _vars.addConstant(ROBOT_CONSTS[i], ROBOT_CONST_VALS[i]);
+        addExprs(setupExprs, true);
+        addExprs(loopExprs, false);
+    }
+    void eval(bool setup)
+    {
+        for (Assignment& assignment : _assignments)
+            if (assignment._isSetup == setup)
+                _vars.setValByIdx(assignment._varIdx, te_eval(assignment._pExpr));
+    }
+    bool nextPoint(EvaluatorPattern_Program::PatternPoint& pt)
+    {
+        eval(false);
+        bool isValid = false;
+        pt._x = _vars.getVal("x", isValid, true);
+        pt._y = _vars.getVal("y", isValid, true);
+        return _vars.getVal("stop", isValid, true) != 0;
+    }
+
+private:
+    struct Assignment
+    {
+        te_expr* _pExpr;
+        int _varIdx;
+        bool _isSetup;
+    };
+    EvaluatorPattern_Vars _vars;
+    std::vector<Assignment> _assignments;
+    void addExprs(const char* exprs, bool isSetup)
+    {
+        std::vector<String> statements;
+        EvaluatorPattern_Program::splitStatements(exprs, statements);
+        for (const String& statement : statements)
+        {
+            String expr;
+            int varIdx = _vars.addAssignment(statement.c_str(), expr);
+            if (varIdx < 0)
+                continue;
+            te_expr* pExpr = te_compile(expr.c_str(), _vars.getVars(), _vars.getNumVars(), NULL);
+            if (pExpr)
+                _assignments.push_back({ pExpr, varIdx, isSetup });
+        }
+    }
+};
+
+// Run the pattern (restarting it when it stops) until numPoints points have been generated
+static double runTinyExpr(const String& setupExprs, const String& loopExprs, uint32_t numPoints,
+                std::vector<EvaluatorPattern_Program::PatternPoint>* pPoints)
+{
+    TinyExprPattern pattern;
+    pattern.compile(setupExprs.c_str(), loopExprs.c_str());
+    auto startTime = std::chrono::steady_clock::now();
+    bool stopped = true;
+    EvaluatorPattern_Program::PatternPoint pt;
+    for (uint32_t i = 0; i < numPoints; i++)
+    {
+        if (stopped)
+            pattern.eval(true);
+        stopped = pattern.nextPoint(pt);
+        if (pPoints)
+            pPoints->push_back(pt);
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+static double runProgram(const String& setupExprs, const String& loopExprs, uint32_t numPoints,
+                std::vector<EvaluatorPattern_Program::PatternPoint>* pPoints, int pointsPerRun)
+{
+    EvaluatorPattern_Program program;
+    for (int i = 0; i < NUM_ROBOT_CONSTS; i++)
+        program.addConstant(ROBOT_CONSTS[i], ROBOT_CONST_VALS[i]);
+    program.compile(setupExprs.c_str(), loopExprs.c_str());
+    std::vector<EvaluatorPattern_Program::PatternPoint> pointBuf(pointsPerRun);
+    auto startTime = std::chrono::steady_clock::now();
+    bool stopped = true;
+    for (uint32_t i = 0; i < numPoints; )
+    {
+        if (stopped)
+            program.runSetup();
+        int numRun = program.runLoop(pointBuf.data(), std::min(uint32_t(pointsPerRun), numPoints - i), stopped);
+        if (numRun <= 0)
+            break;
+        if (pPoints)
+            pPoints->insert(pPoints->end(), pointBuf.begin(), pointBuf.begin() + numRun);
+        i += numRun;
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+int hostPatternBench(const char* patternFile, uint32_t numPoints)
+{
+    std::ifstream patternStream(patternFile);
+    std::stringstream patternContents;
+    patternContents << patternStream.rdbuf();
+    String patternJson = patternContents.str().c_str();
+    String setupExprs = RdJson::getString("setup", "", patternJson.c_str());
+    String loopExprs = RdJson::getString("loop", "", patternJson.c_str());
+    if (loopExprs.length() == 0)
+    {
+        printf("pattern %s has no loop\n", patternFile);
+        return 1;
+    }
+
+    // Compiled program size
+    EvaluatorPattern_Program program;
+    for (int i = 0; i < NUM_ROBOT_CONSTS; i++)
+        program.addConstant(ROBOT_CONSTS[i], ROBOT_CONST_VALS[i]);
+    program.compile(setupExprs.c_str(), loopExprs.c_str());
+    printf("pattern %s vars %d setupInstrs %d loopInstrs %d\n", patternFile, program.getNumVars(),
+                program.getNumInstrs(false), program.getNumInstrs(true));
+
+    // Check all the points which are timed match
+    std::vector<EvaluatorPattern_Program::PatternPoint> refPoints, progPoints;
+    refPoints.reserve(numPoints);
+    progPoints.reserve(numPoints);
+    runTinyExpr(setupExprs, loopExprs, numPoints, &refPoints);
+    runProgram(setupExprs, loopExprs, numPoints, &progPoints, 10);
+    double maxErr = 0;
+    uint32_t numCompared = std::min(refPoints.size(), progPoints.size());
+    for (uint32_t i = 0; i < numCompared; i++)
+    {
+        maxErr = std::max(maxErr, fabs(refPoints[i]._x - progPoints[i]._x));
+        maxErr = std::max(maxErr, fabs(refPoints[i]._y - progPoints[i]._y));
+    }
+    bool pointsMatch = (refPoints.size() == progPoints.size()) && (maxErr < 1e-9);
+    printf("points %u/%u maxErr %g %s\n", uint32_t(progPoints.size()), uint32_t(refPoints.size()),
+                maxErr, pointsMatch ? "OK" : "MISMATCH");
+
+    // Timing
+    double tinyExprSecs = runTinyExpr(setupExprs, loopExprs, numPoints, NULL);
+    printf("tinyexpr %.1fns/point\n", tinyExprSecs * 1e9 / numPoints);
+    for (int pointsPerRun : { 1, 10, 100 })
+    {
+        double progSecs = runProgram(setupExprs, loopExprs, numPoints, NULL, pointsPerRun);
+        printf("program %d points per run %.1fns/point (x%.1f)\n", pointsPerRun, progSecs * 1e9 / numPoints,
+                    tinyExprSecs / progSecs);
+    }
+    return pointsMatch ? 0 : 1;
+}
+
+#endif // RAMPGEN_HOST_SIM
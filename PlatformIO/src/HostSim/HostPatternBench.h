@@ -0,0 +1,8 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+#pragma once
+
+// Run a .param pattern file through tinyexpr (evaluated as EvaluatorPatterns used to) and through
+// the compiled EvaluatorPattern_Program - checks the points match and times both
+int hostPatternBench(const char* patternFile, uint32_t numPoints);
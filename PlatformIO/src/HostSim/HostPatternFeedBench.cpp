@@ -0,0 +1,186 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Host benchmark of feeding pattern points through the main loop model of HostFeedBench - the
+// pattern is compiled once per run and its points are evaluated a batch at a time
+
+#ifdef RAMPGEN_HOST_SIM
+
+#include <Arduino.h>
+#include <ArduinoLog.h>
+#include <fstream>
+#include <sstream>
+#include "RdJson.h"
+#include "RdJsonDoc.h"
+#include "HostPatternFeedBench.h"
+#include "HostFeedBench.h"
+#include "RobotMotion/RobotController.h"
+#include "WorkManager/WorkItemQueue.h"
+#include "WorkManager/Evaluators/EvaluatorPattern_Program.h"
+
+// Pattern points evaluated a batch at a time as EvaluatorPatterns
+class PatternPointSource : public MotionPointSource
+{
+public:
+    PatternPointSource(EvaluatorPattern_Program& program) : _program(program)
+    {
+        _isRunning = false;
+        _pointBufCount = 0;
+        _pointBufPos = 0;
+        _stopAfterBuf = false;
+        _numPoints = 0;
+    }
+    void start()
+    {
+        _isRunning = true;
+        _pointBufCount = 0;
+        _pointBufPos = 0;
+        _stopAfterBuf = false;
+        _program.runSetup();
+    }
+    virtual bool isBusy()
+    {
+        return _isRunning;
+    }
+    virtual bool nextPoint(AxisFloats& pt)
+    {
+        if (!_isRunning)
+            return false;
+        if (_pointBufPos >= _pointBufCount)
+        {
+            _pointBufCount = _program.runLoop(_pointBuf, POINT_BUF_LEN, _stopAfterBuf);
+            _pointBufPos = 0;
+            if (_pointBufCount <= 0)
+            {
+                _isRunning = false;
+                return false;
+            }
+        }
+        pt.setVal(0, _pointBuf[_pointBufPos]._x);
+        pt.setVal(1, _pointBuf[_pointBufPos]._y);
+        _pointBufPos++;
+        _numPoints++;
+        if ((_pointBufPos >= _pointBufCount) && _stopAfterBuf)
+            _isRunning = false;
+        return true;
+    }
+    uint32_t getNumPoints()
+    {
+        return _numPoints;
+    }
+
+private:
+    EvaluatorPattern_Program& _program;
+    static constexpr int POINT_BUF_LEN = 16;
+    EvaluatorPattern_Program::PatternPoint _pointBuf[POINT_BUF_LEN];
+    int _pointBufCount;
+    int _pointBufPos;
+    bool _stopAfterBuf;
+    bool _isRunning;
+    uint32_t _numPoints;
+};
+
+// Pattern points pushed as move work items (as many as the queue has room for each loop) or
+// pulled by MotionHelper from the point source
+class PatternFeed : public HostFeed
+{
+public:
+    PatternFeed(RobotController& robotController, bool pullPoints) :
+                _robotController(robotController), _pullPoints(pullPoints), _pointSource(_program)
+    {
+    }
+
+    // Compile with the robot size and origin as EvaluatorPatterns::execWorkItem and start the points
+    bool start(const String& setupExprs, const String& loopExprs)
+    {
+        String robotAttrs;
+        _robotController.getRobotAttributes(robotAttrs);
+        RdJsonDoc attributesDoc(robotAttrs.c_str());
+        const char* attrNames[] = { "sizeX", "sizeY", "sizeZ", "originX", "originY", "originZ" };
+        const double attrDefaults[] = { 100, 100, 100, 0, 0, 0 };
+        for (int i = 0; i < 6; i++)
+            _program.addConstant(attrNames[i], attributesDoc.getDouble(attrNames[i], attrDefaults[i]));
+        if (!_program.compile(setupExprs.c_str(), loopExprs.c_str()) || !_program.hasPointVars() ||
+                    !_program.hasStopVar())
+            return false;
+        if (_pullPoints)
+            return _robotController.movePointSource(_pointSource, [&]() {
+                _pointSource.start();
+            });
+        _pointSource.start();
+        return true;
+    }
+
+    virtual void loop()
+    {
+        // Work manager
+        WorkItem workItem;
+        if (_robotController.canAcceptCommand() && _workItemQueue.get(workItem))
+            _robotController.moveTo(workItem.getMoveArgs());
+
+        // Pattern - pushed points are queued while there is room
+        while (!_pullPoints && _pointSource.isBusy() && !_workItemQueue.isFull())
+        {
+            AxisFloats pt;
+            if (!_pointSource.nextPoint(pt))
+                break;
+            RobotCommandArgs cmdArgs;
+            cmdArgs.setAxisValMM(0, pt.getVal(0), true);
+            cmdArgs.setAxisValMM(1, pt.getVal(1), true);
+            cmdArgs.setMoveRapid(true);
+            _workItemQueue.add(WorkItem(cmdArgs));
+        }
+    }
+
+    virtual bool isDone()
+    {
+        return _workItemQueue.isEmpty() && !_pointSource.isBusy();
+    }
+
+    virtual uint32_t getNumPoints()
+    {
+        return _pointSource.getNumPoints();
+    }
+
+private:
+    RobotController& _robotController;
+    bool _pullPoints;
+    EvaluatorPattern_Program _program;
+    PatternPointSource _pointSource;
+    WorkItemQueue _workItemQueue;
+};
+
+int hostPatternFeedBench(const char* robotConfig, const char* patternFile, uint32_t ticksPerLoop)
+{
+    std::ifstream patternStream(patternFile);
+    std::stringstream patternContents;
+    patternContents << patternStream.rdbuf();
+    String patternJson = patternContents.str().c_str();
+    String setupExprs = RdJson::getString("setup", "", patternJson.c_str());
+    String loopExprs = RdJson::getString("loop", "", patternJson.c_str());
+    printf("patternFeed %s\n", patternFile);
+
+    HostFeedResult results[2][2];
+    bool stepsOk = false;
+    bool feedOk = hostFeedBench(robotConfig, [&](RobotController& robotController, bool pullPoints) -> HostFeed* {
+                PatternFeed* pFeed = new PatternFeed(robotController, pullPoints);
+                if (!pFeed->start(setupExprs, loopExprs))
+                {
+                    delete pFeed;
+                    return NULL;
+                }
+                return pFeed;
+            }, ticksPerLoop, results, stepsOk);
+    if (!feedOk)
+    {
+        printf("patternFeed %s needs x, y and stop assigned in the loop\n", patternFile);
+        return 1;
+    }
+    printf("pull loops %u -> %u virtualSecs %.1f -> %.1f drained loops %u -> %u starvedLoops %u -> %u steps %s\n",
+                results[0][0].loops, results[0][1].loops, results[0][0].virtualSecs, results[0][1].virtualSecs,
+                results[1][0].loops, results[1][1].loops, results[1][0].starvedLoops, results[1][1].starvedLoops,
+                stepsOk ? "OK" : "MISMATCH");
+    return stepsOk ? 0 : 1;
+}
+
+#endif // RAMPGEN_HOST_SIM
@@ -0,0 +1,10 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+#pragma once
+
+// Run a .param pattern file through hostFeedBench - the points are pushed as move work items (one
+// dispatched per loop, as EvaluatorPatterns::service used to) or pulled by MotionHelper a batch at a
+// time (as EvaluatorPatterns now is) - non-zero if the pattern doesn't compile or the runs made
+// different steps
+int hostPatternFeedBench(const char* robotConfig, const char* patternFile, uint32_t ticksPerLoop);
@@ -0,0 +1,109 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Host benchmark of the motion planner - blocks are planned for paths of short segments with
+// actuator steps simply proportional to the axis position so that only the planner is timed
+// - around a circle (a curve split into blocks as MotionHelper does) where speeds change
+//   over the whole pipeline so most blocks are prepared again for each block added
+// - a zigzag with right angle corners where junction speeds limit each block so that
+//   few blocks are prepared again and the cost of adding a block dominates
+
+#ifdef RAMPGEN_HOST_SIM
+
+#include <Arduino.h>
+#include <ArduinoLog.h>
+#include <chrono>
+#include "RdJsonDoc.h"
+#include "HostPlannerBench.h"
+#include "RobotMotion/AxesParams.h"
+#include "RobotMotion/AxisPosition.h"
+#include "RobotMotion/MotionControl/MotionPlanner.h"
+
+// Budget for the stepping values the ISR reads for each block (MotionBlockSteps) - the
+// jerk-limited ramps are kept out of it in MotionBlockRamps
+static const int BLOCK_STEPS_BUDGET_BYTES = 48;
+
+// Path - segment length and circle radius
+static const float SEGMENT_LEN_MM = 0.5f;
+static const float CIRCLE_RADIUS_MM = 50.0f;
+
+// Point on a path
+static void pathPoint(bool zigzag, uint32_t ptIdx, float& x, float& y)
+{
+    if (zigzag)
+    {
+        x = ((ptIdx + 1) / 2) * SEGMENT_LEN_MM;
+        y = (((ptIdx / 2) % 2) == 0) ? 0 : SEGMENT_LEN_MM;
+        x = fmodf(x, CIRCLE_RADIUS_MM);
+        return;
+    }
+    float angle = ptIdx * SEGMENT_LEN_MM / CIRCLE_RADIUS_MM;
+    x = CIRCLE_RADIUS_MM * sinf(angle);
+    y = CIRCLE_RADIUS_MM * cosf(angle);
+}
+
+int hostPlannerBench(const char* robotConfig, uint32_t numBlocks)
+{
+    // Axes and pipeline from the robot config (as MotionHelper::configure)
+    AxesParams axesParams;
+    RdJsonDoc robotGeomDoc(RdJson::getString("robotGeom", "NONE", robotConfig).c_str());
+    RdJsonDoc axisDoc;
+    for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+        axesParams.configureAxis(robotGeomDoc, axisIdx, axisDoc);
+    int pipelineLen = int(robotGeomDoc.getLong("pipelineLen", 100));
+    float junctionDeviation = float(robotGeomDoc.getDouble("junctionDeviation", 0.05));
+    bool jerkLimited = robotGeomDoc.getString("motionProfile", "trapezoid").equalsIgnoreCase("scurve");
+    MotionPipeline motionPipeline;
+    motionPipeline.init(pipelineLen);
+    MotionPlanner motionPlanner;
+    motionPlanner.configure(junctionDeviation, pipelineLen, jerkLimited);
+    printf("planner pipelineLen %d junctionDeviation %.3f sizeof MotionBlock %d MotionBlockSteps %d MotionBlockRamps %d\n",
+                pipelineLen, junctionDeviation, int(sizeof(MotionBlock)), int(sizeof(MotionBlockSteps)),
+                int(sizeof(MotionBlockRamps)));
+
+    // Add blocks for each path
+    int rslt = 0;
+    if (int(sizeof(MotionBlockSteps)) > BLOCK_STEPS_BUDGET_BYTES)
+    {
+        printf("FAIL sizeof MotionBlockSteps %d over budget %d\n", int(sizeof(MotionBlockSteps)), BLOCK_STEPS_BUDGET_BYTES);
+        rslt = 1;
+    }
+    for (int zigzag = 0; zigzag < 2; zigzag++)
+    {
+        motionPipeline.clear();
+        motionPlanner.statsClear();
+        AxisPosition curPos;
+        curPos.clear();
+        uint32_t blocksAdded = 0;
+        auto startTime = std::chrono::steady_clock::now();
+        for (uint32_t blockIdx = 0; blockIdx < numBlocks; blockIdx++)
+        {
+            if (!motionPipeline.canAccept())
+                motionPipeline.remove();
+            float x = 0, y = 0;
+            pathPoint(zigzag, blockIdx + 1, x, y);
+            RobotCommandArgs args;
+            args.setAxisValMM(0, x, true);
+            args.setAxisValMM(1, y, true);
+            args.setAxisValMM(2, 0, true);
+            args.setMoreMovesComing(true);
+            AxisFloats actuatorCoords;
+            for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+                actuatorCoords.setVal(axisIdx, roundf(args.getValNoCkMM(axisIdx) * axesParams.getStepsPerUnit(axisIdx)));
+            if (motionPlanner.moveTo(args, actuatorCoords, curPos, axesParams, motionPipeline))
+            {
+                curPos._axisPositionMM = args.getPointMM();
+                blocksAdded++;
+            }
+        }
+        double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        printf("%s blocks %u/%u secs %.3f blocksPerSec %.0f nsPerBlock %.1f stepPos %d,%d%s\n", zigzag ? "zigzag" : "circle",
+                    blocksAdded, numBlocks, secs, blocksAdded / secs, secs * 1e9 / numBlocks,
+                    curPos._stepsFromHome.getVal(0), curPos._stepsFromHome.getVal(1), motionPlanner.getDebugStr().c_str());
+        if (blocksAdded != numBlocks)
+            rslt = 1;
+    }
+    return rslt;
+}
+
+#endif // RAMPGEN_HOST_SIM
@@ -0,0 +1,8 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+#pragma once
+
+// Time adding blocks through MotionPlanner::moveTo with the pipeline kept full (the oldest
+// block is removed, as the ramp generator would, whenever the pipeline can't accept more)
+int hostPlannerBench(const char* robotConfig, uint32_t numBlocks);
@@ -0,0 +1,159 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Host latency test of the planner task - the ramp generator ISR runs on a thread in real time
+// (ticks due since the start are run every millisecond) while the main loop thread stalls
+// periodically - with the planner serviced from the loop the pipeline drains during a stall
+// longer than the motion it holds, with the planner task it keeps being refilled
+
+#ifdef RAMPGEN_HOST_SIM
+
+#include <Arduino.h>
+#include <ArduinoLog.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "HostPlannerTaskLatency.h"
+#include "RobotMotion/RobotController.h"
+#include "LoopProfiler.h"
+
+// Path (short segments around a circle) and timing
+static const float SEGMENT_LEN_MM = 0.05f;
+static const float CIRCLE_RADIUS_MM = 50.0f;
+static const uint32_t RUN_MS = 3000;
+static const uint32_t STALL_INTERVAL_MS = 500;
+static const uint32_t MAX_CATCH_UP_TICKS = 100000;
+
+// Endless circle of points (through the origin so there is no long initial move)
+class CirclePointSource : public MotionPointSource
+{
+public:
+    CirclePointSource() : _ptIdx(0)
+    {
+    }
+    virtual bool isBusy()
+    {
+        return true;
+    }
+    virtual bool nextPoint(AxisFloats& pt)
+    {
+        float angle = _ptIdx * SEGMENT_LEN_MM / CIRCLE_RADIUS_MM;
+        pt.setVal(0, CIRCLE_RADIUS_MM * (1 - cosf(angle)));
+        pt.setVal(1, CIRCLE_RADIUS_MM * sinf(angle));
+        pt.setVal(2, 0);
+        _ptIdx++;
+        return true;
+    }
+    uint32_t getNumPoints()
+    {
+        return _ptIdx;
+    }
+
+private:
+    std::atomic<uint32_t> _ptIdx;
+};
+
+// Run the source for RUN_MS - returns the time the pipeline was empty once motion started
+// (or -1 if there was no motion)
+static int runMode(const char* robotConfig, bool useTask, uint32_t stallMs, bool outputProfile)
+{
+    RobotController robotController;
+    robotController.init(robotConfig);
+    MotionHelper& motionHelper = robotController.simGetMotionHelper();
+    RampGenerator& rampGenerator = motionHelper.simGetRampGenerator();
+    if (useTask)
+        robotController.startPlannerTask();
+    CirclePointSource pointSource;
+    robotController.movePointSource(pointSource, NULL);
+
+    // ISR thread
+    std::atomic<bool> isrStop(false);
+    uint32_t emptyMs = 0, maxEmptyMs = 0, curEmptyMs = 0, motionMs = 0;
+    std::thread isrThread([&]() {
+        auto startTime = std::chrono::steady_clock::now();
+        uint64_t ticksRun = 0;
+        bool motionStarted = false;
+        while (!isrStop)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            uint64_t ticksDue = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - startTime).count() / MotionBlock::TICK_INTERVAL_NS;
+            uint32_t ticksToRun = uint32_t(std::min(ticksDue - ticksRun, uint64_t(MAX_CATCH_UP_TICKS)));
+            rampGenerator.simRunTicks(ticksToRun);
+            ticksRun = ticksDue;
+            if (!motionStarted)
+            {
+                motionStarted = !motionHelper.isIdle();
+                continue;
+            }
+            uint32_t sliceMs = ticksToRun * MotionBlock::TICK_INTERVAL_NS / 1000000;
+            motionMs += sliceMs;
+            if (motionHelper.isIdle())
+            {
+                emptyMs += sliceMs;
+                curEmptyMs += sliceMs;
+                maxEmptyMs = std::max(maxEmptyMs, curEmptyMs);
+            }
+            else
+            {
+                curEmptyMs = 0;
+            }
+        }
+    });
+
+    // Main loop with stalls
+    auto startTime = std::chrono::steady_clock::now();
+    auto lastStallTime = startTime;
+    uint32_t numStalls = 0;
+    while (true)
+    {
+        auto nowTime = std::chrono::steady_clock::now();
+        if (nowTime - startTime > std::chrono::milliseconds(RUN_MS))
+            break;
+        LoopProfiler* pLoopProfiler = LoopProfiler::current();
+        if (pLoopProfiler)
+            pLoopProfiler->loopStart();
+        {
+            LOOP_PROFILE_SCOPE("Robot");
+            robotController.service();
+        }
+        if (nowTime - lastStallTime > std::chrono::milliseconds(STALL_INTERVAL_MS))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(stallMs));
+            lastStallTime = std::chrono::steady_clock::now();
+            numStalls++;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    isrStop = true;
+    isrThread.join();
+    robotController.stopPlannerTask();
+    String pipelineStats, profileJson;
+    robotController.getPipelineStats(pipelineStats, false);
+    if (outputProfile)
+        LoopProfiler::getAllJSON(profileJson, true);
+    robotController.stop();
+
+    printf("%s stalls %u of %ums motionMs %u emptyMs %u maxEmptyMs %u points %u\n",
+                useTask ? "plannerTask" : "loopPlanner", numStalls, stallMs, motionMs, emptyMs, maxEmptyMs,
+                pointSource.getNumPoints());
+    printf("%s\n", pipelineStats.c_str());
+    if (outputProfile)
+        printf("profile %s\n", profileJson.c_str());
+    return (motionMs > 0) ? int(emptyMs) : -1;
+}
+
+int hostPlannerTaskLatency(const char* robotConfig, uint32_t stallMs, bool outputProfile)
+{
+    int loopEmptyMs = runMode(robotConfig, false, stallMs, outputProfile);
+    int taskEmptyMs = runMode(robotConfig, true, stallMs, outputProfile);
+    if (loopEmptyMs <= 0)
+    {
+        printf("FAIL loopPlanner pipeline never ran empty - stall too short for the motion the pipeline holds\n");
+        return 1;
+    }
+    printf("%s plannerTask emptyMs %d (loopPlanner %d)\n", taskEmptyMs == 0 ? "OK" : "FAIL", taskEmptyMs, loopEmptyMs);
+    return (taskEmptyMs == 0) ? 0 : 1;
+}
+
+#endif // RAMPGEN_HOST_SIM
@@ -0,0 +1,11 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+#pragma once
+
+// Run a point source through the robot in real time with the ISR on its own thread while the main
+// loop stalls for stallMs every so often (as network servicing can) - once with the planner serviced
+// from the loop and once with the planner task - reports how long the pipeline ran empty (and the
+// loop profiles if outputProfile) - fails if the pipeline doesn't run empty with the loop planner as
+// the stall is then too short (for the motion the pipeline holds) to show the planner task working
+int hostPlannerTaskLatency(const char* robotConfig, uint32_t stallMs, bool outputProfile);
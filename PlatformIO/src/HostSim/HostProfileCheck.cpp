@@ -0,0 +1,173 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Host check of the jerk-limited (S-curve) motion profile - the step rate of the axis with most
+// steps is recorded when each block starts and at each rate update (every ms) and, within each
+// block, the change in rate per ms (acceleration) and the change in that per ms (jerk) are found
+// relative to the configured max acceleration per ms (jerk-limited blocks are planned with a
+// fraction of it) - the change in acceleration where blocks join is found too where the blocks'
+// accelerations are comparable (the rate units of blocks on different axes or angles differ)
+
+#ifdef RAMPGEN_HOST_SIM
+
+#include <Arduino.h>
+#include <ArduinoLog.h>
+#include <math.h>
+#include "HostProfileCheck.h"
+#include "RobotMotion/RobotController.h"
+#include "WorkManager/Evaluators/EvaluatorGCode.h"
+
+// Main loop period and limit on virtual time
+static const uint32_t LOOP_TICKS = MotionBlock::TICKS_PER_RATE_UPDATE;
+static const uint32_t MAX_TICKS = 3600 * 100000;
+
+// A change in acceleration of at least this fraction of the configured acceleration in one ms is
+// counted as a step in acceleration - jerk-limited profiles must have none within blocks or where
+// blocks join (trapezoid profiles step by the whole acceleration)
+static const double ACCEL_STEP_MIN = 0.5;
+
+// Jerk-limited ramps peak at the configured acceleration (allowing for rounding)
+static const double JERK_LIMITED_MAX_ACCEL = 1.01;
+
+// Blocks' accelerations within this fraction are comparable at a junction
+static const double JUNCTION_ACC_MATCH = 0.02;
+
+struct ProfileResult
+{
+    uint32_t ticks;
+    AxisInt32s stepPos;
+    uint32_t rateSamples;
+    double maxAccel;
+    double maxJerk;
+    uint32_t accelSteps;
+    double maxBlockStartJump;
+    double maxJunctionJerk;
+    double accelVariation;
+};
+
+// Robot config with the motion profile set in robotGeom
+static String configWithProfile(const char* robotConfig, const char* motionProfile)
+{
+    std::string config = robotConfig;
+    size_t geomPos = config.find("\"robotGeom\"");
+    size_t bracePos = (geomPos == std::string::npos) ? std::string::npos : config.find('{', geomPos);
+    if (bracePos != std::string::npos)
+        config.insert(bracePos + 1, std::string("\"motionProfile\":\"") + motionProfile + "\",");
+    return config.c_str();
+}
+
+static void runProfile(const char* robotConfig, double accFactor, const std::vector<std::string>& gcodeLines,
+            ProfileResult& result)
+{
+    RobotController robotController;
+    robotController.init(robotConfig);
+    MotionHelper& motionHelper = robotController.simGetMotionHelper();
+    RampGenerator& rampGenerator = motionHelper.simGetRampGenerator();
+    RampGenIO& rampGenIO = rampGenerator.simGetRampGenIO();
+    rampGenerator.simSetRecordRates(true);
+
+    // Run the G-code
+    for (const std::string& line : gcodeLines)
+    {
+        while (!robotController.canAcceptCommand() && (rampGenIO.simGetTickCount() < MAX_TICKS))
+        {
+            robotController.service();
+            rampGenerator.simRunTicks(LOOP_TICKS);
+        }
+        WorkItem workItem(line.c_str());
+        EvaluatorGCode::interpretGcode(workItem, &robotController, true);
+        robotController.service();
+        rampGenerator.simRunTicks(LOOP_TICKS);
+    }
+    while ((!robotController.canAcceptCommand() || !motionHelper.isIdle()) && (rampGenIO.simGetTickCount() < MAX_TICKS))
+    {
+        robotController.service();
+        rampGenerator.simRunTicks(LOOP_TICKS);
+    }
+    // The last step ends on the tick after motion completes
+    rampGenerator.simRunTicks(LOOP_TICKS);
+    result.ticks = rampGenIO.simGetTickCount();
+    rampGenerator.getTotalStepPosition(result.stepPos);
+
+    // Acceleration and jerk within blocks and the change in rate when each block starts
+    const std::vector<RampGenerator::SimRateSample>& rates = rampGenerator.simGetRates();
+    result.rateSamples = rates.size();
+    result.maxAccel = 0;
+    result.maxJerk = 0;
+    result.accelSteps = 0;
+    result.maxBlockStartJump = 0;
+    result.maxJunctionJerk = 0;
+    result.accelVariation = 0;
+    double prevAccel = 0, prevBlockAcc = 0;
+    bool prevAccelValid = false;
+    for (uint32_t i = 1; i < rates.size(); i++)
+    {
+        if (rates[i].accStepsPerTTicksPerMS == 0)
+            continue;
+        double maxAccPerMS = rates[i].accStepsPerTTicksPerMS / accFactor;
+        double accel = (double(rates[i].stepRatePerTTicks) - rates[i-1].stepRatePerTTicks) / maxAccPerMS;
+        if (rates[i].blockIdx != rates[i-1].blockIdx)
+        {
+            // The first sample of a block is its start rate - the junction compares the acceleration
+            // either side of it
+            result.maxBlockStartJump = std::max(result.maxBlockStartJump, fabs(accel));
+            prevAccelValid = prevAccelValid && (fabs(maxAccPerMS - prevBlockAcc) <= prevBlockAcc * JUNCTION_ACC_MATCH);
+            continue;
+        }
+        result.maxAccel = std::max(result.maxAccel, fabs(accel));
+        if ((i >= 2) && (rates[i-1].blockIdx == rates[i-2].blockIdx))
+        {
+            double jerk = fabs(accel - prevAccel);
+            result.maxJerk = std::max(result.maxJerk, jerk);
+            result.accelVariation += jerk;
+            if (jerk >= ACCEL_STEP_MIN)
+                result.accelSteps++;
+        }
+        else if (prevAccelValid)
+        {
+            double jerk = fabs(accel - prevAccel);
+            result.maxJunctionJerk = std::max(result.maxJunctionJerk, jerk);
+            result.accelVariation += jerk;
+        }
+        prevAccel = accel;
+        prevAccelValid = true;
+        prevBlockAcc = maxAccPerMS;
+    }
+    robotController.stop();
+}
+
+int hostProfileCheck(const char* robotConfig, const std::vector<std::string>& gcodeLines)
+{
+    static const char* PROFILES[] = { "trapezoid", "scurve" };
+    static const double ACC_FACTORS[] = { 1, MotionBlock::JERK_LIMITED_ACC_FACTOR };
+    ProfileResult results[2];
+    for (int i = 0; i < 2; i++)
+    {
+        runProfile(configWithProfile(robotConfig, PROFILES[i]).c_str(), ACC_FACTORS[i], gcodeLines, results[i]);
+        ProfileResult& result = results[i];
+        printf("%s virtualSecs %.3f rateSamples %u maxAccel %.3f maxJerk %.3f accelSteps %u maxBlockStartJump %.3f "
+                    "maxJunctionJerk %.3f accelVariation %.1f stepPos",
+                    PROFILES[i], result.ticks * (MotionBlock::TICK_INTERVAL_NS / 1e9), result.rateSamples,
+                    result.maxAccel, result.maxJerk, result.accelSteps, result.maxBlockStartJump,
+                    result.maxJunctionJerk, result.accelVariation);
+        for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+            printf(" %d", result.stepPos.getVal(axisIdx));
+        printf("\n");
+    }
+
+    // Same end positions, acceleration within the limit and no steps in acceleration within blocks
+    // or where blocks join (ramps are carried through junctions)
+    ProfileResult& trapezoid = results[0];
+    ProfileResult& scurve = results[1];
+    bool samePos = true;
+    for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+        samePos = samePos && (trapezoid.stepPos.getVal(axisIdx) == scurve.stepPos.getVal(axisIdx));
+    bool accelOk = scurve.maxAccel <= JERK_LIMITED_MAX_ACCEL;
+    bool jerkOk = scurve.maxJerk < ACCEL_STEP_MIN;
+    bool junctionOk = scurve.maxJunctionJerk < ACCEL_STEP_MIN;
+    printf("samePos %s accelLimit %s jerk %s junction %s\n", samePos ? "OK" : "FAIL", accelOk ? "OK" : "FAIL",
+                jerkOk ? "OK" : "FAIL", junctionOk ? "OK" : "FAIL");
+    return (samePos && accelOk && jerkOk && junctionOk) ? 0 : 1;
+}
+
+#endif // RAMPGEN_HOST_SIM
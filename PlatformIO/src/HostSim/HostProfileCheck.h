@@ -0,0 +1,13 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+// Run G-code through the robot with the trapezoid and the jerk-limited (S-curve) motion profiles -
+// checks both end on the same step positions and that the jerk-limited step rate is continuous
+// (acceleration no more than the configured acceleration and no steps in acceleration within
+// blocks or where blocks join) and reports the rate changes of each
+int hostProfileCheck(const char* robotConfig, const std::vector<std::string>& gcodeLines);
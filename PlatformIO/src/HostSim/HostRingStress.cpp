@@ -0,0 +1,142 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Host stress test of the single-producer single-consumer ring used for the motion pipeline - each
+// item carries a sequence number and values derived from it so that an item read before it was
+// completely written (or overwritten before it was read) is detected, ring lengths include ones
+// which aren't a power of two - the put and get position peeks are checked separately
+
+#ifdef RAMPGEN_HOST_SIM
+
+#include <Arduino.h>
+#include <chrono>
+#include <thread>
+#include "HostRingStress.h"
+#include "RobotMotion/MotionControl/MotionRingBuffer.h"
+
+// Item of similar size to the stepping part of a motion block
+struct RingStressItem
+{
+    uint32_t _seq;
+    uint32_t _vals[10];
+};
+
+static uint32_t ringStressVal(uint32_t seq, int valIdx)
+{
+    return (seq * 2654435761u) ^ (valIdx * 40503u);
+}
+
+// Run items through a ring - returns the number of errors
+static uint32_t ringStressRun(unsigned int ringLen, uint32_t numItems, double& secs)
+{
+    MotionRingBuffer<RingStressItem> ring(ringLen);
+    uint32_t errors = 0;
+    uint32_t maxCount = 0;
+    auto startTime = std::chrono::steady_clock::now();
+
+    // Producer
+    std::thread producer([&]()
+        {
+            RingStressItem item;
+            for (uint32_t seq = 0; seq < numItems; )
+            {
+                item._seq = seq;
+                for (int valIdx = 0; valIdx < 10; valIdx++)
+                    item._vals[valIdx] = ringStressVal(seq, valIdx);
+                if (ring.put(item))
+                    seq++;
+                else
+                    std::this_thread::yield();
+            }
+        });
+
+    // Consumer
+    uint32_t expectedSeq = 0;
+    RingStressItem item;
+    while (expectedSeq < numItems)
+    {
+        unsigned int count = ring.count();
+        if (count > maxCount)
+            maxCount = count;
+        if (!ring.get(item))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        bool itemOk = (item._seq == expectedSeq);
+        for (int valIdx = 0; valIdx < 10; valIdx++)
+            itemOk = itemOk && (item._vals[valIdx] == ringStressVal(expectedSeq, valIdx));
+        if (!itemOk)
+        {
+            if (errors < 10)
+                printf("ring %u item %u received seq %u\n", ringLen, expectedSeq, item._seq);
+            errors++;
+        }
+        expectedSeq++;
+    }
+    producer.join();
+    secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    if ((maxCount > ringLen) || ring.canGet())
+    {
+        printf("ring %u maxCount %u %s\n", ringLen, maxCount, ring.canGet() ? "not empty" : "");
+        errors++;
+    }
+    return errors;
+}
+
+// Peek positions from put and get against the count (single thread)
+static uint32_t ringPosnCheck(unsigned int ringLen)
+{
+    uint32_t errors = 0;
+    MotionRingBufferPosn posn(ringLen);
+    uint32_t putCount = 0, getCount = 0;
+    for (uint32_t i = 0; i < ringLen * 10; i++)
+    {
+        // Put two and get one until full then get until empty
+        bool putPhase = ((i / (ringLen * 2)) % 2) == 0;
+        for (int j = 0; j < (putPhase ? 2 : 1); j++)
+        {
+            if (posn.canPut() && putPhase)
+            {
+                posn.hasPut();
+                putCount++;
+            }
+        }
+        if (posn.canGet())
+        {
+            posn.hasGot();
+            getCount++;
+        }
+        unsigned int count = putCount - getCount;
+        errors += (posn.count() != count) || (posn.canPut() != (count < ringLen)) || (posn.canGet() != (count > 0));
+        for (unsigned int n = 0; n <= count; n++)
+        {
+            int fromPut = posn.getNthFromPut(n);
+            int fromGet = posn.getNthFromGet(n);
+            if (n == count)
+                errors += (fromPut != -1) || (fromGet != -1);
+            else
+                errors += (fromPut != int((putCount - 1 - n) % posn.storageLen())) ||
+                            (fromGet != int((getCount + n) % posn.storageLen()));
+        }
+    }
+    return errors;
+}
+
+int hostRingStress(uint32_t numItems)
+{
+    uint32_t totalErrors = 0;
+    for (unsigned int ringLen : { 1, 2, 7, 64, 100 })
+    {
+        uint32_t posnErrors = ringPosnCheck(ringLen);
+        double secs = 0;
+        uint32_t errors = ringStressRun(ringLen, numItems, secs);
+        printf("ring %u storage %u items %u secs %.3f itemsPerSec %.0f posnErrors %u errors %u\n", ringLen,
+                    MotionRingBufferPosn(ringLen).storageLen(), numItems, secs, numItems / secs, posnErrors, errors);
+        totalErrors += posnErrors + errors;
+    }
+    printf("ring stress %s\n", totalErrors == 0 ? "OK" : "FAILED");
+    return totalErrors == 0 ? 0 : 1;
+}
+
+#endif // RAMPGEN_HOST_SIM
@@ -0,0 +1,8 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+#pragma once
+
+// Pass numItems through MotionRingBuffer from a producer thread to a consumer thread (as the main
+// loop and ISR use the motion pipeline) - checks order and contents and reports throughput
+int hostRingStress(uint32_t numItems);
@@ -0,0 +1,194 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Host benchmark of theta-rho playback through the main loop model of HostFeedBench - the file is
+// read a line at a time (when the work item queue is empty) and each line is dispatched when the
+// last one's points have been made - the last block is held until the block which follows it is
+// added so a line's points are only all executed once the next line has started
+
+#ifdef RAMPGEN_HOST_SIM
+
+#include <Arduino.h>
+#include <ArduinoLog.h>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "RdJsonDoc.h"
+#include "HostThetaRhoBench.h"
+#include "HostFeedBench.h"
+#include "RobotMotion/RobotController.h"
+#include "RobotMotion/MotionControl/ThetaRhoMotionSource.h"
+#include "WorkManager/WorkItemQueue.h"
+
+// As EvaluatorThetaRhoLine's default step angle and the points it used to make per service
+static const double THETA_RHO_BENCH_STEP_ANGLE = M_PI / 64;
+static const int THETA_RHO_BENCH_PUSH_POINTS_PER_LOOP = 20;
+
+// Counts the points made
+class CountingThetaRhoSource : public ThetaRhoMotionSource
+{
+public:
+    CountingThetaRhoSource() : _numPoints(0)
+    {
+    }
+    virtual bool nextPoint(AxisFloats& pt)
+    {
+        if (!ThetaRhoMotionSource::nextPoint(pt))
+            return false;
+        _numPoints++;
+        return true;
+    }
+    uint32_t getNumPoints()
+    {
+        return _numPoints;
+    }
+
+private:
+    uint32_t _numPoints;
+};
+
+// Theta-rho lines of the file (comments skipped) as EvaluatorFiles parses them
+static bool thetaRhoLines(const char* thrFile, std::vector<std::pair<double, double>>& lines)
+{
+    std::ifstream thrStream(thrFile);
+    if (!thrStream)
+        return false;
+    std::string line;
+    while (std::getline(thrStream, line))
+    {
+        const char* pLine = line.c_str();
+        while (isspace(*pLine))
+            pLine++;
+        const char* pSpace = strchr(pLine, ' ');
+        if ((*pLine == '#') || (pSpace == NULL) || (pSpace == pLine))
+            continue;
+        lines.push_back(std::make_pair(strtod(pLine, NULL), strtod(pSpace + 1, NULL)));
+    }
+    return true;
+}
+
+// Theta-rho file as work items - interpolated points pushed as move work items (up to
+// THETA_RHO_BENCH_PUSH_POINTS_PER_LOOP per loop) or pulled by MotionHelper from the motion source
+class ThetaRhoFeed : public HostFeed
+{
+public:
+    ThetaRhoFeed(RobotController& robotController, bool pullPoints,
+                const std::vector<std::pair<double, double>>& lines) :
+                _robotController(robotController), _pullPoints(pullPoints), _lines(lines)
+    {
+        _lineIdx = 0;
+        _prevTheta = 0;
+        _prevRho = 0;
+        _thetaStartOffset = 0;
+
+        // Interpolation as EvaluatorThetaRhoLine::setConfig
+        String robotAttrs;
+        robotController.getRobotAttributes(robotAttrs);
+        RdJsonDoc attributesDoc(robotAttrs.c_str());
+        double sizeX = attributesDoc.getDouble("sizeX", 0);
+        double sizeY = attributesDoc.getDouble("sizeY", 0);
+        _motionSource.configure(THETA_RHO_BENCH_STEP_ANGLE, true, std::min(sizeX, sizeY) / 2,
+                    sizeX / 2 - attributesDoc.getDouble("originX", 0), sizeY / 2 - attributesDoc.getDouble("originY", 0));
+    }
+
+    virtual void loop()
+    {
+        // Work manager - the next line is dispatched when the last one's points have been made (and
+        // stays queued if the robot rejects it)
+        WorkItem workItem;
+        if (_robotController.canAcceptCommand() && _workItemQueue.peek(workItem))
+        {
+            if (workItem.getType() == WorkItem::WORK_ITEM_MOVE)
+            {
+                _workItemQueue.get(workItem);
+                _robotController.moveTo(workItem.getMoveArgs());
+            }
+            else if (!_motionSource.isBusy())
+            {
+                double startTheta = _prevTheta;
+                double startRho = _prevRho;
+                double endTheta = workItem.getTheta() - _thetaStartOffset;
+                double endRho = workItem.getRho();
+                bool lineOk = true;
+                if (workItem.getThetaRhoLineType() == WorkItem::THETA_RHO_FIRST)
+                    _thetaStartOffset = workItem.getTheta() - _prevTheta;
+                else if (_pullPoints)
+                    lineOk = _robotController.movePointSource(_motionSource, [&]() {
+                        _motionSource.start(startTheta, startRho, endTheta, endRho);
+                    });
+                else
+                    _motionSource.start(startTheta, startRho, endTheta, endRho);
+                if (lineOk)
+                {
+                    _workItemQueue.get(workItem);
+                    _prevTheta = workItem.getTheta();
+                    _prevRho = endRho;
+                }
+            }
+        }
+
+        // Evaluators - pushed points are queued while there is room and the file is read a line at a
+        // time when the queue is empty
+        for (int i = 0; !_pullPoints && (i < THETA_RHO_BENCH_PUSH_POINTS_PER_LOOP) && _motionSource.isBusy() &&
+                    !_workItemQueue.isFull(); i++)
+        {
+            AxisFloats pt;
+            _motionSource.nextPoint(pt);
+            RobotCommandArgs cmdArgs;
+            cmdArgs.setAxisValMM(0, pt.getVal(0), true);
+            cmdArgs.setAxisValMM(1, pt.getVal(1), true);
+            cmdArgs.setMoveRapid(true);
+            _workItemQueue.add(WorkItem(cmdArgs));
+        }
+        if (_workItemQueue.isEmpty() && (_lineIdx < _lines.size()))
+        {
+            _workItemQueue.add(WorkItem(_lineIdx == 0 ? WorkItem::THETA_RHO_FIRST : WorkItem::THETA_RHO_NEXT,
+                        _lines[_lineIdx].first, _lines[_lineIdx].second));
+            _lineIdx++;
+        }
+    }
+
+    virtual bool isDone()
+    {
+        return (_lineIdx >= _lines.size()) && _workItemQueue.isEmpty() && !_motionSource.isBusy();
+    }
+
+    virtual uint32_t getNumPoints()
+    {
+        return _motionSource.getNumPoints();
+    }
+
+private:
+    RobotController& _robotController;
+    bool _pullPoints;
+    const std::vector<std::pair<double, double>>& _lines;
+    CountingThetaRhoSource _motionSource;
+    WorkItemQueue _workItemQueue;
+    uint32_t _lineIdx;
+    double _prevTheta;
+    double _prevRho;
+    double _thetaStartOffset;
+};
+
+int hostThetaRhoBench(const char* robotConfig, const char* thrFile, uint32_t ticksPerLoop)
+{
+    std::vector<std::pair<double, double>> lines;
+    if (!thetaRhoLines(thrFile, lines))
+    {
+        printf("thetaRho can't open %s\n", thrFile);
+        return 1;
+    }
+    printf("thetaRho %s lines %zu\n", thrFile, lines.size());
+
+    HostFeedResult results[2][2];
+    bool stepsOk = false;
+    hostFeedBench(robotConfig, [&](RobotController& robotController, bool pullPoints) -> HostFeed* {
+                return new ThetaRhoFeed(robotController, pullPoints, lines);
+            }, ticksPerLoop, results, stepsOk);
+    printf("pull drained loops %u -> %u starvedLoops %u -> %u virtualSecs %.1f -> %.1f steps %s\n",
+                results[1][0].loops, results[1][1].loops, results[1][0].starvedLoops, results[1][1].starvedLoops,
+                results[1][0].virtualSecs, results[1][1].virtualSecs, stepsOk ? "OK" : "MISMATCH");
+    return stepsOk ? 0 : 1;
+}
+
+#endif // RAMPGEN_HOST_SIM
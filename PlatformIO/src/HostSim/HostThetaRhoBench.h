@@ -0,0 +1,9 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+#pragma once
+
+// Play a theta-rho file through hostFeedBench - the interpolated points are pushed as move work
+// items (up to 20 per loop and one dispatched per loop, as EvaluatorThetaRhoLine used to) or pulled
+// by MotionHelper from ThetaRhoMotionSource - non-zero if the runs made different steps
+int hostThetaRhoBench(const char* robotConfig, const char* thrFile, uint32_t ticksPerLoop);
@@ -0,0 +1,126 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Host benchmark of file upload writing - on tmpfs the open and write calls are cheap so the
+// operation counts matter as much as the time (on SPIFFS an append open walks the file to its end
+// and a write which isn't whole sectors is a read-modify-write on SD)
+
+#ifdef RAMPGEN_HOST_SIM
+
+#include <Arduino.h>
+#include <chrono>
+#include <vector>
+#include <unistd.h>
+#include "HostUploadBench.h"
+#include "FileUploadWriter.h"
+
+// Block size ESPAsyncWebServer hands over (the data in one TCP segment)
+static const int UPLOAD_BENCH_BLOCK_LEN = 1436;
+static const int UPLOAD_BENCH_RUNS = 3;
+
+struct UploadBenchResult
+{
+    double secs;
+    uint32_t fileOpens;
+    uint32_t fileWrites;
+    uint32_t unalignedWrites;
+};
+
+// Open, append and close for every block
+static bool uploadPerBlock(const char* pFilename, const std::vector<uint8_t>& data, UploadBenchResult& result)
+{
+    result = { 0, 0, 0, 0 };
+    bool writeOk = true;
+    auto startTime = std::chrono::steady_clock::now();
+    for (size_t index = 0; index < data.size(); index += UPLOAD_BENCH_BLOCK_LEN)
+    {
+        size_t len = std::min(size_t(UPLOAD_BENCH_BLOCK_LEN), data.size() - index);
+        FILE* pFile = fopen(pFilename, index > 0 ? "ab" : "wb");
+        if (!pFile)
+            return false;
+        result.fileOpens++;
+        result.fileWrites++;
+        if ((index % 512 != 0) || (len % 512 != 0))
+            result.unalignedWrites++;
+        writeOk &= fwrite(data.data() + index, 1, len, pFile) == len;
+        fclose(pFile);
+    }
+    result.secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    return writeOk;
+}
+
+// Upload session
+static bool uploadWriter(const char* pFilename, const std::vector<uint8_t>& data, UploadBenchResult& result)
+{
+    result = { 0, 0, 0, 0 };
+    FileUploadWriter writer;
+    auto startTime = std::chrono::steady_clock::now();
+    if (!writer.open(pFilename))
+        return false;
+    bool writeOk = true;
+    for (size_t index = 0; index < data.size(); index += UPLOAD_BENCH_BLOCK_LEN)
+    {
+        size_t len = std::min(size_t(UPLOAD_BENCH_BLOCK_LEN), data.size() - index);
+        writeOk &= writer.write(data.data() + index, len);
+    }
+    writeOk &= writer.close();
+    result.secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    result.fileOpens = 1;
+    result.fileWrites = writer.getFileWrites();
+    // Only the final write can be a partial block
+    result.unalignedWrites = (data.size() % FileUploadWriter::UPLOAD_BLOCK_SIZE) ? 1 : 0;
+    return writeOk;
+}
+
+static bool checkFile(const char* pFilename, const std::vector<uint8_t>& data)
+{
+    FILE* pFile = fopen(pFilename, "rb");
+    if (!pFile)
+        return false;
+    std::vector<uint8_t> readBack(data.size() + 1);
+    size_t numRead = fread(readBack.data(), 1, readBack.size(), pFile);
+    fclose(pFile);
+    return (numRead == data.size()) && (memcmp(readBack.data(), data.data(), data.size()) == 0);
+}
+
+int hostUploadBench(const char* dirPath, uint32_t fileKB)
+{
+    // Theta-rho file contents
+    std::vector<uint8_t> data;
+    data.reserve(fileKB * 1024 + 32);
+    char lineBuf[40];
+    for (uint32_t lineIdx = 0; data.size() < fileKB * 1024; lineIdx++)
+    {
+        int lineLen = snprintf(lineBuf, sizeof(lineBuf), "%.5f %.5f\n", lineIdx * 0.01, (lineIdx % 10000) / 10000.0);
+        data.insert(data.end(), lineBuf, lineBuf + lineLen);
+    }
+    data.resize(fileKB * 1024);
+    String filename = String(dirPath) + "/__uploadbench__";
+    printf("upload %uKB in %d byte blocks to %s\n", fileKB, UPLOAD_BENCH_BLOCK_LEN, dirPath);
+
+    // Best of a few runs of each
+    bool allOk = true;
+    double bestSecs[2] = { 0, 0 };
+    const char* methodNames[2] = { "perBlock", "writer" };
+    for (int method = 0; method < 2; method++)
+    {
+        UploadBenchResult result;
+        for (int run = 0; run < UPLOAD_BENCH_RUNS; run++)
+        {
+            bool writeOk = (method == 0) ? uploadPerBlock(filename.c_str(), data, result) :
+                        uploadWriter(filename.c_str(), data, result);
+            bool fileOk = writeOk && checkFile(filename.c_str(), data);
+            allOk &= fileOk;
+            if ((run == 0) || (result.secs < bestSecs[method]))
+                bestSecs[method] = result.secs;
+            unlink(filename.c_str());
+        }
+        printf("%-8s %.1fMB/s opens %u writes %u unalignedWrites %u %s\n", methodNames[method],
+                    data.size() / bestSecs[method] / 1e6, result.fileOpens, result.fileWrites,
+                    result.unalignedWrites, allOk ? "OK" : "MISMATCH");
+    }
+    printf("writer x%.1f\n", bestSecs[0] / bestSecs[1]);
+    return allOk ? 0 : 1;
+}
+
+#endif // RAMPGEN_HOST_SIM
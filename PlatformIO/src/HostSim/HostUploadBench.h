@@ -0,0 +1,9 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+#pragma once
+
+// Upload a generated .thr file of fileKB into dirPath (a tmpfs directory stands in for SPIFFS/SD) in
+// network sized blocks - once with an open/append/close per block (as FileManager used to) and once
+// through FileUploadWriter - checks the files and reports MB/s and the file operations used
+int hostUploadBench(const char* dirPath, uint32_t fileKB);
@@ -0,0 +1,182 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Host benchmark of move work items - only queueing and dispatching the work items is timed, the
+// robot service and ISR ticks run while the robot can't accept a command are not
+
+#ifdef RAMPGEN_HOST_SIM
+
+#include <Arduino.h>
+#include <ArduinoLog.h>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "RdJsonDoc.h"
+#include "HostWorkItemBench.h"
+#include "RobotMotion/RobotController.h"
+#include "RobotMotion/MotionControl/ThetaRhoMotionSource.h"
+#include "WorkManager/WorkItemQueue.h"
+#include "WorkManager/Evaluators/EvaluatorGCode.h"
+
+// Theta-rho step angle as EvaluatorThetaRhoLine's default
+static const double WORK_ITEM_BENCH_STEP_ANGLE = M_PI / 64;
+
+// Main loop period and limit on virtual time
+static const uint32_t LOOP_TICKS = MotionBlock::TICKS_PER_RATE_UPDATE;
+static const uint32_t MAX_TICKS = 3600 * 100000;
+
+// Text moves are rounded to 0.001mm so the step totals can differ slightly (and the end positions
+// of a SCARA robot can differ more as theta-rho files usually end at the centre where the arm
+// angles are very sensitive to the position)
+static const double STEP_TOTAL_MAX_DIFF = 0.001;
+
+struct WorkItemBenchResult
+{
+    double secs;
+    uint32_t items;
+    uint32_t stepTotals[2];
+    AxisInt32s stepPos;
+};
+
+// Interpolated points of the file as EvaluatorFiles and EvaluatorThetaRhoLine would produce them
+static bool thetaRhoPoints(RobotController& robotController, const char* thrFile, std::vector<AxisFloats>& pts)
+{
+    std::ifstream thrStream(thrFile);
+    if (!thrStream)
+        return false;
+    String robotAttrs;
+    robotController.getRobotAttributes(robotAttrs);
+    RdJsonDoc attributesDoc(robotAttrs.c_str());
+    double sizeX = attributesDoc.getDouble("sizeX", 0);
+    double sizeY = attributesDoc.getDouble("sizeY", 0);
+    ThetaRhoMotionSource motionSource;
+    motionSource.configure(WORK_ITEM_BENCH_STEP_ANGLE, true, std::min(sizeX, sizeY) / 2,
+                sizeX / 2 - attributesDoc.getDouble("originX", 0), sizeY / 2 - attributesDoc.getDouble("originY", 0));
+    std::string line;
+    bool firstLine = true;
+    double prevTheta = 0, prevRho = 0;
+    while (std::getline(thrStream, line))
+    {
+        const char* pLine = line.c_str();
+        while (isspace(*pLine))
+            pLine++;
+        const char* pSpace = strchr(pLine, ' ');
+        if ((*pLine == '#') || (pSpace == NULL) || (pSpace == pLine))
+            continue;
+        double theta = strtod(pLine, NULL);
+        double rho = strtod(pSpace + 1, NULL);
+        if (!firstLine)
+        {
+            motionSource.start(prevTheta, prevRho, theta, rho);
+            AxisFloats pt;
+            while (motionSource.nextPoint(pt))
+                pts.push_back(pt);
+        }
+        firstLine = false;
+        prevTheta = theta;
+        prevRho = rho;
+    }
+    return true;
+}
+
+static void runWorkItems(const char* robotConfig, std::vector<AxisFloats>& pts, bool preParsed,
+            WorkItemBenchResult& result)
+{
+    RobotController robotController;
+    robotController.init(robotConfig);
+    MotionHelper& motionHelper = robotController.simGetMotionHelper();
+    RampGenerator& rampGenerator = motionHelper.simGetRampGenerator();
+    RampGenIO& rampGenIO = rampGenerator.simGetRampGenIO();
+    rampGenIO.simSetRecordEdges(false);
+    WorkItemQueue workItemQueue;
+    std::chrono::steady_clock::duration workItemTime(0);
+    result.items = 0;
+    char lineBuf[100];
+    for (AxisFloats& pt : pts)
+    {
+        while (!robotController.canAcceptCommand() && (rampGenIO.simGetTickCount() < MAX_TICKS))
+        {
+            robotController.service();
+            rampGenerator.simRunTicks(LOOP_TICKS);
+        }
+
+        // Queue and dispatch
+        auto startTime = std::chrono::steady_clock::now();
+        if (preParsed)
+        {
+            RobotCommandArgs cmdArgs;
+            cmdArgs.setAxisValMM(0, pt.getVal(0), true);
+            cmdArgs.setAxisValMM(1, pt.getVal(1), true);
+            cmdArgs.setMoveRapid(true);
+            workItemQueue.add(WorkItem(cmdArgs));
+        }
+        else
+        {
+            sprintf(lineBuf, "G0 X%0.3f Y%0.3f", pt.getVal(0), pt.getVal(1));
+            workItemQueue.add(lineBuf);
+        }
+        WorkItem workItem;
+        if (workItemQueue.get(workItem))
+        {
+            if (workItem.getType() == WorkItem::WORK_ITEM_MOVE)
+                robotController.moveTo(workItem.getMoveArgs());
+            else
+                EvaluatorGCode::interpretGcode(workItem, &robotController, true);
+            result.items++;
+        }
+        workItemTime += std::chrono::steady_clock::now() - startTime;
+        robotController.service();
+        rampGenerator.simRunTicks(LOOP_TICKS);
+    }
+
+    // Run until all motion is complete
+    while ((!robotController.canAcceptCommand() || !motionHelper.isIdle()) && (rampGenIO.simGetTickCount() < MAX_TICKS))
+    {
+        robotController.service();
+        rampGenerator.simRunTicks(LOOP_TICKS);
+    }
+    result.secs = std::chrono::duration<double>(workItemTime).count();
+    result.stepTotals[0] = rampGenIO.simGetStepCount(0);
+    result.stepTotals[1] = rampGenIO.simGetStepCount(1);
+    rampGenerator.getTotalStepPosition(result.stepPos);
+}
+
+int hostWorkItemBench(const char* robotConfig, const char* thrFile)
+{
+    std::vector<AxisFloats> pts;
+    {
+        RobotController robotController;
+        robotController.init(robotConfig);
+        if (!thetaRhoPoints(robotController, thrFile, pts))
+        {
+            printf("workItems can't open %s\n", thrFile);
+            return 1;
+        }
+    }
+    printf("workItems %s points %zu\n", thrFile, pts.size());
+
+    // Each method
+    WorkItemBenchResult results[2];
+    const char* methodNames[2] = { "text", "moves" };
+    for (int method = 0; method < 2; method++)
+    {
+        WorkItemBenchResult& result = results[method];
+        runWorkItems(robotConfig, pts, method == 1, result);
+        printf("%-5s items %u %.0fk items/s steps %u %u stepPos %d %d\n", methodNames[method], result.items,
+                    result.items / result.secs / 1000, result.stepTotals[0], result.stepTotals[1],
+                    result.stepPos.getVal(0), result.stepPos.getVal(1));
+    }
+
+    // Steps agree (allowing for the rounding of text moves)
+    bool stepsOk = results[1].items == pts.size();
+    for (int axisIdx = 0; axisIdx < 2; axisIdx++)
+    {
+        double stepDiff = fabs(double(results[0].stepTotals[axisIdx]) - results[1].stepTotals[axisIdx]);
+        stepsOk &= (stepDiff <= results[0].stepTotals[axisIdx] * STEP_TOTAL_MAX_DIFF);
+    }
+    printf("moves x%.1f steps %s\n", results[0].secs / results[1].secs, stepsOk ? "OK" : "MISMATCH");
+    return stepsOk ? 0 : 1;
+}
+
+#endif // RAMPGEN_HOST_SIM
@@ -0,0 +1,10 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+#pragma once
+
+// Queue the interpolated points of a theta-rho file as moves through WorkItemQueue to the robot - once
+// as text (formatted as G-code and parsed by EvaluatorGCode as EvaluatorThetaRhoLine used to) and once
+// as pre-parsed move work items handed to RobotController::moveTo (as WorkManager::service does) -
+// reports work items/s (including the planning moveTo does) and checks the steps agree
+int hostWorkItemBench(const char* robotConfig, const char* thrFile);
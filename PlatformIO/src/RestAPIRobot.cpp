@@ -11,6 +11,12 @@ void RestAPIRobot::apiQueryStatus(String &reqStr, String &respStr)
     _workManager.queryStatus(respStr);
 }
 
+void RestAPIRobot::apiPipelineStats(String &reqStr, String &respStr)
+{
+    String clearStr = RestAPIEndpoints::getNthArgStr(reqStr.c_str(), 1);
+    _workManager.queryPipelineStats(respStr, clearStr.equalsIgnoreCase("clear"));
+}
+
 void RestAPIRobot::apiGetRobotTypes(String &reqStr, String &respStr)
 {
     Log.notice("%sGetRobotTypes\n", MODULE_PREFIX);
@@ -112,6 +118,11 @@ void RestAPIRobot::setup(RestAPIEndpoints &endpoints)
     endpoints.addEndpoint("status", RestAPIEndpointDef::ENDPOINT_CALLBACK, RestAPIEndpointDef::ENDPOINT_GET,
                             std::bind(&RestAPIRobot::apiQueryStatus, this, std::placeholders::_1, std::placeholders::_2),
                             "Query status");
+
+    // Get motion pipeline telemetry
+    endpoints.addEndpoint("pipelinestats", RestAPIEndpointDef::ENDPOINT_CALLBACK, RestAPIEndpointDef::ENDPOINT_GET,
+                            std::bind(&RestAPIRobot::apiPipelineStats, this, std::placeholders::_1, std::placeholders::_2),
+                            "Motion pipeline underruns and histograms, pipelinestats/clear to reset");
                             
     // Set LED Strip
     endpoints.addEndpoint("setled", RestAPIEndpointDef::ENDPOINT_CALLBACK, RestAPIEndpointDef::ENDPOINT_POST,
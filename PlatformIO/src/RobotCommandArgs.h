@@ -27,6 +27,8 @@ private:
     bool _moreMovesComing : 1;
     bool _isHoming: 1;
     bool _hasHomed: 1;
+    bool _arcMove : 1;
+    bool _arcRadiusValid : 1;
     // Command control
     int _queuedCommands;
     int _numberedCommandIndex;
@@ -38,6 +40,10 @@ private:
     float _feedrateValue;
     RobotMoveTypeArg _moveType;
     AxisMinMaxBools _endstops;
+    // Arc (G2/G3) centre offset from start (I, J) or radius (R)
+    float _arcCentreOffsetI;
+    float _arcCentreOffsetJ;
+    float _arcRadius;
 
 public:
     RobotCommandArgs()
@@ -58,6 +64,8 @@ public:
         _moreMovesComing = false;
         _isHoming = false;
         _hasHomed = false;
+        _arcMove = false;
+        _arcRadiusValid = false;
         // Command control
         _queuedCommands = 0;
         _numberedCommandIndex = RobotConsts::NUMBERED_COMMAND_NONE;
@@ -69,6 +77,9 @@ public:
         _feedrateValue = 0.0;
         _moveType = RobotMoveTypeArg_None;
         _endstops.none();
+        _arcCentreOffsetI = 0;
+        _arcCentreOffsetJ = 0;
+        _arcRadius = 0;
     }
 
     RobotCommandArgs& operator=(const RobotCommandArgs& copyFrom)
@@ -90,6 +101,8 @@ public:
             (_allowOutOfBounds == other._allowOutOfBounds) &&
             (_pause == other._pause) &&
             (_moreMovesComing == other._moreMovesComing) &&
+            (_arcMove == other._arcMove) &&
+            (_arcRadiusValid == other._arcRadiusValid) &&
             // Command control
             (_queuedCommands == other._queuedCommands) &&
             (_numberedCommandIndex == other._numberedCommandIndex) &&
@@ -97,7 +110,10 @@ public:
             (_extrudeValue == other._extrudeValue) &&
             (_feedrateValue == other._feedrateValue) &&
             (_moveType == other._moveType) &&
-            (_endstops == other._endstops);
+            (_endstops == other._endstops) &&
+            (_arcCentreOffsetI == other._arcCentreOffsetI) &&
+            (_arcCentreOffsetJ == other._arcCentreOffsetJ) &&
+            (_arcRadius == other._arcRadius);
         if (!isEqual)
             return false;
         // Coords, etc
@@ -133,6 +149,8 @@ private:
         _allowOutOfBounds = copyFrom._allowOutOfBounds;
         _pause = copyFrom._pause;
         _moreMovesComing = copyFrom._moreMovesComing;
+        _arcMove = copyFrom._arcMove;
+        _arcRadiusValid = copyFrom._arcRadiusValid;
         // Command control
         _queuedCommands = copyFrom._queuedCommands;
         _numberedCommandIndex = copyFrom._numberedCommandIndex;
@@ -144,6 +162,9 @@ private:
         _feedrateValue = copyFrom._feedrateValue;
         _moveType = copyFrom._moveType;
         _endstops = copyFrom._endstops;
+        _arcCentreOffsetI = copyFrom._arcCentreOffsetI;
+        _arcCentreOffsetJ = copyFrom._arcCentreOffsetJ;
+        _arcRadius = copyFrom._arcRadius;
     }
 
 public:
@@ -236,6 +257,45 @@ public:
     {
         _moveRapid = moveRapid;
     }
+    // Arc in the XY plane - clockwise for G2
+    void setArcMove(bool clockwise)
+    {
+        _arcMove = true;
+        _moveClockwise = clockwise;
+    }
+    bool isArcMove()
+    {
+        return _arcMove;
+    }
+    bool isArcClockwise()
+    {
+        return _moveClockwise;
+    }
+    void setArcCentreOffset(int axisIdx, float offset)
+    {
+        if (axisIdx == 0)
+            _arcCentreOffsetI = offset;
+        else if (axisIdx == 1)
+            _arcCentreOffsetJ = offset;
+    }
+    float getArcCentreOffset(int axisIdx)
+    {
+        return (axisIdx == 0) ? _arcCentreOffsetI : ((axisIdx == 1) ? _arcCentreOffsetJ : 0);
+    }
+    // Radius form - negative for arcs of more than 180 degrees
+    void setArcRadius(float radius)
+    {
+        _arcRadius = radius;
+        _arcRadiusValid = true;
+    }
+    bool isArcRadiusValid()
+    {
+        return _arcRadiusValid;
+    }
+    float getArcRadius()
+    {
+        return _arcRadius;
+    }
     void setMoreMovesComing(bool moreMovesComing)
     {
         _moreMovesComing = moreMovesComing;
@@ -332,6 +392,10 @@ public:
     {
         _queuedCommands = numQueued;
     }
+    int getNumQueued()
+    {
+        return _queuedCommands;
+    }
     void setPause(bool pause)
     {
         _pause = pause;
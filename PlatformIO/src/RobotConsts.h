@@ -18,6 +18,10 @@ static constexpr int NUMBERED_COMMAND_NONE = 0;
 struct RawMotionAxis_t
 {
     RobotConsts::MOTOR_TYPE _motorType;
+    // Step and direction pins (direction is -1 if multiplexed)
+    int _pinStep;
+    int _pinDirection;
+    bool _dirnReversed;
     int _pinEndStopMin;
     bool _pinEndStopMinactLvl;
     int _pinEndStopMax;
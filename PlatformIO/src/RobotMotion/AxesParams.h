@@ -147,19 +147,20 @@ class AxesParams
         return wasValid;
     }
 
-    bool configureAxis(const char *robotConfigJSON, int axisIdx, String &axisJSON)
+    bool configureAxis(RdJsonDoc& robotGeomDoc, int axisIdx, RdJsonDoc& axisDoc)
     {
         if (axisIdx < 0 || axisIdx >= RobotConsts::MAX_AXES)
             return false;
 
         // Get params
         String axisIdStr = "axis" + String(axisIdx);
-        axisJSON = RdJson::getString(axisIdStr.c_str(), "{}", robotConfigJSON);
+        String axisJSON = robotGeomDoc.getString(axisIdStr.c_str(), "{}");
         if (axisJSON.length() == 0 || axisJSON.equals("{}"))
             return false;
+        axisDoc.parse(axisJSON.c_str());
 
         // Set the axis parameters
-        _axisParams[axisIdx].setFromJSON(axisJSON.c_str());
+        _axisParams[axisIdx].setFromJSON(axisDoc);
         _axisParams[axisIdx].debugLog(axisIdx);
 
         // Find the master axis (dominant one, or first primary - or just first)
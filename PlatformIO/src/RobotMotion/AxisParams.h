@@ -3,7 +3,7 @@
 
 #pragma once
 
-#include "RdJson.h"
+#include "RdJsonDoc.h"
 
 class AxisParams
 {
@@ -86,21 +86,21 @@ class AxisParams
         return wasValid;
     }
 
-    void setFromJSON(const char *axisJSON)
+    void setFromJSON(RdJsonDoc& axisDoc)
     {
         // Stepper motor
-        _maxSpeedMMps = float(RdJson::getDouble("maxSpeed", AxisParams::maxSpeed_default, axisJSON));
-        _maxAccelMMps2 = float(RdJson::getDouble("maxAcc", AxisParams::acceleration_default, axisJSON));
-        _stepsPerRot = float(RdJson::getDouble("stepsPerRot", AxisParams::stepsPerRot_default, axisJSON));
-        _unitsPerRot = float(RdJson::getDouble("unitsPerRot", AxisParams::unitsPerRot_default, axisJSON));
-        _maxRPM = float(RdJson::getDouble("maxRPM", AxisParams::maxRPM_default, axisJSON));
-        _minVal = float(RdJson::getDouble("minVal", 0, _minValValid, axisJSON));
-        _maxVal = float(RdJson::getDouble("maxVal", 0, _maxValValid, axisJSON));
-        _isDominantAxis = RdJson::getLong("isDominantAxis", 0, axisJSON) != 0;
-        _isPrimaryAxis = RdJson::getLong("isPrimaryAxis", 1, axisJSON) != 0;
-        _isServoAxis = RdJson::getLong("isServoAxis", 0, axisJSON) != 0;
-        _homeOffsetVal = float(RdJson::getDouble("homeOffsetVal", 0, axisJSON));
-        _homeOffSteps = RdJson::getLong("homeOffSteps", 0, axisJSON);
+        _maxSpeedMMps = float(axisDoc.getDouble("maxSpeed", AxisParams::maxSpeed_default));
+        _maxAccelMMps2 = float(axisDoc.getDouble("maxAcc", AxisParams::acceleration_default));
+        _stepsPerRot = float(axisDoc.getDouble("stepsPerRot", AxisParams::stepsPerRot_default));
+        _unitsPerRot = float(axisDoc.getDouble("unitsPerRot", AxisParams::unitsPerRot_default));
+        _maxRPM = float(axisDoc.getDouble("maxRPM", AxisParams::maxRPM_default));
+        _minVal = float(axisDoc.getDouble("minVal", 0, _minValValid));
+        _maxVal = float(axisDoc.getDouble("maxVal", 0, _maxValValid));
+        _isDominantAxis = axisDoc.getLong("isDominantAxis", 0) != 0;
+        _isPrimaryAxis = axisDoc.getLong("isPrimaryAxis", 1) != 0;
+        _isServoAxis = axisDoc.getLong("isServoAxis", 0) != 0;
+        _homeOffsetVal = float(axisDoc.getDouble("homeOffsetVal", 0));
+        _homeOffSteps = axisDoc.getLong("homeOffSteps", 0);
     }
 
     void debugLog(int axisIdx)
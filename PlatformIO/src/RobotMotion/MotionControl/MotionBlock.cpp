@@ -7,8 +7,40 @@
 
 static const char* MODULE_PREFIX = "MotionBlock: ";
 
+void MotionBlockSteps::clear()
+{
+    _isExecuting = false;
+    _canExecute = false;
+    _axisIdxWithMaxSteps = 0;
+    _endStopsToCheck.none();
+    _numberedCommandIndex = 0;
+    for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+        _stepsTotalMaybeNeg[axisIdx] = 0;
+    _stepsBeforeDecel = 0;
+    _initialStepRatePerTTicks = 0;
+    _accStepsPerTTicksPerMS = 0;
+    _accelRateUpdates = 0;
+    _decelRateUpdatesAdj = 0;
+    _jerkLimited = false;
+}
+
+void MotionBlockRamps::clear()
+{
+    for (int i = 0; i < 3; i++)
+    {
+        _accelRateDiffs[i] = 0;
+        _decelRateDiffs[i] = 0;
+    }
+    _accelRampUpdates = 0;
+    _decelRampUpdates = 0;
+    _accelEndRatePerTTicks = 0;
+    _decelEndRatePerTTicks = 0;
+}
+
 MotionBlock::MotionBlock()
 {
+    _pSteps = NULL;
+    _pRamps = NULL;
     clear();
 }
 
@@ -21,35 +53,31 @@ void MotionBlock::clear()
     _entrySpeedMMps = 0;
     _exitSpeedMMps = 0;
     _debugStepDistMM = 0;
-    _isExecuting = false;
-    _canExecute = false;
     _blockIsFollowed = false;
-    _axisIdxWithMaxSteps = 0;
+    _entryAccDirn = 0;
+    _exitAccDirn = 0;
     _unitVecAxisWithMaxDist = 0;
-    _accStepsPerTTicksPerMS = 0;
     _finalStepRatePerTTicks = 0;
-    _initialStepRatePerTTicks = 0;
     _maxStepRatePerTTicks = 0;
-    _stepsBeforeDecel = 0;
-    _numberedCommandIndex = 0;
-    _endStopsToCheck.none();
-    for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
-        _stepsTotalMaybeNeg[axisIdx] = 0;
+    if (_pSteps)
+        _pSteps->clear();
+    if (_pRamps)
+        _pRamps->clear();
 }
 
 void MotionBlock::setNumberedCommandIndex(int cmdIdx)
 {
-    _numberedCommandIndex = cmdIdx;
+    _pSteps->_numberedCommandIndex = cmdIdx;
 }
-int IRAM_ATTR MotionBlock::getNumberedCommandIndex()
+int MotionBlock::getNumberedCommandIndex()
 {
-    return _numberedCommandIndex;
+    return _pSteps->_numberedCommandIndex;
 }
 int32_t MotionBlock::getStepsToTarget(int axisIdx)
 {
     if (axisIdx >= 0 && axisIdx < RobotConsts::MAX_AXES)
     {
-        return _stepsTotalMaybeNeg[axisIdx];
+        return _pSteps->_stepsTotalMaybeNeg[axisIdx];
     }
     return 0;
 }
@@ -58,7 +86,7 @@ int32_t MotionBlock::getAbsStepsToTarget(int axisIdx)
 {
     if (axisIdx >= 0 && axisIdx < RobotConsts::MAX_AXES)
     {
-        return abs(_stepsTotalMaybeNeg[axisIdx]);
+        return abs(_pSteps->_stepsTotalMaybeNeg[axisIdx]);
     }
     return 0;
 }
@@ -67,9 +95,9 @@ void MotionBlock::setStepsToTarget(int axisIdx, int32_t steps)
 {
     if (axisIdx >= 0 && axisIdx < RobotConsts::MAX_AXES)
     {
-        _stepsTotalMaybeNeg[axisIdx] = steps;
-        if (abs(steps) > abs(_stepsTotalMaybeNeg[_axisIdxWithMaxSteps]))
-            _axisIdxWithMaxSteps = axisIdx;
+        _pSteps->_stepsTotalMaybeNeg[axisIdx] = steps;
+        if (abs(steps) > abs(_pSteps->_stepsTotalMaybeNeg[_pSteps->_axisIdxWithMaxSteps]))
+            _pSteps->_axisIdxWithMaxSteps = axisIdx;
     }
 }
 
@@ -94,20 +122,22 @@ void MotionBlock::forceInBounds(float &val, float lowBound, float highBound)
 void MotionBlock::setEndStopsToCheck(AxisMinMaxBools &endStopCheck)
 {
     Log.verbose("%sSet test endstops %x\n", MODULE_PREFIX, endStopCheck.uintVal());
-    _endStopsToCheck = endStopCheck;
+    _pSteps->_endStopsToCheck = endStopCheck;
 }
 
 // The block's entry and exit speed are now known
 // The block can accelerate and decelerate as required as long as these criteria are met
 // We now compute the stepping parameters to make motion happen
-bool MotionBlock::prepareForStepping(AxesParams &axesParams, bool isStepwise)
+bool MotionBlock::prepareForStepping(AxesParams &axesParams, bool isStepwise, bool jerkLimited)
 {
+    MotionBlockSteps& steps = *_pSteps;
+
     // If block is currently being executed don't change it
-    if (_isExecuting)
+    if (steps._isExecuting)
         return false;
 
     // Find the max number of steps for any axis
-    uint32_t absMaxStepsForAnyAxis = abs(_stepsTotalMaybeNeg[_axisIdxWithMaxSteps]);
+    uint32_t absMaxStepsForAnyAxis = abs(steps._stepsTotalMaybeNeg[steps._axisIdxWithMaxSteps]);
 
     // Check if stepwise movement
     float initialStepRatePerSec = 0;
@@ -120,8 +150,8 @@ bool MotionBlock::prepareForStepping(AxesParams &axesParams, bool isStepwise)
     {
         // Feedrate is in steps per second in this case
         float stepRatePerSec = _feedrate;
-        if (stepRatePerSec > axesParams.getMaxStepRatePerSec(_axisIdxWithMaxSteps))
-            stepRatePerSec = axesParams.getMaxStepRatePerSec(_axisIdxWithMaxSteps);
+        if (stepRatePerSec > axesParams.getMaxStepRatePerSec(steps._axisIdxWithMaxSteps))
+            stepRatePerSec = axesParams.getMaxStepRatePerSec(steps._axisIdxWithMaxSteps);
         initialStepRatePerSec = stepRatePerSec;
         finalStepRatePerSec = stepRatePerSec;
         maxAccStepsPerSec2 = stepRatePerSec;
@@ -131,14 +161,16 @@ bool MotionBlock::prepareForStepping(AxesParams &axesParams, bool isStepwise)
     else
     {
         // Get the initial step rate, final step rate and max acceleration for the axis with max steps
-        stepDistMM = fabsf(_moveDistPrimaryAxesMM / _stepsTotalMaybeNeg[_axisIdxWithMaxSteps]);
+        stepDistMM = fabsf(_moveDistPrimaryAxesMM / steps._stepsTotalMaybeNeg[steps._axisIdxWithMaxSteps]);
         initialStepRatePerSec = fabsf(_entrySpeedMMps / stepDistMM);
-        if (initialStepRatePerSec > axesParams.getMaxStepRatePerSec(_axisIdxWithMaxSteps))
-            initialStepRatePerSec = axesParams.getMaxStepRatePerSec(_axisIdxWithMaxSteps);
+        if (initialStepRatePerSec > axesParams.getMaxStepRatePerSec(steps._axisIdxWithMaxSteps))
+            initialStepRatePerSec = axesParams.getMaxStepRatePerSec(steps._axisIdxWithMaxSteps);
         finalStepRatePerSec = fabsf(_exitSpeedMMps / stepDistMM);
-        if (finalStepRatePerSec > axesParams.getMaxStepRatePerSec(_axisIdxWithMaxSteps))
-            finalStepRatePerSec = axesParams.getMaxStepRatePerSec(_axisIdxWithMaxSteps);
-        maxAccStepsPerSec2 = fabsf(axesParams.getMaxAccel(_axisIdxWithMaxSteps) / stepDistMM);
+        if (finalStepRatePerSec > axesParams.getMaxStepRatePerSec(steps._axisIdxWithMaxSteps))
+            finalStepRatePerSec = axesParams.getMaxStepRatePerSec(steps._axisIdxWithMaxSteps);
+        maxAccStepsPerSec2 = fabsf(axesParams.getMaxAccel(steps._axisIdxWithMaxSteps) / stepDistMM);
+        if (jerkLimited)
+            maxAccStepsPerSec2 *= JERK_LIMITED_ACC_FACTOR;
 
         // Calculate the distance decelerating and ensure within bounds
         // Using the facts for the block ... (assuming max accleration followed by max deceleration):
@@ -163,8 +195,8 @@ bool MotionBlock::prepareForStepping(AxesParams &axesParams, bool isStepwise)
 
         // Find max possible rate for axis with max steps
         axisMaxStepRatePerSec = fabsf(_feedrate / stepDistMM);
-        if (axisMaxStepRatePerSec > axesParams.getMaxStepRatePerSec(_axisIdxWithMaxSteps))
-            axisMaxStepRatePerSec = axesParams.getMaxStepRatePerSec(_axisIdxWithMaxSteps);
+        if (axisMaxStepRatePerSec > axesParams.getMaxStepRatePerSec(steps._axisIdxWithMaxSteps))
+            axisMaxStepRatePerSec = axesParams.getMaxStepRatePerSec(steps._axisIdxWithMaxSteps);
 
         // See if max speed will be reached
         uint32_t stepsToMaxSpeed =
@@ -192,16 +224,165 @@ bool MotionBlock::prepareForStepping(AxesParams &axesParams, bool isStepwise)
     }
 
     // Fill in the step values for this axis
-    _initialStepRatePerTTicks = uint32_t((initialStepRatePerSec * TTICKS_VALUE) / TICKS_PER_SEC);
+    steps._initialStepRatePerTTicks = uint32_t((initialStepRatePerSec * TTICKS_VALUE) / TICKS_PER_SEC);
     _maxStepRatePerTTicks = uint32_t((axisMaxStepRatePerSec * TTICKS_VALUE) / TICKS_PER_SEC);
     _finalStepRatePerTTicks = uint32_t((finalStepRatePerSec * TTICKS_VALUE) / TICKS_PER_SEC);
-    _accStepsPerTTicksPerMS = uint32_t((maxAccStepsPerSec2 * TTICKS_VALUE) / TICKS_PER_SEC / 1000);
-    _stepsBeforeDecel = absMaxStepsForAnyAxis - stepsDecelerating;
+    steps._accStepsPerTTicksPerMS = uint32_t((maxAccStepsPerSec2 * TTICKS_VALUE) / TICKS_PER_SEC / 1000);
+    steps._stepsBeforeDecel = absMaxStepsForAnyAxis - stepsDecelerating;
     _debugStepDistMM = stepDistMM;
 
+    // Precompute the number of rate updates so the ISR doesn't need any comparisons
+    prepareRateUpdates(jerkLimited);
     return true;
 }
 
+// The step rate is increased each ms while below the max step rate (staying below TTICKS_VALUE) and,
+// once decelerating, decreased each ms while more than one increment above the larger of the final
+// and minimum step rates
+void MotionBlock::prepareRateUpdates(bool jerkLimited)
+{
+    MotionBlockSteps& steps = *_pSteps;
+    if (steps._initialStepRatePerTTicks < MIN_STEP_RATE_PER_TTICKS)
+        steps._initialStepRatePerTTicks = MIN_STEP_RATE_PER_TTICKS;
+    steps._accelRateUpdates = 0;
+    steps._decelRateUpdatesAdj = 0;
+    steps._jerkLimited = false;
+    int64_t acc = steps._accStepsPerTTicksPerMS;
+    if (acc == 0)
+        return;
+
+    // Acceleration updates
+    int64_t initialRate = steps._initialStepRatePerTTicks;
+    if (_maxStepRatePerTTicks > initialRate)
+    {
+        int64_t accelUpdates = (_maxStepRatePerTTicks - initialRate + acc - 1) / acc;
+        int64_t maxAccelUpdates = (int64_t(TTICKS_VALUE) - 1 - initialRate) / acc;
+        steps._accelRateUpdates = uint32_t(std::min(accelUpdates, maxAccelUpdates));
+    }
+
+    // Deceleration from a rate R takes ceil((R - floor) / acc) updates and R is the initial rate
+    // plus a whole number of accel updates so that part can be added when deceleration starts
+    int64_t floorRate = std::max(MIN_STEP_RATE_PER_TTICKS, _finalStepRatePerTTicks) + acc;
+    int64_t diff = initialRate - floorRate;
+    steps._decelRateUpdatesAdj = int32_t(diff > 0 ? (diff + acc - 1) / acc : -((-diff) / acc));
+    if (!jerkLimited)
+        return;
+
+    // Jerk-limited ramps start and end on the same rates as the trapezoid ramps (deceleration
+    // assuming acceleration completed - the ISR doesn't start deceleration until it has) but don't
+    // overshoot the peak rate - a ramp continuing from the previous block (decelerating) or into the
+    // next (accelerating or decelerating) runs to the end of the block ending on the final rate - a
+    // block continuing deceleration from the previous block decelerates from the start (to a lower
+    // final rate than planned if its speeds increased after the previous block started executing)
+    steps._jerkLimited = true;
+    uint32_t absMaxSteps = abs(steps._stepsTotalMaybeNeg[steps._axisIdxWithMaxSteps]);
+    bool decelFromStart = (_entryAccDirn < 0) && (_finalStepRatePerTTicks < initialRate);
+    bool accelToEnd = _exitAccDirn > 0;
+    bool decelToEnd = _exitAccDirn < 0;
+    if (decelFromStart)
+    {
+        steps._accelRateUpdates = 0;
+        steps._stepsBeforeDecel = 0;
+    }
+    else if (accelToEnd)
+    {
+        steps._stepsBeforeDecel = absMaxSteps;
+    }
+    int64_t decelUpdates = int64_t(steps._accelRateUpdates) + steps._decelRateUpdatesAdj;
+    int64_t peakRate = std::min(initialRate + int64_t(steps._accelRateUpdates) * acc,
+                std::max(initialRate, int64_t(_maxStepRatePerTTicks)));
+    int64_t decelEndRate = initialRate - steps._decelRateUpdatesAdj * acc;
+    double accelUpdates = steps._accelRateUpdates;
+    double decelRampUpdates = decelUpdates > 0 ? decelUpdates : 0;
+    if (accelToEnd)
+    {
+        peakRate = std::max(initialRate, int64_t(_finalStepRatePerTTicks));
+        accelUpdates = rampUpdatesForSteps(absMaxSteps, initialRate, peakRate);
+    }
+    if (decelToEnd && (decelUpdates > 0))
+    {
+        decelEndRate = std::max(int64_t(MIN_STEP_RATE_PER_TTICKS), int64_t(_finalStepRatePerTTicks));
+        decelRampUpdates = rampUpdatesForSteps(absMaxSteps - steps._stepsBeforeDecel, peakRate, decelEndRate);
+    }
+    MotionBlockRamps& ramps = *_pRamps;
+    ramps._accelEndRatePerTTicks = uint32_t(peakRate);
+    ramps._decelEndRatePerTTicks = uint32_t(decelEndRate);
+    int64_t maxAcc = int64_t(acc / JERK_LIMITED_ACC_FACTOR);
+    ramps._accelRampUpdates = prepareRampDiffs(initialRate, peakRate, accelUpdates,
+                _entryAccDirn > 0 ? acc : 0, accelToEnd ? acc : 0, maxAcc, ramps._accelRateDiffs);
+    ramps._decelRampUpdates = prepareRampDiffs(peakRate, decelEndRate, decelRampUpdates,
+                decelFromStart ? -acc : 0, decelToEnd ? -acc : 0, maxAcc, ramps._decelRateDiffs);
+}
+
+// Rate updates at the mean of two rates to make a number of steps
+double MotionBlock::rampUpdatesForSteps(uint32_t numSteps, int64_t startRate, int64_t endRate)
+{
+    double stepsPerUpdate = double(startRate + endRate) / 2 * TICKS_PER_RATE_UPDATE / TTICKS_VALUE;
+    return stepsPerUpdate > 0 ? numSteps / stepsPerUpdate : 0;
+}
+
+// Cubic ramp rate(k) = startRate + startAcc * k + a2 * k^2 + a3 * k^3 from startRate to endRate with
+// acceleration (rate change per update) startAcc at the start and endAcc at the end - with no acceleration
+// at the ends the ramp takes numUpdates and peaks at 1.5 times the average acceleration - acceleration at
+// the ends changes the steps covered in n updates by n^2 * (startAcc - endAcc) / 12 so n is chosen to cover
+// the steps of numUpdates at the mean rate - if whole updates are required n is rounded up (so acceleration
+// stays within that planned) except for a ramp carrying acceleration to the end of the block which is
+// rounded to the nearest so the ramp ends as close as possible to the block - returns false if the rate
+// would reverse or the acceleration exceed maxAcc
+bool MotionBlock::cubicRamp(double startRate, double endRate, double numUpdates, double startAcc, double endAcc,
+            double maxAcc, bool wholeUpdates, double& n, double& a2, double& a3)
+{
+    double change = endRate - startRate;
+    double meanRate = (startRate + endRate) / 2;
+    double k = (startAcc - endAcc) / 12;
+    n = numUpdates;
+    a2 = a3 = 0;
+    if (k != 0)
+    {
+        double discriminant = meanRate * meanRate + 4 * k * meanRate * numUpdates;
+        if (discriminant < 0)
+            return false;
+        n = 2 * meanRate * numUpdates / (meanRate + sqrt(discriminant));
+    }
+    if (wholeUpdates)
+        n = (endAcc != 0) ? std::max(1.0, round(n)) : ceil(n);
+    if (n <= 0)
+        return false;
+    a2 = (3 * change - (2 * startAcc + endAcc) * n) / (n * n);
+    a3 = (-2 * change + (startAcc + endAcc) * n) / (n * n * n);
+
+    // Acceleration is largest (and smallest) at an end or where it stops changing
+    double peakK = (a3 != 0) ? -a2 / (3 * a3) : 0;
+    double accs[] = { startAcc, endAcc, startAcc + 2 * a2 * peakK + 3 * a3 * peakK * peakK };
+    int numAccs = ((peakK > 0) && (peakK < n)) ? 3 : 2;
+    double dirn = (change < 0) ? -1 : 1;
+    for (int i = 0; i < numAccs; i++)
+        if ((accs[i] * dirn < 0) || (fabs(accs[i]) > maxAcc))
+            return false;
+    return true;
+}
+
+// Forward differences (in fixed point) of a cubic ramp (see cubicRamp) - if the ramp can't have the
+// accelerations at its ends they are zero - returns the number of updates in the ramp
+uint32_t MotionBlock::prepareRampDiffs(int64_t startRate, int64_t endRate, double numUpdates,
+            int64_t startAcc, int64_t endAcc, int64_t maxAcc, int64_t rateDiffs[3])
+{
+    rateDiffs[0] = rateDiffs[1] = rateDiffs[2] = 0;
+    if ((numUpdates <= 0) || (startRate == endRate))
+        return 0;
+    double n = 0, a2 = 0, a3 = 0;
+    if (!cubicRamp(startRate, endRate, numUpdates, startAcc, endAcc, maxAcc, true, n, a2, a3))
+    {
+        startAcc = endAcc = 0;
+        cubicRamp(startRate, endRate, numUpdates, 0, 0, maxAcc, true, n, a2, a3);
+    }
+    double scale = double(1ull << RATE_DIFF_FRAC_BITS);
+    rateDiffs[0] = llround((startAcc + a2 + a3) * scale);
+    rateDiffs[1] = llround((2 * a2 + 6 * a3) * scale);
+    rateDiffs[2] = llround(6 * a3 * scale);
+    return uint32_t(n);
+}
+
 void MotionBlock::debugShowBlkHead()
 {
     Log.notice("#i EntMMps ExtMMps StTot0 StTot1 StTot2 St>Dec    Init     (perTT)      Pk     (perTT)     Fin     (perTT)     Acc     (perTT) UnitVecMax   FeedRtMMps StepDistMM  MaxStepRate\n");
@@ -209,6 +390,7 @@ void MotionBlock::debugShowBlkHead()
 
 void MotionBlock::debugShowBlock(int elemIdx, AxesParams &axesParams)
 {
+    MotionBlockSteps& steps = *_pSteps;
     char tmpBuf[200];
     sprintf(tmpBuf, "%2d%8.3f%8.3f%7d%7d%7d%7u%8.3f(%10d)%8.3f(%10d)%8.3f(%10d)%8.3f(%10u)%13.8f%11.6f%11.8f%11.3f", elemIdx,
                 _entrySpeedMMps,
@@ -216,11 +398,11 @@ void MotionBlock::debugShowBlock(int elemIdx, AxesParams &axesParams)
                 getStepsToTarget(0),
                 getStepsToTarget(1),
                 getStepsToTarget(2),
-                _stepsBeforeDecel,
-                debugStepRateToMMps(_initialStepRatePerTTicks), _initialStepRatePerTTicks,
+                steps._stepsBeforeDecel,
+                debugStepRateToMMps(steps._initialStepRatePerTTicks), steps._initialStepRatePerTTicks,
                 debugStepRateToMMps(_maxStepRatePerTTicks), _maxStepRatePerTTicks,
                 debugStepRateToMMps(_finalStepRatePerTTicks), _finalStepRatePerTTicks,
-                debugStepRateToMMps2(_accStepsPerTTicksPerMS),_accStepsPerTTicksPerMS,
+                debugStepRateToMMps2(steps._accStepsPerTTicksPerMS),steps._accStepsPerTTicksPerMS,
                 _unitVecAxisWithMaxDist,
                 _feedrate,
                 _debugStepDistMM,
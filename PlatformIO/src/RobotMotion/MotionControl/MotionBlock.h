@@ -7,6 +7,58 @@
 #include "AxisValues.h"
 #include "../AxesParams.h"
 
+// Part of a motion block used when stepping - the pipeline keeps these in their own array so the
+// ISR only touches this small record for each block and never the planning values
+// (HostMotionSim -b fails if it grows past HostPlannerBench's budget)
+struct MotionBlockSteps
+{
+    // Flags indicating the block is currently executing and that it can start executing
+    // (separate bytes as one is written by the ISR and the other by the planner)
+    volatile bool _isExecuting;
+    volatile bool _canExecute;
+    // Axis with the most steps
+    uint8_t _axisIdxWithMaxSteps;
+    // Block has a jerk-limited (S-curve) profile held in MotionBlockRamps
+    bool _jerkLimited;
+    // End-stops to test
+    AxisMinMaxBools _endStopsToCheck;
+    // Numbered command index - to help keep track of block execution from other processes
+    // like homing
+    int _numberedCommandIndex;
+
+    // Steps to target and before deceleration
+    int32_t _stepsTotalMaybeNeg[RobotConsts::MAX_AXES];
+    uint32_t _stepsBeforeDecel;
+
+    // Precomputed profile for the ISR - the rate starts at _initialStepRatePerTTicks (which is at least
+    // MIN_STEP_RATE_PER_TTICKS) and is increased by _accStepsPerTTicksPerMS for _accelRateUpdates ms
+    // then, once _stepsBeforeDecel steps are done, decreased for (accel updates done + _decelRateUpdatesAdj) ms
+    uint32_t _initialStepRatePerTTicks;
+    uint32_t _accStepsPerTTicksPerMS;
+    uint32_t _accelRateUpdates;
+    int32_t _decelRateUpdatesAdj;
+
+    void clear();
+};
+
+// Jerk-limited (S-curve) part of a motion block - held by the pipeline in a third array so the
+// trapezoid profile's stepping values stay small - each ramp changes the rate by the same amount as
+// the trapezoid ramp and covers the same steps but follows a cubic so the acceleration changes
+// smoothly - it is zero at the ends of a ramp except where a ramp continues into the next block -
+// the ISR steps through the cubic by forward differences (first, second and constant third
+// difference in 32.32 fixed point) for the ramp's updates and the ramp ends exactly on its end rate
+struct MotionBlockRamps
+{
+    int64_t _accelRateDiffs[3];
+    int64_t _decelRateDiffs[3];
+    uint32_t _accelRampUpdates;
+    uint32_t _decelRampUpdates;
+    uint32_t _accelEndRatePerTTicks;
+    uint32_t _decelEndRatePerTTicks;
+
+    void clear();
+};
+
 class MotionBlock
 {
 public:
@@ -19,12 +71,29 @@ public:
     // Tick interval in NS
     // 20000NS means max of 25k steps per second (as each step requires 2 entries to ISR - at least)
     // The ISR time is now averaging 1.3uS and max 2.8uS so this could be reduced to 10000 if needed
+    // (acceleration is precomputed - see prepareRateUpdates - so the ISR has no per-ms comparisons)
     static constexpr uint32_t TICK_INTERVAL_NS = 20000;
     static constexpr float TICKS_PER_SEC = (1e9f / TICK_INTERVAL_NS);
 
     // Number of ns in ms
     static constexpr uint32_t NS_IN_A_MS = 1000000;
 
+    // Step rate is changed (for acceleration/deceleration) every ms
+    static constexpr uint32_t TICKS_PER_RATE_UPDATE = NS_IN_A_MS / TICK_INTERVAL_NS;
+    static_assert(NS_IN_A_MS % TICK_INTERVAL_NS == 0, "TICK_INTERVAL_NS must divide into a ms");
+
+    // This is to ensure that the robot never goes to 0 tick rate - which would leave it
+    // immobile forever
+    static constexpr uint32_t MIN_STEP_RATE_PER_SEC = 10;
+    static constexpr uint32_t MIN_STEP_RATE_PER_TTICKS = uint32_t((MIN_STEP_RATE_PER_SEC * 1.0 * TTICKS_VALUE) / TICKS_PER_SEC);
+
+    // Fractional bits of the jerk-limited rate differences
+    static constexpr int RATE_DIFF_FRAC_BITS = 32;
+
+    // Jerk-limited ramps are planned with this fraction of the max acceleration - a cubic ramp's peak
+    // acceleration is 1.5 times its average so the peak is the max acceleration
+    static constexpr float JERK_LIMITED_ACC_FACTOR = 2.0f / 3;
+
 public:
     // Max speed for move - either MMps or stepsPerSec depending if move is stepwise
     float _feedrate;
@@ -40,39 +109,27 @@ public:
     float _exitSpeedMMps;
     // Step distance in MM
     double _debugStepDistMM;
-    // End-stops to test
-    AxisMinMaxBools _endStopsToCheck;
-    // Numbered command index - to help keep track of block execution from other processes
-    // like homing
-    int _numberedCommandIndex;
-
-    // Flags
-    struct
-    {
-        // Flag indicating the block is currently executing
-        volatile bool _isExecuting : 1;
-        // Flag indicating the block can start executing
-        volatile bool _canExecute : 1;
-        // Block is followed by others
-        bool _blockIsFollowed : 1;
-    };
+    // Block is followed by others
+    bool _blockIsFollowed;
+    // Jerk-limited ramp through the junction with the previous and next blocks - 1 if the blocks
+    // are both accelerating there, -1 if both decelerating (set by MotionPlanner when the speeds at the
+    // junction are final) - the ramps then have the block's acceleration at the junction instead of zero
+    int8_t _entryAccDirn;
+    int8_t _exitAccDirn;
 
-    // Steps to target and before deceleration
-    int32_t _stepsTotalMaybeNeg[RobotConsts::MAX_AXES];
-    int _axisIdxWithMaxSteps;
-    uint32_t _stepsBeforeDecel;
-
-    // Stepping acceleration/deceleration profile
-    uint32_t _initialStepRatePerTTicks;
+    // Peak and final step rates of the profile (not needed for stepping)
     uint32_t _maxStepRatePerTTicks;
     uint32_t _finalStepRatePerTTicks;
-    uint32_t _accStepsPerTTicksPerMS;
+
+    // Stepping and jerk-limited ramp parts of the block - held by the pipeline alongside this block
+    MotionBlockSteps* _pSteps;
+    MotionBlockRamps* _pRamps;
 
 public:
     MotionBlock();
     void clear();
     void setNumberedCommandIndex(int cmdIdx);
-    int IRAM_ATTR getNumberedCommandIndex();
+    int getNumberedCommandIndex();
     int32_t getStepsToTarget(int axisIdx);
     int32_t getAbsStepsToTarget(int axisIdx);
     void setStepsToTarget(int axisIdx, int32_t steps);
@@ -80,11 +137,25 @@ public:
     static float maxAchievableSpeed(float acceleration, float target_velocity, float distance);
     void forceInBounds(float &val, float lowBound, float highBound);
     void setEndStopsToCheck(AxisMinMaxBools &endStopCheck);
+    bool isExecuting()
+    {
+        return _pSteps->_isExecuting;
+    }
+    void setCanExecute()
+    {
+        _pSteps->_canExecute = true;
+    }
 
     // The block's entry and exit speed are now known
     // The block can accelerate and decelerate as required as long as these criteria are met
     // We now compute the stepping parameters to make motion happen
-    bool prepareForStepping(AxesParams &axesParams, bool isStepwise);
+    bool prepareForStepping(AxesParams &axesParams, bool isStepwise, bool jerkLimited);
+    void prepareRateUpdates(bool jerkLimited);
+    static bool cubicRamp(double startRate, double endRate, double numUpdates, double startAcc, double endAcc,
+                double maxAcc, bool wholeUpdates, double& n, double& a2, double& a3);
+    static double rampUpdatesForSteps(uint32_t numSteps, int64_t startRate, int64_t endRate);
+    static uint32_t prepareRampDiffs(int64_t startRate, int64_t endRate, double numUpdates,
+                int64_t startAcc, int64_t endAcc, int64_t maxAcc, int64_t rateDiffs[3]);
 
     // Debug
     void debugShowBlkHead();
@@ -6,6 +6,7 @@
 #include "MotionHelper.h"
 #include "Utils.h"
 #include "AxisValues.h"
+#include "LoopProfiler.h"
 
 // #define MOTION_LOG_DEBUG 1
 // #define DEBUG_MOTION_HELPER 1
@@ -21,7 +22,10 @@ MotionHelper::MotionHelper() :
     _isPaused = false;
     _moveRelative = false;
     _blockDistanceMM = 0;
+    _arcChordErrorMM = arcChordErrorMM_default;
     _allowAllOutOfBounds = false;
+    _stopRequested = false;
+    _stopRequestTimeMs = 0;
     // Clear axis current location
     _lastCommandedAxisPos.clear();
     _rampGenerator.resetTotalStepPosition();
@@ -32,6 +36,13 @@ MotionHelper::MotionHelper() :
     _correctStepOverflowFn = NULL;
     // Handling of splitting-up of motion into smaller blocks
     _blocksToAddTotal = 0;    
+    _blocksToAddIsArc = false;
+    _pPointSource = NULL;
+    // Telemetry
+    _serviceWorkPending = false;
+    _upstreamWorkPending = false;
+    _lastServiceUs = 0;
+    _serviceGapMaxUs = 0;
     // Init callbacks
     _ptToActuatorFn = nullptr;
     _actuatorToPtFn = nullptr;
@@ -69,21 +80,24 @@ void MotionHelper::configure(const char *robotConfigJSON)
     _trinamicsController.stop();
     
     // Config geometry
-    String robotGeom = RdJson::getString("robotGeom", "NONE", robotConfigJSON);
+    RdJsonDoc robotGeomDoc(RdJson::getString("robotGeom", "NONE", robotConfigJSON).c_str());
 
     // Config settings
-    int pipelineLen = int(RdJson::getLong("pipelineLen", pipelineLen_default, robotGeom.c_str()));
-    _blockDistanceMM = float(RdJson::getDouble("blockDistanceMM", blockDistanceMM_default, robotGeom.c_str()));
-    _allowAllOutOfBounds = bool(RdJson::getLong("allowOutOfBounds", false, robotGeom.c_str()));
-    float junctionDeviation = float(RdJson::getDouble("junctionDeviation", junctionDeviation_default, robotGeom.c_str()));
-    Log.notice("%sconfigMotionPipeline len %d, blockDistMM %F (0=no-max), allowOoB %s, jnDev %F\n", MODULE_PREFIX,
-               pipelineLen, _blockDistanceMM, _allowAllOutOfBounds ? "Y" : "N", junctionDeviation);
+    int pipelineLen = int(robotGeomDoc.getLong("pipelineLen", pipelineLen_default));
+    _blockDistanceMM = float(robotGeomDoc.getDouble("blockDistanceMM", blockDistanceMM_default));
+    _allowAllOutOfBounds = bool(robotGeomDoc.getLong("allowOutOfBounds", false));
+    float junctionDeviation = float(robotGeomDoc.getDouble("junctionDeviation", junctionDeviation_default));
+    _arcChordErrorMM = float(robotGeomDoc.getDouble("arcChordErrorMM", arcChordErrorMM_default));
+    bool jerkLimited = robotGeomDoc.getString("motionProfile", "trapezoid").equalsIgnoreCase("scurve");
+    Log.notice("%sconfigMotionPipeline len %d, blockDistMM %F (0=no-max), allowOoB %s, jnDev %F, arcErrMM %F, profile %s\n", MODULE_PREFIX,
+               pipelineLen, _blockDistanceMM, _allowAllOutOfBounds ? "Y" : "N", junctionDeviation, _arcChordErrorMM,
+               jerkLimited ? "scurve" : "trapezoid");
 
     // Pipeline length and block size
     _motionPipeline.init(pipelineLen);
 
     // Motion Pipeline and Planner
-    _motionPlanner.configure(junctionDeviation);
+    _motionPlanner.configure(junctionDeviation, pipelineLen, jerkLimited);
 
     // Clean up previous
     _trinamicsController.deinit();
@@ -92,15 +106,15 @@ void MotionHelper::configure(const char *robotConfigJSON)
 
     // Configure Axes
     _axesParams.clearAxes();
-    String axisJSON;
+    RdJsonDoc axisDoc;
     for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
     {
-        if (_axesParams.configureAxis(robotGeom.c_str(), axisIdx, axisJSON))
+        if (_axesParams.configureAxis(robotGeomDoc, axisIdx, axisDoc))
         {
             // Configure ramp generator - motors and end-stops
-            _rampGenerator.configureAxis(axisIdx, axisJSON.c_str());
+            _rampGenerator.configureAxis(axisIdx, axisDoc);
             // Configure ramp generator - motors and end-stops
-            _trinamicsController.configureAxis(axisIdx, axisJSON.c_str());
+            _trinamicsController.configureAxis(axisIdx, axisDoc);
         }
     }
 
@@ -109,13 +123,13 @@ void MotionHelper::configure(const char *robotConfigJSON)
         _setRobotAttributes(_axesParams, _robotAttributes);
 
     // Homing
-    _motionHoming.configure(robotGeom.c_str());    
+    _motionHoming.configure(robotGeomDoc);    
 
     // Trinamic controller
-    _trinamicsController.configure(robotGeom.c_str());
+    _trinamicsController.configure(robotGeomDoc);
 
     // Motor enabler
-    _motorEnabler.configure(robotGeom.c_str());
+    _motorEnabler.configure(robotGeomDoc);
 
     // Start motion actuator
     _rampGenerator.configure(!_trinamicsController.isRampGenerator());
@@ -133,6 +147,8 @@ bool MotionHelper::canAccept()
     if (_motionHoming.isHomingInProgress())
         return false;
     // Check that the motion pipeline can accept new data
+    if (_pPointSource && _pPointSource->isBusy())
+        return false;
     return (_blocksToAddTotal == 0) && _motionPipeline.canAccept();
 }
 
@@ -154,6 +170,7 @@ bool MotionHelper::isPaused()
 void MotionHelper::stop()
 {
     _blocksToAddTotal = 0;
+    _pPointSource = NULL;
     _stopRequested = true;
     _stopRequestTimeMs = millis();
     _rampGenerator.stop();
@@ -226,6 +243,19 @@ void MotionHelper::getCurStatus(RobotCommandArgs &args)
     args.setNumQueued(_motionPipeline.count());
 }
 
+// Report status to the snapshot (which only marks the fields which changed)
+void MotionHelper::updateStatus(StatusSnapshot &status, int numCmdsWaiting)
+{
+    status.setPosition(_lastCommandedAxisPos._axisPositionMM, _lastCommandedAxisPos._stepsFromHome);
+    AxisMinMaxBools endstops;
+    _rampGenerator.getEndStopStatus(endstops);
+    status.setEndStops(endstops);
+    status.setMoveRelative(_moveRelative);
+    status.setPause(_isPaused);
+    status.setHoming(_motionHoming.isHomingInProgress(), _motionHoming.isHomedOk());
+    status.setNumQueued(_motionPipeline.count() + numCmdsWaiting);
+}
+
 // Get attributes of robot
 void MotionHelper::getRobotAttributes(String& robotAttrs)
 {
@@ -246,6 +276,32 @@ bool MotionHelper::moveTo(RobotCommandArgs &args)
     {
         return _motionPlanner.moveToStepwise(args, _lastCommandedAxisPos, _axesParams, _motionPipeline);
     }
+    // Setup for adding blocks and process anything that can be done immediately
+    if (!blocksToAddSetup(args))
+        return false;
+    blocksToAddProcess();
+    return true;
+}
+
+// Move through the points from a source (e.g. a theta-rho line) - the points are pulled from
+// the source as the pipeline has room so the source must remain valid until it is no longer
+// busy (or stop() is called)
+void MotionHelper::movePointSource(MotionPointSource &source)
+{
+    _pPointSource = &source;
+    blocksToAddProcess();
+}
+
+// Stop pulling points from a source (if it is the current one) - e.g. before it is restarted
+void MotionHelper::pointSourceDetach(MotionPointSource &source)
+{
+    if (_pPointSource == &source)
+        _pPointSource = NULL;
+}
+
+// Setup splitting a move into blocks to be added to the pipeline
+bool MotionHelper::blocksToAddSetup(RobotCommandArgs &args)
+{
     // Convert coordinates if required
     // Convert coords to MM (in-place conversion)
     if (_convertCoordsFn)
@@ -294,6 +350,9 @@ bool MotionHelper::moveTo(RobotCommandArgs &args)
         numBlocks = int(ceil(lineLen / _blockDistanceMM));
     if (numBlocks == 0)
         numBlocks = 1;
+
+    // Arcs are split into chords as they are added to the pipeline
+    _blocksToAddIsArc = args.isArcMove() && arcSetup(args, destPos, numBlocks);
 #ifdef DEBUG_MOTION_HELPER
     Log.trace("%smoveTo curX %F(%d) curY %F(%d) curZ %F(%d) newX %F newY %F newZ %F numBlocks %d (lineLen %F / blockDistMM %F)\n", MODULE_PREFIX,
                 _lastCommandedAxisPos._axisPositionMM.getVal(0),
@@ -317,9 +376,6 @@ bool MotionHelper::moveTo(RobotCommandArgs &args)
     _blocksToAddEndPos = destPos;
     _blocksToAddCurBlock = 0;
     _blocksToAddTotal = numBlocks;
-
-    // Process anything that can be done immediately
-    blocksToAddProcess();
     return true;
 }
 
@@ -330,13 +386,27 @@ void MotionHelper::blocksToAddProcess()
     // Check if we can add anything to the pipeline
     while (_motionPipeline.canAccept())
     {
-        // Check if any blocks remain to be expanded out
+        // Check if any blocks remain to be expanded out - if not get the next
+        // point from the source (if any)
         if (_blocksToAddTotal <= 0)
-            return;
+        {
+            LOOP_PROFILE_SCOPE("PointSource");
+            if (!pointSourceNext())
+                return;
+            continue;
+        }
 
         // Add to pipeline any blocks that are waiting to be expanded out
         AxisFloats nextBlockDest = _blocksToAddStartPos + _blocksToAddDelta * float(_blocksToAddCurBlock + 1);
 
+        // Point on arc
+        if (_blocksToAddIsArc)
+        {
+            float angle = _blocksToAddArcStartAngle + _blocksToAddArcAnglePerBlock * float(_blocksToAddCurBlock + 1);
+            nextBlockDest.setVal(0, _blocksToAddArcCentreX + _blocksToAddArcRadius * cosf(angle));
+            nextBlockDest.setVal(1, _blocksToAddArcCentreY + _blocksToAddArcRadius * sinf(angle));
+        }
+
         // If last block then just use end point coords
         if (_blocksToAddCurBlock + 1 >= _blocksToAddTotal)
             nextBlockDest = _blocksToAddEndPos;
@@ -350,17 +420,99 @@ void MotionHelper::blocksToAddProcess()
 
         // Prepare add to planner
         _blocksToAddCommandArgs.setPointMM(nextBlockDest);
-        _blocksToAddCommandArgs.setMoreMovesComing(_blocksToAddTotal != 0);
+        _blocksToAddCommandArgs.setMoreMovesComing((_blocksToAddTotal != 0) ||
+                    (_pPointSource && _pPointSource->isBusy()));
 
 
         // Add to planner
-        addToPlanner(_blocksToAddCommandArgs);
+        {
+            LOOP_PROFILE_SCOPE("Plan");
+            addToPlanner(_blocksToAddCommandArgs);
+        }
 
         // Enable motors
         _motorEnabler.enableMotors(true, false);
     }
 }
 
+// Setup blocks for the next point from the point source - returns false when there are none
+bool MotionHelper::pointSourceNext()
+{
+    AxisFloats pt;
+    if (!_pPointSource || !_pPointSource->nextPoint(pt))
+    {
+        _pPointSource = NULL;
+        return false;
+    }
+    RobotCommandArgs args;
+    args.setAxisValMM(0, pt.getVal(0), true);
+    args.setAxisValMM(1, pt.getVal(1), true);
+    args.setMoveRapid(true);
+    return blocksToAddSetup(args);
+}
+
+// Setup generation of an arc in the XY plane from the current position to destPos - the
+// number of blocks is chosen to keep the chords within _arcChordErrorMM of the arc
+// Returns false if the arc is degenerate (in which case it is handled as a line)
+bool MotionHelper::arcSetup(RobotCommandArgs &args, AxisFloats &destPos, int &numBlocks)
+{
+    float startX = _lastCommandedAxisPos._axisPositionMM.getVal(0);
+    float startY = _lastCommandedAxisPos._axisPositionMM.getVal(1);
+    float deltaX = destPos.getVal(0) - startX;
+    float deltaY = destPos.getVal(1) - startY;
+    bool clockwise = args.isArcClockwise();
+
+    // Centre offset from start - either I, J or computed from radius (negative radius is the longer arc)
+    float offsetI = args.getArcCentreOffset(0);
+    float offsetJ = args.getArcCentreOffset(1);
+    if (args.isArcRadiusValid())
+    {
+        float chordLen = sqrtf(deltaX * deltaX + deltaY * deltaY);
+        if (chordLen < distToTravelMM_ignoreBelow)
+            return false;
+        float radius = args.getArcRadius();
+        float hx2DivD = -sqrtf(fmaxf(4 * radius * radius - chordLen * chordLen, 0)) / chordLen;
+        if (!clockwise)
+            hx2DivD = -hx2DivD;
+        if (radius < 0)
+            hx2DivD = -hx2DivD;
+        offsetI = 0.5f * (deltaX - deltaY * hx2DivD);
+        offsetJ = 0.5f * (deltaY + deltaX * hx2DivD);
+    }
+    float radius = sqrtf(offsetI * offsetI + offsetJ * offsetJ);
+    if (radius < distToTravelMM_ignoreBelow)
+        return false;
+
+    // Angle swept from start to end (start == end is a full circle)
+    float centreX = startX + offsetI;
+    float centreY = startY + offsetJ;
+    float endRelX = destPos.getVal(0) - centreX;
+    float endRelY = destPos.getVal(1) - centreY;
+    float sweep = atan2f(-offsetI * endRelY + offsetJ * endRelX, -offsetI * endRelX - offsetJ * endRelY);
+    if (clockwise && (sweep >= -arcAngleEpsilon))
+        sweep -= 2 * M_PI;
+    else if (!clockwise && (sweep <= arcAngleEpsilon))
+        sweep += 2 * M_PI;
+
+    // Chord angle which keeps within the error (and block distance if set)
+    float maxChordAngle = 2 * acosf(1 - fminf(_arcChordErrorMM, radius) / radius);
+    if (_blockDistanceMM > 0.01f)
+        maxChordAngle = fminf(maxChordAngle, _blockDistanceMM / radius);
+    numBlocks = max(1, int(ceilf(fabsf(sweep) / maxChordAngle)));
+
+    // Generation info
+    _blocksToAddArcCentreX = centreX;
+    _blocksToAddArcCentreY = centreY;
+    _blocksToAddArcRadius = radius;
+    _blocksToAddArcStartAngle = atan2f(-offsetJ, -offsetI);
+    _blocksToAddArcAnglePerBlock = sweep / numBlocks;
+#ifdef DEBUG_MOTION_HELPER
+    Log.trace("%sarcSetup centre X%F Y%F radius %F sweep %F numBlocks %d\n", MODULE_PREFIX,
+                centreX, centreY, radius, sweep, numBlocks);
+#endif
+    return true;
+}
+
 // Add a movement to the pipeline using the planner which computes suitable motion
 bool MotionHelper::addToPlanner(RobotCommandArgs &args)
 {
@@ -415,12 +567,19 @@ bool MotionHelper::addToPlanner(RobotCommandArgs &args)
 // disabled after a period of no motion
 void MotionHelper::service()
 {
+    // Telemetry - time since the last service if there was more motion to add then
+    unsigned long nowUs = micros();
+    if (_serviceWorkPending && (nowUs - _lastServiceUs > _serviceGapMaxUs))
+        _serviceGapMaxUs = nowUs - _lastServiceUs;
+    _lastServiceUs = nowUs;
+
     // Check if stop requested
     if (_stopRequested)
     {
         if (Utils::isTimeout(millis(), _stopRequestTimeMs, MAX_TIME_BEFORE_STOP_COMPLETE_MS))
         {
             _blocksToAddTotal = 0;
+            _pPointSource = NULL;
             _rampGenerator.stop();
             _trinamicsController.stop();
             _motionPipeline.clear();
@@ -438,10 +597,19 @@ void MotionHelper::service()
     _trinamicsController.process();
 
     // Process any split-up blocks to be added to the pipeline
-    blocksToAddProcess();
+    {
+        LOOP_PROFILE_SCOPE("BlocksToAdd");
+        blocksToAddProcess();
+    }
+    _serviceWorkPending = (_blocksToAddTotal > 0) || (_pPointSource && _pPointSource->isBusy()) ||
+                _upstreamWorkPending;
+    _rampGenerator.getPipelineStats().setWorkPending(_serviceWorkPending);
 
     // Service homing
-    _motionHoming.service(_axesParams);
+    {
+        LOOP_PROFILE_SCOPE("Homing");
+        _motionHoming.service(_axesParams);
+    }
 
     // Ensure motors enabled when homing or moving
     if ((_motionPipeline.count() > 0) || _motionHoming.isHomingInProgress())
@@ -486,7 +654,23 @@ void MotionHelper::debugShowTopBlock()
 
 String MotionHelper::getDebugStr()
 {
-    return _rampGenerator.getDebugStr();
+    MotionPipelineStats& pipelineStats = _rampGenerator.getPipelineStats();
+    return _rampGenerator.getDebugStr() + _motionPlanner.getDebugStr() +
+                " UR:" + String(pipelineStats.getUnderruns()) + "/" + String(pipelineStats.getMaxGapMs()) + "ms";
+}
+
+void MotionHelper::getPipelineStats(String& statsJson, bool clearStats)
+{
+    MotionPipelineStats& pipelineStats = _rampGenerator.getPipelineStats();
+    String fieldsStr;
+    pipelineStats.getJSONFields(fieldsStr);
+    statsJson = "{\"depth\":" + String(_motionPipeline.count()) +
+                ",\"serviceGapMaxMs\":" + String(_serviceGapMaxUs / 1000.0, 1) + "," + fieldsStr + "}";
+    if (clearStats)
+    {
+        pipelineStats.clear();
+        _serviceGapMaxUs = 0;
+    }
 }
 
 int MotionHelper::testGetPipelineCount()
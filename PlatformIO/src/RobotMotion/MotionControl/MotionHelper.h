@@ -6,11 +6,13 @@
 #include "../AxesParams.h"
 #include "../AxisPosition.h"
 #include "RobotCommandArgs.h"
+#include "StatusSnapshot.h"
 #include "MotionPlanner.h"
 #include "RampGenerator/RampGenerator.h"
 #include "MotionHoming.h"
 #include "Trinamics/TrinamicsController.h"
 #include "MotorEnabler.h"
+#include "MotionPointSource.h"
 
 class MotionHelper
 {
@@ -18,6 +20,8 @@ public:
     static constexpr float blockDistanceMM_default = 0.0f;
     static constexpr float junctionDeviation_default = 0.05f;
     static constexpr float distToTravelMM_ignoreBelow = 0.01f;
+    static constexpr float arcChordErrorMM_default = 0.02f;
+    static constexpr float arcAngleEpsilon = 5e-7f;
     static constexpr int pipelineLen_default = 100;
     static constexpr uint32_t MAX_TIME_BEFORE_STOP_COMPLETE_MS = 500;
 
@@ -26,6 +30,8 @@ private:
     bool _isPaused;
     // Block distance
     float _blockDistanceMM;
+    // Max distance between an arc and the chords used to draw it
+    float _arcChordErrorMM;
     // Allow all out of bounds movement
     bool _allowAllOutOfBounds;
     // Axes parameters
@@ -68,10 +74,27 @@ private:
     AxisFloats _blocksToAddDelta;
     // Command args for block generation
     RobotCommandArgs _blocksToAddCommandArgs;
+    // Arcs (G2/G3) - XY points are generated on the arc as blocks are added and
+    // any other axes move linearly
+    bool _blocksToAddIsArc;
+    float _blocksToAddArcCentreX;
+    float _blocksToAddArcCentreY;
+    float _blocksToAddArcRadius;
+    float _blocksToAddArcStartAngle;
+    float _blocksToAddArcAnglePerBlock;
+    // Source of points (e.g. theta-rho or pattern) - pulled whenever there are no blocks left to add
+    MotionPointSource* _pPointSource;
 
     // Handling of stop
     bool _stopRequested;
-    bool _stopRequestTimeMs;
+    unsigned long _stopRequestTimeMs;
+
+    // Telemetry - longest time between services while there was more motion to add (here or
+    // upstream - robot commands, work items or busy evaluators)
+    bool _serviceWorkPending;
+    bool _upstreamWorkPending;
+    unsigned long _lastServiceUs;
+    unsigned long _serviceGapMaxUs;
 
     // Debug
     unsigned long _debugLastPosDispMs;
@@ -125,8 +148,11 @@ public:
     void setCurPositionAsHome(int axisIdx);
 
     bool moveTo(RobotCommandArgs &args);
+    void movePointSource(MotionPointSource &source);
+    void pointSourceDetach(MotionPointSource &source);
     void setMotionParams(RobotCommandArgs &args);
     void getCurStatus(RobotCommandArgs &args);
+    void updateStatus(StatusSnapshot &status, int numCmdsWaiting);
     void getRobotAttributes(String& robotAttrs);
     void goHome(RobotCommandArgs &args);
     int getLastCompletedNumberedCmdIdx()
@@ -145,6 +171,15 @@ public:
     void debugShowTopBlock();
     void debugShowTiming();
     String getDebugStr();
+    // Pipeline underrun telemetry as JSON (optionally cleared after reading)
+    void getPipelineStats(String& statsJson, bool clearStats);
+
+    // Set (before service) when motion is waiting upstream so that a gap in the pipeline while it
+    // waits counts as an underrun
+    void setUpstreamWorkPending(bool workPending)
+    {
+        _upstreamWorkPending = workPending;
+    }
     int testGetPipelineCount();
     bool testGetPipelineBlock(int elIdx, MotionBlock &elem);
     void setIntrumentationMode(const char *testModeStr)
@@ -159,6 +194,17 @@ public:
     }
 #endif
 
+#ifdef RAMPGEN_HOST_SIM
+    RampGenerator& simGetRampGenerator()
+    {
+        return _rampGenerator;
+    }
+    MotionPipeline& simGetMotionPipeline()
+    {
+        return _motionPipeline;
+    }
+#endif
+
 private:
     bool isInBounds(double v, double b1, double b2)
     {
@@ -166,5 +212,8 @@ private:
     }
     void setCurPosActualPosition();
     bool addToPlanner(RobotCommandArgs &args);
+    bool blocksToAddSetup(RobotCommandArgs &args);
     void blocksToAddProcess();
+    bool pointSourceNext();
+    bool arcSetup(RobotCommandArgs &args, AxisFloats &destPos, int &numBlocks);
 };
@@ -22,15 +22,15 @@ MotionHoming::MotionHoming(MotionHelper *pMotionHelper)
     _centringPhase = 0;
 }
 
-void MotionHoming::configure(const char *configJSON)
+void MotionHoming::configure(RdJsonDoc& robotGeomDoc)
 {
     // Sequence of commands for homing
     bool isValid = false;
-    _homingSequence = RdJson::getString("homing/homingSeq", "", configJSON, isValid);
+    _homingSequence = robotGeomDoc.getString("homing/homingSeq", "", isValid);
     if (!isValid)
         _homingSequence = "";
     // Max time homing
-    _maxHomingSecs = RdJson::getLong("homing/maxHomingSecs", maxHomingSecs_default, configJSON);
+    _maxHomingSecs = robotGeomDoc.getLong("homing/maxHomingSecs", maxHomingSecs_default);
     // No homing currently
     _homingStrPos = 0;
     _commandInProgress = false;
@@ -42,7 +42,7 @@ private:
 
 public:
     MotionHoming(MotionHelper *pMotionHelper);
-    void configure(const char *configJSON);
+    void configure(RdJsonDoc& robotGeomDoc);
     bool isHomingInProgress();
     bool isHomedOk();
     void homingStart(RobotCommandArgs &args);
@@ -11,7 +11,12 @@ class MotionPipeline
 {
   private:
     MotionRingBufferPosn _pipelinePosn;
+    // Blocks are held as three arrays - the planning values, the stepping values used by the ISR
+    // and the jerk-limited ramps (only used by the ISR for S-curve profiles) - each block points to
+    // its stepping values and ramps
     std::vector<MotionBlock> _pipeline;
+    std::vector<MotionBlockSteps> _pipelineSteps;
+    std::vector<MotionBlockRamps> _pipelineRamps;
 
   public:
     MotionPipeline() : _pipelinePosn(0)
@@ -20,8 +25,16 @@ class MotionPipeline
 
     void init(int pipelineSize)
     {
-        _pipeline.resize(pipelineSize);
         _pipelinePosn.init(pipelineSize);
+        unsigned int storageLen = _pipelinePosn.storageLen();
+        _pipeline.resize(storageLen);
+        _pipelineSteps.resize(storageLen);
+        _pipelineRamps.resize(storageLen);
+        for (unsigned int i = 0; i < storageLen; i++)
+        {
+            _pipeline[i]._pSteps = &_pipelineSteps[i];
+            _pipeline[i]._pRamps = &_pipelineRamps[i];
+        }
     }
 
     // Clear the pipeline
@@ -30,7 +43,7 @@ class MotionPipeline
         _pipelinePosn.clear();
     }
 
-    unsigned int count()
+    unsigned int IRAM_ATTR count()
     {
         return _pipelinePosn.count();
     }
@@ -41,17 +54,24 @@ class MotionPipeline
         return _pipelinePosn.canPut();
     }
 
-    // Add to pipeline
-    bool add(MotionBlock &block)
+    // Reserve the block at the put position so it can be filled in place - returns NULL if full
+    // The block is cleared and isn't in the pipeline until commitPut() is called
+    MotionBlock* reservePut()
     {
         // Check if full
         if (!_pipelinePosn.canPut())
-            return false;
+            return NULL;
 
-        // Add the item
-        _pipeline[_pipelinePosn._putPos] = block;
+        // Clear the block
+        MotionBlock* pBlock = &(_pipeline[_pipelinePosn.posToPut()]);
+        pBlock->clear();
+        return pBlock;
+    }
+
+    // Add the reserved block to the pipeline
+    void commitPut()
+    {
         _pipelinePosn.hasPut();
-        return true;
     }
 
     // Can get from queue (i.e. not empty)
@@ -60,39 +80,45 @@ class MotionPipeline
         return _pipelinePosn.canGet();
     }
 
-    // Get from queue
-    bool IRAM_ATTR get(MotionBlock &block)
+    // Remove last element from queue
+    bool IRAM_ATTR remove()
     {
         // Check if queue is empty
         if (!_pipelinePosn.canGet())
             return false;
 
-        // read the item and remove
-        block = _pipeline[_pipelinePosn._getPos];
+        // remove item
         _pipelinePosn.hasGot();
         return true;
     }
 
-    // Remove last element from queue
-    bool IRAM_ATTR remove()
+    // Peek the block which would be got (if there is one)
+    MotionBlock* peekGet()
     {
         // Check if queue is empty
         if (!_pipelinePosn.canGet())
-            return false;
-
-        // remove item
-        _pipelinePosn.hasGot();
-        return true;
+            return NULL;
+        // get pointer to the last item (don't remove)
+        return &(_pipeline[_pipelinePosn.posToGet()]);
     }
 
-    // Peek the block which would be got (if there is one)
-    MotionBlock* IRAM_ATTR peekGet()
+    // Peek the stepping values of the block which would be got (if there is one)
+    MotionBlockSteps* IRAM_ATTR peekGetSteps()
     {
         // Check if queue is empty
         if (!_pipelinePosn.canGet())
             return NULL;
         // get pointer to the last item (don't remove)
-        return &(_pipeline[_pipelinePosn._getPos]);
+        return &(_pipelineSteps[_pipelinePosn.posToGet()]);
+    }
+
+    // Peek the jerk-limited ramps of the block which would be got (if there is one)
+    MotionBlockRamps* IRAM_ATTR peekGetRamps()
+    {
+        // Check if queue is empty
+        if (!_pipelinePosn.canGet())
+            return NULL;
+        return &(_pipelineRamps[_pipelinePosn.posToGet()]);
     }
 
     // Peek from the put position
@@ -0,0 +1,42 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+#include "MotionPipelineStats.h"
+
+void MotionPipelineStats::clear()
+{
+    _blockEndTick = 0;
+    _blockEndWorkPending = false;
+    _blocksStarted = 0;
+    _underruns = 0;
+    _underrunTicks = 0;
+    _maxGapTicks = 0;
+    for (int i = 0; i < NUM_HIST_BUCKETS; i++)
+    {
+        _depthHist[i] = 0;
+        _refillHist[i] = 0;
+    }
+}
+
+String MotionPipelineStats::histJSON(volatile uint32_t* pHist)
+{
+    String histStr = "[";
+    for (int i = 0; i < NUM_HIST_BUCKETS; i++)
+    {
+        if (i != 0)
+            histStr += ",";
+        histStr += String(pHist[i]);
+    }
+    return histStr + "]";
+}
+
+void MotionPipelineStats::getJSONFields(String& jsonStr)
+{
+    // Histogram buckets are 0, 1, 2-3, 4-7, ... 64+ (blocks for depth and ms for refill)
+    jsonStr = "\"blocks\":" + String(_blocksStarted) +
+                ",\"underruns\":" + String(_underruns) +
+                ",\"underrunMs\":" + String(_underrunTicks / TICKS_PER_MS) +
+                ",\"maxGapMs\":" + String(_maxGapTicks / float(TICKS_PER_MS), 2) +
+                ",\"depthHist\":" + histJSON(_depthHist) +
+                ",\"refillMsHist\":" + histJSON(_refillHist);
+}
@@ -0,0 +1,119 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Motion pipeline telemetry - counts underruns (the ISR finished a block while the planner still had
+// work - blocks still to be split, a point source with points or motion waiting upstream such as
+// queued work items or a file being played - and the next block didn't start straight away) and
+// keeps histograms of the pipeline depth when each block starts and of the time taken to refill
+// after an underrun
+// The ISR counts ticks and records block ends and starts so it costs an increment per tick and
+// a few instructions per block
+
+#pragma once
+
+#include <Arduino.h>
+#include "MotionBlock.h"
+
+class MotionPipelineStats
+{
+public:
+    // Histogram buckets are powers of two - 0, 1, 2-3, 4-7 ... and the last bucket holds the rest
+    static const int NUM_HIST_BUCKETS = 8;
+
+    // A block which starts within this many ticks of the previous block ending is in time (the ISR
+    // may take a tick to finish a step pulse and a tick to pick up the next block)
+    static const uint32_t UNDERRUN_MIN_TICKS = 3;
+    static const uint32_t TICKS_PER_MS = MotionBlock::NS_IN_A_MS / MotionBlock::TICK_INTERVAL_NS;
+
+    MotionPipelineStats()
+    {
+        _workPending = false;
+        _tickCount = 0;
+        clear();
+    }
+
+    void clear();
+
+    // Set by the planner side - true while there is more motion to add to the pipeline - once
+    // there is no more a gap after the last block ended isn't an underrun
+    void setWorkPending(bool workPending)
+    {
+        _workPending = workPending;
+        if (!workPending)
+            _blockEndWorkPending = false;
+    }
+
+    // ISR - every tick
+    void IRAM_ATTR tick()
+    {
+        _tickCount++;
+    }
+
+    // ISR - block complete
+    void IRAM_ATTR blockEnded()
+    {
+        _blockEndTick = _tickCount;
+        _blockEndWorkPending = _workPending;
+    }
+
+    // ISR - block started with pipelineDepth blocks in the pipeline (including the one started)
+    void IRAM_ATTR blockStarted(unsigned int pipelineDepth)
+    {
+        _blocksStarted++;
+        _depthHist[histBucket(pipelineDepth)]++;
+        if (!_blockEndWorkPending)
+            return;
+        _blockEndWorkPending = false;
+        uint32_t gapTicks = _tickCount - _blockEndTick;
+        if (gapTicks > _maxGapTicks)
+            _maxGapTicks = gapTicks;
+        if (gapTicks < UNDERRUN_MIN_TICKS)
+            return;
+        _underruns++;
+        _underrunTicks += gapTicks;
+        _refillHist[histBucket(gapTicks / TICKS_PER_MS)]++;
+    }
+
+    // Motion stopped or paused - a gap before the next block isn't an underrun
+    void motionInterrupted()
+    {
+        _blockEndWorkPending = false;
+    }
+
+    // Info
+    uint32_t getBlocksStarted()
+    {
+        return _blocksStarted;
+    }
+    uint32_t getUnderruns()
+    {
+        return _underruns;
+    }
+    uint32_t getMaxGapMs()
+    {
+        return _maxGapTicks / TICKS_PER_MS;
+    }
+    // Fields of a JSON object (without braces)
+    void getJSONFields(String& jsonStr);
+
+private:
+    static inline int IRAM_ATTR histBucket(uint32_t val)
+    {
+        if (val == 0)
+            return 0;
+        int bucket = 32 - __builtin_clz(val);
+        return (bucket < NUM_HIST_BUCKETS) ? bucket : NUM_HIST_BUCKETS - 1;
+    }
+    static String histJSON(volatile uint32_t* pHist);
+
+    volatile bool _workPending;
+    volatile uint32_t _tickCount;
+    volatile uint32_t _blockEndTick;
+    volatile bool _blockEndWorkPending;
+    volatile uint32_t _blocksStarted;
+    volatile uint32_t _underruns;
+    volatile uint32_t _underrunTicks;
+    volatile uint32_t _maxGapTicks;
+    volatile uint32_t _depthHist[NUM_HIST_BUCKETS];
+    volatile uint32_t _refillHist[NUM_HIST_BUCKETS];
+};
@@ -3,9 +3,14 @@
 
 #include "MotionPlanner.h"
 
-void MotionPlanner::configure(float junctionDeviation)
+void MotionPlanner::configure(float junctionDeviation, int pipelineLen, bool jerkLimited)
 {
     _junctionDeviation = junctionDeviation;
+    _jerkLimited = jerkLimited;
+    _reverseEntrySpeeds.resize(pipelineLen);
+    _blockNeedsPrepare.resize(pipelineLen + 1);
+    _numUnplannedBlocks = 0;
+    statsClear();
 }
 
 // Entry point for adding a motion block
@@ -51,8 +56,11 @@ bool MotionPlanner::moveTo(RobotCommandArgs &args,
     if (!isAMove || moveDist < MotionBlock::MINIMUM_MOVE_DIST_MM)
         return false;
 
-    // Create a block for this movement which will end up on the pipeline
-    MotionBlock block;
+    // Build the block for this movement in place at the put position of the pipeline
+    MotionBlock* pNewBlock = motionPipeline.reservePut();
+    if (!pNewBlock)
+        return false;
+    MotionBlock& block = *pNewBlock;
 
     // Set flag to indicate if more moves coming
     block._blockIsFollowed = args.getMoreMovesComing();
@@ -104,7 +112,7 @@ bool MotionPlanner::moveTo(RobotCommandArgs &args,
     Log.notice("F %F D %F uX %F uY %F, uZ %F maxStAx %d maxDAx %d %s\n", validFeedrateMMps,
             moveDist, 
             unitVectors.getVal(0), unitVectors.getVal(1), unitVectors.getVal(2), 
-            block._axisIdxWithMaxSteps, axisWithMaxMoveDist,
+            block._pSteps->_axisIdxWithMaxSteps, axisWithMaxMoveDist,
             hasSteps ? "has steps" : "NO STEPS");
 #endif
 
@@ -159,7 +167,7 @@ bool MotionPlanner::moveTo(RobotCommandArgs &args,
 #endif
 
     // Add the element to the pipeline and remember previous element
-    motionPipeline.add(block);
+    motionPipeline.commitPut();
     MotionBlockSequentialData prevBlockInfo;
     prevBlockInfo._maxParamSpeedMMps = block._feedrate;
     prevBlockInfo._unitVectors = unitVectors;
@@ -197,123 +205,158 @@ void MotionPlanner::debugDumpQueue(const char *comStr, MotionPipeline &motionPip
 void MotionPlanner::recalculatePipeline(MotionPipeline &motionPipeline, AxesParams &axesParams)
 {
     // The last block in the pipe (most recently added) will have zero exit speed
-    // For each block, walking backwards in the queue :
+    // Only blocks after the last planned block are recalculated - the last planned block's entry
+    // speed cannot change (adding blocks only allows speeds to increase) so it anchors the calculation
+    // For each block, walking backwards in the queue as far as the last planned block:
     //    We know the desired exit speed so calculate the entry speed using v^2 = u^2 + 2*a*s
     //    Set the exit speed for the previous block from this entry speed
-    // Then walk forward in the queue starting with the first block that can be changed:
+    // Then walk forward in the queue starting with the last planned block:
     //    Set the entry speed from the previous block (or to 0 if none)
     //    Calculate the max possible exit speed for the block using the same formula as above
     //    Set the entry speed for the next block using this exit speed
-    // Finally prepare the block for stepper motor actuation
+    //    Move the last planned block forward if this block's entry speed is now final
+    // Finally walk forward again preparing blocks whose speeds (or jerk-limited junctions) have
+    // changed for stepper motor actuation
 
 #ifdef DEBUG_MOTIONPLANNER_DETAILED_INFO
     Log.notice("^^^^^^^^^^^^^^^^^^^^^^^BEFORE RECALC^^^^^^^^^^^^^^^^^^^^^^^^\n");
     motionPipeline.debugShowBlocks(axesParams);
 #endif
 
-    // Iterate the block queue in backwards time order stopping at the first block that has its recalculateFlag false
-    int blockIdx = 0;
-    int earliestBlockToReprocess = -1;
-    float previousBlockExitSpeed = 0;
+    // The block just added is unplanned - the oldest block's entry speed is final (it follows a block
+    // which has been executed) unless it is the only block
+    unsigned int pipelineCount = motionPipeline.count();
+    _numUnplannedBlocks = std::min(_numUnplannedBlocks + 1, std::max(pipelineCount - 1, 1u));
+    if (_reverseEntrySpeeds.size() < _numUnplannedBlocks)
+        _reverseEntrySpeeds.resize(_numUnplannedBlocks);
+    if (_blockNeedsPrepare.size() < _numUnplannedBlocks + 1)
+        _blockNeedsPrepare.resize(_numUnplannedBlocks + 1);
+
+    // Jerk-limited ramps are planned with a fraction of the max acceleration
+    float rampAcc = axesParams._masterAxisMaxAccMMps2;
+    if (_jerkLimited)
+        rampAcc *= MotionBlock::JERK_LIMITED_ACC_FACTOR;
+
+    // Iterate the unplanned blocks in backwards time order stopping if a block is already executing
+    unsigned int numBlocksToPlan = 0;
     float followingBlockEntrySpeed = 0;
-    MotionBlock *pBlock = NULL;
-    MotionBlock *pFollowingBlock = NULL;
-    while (true)
+    while (numBlocksToPlan < _numUnplannedBlocks)
     {
-        // Get the block at current index
-        pBlock = motionPipeline.peekNthFromPut(blockIdx);
-        if (pBlock == NULL)
+        MotionBlock *pBlock = motionPipeline.peekNthFromPut(numBlocksToPlan);
+        if ((pBlock == NULL) || (pBlock->isExecuting()))
             break;
 
-        // Stop if we don't need to recalculate beyond here or if this block is already executing
-        if (pBlock->_isExecuting)
-        {
-            // Get the exit speed from this executing block to use as the entry speed when going forwards
-            previousBlockExitSpeed = pBlock->_exitSpeedMMps;
-            break;
-        }
-
-        // If entry speed is already at the maximum entry speed then we can stop here as no further changes are
-        // going to be made by going back further
-        if (pBlock->_entrySpeedMMps == pBlock->_maxEntrySpeedMMps && blockIdx > 1)
-        {
-#ifdef DEBUG_MOTIONPLANNER_DETAILED_INFO
-            Log.notice("++++++++++++++++++++++++++++++ Optimizing block %d, prevSpeed %F\n", blockIdx, pBlock->_exitSpeedMMps);
-#endif
-            //Get the exit speed from this block to use as the entry speed when going forwards
-            previousBlockExitSpeed = pBlock->_exitSpeedMMps;
-            break;
-        }
+        // Max speed we can enter and still slow to the exit speed required
+        float maxEntrySpeed = MotionBlock::maxAchievableSpeed(rampAcc,
+                                                                followingBlockEntrySpeed, pBlock->_moveDistPrimaryAxesMM);
+        followingBlockEntrySpeed = fminf(maxEntrySpeed, pBlock->_maxEntrySpeedMMps);
+        _reverseEntrySpeeds[numBlocksToPlan] = followingBlockEntrySpeed;
+        numBlocksToPlan++;
+    }
 
-        // If there was a following block (remember we're working backwards) then now set the entry speed
-        if (pFollowingBlock)
+    // The last planned block (or executing block) provides the entry speed when going forwards
+    float previousBlockExitSpeed = 0;
+    MotionBlock *pPlannedBlock = motionPipeline.peekNthFromPut(numBlocksToPlan);
+    bool plannedBlockCanChange = pPlannedBlock && (numBlocksToPlan < pipelineCount) && !pPlannedBlock->isExecuting();
+    _blockNeedsPrepare[numBlocksToPlan] = false;
+    if (pPlannedBlock && (numBlocksToPlan < pipelineCount))
+    {
+        if (plannedBlockCanChange)
         {
-            // Assume for now that that whole block will be deceleration and calculate the max speed we can enter to be able to slow
-            // to the exit speed required
-            float maxEntrySpeed = MotionBlock::maxAchievableSpeed(axesParams._masterAxisMaxAccMMps2,
-                                                                    pFollowingBlock->_exitSpeedMMps, pFollowingBlock->_moveDistPrimaryAxesMM);
-            pFollowingBlock->_entrySpeedMMps = fminf(maxEntrySpeed, pFollowingBlock->_maxEntrySpeedMMps);
-
-            // Remember entry speed (to use as exit speed in the next loop)
-            followingBlockEntrySpeed = pFollowingBlock->_entrySpeedMMps;
+            // Entry speed is final but exit speed may increase
+            float maxExitSpeed = MotionBlock::maxAchievableSpeed(rampAcc,
+                                                        pPlannedBlock->_entrySpeedMMps, pPlannedBlock->_moveDistPrimaryAxesMM);
+            float exitSpeed = fminf(maxExitSpeed, numBlocksToPlan > 0 ? _reverseEntrySpeeds[numBlocksToPlan-1] : 0);
+            if (exitSpeed != pPlannedBlock->_exitSpeedMMps)
+            {
+                pPlannedBlock->_exitSpeedMMps = exitSpeed;
+                _blockNeedsPrepare[numBlocksToPlan] = true;
+            }
         }
-
-        // Remember the following block for the next pass
-        pFollowingBlock = pBlock;
-
-        // Set the block's exit speed to the entry speed of the block after this one
-        pBlock->_exitSpeedMMps = followingBlockEntrySpeed;
-
-        // Remember this as the earliest block to reprocess when going forwards
-        earliestBlockToReprocess = blockIdx;
-
-        // Next
-        blockIdx++;
+        previousBlockExitSpeed = pPlannedBlock->_exitSpeedMMps;
     }
 
-    // Now iterate in forward time order
-    for (blockIdx = earliestBlockToReprocess; blockIdx >= 0; blockIdx--)
+    // Now iterate in forward time order setting the speeds
+    unsigned int numUnplannedBlocks = numBlocksToPlan;
+    for (int blockIdx = numBlocksToPlan - 1; blockIdx >= 0; blockIdx--)
     {
         // Get the block to calculate for
-        pBlock = motionPipeline.peekNthFromPut(blockIdx);
+        MotionBlock *pBlock = motionPipeline.peekNthFromPut(blockIdx);
         if (!pBlock)
             break;
 
-        // Set the entry speed to the previous block exit speed
-        // if (pBlock->_entrySpeedMMps > previousBlockExitSpeed)
-        pBlock->_entrySpeedMMps = previousBlockExitSpeed;
+        // Entry speed is the previous block exit speed and the exit speed is the lower of the speed
+        // that can be reached by accelerating and the entry speed to the following block
+        float entrySpeed = previousBlockExitSpeed;
+        float maxExitSpeed = MotionBlock::maxAchievableSpeed(rampAcc,
+                                                        entrySpeed, pBlock->_moveDistPrimaryAxesMM);
+        float exitSpeed = fminf(maxExitSpeed, blockIdx > 0 ? _reverseEntrySpeeds[blockIdx-1] : 0);
 
-        // Calculate maximum speed possible for the block - based on acceleration at the best rate
-        float maxExitSpeed = pBlock->maxAchievableSpeed(axesParams._masterAxisMaxAccMMps2,
-                                                        pBlock->_entrySpeedMMps, pBlock->_moveDistPrimaryAxesMM);
-        pBlock->_exitSpeedMMps = fminf(maxExitSpeed, pBlock->_exitSpeedMMps);
+        // The block needs preparing for stepping if it is new or its speeds have changed
+        _blockNeedsPrepare[blockIdx] = (blockIdx == 0) || (entrySpeed != pBlock->_entrySpeedMMps) ||
+                                        (exitSpeed != pBlock->_exitSpeedMMps);
+        pBlock->_entrySpeedMMps = entrySpeed;
+        pBlock->_exitSpeedMMps = exitSpeed;
+
+        // Entry speed is final if at the maximum or if limited by acceleration from the previous block
+        if ((entrySpeed == pBlock->_maxEntrySpeedMMps) || (entrySpeed < _reverseEntrySpeeds[blockIdx]))
+            numUnplannedBlocks = blockIdx;
 
         // Remember for next block
-        previousBlockExitSpeed = pBlock->_exitSpeedMMps;
+        previousBlockExitSpeed = exitSpeed;
     }
+    _numUnplannedBlocks = numUnplannedBlocks;
 
-    // Recalculate acceleration and deceleration curves
-    for (blockIdx = earliestBlockToReprocess; blockIdx >= 0; blockIdx--)
+    // Prepare blocks for stepping (in forward time order as a jerk-limited block's ramps depend on
+    // those of the previous block)
+    unsigned int blocksPrepared = 0;
+    int firstBlockIdx = plannedBlockCanChange ? numBlocksToPlan : int(numBlocksToPlan) - 1;
+    for (int blockIdx = firstBlockIdx; blockIdx >= 0; blockIdx--)
     {
-        // Get the block to calculate for
-        pBlock = motionPipeline.peekNthFromPut(blockIdx);
+        MotionBlock *pBlock = motionPipeline.peekNthFromPut(blockIdx);
         if (!pBlock)
             break;
 
-        // Prepare this block for stepping
-        if (pBlock->prepareForStepping(axesParams, false))
+        // Ramps continue through the junction with the next block if both are accelerating or decelerating
+        // (an executing block's ramps can't change so the next block keeps continuing them)
+        int8_t exitAccDirn = pBlock->_exitAccDirn;
+        if (!pBlock->isExecuting())
+            exitAccDirn = _jerkLimited ? junctionAccDirn(motionPipeline, blockIdx, rampAcc, axesParams) : 0;
+        if (exitAccDirn != pBlock->_exitAccDirn)
         {
-            // Check if the block is part of a split block and has at least one more block following it
-            // in which case wait until at least two blocks are in the pipeline before locking down the
-            // first so that acceleration can be allowed to happen more smoothly
-            if ((!pBlock->_blockIsFollowed) || (motionPipeline.count() > 1))
-            {
-                // No more changes
-                pBlock->_canExecute = true;
-            }
+            pBlock->_exitAccDirn = exitAccDirn;
+            _blockNeedsPrepare[blockIdx] = true;
+        }
+        MotionBlock *pNextBlock = blockIdx > 0 ? motionPipeline.peekNthFromPut(blockIdx - 1) : NULL;
+        if (pNextBlock && (pNextBlock->_entryAccDirn != exitAccDirn))
+        {
+            pNextBlock->_entryAccDirn = exitAccDirn;
+            _blockNeedsPrepare[blockIdx - 1] = true;
+        }
+
+        if (_blockNeedsPrepare[blockIdx])
+        {
+            if (pBlock->prepareForStepping(axesParams, false, _jerkLimited))
+                blocksPrepared++;
+        }
+
+        // Check if the block is part of a split block and has at least one more block following it
+        // in which case wait until at least two blocks are in the pipeline before locking down the
+        // first so that acceleration can be allowed to happen more smoothly
+        if ((!pBlock->_blockIsFollowed) || (pipelineCount > 1))
+        {
+            // No more changes
+            pBlock->setCanExecute();
         }
     }
 
+    // Stats
+    _statsBlocksPreparedLast = blocksPrepared;
+    if (_statsBlocksPreparedMax < blocksPrepared)
+        _statsBlocksPreparedMax = blocksPrepared;
+    _statsBlocksPreparedTotal += blocksPrepared;
+    _statsBlocksAdded++;
+
 #ifdef DEBUG_MOTIONPLANNER_DETAILED_INFO
     Log.notice(".................AFTER RECALC.......................\n");
     motionPipeline.debugShowBlocks(axesParams);
@@ -322,13 +365,106 @@ void MotionPlanner::recalculatePipeline(MotionPipeline &motionPipeline, AxesPara
 #endif
 }
 
+// Direction of acceleration carried through the junction at the end of a block by jerk-limited ramps
+// 1 if the block accelerates all the way to the junction and the next block starts by accelerating,
+// -1 if the block ends by decelerating and the next decelerates all the way through, 0 otherwise -
+// speeds are limited to those of the max step rates (the blocks cruise above them) - accelerating
+// needs the junction speed to be final (so the ramps won't need to change once executing) but
+// decelerating doesn't as the speeds in a run of decelerating blocks are only final when the blocks
+// to follow are known (if the speeds increase once the block is executing the next block still
+// starts by decelerating - see MotionBlock::prepareRateUpdates)
+int8_t MotionPlanner::junctionAccDirn(MotionPipeline &motionPipeline, int blockIdx, float rampAcc, AxesParams &axesParams)
+{
+    if (blockIdx <= 0)
+        return 0;
+    MotionBlock *pBlock = motionPipeline.peekNthFromPut(blockIdx);
+    MotionBlock *pNextBlock = motionPipeline.peekNthFromPut(blockIdx - 1);
+    if (!pBlock || !pNextBlock)
+        return 0;
+    const float tolerance = 1e-5f;
+    float blockMaxSpeed = maxStepRateSpeed(*pBlock, axesParams);
+    float nextMaxSpeed = maxStepRateSpeed(*pNextBlock, axesParams);
+    float entrySpeed = fminf(pBlock->_entrySpeedMMps, blockMaxSpeed);
+    float exitSpeed = fminf(pBlock->_exitSpeedMMps, fminf(blockMaxSpeed, nextMaxSpeed));
+    float nextExitSpeed = fminf(pNextBlock->_exitSpeedMMps, nextMaxSpeed);
+
+    // Accelerating through the junction (the ramps either side must be able to carry the acceleration)
+    if ((exitSpeed > entrySpeed) &&
+            (exitSpeed >= MotionBlock::maxAchievableSpeed(rampAcc, entrySpeed, pBlock->_moveDistPrimaryAxesMM) * (1 - tolerance)))
+    {
+        // Next block's entry speed must be final (so this block's speeds are too)
+        if (unsigned(blockIdx - 1) < _numUnplannedBlocks)
+            return 0;
+        float nextPeakSpeed = fminf(peakSpeed(*pNextBlock, rampAcc), nextMaxSpeed);
+        if ((nextPeakSpeed > exitSpeed * (1 + tolerance)) &&
+                carriedRampOk(entrySpeed, exitSpeed, pBlock->_entryAccDirn > 0 ? 1 : 0, 1, rampAcc) &&
+                carriedRampOk(exitSpeed, nextPeakSpeed, 1, 0, rampAcc))
+            return 1;
+        return 0;
+    }
+
+    // Decelerating through the junction
+    if ((exitSpeed > nextExitSpeed) &&
+            (exitSpeed >= MotionBlock::maxAchievableSpeed(rampAcc, nextExitSpeed, pNextBlock->_moveDistPrimaryAxesMM) * (1 - tolerance)))
+    {
+        float blockPeakSpeed = fminf(peakSpeed(*pBlock, rampAcc), blockMaxSpeed);
+        if ((blockPeakSpeed > exitSpeed * (1 + tolerance)) &&
+                carriedRampOk(blockPeakSpeed, exitSpeed, pBlock->_entryAccDirn < 0 ? -1 : 0, -1, rampAcc) &&
+                carriedRampOk(exitSpeed, nextExitSpeed, -1, 0, rampAcc))
+            return -1;
+    }
+    return 0;
+}
+
+// Check a jerk-limited ramp between speeds can start and end with the acceleration in the directions given
+// (rates are updated each ms) - it must be a few updates long to shape the acceleration and is checked
+// against a lower peak acceleration than the ramp in the block to allow for rounding
+bool MotionPlanner::carriedRampOk(float startSpeed, float endSpeed, int startAccDirn, int endAccDirn, float rampAcc)
+{
+    double accPerUpdate = rampAcc / 1000.0;
+    double n = 0, a2 = 0, a3 = 0;
+    return MotionBlock::cubicRamp(startSpeed, endSpeed, fabs(endSpeed - startSpeed) / accPerUpdate,
+                startAccDirn * accPerUpdate, endAccDirn * accPerUpdate, accPerUpdate * CARRIED_RAMP_MAX_ACC_RATIO,
+                false, n, a2, a3) && (n >= MIN_CARRIED_RAMP_UPDATES);
+}
+
+// Speed of a block at the max step rate of its axis with most steps
+float MotionPlanner::maxStepRateSpeed(MotionBlock &block, AxesParams &axesParams)
+{
+    int axisIdx = block._pSteps->_axisIdxWithMaxSteps;
+    int32_t absMaxSteps = block.getAbsStepsToTarget(axisIdx);
+    if (absMaxSteps == 0)
+        return block._feedrate;
+    return axesParams.getMaxStepRatePerSec(axisIdx) * block._moveDistPrimaryAxesMM / absMaxSteps;
+}
+
+// Peak speed of a block accelerating from its entry speed and decelerating to its exit speed
+float MotionPlanner::peakSpeed(MotionBlock &block, float rampAcc)
+{
+    float entrySpeed = block._entrySpeedMMps;
+    float exitSpeed = block._exitSpeedMMps;
+    float peakSpeed = sqrtf((entrySpeed * entrySpeed + exitSpeed * exitSpeed) / 2 + rampAcc * block._moveDistPrimaryAxesMM);
+    return fminf(peakSpeed, block._feedrate);
+}
+
+String MotionPlanner::getDebugStr()
+{
+    char dbg[60];
+    sprintf(dbg, " PREP:%0.2f/%u", _statsBlocksAdded > 0 ? float(_statsBlocksPreparedTotal) / _statsBlocksAdded : 0.0f,
+                _statsBlocksPreparedMax);
+    return dbg;
+}
+
 // Entry point for adding a motion block for stepwise motion
 bool MotionPlanner::moveToStepwise(RobotCommandArgs &args,
                     AxisPosition &curAxisPositions,
                     AxesParams &axesParams, MotionPipeline &motionPipeline)
 {
-    // Create a block for this movement which will end up on the pipeline
-    MotionBlock block;
+    // Build the block for this movement in place at the put position of the pipeline
+    MotionBlock* pNewBlock = motionPipeline.reservePut();
+    if (!pNewBlock)
+        return false;
+    MotionBlock& block = *pNewBlock;
     block._entrySpeedMMps = 0;
     block._exitSpeedMMps = 0;
 
@@ -377,15 +513,16 @@ bool MotionPlanner::moveToStepwise(RobotCommandArgs &args,
     block._feedrate = minFeedrateStepsPerSec;
 
     // Prepare for stepping
-    if (block.prepareForStepping(axesParams, true))
+    if (block.prepareForStepping(axesParams, true, false))
     {
         // No more changes
-        block._canExecute = true;
+        block.setCanExecute();
     }
 
-    // Add the block
-    motionPipeline.add(block);
+    // Add the block - its speeds are final so earlier blocks don't need recalculating
+    motionPipeline.commitPut();
     _prevMotionBlockValid = true;
+    _numUnplannedBlocks = 0;
 
     // Return the change in actuator position
     for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
@@ -12,8 +12,11 @@
 #include "../AxisPosition.h"
 #include "../../RobotCommandArgs.h"
 #include "MotionPipeline.h"
+#include <vector>
+#include <functional>
 
-typedef bool (*ptToActuatorFnType)(AxisFloats &targetPt, AxisFloats &outActuator, AxisPosition &curPos, AxesParams &axesParams, bool allowOutOfBounds);
+// Point to actuator can be bound to a robot instance (for its kinematics settings)
+typedef std::function<bool(AxisFloats &targetPt, AxisFloats &outActuator, AxisPosition &curPos, AxesParams &axesParams, bool allowOutOfBounds)> ptToActuatorFnType;
 typedef void (*actuatorToPtFnType)(AxisInt32s &targetActuator, AxisFloats &outPt, AxisPosition &curPos, AxesParams &axesParams);
 typedef void (*correctStepOverflowFnType)(AxisPosition &curPos, AxesParams &axesParams);
 typedef void (*convertCoordsFnType)(RobotCommandArgs& cmdArgs, AxesParams &axesParams);
@@ -26,6 +29,8 @@ class MotionPlanner
     float _minimumPlannerSpeedMMps;
     // Junction deviation
     float _junctionDeviation;
+    // Jerk-limited (S-curve) acceleration instead of trapezoid
+    bool _jerkLimited;
 
     // Structure to store details on last processed block
     struct MotionBlockSequentialData
@@ -37,6 +42,23 @@ class MotionPlanner
     bool _prevMotionBlockValid;
     MotionBlockSequentialData _prevMotionBlock;
 
+    // Number of blocks (counting back from the put position) whose entry speed can still change
+    // The block before these has a final entry speed (it is either at its max entry speed or
+    // is limited by acceleration from a block before it) so recalculation doesn't go beyond it
+    unsigned int _numUnplannedBlocks;
+
+    // Entry speeds computed in the reverse pass of recalculatePipeline
+    std::vector<float> _reverseEntrySpeeds;
+
+    // Blocks (counting back from the put position) to prepare for stepping in recalculatePipeline
+    std::vector<bool> _blockNeedsPrepare;
+
+    // Stats on blocks prepared for stepping each time a block is added
+    unsigned int _statsBlocksPreparedLast;
+    unsigned int _statsBlocksPreparedMax;
+    uint32_t _statsBlocksPreparedTotal;
+    uint32_t _statsBlocksAdded;
+
   public:
     MotionPlanner()
     {
@@ -44,9 +66,12 @@ class MotionPlanner
         _minimumPlannerSpeedMMps = 0;
         // Configure the motion pipeline - these values will be changed in config
         _junctionDeviation = 0;
+        _jerkLimited = false;
+        _numUnplannedBlocks = 0;
+        statsClear();
     }
 
-    void configure(float junctionDeviation);
+    void configure(float junctionDeviation, int pipelineLen, bool jerkLimited);
 
     // Entry point for adding a motion block
     bool moveTo(RobotCommandArgs &args,
@@ -58,6 +83,33 @@ class MotionPlanner
 
     void recalculatePipeline(MotionPipeline &motionPipeline, AxesParams &axesParams);
 
+    // Stats - blocks prepared for stepping when the last block was added and average/max since stats cleared
+    unsigned int getBlocksPreparedLastAdd()
+    {
+        return _statsBlocksPreparedLast;
+    }
+    void statsClear()
+    {
+        _statsBlocksPreparedLast = 0;
+        _statsBlocksPreparedMax = 0;
+        _statsBlocksPreparedTotal = 0;
+        _statsBlocksAdded = 0;
+    }
+    String getDebugStr();
+
+  private:
+    int8_t junctionAccDirn(MotionPipeline &motionPipeline, int blockIdx, float rampAcc, AxesParams &axesParams);
+    static float maxStepRateSpeed(MotionBlock &block, AxesParams &axesParams);
+    static float peakSpeed(MotionBlock &block, float rampAcc);
+    static bool carriedRampOk(float startSpeed, float endSpeed, int startAccDirn, int endAccDirn, float rampAcc);
+
+    // Jerk-limited ramps carrying acceleration through a junction - min length in updates and max peak
+    // acceleration relative to the planning acceleration (a ramp in a block may peak at 1.5 times it)
+    static constexpr double MIN_CARRIED_RAMP_UPDATES = 3;
+    static constexpr double CARRIED_RAMP_MAX_ACC_RATIO = 1.4;
+
+  public:
+
     // Entry point for adding a motion block
     bool moveToStepwise(RobotCommandArgs &args,
                         AxisPosition &curAxisPositions,
@@ -0,0 +1,23 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Source of points which MotionHelper pulls (and splits into blocks) whenever the motion
+// pipeline has room - e.g. theta-rho interpolation or a pattern evaluator
+
+#pragma once
+
+#include "AxisValues.h"
+
+class MotionPointSource
+{
+public:
+    virtual ~MotionPointSource()
+    {
+    }
+
+    // Check if there are more points
+    virtual bool isBusy() = 0;
+
+    // Get the next point (in MM) - returns false if there are no more
+    virtual bool nextPoint(AxisFloats& pt) = 0;
+};
@@ -1,75 +1,81 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
 #pragma once
 
-// Generic interrupt-safe ring buffer pointer class
-// Each pointer is only updated by one source (ISR or main thread)
+#include <Arduino.h>
+#include <atomic>
+#include <vector>
+
+// Single-producer single-consumer ring buffer positions (e.g. main loop puts and the ISR gets)
+// The put and get counts run freely and are masked to index storage which is a power of two in
+// length - the count held is limited to the requested length so all slots can be used
+// The producer publishes a slot with a release store of the put count (after writing the slot)
+// and the consumer frees a slot with a release store of the get count (after reading the slot) -
+// each side reads the other's count with acquire so this is safe with the two sides on
+// different cores
 class MotionRingBufferPosn
 {
   public:
-    volatile unsigned int _putPos;
-    volatile unsigned int _getPos;
-    unsigned int _bufLen;
-
-    MotionRingBufferPosn(int maxLen)
+    MotionRingBufferPosn(unsigned int maxLen)
     {
         init(maxLen);
     }
 
-    void init(int maxLen)
+    // Length of storage (a power of two at least maxLen) required for the slot indices
+    void init(unsigned int maxLen)
     {
-        _bufLen = maxLen;
-        _putPos = 0;
-        _getPos = 0;
+        _maxLen = maxLen;
+        unsigned int storageLen = 1;
+        while (storageLen < maxLen)
+            storageLen <<= 1;
+        _mask = storageLen - 1;
+        clear();
+    }
+    unsigned int storageLen()
+    {
+        return _mask + 1;
     }
 
+    // Only valid when neither side is using the buffer
     void clear()
     {
-        _getPos = _putPos = 0;
+        _putCount.store(0, std::memory_order_relaxed);
+        _getCount.store(0, std::memory_order_release);
     }
+
+    // Producer
     bool canPut()
     {
-        if (_bufLen == 0)
-            return false;
-        if (_putPos == _getPos)
-            return true;
-        unsigned int gp = _getPos;
-        if (_putPos > gp)
-        {
-            if ((_putPos != _bufLen - 1) || (gp != 0))
-                return true;
-        }
-        else
-        {
-            if (gp - _putPos > 1)
-                return true;
-        }
-        return false;
+        return _putCount.load(std::memory_order_relaxed) - _getCount.load(std::memory_order_acquire) < _maxLen;
     }
-
-    bool IRAM_ATTR canGet()
+    unsigned int posToPut()
     {
-        return _putPos != _getPos;
+        return _putCount.load(std::memory_order_relaxed) & _mask;
     }
-
     void hasPut()
     {
-        _putPos++;
-        if (_putPos >= _bufLen)
-            _putPos = 0;
+        _putCount.store(_putCount.load(std::memory_order_relaxed) + 1, std::memory_order_release);
     }
 
+    // Consumer
+    bool IRAM_ATTR canGet()
+    {
+        return _putCount.load(std::memory_order_acquire) != _getCount.load(std::memory_order_relaxed);
+    }
+    unsigned int IRAM_ATTR posToGet()
+    {
+        return _getCount.load(std::memory_order_relaxed) & _mask;
+    }
     void IRAM_ATTR hasGot()
     {
-        _getPos++;
-        if (_getPos >= _bufLen)
-            _getPos = 0;
+        _getCount.store(_getCount.load(std::memory_order_relaxed) + 1, std::memory_order_release);
     }
 
-    unsigned int count()
+    unsigned int IRAM_ATTR count()
     {
-        unsigned int getPos = _getPos;
-        if (getPos <= _putPos)
-            return _putPos - getPos;
-        return _bufLen - getPos + _putPos;
+        uint32_t getCount = _getCount.load(std::memory_order_acquire);
+        return _putCount.load(std::memory_order_acquire) - getCount;
     }
 
     // Get Nth element prior to the put position
@@ -78,16 +84,10 @@ class MotionRingBufferPosn
     // Returns -1 if invalid
     int getNthFromPut(unsigned int N)
     {
-        if (!canGet())
-            return -1;
-        if (N >= _bufLen)
-            return -1;
-        int nthPos = _putPos - 1 - N;
-        if (nthPos < 0)
-            nthPos += _bufLen;
-        if (((unsigned int)(nthPos + 1) == _getPos) || ((unsigned int)(nthPos + 1) == _bufLen && _getPos == 0))
+        uint32_t putCount = _putCount.load(std::memory_order_relaxed);
+        if (N >= putCount - _getCount.load(std::memory_order_acquire))
             return -1;
-        return nthPos;
+        return (putCount - 1 - N) & _mask;
     }
 
     // Get Nth element from the get position
@@ -96,15 +96,74 @@ class MotionRingBufferPosn
     // returns -1 if invalid
     int getNthFromGet(unsigned int N)
     {
-        if (!canGet())
+        uint32_t getCount = _getCount.load(std::memory_order_acquire);
+        if (N >= _putCount.load(std::memory_order_acquire) - getCount)
             return -1;
-        if (N >= _bufLen)
-            return -1;
-        unsigned int nthPos = _getPos + N;
-        if (nthPos >= _bufLen)
-            nthPos -= _bufLen;
-        if (nthPos == _putPos)
-            return -1;
-        return nthPos;
+        return (getCount + N) & _mask;
+    }
+
+  private:
+    std::atomic<uint32_t> _putCount;
+    std::atomic<uint32_t> _getCount;
+    uint32_t _mask;
+    uint32_t _maxLen;
+};
+
+// Single-producer single-consumer ring buffer of elements
+template <typename T>
+class MotionRingBuffer
+{
+  public:
+    MotionRingBuffer(unsigned int maxLen) : _posn(maxLen)
+    {
+        _buffer.resize(_posn.storageLen());
     }
+
+    void init(unsigned int maxLen)
+    {
+        _posn.init(maxLen);
+        _buffer.resize(_posn.storageLen());
+    }
+
+    void clear()
+    {
+        _posn.clear();
+    }
+
+    unsigned int count()
+    {
+        return _posn.count();
+    }
+
+    bool canPut()
+    {
+        return _posn.canPut();
+    }
+
+    bool put(const T& elem)
+    {
+        if (!_posn.canPut())
+            return false;
+        _buffer[_posn.posToPut()] = elem;
+        _posn.hasPut();
+        return true;
+    }
+
+    bool IRAM_ATTR canGet()
+    {
+        return _posn.canGet();
+    }
+
+    bool IRAM_ATTR get(T& elem)
+    {
+        if (!_posn.canGet())
+            return false;
+        elem = _buffer[_posn.posToGet()];
+        _posn.hasGot();
+        return true;
+    }
+
+  private:
+    MotionRingBufferPosn _posn;
+    std::vector<T> _buffer;
 };
@@ -27,13 +27,13 @@ public:
             pinMode(_stepEnablePin, INPUT);
     }
 
-    bool configure(const char *robotConfigJSON)
+    bool configure(RdJsonDoc& robotGeomDoc)
     {
         // Get motor enable info
-        String stepEnablePinName = RdJson::getString("stepEnablePin", "-1", robotConfigJSON);
-        _stepEnLev = RdJson::getLong("stepEnLev", 1, robotConfigJSON);
+        String stepEnablePinName = robotGeomDoc.getString("stepEnablePin", "-1");
+        _stepEnLev = robotGeomDoc.getLong("stepEnLev", 1);
         _stepEnablePin = ConfigPinMap::getPinFromName(stepEnablePinName.c_str());
-        _stepDisableSecs = float(RdJson::getDouble("stepDisableSecs", stepDisableSecs_default, robotConfigJSON));
+        _stepDisableSecs = float(robotGeomDoc.getDouble("stepDisableSecs", stepDisableSecs_default));
         Log.notice("MotorEnabler: (pin %d, actLvl %d, disableAfter %Fs)\n", _stepEnablePin, _stepEnLev, _stepDisableSecs);
 
         // Enable pin - initially disable
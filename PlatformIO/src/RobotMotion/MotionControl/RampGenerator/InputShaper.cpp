@@ -0,0 +1,157 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+#include <ArduinoLog.h>
+#include <math.h>
+#include "InputShaper.h"
+#include "../MotionBlock.h"
+
+static const char* MODULE_PREFIX = "InputShaper: ";
+
+InputShaper::InputShaper()
+{
+    _shaperType = SHAPER_NONE;
+    _freqHz = 0;
+    _damping = 0;
+    _numImpulses = 0;
+    for (int i = 0; i < MAX_IMPULSES; i++)
+    {
+        _amplitudes[i] = 0;
+        _delayTicks[i] = 0;
+    }
+    _delayLine.resize(1);
+    _delayMask = 0;
+    reset();
+}
+
+InputShaper* InputShaper::createFromConfig(int axisIdx, RdJsonDoc& axisDoc)
+{
+    ShaperType shaperType = getTypeFromStr(axisDoc.getString("shaper", "").c_str());
+    if (shaperType == SHAPER_NONE)
+        return NULL;
+    double freqHz = axisDoc.getDouble("shaperHz", 0);
+    double damping = axisDoc.getDouble("shaperDamping", 0.1);
+    InputShaper* pShaper = new InputShaper();
+    if (!pShaper->setup(shaperType, freqHz, damping))
+    {
+        Log.warning("%sAxis%d invalid shaper %s freq %FHz damping %F\n", MODULE_PREFIX, axisIdx,
+                    getTypeStr(shaperType), freqHz, damping);
+        delete pShaper;
+        return NULL;
+    }
+    Log.notice("%sAxis%d %s\n", MODULE_PREFIX, axisIdx, pShaper->getInfoStr().c_str());
+    return pShaper;
+}
+
+// Impulses (amplitudes and times) as in the input shaping literature - K is the fraction of the
+// vibration amplitude remaining after half a damped period
+bool InputShaper::setup(ShaperType shaperType, double freqHz, double damping)
+{
+    _shaperType = SHAPER_NONE;
+    _numImpulses = 0;
+    if ((freqHz <= 0) || (damping < 0) || (damping >= 1))
+        return false;
+    double dampedPeriodSecs = 1 / (freqHz * sqrt(1 - damping * damping));
+    double K = exp(-damping * M_PI / sqrt(1 - damping * damping));
+    double amplitudes[MAX_IMPULSES] = { 1, 0, 0 };
+    double times[MAX_IMPULSES] = { 0, dampedPeriodSecs / 2, dampedPeriodSecs };
+    int numImpulses = 0;
+    switch (shaperType)
+    {
+        case SHAPER_ZV:
+            amplitudes[1] = K;
+            numImpulses = 2;
+            break;
+        case SHAPER_ZVD:
+            amplitudes[1] = 2 * K;
+            amplitudes[2] = K * K;
+            numImpulses = 3;
+            break;
+        case SHAPER_EI:
+            amplitudes[0] = 0.25 * (1 + EI_VIBRATION_TOLERANCE);
+            amplitudes[1] = 0.5 * (1 - EI_VIBRATION_TOLERANCE) * K;
+            amplitudes[2] = amplitudes[0] * K * K;
+            numImpulses = 3;
+            break;
+        default:
+            return false;
+    }
+    uint32_t durationTicks = uint32_t(lround(times[numImpulses - 1] * MotionBlock::TICKS_PER_SEC));
+    if (durationTicks > uint32_t(MAX_DURATION_SECS * MotionBlock::TICKS_PER_SEC))
+        return false;
+
+    // Fixed point amplitudes summing to exactly one step
+    double sum = 0;
+    for (int i = 0; i < numImpulses; i++)
+        sum += amplitudes[i];
+    uint32_t fixedSum = 0;
+    for (int i = 0; i < numImpulses; i++)
+    {
+        _amplitudes[i] = uint32_t(lround(amplitudes[i] / sum * AMPLITUDE_ONE));
+        _delayTicks[i] = uint32_t(lround(times[i] * MotionBlock::TICKS_PER_SEC));
+        fixedSum += _amplitudes[i];
+    }
+    _amplitudes[0] += AMPLITUDE_ONE - fixedSum;
+
+    // Delay line
+    uint32_t delayLen = 1;
+    while (delayLen <= durationTicks)
+        delayLen <<= 1;
+    _delayLine.assign(delayLen, 0);
+    _delayMask = delayLen - 1;
+    _shaperType = shaperType;
+    _freqHz = freqHz;
+    _damping = damping;
+    _numImpulses = numImpulses;
+    reset();
+    return true;
+}
+
+InputShaper::ShaperType InputShaper::getTypeFromStr(const char* typeStr)
+{
+    if (strcasecmp(typeStr, "ZV") == 0)
+        return SHAPER_ZV;
+    if (strcasecmp(typeStr, "ZVD") == 0)
+        return SHAPER_ZVD;
+    if (strcasecmp(typeStr, "EI") == 0)
+        return SHAPER_EI;
+    return SHAPER_NONE;
+}
+
+const char* InputShaper::getTypeStr(ShaperType shaperType)
+{
+    switch (shaperType)
+    {
+        case SHAPER_ZV: return "ZV";
+        case SHAPER_ZVD: return "ZVD";
+        case SHAPER_EI: return "EI";
+        default: return "none";
+    }
+}
+
+void InputShaper::reset()
+{
+    for (int8_t& step : _delayLine)
+        step = 0;
+    _writePos = 0;
+    _shapedLessOutput = 0;
+    _dirnFwd = true;
+    _holdOff = false;
+}
+
+double InputShaper::getCentroidTicks()
+{
+    double centroid = 0;
+    for (int i = 0; i < _numImpulses; i++)
+        centroid += double(_amplitudes[i]) * _delayTicks[i] / AMPLITUDE_ONE;
+    return centroid;
+}
+
+String InputShaper::getInfoStr()
+{
+    char infoStr[100];
+    snprintf(infoStr, sizeof(infoStr), "%s %.1fHz damping %.3f impulses %d duration %.1fms centroid %.1fms",
+                getTypeStr(_shaperType), _freqHz, _damping, _numImpulses,
+                getDurationTicks() / (MotionBlock::TICKS_PER_SEC / 1000), getCentroidTicks() / (MotionBlock::TICKS_PER_SEC / 1000));
+    return infoStr;
+}
@@ -0,0 +1,138 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Input shaper for a joint axis - the step stream for the axis (steps in actuator space so after
+// ptToActuator) is convolved with a few impulses (ZV, ZVD or EI shaper designed for the
+// resonant frequency and damping of the joint) so that the vibration each impulse excites is
+// cancelled by the later ones
+// Steps are fed in each ISR tick and shaped steps come out - the shaped position is the sum of
+// the delayed step streams weighted by the impulse amplitudes (which sum to one) so the output
+// ends on the same position as the input, delayed by at most the shaper duration
+// Axis JSON: "shaper":"ZV"|"ZVD"|"EI", "shaperHz": resonant frequency, "shaperDamping": ratio
+
+#pragma once
+
+#include <Arduino.h>
+#include <vector>
+#include "RdJsonDoc.h"
+
+class InputShaper
+{
+public:
+    enum ShaperType
+    {
+        SHAPER_NONE,
+        SHAPER_ZV,
+        SHAPER_ZVD,
+        SHAPER_EI
+    };
+
+    // Output for a tick - a direction change is output on its own tick before the next step
+    enum ShaperOutput
+    {
+        OUTPUT_NONE,
+        OUTPUT_DIRN,
+        OUTPUT_STEP
+    };
+
+    static const int MAX_IMPULSES = 3;
+    // Longest shaper (EI and ZVD last one period so this allows down to 5Hz) - the delay line is
+    // a byte per ISR tick rounded up to a power of two so at most 16KB per shaped axis
+    static constexpr double MAX_DURATION_SECS = 0.2;
+    // Amplitudes are fixed point with this many fractional bits (so a step is 1 << AMPLITUDE_BITS)
+    static const int AMPLITUDE_BITS = 16;
+    // Vibration tolerance of the EI shaper
+    static constexpr double EI_VIBRATION_TOLERANCE = 0.05;
+
+    InputShaper();
+
+    // Create a shaper from the axis config (NULL if the axis has no shaper or it is invalid)
+    static InputShaper* createFromConfig(int axisIdx, RdJsonDoc& axisDoc);
+
+    // Design the shaper - false if the type is unknown or the frequency/damping is out of range
+    bool setup(ShaperType shaperType, double freqHz, double damping);
+    static ShaperType getTypeFromStr(const char* typeStr);
+    static const char* getTypeStr(ShaperType shaperType);
+
+    // Clear steps in progress
+    void reset();
+
+    // Process one ISR tick - stepIn is the unshaped step on this tick (-1, 0 or 1) and if immediate
+    // it bypasses the shaper (for moves which check end-stops) - at most one step or direction
+    // change is output every other tick (so the step pulse can be ended on the tick between)
+    ShaperOutput IRAM_ATTR process(int stepIn, bool immediate)
+    {
+        // Shaped position change - the impulse with no delay reads the step just written
+        _delayLine[_writePos] = immediate ? 0 : int8_t(stepIn);
+        if (immediate)
+            _shapedLessOutput += stepIn * AMPLITUDE_ONE;
+        for (int i = 0; i < _numImpulses; i++)
+            _shapedLessOutput += int32_t(_amplitudes[i]) * _delayLine[(_writePos - _delayTicks[i]) & _delayMask];
+        _writePos = (_writePos + 1) & _delayMask;
+
+        // Step when the shaped position is more than half a step from the output position
+        if (_holdOff)
+        {
+            _holdOff = false;
+            return OUTPUT_NONE;
+        }
+        bool stepFwd = _shapedLessOutput >= AMPLITUDE_ONE / 2;
+        if (!stepFwd && (_shapedLessOutput >= -AMPLITUDE_ONE / 2))
+            return OUTPUT_NONE;
+        _holdOff = true;
+        if (stepFwd != _dirnFwd)
+        {
+            _dirnFwd = stepFwd;
+            return OUTPUT_DIRN;
+        }
+        _shapedLessOutput += stepFwd ? -AMPLITUDE_ONE : AMPLITUDE_ONE;
+        return OUTPUT_STEP;
+    }
+
+    // Direction of the last direction change output
+    bool isDirnFwd()
+    {
+        return _dirnFwd;
+    }
+
+    // Design
+    ShaperType getType()
+    {
+        return _shaperType;
+    }
+    double getFreqHz()
+    {
+        return _freqHz;
+    }
+    double getDamping()
+    {
+        return _damping;
+    }
+    uint32_t getDurationTicks()
+    {
+        return _numImpulses > 0 ? _delayTicks[_numImpulses - 1] : 0;
+    }
+    // Mean delay (the delay of the impulse amplitude centroid)
+    double getCentroidTicks();
+    String getInfoStr();
+
+private:
+    static const int32_t AMPLITUDE_ONE = 1 << AMPLITUDE_BITS;
+
+    ShaperType _shaperType;
+    double _freqHz;
+    double _damping;
+    int _numImpulses;
+    uint32_t _amplitudes[MAX_IMPULSES];
+    uint32_t _delayTicks[MAX_IMPULSES];
+
+    // Unshaped steps for the shaper duration (power of two length)
+    std::vector<int8_t> _delayLine;
+    uint32_t _delayMask;
+    uint32_t _writePos;
+
+    // Shaped position less the output position (fixed point)
+    int32_t _shapedLessOutput;
+    bool _dirnFwd;
+    bool _holdOff;
+};
@@ -12,14 +12,27 @@
 #define INSTRUMENT_MOTION_ACTUATOR_OUTPUT 1
 #define SystemTicksPerMicrosecond System.ticksPerMicrosecond()
 #define SystemTicks System.ticks()
-#else
+#elif defined(ESP32)
 //#define INSTRUMENT_MOTION_ACTUATOR_ENABLE    1
 //#define INSTRUMENT_MOTION_ACTUATOR_OUTPUT    1
 #include "xtensa/core-macros.h"
-#define SystemTicksPerMicrosecond XTHAL_GET_CCOUNT()
-#define SystemTicks (10000000)
+#define SystemTicksPerMicrosecond (F_CPU / 1000000)
+#define SystemTicks XTHAL_GET_CCOUNT()
+#elif defined(RAMPGEN_HOST_SIM)
+// Host simulation - always available (enabled at runtime with TIMEISR) and uses the CPU cycle counter
+#define INSTRUMENT_MOTION_ACTUATOR_ENABLE    1
+#define SystemTicksPerMicrosecond hostCyclesPerMicrosecond()
+#define SystemTicks hostCycleCount()
+#define INSTRUMENT_MOTION_ACTUATOR_CONFIG ""
+#else
+//#define INSTRUMENT_MOTION_ACTUATOR_ENABLE    1
+//#define INSTRUMENT_MOTION_ACTUATOR_OUTPUT    1
+#define SystemTicksPerMicrosecond 1
+#define SystemTicks micros()
 #endif
+#ifndef INSTRUMENT_MOTION_ACTUATOR_CONFIG
 #define INSTRUMENT_MOTION_ACTUATOR_CONFIG "TIMEISR BLINKD7"
+#endif
 
 #include <ArduinoLog.h>
 #include "../MotionRingBuffer.h"
@@ -56,7 +69,7 @@ static constexpr int INSTRUMENT_OUTPUT_STEPS = 1000;
 
 #else
 
-#define INSTRUMENT_MOTION_ACTUATOR_INSTANCE MotionInstrumentation *RampGenerator::_pMotionInstrumentation = NULL;
+#define INSTRUMENT_MOTION_ACTUATOR_INSTANCE
 #define INSTRUMENT_MOTION_ACTUATOR_TIME_START    \
     if (_pMotionInstrumentation)              \
     {                                      \
@@ -79,12 +92,10 @@ public:
             int _val : 1;
         };
     };
-    MotionRingBufferPosn _stepBufPos;
-    std::vector<TestOutputStepInf> _stepBuf;
+    MotionRingBuffer<TestOutputStepInf> _stepBuf;
 
-    InstrumentOutputStepData() : _stepBufPos(INSTRUMENT_OUTPUT_STEPS)
+    InstrumentOutputStepData() : _stepBuf(INSTRUMENT_OUTPUT_STEPS)
     {
-        _stepBuf.resize(INSTRUMENT_OUTPUT_STEPS);
     }
 
     void stepStart(int axisIdx)
@@ -106,33 +117,29 @@ public:
         // Ignore if it is a lowering of a step pin (to avoid end of test problem)
         if ((val == 0) && (pin == 17 || pin == 15))
             return;
-        if (_stepBufPos.canPut())
-        {
-            TestOutputStepInf newInf;
-            newInf._micros = micros();
-            newInf._pin = uint8_t(pin);
-            newInf._val = val;
-            _stepBuf[_stepBufPos._putPos] = newInf;
-            _stepBufPos.hasPut();
-        }
+        TestOutputStepInf newInf;
+        newInf._micros = micros();
+        newInf._pin = uint8_t(pin);
+        newInf._val = val;
+        _stepBuf.put(newInf);
     }
 
     TestOutputStepInf getStepInf()
     {
-        TestOutputStepInf inf = _stepBuf[_stepBufPos._getPos];
-        _stepBufPos.hasGot();
+        TestOutputStepInf inf;
+        _stepBuf.get(inf);
         return inf;
     }
 
     void process()
     {
-        // Log.trace("StepBuf getPos %d putPos %d count %d", _stepBufPos._getPos, _stepBufPos._putPos, _stepBufPos.count());
+        // Log.trace("StepBuf count %d", _stepBuf.count());
 
         // Get
         for (int i = 0; i < 5; i++)
         {
             // Check if can get
-            if (!_stepBufPos.canGet())
+            if (!_stepBuf.canGet())
             {
                 // Log.trace("Process can't get");
                 return;
@@ -155,7 +162,7 @@ public:
     uint32_t __isrDbgTickMin;
     uint32_t __isrDbgTickMax;
     uint32_t __isrDbgTickCount;
-    uint32_t __isrDbgTickSum;
+    uint64_t __isrDbgTickSum;
     uint32_t __startTicks;
 
     MotionInstrumentation()
@@ -176,7 +183,7 @@ public:
 #endif
     static uint32_t _testCount;
 
-    void setIntrumentationMode(const char *pTestModeStr)
+    void setInstrumentationMode(const char *pTestModeStr)
     {
         _blinkD7OnISR = false;
         if (strstr(pTestModeStr, "BLINKD7") != NULL)
@@ -187,7 +194,7 @@ public:
         _timeISR = false;
         if (strstr(pTestModeStr, "TIMEISR") != NULL)
             _timeISR = true;
-        Log.notice("MotionInstrumentation: blink %d, outputStepData %d, timeISR %d",
+        Log.notice("MotionInstrumentation: blink %d, outputStepData %d, timeISR %d\n",
                    _blinkD7OnISR, _outputStepData, _timeISR);
 #ifndef INSTRUMENT_MOTION_ACTUATOR_OUTPUT
         if (_outputStepData)
@@ -219,6 +226,8 @@ public:
 
     void blink()
     {
+        if (!_blinkD7OnISR)
+            return;
         uint32_t blinkRate = 10000;
         _testCount++;
         if (_testCount > blinkRate)
@@ -252,9 +261,8 @@ public:
 #ifdef USE_IRQ_CONTROL
             __enable_irq();
 #endif
+            // Unsigned subtraction handles wrap-around
             uint32_t elapsedTicks = endTicks - __startTicks;
-            if (__startTicks < endTicks)
-                elapsedTicks = 0xffffffff - __startTicks + endTicks;
             if (__isrDbgTickMin > elapsedTicks)
                 __isrDbgTickMin = elapsedTicks;
             if (__isrDbgTickMax < elapsedTicks)
@@ -291,7 +299,7 @@ public:
     String getDebugStr()
     {
         char strBuf[200];
-        sprintf(strBuf, "ISR Mn/Mx/Av/# %FuS/%FuS/%Fus/%d",
+        sprintf(strBuf, "ISR Mn/Mx/Av/# %0.3fuS/%0.3fuS/%0.3fuS/%u",
                 ((double)__isrDbgTickMin) / SystemTicksPerMicrosecond,
                 ((double)__isrDbgTickMax) / SystemTicksPerMicrosecond,
                 (__isrDbgTickCount != 0) ? ((double)(__isrDbgTickSum * 1.0 / __isrDbgTickCount) / SystemTicksPerMicrosecond) : 0,
@@ -306,7 +314,7 @@ public:
     void showDebug()
     {
 #ifdef INSTRUMENT_MOTION_ACTUATOR_ENABLE
-        Log.notice(getDebugStr().c_str());
+        Log.notice("%s\n", getDebugStr().c_str());
 #endif
     }
 };
@@ -0,0 +1,53 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Register level GPIO access for the stepping ISR - pins are handled as 64 bit masks
+// (bit N = GPIO N) so that the steps for several axes can be started or ended with a
+// single write and all endstops can be read at once. Host builds use the simulated
+// pin levels in the Arduino shim
+
+#pragma once
+
+#include <Arduino.h>
+#ifndef RAMPGEN_HOST_SIM
+#include "soc/gpio_struct.h"
+#endif
+
+class RampGenGPIO
+{
+public:
+    // Mask for a pin (0 if the pin isn't valid)
+    static inline uint64_t pinMask(int pin)
+    {
+        if ((pin < 0) || (pin >= 64))
+            return 0;
+        return 1ULL << pin;
+    }
+
+    // Read all inputs
+    static inline uint64_t IRAM_ATTR readInputs()
+    {
+#ifdef RAMPGEN_HOST_SIM
+        return hostReadPinLevels();
+#else
+        return GPIO.in | (uint64_t(GPIO.in1.val) << 32);
+#endif
+    }
+
+    // Set and clear outputs - pins in both masks end up cleared
+    static inline void IRAM_ATTR writeOutputs(uint64_t setMask, uint64_t clearMask)
+    {
+#ifdef RAMPGEN_HOST_SIM
+        hostWritePinLevels(setMask, clearMask);
+#else
+        if (uint32_t(setMask))
+            GPIO.out_w1ts = uint32_t(setMask);
+        if (setMask >> 32)
+            GPIO.out1_w1ts.val = uint32_t(setMask >> 32);
+        if (uint32_t(clearMask))
+            GPIO.out_w1tc = uint32_t(clearMask);
+        if (clearMask >> 32)
+            GPIO.out1_w1tc.val = uint32_t(clearMask >> 32);
+#endif
+    }
+};
@@ -2,6 +2,10 @@
 // Rob Dobson 2016-18
 
 #include "RampGenIO.h"
+
+// Host builds use the simulated implementation in RampGenIOSim.cpp
+#ifndef RAMPGEN_HOST_SIM
+
 #include <ESP32Servo.h>
 #include "AxisValues.h"
 #include "StepperMotor.h"
@@ -19,6 +23,7 @@ RampGenIO::RampGenIO()
         _servoMotors[i] = NULL;
         for (int j = 0; j < RobotConsts::MAX_ENDSTOPS_PER_AXIS; j++)
             _endStops[i][j] = NULL;
+        _inputShapers[i] = NULL;
     }
 }
 
@@ -43,37 +48,39 @@ void RampGenIO::deinit()
             delete _endStops[i][j];
             _endStops[i][j] = NULL;
         }
+        delete _inputShapers[i];
+        _inputShapers[i] = NULL;
     }
 }
 
-bool RampGenIO::configureAxis(int axisIdx, const char *axisJSON)
+bool RampGenIO::configureAxis(int axisIdx, RdJsonDoc& axisDoc)
 {
     if (axisIdx < 0 || axisIdx >= RobotConsts::MAX_AXES)
         return false;
 
     // Check the kind of motor to use
     bool isValid = false;
-    String stepPinName = RdJson::getString("stepPin", "-1", axisJSON, isValid);
+    String stepPinName = axisDoc.getString("stepPin", "-1", isValid);
     if (isValid)
     {
         // Create the stepper motor for the axis
         int stepPin = ConfigPinMap::getPinFromName(stepPinName.c_str());
-        String dirnPinName = RdJson::getString("dirnPin", "-1", axisJSON);
+        String dirnPinName = axisDoc.getString("dirnPin", "-1");
         int dirnPin = ConfigPinMap::getPinFromName(dirnPinName.c_str());
         int muxPin1 = -1, muxPin2 = -1, muxPin3 = -1, muxDirnIdx = 0;
         if (dirnPin == -1)
         {
             // Check for multiplexed pins
-            String muxName = RdJson::getString("muxPin1", "-1", axisJSON);
+            String muxName = axisDoc.getString("muxPin1", "-1");
             muxPin1 = ConfigPinMap::getPinFromName(muxName.c_str());
-            muxName = RdJson::getString("muxPin2", "-1", axisJSON);
+            muxName = axisDoc.getString("muxPin2", "-1");
             muxPin2 = ConfigPinMap::getPinFromName(muxName.c_str());
-            muxName = RdJson::getString("muxPin3", "-1", axisJSON);
+            muxName = axisDoc.getString("muxPin3", "-1");
             muxPin3 = ConfigPinMap::getPinFromName(muxName.c_str());
-            muxName = RdJson::getString("muxDirnIdx", "-1", axisJSON);
+            muxName = axisDoc.getString("muxDirnIdx", "-1");
             muxDirnIdx = ConfigPinMap::getPinFromName(muxName.c_str());
         }
-        bool directionReversed = (RdJson::getLong("dirnRev", 0, axisJSON) != 0);
+        bool directionReversed = (axisDoc.getLong("dirnRev", 0) != 0);
 
         // Debug
         if (dirnPin >= 0)
@@ -86,11 +93,15 @@ bool RampGenIO::configureAxis(int axisIdx, const char *axisJSON)
         if ((stepPin >= 0) && ((dirnPin >= 0) || (muxPin1 >= 0)))
             _stepperMotors[axisIdx] = new StepperMotor(RobotConsts::MOTOR_TYPE_DRIVER, stepPin, dirnPin, 
                                 muxPin1, muxPin2, muxPin3, muxDirnIdx, directionReversed);
+
+        // Input shaper
+        delete _inputShapers[axisIdx];
+        _inputShapers[axisIdx] = _stepperMotors[axisIdx] ? InputShaper::createFromConfig(axisIdx, axisDoc) : NULL;
     }
     else
     {
         // Create a servo motor for the axis
-        String servoPinName = RdJson::getString("servoPin", "-1", axisJSON);
+        String servoPinName = axisDoc.getString("servoPin", "-1");
         long servoPin = ConfigPinMap::getPinFromName(servoPinName.c_str());
         Log.notice("%sAxis%d (servo pin %d)\n", MODULE_PREFIX, axisIdx, servoPin);
         if ((servoPin != -1))
@@ -106,7 +117,7 @@ bool RampGenIO::configureAxis(int axisIdx, const char *axisJSON)
     {
         // Get the config for endstop if present
         String endStopIdStr = "endStop" + String(endStopIdx);
-        String endStopJSON = RdJson::getString(endStopIdStr.c_str(), "{}", axisJSON);
+        String endStopJSON = axisDoc.getString(endStopIdStr.c_str(), "{}");
         if (endStopJSON.length() == 0 || endStopJSON.equals("{}"))
             continue;
 
@@ -231,6 +242,9 @@ void RampGenIO::getRawMotionHwInfo(RobotConsts::RawMotionHwInfo_t &raw)
     {
         // Initialise
         raw._axis[axisIdx]._motorType = RobotConsts::MOTOR_TYPE_NONE;
+        raw._axis[axisIdx]._pinStep = -1;
+        raw._axis[axisIdx]._pinDirection = -1;
+        raw._axis[axisIdx]._dirnReversed = false;
         raw._axis[axisIdx]._pinEndStopMin = -1;
         raw._axis[axisIdx]._pinEndStopMinactLvl = 0;
         raw._axis[axisIdx]._pinEndStopMax = -1;
@@ -240,6 +254,8 @@ void RampGenIO::getRawMotionHwInfo(RobotConsts::RawMotionHwInfo_t &raw)
         if (_stepperMotors[axisIdx])
         {
             raw._axis[axisIdx]._motorType = _stepperMotors[axisIdx]->getMotorType();
+            _stepperMotors[axisIdx]->getPins(raw._axis[axisIdx]._pinStep, raw._axis[axisIdx]._pinDirection,
+                                            raw._axis[axisIdx]._dirnReversed);
         }
         // Min endstop
         if (_endStops[axisIdx][0])
@@ -277,4 +293,29 @@ bool IRAM_ATTR RampGenIO::stepEnd(int axisIdx)
     if (pStepper)
         return pStepper->stepEnd();
     return false;
-}
\ No newline at end of file
+}
+
+// Start steps on all pins in the mask
+void IRAM_ATTR RampGenIO::stepStartPins(uint64_t pinMask)
+{
+    RampGenGPIO::writeOutputs(pinMask, 0);
+}
+
+// End steps on all pins in the mask
+void IRAM_ATTR RampGenIO::stepEndPins(uint64_t pinMask)
+{
+    RampGenGPIO::writeOutputs(0, pinMask);
+}
+
+// Set direction pins
+void IRAM_ATTR RampGenIO::setDirectionPins(uint64_t setMask, uint64_t clearMask)
+{
+    RampGenGPIO::writeOutputs(setMask, clearMask);
+}
+
+uint64_t IRAM_ATTR RampGenIO::readInputPins()
+{
+    return RampGenGPIO::readInputs();
+}
+
+#endif // RAMPGEN_HOST_SIM
@@ -5,6 +5,13 @@
 
 #include <time.h>
 #include "RobotConsts.h"
+#include "RampGenGPIO.h"
+#include "RdJsonDoc.h"
+#include "InputShaper.h"
+#ifdef RAMPGEN_HOST_SIM
+#include <stdint.h>
+#include <vector>
+#endif
 
 #ifndef SPARK
 //#define BOUNDS_CHECK_ISR_FUNCTIONS    1
@@ -18,12 +25,29 @@ class AxisMinMaxBools;
 class RampGenIO
 {
 private:
+#ifdef RAMPGEN_HOST_SIM
+    // Simulated steppers - configured axes and current step/direction levels
+    bool _simStepperValid[RobotConsts::MAX_AXES];
+    int _simStepPin[RobotConsts::MAX_AXES];
+    int _simDirnPin[RobotConsts::MAX_AXES];
+    bool _simDirnReversed[RobotConsts::MAX_AXES];
+    bool _simStepActive[RobotConsts::MAX_AXES];
+    bool _simDirnLevel[RobotConsts::MAX_AXES];
+    uint32_t _simStepCount[RobotConsts::MAX_AXES];
+    // Virtual time in ISR ticks (each MotionBlock::TICK_INTERVAL_NS)
+    uint32_t _simTickCount;
+    // Recorded edges
+    bool _simRecordEdges;
+#else
     // Stepper motors
     StepperMotor* _stepperMotors[RobotConsts::MAX_AXES];
     // Servo motors
     Servo* _servoMotors[RobotConsts::MAX_AXES];
+#endif
     // End stops
     EndStop* _endStops[RobotConsts::MAX_AXES][RobotConsts::MAX_ENDSTOPS_PER_AXIS];
+    // Input shapers (NULL for axes which aren't shaped)
+    InputShaper* _inputShapers[RobotConsts::MAX_AXES];
 
 public:
     RampGenIO();
@@ -48,16 +72,68 @@ public:
     void getRawMotionHwInfo(RobotConsts::RawMotionHwInfo_t &raw);
 
     // Configure
-    bool configureAxis(int axisIdx, const char *axisJSON);
+    bool configureAxis(int axisIdx, RdJsonDoc& axisDoc);
 
     // Endstop status
     void getEndStopStatus(AxisMinMaxBools& axisEndStopVals);
 
+    // Input shaper for an axis (NULL if none)
+    InputShaper* getInputShaper(int axisIdx)
+    {
+        return _inputShapers[axisIdx];
+    }
+
     // Motor control
     void setDirection(int axisIdx, bool direction);
     void stepStart(int axisIdx);
     bool stepEnd(int axisIdx);
 
+    // Motor control using pin masks (see RampGenGPIO.h) - used by the ISR for all
+    // axes which have step and direction pins (multiplexed direction needs the above)
+    void stepStartPins(uint64_t pinMask);
+    void stepEndPins(uint64_t pinMask);
+    void setDirectionPins(uint64_t setMask, uint64_t clearMask);
+    uint64_t readInputPins();
+
+#ifdef RAMPGEN_HOST_SIM
+    // Simulated step/direction edge - recorded instead of driving GPIO
+    struct SimEdge
+    {
+        uint32_t tick;
+        uint8_t axisIdx;
+        bool isDirn;
+        bool level;
+    };
+
+    // Advance virtual time by one ISR tick
+    void simTick()
+    {
+        _simTickCount++;
+    }
+    uint32_t simGetTickCount()
+    {
+        return _simTickCount;
+    }
+    uint32_t simGetStepCount(int axisIdx)
+    {
+        return _simStepCount[axisIdx];
+    }
+    // Edge recording can be turned off for long throughput runs
+    void simSetRecordEdges(bool recordEdges)
+    {
+        _simRecordEdges = recordEdges;
+    }
+    std::vector<SimEdge>& simGetEdges()
+    {
+        return _simEdges;
+    }
+    void simClear();
+
+private:
+    std::vector<SimEdge> _simEdges;
+    void simAddEdge(int axisIdx, bool isDirn, bool level);
+#endif
+
 // private:
 
 //     // Check if a step is in progress on any motor, if all such and return true, else false
@@ -0,0 +1,227 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Simulated RampGenIO for host (native) builds - instead of driving GPIO every
+// step and direction edge is recorded against the virtual ISR tick count so that
+// the planner and ramp generator can be profiled and checked off-target
+
+#include "RampGenIO.h"
+
+#ifdef RAMPGEN_HOST_SIM
+
+#include "AxisValues.h"
+#include "EndStop.h"
+
+static const char* MODULE_PREFIX = "RampGenIOSim: ";
+
+RampGenIO::RampGenIO()
+{
+    // Clear axis specific values
+    for (int i = 0; i < RobotConsts::MAX_AXES; i++)
+    {
+        _simStepperValid[i] = false;
+        _simStepPin[i] = -1;
+        _simDirnPin[i] = -1;
+        _simDirnReversed[i] = false;
+        for (int j = 0; j < RobotConsts::MAX_ENDSTOPS_PER_AXIS; j++)
+            _endStops[i][j] = NULL;
+        _inputShapers[i] = NULL;
+    }
+    _simRecordEdges = true;
+    simClear();
+}
+
+RampGenIO::~RampGenIO()
+{
+    deinit();
+}
+
+void RampGenIO::deinit()
+{
+    // remove motors and end stops
+    for (int i = 0; i < RobotConsts::MAX_AXES; i++)
+    {
+        _simStepperValid[i] = false;
+        for (int j = 0; j < RobotConsts::MAX_ENDSTOPS_PER_AXIS; j++)
+        {
+            delete _endStops[i][j];
+            _endStops[i][j] = NULL;
+        }
+        delete _inputShapers[i];
+        _inputShapers[i] = NULL;
+    }
+}
+
+void RampGenIO::simClear()
+{
+    for (int i = 0; i < RobotConsts::MAX_AXES; i++)
+    {
+        _simStepActive[i] = false;
+        _simDirnLevel[i] = false;
+        _simStepCount[i] = 0;
+    }
+    _simTickCount = 0;
+    _simEdges.clear();
+}
+
+bool RampGenIO::configureAxis(int axisIdx, RdJsonDoc& axisDoc)
+{
+    if (axisIdx < 0 || axisIdx >= RobotConsts::MAX_AXES)
+        return false;
+
+    // Only step/direction axes are simulated
+    bool isValid = false;
+    String stepPinName = axisDoc.getString("stepPin", "-1", isValid);
+    _simStepPin[axisIdx] = isValid ? ConfigPinMap::getPinFromName(stepPinName.c_str()) : -1;
+    _simStepperValid[axisIdx] = _simStepPin[axisIdx] >= 0;
+    String dirnPinName = axisDoc.getString("dirnPin", "-1");
+    _simDirnPin[axisIdx] = ConfigPinMap::getPinFromName(dirnPinName.c_str());
+    _simDirnReversed[axisIdx] = (axisDoc.getLong("dirnRev", 0) != 0);
+    Log.notice("%sAxis%d simulated stepper %s\n", MODULE_PREFIX, axisIdx, _simStepperValid[axisIdx] ? "Y" : "N");
+
+    // Input shaper
+    delete _inputShapers[axisIdx];
+    _inputShapers[axisIdx] = _simStepperValid[axisIdx] ? InputShaper::createFromConfig(axisIdx, axisDoc) : NULL;
+
+    // End stops use the host's simulated pins
+    for (int endStopIdx = 0; endStopIdx < RobotConsts::MAX_ENDSTOPS_PER_AXIS; endStopIdx++)
+    {
+        // Get the config for endstop if present
+        String endStopIdStr = "endStop" + String(endStopIdx);
+        String endStopJSON = axisDoc.getString(endStopIdStr.c_str(), "{}");
+        if (endStopJSON.length() == 0 || endStopJSON.equals("{}"))
+            continue;
+
+        // Create endStop from JSON
+        _endStops[axisIdx][endStopIdx] = new EndStop(axisIdx, endStopIdx, endStopJSON.c_str());
+    }
+
+    return true;
+}
+
+void RampGenIO::getEndStopStatus(AxisMinMaxBools& axisEndStopVals)
+{
+    for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+    {
+        for (int endStopIdx = 0; endStopIdx < RobotConsts::MAX_ENDSTOPS_PER_AXIS; endStopIdx++)
+        {
+            AxisMinMaxBools::AxisMinMaxEnum endStopEnum = AxisMinMaxBools::END_STOP_NONE;
+            if (_endStops[axisIdx][endStopIdx])
+            {
+                if (_endStops[axisIdx][endStopIdx]->isAtEndStop())
+                    endStopEnum = AxisMinMaxBools::END_STOP_HIT;
+                else
+                    endStopEnum = AxisMinMaxBools::END_STOP_NOT_HIT;
+            }
+            axisEndStopVals.set(axisIdx, endStopIdx, endStopEnum);
+        }
+    }
+}
+
+void RampGenIO::service()
+{
+}
+
+void RampGenIO::getRawMotionHwInfo(RobotConsts::RawMotionHwInfo_t &raw)
+{
+    for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+    {
+        raw._axis[axisIdx]._motorType = _simStepperValid[axisIdx] ?
+                    RobotConsts::MOTOR_TYPE_DRIVER : RobotConsts::MOTOR_TYPE_NONE;
+        raw._axis[axisIdx]._pinStep = _simStepperValid[axisIdx] ? _simStepPin[axisIdx] : -1;
+        raw._axis[axisIdx]._pinDirection = _simStepperValid[axisIdx] ? _simDirnPin[axisIdx] : -1;
+        raw._axis[axisIdx]._dirnReversed = _simDirnReversed[axisIdx];
+        raw._axis[axisIdx]._pinEndStopMin = -1;
+        raw._axis[axisIdx]._pinEndStopMinactLvl = 0;
+        raw._axis[axisIdx]._pinEndStopMax = -1;
+        raw._axis[axisIdx]._pinEndStopMaxactLvl = 0;
+        if (_endStops[axisIdx][0])
+            _endStops[axisIdx][0]->getPins(raw._axis[axisIdx]._pinEndStopMin,
+                                            raw._axis[axisIdx]._pinEndStopMinactLvl);
+        if (_endStops[axisIdx][1])
+            _endStops[axisIdx][1]->getPins(raw._axis[axisIdx]._pinEndStopMax,
+                                            raw._axis[axisIdx]._pinEndStopMaxactLvl);
+    }
+}
+
+void RampGenIO::simAddEdge(int axisIdx, bool isDirn, bool level)
+{
+    if (!_simRecordEdges)
+        return;
+    SimEdge edge;
+    edge.tick = _simTickCount;
+    edge.axisIdx = axisIdx;
+    edge.isDirn = isDirn;
+    edge.level = level;
+    _simEdges.push_back(edge);
+}
+
+// Set axis direction - only changes of level are edges
+void RampGenIO::setDirection(int axisIdx, bool direction)
+{
+    if (!_simStepperValid[axisIdx] || (_simDirnLevel[axisIdx] == direction))
+        return;
+    _simDirnLevel[axisIdx] = direction;
+    simAddEdge(axisIdx, true, direction);
+}
+
+void RampGenIO::stepStart(int axisIdx)
+{
+    if (!_simStepperValid[axisIdx])
+        return;
+    _simStepActive[axisIdx] = true;
+    _simStepCount[axisIdx]++;
+    simAddEdge(axisIdx, false, true);
+}
+
+bool RampGenIO::stepEnd(int axisIdx)
+{
+    if (!_simStepActive[axisIdx])
+        return false;
+    _simStepActive[axisIdx] = false;
+    simAddEdge(axisIdx, false, false);
+    return true;
+}
+
+// Pin mask versions - the simulated pin levels are updated and edges are recorded
+// for each axis whose pins are in the masks
+void RampGenIO::stepStartPins(uint64_t pinMask)
+{
+    RampGenGPIO::writeOutputs(pinMask, 0);
+    for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+    {
+        if (_simStepperValid[axisIdx] && (pinMask & RampGenGPIO::pinMask(_simStepPin[axisIdx])))
+            stepStart(axisIdx);
+    }
+}
+
+void RampGenIO::stepEndPins(uint64_t pinMask)
+{
+    RampGenGPIO::writeOutputs(0, pinMask);
+    for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+    {
+        if (_simStepperValid[axisIdx] && (pinMask & RampGenGPIO::pinMask(_simStepPin[axisIdx])))
+            stepEnd(axisIdx);
+    }
+}
+
+// Edges are recorded as the direction (not the pin level) as for setDirection()
+void RampGenIO::setDirectionPins(uint64_t setMask, uint64_t clearMask)
+{
+    RampGenGPIO::writeOutputs(setMask, clearMask);
+    for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+    {
+        uint64_t dirnPinMask = RampGenGPIO::pinMask(_simDirnPin[axisIdx]);
+        if (!_simStepperValid[axisIdx] || !((setMask | clearMask) & dirnPinMask))
+            continue;
+        bool pinLevel = (RampGenGPIO::readInputs() & dirnPinMask) != 0;
+        setDirection(axisIdx, _simDirnReversed[axisIdx] ? pinLevel : !pinLevel);
+    }
+}
+
+uint64_t RampGenIO::readInputPins()
+{
+    return RampGenGPIO::readInputs();
+}
+
+#endif // RAMPGEN_HOST_SIM
@@ -53,12 +53,44 @@ RampGenerator::RampGenerator(MotionPipeline* pMotionPipeline)
     _isEnabled = false;
     _curStepRatePerTTicks = 0;
     _curAccumulatorStep = 0;
-    _curAccumulatorNS = 0;
-    _endStopCheckNum = 0;
+    _ticksToRateUpdate = MotionBlock::TICKS_PER_RATE_UPDATE;
+    _rateUpdatesLeft = 0;
+    _rateIncPerUpdate = 0;
+    _decelStartStepCount = 0;
+    _rampJerkLimited = false;
+    _rampDecelerating = false;
+    _rampDecelPending = false;
+    _pBlockRamps = NULL;
+    _rampRateFixed = 0;
+    for (int i = 0; i < 3; i++)
+        _rampRateDiffs[i] = 0;
+    _rampEndRatePerTTicks = 0;
+    for (int i = 0; i < RobotConsts::MAX_AXES; i++)
+    {
+        _axisStepPinMask[i] = 0;
+        _axisDirnPinMask[i] = 0;
+        _axisDirnReversed[i] = false;
+    }
+    _endStopPinMask = 0;
+    _endStopHitLevels = 0;
+    _stepPinsActive = 0;
+    _stepAxesActive = 0;
+    _axisShapedMask = 0;
+    for (int i = 0; i < RobotConsts::MAX_AXES; i++)
+    {
+        _pInputShapers[i] = NULL;
+        _shaperStepIn[i] = 0;
+    }
+    _shapedStepsActive = 0;
+    _shaperBypass = false;
     _isrTimerStarted = false;
+#ifdef RAMPGEN_HOST_SIM
+    _simRecordRates = false;
+    _simBlockAccStepsPerTTicksPerMS = 0;
+#endif
     _rampGenEnabled = false;
 
-#ifdef TEST_MOTION_ACTUATOR_ENABLE
+#ifdef INSTRUMENT_MOTION_ACTUATOR_ENABLE
     _pMotionInstrumentation = NULL;
 #endif
     resetTotalStepPosition();
@@ -72,13 +104,19 @@ RampGenerator::RampGenerator(MotionPipeline* pMotionPipeline)
 void RampGenerator::setInstrumentationMode(const char *testModeStr)
 {
 #ifdef INSTRUMENT_MOTION_ACTUATOR_ENABLE
-    _pMotionInstrumentation = new MotionInstrumentation();
+    if (!_pMotionInstrumentation)
+        _pMotionInstrumentation = new MotionInstrumentation();
     _pMotionInstrumentation->setInstrumentationMode(testModeStr);
 #endif
 }
 
 void RampGenerator::deinit()
 {
+    // Stop using the input shapers (they are deleted when the axes are reconfigured)
+    _axisShapedMask = 0;
+    for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+        _pInputShapers[axisIdx] = NULL;
+
 #ifdef USE_ESP32_TIMER_ISR
     if (_isrTimerStarted)
     {
@@ -93,6 +131,32 @@ void RampGenerator::configure(bool rampGenEnabled)
     // Cache axis and endstop info
     _rampGenIO.getRawMotionHwInfo(_rawMotionHwInfo);
 
+    // Pin masks for axes which can be stepped with register writes
+    for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+    {
+        RobotConsts::RawMotionAxis_t& axisInfo = _rawMotionHwInfo._axis[axisIdx];
+        bool useMasks = (axisInfo._motorType == RobotConsts::MOTOR_TYPE_DRIVER) && (axisInfo._pinDirection >= 0);
+        _axisStepPinMask[axisIdx] = useMasks ? RampGenGPIO::pinMask(axisInfo._pinStep) : 0;
+        _axisDirnPinMask[axisIdx] = useMasks ? RampGenGPIO::pinMask(axisInfo._pinDirection) : 0;
+        _axisDirnReversed[axisIdx] = axisInfo._dirnReversed;
+    }
+
+    // Input shapers
+    _axisShapedMask = 0;
+    for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+    {
+        _shaperStepIn[axisIdx] = 0;
+        _pInputShapers[axisIdx] = _rampGenIO.getInputShaper(axisIdx);
+        if (!_pInputShapers[axisIdx])
+            continue;
+        _pInputShapers[axisIdx]->reset();
+        _rampGenIO.setDirection(axisIdx, _pInputShapers[axisIdx]->isDirnFwd());
+        _axisStepPinMask[axisIdx] = 0;
+        _axisDirnPinMask[axisIdx] = 0;
+        _axisShapedMask |= (1 << axisIdx);
+    }
+    _shapedStepsActive = 0;
+
     // TODO check we don't need this...
 
     // // Give the RampGenerator access to raw motionIO info
@@ -122,11 +186,13 @@ void RampGenerator::stop()
 {
     _isPaused = true;
     _endStopReached = false;
+    _pipelineStats.motionInterrupted();
 }
 
 void RampGenerator::pause(bool pauseIt)
 {
     _isPaused = pauseIt;
+    _pipelineStats.motionInterrupted();
     if (!_isPaused)
     {
         _endStopReached = false;
@@ -171,24 +237,34 @@ int RampGenerator::getLastCompletedNumberedCmdIdx()
 // Handle the end of a step for any axis
 bool IRAM_ATTR RampGenerator::handleStepEnd()
 {
-    bool anyPinReset = false;
+    if (!_stepAxesActive)
+        return false;
+
+    // End all steps started with pin masks in one write
+    if (_stepPinsActive)
+        _rampGenIO.stepEndPins(_stepPinsActive);
     for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
     {
-        if (_rampGenIO.stepEnd(axisIdx))
-        {
-            anyPinReset = true;
-            _axisTotalSteps[axisIdx] += _totalStepsInc[axisIdx];
-        }
+        if (!(_stepAxesActive & (1 << axisIdx)))
+            continue;
+        if (!_axisStepPinMask[axisIdx] && !(_axisShapedMask & (1 << axisIdx)))
+            _rampGenIO.stepEnd(axisIdx);
+        _axisTotalSteps[axisIdx] += _totalStepsInc[axisIdx];
     }
-    return anyPinReset;
+    _stepPinsActive = 0;
+    _stepAxesActive = 0;
+    return true;
 }
 
 // Setup new block - cache all the info needed to process the block and reset
 // motion accumulators to facilitate the block's execution
-void IRAM_ATTR RampGenerator::setupNewBlock(MotionBlock *pBlock)
+void IRAM_ATTR RampGenerator::setupNewBlock(MotionBlockSteps *pBlock)
 {
     // Setup step counts, direction and endstops for each axis
-    _endStopCheckNum = 0;
+    uint64_t dirnSetMask = 0;
+    uint64_t dirnClearMask = 0;
+    _endStopPinMask = 0;
+    _endStopHitLevels = 0;
     for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
     {
         // Total steps
@@ -196,8 +272,19 @@ void IRAM_ATTR RampGenerator::setupNewBlock(MotionBlock *pBlock)
         _stepsTotalAbs[axisIdx] = abs(stepsTotal);
         _curStepCount[axisIdx] = 0;
         _curAccumulatorRelative[axisIdx] = 0;
-        // Set direction for the axis
-        _rampGenIO.setDirection(axisIdx, stepsTotal >= 0);
+        // Set direction for the axis (the pin is high when direction matches dirnRev) - the input
+        // shaper sets the direction of shaped axes
+        if (_axisDirnPinMask[axisIdx])
+        {
+            if ((stepsTotal >= 0) == _axisDirnReversed[axisIdx])
+                dirnSetMask |= _axisDirnPinMask[axisIdx];
+            else
+                dirnClearMask |= _axisDirnPinMask[axisIdx];
+        }
+        else if (!(_axisShapedMask & (1 << axisIdx)))
+        {
+            _rampGenIO.setDirection(axisIdx, stepsTotal >= 0);
+        }
         _totalStepsInc[axisIdx] = (stepsTotal >= 0) ? 1 : -1;
 
         // Instrumentation
@@ -210,9 +297,6 @@ void IRAM_ATTR RampGenerator::setupNewBlock(MotionBlock *pBlock)
         // Check if the axis is moving in a direction which might result in hitting an active end-stop
         for (int minMaxIdx = 0; minMaxIdx < AxisMinMaxBools::ENDSTOPS_PER_AXIS; minMaxIdx++)
         {
-            int pinToTest = -1;
-            bool valToTestFor = false;
-
             // See if anything to check for
             AxisMinMaxBools::AxisMinMaxEnum minMaxType = pBlock->_endStopsToCheck.get(axisIdx, minMaxIdx);
             if (minMaxType == AxisMinMaxBools::END_STOP_NONE)
@@ -230,60 +314,178 @@ void IRAM_ATTR RampGenerator::setupNewBlock(MotionBlock *pBlock)
             }
             
             // Pin for stop
-            pinToTest = (minMaxIdx == AxisMinMaxBools::MIN_VAL_IDX) ? 
+            bool isMin = (minMaxIdx == AxisMinMaxBools::MIN_VAL_IDX);
+            uint64_t pinMask = RampGenGPIO::pinMask(isMin ? 
                                 _rawMotionHwInfo._axis[axisIdx]._pinEndStopMin : 
-                                _rawMotionHwInfo._axis[axisIdx]._pinEndStopMax;
+                                _rawMotionHwInfo._axis[axisIdx]._pinEndStopMax);
+            bool actLvl = isMin ? 
+                                _rawMotionHwInfo._axis[axisIdx]._pinEndStopMinactLvl :
+                                _rawMotionHwInfo._axis[axisIdx]._pinEndStopMaxactLvl;
 
             // Endstop test
-            valToTestFor = (minMaxType != AxisMinMaxBools::END_STOP_NOT_HIT) ? 
-                                _rawMotionHwInfo._axis[axisIdx]._pinEndStopMaxactLvl :
-                                !_rawMotionHwInfo._axis[axisIdx]._pinEndStopMaxactLvl;
-            if (pinToTest != -1)
-            {
-                _endStopChecks[_endStopCheckNum].pin = pinToTest;
-                _endStopChecks[_endStopCheckNum].val = valToTestFor;
-                _endStopCheckNum++;
-            }
+            bool valToTestFor = (minMaxType != AxisMinMaxBools::END_STOP_NOT_HIT) ? actLvl : !actLvl;
+            _endStopPinMask |= pinMask;
+            if (valToTestFor)
+                _endStopHitLevels |= pinMask;
         }
     }
 
+    // Set directions with a single write
+    if (dirnSetMask | dirnClearMask)
+        _rampGenIO.setDirectionPins(dirnSetMask, dirnClearMask);
+    _shaperBypass = (_endStopPinMask != 0);
+
     // Accumulator reset
     _curAccumulatorStep = 0;
-    _curAccumulatorNS = 0;
+    _ticksToRateUpdate = MotionBlock::TICKS_PER_RATE_UPDATE;
 
-    // Step rate
+    // Step rate and acceleration from the precomputed profile
     _curStepRatePerTTicks = pBlock->_initialStepRatePerTTicks;
+    _rateUpdatesLeft = pBlock->_accelRateUpdates;
+    _rateIncPerUpdate = pBlock->_accStepsPerTTicksPerMS;
+    _decelStartStepCount = pBlock->_stepsBeforeDecel + 1;
+    _rampJerkLimited = pBlock->_jerkLimited;
+    _rampDecelPending = false;
+    if (_rampJerkLimited)
+    {
+        // The ramps are at the same pipeline position as the stepping values
+        _pBlockRamps = _pMotionPipeline->peekGetRamps();
+        _rateUpdatesLeft = _pBlockRamps->_accelRampUpdates;
+        startJerkLimitedRamp(_pBlockRamps->_accelRateDiffs, _pBlockRamps->_accelEndRatePerTTicks, false);
+
+        // A block decelerating from the start (such as one continuing deceleration from the previous
+        // block) starts the ramp now rather than on its first step (which would hold the rate for a
+        // step interval)
+        if (pBlock->_stepsBeforeDecel == 0)
+        {
+            _decelStartStepCount = 0;
+            startDecel(pBlock);
+        }
+    }
+}
+
+// Start a jerk-limited ramp from the current rate
+void IRAM_ATTR RampGenerator::startJerkLimitedRamp(const int64_t rateDiffs[3], uint32_t endRatePerTTicks, bool decelerating)
+{
+    _rampRateFixed = int64_t(_curStepRatePerTTicks) << MotionBlock::RATE_DIFF_FRAC_BITS;
+    _rampRateDiffs[0] = rateDiffs[0];
+    _rampRateDiffs[1] = rateDiffs[1];
+    _rampRateDiffs[2] = rateDiffs[2];
+    _rampEndRatePerTTicks = endRatePerTTicks;
+    _rampDecelerating = decelerating;
+}
+
+// Switch to the deceleration part of the profile
+void IRAM_ATTR RampGenerator::startDecel(MotionBlockSteps *pBlock)
+{
+    if (_rampJerkLimited)
+    {
+        // Deceleration starts when acceleration has finished (so there is no step in acceleration
+        // and the ramp starts from its planned rate)
+        if (!_rampDecelerating && (_rateUpdatesLeft != 0))
+        {
+            _rampDecelPending = true;
+            return;
+        }
+        bool aboveEndRate = _curStepRatePerTTicks > _pBlockRamps->_decelEndRatePerTTicks;
+        _rateUpdatesLeft = aboveEndRate ? _pBlockRamps->_decelRampUpdates : 0;
+        startJerkLimitedRamp(_pBlockRamps->_decelRateDiffs, _pBlockRamps->_decelEndRatePerTTicks, true);
+        return;
+    }
+    int32_t decelUpdates = int32_t(pBlock->_accelRateUpdates - _rateUpdatesLeft) + pBlock->_decelRateUpdatesAdj;
+    _rateUpdatesLeft = decelUpdates > 0 ? decelUpdates : 0;
+    _rateIncPerUpdate = 0 - pBlock->_accStepsPerTTicksPerMS;
 }
 
 // Update millisecond accumulator to handle acceleration and deceleration
-void IRAM_ATTR RampGenerator::updateMSAccumulator(MotionBlock *pBlock)
+void IRAM_ATTR RampGenerator::updateMSAccumulator()
 {
-    // Bump the millisec accumulator
-    _curAccumulatorNS += MotionBlock::TICK_INTERVAL_NS;
+    // Count down to the next rate update
+    if (--_ticksToRateUpdate != 0)
+        return;
+    _ticksToRateUpdate = MotionBlock::TICKS_PER_RATE_UPDATE;
+
+    // Apply the next rate change from the profile
+    if (_rateUpdatesLeft != 0)
+    {
+        if (_rampJerkLimited)
+        {
+            updateJerkLimitedRate();
+            return;
+        }
+        _curStepRatePerTTicks += _rateIncPerUpdate;
+        _rateUpdatesLeft--;
+    }
+}
+
+// Next rate on a jerk-limited ramp - three adds then a check for the end of the ramp
+void IRAM_ATTR RampGenerator::updateJerkLimitedRate()
+{
+    _rampRateFixed += _rampRateDiffs[0];
+    _rampRateDiffs[0] += _rampRateDiffs[1];
+    _rampRateDiffs[1] += _rampRateDiffs[2];
+    _rateUpdatesLeft--;
+    uint32_t rate = uint32_t(_rampRateFixed >> MotionBlock::RATE_DIFF_FRAC_BITS);
+    bool rampEnded = (_rateUpdatesLeft == 0) ||
+                (_rampDecelerating ? (rate <= _rampEndRatePerTTicks) : (rate >= _rampEndRatePerTTicks));
+    if (rampEnded)
+    {
+        _curStepRatePerTTicks = _rampEndRatePerTTicks;
+        _rateUpdatesLeft = 0;
+        if (_rampDecelPending)
+        {
+            _rampDecelPending = false;
+            startDecel(_pMotionPipeline->peekGetSteps());
+        }
+        return;
+    }
+    _curStepRatePerTTicks = rate;
+}
 
-    // Check for millisec accumulator overflow
-    if (_curAccumulatorNS >= MotionBlock::NS_IN_A_MS)
+// Record a step on an axis - steps on axes with pin masks are started together at the end of
+// handleStepMotion and steps on shaped axes go to the input shaper
+void IRAM_ATTR RampGenerator::stepAxis(int axisIdx)
+{
+    _stepAxesActive |= (1 << axisIdx);
+    if (_axisShapedMask & (1 << axisIdx))
     {
-        // Subtract from accumulator leaving remainder to combat rounding errors
-        _curAccumulatorNS -= MotionBlock::NS_IN_A_MS;
+        _shaperStepIn[axisIdx] = int8_t(_totalStepsInc[axisIdx]);
+        return;
+    }
+    _stepPinsActive |= _axisStepPinMask[axisIdx];
+    if (!_axisStepPinMask[axisIdx])
+        _rampGenIO.stepStart(axisIdx);
+}
 
-        // Check if decelerating
-        if (_curStepCount[pBlock->_axisIdxWithMaxSteps] > pBlock->_stepsBeforeDecel)
+// Run the input shapers - end the shaped steps started on the last tick and output the
+// shaped steps and direction changes for this tick
+void IRAM_ATTR RampGenerator::processShapers()
+{
+    uint32_t shapedStepsActive = 0;
+    for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+    {
+        InputShaper* pShaper = _pInputShapers[axisIdx];
+        if (!pShaper)
+            continue;
+        if (_shapedStepsActive & (1 << axisIdx))
+            _rampGenIO.stepEnd(axisIdx);
+        InputShaper::ShaperOutput shaperOutput = pShaper->process(_shaperStepIn[axisIdx], _shaperBypass);
+        _shaperStepIn[axisIdx] = 0;
+        if (shaperOutput == InputShaper::OUTPUT_STEP)
         {
-            if (_curStepRatePerTTicks > std::max(MIN_STEP_RATE_PER_TTICKS + pBlock->_accStepsPerTTicksPerMS,
-                                                 pBlock->_finalStepRatePerTTicks + pBlock->_accStepsPerTTicksPerMS))
-                _curStepRatePerTTicks -= pBlock->_accStepsPerTTicksPerMS;
+            _rampGenIO.stepStart(axisIdx);
+            shapedStepsActive |= (1 << axisIdx);
         }
-        else if ((_curStepRatePerTTicks < MIN_STEP_RATE_PER_TTICKS) || (_curStepRatePerTTicks < pBlock->_maxStepRatePerTTicks))
+        else if (shaperOutput == InputShaper::OUTPUT_DIRN)
         {
-            if (_curStepRatePerTTicks + pBlock->_accStepsPerTTicksPerMS < MotionBlock::TTICKS_VALUE)
-                _curStepRatePerTTicks += pBlock->_accStepsPerTTicksPerMS;
+            _rampGenIO.setDirection(axisIdx, pShaper->isDirnFwd());
         }
     }
+    _shapedStepsActive = shapedStepsActive;
 }
 
 // Handle start of step on each axis
-bool IRAM_ATTR RampGenerator::handleStepMotion(MotionBlock *pBlock)
+bool IRAM_ATTR RampGenerator::handleStepMotion(MotionBlockSteps *pBlock)
 {
     // Complete Flag
     bool anyAxisMoving = false;
@@ -298,11 +500,15 @@ bool IRAM_ATTR RampGenerator::handleStepMotion(MotionBlock *pBlock)
     if (_curStepCount[axisIdxMaxSteps] < _stepsTotalAbs[axisIdxMaxSteps])
     {
         // Step this axis
-        _rampGenIO.stepStart(axisIdxMaxSteps);
+        stepAxis(axisIdxMaxSteps);
         _curStepCount[axisIdxMaxSteps]++;
         if (_curStepCount[axisIdxMaxSteps] < _stepsTotalAbs[axisIdxMaxSteps])
             anyAxisMoving = true;
 
+        // Check for start of deceleration
+        if (_curStepCount[axisIdxMaxSteps] == _decelStartStepCount)
+            startDecel(pBlock);
+
         // Instrumentation
         INSTRUMENT_MOTION_ACTUATOR_STEP_START(axisIdxMaxSteps)
     }
@@ -321,7 +527,7 @@ bool IRAM_ATTR RampGenerator::handleStepMotion(MotionBlock *pBlock)
             _curAccumulatorRelative[axisIdx] -= _stepsTotalAbs[axisIdxMaxSteps];
 
             // Step the axis
-            _rampGenIO.stepStart(axisIdx);
+            stepAxis(axisIdx);
             // Log.trace("RampGenerator::procTick otherAxisStep: %d (ax %d)\n", pAxisInfo->_pinStep, axisIdx);
             _curStepCount[axisIdx]++;
             if (_curStepCount[axisIdx] < _stepsTotalAbs[axisIdx])
@@ -332,16 +538,21 @@ bool IRAM_ATTR RampGenerator::handleStepMotion(MotionBlock *pBlock)
         }
     }
 
+    // Start the steps
+    if (_stepPinsActive)
+        _rampGenIO.stepStartPins(_stepPinsActive);
+
     // Return indicator of block complete
     return anyAxisMoving;
 }
 
-void IRAM_ATTR RampGenerator::endMotion(MotionBlock *pBlock)
+void IRAM_ATTR RampGenerator::endMotion(MotionBlockSteps *pBlock)
 {
     _pMotionPipeline->remove();
+    _pipelineStats.blockEnded();
     // Check if this is a numbered block - if so record its completion
-    if (pBlock->getNumberedCommandIndex() != RobotConsts::NUMBERED_COMMAND_NONE)
-        _lastDoneNumberedCmdIdx = pBlock->getNumberedCommandIndex();
+    if (pBlock->_numberedCommandIndex != RobotConsts::NUMBERED_COMMAND_NONE)
+        _lastDoneNumberedCmdIdx = pBlock->_numberedCommandIndex;
 }
 
 #ifdef DEBUG_MONITOR_ISR_OPERATION
@@ -352,7 +563,6 @@ volatile int maxstepax = -1;
 volatile uint32_t accrate = 0;
 volatile int curSteps = -1;
 volatile int befDec = -1;
-volatile int maxStepRt = -1;
 #endif
 
 // Function that handles ISR calls based on a timer
@@ -368,6 +578,13 @@ void IRAM_ATTR RampGenerator::isrStepperMotion()
     // Instrumentation code to time ISR execution (if enabled - see MotionInstrumentation.h)
     INSTRUMENT_MOTION_ACTUATOR_TIME_START
 
+    // Telemetry tick count
+    _pipelineStats.tick();
+
+    // Input shapers run every tick as shaped steps continue after the block which made them ends
+    if (_axisShapedMask)
+        processShapers();
+
     // Do a step-end for any motor which needs one - return here to avoid too short a pulse
     if (handleStepEnd())
         return;
@@ -376,8 +593,8 @@ void IRAM_ATTR RampGenerator::isrStepperMotion()
     if (_isPaused)
         return;
 
-    // Peek a MotionPipelineElem from the queue
-    MotionBlock *pBlock = _pMotionPipeline->peekGet();
+    // Peek the stepping values of the next block from the queue
+    MotionBlockSteps *pBlock = _pMotionPipeline->peekGetSteps();
     if (!pBlock)
         return;
 
@@ -394,6 +611,7 @@ void IRAM_ATTR RampGenerator::isrStepperMotion()
     {
         // Setup new block
         setupNewBlock(pBlock);
+        _pipelineStats.blockStarted(_pMotionPipeline->count());
 
         // Return here to reduce the maximum time this function takes
         // Assuming this function is called frequently (<50uS intervals say)
@@ -401,17 +619,8 @@ void IRAM_ATTR RampGenerator::isrStepperMotion()
         return;
     }
 
-    // Check endstops        
-    bool endStopHit = false;
-    for (int i = 0; i < _endStopCheckNum; i++)
-    {
-        bool pinVal = digitalRead(_endStopChecks[i].pin);
-        if (pinVal == _endStopChecks[i].val)
-            endStopHit = true;
-    }
-
-    // Handle end-stop hit
-    if (endStopHit)
+    // Check endstops - one register read and a masked compare
+    if (_endStopPinMask && (~(_rampGenIO.readInputPins() ^ _endStopHitLevels) & _endStopPinMask))
     {
         // Cancel motion (by removing the block) as end-stop reached
         _endStopReached = true;
@@ -420,20 +629,19 @@ void IRAM_ATTR RampGenerator::isrStepperMotion()
 
     // Update the millisec accumulator - this handles the process of changing speed incrementally to
     // implement acceleration and deceleration
-    updateMSAccumulator(pBlock);
+    updateMSAccumulator();
 
     // Bump the step accumulator
-    _curAccumulatorStep += std::max(_curStepRatePerTTicks, MIN_STEP_RATE_PER_TTICKS);
+    _curAccumulatorStep += _curStepRatePerTTicks;
 
 #ifdef DEBUG_MONITOR_ISR_OPERATION
     accumStep = _curAccumulatorStep;
     stepRate = _curStepRatePerTTicks;
-    accelacc = _curAccumulatorNS;
+    accelacc = _rateUpdatesLeft;
     maxstepax = pBlock->_axisIdxWithMaxSteps;
     accrate = pBlock->_accStepsPerTTicksPerMS;
     curSteps = _curStepCount[pBlock->_axisIdxWithMaxSteps];
     befDec =pBlock->_stepsBeforeDecel;
-    maxStepRt = pBlock->_maxStepRatePerTTicks;
 #endif
 
     // Check for step accumulator overflow
@@ -466,9 +674,10 @@ void RampGenerator::process()
     // If using a controller with a ramp generator then service the block handling
     if (_rampGenEnabled)
     {
-        // If not using ISR call _isrStepperMotion on every process call
-#ifndef USE_ESP32_TIMER_ISR
-        _isrStepperMotion();
+        // If not using ISR call isrStepperMotion on every process call
+        // (in host simulation the ISR is driven by simRunTicks instead)
+#if !defined(USE_ESP32_TIMER_ISR) && !defined(RAMPGEN_HOST_SIM)
+        isrStepperMotion();
 #endif
     }
 
@@ -476,6 +685,36 @@ void RampGenerator::process()
     INSTRUMENT_MOTION_ACTUATOR_PROCESS
 }
 
+#ifdef RAMPGEN_HOST_SIM
+// Stand-in for the hardware timer - each tick is MotionBlock::TICK_INTERVAL_NS of virtual time
+void RampGenerator::simRunTicks(uint32_t numTicks)
+{
+    for (uint32_t i = 0; i < numTicks; i++)
+    {
+        _rampGenIO.simTick();
+        if (!_rampGenEnabled)
+            continue;
+        uint32_t blocksStarted = _pipelineStats.getBlocksStarted();
+        uint32_t ticksToRateUpdate = _ticksToRateUpdate;
+        isrStepperMotion();
+        if (!_simRecordRates)
+            continue;
+
+        // The ISR resets the ticks to the next rate update when a block starts and after a rate update
+        bool blockStarted = _pipelineStats.getBlocksStarted() != blocksStarted;
+        if (blockStarted)
+        {
+            MotionBlockSteps* pBlock = _pMotionPipeline->peekGetSteps();
+            _simBlockAccStepsPerTTicksPerMS = pBlock ? pBlock->_accStepsPerTTicksPerMS : 0;
+        }
+        if (blockStarted || ((_ticksToRateUpdate == MotionBlock::TICKS_PER_RATE_UPDATE) &&
+                    (ticksToRateUpdate != MotionBlock::TICKS_PER_RATE_UPDATE)))
+            _simRates.push_back({ _rampGenIO.simGetTickCount(), _pipelineStats.getBlocksStarted(),
+                        _curStepRatePerTTicks, _simBlockAccStepsPerTTicksPerMS });
+    }
+}
+#endif
+
 String RampGenerator::getDebugStr()
 {
 #ifdef INSTRUMENT_MOTION_ACTUATOR_ENABLE
@@ -10,6 +10,7 @@
 #include <ArduinoLog.h>
 #include "MotionInstrumentation.h"
 #include "../MotionBlock.h"
+#include "../MotionPipelineStats.h"
 #include "RampGenIO.h"
 
 class MotionPipeline;
@@ -36,10 +37,8 @@ private:
     // Raw access to motors and endstops
     RobotConsts::RawMotionHwInfo_t _rawMotionHwInfo;
 
-    // This is to ensure that the robot never goes to 0 tick rate - which would leave it
-    // immobile forever
-    static constexpr uint32_t MIN_STEP_RATE_PER_SEC = 10;
-    static constexpr uint32_t MIN_STEP_RATE_PER_TTICKS = uint32_t((MIN_STEP_RATE_PER_SEC * 1.0 * MotionBlock::TTICKS_VALUE) / MotionBlock::TICKS_PER_SEC);
+    // Underrun telemetry (updated by the ISR)
+    MotionPipelineStats _pipelineStats;
 
 #ifdef INSTRUMENT_MOTION_ACTUATOR_ENABLE
     // Test code
@@ -68,18 +67,45 @@ private:
     uint32_t _curStepCount[RobotConsts::MAX_AXES];
     // Current step rate (in steps per K ticks)
     uint32_t _curStepRatePerTTicks;
-    // Accumulators for stepping and acceleration increments
+    // Accumulators for stepping
     uint32_t _curAccumulatorStep;
-    uint32_t _curAccumulatorNS;
     uint32_t _curAccumulatorRelative[RobotConsts::MAX_AXES];
-
-    int _endStopCheckNum;
-    struct EndStopChecks
-    {
-        int pin;
-        bool val;
-    };
-    EndStopChecks _endStopChecks[RobotConsts::MAX_AXES];
+    // Rate updates (from the block's precomputed profile) - the increment is added to the
+    // rate every ms while updates remain and is negative (two's complement) when decelerating
+    uint32_t _ticksToRateUpdate;
+    uint32_t _rateUpdatesLeft;
+    uint32_t _rateIncPerUpdate;
+    uint32_t _decelStartStepCount;
+    // Jerk-limited ramp (see MotionBlockRamps) - the block's ramps, the rate in fixed point, its
+    // forward differences and the rate the ramp ends on - a block reaching its deceleration point
+    // before the acceleration ramp has finished starts deceleration when it has
+    bool _rampJerkLimited;
+    bool _rampDecelerating;
+    bool _rampDecelPending;
+    MotionBlockRamps* _pBlockRamps;
+    int64_t _rampRateFixed;
+    int64_t _rampRateDiffs[3];
+    uint32_t _rampEndRatePerTTicks;
+
+    // Pin masks for register level access (set on configure) - axes without a step pin mask
+    // (e.g. multiplexed direction) are stepped through RampGenIO one at a time
+    uint64_t _axisStepPinMask[RobotConsts::MAX_AXES];
+    uint64_t _axisDirnPinMask[RobotConsts::MAX_AXES];
+    bool _axisDirnReversed[RobotConsts::MAX_AXES];
+    // Endstops for the current block - hit when any pin in the mask is at its level
+    uint64_t _endStopPinMask;
+    uint64_t _endStopHitLevels;
+    // Steps in progress (ended on the next tick)
+    uint64_t _stepPinsActive;
+    uint32_t _stepAxesActive;
+    // Input shaped axes - steps on these axes go to the axis input shaper (on the next tick) instead
+    // of the pins and the shaper's output steps are ended on the tick after they start - moves which
+    // check end-stops bypass the shapers
+    uint32_t _axisShapedMask;
+    InputShaper* _pInputShapers[RobotConsts::MAX_AXES];
+    int8_t _shaperStepIn[RobotConsts::MAX_AXES];
+    uint32_t _shapedStepsActive;
+    bool _shaperBypass;
 
 public:
     RampGenerator(MotionPipeline* pMotionPipeline);
@@ -87,9 +113,9 @@ public:
     void setInstrumentationMode(const char *testModeStr);
     void deinit();
     void configure(bool rampGenEnabled);
-    bool configureAxis(int axisIdx, const char *axisJSON)
+    bool configureAxis(int axisIdx, RdJsonDoc& axisDoc)
     {
-        return _rampGenIO.configureAxis(axisIdx, axisJSON);
+        return _rampGenIO.configureAxis(axisIdx, axisDoc);
     }
     void stop();
     // static void clear();
@@ -104,16 +130,57 @@ public:
     }
     bool isEndStopReached();
     int getLastCompletedNumberedCmdIdx();
+    MotionPipelineStats& getPipelineStats()
+    {
+        return _pipelineStats;
+    }
     void process();
     String getDebugStr();
     void showDebug();
 
+#ifdef RAMPGEN_HOST_SIM
+    // Host simulation - run the ISR for a number of virtual ticks
+    void simRunTicks(uint32_t numTicks);
+    RampGenIO& simGetRampGenIO()
+    {
+        return _rampGenIO;
+    }
+    // Step rate when each block starts and after each rate update (every ms while a block executes)
+    struct SimRateSample
+    {
+        uint32_t tick;
+        uint32_t blockIdx;
+        uint32_t stepRatePerTTicks;
+        uint32_t accStepsPerTTicksPerMS;
+    };
+    void simSetRecordRates(bool recordRates)
+    {
+        _simRecordRates = recordRates;
+    }
+    std::vector<SimRateSample>& simGetRates()
+    {
+        return _simRates;
+    }
+#endif
+
 private:
     static void _staticISRStepperMotion();
     void isrStepperMotion();
     bool handleStepEnd();
-    void setupNewBlock(MotionBlock *pBlock);
-    void updateMSAccumulator(MotionBlock *pBlock);
-    bool handleStepMotion(MotionBlock *pBlock);
-    void endMotion(MotionBlock *pBlock);
+    void setupNewBlock(MotionBlockSteps *pBlock);
+    void updateMSAccumulator();
+    void startJerkLimitedRamp(const int64_t rateDiffs[3], uint32_t endRatePerTTicks, bool decelerating);
+    void updateJerkLimitedRate();
+    void startDecel(MotionBlockSteps *pBlock);
+    void stepAxis(int axisIdx);
+    void processShapers();
+    bool handleStepMotion(MotionBlockSteps *pBlock);
+    void endMotion(MotionBlockSteps *pBlock);
+
+#ifdef RAMPGEN_HOST_SIM
+    // Recorded step rates
+    bool _simRecordRates;
+    uint32_t _simBlockAccStepsPerTTicksPerMS;
+    std::vector<SimRateSample> _simRates;
+#endif
 };
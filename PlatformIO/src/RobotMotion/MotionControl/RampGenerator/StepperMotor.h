@@ -151,12 +151,12 @@ class StepperMotor
     //     digitalWrite(_pinStep, false);
     // }
 
-    // void getPins(int &stepPin, int &dirnPin, bool &dirnReverse)
-    // {
-    //     stepPin = _pinStep;
-    //     dirnPin = _pinDirection;
-    //     dirnReverse = _motorDirectionReversed;
-    // }
+    void getPins(int &stepPin, int &dirnPin, bool &dirnReverse)
+    {
+        stepPin = _pinStep;
+        dirnPin = _pinDirectionSingle;
+        dirnReverse = _motorDirectionReversed;
+    }
 
     RobotConsts::MOTOR_TYPE getMotorType()
     {
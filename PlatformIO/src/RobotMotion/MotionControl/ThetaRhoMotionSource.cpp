@@ -0,0 +1,109 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+#include <Arduino.h>
+#include <ArduinoLog.h>
+#include "ThetaRhoMotionSource.h"
+
+// #define THETA_RHO_DEBUG 1
+
+#ifdef THETA_RHO_DEBUG
+static const char *MODULE_PREFIX = "ThetaRhoMotionSource: ";
+#endif
+
+ThetaRhoMotionSource::ThetaRhoMotionSource()
+{
+    _stepAngle = M_PI / 64;
+    _stepAdaptation = true;
+    _bedRadiusMM = 0;
+    _centreOffsetX = 0;
+    _centreOffsetY = 0;
+    _curTheta = 0;
+    _curRho = 0;
+    _interpolateSteps = 0;
+    _curStep = 0;
+    _thetaInc = 0;
+    _rhoInc = 0;
+}
+
+void ThetaRhoMotionSource::configure(double stepAngle, bool stepAdaptation, double bedRadiusMM,
+                double centreOffsetX, double centreOffsetY)
+{
+    _stepAngle = stepAngle;
+    _stepAdaptation = stepAdaptation;
+    _bedRadiusMM = bedRadiusMM;
+    _centreOffsetX = centreOffsetX;
+    _centreOffsetY = centreOffsetY;
+}
+
+void ThetaRhoMotionSource::start(double startTheta, double startRho, double endTheta, double endRho)
+{
+    // Step angle is smaller further from the centre
+    double deltaTheta = endTheta - startTheta;
+    double absDeltaTheta = fabs(deltaTheta);
+    double adaptedStepAngle = _stepAngle;
+    if (_stepAdaptation)
+    {
+        double avgRho = std::max(fabs(endRho), fabs(startRho));
+        if (avgRho > 1)
+            avgRho = 1;
+        double maxStepAngle = _stepAngle * 16;
+        if (maxStepAngle > M_PI / 2)
+            maxStepAngle = M_PI / 2;
+        double minStepAngle = _stepAngle / 4;
+        if (avgRho > RHO_AT_DEFAULT_STEP_ANGLE)
+        {
+            adaptedStepAngle = ((avgRho - RHO_AT_DEFAULT_STEP_ANGLE) / (1 - RHO_AT_DEFAULT_STEP_ANGLE)) *
+                    (minStepAngle - _stepAngle) + _stepAngle;
+        }
+        else
+        {
+            adaptedStepAngle = (avgRho / RHO_AT_DEFAULT_STEP_ANGLE) *
+                    (_stepAngle - maxStepAngle) + maxStepAngle;
+        }
+    }
+    _thetaInc = deltaTheta >= 0 ? adaptedStepAngle : -adaptedStepAngle;
+    double deltaRho = endRho - startRho;
+    _curStep = 0;
+    if (absDeltaTheta < adaptedStepAngle)
+    {
+        _thetaInc = deltaTheta;
+        _interpolateSteps = 1;
+        _rhoInc = deltaRho;
+    }
+    else
+    {
+        _interpolateSteps = int(floor(absDeltaTheta / adaptedStepAngle));
+        _rhoInc = deltaRho * adaptedStepAngle / absDeltaTheta;
+    }
+    _curTheta = startTheta;
+    _curRho = startRho;
+#ifdef THETA_RHO_DEBUG
+    Log.trace("%sstart theta %F rho %F steps %d thetaInc %F rhoInc %F adaptedStepAngle %F\n", MODULE_PREFIX,
+            endTheta, endRho, _interpolateSteps, _thetaInc, _rhoInc, adaptedStepAngle);
+#endif
+}
+
+bool ThetaRhoMotionSource::nextPoint(AxisFloats& pt)
+{
+    if (_curStep >= _interpolateSteps)
+        return false;
+
+    // Step
+    _curStep++;
+    _curTheta += _thetaInc;
+    _curRho += _rhoInc;
+
+    // Calculate coords
+    double x, y;
+    calcXYPos(_curTheta, _curRho, x, y);
+    pt.setVal(0, x);
+    pt.setVal(1, y);
+    return true;
+}
+
+void ThetaRhoMotionSource::stop()
+{
+    _interpolateSteps = 0;
+    _curStep = 0;
+}
@@ -0,0 +1,60 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Interpolates a line between two theta-rho points - MotionHelper pulls the XY points
+// from this on demand whenever the motion pipeline has room
+
+#pragma once
+
+#include "MotionPointSource.h"
+#include <atomic>
+
+class ThetaRhoMotionSource : public MotionPointSource
+{
+public:
+    ThetaRhoMotionSource();
+
+    // Config
+    void configure(double stepAngle, bool stepAdaptation, double bedRadiusMM,
+                double centreOffsetX, double centreOffsetY);
+
+    // Start interpolating from one theta-rho point to the next
+    void start(double startTheta, double startRho, double endTheta, double endRho);
+
+    // Check if there are more points
+    virtual bool isBusy()
+    {
+        return _curStep < _interpolateSteps;
+    }
+
+    // Get the next point (in MM) - returns false if there are no more
+    virtual bool nextPoint(AxisFloats& pt);
+
+    // Stop
+    void stop();
+
+    // Convert theta-rho to XY
+    void calcXYPos(double theta, double rho, double& x, double& y)
+    {
+        x = sin(theta) * rho * _bedRadiusMM + _centreOffsetX;
+        y = cos(theta) * rho * _bedRadiusMM + _centreOffsetY;
+    }
+
+private:
+    // Config
+    static constexpr double RHO_AT_DEFAULT_STEP_ANGLE = 0.5;
+    double _stepAngle;
+    bool _stepAdaptation;
+    double _bedRadiusMM;
+    double _centreOffsetX;
+    double _centreOffsetY;
+
+    // Interpolation - steps are atomic as isBusy() is checked from the main loop while the
+    // planner task pulls points
+    double _curTheta;
+    double _curRho;
+    std::atomic<int> _interpolateSteps;
+    std::atomic<int> _curStep;
+    double _thetaInc;
+    double _rhoInc;
+};
@@ -85,25 +85,25 @@ void TrinamicsController::deinit()
     _isRampGenerator = false;
 }
 
-void TrinamicsController::configure(const char *configJSON)
+void TrinamicsController::configure(RdJsonDoc& robotGeomDoc)
 {
-    Log.verbose("%sconfigure %s\n", MODULE_PREFIX, configJSON);
+    Log.verbose("%sconfigure %s\n", MODULE_PREFIX, robotGeomDoc.getSource());
 
     // Check for trinamics controller config JSON
-    String motionController = RdJson::getString("motionController", "NONE", configJSON);
+    RdJsonDoc motionControllerDoc(robotGeomDoc.getString("motionController", "NONE").c_str());
 
     // Get chip
-    String mcChip = RdJson::getString("chip", "NONE", motionController.c_str());
-    Log.trace("%sconfigure motionController %s chip %s\n", MODULE_PREFIX, motionController.c_str(), mcChip.c_str());
+    String mcChip = motionControllerDoc.getString("chip", "NONE");
+    Log.trace("%sconfigure motionController %s chip %s\n", MODULE_PREFIX, motionControllerDoc.getSource(), mcChip.c_str());
 
     if ((mcChip == "TMC5072") || (mcChip == "TMC2130"))
     {
         // SPI settings
-        String pinName = RdJson::getString("MOSI", "", motionController.c_str());
+        String pinName = motionControllerDoc.getString("MOSI", "");
         int spiMOSIPin = ConfigPinMap::getPinFromName(pinName.c_str());
-        pinName = RdJson::getString("MISO", "", motionController.c_str());
+        pinName = motionControllerDoc.getString("MISO", "");
         int spiMISOPin = ConfigPinMap::getPinFromName(pinName.c_str());
-        pinName = RdJson::getString("CLK", "", motionController.c_str());
+        pinName = motionControllerDoc.getString("CLK", "");
         int spiCLKPin = ConfigPinMap::getPinFromName(pinName.c_str());
 
         // Check valid
@@ -129,19 +129,19 @@ void TrinamicsController::configure(const char *configJSON)
     if (_isEnabled)
     {
         // Non-multiplexed cs pins
-        _cs1 = getPinAndConfigure(motionController.c_str(), "CS1", OUTPUT, HIGH);
-        _cs2 = getPinAndConfigure(motionController.c_str(), "CS2", OUTPUT, HIGH);
-        _cs3 = getPinAndConfigure(motionController.c_str(), "CS3", OUTPUT, HIGH);
+        _cs1 = getPinAndConfigure(motionControllerDoc, "CS1", OUTPUT, HIGH);
+        _cs2 = getPinAndConfigure(motionControllerDoc, "CS2", OUTPUT, HIGH);
+        _cs3 = getPinAndConfigure(motionControllerDoc, "CS3", OUTPUT, HIGH);
 
         // Multiplexer settings
-        _mux1 = getPinAndConfigure(motionController.c_str(), "MUX1", OUTPUT, LOW);
-        _mux2 = getPinAndConfigure(motionController.c_str(), "MUX2", OUTPUT, LOW);
-        _mux3 = getPinAndConfigure(motionController.c_str(), "MUX3", OUTPUT, HIGH);
-        String confName = RdJson::getString("MUX_CS_1", "", motionController.c_str());
+        _mux1 = getPinAndConfigure(motionControllerDoc, "MUX1", OUTPUT, LOW);
+        _mux2 = getPinAndConfigure(motionControllerDoc, "MUX2", OUTPUT, LOW);
+        _mux3 = getPinAndConfigure(motionControllerDoc, "MUX3", OUTPUT, HIGH);
+        String confName = motionControllerDoc.getString("MUX_CS_1", "");
         _muxCS1 = ConfigPinMap::getPinFromName(confName.c_str());
-        confName = RdJson::getString("MUX_CS_2", "", motionController.c_str());
+        confName = motionControllerDoc.getString("MUX_CS_2", "");
         _muxCS2 = ConfigPinMap::getPinFromName(confName.c_str());
-        confName = RdJson::getString("MUX_CS_3", "", motionController.c_str());
+        confName = motionControllerDoc.getString("MUX_CS_3", "");
         _muxCS3 = ConfigPinMap::getPinFromName(confName.c_str());
 
         // Configure TMC2130s
@@ -183,9 +183,9 @@ void TrinamicsController::configure(const char *configJSON)
 }
 
 uint32_t TrinamicsController::getUint32WithBaseFromConfig(const char* dataPath, uint32_t defaultValue,
-                            const char* pSourceStr)
+                            RdJsonDoc& configDoc)
 {
-    String confStr = RdJson::getString(dataPath, "", pSourceStr);
+    String confStr = configDoc.getString(dataPath, "");
     if (confStr.length() == 0)
         return defaultValue;
     if ((confStr.startsWith("0x")) || (confStr.startsWith("0X")))
@@ -195,22 +195,22 @@ uint32_t TrinamicsController::getUint32WithBaseFromConfig(const char* dataPath,
     return strtoul(confStr.c_str(), NULL, 10);    
 }
 
-void TrinamicsController::configureAxis(int axisIdx, const char *axisJSON)
+void TrinamicsController::configureAxis(int axisIdx, RdJsonDoc& axisDoc)
 {
     if (axisIdx < 0 || axisIdx >= RobotConsts::MAX_AXES)
         return;
 
     // Get axis information
-    _axisSettings[axisIdx].reversed = (RdJson::getLong("dirnRev", 0, axisJSON) != 0);
+    _axisSettings[axisIdx].reversed = (axisDoc.getLong("dirnRev", 0) != 0);
 
     // Driver settings
-    _axisSettings[axisIdx].iRunPower = RdJson::getLong("IRUN", TMC_IRUN_DEFAULT, axisJSON);
-    _axisSettings[axisIdx].iHoldPower = RdJson::getLong("IHOLD", TMC_IHOLD_DEFAULT, axisJSON);
-    _axisSettings[axisIdx].iHoldDelay = RdJson::getLong("IHOLDDELAY", TMC_IHOLDDELAY_DEFAULT, axisJSON);
-    _axisSettings[axisIdx].chopConf = getUint32WithBaseFromConfig("CHOPCONF", TMC_CHOPCONF_DEFAULT, axisJSON);
+    _axisSettings[axisIdx].iRunPower = axisDoc.getLong("IRUN", TMC_IRUN_DEFAULT);
+    _axisSettings[axisIdx].iHoldPower = axisDoc.getLong("IHOLD", TMC_IHOLD_DEFAULT);
+    _axisSettings[axisIdx].iHoldDelay = axisDoc.getLong("IHOLDDELAY", TMC_IHOLDDELAY_DEFAULT);
+    _axisSettings[axisIdx].chopConf = getUint32WithBaseFromConfig("CHOPCONF", TMC_CHOPCONF_DEFAULT, axisDoc);
 
     // Get axis mapping
-    int chipDriverIdx = RdJson::getLong("chipDriverIdx", -1, axisJSON);
+    int chipDriverIdx = axisDoc.getLong("chipDriverIdx", -1);
     if ((chipDriverIdx != -1) && (chipDriverIdx >= 0) && (chipDriverIdx < MAX_TMC5072*MAX_TMC_DRIVERS_PER_CHIP))
     {
         _axisIdxToChipDriverIdx[axisIdx] = chipDriverIdx;
@@ -311,9 +311,9 @@ void TrinamicsController::tmc5072Init()
     }
 }
 
-int TrinamicsController::getPinAndConfigure(const char* configJSON, const char* pinSelector, int direction, int initValue)
+int TrinamicsController::getPinAndConfigure(RdJsonDoc& configDoc, const char* pinSelector, int direction, int initValue)
 {
-    String pinName = RdJson::getString(pinSelector, "", configJSON);
+    String pinName = configDoc.getString(pinSelector, "");
     int pinIdx = ConfigPinMap::getPinFromName(pinName.c_str());
     if (pinIdx >= 0)
     {
@@ -559,15 +559,15 @@ void TrinamicsController::_timerCallback(void* arg)
     }
 
     // Check if the element can be executed
-    if (!pBlock->_canExecute)
+    if (!pBlock->_pSteps->_canExecute)
     {
         // Log.trace("Can't execute\n");
         return;
     }
 
     // See if the block was already executing and set isExecuting if not
-    bool blockIsNew = !pBlock->_isExecuting;
-    pBlock->_isExecuting = true;
+    bool blockIsNew = !pBlock->_pSteps->_isExecuting;
+    pBlock->_pSteps->_isExecuting = true;
 
     // Existing block
     bool debugBlockCompleteCode = 0;
@@ -602,11 +602,11 @@ void TrinamicsController::_timerCallback(void* arg)
             // Peek a MotionPipelineElem from the queue
             // Check if the element can be executed
             MotionBlock *pBlock = _motionPipeline.peekGet();
-            if (pBlock && pBlock->_canExecute)
+            if (pBlock && pBlock->_pSteps->_canExecute)
             {
                 // Should be new!
-                blockIsNew = !pBlock->_isExecuting;
-                pBlock->_isExecuting = true;
+                blockIsNew = !pBlock->_pSteps->_isExecuting;
+                pBlock->_pSteps->_isExecuting = true;
             }
         }
     }
@@ -615,13 +615,13 @@ void TrinamicsController::_timerCallback(void* arg)
     if (blockIsNew)
     {
         // Handle the motion by requesting the controller to make the move
-        int32_t maxAxisSteps = pBlock->_stepsTotalMaybeNeg[pBlock->_axisIdxWithMaxSteps];
+        int32_t maxAxisSteps = pBlock->getStepsToTarget(pBlock->_pSteps->_axisIdxWithMaxSteps);
         float entrySpeedFactor = fabs(pBlock->_entrySpeedMMps / pBlock->_feedrate);
         float exitSpeedFactor = fabs(pBlock->_exitSpeedMMps / pBlock->_feedrate);
         for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
         {
             // Set VMAX based on the distance each axis will travel
-            uint32_t axisVMax = 100000 * abs(1000*pBlock->_stepsTotalMaybeNeg[axisIdx]/maxAxisSteps) / 1000;
+            uint32_t axisVMax = 100000 * abs(1000*pBlock->getStepsToTarget(axisIdx)/maxAxisSteps) / 1000;
             uint32_t axisVStart = axisVMax * entrySpeedFactor;
             tmc5072SendCmd(axisIdx, TMC5072_VSTART, axisVStart);
             tmc5072SendCmd(axisIdx, TMC5072_VMAX, axisVMax);
@@ -639,7 +639,7 @@ void TrinamicsController::_timerCallback(void* arg)
         // Send commnands for each axis movement
         for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
         {
-            _axisTargetSteps[axisIdx] = _axisTotalSteps[axisIdx] + pBlock->_stepsTotalMaybeNeg[axisIdx];
+            _axisTargetSteps[axisIdx] = _axisTotalSteps[axisIdx] + pBlock->getStepsToTarget(axisIdx);
             tmc5072SendCmd(axisIdx, TMC5072_XTARGET, _axisTargetSteps[axisIdx]);
 
             // Log.trace("TARGET %d, %d, %d Total %d %d %d\n", 
@@ -13,20 +13,32 @@
 #include "Robots/RobotSandTableScara.h"
 #include "Robots/RobotXYBot.h"
 
-RobotController::RobotController()
+RobotController::RobotController() : _cmdQueue(ROBOT_COMMAND_QUEUE_LEN), _plannerProfiler("planner")
 {
     // Init
     _pRobot = NULL;
+    _plannerTaskRunning = false;
+    _plannerTaskStopReqd = false;
+    _workQueued = false;
 }
 
 RobotController::~RobotController()
 {
+    // Queued commands are discarded (the planner task applies any left when it stops)
+    {
+        std::lock_guard<std::mutex> lock(_robotMutex);
+        clearCommands();
+    }
+    stopPlannerTask();
     delete _pRobot;
 }
 
 bool RobotController::init(const char* configStr)
 {
+    std::lock_guard<std::mutex> lock(_robotMutex);
+
     // Init
+    clearCommands();
     delete _pRobot;
     _pRobot = NULL;
 
@@ -96,6 +108,7 @@ void RobotController::pause(bool pauseIt)
         Log.notice("RobotController: pausing\n");
     else
         Log.notice("RobotController: resuming\n");
+    std::lock_guard<std::mutex> lock(_robotMutex);
     if (!_pRobot)
         return;
     _pRobot->pause(pauseIt);
@@ -105,6 +118,8 @@ void RobotController::pause(bool pauseIt)
 void RobotController::stop()
 {
     Log.notice("RobotController: stop\n");
+    std::lock_guard<std::mutex> lock(_robotMutex);
+    clearCommands();
     if (!_pRobot)
         return;
     _pRobot->stop();
@@ -113,6 +128,7 @@ void RobotController::stop()
 // Check if paused
 bool RobotController::isPaused()
 {
+    std::lock_guard<std::mutex> lock(_robotMutex);
     if (!_pRobot)
         return false;
     return _pRobot->isPaused();
@@ -121,53 +137,105 @@ bool RobotController::isPaused()
 // Service (called frequently)
 void RobotController::service()
 {
+    if (_plannerTaskRunning)
+        return;
+    std::lock_guard<std::mutex> lock(_robotMutex);
     if (!_pRobot)
         return;
+    _motionHelper.setUpstreamWorkPending(_workQueued);
     _pRobot->service();
 }
 
 // Movement commands
-void RobotController::actuator(double value)
+bool RobotController::actuator(double value)
 {
-    if (!_pRobot)
-        return;
-    _pRobot->actuator(value);
+    return submitCommand(ROBOT_CMD_ACTUATOR, NULL, value);
 }
 
 // Check if the robot can accept a (motion) command
 bool RobotController::canAcceptCommand()
 {
+    std::lock_guard<std::mutex> lock(_robotMutex);
     if (!_pRobot)
         return false;
+    if (_plannerTaskRunning)
+        return _cmdQueue.canPut();
     return _pRobot->canAcceptCommand();
 }
 
-void RobotController::moveTo(RobotCommandArgs& args)
+bool RobotController::moveTo(RobotCommandArgs& args)
 {
+    return submitCommand(ROBOT_CMD_MOVE_TO, &args, 0);
+}
+
+bool RobotController::movePointSource(MotionPointSource& source, PointSourceFn startFn)
+{
+    waitForCommandSpace();
+    std::lock_guard<std::mutex> lock(_robotMutex);
+
+    // Check there is space for the command before starting the source (no other command can be
+    // queued while _cmdPutMutex is held)
+    std::lock_guard<std::mutex> putLock(_cmdPutMutex);
+    if (_plannerTaskRunning && !_cmdQueue.canPut())
+    {
+        Log.warning("RobotController: command queue full, command %d rejected\n", ROBOT_CMD_POINT_SOURCE);
+        return false;
+    }
+    _motionHelper.pointSourceDetach(source);
+    if (startFn)
+        startFn();
+    if (_plannerTaskRunning)
+    {
+        RobotCommand cmd;
+        cmd._type = ROBOT_CMD_POINT_SOURCE;
+        cmd._pSource = &source;
+        cmd._value = 0;
+        return _cmdQueue.put(cmd);
+    }
     if (!_pRobot)
-        return;
-    _pRobot->moveTo(args);
+        return false;
+    _motionHelper.movePointSource(source);
+    return true;
+}
+
+void RobotController::stopPointSource(MotionPointSource& source, PointSourceFn stopFn)
+{
+    std::lock_guard<std::mutex> lock(_robotMutex);
+    _motionHelper.pointSourceDetach(source);
+    if (stopFn)
+        stopFn();
 }
 
 // Set motion parameters
-void RobotController::setMotionParams(RobotCommandArgs& args)
+bool RobotController::setMotionParams(RobotCommandArgs& args)
 {
-    if (!_pRobot)
-        return;
-    _pRobot->setMotionParams(args);
+    return submitCommand(ROBOT_CMD_MOTION_PARAMS, &args, 0);
 }
 
 // Get status
 void RobotController::getCurStatus(RobotCommandArgs& args)
 {
+    std::lock_guard<std::mutex> lock(_robotMutex);
     if (!_pRobot)
         return;
     _pRobot->getCurStatus(args);
+    // Commands waiting for the planner task count as queued
+    args.setNumQueued(args.getNumQueued() + _cmdQueue.count());
+}
+
+// Update the status snapshot
+void RobotController::updateStatus(StatusSnapshot& status)
+{
+    std::lock_guard<std::mutex> lock(_robotMutex);
+    if (!_pRobot)
+        return;
+    _pRobot->updateStatus(status, _cmdQueue.count());
 }
 
 // Get robot attributes
 void RobotController::getRobotAttributes(String& robotAttrs)
 {
+    std::lock_guard<std::mutex> lock(_robotMutex);
     robotAttrs = "{}";
     if (!_pRobot)
         return;
@@ -175,23 +243,20 @@ void RobotController::getRobotAttributes(String& robotAttrs)
 }
 
 // Go Home
-void RobotController::goHome(RobotCommandArgs& args)
+bool RobotController::goHome(RobotCommandArgs& args)
 {
-    if (!_pRobot)
-        return;
-    _pRobot->goHome(args);
+    return submitCommand(ROBOT_CMD_GO_HOME, &args, 0);
 }
 
 // Set Home
-void RobotController::setHome(RobotCommandArgs& args)
+bool RobotController::setHome(RobotCommandArgs& args)
 {
-    if (!_pRobot)
-        return;
-    _pRobot->setHome(args);
+    return submitCommand(ROBOT_CMD_SET_HOME, &args, 0);
 }
 
 bool RobotController::wasActiveInLastNSeconds(int nSeconds)
 {
+    std::lock_guard<std::mutex> lock(_robotMutex);
     if (!_pRobot)
         return false;
     return _pRobot->wasActiveInLastNSeconds(nSeconds);
@@ -199,5 +264,171 @@ bool RobotController::wasActiveInLastNSeconds(int nSeconds)
 
 String RobotController::getDebugStr()
 {
+    std::lock_guard<std::mutex> lock(_robotMutex);
     return _motionHelper.getDebugStr();
 }
+
+void RobotController::getPipelineStats(String& statsJson, bool clearStats)
+{
+    std::lock_guard<std::mutex> lock(_robotMutex);
+    _motionHelper.getPipelineStats(statsJson, clearStats);
+}
+
+// Queue a command for the planner task or, if the task isn't running, apply it immediately -
+// returns false if the command is rejected (the queue stayed full or there is no robot)
+bool RobotController::submitCommand(RobotCommandType type, RobotCommandArgs* pArgs, double value)
+{
+    RobotCommand cmd;
+    cmd._type = type;
+    if (pArgs)
+        cmd._args = *pArgs;
+    cmd._pSource = NULL;
+    cmd._value = value;
+    waitForCommandSpace();
+    bool queued = false;
+    if (!queueCommand(cmd, queued))
+        return false;
+    if (queued)
+        return true;
+    std::lock_guard<std::mutex> lock(_robotMutex);
+    if (!_pRobot)
+        return false;
+    applyCommand(cmd);
+    return true;
+}
+
+// Wait (for up to COMMAND_QUEUE_WAIT_MS) for space in the planner task's queue - not called with
+// _robotMutex held as the planner task needs it to get commands
+void RobotController::waitForCommandSpace()
+{
+    unsigned long waitStartMs = millis();
+    while (_plannerTaskRunning && !_cmdQueue.canPut() && (millis() - waitStartMs < COMMAND_QUEUE_WAIT_MS))
+        delay(1);
+}
+
+// Queue a command for the planner task - queued is false if the task isn't running (in which
+// case the caller applies the command) - returns false if the queue is full
+bool RobotController::queueCommand(RobotCommand& cmd, bool& queued)
+{
+    std::lock_guard<std::mutex> lock(_cmdPutMutex);
+    queued = false;
+    if (!_plannerTaskRunning)
+        return true;
+    if (!_cmdQueue.put(cmd))
+    {
+        Log.warning("RobotController: command queue full, command %d rejected\n", cmd._type);
+        return false;
+    }
+    queued = true;
+    return true;
+}
+
+// Apply a queued command (called with _robotMutex held)
+void RobotController::applyCommand(RobotCommand& cmd)
+{
+    switch (cmd._type)
+    {
+        case ROBOT_CMD_MOVE_TO: _pRobot->moveTo(cmd._args); break;
+        case ROBOT_CMD_POINT_SOURCE: _motionHelper.movePointSource(*cmd._pSource); break;
+        case ROBOT_CMD_MOTION_PARAMS: _pRobot->setMotionParams(cmd._args); break;
+        case ROBOT_CMD_GO_HOME: _pRobot->goHome(cmd._args); break;
+        case ROBOT_CMD_SET_HOME: _pRobot->setHome(cmd._args); break;
+        case ROBOT_CMD_ACTUATOR: _pRobot->actuator(cmd._value); break;
+    }
+}
+
+// Discard queued commands (called with _robotMutex held - so the planner task isn't getting)
+void RobotController::clearCommands()
+{
+    RobotCommand cmd;
+    while (_cmdQueue.get(cmd))
+        ;
+}
+
+// Planner task
+void RobotController::startPlannerTask()
+{
+    if (_plannerTaskRunning)
+        return;
+    _plannerTaskStopReqd = false;
+    _plannerTaskRunning = true;
+#ifdef RAMPGEN_HOST_SIM
+    _plannerThread = std::thread(plannerTaskFn, this);
+#else
+    if (xTaskCreatePinnedToCore(plannerTaskFn, "planner", PLANNER_TASK_STACK_SIZE, this,
+                PLANNER_TASK_PRIORITY, NULL, PLANNER_TASK_CORE) != pdPASS)
+    {
+        Log.notice("RobotController: failed to start planner task\n");
+        _plannerTaskRunning = false;
+        return;
+    }
+#endif
+    Log.notice("RobotController: planner task started on core %d\n", PLANNER_TASK_CORE);
+}
+
+void RobotController::stopPlannerTask()
+{
+    if (!_plannerTaskRunning)
+        return;
+    _plannerTaskStopReqd = true;
+#ifdef RAMPGEN_HOST_SIM
+    _plannerThread.join();
+#else
+    while (_plannerTaskRunning)
+        delay(1);
+#endif
+}
+
+void RobotController::plannerTaskFn(void* pArg)
+{
+    RobotController* pThis = (RobotController*)pArg;
+    pThis->_plannerProfiler.attachToThisThread();
+    while (true)
+    {
+        pThis->_plannerProfiler.loopStart();
+        pThis->plannerTaskService();
+
+        // Once a stop is requested the commands still queued are applied (as the robot can accept
+        // them) before the task stops - producers check the task is running with _cmdPutMutex held
+        // so nothing is queued after the queue is found empty and commands are then applied
+        // immediately (stop() discards queued commands)
+        if (pThis->_plannerTaskStopReqd)
+        {
+            std::lock_guard<std::mutex> lock(pThis->_robotMutex);
+            std::lock_guard<std::mutex> putLock(pThis->_cmdPutMutex);
+            if (!pThis->_pRobot)
+                pThis->clearCommands();
+            if (!pThis->_cmdQueue.canGet())
+            {
+                pThis->_plannerTaskRunning = false;
+                break;
+            }
+        }
+#ifdef RAMPGEN_HOST_SIM
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+#else
+        vTaskDelay(1);
+#endif
+    }
+#ifndef RAMPGEN_HOST_SIM
+    vTaskDelete(NULL);
+#endif
+}
+
+void RobotController::plannerTaskService()
+{
+    std::lock_guard<std::mutex> lock(_robotMutex);
+    if (!_pRobot)
+        return;
+    // Apply queued commands in order as the robot can accept them
+    RobotCommand cmd;
+    while (_cmdQueue.canGet() && _pRobot->canAcceptCommand())
+    {
+        LOOP_PROFILE_SCOPE("Command");
+        _cmdQueue.get(cmd);
+        applyCommand(cmd);
+    }
+    LOOP_PROFILE_SCOPE("Robot");
+    _motionHelper.setUpstreamWorkPending(_workQueued || _cmdQueue.canGet());
+    _pRobot->service();
+}
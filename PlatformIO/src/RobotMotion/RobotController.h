@@ -4,9 +4,21 @@
 #pragma once
 
 #include "MotionControl/MotionHelper.h"
+#include "MotionControl/MotionRingBuffer.h"
+#include "LoopProfiler.h"
+#include <atomic>
+#include <functional>
+#include <mutex>
+#ifdef RAMPGEN_HOST_SIM
+#include <thread>
+#endif
 
 class RobotBase;
 class RobotCommandArgs;
+class StatusSnapshot;
+
+// Starts or stops a point source (called with the robot mutex held)
+typedef std::function<void()> PointSourceFn;
 
 class RobotController
 {
@@ -14,6 +26,57 @@ private:
     RobotBase* _pRobot;
     MotionHelper _motionHelper;
 
+    // Held while the robot (planner, homing and point sources) is serviced or accessed
+    std::mutex _robotMutex;
+
+    // Commands which change motion are queued for the planner task (when it is running)
+    // and applied in order as the robot can accept them - the queue has a single consumer
+    // (the planner task, holding _robotMutex) and producers are serialised by _cmdPutMutex
+    // (which is also held while checking the task is running so nothing is queued once it stops)
+    enum RobotCommandType
+    {
+        ROBOT_CMD_MOVE_TO,
+        ROBOT_CMD_POINT_SOURCE,
+        ROBOT_CMD_MOTION_PARAMS,
+        ROBOT_CMD_GO_HOME,
+        ROBOT_CMD_SET_HOME,
+        ROBOT_CMD_ACTUATOR
+    };
+    struct RobotCommand
+    {
+        RobotCommandType _type;
+        RobotCommandArgs _args;
+        MotionPointSource* _pSource;
+        double _value;
+    };
+    static const int ROBOT_COMMAND_QUEUE_LEN = 10;
+    // Max time to wait for space in the queue before a command is rejected
+    static const uint32_t COMMAND_QUEUE_WAIT_MS = 100;
+    MotionRingBuffer<RobotCommand> _cmdQueue;
+    std::mutex _cmdPutMutex;
+    bool submitCommand(RobotCommandType type, RobotCommandArgs* pArgs, double value);
+    void waitForCommandSpace();
+    bool queueCommand(RobotCommand& cmd, bool& queued);
+    void applyCommand(RobotCommand& cmd);
+    void clearCommands();
+
+    // Planner task - pinned to the core the network stack doesn't use and at a priority above
+    // the main loop so that stalls in the loop (web, MQTT, file system) don't starve the pipeline
+    static const int PLANNER_TASK_CORE = 1;
+    static const int PLANNER_TASK_PRIORITY = 5;
+    static const int PLANNER_TASK_STACK_SIZE = 8192;
+    std::atomic<bool> _plannerTaskRunning;
+    LoopProfiler _plannerProfiler;
+    std::atomic<bool> _plannerTaskStopReqd;
+
+    // Motion waiting upstream (work items or busy evaluators) - set from the main loop
+    std::atomic<bool> _workQueued;
+#ifdef RAMPGEN_HOST_SIM
+    std::thread _plannerThread;
+#endif
+    static void plannerTaskFn(void* pArg);
+    void plannerTaskService();
+
 public:
     RobotController();
     ~RobotController();
@@ -28,33 +91,70 @@ public:
     // Check if paused
     bool isPaused();
 
-    // Service (called frequently)
+    // Service (called frequently) - does nothing when the planner task is running
     void service();
 
-    // Movement commands
-    void actuator(double value);
+    // Start the planner task which services the robot from then on - motion commands
+    // are queued for it rather than applied immediately
+    void startPlannerTask();
+    void stopPlannerTask();
+    bool isPlannerTaskRunning()
+    {
+        return _plannerTaskRunning;
+    }
+
+    // Movement commands - commands return false if rejected (the planner task's queue stayed full)
+    bool actuator(double value);
 
     // Check if the robot can accept a (motion) command
     bool canAcceptCommand();
 
-    void moveTo(RobotCommandArgs& args);
+    // Set by the work manager while it has motion waiting (work items queued or evaluators busy,
+    // e.g. playing a file) - a gap in the pipeline then counts as an underrun in the telemetry
+    void setWorkQueued(bool workQueued)
+    {
+        _workQueued = workQueued;
+    }
+
+    bool moveTo(RobotCommandArgs& args);
+
+    // Move through the points from a source (e.g. a theta-rho line) - the MotionHelper pulls them
+    // as needed (from the planner task if it is running) so startFn (re)starts the source with it
+    // detached and _robotMutex held
+    bool movePointSource(MotionPointSource& source, PointSourceFn startFn);
+
+    // Stop a point source - stopFn is called with the source detached and _robotMutex held
+    void stopPointSource(MotionPointSource& source, PointSourceFn stopFn);
 
     // Set motion parameters
-    void setMotionParams(RobotCommandArgs& args);
+    bool setMotionParams(RobotCommandArgs& args);
 
     // Get status
     void getCurStatus(RobotCommandArgs& args);
 
+    // Update the status snapshot
+    void updateStatus(StatusSnapshot& status);
+
     // Get robot attributes
     void getRobotAttributes(String& robotAttrs);
 
     // Go Home
-    void goHome(RobotCommandArgs& args);
+    bool goHome(RobotCommandArgs& args);
 
     // Set Home
-    void setHome(RobotCommandArgs& args);
+    bool setHome(RobotCommandArgs& args);
 
     bool wasActiveInLastNSeconds(int nSeconds);
 
     String getDebugStr();
+
+    // Pipeline underrun telemetry as JSON (optionally cleared after reading)
+    void getPipelineStats(String& statsJson, bool clearStats);
+
+#ifdef RAMPGEN_HOST_SIM
+    MotionHelper& simGetMotionHelper()
+    {
+        return _motionHelper;
+    }
+#endif
 };
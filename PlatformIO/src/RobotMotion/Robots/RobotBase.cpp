@@ -74,6 +74,11 @@ void RobotBase::getCurStatus(RobotCommandArgs &args)
     _motionHelper.getCurStatus(args);
 }
 
+void RobotBase::updateStatus(StatusSnapshot &status, int numCmdsWaiting)
+{
+    _motionHelper.updateStatus(status, numCmdsWaiting);
+}
+
 void RobotBase::getRobotAttributes(String& robotAttrs)
 {
     _motionHelper.getRobotAttributes(robotAttrs);
@@ -5,6 +5,7 @@
 
 class MotionHelper;
 class RobotCommandArgs;
+class StatusSnapshot;
 
 class RobotBase
 {
@@ -31,6 +32,7 @@ class RobotBase
     virtual void moveTo(RobotCommandArgs &args);
     virtual void setMotionParams(RobotCommandArgs &args);
     virtual void getCurStatus(RobotCommandArgs &args);
+    virtual void updateStatus(StatusSnapshot &status, int numCmdsWaiting);
     virtual void getRobotAttributes(String& robotAttrs);
     // Homing commands
     virtual void goHome(RobotCommandArgs &args);
@@ -5,6 +5,7 @@
 #include "RobotSandTableScara.h"
 #include "../MotionControl/MotionHelper.h"
 #include "Utils.h"
+#include "RdJson.h"
 #include "math.h"
 
 // #define DEBUG_SANDTABLESCARA_MOTION 1
@@ -23,12 +24,29 @@ static const char* MODULE_PREFIX = "SandTableScara: ";
 RobotSandTableScara::RobotSandTableScara(const char* pRobotTypeName, MotionHelper& motionHelper) :
     RobotBase(pRobotTypeName, motionHelper)
 {
-    // Set transforms
-    _motionHelper.setTransforms(ptToActuator, actuatorToPt, correctStepOverflow, convertCoords, setRobotAttributes);
+    _fastKinematics = false;
+
+    // Set transforms - point to actuator uses this robot's kinematics mode
+    _motionHelper.setTransforms(
+            [this](AxisFloats& targetPt, AxisFloats& outActuator, AxisPosition& curPos, AxesParams& axesParams, bool allowOutOfBounds) {
+                return ptToActuator(targetPt, outActuator, curPos, axesParams, allowOutOfBounds);
+            },
+            actuatorToPt, correctStepOverflow, convertCoords, setRobotAttributes);
 }
 
 RobotSandTableScara::~RobotSandTableScara()
 {
+    // Transforms mustn't refer to this robot once it has gone
+    _motionHelper.setTransforms(nullptr, nullptr, nullptr, nullptr, nullptr);
+}
+
+bool RobotSandTableScara::init(const char* robotConfigStr)
+{
+    // Kinematics mode
+    String robotGeom = RdJson::getString("robotGeom", "NONE", robotConfigStr);
+    _fastKinematics = RdJson::getLong("fastKinematics", 0, robotGeom.c_str()) != 0;
+    Log.notice("%sinit fastKinematics %s\n", MODULE_PREFIX, _fastKinematics ? "Y" : "N");
+    return RobotBase::init(robotConfigStr);
 }
 
 // Convert a cartesian point to actuator coordinates
@@ -71,8 +89,15 @@ bool RobotSandTableScara::ptToActuator(AxisFloats& targetPt, AxisFloats& outActu
         float a2Rel = calcRelativePolar(soln2.getVal(0), curPolar.getVal(0));
         float b2Rel = calcRelativePolar(soln2.getVal(1), curPolar.getVal(1));
 
-        // Which solution involves least overall rotation
-        if (abs(a1Rel) + abs(b1Rel) <= abs(a2Rel) + abs(b2Rel))
+        // Which solution involves least overall rotation - near a tie keep the elbow on the same
+        // side as now (soln1 has beta clockwise of alpha) as either implementation's rounding could
+        // otherwise decide it
+        float soln1Rotation = fabsf(a1Rel) + fabsf(b1Rel);
+        float soln2Rotation = fabsf(a2Rel) + fabsf(b2Rel);
+        bool useSoln1 = soln1Rotation <= soln2Rotation;
+        if (fabsf(soln1Rotation - soln2Rotation) <= IK_SOLN_HYSTERESIS_DEGS)
+            useSoln1 = calcRelativePolar(curPolar.getVal(1), curPolar.getVal(0)) >= 0;
+        if (useSoln1)
         {
             relativePolarSolution.setVal(0, a1Rel);
             relativePolarSolution.setVal(1, b1Rel);
@@ -168,36 +193,56 @@ bool RobotSandTableScara::cartesianToPolar(AxisFloats& targetPt, AxisFloats& tar
 	if (!axis1MaxValid)
 		elbowHandMM = 100;
 
+	// Squares are shared by the distance and both cosine rule calculations
+	float x = targetPt._pt[0];
+	float y = targetPt._pt[1];
+	float shoulderElbowSq = shoulderElbowMM * shoulderElbowMM;
+	float elbowHandSq = elbowHandMM * elbowHandMM;
+	float thirdSideSq = x * x + y * y;
+
 	// Calculate distance from origin to pt (forms one side of triangle where arm segments form other sides)
-	float thirdSideL3MM = sqrt(pow(targetPt._pt[0], 2) + pow(targetPt._pt[1], 2));
+	float thirdSideL3MM = sqrtf(thirdSideSq);
 
 	// Check validity of position
 	bool posValid = thirdSideL3MM <= shoulderElbowMM + elbowHandMM;
 
+	// Cosines of the angle of triangle opposite elbow-hand side and angle opposite third side
+	float cosDelta2 = (thirdSideSq + shoulderElbowSq - elbowHandSq) / (2 * thirdSideL3MM * shoulderElbowMM);
+	float cosGamma = (shoulderElbowSq + elbowHandSq - thirdSideSq) / (2 * shoulderElbowMM * elbowHandMM);
+	cosDelta2 = cosDelta2 > 1 ? 1 : (cosDelta2 < -1 ? -1 : cosDelta2);
+	cosGamma = cosGamma > 1 ? 1 : (cosGamma < -1 ? -1 : cosGamma);
+
 	// Calculate angle from North to the point (note in atan2 X and Y are flipped from normal as angles are clockwise)
-	float delta1 = atan2(targetPt._pt[0], targetPt._pt[1]);
+	// and the angles of the triangle
+	float delta1, delta2, innerAngleOppThirdGamma;
+	if (_fastKinematics)
+	{
+		delta1 = AxisUtils::fastAtan2(x, y);
+		delta2 = AxisUtils::fastAcos(cosDelta2);
+		innerAngleOppThirdGamma = AxisUtils::fastAcos(cosGamma);
+	}
+	else
+	{
+		delta1 = atan2f(x, y);
+		delta2 = acosf(cosDelta2);
+		innerAngleOppThirdGamma = acosf(cosGamma);
+	}
 	if (delta1 < 0)
-		delta1 += M_PI * 2;
-
-	// Calculate angle of triangle opposite elbow-hand side
-	float delta2 = AxisUtils::cosineRule(thirdSideL3MM, shoulderElbowMM, elbowHandMM);
-
-	// Calculate angle of triangle opposite third side
-	float innerAngleOppThirdGamma = AxisUtils::cosineRule(shoulderElbowMM, elbowHandMM, thirdSideL3MM);
+		delta1 += float(M_PI * 2);
 
 	// The two pairs of angles that solve these equations
 	// alpha is the angle from shoulder to elbow
 	// beta is angle from elbow to hand
 	float alpha1rads = delta1 - delta2;
-	float beta1rads = alpha1rads - innerAngleOppThirdGamma + M_PI;
+	float beta1rads = alpha1rads - innerAngleOppThirdGamma + float(M_PI);
 	float alpha2rads = delta1 + delta2;
-	float beta2rads = alpha2rads + innerAngleOppThirdGamma - M_PI;
+	float beta2rads = alpha2rads + innerAngleOppThirdGamma - float(M_PI);
 
-	// Calculate the alpha and beta angles in degrees
-	targetSoln1.setVal(0, AxisUtils::r2d(AxisUtils::wrapRadians(alpha1rads + 2 * M_PI)));
-	targetSoln1.setVal(1, AxisUtils::r2d(AxisUtils::wrapRadians(beta1rads + 2 * M_PI)));
-	targetSoln2.setVal(0, AxisUtils::r2d(AxisUtils::wrapRadians(alpha2rads + 2 * M_PI)));
-	targetSoln2.setVal(1, AxisUtils::r2d(AxisUtils::wrapRadians(beta2rads + 2 * M_PI)));
+	// Calculate the alpha and beta angles in degrees - all are within one turn either side of 0..2*PI
+	targetSoln1.setVal(0, wrapNearRadiansToDegrees(alpha1rads));
+	targetSoln1.setVal(1, wrapNearRadiansToDegrees(beta1rads));
+	targetSoln2.setVal(0, wrapNearRadiansToDegrees(alpha2rads));
+	targetSoln2.setVal(1, wrapNearRadiansToDegrees(beta2rads));
 
 #ifdef DEBUG_SANDTABLE_CARTESIAN_TO_POLAR
     Log.trace("%scartesianToPolar target X%F Y%F l1 %F, l2 %F\n", MODULE_PREFIX,
@@ -218,8 +263,10 @@ void RobotSandTableScara::stepsToPolar(AxisInt32s& actuatorCoords, AxisFloats& r
     // Axis 0 positive steps clockwise, axis 1 postive steps are anticlockwise
     // Axis 0 zero steps is at 0 degrees, axis 1 zero steps is at 180 degrees
     // All angles returned are in degrees clockwise from North
-    double axis0Degrees = AxisUtils::wrapDegrees(actuatorCoords.getVal(0) * 360 / axesParams.getStepsPerRot(0));
-    double axis1Degrees = AxisUtils::wrapDegrees(540 - (actuatorCoords.getVal(1) * 360 / axesParams.getStepsPerRot(1)));
+    float axis0Degrees = actuatorCoords.getVal(0) * 360 / axesParams.getStepsPerRot(0);
+    float axis1Degrees = 540 - (actuatorCoords.getVal(1) * 360 / axesParams.getStepsPerRot(1));
+    axis0Degrees -= 360 * floorf(axis0Degrees / 360);
+    axis1Degrees -= 360 * floorf(axis1Degrees / 360);
     rotationDegrees.set(axis0Degrees, axis1Degrees);
 #ifdef DEBUG_SANDTABLE_CARTESIAN_TO_POLAR
     Log.trace("%sstepsToPolar: ax0Steps %d ax1Steps %d a %Fd b %Fd\n", MODULE_PREFIX,
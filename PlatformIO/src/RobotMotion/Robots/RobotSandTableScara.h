@@ -32,10 +32,21 @@ public:
     RobotSandTableScara(const char* pRobotTypeName, MotionHelper& motionHelper);
     ~RobotSandTableScara();
 
-private:
+    // Init - robotGeom "fastKinematics" selects the polynomial atan2/acos (see AxisUtils) which
+    // keeps arm angles within FAST_KINEMATICS_MAX_ERR_DEGS of the libm result
+    virtual bool init(const char* robotConfigStr);
+    static constexpr float FAST_KINEMATICS_MAX_ERR_DEGS = 0.0005f;
+    void setFastKinematics(bool fastKinematics)
+    {
+        _fastKinematics = fastKinematics;
+    }
+
+    // When the two solutions need total rotations within this of each other the one with the elbow
+    // on the same side as the current pose is used (so rounding can't flip the arms over)
+    static constexpr float IK_SOLN_HYSTERESIS_DEGS = 0.5f;
 
     // Convert a cartesian point to actuator coordinates
-    static bool ptToActuator(AxisFloats& targetPt, AxisFloats& outActuator, 
+    bool ptToActuator(AxisFloats& targetPt, AxisFloats& outActuator, 
                 AxisPosition& curPos, AxesParams& axesParams, bool allowOutOfBounds);
 
     // Convert actuator values to cartesian point
@@ -51,11 +62,25 @@ private:
     // Set robot attributes
     static void setRobotAttributes(AxesParams& axesParams, String& robotAttributes);
 
-private:
-    static bool cartesianToPolar(AxisFloats& targetPt, AxisFloats& targetSoln1, 
+    // Convert a cartesian point to the two pairs of arm angles (degrees) which reach it
+    bool cartesianToPolar(AxisFloats& targetPt, AxisFloats& targetSoln1, 
                     AxisFloats& targetSoln2, AxesParams& axesParams);
+
+private:
+    // Kinematics mode
+    bool _fastKinematics;
+
     static void stepsToPolar(AxisInt32s& actuatorCoords, AxisFloats& rotationDegrees, AxesParams& axesParams);
     static float calcRelativePolar(float targetRotation, float curRotation);
+    static inline float wrapNearRadiansToDegrees(float angleRads)
+    {
+        // Angle must be within one turn of 0..2*PI
+        if (angleRads < 0)
+            angleRads += float(M_PI * 2);
+        else if (angleRads >= float(M_PI * 2))
+            angleRads -= float(M_PI * 2);
+        return angleRads * float(180 / M_PI);
+    }
     static void relativePolarToSteps(AxisFloats& relativePolar, AxisPosition& curAxisPositions, 
             AxisFloats& outActuator, AxesParams& axesParams);
 
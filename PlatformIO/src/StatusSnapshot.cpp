@@ -0,0 +1,207 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+#include <stdarg.h>
+#include "StatusSnapshot.h"
+#include "ArduinoLog.h"
+
+static const char* MODULE_PREFIX = "StatusSnapshot: ";
+
+StatusSnapshot::StatusSnapshot()
+{
+    for (int i = 0; i < NUM_FIELDS; i++)
+    {
+        _fieldJson[i][0] = 0;
+        _fieldLen[i] = 0;
+        _fieldSeq[i] = 0;
+    }
+    _seq = 0;
+    _moveRelative = false;
+    _numQueued = 0;
+    _isHoming = false;
+    _hasHomed = false;
+    _isPaused = false;
+    _ledChangeCount = 0;
+    _ledValid = false;
+    _pLedJson = NULL;
+    _systemHash = 0;
+    _systemValid = false;
+    _timeOfDay[0] = 0;
+    // Encode the initial values on the first update
+    _dirtyMask = (1 << NUM_FIELDS) - 1;
+}
+
+void StatusSnapshot::setSystem(unsigned long systemHash, const char* pSystemJson)
+{
+    _systemHash = systemHash;
+    _systemValid = true;
+    int len = strlen(pSystemJson);
+    if (len >= MAX_FIELD_LEN)
+    {
+        Log.warning("%ssystem status too long %d\n", MODULE_PREFIX, len);
+        len = 0;
+    }
+    if ((len == _fieldLen[FIELD_SYSTEM]) && (strncmp(_fieldJson[FIELD_SYSTEM], pSystemJson, len) == 0))
+        return;
+    memcpy(_fieldJson[FIELD_SYSTEM], pSystemJson, len);
+    _fieldJson[FIELD_SYSTEM][len] = 0;
+    _fieldLen[FIELD_SYSTEM] = len;
+    _dirtyMask |= (1 << FIELD_SYSTEM);
+}
+
+void StatusSnapshot::setTimeOfDay(const char* pTimeOfDay)
+{
+    if (!pTimeOfDay)
+        pTimeOfDay = "";
+    if (strncmp(_timeOfDay, pTimeOfDay, MAX_TIME_OF_DAY_LEN - 1) == 0)
+        return;
+    strncpy(_timeOfDay, pTimeOfDay, MAX_TIME_OF_DAY_LEN - 1);
+    _timeOfDay[MAX_TIME_OF_DAY_LEN - 1] = 0;
+    _dirtyMask |= (1 << FIELD_TIME_OF_DAY);
+}
+
+bool StatusSnapshot::update()
+{
+    if (_dirtyMask == 0)
+        return false;
+    _seq++;
+    for (int i = 0; i < NUM_FIELDS; i++)
+    {
+        if ((_dirtyMask & (1 << i)) == 0)
+            continue;
+        encodeField(i);
+        _fieldSeq[i] = _seq;
+    }
+    _dirtyMask = 0;
+    return true;
+}
+
+// Append formatted text to a buffer - false if it doesn't fit
+static bool appendJSON(char* pBuf, int bufLen, int& len, const char* pFormat, ...)
+{
+    va_list args;
+    va_start(args, pFormat);
+    int added = vsnprintf(pBuf + len, bufLen - len, pFormat, args);
+    va_end(args);
+    if ((added < 0) || (added >= bufLen - len))
+        return false;
+    len += added;
+    return true;
+}
+
+void StatusSnapshot::encodeField(int fieldIdx)
+{
+    char* pBuf = _fieldJson[fieldIdx];
+    int len = 0;
+    bool fits = true;
+    switch (fieldIdx)
+    {
+        case FIELD_SYSTEM:
+            // Copied when set
+            return;
+        case FIELD_POSITION:
+            fits &= appendJSON(pBuf, MAX_FIELD_LEN, len, "\"XYZ\":[");
+            for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+                fits &= appendJSON(pBuf, MAX_FIELD_LEN, len, "%s%.2f", axisIdx != 0 ? "," : "",
+                            _posMM.getValNoCk(axisIdx));
+            fits &= appendJSON(pBuf, MAX_FIELD_LEN, len, "],\"ABC\":[");
+            for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+                fits &= appendJSON(pBuf, MAX_FIELD_LEN, len, "%s%d", axisIdx != 0 ? "," : "",
+                            _posSteps.getVal(axisIdx));
+            fits &= appendJSON(pBuf, MAX_FIELD_LEN, len, "]");
+            break;
+        case FIELD_MOVE_TYPE:
+            fits &= appendJSON(pBuf, MAX_FIELD_LEN, len, "\"mv\":\"%s\",\"OoB\":\"N\",\"num\":%d",
+                        _moveRelative ? "rel" : "abs", RobotConsts::NUMBERED_COMMAND_NONE);
+            break;
+        case FIELD_END_STOPS:
+            fits &= appendJSON(pBuf, MAX_FIELD_LEN, len, "\"end\":[");
+            for (int axisIdx = 0; axisIdx < RobotConsts::MAX_AXES; axisIdx++)
+            {
+                fits &= appendJSON(pBuf, MAX_FIELD_LEN, len, "%s[", axisIdx != 0 ? "," : "");
+                for (int endStopIdx = 0; endStopIdx < RobotConsts::MAX_ENDSTOPS_PER_AXIS; endStopIdx++)
+                    fits &= appendJSON(pBuf, MAX_FIELD_LEN, len, "%s%d", endStopIdx != 0 ? "," : "",
+                                int(_endStops.get(axisIdx, endStopIdx)));
+                fits &= appendJSON(pBuf, MAX_FIELD_LEN, len, "]");
+            }
+            fits &= appendJSON(pBuf, MAX_FIELD_LEN, len, "]");
+            break;
+        case FIELD_QUEUED:
+            fits &= appendJSON(pBuf, MAX_FIELD_LEN, len, "\"Qd\":%d", _numQueued);
+            break;
+        case FIELD_HOMING:
+            fits &= appendJSON(pBuf, MAX_FIELD_LEN, len, "\"Hmd\":%d,\"Homing\":%d", _hasHomed ? 1 : 0,
+                        _isHoming ? 1 : 0);
+            break;
+        case FIELD_PAUSE:
+            fits &= appendJSON(pBuf, MAX_FIELD_LEN, len, "\"pause\":%d", _isPaused ? 1 : 0);
+            break;
+        case FIELD_LED:
+        {
+            // LED config object without its braces
+            int ledLen = _pLedJson ? strlen(_pLedJson) : 0;
+            if (ledLen > 2)
+                fits &= appendJSON(pBuf, MAX_FIELD_LEN, len, "%.*s", ledLen - 2, _pLedJson + 1);
+            break;
+        }
+        case FIELD_TIME_OF_DAY:
+            if (_timeOfDay[0])
+                fits &= appendJSON(pBuf, MAX_FIELD_LEN, len, "\"tod\":\"%s\"", _timeOfDay);
+            break;
+    }
+    if (!fits)
+    {
+        Log.warning("%sfield %d too long\n", MODULE_PREFIX, fieldIdx);
+        len = 0;
+    }
+    pBuf[len] = 0;
+    _fieldLen[fieldIdx] = len;
+}
+
+uint32_t StatusSnapshot::getFieldsSince(uint32_t sinceSeq)
+{
+    uint32_t fieldMask = 0;
+    for (int i = 0; i < NUM_FIELDS; i++)
+        if ((_fieldLen[i] != 0) && ((sinceSeq == 0) || (_fieldSeq[i] > sinceSeq) || (i == FIELD_PAUSE)))
+            fieldMask |= (1 << i);
+    return fieldMask;
+}
+
+const char* StatusSnapshot::getJSON(uint32_t sinceSeq)
+{
+    uint32_t fieldMask = getFieldsSince(sinceSeq);
+    int len = 0;
+    _jsonBuf[len++] = '{';
+    for (int i = 0; i < NUM_FIELDS; i++)
+    {
+        if ((fieldMask & (1 << i)) == 0)
+            continue;
+        memcpy(_jsonBuf + len, _fieldJson[i], _fieldLen[i]);
+        len += _fieldLen[i];
+        _jsonBuf[len++] = ',';
+    }
+    snprintf(_jsonBuf + len, MAX_JSON_LEN - len, "\"seq\":%u}", (unsigned)_seq);
+    return _jsonBuf;
+}
+
+void StatusSnapshot::getJSON(String& jsonStr, uint32_t sinceSeq)
+{
+    uint32_t fieldMask = getFieldsSince(sinceSeq);
+    int len = 0;
+    for (int i = 0; i < NUM_FIELDS; i++)
+        if (fieldMask & (1 << i))
+            len += _fieldLen[i] + 1;
+    char seqStr[24];
+    snprintf(seqStr, sizeof(seqStr), "\"seq\":%u}", (unsigned)_seq);
+    jsonStr = "";
+    jsonStr.reserve(len + strlen(seqStr) + 1);
+    jsonStr += "{";
+    for (int i = 0; i < NUM_FIELDS; i++)
+    {
+        if ((fieldMask & (1 << i)) == 0)
+            continue;
+        jsonStr += _fieldJson[i];
+        jsonStr += ",";
+    }
+    jsonStr += seqStr;
+}
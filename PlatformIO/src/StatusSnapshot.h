@@ -0,0 +1,155 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Status snapshot - the status JSON is held as a fixed buffer per field and the producers (motion
+// position, queue count, pause, homing, LED, system and time of day) set a field's dirty bit
+// when its value changes - update() re-encodes only the dirty fields and bumps the sequence
+// number so that a delta (the fields changed since a sequence number) can be sent
+// Not thread-safe - the owner serialises setters, update and getJSON
+
+#pragma once
+
+#include <Arduino.h>
+#include "AxisValues.h"
+
+class StatusSnapshot
+{
+public:
+    enum StatusField
+    {
+        FIELD_SYSTEM,
+        FIELD_POSITION,
+        FIELD_MOVE_TYPE,
+        FIELD_END_STOPS,
+        FIELD_QUEUED,
+        FIELD_HOMING,
+        FIELD_PAUSE,
+        FIELD_LED,
+        FIELD_TIME_OF_DAY,
+        NUM_FIELDS
+    };
+
+    // Longest encoding of a field (a field which doesn't fit is left out)
+    static const int MAX_FIELD_LEN = 200;
+    // Longest status JSON
+    static const int MAX_JSON_LEN = NUM_FIELDS * (MAX_FIELD_LEN + 1) + 32;
+
+    StatusSnapshot();
+
+    // Producers - each sets the field's dirty bit if the value changed
+    void setPosition(AxisFloats& posMM, AxisInt32s& posSteps)
+    {
+        if ((_posMM != posMM) || (_posSteps != posSteps))
+        {
+            _posMM = posMM;
+            _posSteps = posSteps;
+            _dirtyMask |= (1 << FIELD_POSITION);
+        }
+    }
+    void setMoveRelative(bool moveRelative)
+    {
+        if (_moveRelative != moveRelative)
+        {
+            _moveRelative = moveRelative;
+            _dirtyMask |= (1 << FIELD_MOVE_TYPE);
+        }
+    }
+    void setEndStops(AxisMinMaxBools& endStops)
+    {
+        if (_endStops != endStops)
+        {
+            _endStops = endStops;
+            _dirtyMask |= (1 << FIELD_END_STOPS);
+        }
+    }
+    void setNumQueued(int numQueued)
+    {
+        if (_numQueued != numQueued)
+        {
+            _numQueued = numQueued;
+            _dirtyMask |= (1 << FIELD_QUEUED);
+        }
+    }
+    void setHoming(bool isHoming, bool hasHomed)
+    {
+        if ((_isHoming != isHoming) || (_hasHomed != hasHomed))
+        {
+            _isHoming = isHoming;
+            _hasHomed = hasHomed;
+            _dirtyMask |= (1 << FIELD_HOMING);
+        }
+    }
+    void setPause(bool isPaused)
+    {
+        if (_isPaused != isPaused)
+        {
+            _isPaused = isPaused;
+            _dirtyMask |= (1 << FIELD_PAUSE);
+        }
+    }
+    // The LED config is only read (on update) if its change count differs
+    void setLed(uint32_t ledChangeCount, const char* pLedJson)
+    {
+        if (!_ledValid || (_ledChangeCount != ledChangeCount))
+        {
+            _ledChangeCount = ledChangeCount;
+            _ledValid = true;
+            _pLedJson = pLedJson;
+            _dirtyMask |= (1 << FIELD_LED);
+        }
+    }
+    // System health JSON (without braces) is copied so it only needs to be generated when the
+    // hash changes (or to refresh values which aren't in the hash)
+    bool isSystemHashChanged(unsigned long systemHash)
+    {
+        return !_systemValid || (_systemHash != systemHash);
+    }
+    void setSystem(unsigned long systemHash, const char* pSystemJson);
+    // Time of day string (NULL or empty if not known)
+    void setTimeOfDay(const char* pTimeOfDay);
+
+    // Re-encode dirty fields - returns true if anything changed (and the sequence number
+    // was bumped)
+    bool update();
+    uint32_t getSeq()
+    {
+        return _seq;
+    }
+
+    // Status JSON with the fields changed since sinceSeq (all fields if sinceSeq is 0) and
+    // the sequence number - pause is always included as clients treat it as required
+    // The pointer is to an internal buffer valid until the next call
+    const char* getJSON(uint32_t sinceSeq);
+    void getJSON(String& jsonStr, uint32_t sinceSeq);
+
+private:
+    // Encoded fields (without braces) and the sequence number when each last changed
+    char _fieldJson[NUM_FIELDS][MAX_FIELD_LEN];
+    uint16_t _fieldLen[NUM_FIELDS];
+    uint32_t _fieldSeq[NUM_FIELDS];
+    uint32_t _dirtyMask;
+    uint32_t _seq;
+
+    // Values last set
+    AxisFloats _posMM;
+    AxisInt32s _posSteps;
+    bool _moveRelative;
+    AxisMinMaxBools _endStops;
+    int _numQueued;
+    bool _isHoming;
+    bool _hasHomed;
+    bool _isPaused;
+    uint32_t _ledChangeCount;
+    bool _ledValid;
+    const char* _pLedJson;
+    unsigned long _systemHash;
+    bool _systemValid;
+    static const int MAX_TIME_OF_DAY_LEN = 24;
+    char _timeOfDay[MAX_TIME_OF_DAY_LEN];
+
+    // JSON output
+    char _jsonBuf[MAX_JSON_LEN];
+
+    void encodeField(int fieldIdx);
+    uint32_t getFieldsSince(uint32_t sinceSeq);
+};
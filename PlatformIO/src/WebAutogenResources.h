@@ -4,6081 +4,1665 @@
 
 #include "WebServerResource.h"
 
-static const uint8_t __webAutogenResource_index_html[] PROGMEM {
-    0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6d,0x6c,0x3e,
-    0x0a,0x3c,0x68,0x74,0x6d,0x6c,0x20,0x6c,0x61,0x6e,0x67,0x3d,0x22,0x65,0x6e,0x22,
-    0x3e,0x0a,0x3c,0x68,0x65,0x61,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x6d,0x65,
-    0x74,0x61,0x20,0x63,0x68,0x61,0x72,0x73,0x65,0x74,0x3d,0x22,0x75,0x74,0x66,0x2d,
-    0x38,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x6d,0x65,0x74,0x61,0x20,0x68,0x74,
-    0x74,0x70,0x2d,0x65,0x71,0x75,0x69,0x76,0x3d,0x22,0x58,0x2d,0x55,0x41,0x2d,0x43,
-    0x6f,0x6d,0x70,0x61,0x74,0x69,0x62,0x6c,0x65,0x22,0x20,0x63,0x6f,0x6e,0x74,0x65,
-    0x6e,0x74,0x3d,0x22,0x49,0x45,0x3d,0x65,0x64,0x67,0x65,0x22,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x3c,0x6d,0x65,0x74,0x61,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,
-    0x65,0x77,0x70,0x6f,0x72,0x74,0x22,0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3d,
-    0x22,0x77,0x69,0x64,0x74,0x68,0x3d,0x64,0x65,0x76,0x69,0x63,0x65,0x2d,0x77,0x69,
-    0x64,0x74,0x68,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x6d,0x65,0x74,0x61,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x61,0x70,0x70,0x6c,0x65,0x2d,0x6d,0x6f,0x62,0x69,
-    0x6c,0x65,0x2d,0x77,0x65,0x62,0x2d,0x61,0x70,0x70,0x2d,0x63,0x61,0x70,0x61,0x62,
-    0x6c,0x65,0x22,0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3d,0x22,0x79,0x65,0x73,
-    0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x6d,0x65,0x74,0x61,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x64,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6f,0x6e,0x22,0x20,
-    0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3d,0x22,0x57,0x65,0x62,0x55,0x49,0x20,0x66,
-    0x6f,0x72,0x20,0x52,0x42,0x6f,0x74,0x46,0x69,0x72,0x6d,0x77,0x61,0x72,0x65,0x22,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x6d,0x65,0x74,0x61,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x61,0x75,0x74,0x68,0x6f,0x72,0x22,0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,
-    0x74,0x3d,0x22,0x52,0x6f,0x62,0x20,0x44,0x6f,0x62,0x73,0x6f,0x6e,0x22,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x3c,0x74,0x69,0x74,0x6c,0x65,0x20,0x69,0x64,0x3d,0x22,0x74,
-    0x69,0x74,0x6c,0x65,0x22,0x3e,0x73,0x61,0x6e,0x64,0x42,0x6f,0x74,0x3c,0x2f,0x74,
-    0x69,0x74,0x6c,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x73,0x63,0x72,0x69,0x70,
-    0x74,0x3e,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x62,0x6f,0x64,0x79,0x49,
-    0x73,0x4c,0x6f,0x61,0x64,0x65,0x64,0x28,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,
-    0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x42,0x6f,0x64,0x79,0x20,0x6c,0x6f,0x61,0x64,
-    0x65,0x64,0x22,0x29,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,
-    0x61,0x74,0x65,0x3d,0x7b,0x72,0x75,0x6e,0x49,0x6e,0x54,0x65,0x73,0x74,0x4d,0x6f,
-    0x64,0x65,0x3a,0x22,0x6c,0x6f,0x63,0x61,0x6c,0x68,0x6f,0x73,0x74,0x22,0x3d,0x3d,
-    0x3d,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2e,0x68,0x6f,0x73,0x74,0x6e,0x61,
-    0x6d,0x65,0x7c,0x7c,0x22,0x31,0x32,0x37,0x2e,0x30,0x2e,0x30,0x2e,0x31,0x22,0x3d,
-    0x3d,0x3d,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2e,0x68,0x6f,0x73,0x74,0x6e,
-    0x61,0x6d,0x65,0x7c,0x7c,0x22,0x22,0x3d,0x3d,0x3d,0x6c,0x6f,0x63,0x61,0x74,0x69,
-    0x6f,0x6e,0x2e,0x68,0x6f,0x73,0x74,0x6e,0x61,0x6d,0x65,0x7d,0x2c,0x77,0x69,0x6e,
-    0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x72,0x75,0x6e,0x49,
-    0x6e,0x54,0x65,0x73,0x74,0x4d,0x6f,0x64,0x65,0x3f,0x28,0x64,0x6f,0x63,0x75,0x6d,
-    0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,
-    0x49,0x64,0x28,0x22,0x73,0x70,0x6c,0x61,0x73,0x68,0x50,0x61,0x67,0x65,0x54,0x65,
-    0x78,0x74,0x22,0x29,0x2c,0x73,0x70,0x6c,0x61,0x73,0x68,0x50,0x61,0x67,0x65,0x54,
-    0x65,0x78,0x74,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x22,0x49,
-    0x20,0x6d,0x75,0x73,0x74,0x20,0x72,0x75,0x6e,0x20,0x6f,0x6e,0x20,0x61,0x20,0x73,
-    0x65,0x72,0x76,0x65,0x72,0x21,0x22,0x29,0x3a,0x63,0x61,0x6c,0x6c,0x41,0x6a,0x61,
-    0x78,0x28,0x22,0x2f,0x67,0x65,0x74,0x73,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x22,
-    0x2c,0x73,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,
-    0x6b,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x65,0x74,0x74,
-    0x69,0x6e,0x67,0x73,0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x28,0x6f,0x29,0x7b,
-    0x6c,0x65,0x74,0x20,0x65,0x3d,0x7b,0x7d,0x3b,0x74,0x72,0x79,0x7b,0x65,0x3d,0x4a,
-    0x53,0x4f,0x4e,0x2e,0x70,0x61,0x72,0x73,0x65,0x28,0x6f,0x29,0x7d,0x63,0x61,0x74,
-    0x63,0x68,0x28,0x65,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x65,0x72,
-    0x72,0x6f,0x72,0x28,0x22,0x46,0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,0x20,0x70,
-    0x61,0x72,0x73,0x65,0x20,0x4a,0x53,0x4f,0x4e,0x20,0x73,0x65,0x74,0x74,0x69,0x6e,
-    0x67,0x73,0x20,0x22,0x2b,0x6f,0x29,0x2c,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,
-    0x65,0x72,0x72,0x6f,0x72,0x28,0x65,0x29,0x7d,0x6e,0x75,0x6c,0x6c,0x21,0x3d,0x3d,
-    0x65,0x2e,0x75,0x69,0x54,0x79,0x70,0x65,0x26,0x26,0x22,0x73,0x61,0x6e,0x64,0x22,
-    0x3d,0x3d,0x3d,0x65,0x2e,0x75,0x69,0x54,0x79,0x70,0x65,0x7c,0x7c,0x65,0x2e,0x72,
-    0x6f,0x62,0x6f,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x26,0x26,0x65,0x2e,0x72,0x6f,
-    0x62,0x6f,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x2e,0x77,0x65,0x62,0x75,0x69,0x26,
-    0x26,0x22,0x73,0x61,0x6e,0x64,0x22,0x3d,0x3d,0x3d,0x65,0x2e,0x72,0x6f,0x62,0x6f,
-    0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x2e,0x77,0x65,0x62,0x75,0x69,0x2e,0x74,0x6f,
-    0x4c,0x6f,0x77,0x65,0x72,0x43,0x61,0x73,0x65,0x28,0x29,0x3f,0x77,0x69,0x6e,0x64,
-    0x6f,0x77,0x2e,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2e,0x72,0x65,0x70,0x6c,
-    0x61,0x63,0x65,0x28,0x22,0x73,0x61,0x6e,0x64,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x29,
-    0x3a,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
-    0x2e,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x28,0x22,0x63,0x6e,0x63,0x2e,0x68,0x74,
-    0x6d,0x6c,0x22,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x63,0x61,
-    0x6c,0x6c,0x41,0x6a,0x61,0x78,0x28,0x65,0x2c,0x6f,0x2c,0x74,0x29,0x7b,0x76,0x61,
-    0x72,0x20,0x6e,0x3d,0x6e,0x65,0x77,0x20,0x58,0x4d,0x4c,0x48,0x74,0x74,0x70,0x52,
-    0x65,0x71,0x75,0x65,0x73,0x74,0x3b,0x6e,0x2e,0x6f,0x6e,0x72,0x65,0x61,0x64,0x79,
-    0x73,0x74,0x61,0x74,0x65,0x63,0x68,0x61,0x6e,0x67,0x65,0x3d,0x66,0x75,0x6e,0x63,
-    0x74,0x69,0x6f,0x6e,0x28,0x29,0x7b,0x34,0x3d,0x3d,0x3d,0x6e,0x2e,0x72,0x65,0x61,
-    0x64,0x79,0x53,0x74,0x61,0x74,0x65,0x26,0x26,0x28,0x32,0x30,0x30,0x3d,0x3d,0x3d,
-    0x6e,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x3f,0x76,0x6f,0x69,0x64,0x20,0x30,0x21,
-    0x3d,0x3d,0x6f,0x26,0x26,0x6f,0x28,0x6e,0x2e,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,
-    0x65,0x54,0x65,0x78,0x74,0x29,0x3a,0x76,0x6f,0x69,0x64,0x20,0x30,0x21,0x3d,0x3d,
-    0x74,0x26,0x26,0x74,0x28,0x6e,0x29,0x29,0x7d,0x2c,0x6e,0x2e,0x6f,0x70,0x65,0x6e,
-    0x28,0x22,0x47,0x45,0x54,0x22,0x2c,0x65,0x2c,0x21,0x30,0x29,0x2c,0x6e,0x2e,0x73,
-    0x65,0x6e,0x64,0x28,0x29,0x7d,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0a,
-    0x3c,0x2f,0x68,0x65,0x61,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x73,0x74,0x79,
-    0x6c,0x65,0x3e,0x62,0x6f,0x64,0x79,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,
-    0x69,0x6c,0x79,0x3a,0x22,0x48,0x65,0x6c,0x76,0x65,0x74,0x69,0x63,0x61,0x20,0x4e,
-    0x65,0x75,0x65,0x22,0x2c,0x48,0x65,0x6c,0x76,0x65,0x74,0x69,0x63,0x61,0x2c,0x41,
-    0x72,0x69,0x61,0x6c,0x2c,0x73,0x61,0x6e,0x73,0x2d,0x73,0x65,0x72,0x69,0x66,0x3b,
-    0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x34,0x70,0x78,0x3b,0x6c,
-    0x69,0x6e,0x65,0x2d,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x31,0x2e,0x34,0x7d,0x23,
-    0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,
-    0x79,0x3a,0x66,0x6c,0x65,0x78,0x3b,0x66,0x6c,0x65,0x78,0x2d,0x77,0x72,0x61,0x70,
-    0x3a,0x77,0x72,0x61,0x70,0x7d,0x3c,0x2f,0x73,0x74,0x79,0x6c,0x65,0x3e,0x0a,0x0a,
-    0x0a,0x3c,0x62,0x6f,0x64,0x79,0x20,0x6f,0x6e,0x6c,0x6f,0x61,0x64,0x3d,0x22,0x62,
-    0x6f,0x64,0x79,0x49,0x73,0x4c,0x6f,0x61,0x64,0x65,0x64,0x28,0x65,0x76,0x65,0x6e,
-    0x74,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x0a,0x20,0x20,0x20,0x20,0x3c,0x64,
-    0x69,0x76,0x20,0x69,0x64,0x3d,0x22,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,
-    0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x20,0x69,0x64,
-    0x3d,0x22,0x73,0x70,0x6c,0x61,0x73,0x68,0x50,0x61,0x67,0x65,0x54,0x65,0x78,0x74,
-    0x22,0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,
-    0x3e,0x0a,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,0x2f,0x68,0x74,0x6d,0x6c,
-    0x3e,0x0a
+// cnc.html 51085 bytes (gzip 12110 bytes)
+static const uint8_t __webAutogenResource_cnc_html[] PROGMEM {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xed,0x7d,0xf9,0x7b,0xa2,0x48,
+    0xb7,0xf0,0xcf,0xef,0xfc,0x15,0x0c,0xef,0x73,0x67,0xf4,0xba,0x01,0x8a,0x4b,0xd2,
+    0x76,0x3f,0x6e,0x31,0x26,0x6e,0x71,0x49,0xd4,0x79,0xfb,0xeb,0x07,0xa1,0x14,0x22,
+    0x82,0x01,0xdc,0x92,0xce,0xff,0x7e,0x4f,0x15,0xa0,0xa8,0x68,0x96,0xc9,0xcc,0xed,
+    0xfb,0x4d,0x4f,0x4f,0x14,0x6a,0x39,0x75,0xea,0x6c,0x75,0xce,0x29,0x28,0x7f,0xf9,
+    0xf4,0x6b,0xb1,0x51,0xe8,0xf4,0x9b,0x25,0x4a,0xb6,0xa6,0xea,0xe7,0x5f,0x3e,0xe1,
+    0x2f,0x4a,0x15,0xb4,0x71,0x96,0x46,0x1a,0x8d,0x0b,0x90,0x20,0x7d,0xfe,0x85,0x82,
+    0xff,0x3e,0x4d,0x91,0x25,0x50,0xa2,0x2c,0x18,0x26,0xb2,0xb2,0xf4,0xdc,0x1a,0x45,
+    0xd2,0xb4,0xb7,0x4a,0xb6,0xac,0x59,0x04,0x3d,0xcc,0x95,0x45,0x96,0xee,0x45,0xba,
+    0xb9,0x48,0x41,0x9f,0xce,0x04,0x4b,0x19,0xaa,0x88,0xa6,0x44,0x5d,0xb3,0x90,0x06,
+    0xfd,0x2a,0xa5,0x2c,0x92,0xc6,0x68,0xa7,0xa7,0x26,0x4c,0x51,0x96,0x5e,0x28,0x68,
+    0x39,0xd3,0x0d,0xcb,0xd3,0x78,0xa9,0x48,0x96,0x9c,0x95,0xd0,0x42,0x11,0x51,0x84,
+    0xdc,0xf8,0xf4,0x13,0x66,0x33,0x15,0x45,0xa6,0xfa,0x50,0x81,0xaf,0x25,0x1a,0x46,
+    0xa0,0x20,0x22,0x0a,0x33,0x61,0x77,0xe0,0x35,0x32,0x7d,0x3a,0x4b,0xc8,0x14,0x0d,
+    0x65,0x66,0x29,0xba,0xe6,0x69,0x7b,0x87,0x86,0xdd,0x0a,0x35,0xd2,0x0d,0xaa,0x95,
+    0xd7,0xad,0x0b,0xc5,0x98,0x2e,0x05,0x03,0x51,0x85,0x7a,0xc1,0x6f,0xfc,0xb9,0x25,
+    0xeb,0x86,0xa7,0x77,0x4b,0x1f,0x52,0x45,0x7d,0x68,0xea,0x98,0x82,0x76,0x73,0x4b,
+    0xb1,0x54,0x44,0x29,0x52,0x96,0x26,0x57,0xf4,0x67,0x53,0xd0,0x24,0x00,0xfd,0x29,
+    0x46,0xee,0x1d,0xa0,0xaa,0xa2,0x4d,0x28,0x03,0xa9,0x59,0xda,0x04,0x88,0x96,0x38,
+    0xb7,0x28,0x45,0xc4,0x88,0x59,0xeb,0x19,0x0c,0xa4,0x4c,0x85,0x31,0x8a,0xad,0x22,
+    0x76,0x99,0x6c,0xa0,0x11,0xe0,0x2f,0x58,0xc2,0x99,0xb7,0xe2,0x3c,0xec,0xa2,0x68,
+    0x4f,0xec,0x33,0x94,0x99,0x16,0x35,0x12,0x16,0x15,0xb8,0x02,0xd4,0x74,0xab,0xa1,
+    0x21,0x2a,0xfb,0x0b,0xad,0xdc,0xe6,0x1b,0xad,0x25,0x73,0x5d,0x1e,0xeb,0x39,0xf8,
+    0xaf,0xde,0xee,0xca,0xa5,0xee,0x18,0xae,0x0a,0xf8,0x36,0x37,0x2e,0xe4,0xfa,0xf0,
+    0x95,0x7f,0x44,0x9a,0xc1,0x90,0x92,0x5e,0xbd,0xdd,0x62,0x2a,0x39,0xc3,0x4c,0x88,
+    0xc9,0x1b,0xb8,0xaf,0xb4,0xd4,0xbb,0x92,0x3a,0xed,0x74,0x99,0xdc,0xf5,0x98,0x74,
+    0xc9,0xe5,0x6f,0x4a,0xed,0x5c,0xae,0x86,0x6f,0xf2,0xb9,0x5c,0x09,0xbe,0x4a,0x42,
+    0x2e,0xd7,0x75,0xee,0x73,0xb9,0xf6,0xb8,0x34,0xf4,0xde,0x77,0xc7,0x25,0x7d,0xdb,
+    0xbe,0x02,0xff,0x4b,0xb3,0x5c,0xee,0x66,0x53,0x7f,0x47,0xe0,0xe2,0xff,0xaa,0x06,
+    0xf9,0xc2,0x55,0x73,0xd3,0xa9,0x6f,0x8c,0xe1,0xbe,0xe8,0x94,0xc3,0x7d,0x61,0x0c,
+    0x28,0x94,0x36,0xed,0x0a,0x70,0xbf,0xf4,0xde,0xdb,0x90,0xd6,0x28,0x54,0xe6,0x97,
+    0xf8,0x4a,0x5d,0xb6,0x2f,0xd4,0x47,0x00,0xb5,0x4e,0x40,0xbd,0x38,0x2f,0xe5,0x7b,
+    0x57,0x33,0xb9,0x84,0xc7,0xbc,0x55,0x67,0xb7,0x17,0x32,0x73,0x57,0x62,0x6b,0x8d,
+    0x69,0x7d,0x31,0x6c,0xf3,0xf2,0xa0,0x9c,0x51,0x06,0x6d,0x3e,0x31,0xec,0x39,0x28,
+    0x15,0x57,0x89,0x86,0x26,0x5b,0x62,0x99,0x55,0xa5,0x72,0x69,0x8c,0xca,0xac,0x39,
+    0xd4,0x6a,0x49,0x54,0x64,0x94,0xfe,0x5d,0x6b,0xd1,0x9f,0x76,0x93,0xf8,0x7e,0x78,
+    0x77,0xcb,0xf4,0xdb,0x69,0xa5,0x72,0x39,0x4e,0x42,0x9b,0xa5,0x54,0x36,0x33,0x15,
+    0x55,0xae,0x77,0x0b,0xf9,0xe2,0x30,0x7e,0xa5,0x56,0x8a,0xfd,0x79,0xad,0x90,0x58,
+    0x56,0xee,0x13,0xd7,0x95,0x42,0x6e,0xdc,0xbc,0xbc,0x9a,0x0c,0xee,0x67,0xed,0x56,
+    0xa9,0xbf,0x81,0x29,0x4e,0x5b,0xd3,0x66,0xfb,0x4a,0x97,0x2e,0x5b,0xcb,0x86,0x92,
+    0x5e,0x48,0x71,0x29,0x5e,0xd5,0xc4,0xc7,0xea,0x34,0xb3,0x1e,0xac,0xd3,0xab,0x46,
+    0x67,0xc2,0x57,0x1f,0x73,0xeb,0xea,0x63,0x65,0x5d,0xed,0x41,0x7f,0x85,0x7d,0x44,
+    0x77,0x3c,0xd3,0xef,0x8d,0x2d,0xe8,0x7f,0xef,0xc2,0xf6,0xc0,0x2f,0x0d,0x7a,0xf5,
+    0x7b,0x71,0xaa,0x02,0x3e,0xea,0x62,0xa8,0xe4,0xd7,0x83,0x72,0x3f,0xd9,0xbf,0xbb,
+    0x5a,0x48,0xbd,0x9b,0x4c,0x45,0xa9,0x6c,0xda,0xbb,0x7f,0x2e,0x2e,0xd0,0x7e,0x3a,
+    0xb8,0x67,0x14,0xe1,0xb2,0xc5,0x88,0x45,0x7d,0x51,0xe5,0x78,0xc0,0xe3,0x62,0x32,
+    0xe4,0xae,0xd4,0x2a,0xa1,0x55,0x86,0x11,0xee,0x06,0xd3,0xea,0x63,0x09,0xe6,0x95,
+    0x56,0x9a,0x63,0xdd,0x0b,0x27,0x6d,0xf7,0x9f,0x35,0x61,0x6c,0x75,0xa8,0xb5,0x64,
+    0x32,0xfe,0x7d,0x62,0xd5,0x2c,0xd8,0xfd,0x1a,0x93,0xcc,0x5a,0xb8,0xbb,0x9d,0x4b,
+    0xe5,0x0b,0xb8,0xcf,0xcc,0x3d,0xfd,0xd3,0xd5,0xb8,0x0f,0xee,0x2e,0xdd,0x0a,0x19,
+    0x32,0x87,0xee,0xa4,0x55,0x86,0x3e,0xd0,0xd6,0xa6,0x37,0xa1,0x7f,0x27,0x71,0x5d,
+    0xbe,0x4d,0xc9,0x79,0xe0,0x7b,0x9e,0x6f,0x5d,0xb5,0x4a,0x17,0xdd,0xbb,0xdc,0xb4,
+    0xae,0x8e,0xe7,0x35,0xad,0xdb,0xbd,0x5d,0xc5,0x32,0xf1,0xf9,0x7a,0x25,0x71,0x6b,
+    0x8e,0x29,0xa8,0x6d,0xb9,0xc8,0xdc,0xdc,0x70,0x4a,0xbe,0xf5,0x70,0x5d,0x6c,0x4b,
+    0x63,0xb3,0x7b,0x37,0xad,0xd5,0xee,0x63,0x72,0xae,0xb2,0x6c,0x17,0x4a,0xf7,0x5d,
+    0xf9,0x6a,0x3a,0x2b,0xd5,0xfa,0x95,0x7e,0x25,0x56,0xb6,0x84,0x7c,0xb7,0xcd,0xcc,
+    0x72,0x37,0x4a,0xf3,0xae,0x75,0x5b,0x5a,0xcb,0x52,0x13,0x0d,0xe7,0x19,0xb3,0x70,
+    0xcd,0x16,0xe4,0x6e,0xe5,0x41,0x55,0xcb,0xf1,0xa2,0xbe,0x0e,0x2d,0xad,0xd6,0x1d,
+    0x97,0x1a,0x0e,0xe3,0xe9,0x18,0x1a,0x85,0xd0,0x10,0x25,0x57,0x42,0xfd,0x2a,0x36,
+    0x0d,0x4d,0x3b,0x9a,0xf6,0x58,0x54,0xb5,0xc7,0xa9,0x55,0x0e,0x19,0xa1,0xb1,0x51,
+    0x9a,0xc6,0xa5,0xd2,0x7d,0x75,0xf5,0xd0,0x5b,0x19,0x1d,0x61,0xb0,0x8a,0xdd,0xb4,
+    0x9b,0x66,0xba,0xde,0x59,0xad,0x6f,0x57,0x5a,0xc1,0xbc,0x28,0x0e,0x97,0xcd,0xb6,
+    0x21,0x75,0x51,0xa9,0x6d,0x74,0x6a,0xab,0xd8,0x75,0x26,0x56,0xab,0x65,0xe4,0x8b,
+    0xe2,0x28,0x34,0xe1,0x16,0xec,0xa0,0xa1,0xdd,0xe4,0x2f,0x0b,0x97,0xa1,0xe6,0xa0,
+    0x62,0x8d,0xb8,0xab,0x47,0x76,0xc9,0xb1,0x93,0x61,0xb7,0x9d,0x0c,0x4d,0x80,0x34,
+    0x33,0x94,0xb0,0x98,0xe4,0xb4,0x72,0x27,0xc5,0xae,0xa4,0x0a,0xcf,0x3c,0x2a,0x93,
+    0xb2,0xa4,0x0a,0x77,0xe3,0xfb,0x71,0x61,0x34,0x28,0x30,0x5a,0xed,0xa1,0x29,0x2f,
+    0xdb,0x93,0xca,0x4d,0xb7,0x78,0x5f,0x93,0x87,0x5a,0x7a,0xc6,0x4c,0x2e,0x45,0x76,
+    0x3c,0x67,0x86,0x31,0x59,0xbc,0xd6,0xa6,0xa3,0x55,0x2b,0x69,0xac,0x9a,0x53,0x03,
+    0xd5,0x1b,0x77,0xc5,0x7b,0x94,0xc9,0xcb,0x65,0xe9,0x72,0x9c,0x43,0x5a,0xa9,0x96,
+    0xbc,0xed,0x19,0xfc,0x6d,0x52,0xcd,0x18,0x37,0x31,0xee,0x3a,0x57,0x8f,0x0d,0xd6,
+    0x49,0x59,0xd7,0x92,0x45,0x33,0xaf,0x77,0xd0,0x38,0x79,0xbd,0x68,0x4b,0xc5,0x4e,
+    0xa8,0x94,0xbe,0x48,0x49,0xc9,0xfc,0xb2,0xc6,0x37,0xa5,0xee,0x58,0x9c,0x57,0x05,
+    0xa9,0xda,0xe2,0x99,0xf9,0xe2,0x66,0xd1,0xbd,0x5d,0x0c,0xbb,0xc3,0x59,0x75,0x1a,
+    0xe3,0x73,0xad,0xb2,0x38,0x4f,0xce,0xea,0xda,0x18,0x88,0x50,0xd2,0x9b,0x0d,0x35,
+    0x2d,0x2c,0x56,0xeb,0xc6,0xa2,0xb2,0xba,0xca,0x9b,0xd7,0x8d,0x9b,0x3b,0x3e,0x3f,
+    0x1e,0x74,0xd9,0xc7,0x8b,0x99,0x96,0xa9,0x2c,0x97,0xe3,0x7a,0x23,0xa6,0xce,0x13,
+    0x1d,0xeb,0xf2,0x6e,0xaa,0xf5,0xee,0x13,0x97,0xa1,0x6e,0x32,0x2f,0x0f,0xea,0xca,
+    0x30,0x54,0x99,0xdf,0x32,0x4a,0x3d,0xf1,0xd8,0x2b,0xc6,0xb8,0x4c,0x55,0x1f,0xa5,
+    0xca,0x93,0x89,0x26,0xdd,0x17,0x32,0x48,0x5c,0xf5,0xe4,0xde,0x43,0x2c,0x3f,0x14,
+    0x6e,0x1a,0xd7,0x97,0xa9,0xc1,0xba,0x73,0x7f,0xc3,0x3c,0x88,0x93,0xbb,0xab,0x34,
+    0x37,0x29,0x87,0xea,0x17,0x68,0xbd,0x4c,0x77,0x0b,0x93,0xd9,0x2c,0x7f,0xd7,0x28,
+    0xf1,0xc5,0x78,0x68,0x99,0x37,0xaa,0x97,0x00,0xab,0x54,0x16,0x97,0x37,0xc3,0xcb,
+    0x85,0xc1,0x8b,0xc8,0xba,0xa8,0x8d,0xd6,0x62,0x29,0xc5,0x58,0x89,0xd8,0x9a,0x31,
+    0xef,0xcb,0x21,0x2b,0xbd,0x7e,0xbc,0x17,0x33,0xc3,0xe1,0xbc,0x9a,0xbf,0x46,0x66,
+    0x69,0x3d,0x9a,0xb5,0x13,0xaa,0x76,0xab,0x0d,0xe7,0x9d,0x78,0x3b,0x1d,0xea,0xb3,
+    0xea,0x42,0xd6,0xaa,0xdd,0xc1,0x52,0xe3,0x6e,0x33,0x62,0xeb,0x81,0xed,0x94,0xae,
+    0x42,0x4b,0x65,0x28,0x72,0x93,0x41,0x69,0x3d,0x5c,0x3f,0x0e,0x6e,0x90,0x68,0x01,
+    0xb3,0xf3,0x7c,0x5a,0x9d,0x8d,0x87,0xa1,0x49,0xa8,0xb4,0x8a,0x5f,0x2c,0xda,0xb9,
+    0xe6,0xa2,0x93,0x1a,0x9b,0x46,0x4c,0x99,0x5a,0xb5,0x49,0x39,0x5e,0x59,0x29,0x85,
+    0x74,0x42,0x1d,0xa8,0x52,0x33,0x96,0x6a,0x33,0x7c,0x77,0xfa,0x90,0xe4,0x9a,0xed,
+    0x9b,0xfb,0xab,0x79,0xa7,0x1f,0x63,0x12,0x83,0x72,0x77,0x92,0xbb,0x10,0x1e,0x0a,
+    0x8d,0xda,0xa2,0x31,0x46,0xaa,0x22,0xa4,0x97,0xd3,0x29,0x37,0x5e,0x98,0xdc,0x25,
+    0xcf,0x0f,0x6e,0x4a,0xd3,0x46,0xa5,0x2e,0x2f,0x2b,0x9d,0x8e,0x74,0x6d,0xb2,0xb9,
+    0xd1,0xbc,0xf1,0x58,0x12,0x6e,0xe7,0xf7,0xc5,0x72,0x57,0x48,0x76,0xe3,0xcd,0x81,
+    0x7a,0xcf,0xb7,0x64,0x39,0x97,0x98,0x3d,0xce,0xba,0x6a,0x91,0x31,0xf8,0x4c,0xed,
+    0x72,0x55,0x99,0xcf,0x8b,0x83,0x8b,0xea,0xe8,0xb1,0x7d,0xad,0xe7,0x6b,0xc6,0x60,
+    0xa5,0x3e,0xb6,0xac,0x8e,0xd5,0xb6,0xea,0x3c,0x2f,0xa7,0xb9,0x61,0x42,0xbb,0x78,
+    0x7c,0x9c,0x0d,0xa6,0xa5,0xc1,0xdc,0xea,0x74,0x2d,0x51,0x65,0x26,0x52,0xe5,0x56,
+    0x33,0xe5,0xc1,0x3d,0x77,0x5b,0x1b,0x25,0xf8,0xe4,0x4d,0x7e,0xc4,0x66,0xb4,0x59,
+    0xa5,0xde,0x1f,0x2e,0x73,0x73,0x71,0xd0,0x69,0xcb,0xa1,0xeb,0x39,0x13,0x9f,0xa6,
+    0x78,0x71,0x52,0x61,0x27,0xc9,0x7e,0xef,0xf2,0x9a,0x4f,0x3f,0xde,0x77,0x0a,0x5d,
+    0xfe,0xf1,0x36,0x9e,0xaf,0x68,0xe3,0x34,0xca,0x87,0xd8,0xb8,0x0a,0x38,0x94,0xc4,
+    0xd0,0x64,0xd0,0xcc,0x0f,0x27,0x4c,0x3b,0x9f,0xca,0xa7,0xf9,0x4a,0xa3,0x99,0x96,
+    0xb4,0x69,0xe5,0x32,0xad,0x3c,0x34,0xaf,0x2f,0xd6,0x42,0xcd,0x4a,0x5a,0xcc,0xac,
+    0x60,0xf4,0x7b,0xb9,0xbb,0xfb,0x72,0xa6,0xd2,0x59,0x97,0xc7,0xf3,0xc2,0x65,0x2b,
+    0x76,0x39,0x2a,0x34,0x16,0x17,0xeb,0xc4,0x78,0xd6,0x94,0x17,0xbd,0xf6,0x24,0x56,
+    0xbc,0x85,0xe6,0x21,0xad,0xd8,0x94,0x63,0x46,0x3b,0x16,0x4b,0x54,0xef,0x62,0xea,
+    0x78,0xb6,0x8c,0xdf,0xf7,0xcb,0xad,0x98,0x7c,0x9d,0x9c,0xde,0x27,0x65,0x69,0xc6,
+    0xf5,0x2d,0xf5,0x42,0x2b,0xea,0xd2,0xf4,0xba,0x32,0x8d,0x49,0x69,0x85,0x2f,0xa6,
+    0x6b,0x56,0xd9,0x0c,0x5d,0x35,0x2e,0x67,0xfd,0x34,0x6a,0x5f,0xd7,0x3a,0x5d,0x65,
+    0x3c,0x4f,0xf1,0x7d,0x71,0x22,0x0e,0x2e,0x14,0x21,0x83,0x6e,0x07,0xdd,0xd4,0x45,
+    0x6a,0x3a,0x2b,0xca,0x35,0x43,0xb8,0x92,0xcb,0xb9,0x95,0x79,0x9b,0x97,0x3b,0x8b,
+    0x99,0xd0,0x6b,0xa8,0x6c,0x6a,0xb4,0x36,0xc6,0x69,0x51,0xba,0x59,0x56,0x2e,0x56,
+    0x0d,0x2e,0xdd,0x79,0x50,0x97,0x7d,0x10,0x3b,0x96,0xbf,0x4e,0x4f,0x2f,0xd3,0xf3,
+    0xca,0x75,0xb2,0x62,0xb6,0x87,0xe3,0x0b,0x8b,0xab,0x17,0x57,0x37,0xc6,0x72,0xcd,
+    0x16,0x4b,0xac,0x21,0xb1,0x57,0x45,0x74,0x9b,0xb8,0x6f,0x56,0x12,0xe5,0xd9,0x68,
+    0x55,0x4f,0x26,0x87,0x89,0x16,0xd3,0x37,0x73,0xb5,0xa2,0x60,0xdc,0x9b,0xa9,0xbb,
+    0x41,0x7f,0x32,0xa8,0x4c,0xe6,0x49,0x9e,0xeb,0xb5,0xae,0xfa,0x31,0x65,0x75,0x3b,
+    0x6e,0x96,0xe7,0x85,0x7c,0xaf,0x2d,0xf6,0x42,0x37,0x1d,0x6d,0x9c,0xab,0xc4,0x13,
+    0x37,0xbc,0x78,0x3b,0x52,0x5a,0xc5,0xd2,0x83,0xb4,0xee,0x89,0xe5,0xd4,0xbd,0xac,
+    0xf3,0xb3,0x6b,0x54,0x03,0xbd,0xbc,0x63,0x63,0xa1,0x46,0x43,0x5d,0x0f,0x95,0x75,
+    0x3f,0x59,0x8f,0x6b,0x17,0x21,0x71,0x11,0x4a,0xcc,0x27,0xea,0xd5,0x14,0xcd,0x53,
+    0xd2,0x43,0x99,0xe9,0x3f,0xce,0x2b,0xf5,0x56,0xc9,0x2a,0x3c,0x3e,0x26,0xea,0x77,
+    0xda,0xba,0xd7,0x98,0xb2,0x6a,0xb2,0x97,0xe1,0xf5,0xee,0xe2,0x26,0x35,0x49,0x94,
+    0x6f,0xd7,0xf7,0xab,0x62,0x25,0xc1,0x2a,0x77,0xf5,0x61,0xad,0x73,0xdd,0x4b,0xcf,
+    0xfa,0x2b,0xab,0xc1,0xcf,0xaa,0x2b,0x31,0x15,0x2a,0xd6,0x78,0xad,0xba,0x5a,0x4e,
+    0x6f,0x5b,0x37,0x92,0x08,0x26,0x43,0x56,0xac,0x4b,0x53,0xb2,0x46,0xac,0xb0,0x9a,
+    0x56,0x56,0xfc,0x9d,0xa2,0x8f,0xfa,0xd3,0xb4,0x7e,0x95,0x4b,0x69,0x4c,0xca,0x58,
+    0x8c,0xef,0x4a,0xf7,0x7c,0xd1,0xba,0xaa,0x27,0x2e,0x1f,0xee,0x0b,0x02,0xb3,0x50,
+    0xf3,0x42,0x5b,0x97,0xb9,0x4a,0x32,0xce,0x1b,0xb7,0xbc,0x5e,0x2a,0x0f,0x42,0xa1,
+    0xf5,0xa5,0x1c,0x5b,0xc6,0xca,0x37,0x8b,0xab,0x4c,0xa9,0x9f,0x5a,0xae,0x3a,0x0f,
+    0xac,0x5c,0x79,0xe8,0x15,0x9b,0x43,0x89,0xaf,0x15,0xe3,0xda,0xb8,0xdd,0x96,0xa6,
+    0x23,0x39,0xc7,0x8b,0xf7,0xd5,0xe2,0x28,0xb1,0xd2,0x1e,0x47,0x4c,0x5d,0x68,0x5d,
+    0xd5,0xd7,0xc3,0xc7,0x72,0x97,0x8d,0x5d,0xf1,0xb1,0xcb,0xba,0xb8,0xb2,0x42,0xd7,
+    0xed,0x51,0xf1,0x3e,0x3e,0xe0,0xcc,0xe2,0x38,0x26,0x8f,0xc5,0xc4,0x95,0x5c,0x29,
+    0x08,0xa9,0xbc,0x3a,0xab,0x75,0x54,0x59,0x2b,0x2a,0xec,0xc3,0x2c,0xa1,0x71,0x6a,
+    0x6d,0xc2,0x0a,0x17,0x29,0x33,0x37,0x95,0x27,0xbc,0x78,0x13,0x4b,0xa7,0xc7,0xe5,
+    0xb2,0x39,0xd5,0x66,0x5c,0x2d,0xde,0x9b,0x18,0x71,0x43,0xbf,0x5f,0x00,0x2b,0x63,
+    0xcb,0xcc,0x3a,0x24,0xa7,0xae,0x51,0xcc,0x9a,0x62,0x0b,0x37,0xeb,0xcd,0xc1,0x68,
+    0xf6,0xa4,0x7a,0xb1,0xb5,0x4e,0xa2,0xab,0xfa,0xe5,0x6d,0x69,0x7e,0xd7,0x2f,0xf5,
+    0xa6,0x65,0x31,0x11,0x92,0xbb,0x57,0x33,0xe6,0x7e,0x71,0xd3,0xba,0xbc,0xee,0xf5,
+    0xae,0x43,0xc5,0x75,0xe2,0x9a,0xcf,0x5d,0x14,0x32,0xdc,0x7a,0xa2,0x98,0x8a,0xc4,
+    0x8d,0xc5,0x4a,0x3c,0xdd,0x9c,0xac,0xca,0xd7,0xb3,0x4c,0x68,0x58,0x9a,0xae,0xd2,
+    0xcb,0x7b,0x29,0x3d,0x59,0x72,0x7a,0x6c,0x82,0x86,0xca,0xbc,0x07,0x76,0x19,0xcd,
+    0xba,0xc6,0xbc,0xd7,0x6e,0xab,0xa6,0x34,0xe8,0xdd,0x36,0xd8,0xc7,0xf4,0xfd,0x03,
+    0x23,0xde,0x88,0x37,0x8b,0xa6,0x9e,0x6a,0x99,0x50,0xb3,0x8a,0xab,0xa6,0x99,0x6e,
+    0x57,0x1f,0xc4,0x98,0xda,0x65,0x2e,0xf9,0x6a,0x7e,0xd6,0x5a,0x0c,0xa6,0x99,0x4c,
+    0xab,0x5d,0x9d,0x3e,0xce,0xc7,0x97,0xeb,0xbb,0xe6,0x78,0xd4,0xea,0x69,0x0a,0x33,
+    0xc9,0xdf,0xa6,0x94,0xa2,0x2c,0xa5,0x4a,0x5a,0x39,0xf4,0x28,0x96,0xeb,0xec,0xf5,
+    0x3a,0x69,0xd5,0x8b,0xc5,0x7e,0xa1,0x88,0x94,0xde,0xf5,0xc3,0x94,0x2b,0x36,0x86,
+    0xcb,0x72,0x57,0x6f,0x5c,0x96,0xd3,0xc9,0x5b,0xde,0x8c,0x0f,0x84,0x41,0xf3,0x71,
+    0xd5,0xef,0x49,0x97,0xbd,0x2b,0x94,0xac,0x14,0x53,0xd2,0x55,0x99,0x8b,0xe7,0x3a,
+    0x37,0x93,0x81,0xc0,0x73,0xb3,0xce,0x4a,0xe4,0x66,0xad,0x81,0x34,0x2a,0x72,0xd5,
+    0x61,0x22,0x5e,0xaf,0xaa,0x0f,0xf2,0xd8,0x6c,0xb2,0x6a,0xac,0xdd,0x48,0xe7,0xe2,
+    0x83,0xfa,0xda,0x6c,0xb1,0xb3,0x8b,0x7b,0x79,0x91,0x58,0xdc,0xea,0x82,0x35,0x54,
+    0xe3,0x83,0x5a,0xfb,0xf1,0x62,0x54,0x9e,0x4a,0xc5,0xde,0xd8,0xac,0x49,0x0f,0x0f,
+    0x97,0xd7,0x99,0x50,0x49,0x99,0xde,0x68,0x97,0x89,0x01,0x8b,0x32,0x17,0xc9,0xab,
+    0xc7,0xbb,0x81,0xd6,0x4c,0x09,0xad,0x61,0x23,0x11,0x33,0x79,0xe9,0xf2,0x5e,0xa9,
+    0x70,0xfd,0xdb,0xfe,0x60,0x7e,0x37,0x68,0xf4,0x8a,0xa1,0x6b,0xa1,0x7e,0xb1,0xaa,
+    0xa4,0xc1,0x55,0x5b,0xdf,0x35,0xaa,0x85,0x7a,0xa6,0xdf,0xa9,0x4f,0xaf,0x5a,0xbd,
+    0xd2,0x30,0x3f,0x1f,0xb4,0xee,0xba,0xa3,0x05,0x6b,0x89,0x5a,0xd2,0x42,0x82,0xac,
+    0x8f,0xee,0xa7,0xd5,0x5a,0xe1,0xa2,0x27,0x55,0x47,0xcb,0xd2,0x5d,0x0f,0x56,0xd7,
+    0xc4,0x8d,0x65,0x2c,0x46,0xe9,0xc4,0x80,0x67,0x87,0xfd,0x5b,0x6d,0xda,0x8e,0x4d,
+    0x2f,0x96,0x77,0x77,0x23,0xbe,0x74,0x7b,0x19,0xeb,0xe5,0xef,0xca,0x10,0x78,0xd4,
+    0x9a,0x6b,0xe9,0x76,0xce,0x2f,0x0c,0x8d,0xc9,0xcd,0xaa,0xe3,0xd4,0x30,0x74,0x93,
+    0x5a,0xa7,0xee,0x50,0xfd,0x61,0xb9,0x10,0xc4,0xc5,0xb8,0xdb,0x32,0x3a,0xea,0x4d,
+    0x37,0x55,0xa9,0xe5,0x9b,0x82,0x58,0xee,0x8d,0xef,0x33,0xd6,0xa4,0xcb,0xaa,0x97,
+    0x37,0xb9,0xfb,0x76,0x9a,0x5f,0x4f,0x43,0xe5,0x69,0xf5,0xe2,0xda,0x92,0x8b,0xd5,
+    0x7a,0x91,0xcf,0xad,0x50,0xdc,0x6a,0x2a,0xeb,0x54,0xc3,0xe4,0xca,0x96,0x36,0xba,
+    0x2e,0xa6,0xb5,0x8b,0xd8,0x85,0xf1,0x58,0xbf,0xbc,0x4e,0xad,0xea,0x9d,0xcb,0xc1,
+    0x85,0x5e,0x5d,0xf0,0x85,0x56,0x62,0x74,0x25,0x65,0x8c,0xc9,0xb4,0x36,0x32,0xcb,
+    0x79,0x0d,0x25,0x93,0x37,0x9d,0x66,0xb7,0xd3,0x9c,0xf7,0xf3,0x99,0xdc,0x63,0xe3,
+    0xf2,0x31,0xd6,0xba,0xac,0x57,0x13,0xcd,0x85,0x3c,0x9f,0x19,0xeb,0x8b,0xf4,0xe4,
+    0xf1,0xda,0x58,0x0c,0x8c,0x15,0x33,0xec,0x97,0x42,0x17,0xcd,0x41,0x23,0x31,0x9b,
+    0xde,0x35,0x6b,0x4a,0x7e,0x54,0x1e,0x5b,0xb1,0x50,0xa6,0xbd,0x18,0xb4,0x42,0xb7,
+    0x66,0xba,0xc7,0xaf,0x97,0x96,0xc4,0xc9,0x0b,0x70,0x26,0x91,0xc9,0x58,0xe3,0xc9,
+    0x7a,0xbc,0x0a,0xdd,0x5e,0x33,0xa1,0xe9,0x38,0x13,0xaf,0x87,0xb8,0xd0,0x3c,0x53,
+    0xbc,0x12,0xaf,0x10,0xc7,0x8e,0x3b,0x97,0x6a,0x43,0xe1,0xcb,0x72,0xd3,0xc8,0x08,
+    0x97,0x39,0xa5,0xd3,0xe1,0x50,0xe7,0xfe,0x61,0x78,0x6f,0xca,0x99,0xee,0xf5,0x55,
+    0xba,0xac,0xa6,0x4a,0x23,0x83,0xe3,0xe5,0x4a,0x8a,0x1f,0xdd,0x1a,0xd6,0x03,0x2c,
+    0x55,0xf1,0x0b,0xa6,0xcf,0x97,0x46,0xb5,0x89,0x94,0x9f,0x8e,0x2b,0x2a,0xd7,0xe3,
+    0xc0,0x5d,0x10,0xd3,0xf7,0x99,0xe2,0xa2,0xdd,0x58,0x95,0x92,0x85,0x29,0xd3,0x53,
+    0x6e,0xc5,0xe1,0x60,0x5e,0x1d,0x96,0x50,0x57,0x5d,0x4f,0xcd,0x47,0x74,0x21,0x2e,
+    0x53,0xcb,0x6b,0xb6,0x38,0xd4,0x47,0xc6,0x8c,0x8b,0x25,0x66,0x55,0x88,0x2b,0xae,
+    0x96,0xeb,0xb2,0xb0,0x6a,0x0c,0xd3,0xf5,0x92,0x31,0xcc,0x34,0xd3,0xfd,0xdc,0x64,
+    0xf5,0xd8,0x4b,0x26,0x99,0x96,0xd9,0xbc,0xab,0xcb,0xd2,0x0a,0x5d,0x72,0x52,0x7e,
+    0x31,0x40,0x9a,0xd8,0x5a,0x28,0xc2,0x38,0x39,0xc9,0xc5,0x17,0x89,0x04,0x4a,0x09,
+    0x89,0x58,0x2e,0xbd,0x6a,0x9a,0x63,0xb1,0x3c,0x32,0xf3,0xb7,0x52,0x3e,0xc4,0x95,
+    0xd6,0x29,0xf3,0x7e,0x15,0x67,0xeb,0x46,0xbc,0x18,0x57,0x96,0xad,0x61,0x86,0xf8,
+    0xf8,0x25,0xf5,0xa2,0x33,0x69,0xcf,0x6f,0xa6,0x85,0x02,0x1d,0xfe,0x45,0xd2,0xc5,
+    0x4b,0x08,0x88,0xb3,0xf0,0x3d,0x9f,0x42,0xac,0x17,0x1d,0x23,0xab,0xa4,0x22,0x7c,
+    0x69,0xe6,0xd7,0x1d,0x61,0x5c,0x87,0x88,0x30,0x40,0xe3,0xa0,0x99,0x0e,0xfe,0xc1,
+    0x7c,0x0d,0x6b,0x68,0x59,0x85,0xa0,0x6e,0xdb,0x41,0x34,0x90,0x60,0x21,0xa7,0x4f,
+    0x80,0xc6,0x11,0x1f,0x1d,0x3c,0x1f,0xcd,0x35,0x11,0x87,0xa0,0xd4,0x50,0x97,0xd6,
+    0x15,0xb3,0xaa,0x0b,0x12,0x92,0x02,0xc1,0x27,0x1c,0xbb,0xe9,0x2a,0x8a,0xaa,0xfa,
+    0x38,0x40,0xe7,0xa1,0x8e,0x52,0x49,0x15,0x1d,0x0c,0x2f,0x15,0x4d,0xd2,0x97,0xd1,
+    0x19,0x44,0x7e,0x6d,0x0b,0x40,0x66,0x9f,0x46,0x10,0xff,0x76,0xf4,0xb6,0x05,0x23,
+    0x4c,0xcf,0xb4,0xb9,0xaa,0x86,0x4d,0x72,0xad,0x68,0xe3,0x8a,0xd6,0x34,0xf4,0xb1,
+    0x81,0x4c,0xf3,0xec,0x57,0x36,0x5c,0xcb,0xf5,0xbe,0x35,0x1b,0xed,0xce,0xb7,0xc2,
+    0x65,0xb7,0x7e,0xfd,0xad,0x5d,0x19,0x94,0xce,0x58,0x14,0x0f,0xb7,0x3b,0xad,0x52,
+    0xae,0x56,0xa9,0x97,0xbf,0xb5,0x4a,0x9d,0x56,0xff,0x5b,0xa7,0x52,0x2b,0x7d,0xab,
+    0xb5,0x49,0x1d,0xee,0x63,0xd7,0x7f,0x2b,0x17,0x1a,0xc5,0x12,0x69,0x52,0x29,0x41,
+    0x65,0x9a,0x21,0x95,0x17,0x95,0x6a,0xc9,0x06,0xc5,0xa1,0x24,0x29,0x29,0x34,0xea,
+    0x17,0x95,0xf2,0xb7,0x6a,0xa9,0x0e,0x45,0xf1,0xb0,0xb0,0x52,0x4c,0x4c,0x1e,0xf3,
+    0xec,0x0f,0xba,0x47,0x87,0xe9,0x3e,0xfc,0x0d,0xe8,0xaf,0x61,0xa4,0x49,0xa6,0xa5,
+    0xcf,0xdc,0x2a,0x40,0x17,0x2a,0xa6,0xc2,0x0a,0xaa,0x0c,0x1c,0xad,0x76,0x20,0xf6,
+    0x85,0x8a,0xaf,0x61,0x13,0x59,0x16,0xcc,0xc5,0x3c,0x7b,0x7a,0x0e,0x2b,0x66,0x41,
+    0xd7,0x34,0x70,0x8f,0x90,0x84,0x67,0x34,0x9f,0x41,0x1c,0x8c,0x2e,0x80,0x00,0x66,
+    0x45,0x93,0xd0,0xea,0x8c,0x09,0x8b,0x73,0x03,0xdf,0x57,0x15,0xd3,0xc2,0x9d,0x31,
+    0x71,0x8a,0x8a,0x00,0x84,0xc4,0xf0,0xce,0x68,0x7c,0x6f,0xae,0x4d,0x0b,0x4d,0x69,
+    0xe8,0x8d,0xa9,0xba,0xa1,0x10,0xb4,0x56,0x01,0x9a,0x69,0x8d,0x9c,0xfe,0x15,0x6d,
+    0xa4,0xe3,0x41,0xf1,0x7d,0x9b,0xf4,0xc9,0x0b,0x26,0x6a,0x0a,0x96,0x7c,0x46,0xd3,
+    0xd0,0xd6,0xb4,0x30,0x07,0xe6,0x66,0x6b,0xd5,0x51,0xa6,0xe8,0x0c,0x78,0x4e,0x15,
+    0x01,0x00,0x90,0x1f,0x97,0x76,0x09,0x6e,0x05,0x19,0x89,0x93,0x9a,0x49,0x28,0xe1,
+    0x2d,0xef,0xe8,0x7a,0x15,0xbe,0xa0,0x86,0xe5,0x51,0xfc,0x39,0xec,0x23,0x59,0xf9,
+    0x75,0x45,0x0a,0xd0,0x8a,0x36,0x9b,0x5b,0xdf,0x30,0x0a,0xdf,0x6c,0x7c,0xe9,0x60,
+    0x54,0x90,0xa4,0xd2,0x02,0x5a,0x60,0x24,0x91,0x86,0x8c,0x00,0x2d,0xca,0x82,0x36,
+    0x46,0x34,0x41,0xb5,0x4b,0x9a,0x15,0x48,0x49,0xf8,0x57,0x36,0x78,0x1c,0xf6,0x58,
+    0xd4,0x25,0xd4,0x46,0x38,0x23,0xb1,0xf2,0x05,0x3b,0x41,0xeb,0x19,0xa6,0x0d,0x1d,
+    0x86,0xab,0x26,0xbe,0xaa,0x68,0xe5,0x02,0x74,0x82,0x0e,0x04,0xb4,0x28,0xa8,0x6a,
+    0xee,0x5e,0x58,0x05,0xe8,0x18,0x00,0x77,0x39,0x45,0x6f,0x78,0x56,0x80,0xfa,0xa1,
+    0x20,0x4e,0xf6,0x5b,0xb6,0x36,0x1c,0xa6,0x3d,0xdc,0xde,0xb6,0x76,0x59,0x60,0x13,
+    0x2b,0x00,0xdd,0x6d,0xb6,0x13,0xfc,0x4c,0xb8,0x87,0x01,0x2a,0x9a,0x85,0x8c,0x85,
+    0xa0,0x06,0x76,0xe8,0x0a,0x9c,0x30,0x2e,0x05,0x4d,0x52,0x91,0x71,0xa0,0x2b,0x51,
+    0x1f,0xce,0x10,0x50,0xb8,0x97,0x3e,0xb7,0x02,0x80,0x99,0xcd,0xd2,0x30,0xcb,0x30,
+    0xc1,0xe7,0x8d,0x7a,0x6e,0xca,0xb1,0x6e,0x6e,0x27,0x62,0x83,0xa3,0x1d,0xc6,0x6e,
+    0xb0,0xdf,0xf6,0x3b,0x86,0x19,0x80,0x59,0x08,0x06,0x85,0xce,0x5d,0x99,0x89,0x1c,
+    0xa0,0xba,0x2f,0x5e,0x9f,0x4f,0x4e,0x66,0x23,0x4e,0xbf,0xfd,0x16,0x08,0xa0,0xec,
+    0x51,0x8e,0x0f,0xe7,0x96,0xa5,0x6b,0x11,0x87,0x9a,0x74,0x30,0x18,0x95,0x14,0x13,
+    0x27,0xcc,0xa4,0x2c,0xa8,0x13,0x8a,0x8a,0x30,0xac,0x89,0x09,0x1f,0x35,0xd0,0x54,
+    0x5f,0x80,0x4d,0x73,0xeb,0xa1,0xed,0xfe,0xbc,0xdc,0x09,0x07,0x50,0xf0,0xe9,0x00,
+    0x3b,0x8f,0xa6,0x66,0x7f,0x65,0xce,0xf1,0x74,0xad,0xd7,0xe3,0x75,0x6e,0x79,0x10,
+    0x63,0xc2,0x96,0x07,0x31,0x90,0x52,0x2f,0x56,0xe1,0x17,0x29,0x97,0x75,0x89,0x7c,
+    0xae,0x22,0x8b,0x12,0xb2,0x4f,0xcf,0xe7,0x96,0xb1,0x7e,0x12,0xb2,0x57,0xed,0x46,
+    0x1d,0xfa,0x19,0x26,0x82,0x19,0x3c,0x8b,0x82,0x25,0xca,0x78,0x2a,0xae,0xf1,0x45,
+    0x86,0xa1,0x83,0x0e,0x5c,0x08,0x20,0x8b,0x12,0x65,0xe9,0x14,0x69,0xea,0xcc,0x9d,
+    0xc2,0x9d,0xe9,0xe0,0x33,0x9e,0x97,0x9e,0x3d,0xc0,0x61,0x63,0xf4,0xc2,0xe6,0x61,
+    0xa5,0xd7,0xf2,0x9d,0x2b,0xa3,0x80,0x10,0x95,0x05,0xb3,0xb1,0xc4,0xb6,0x7a,0x86,
+    0x0c,0x6b,0x1d,0xa0,0x7b,0xfd,0x01,0xd0,0x7b,0x04,0xc3,0x63,0x94,0x51,0x96,0x39,
+    0x47,0x9f,0xf4,0xa8,0x8a,0xb4,0xb1,0x25,0x9f,0xa3,0x50,0x28,0x78,0x94,0x90,0x96,
+    0xf4,0x8d,0x0e,0xe9,0x7f,0xa0,0xaf,0xc1,0xa8,0x02,0xb4,0x34,0x2e,0x3b,0xb5,0x6a,
+    0x56,0x88,0x02,0x40,0x28,0x8b,0x5a,0xfa,0x85,0xb2,0x82,0x15,0x86,0x0b,0xfa,0x8f,
+    0x9b,0xcb,0x17,0xde,0x3f,0x2e,0x18,0x8d,0x99,0xdf,0xd8,0x00,0x14,0xca,0xfc,0x07,
+    0x04,0x52,0x78,0x06,0xd4,0x60,0x40,0x6d,0x3b,0xa0,0x06,0x03,0xba,0x55,0x16,0x54,
+    0x59,0x9f,0x4c,0xb7,0xca,0x82,0x2a,0xa2,0x42,0x0a,0x0c,0x00,0x40,0xfe,0xd0,0xbe,
+    0xfe,0x61,0x7d,0x3d,0xb7,0xb1,0xe6,0xb2,0xd9,0xac,0xf2,0x85,0xa6,0xcf,0x58,0xfb,
+    0xe2,0xb2,0xd2,0xa1,0xcf,0x68,0x2d,0x26,0xd0,0xe7,0xa7,0xe9,0x66,0x02,0x0c,0x98,
+    0x80,0xb6,0x33,0x01,0xf4,0x7c,0x88,0xf6,0x4c,0x98,0x9b,0x88,0x0e,0x82,0xb2,0x9d,
+    0x02,0x48,0x0c,0x1b,0x61,0x39,0xbd,0x4b,0x11,0xd2,0xfd,0x0b,0xdd,0xc4,0x5f,0x12,
+    0xa0,0xd6,0x9a,0x6b,0x1a,0x58,0x4b,0x10,0xe6,0xc3,0xa1,0x6e,0xa4,0xd7,0x8d,0x73,
+    0x33,0x47,0x73,0x54,0x45,0xda,0xde,0x50,0x37,0x92,0x47,0x6d,0x0f,0x2d,0xad,0xaf,
+    0xea,0x6e,0x9b,0xed,0xaa,0xc8,0x4b,0x4a,0x0c,0xa8,0x6c,0xec,0x7a,0x1b,0xa9,0xae,
+    0x22,0x6f,0xd1,0xa1,0xe9,0xf3,0x5d,0xd9,0x3a,0x31,0xb4,0x57,0xea,0x02,0xfa,0xcc,
+    0x3a,0xea,0x4a,0xe9,0x76,0x12,0x3f,0xe8,0x9d,0xf7,0x09,0xb8,0x20,0x8a,0x61,0xe8,
+    0x12,0x85,0x85,0x63,0x8e,0x5e,0x6a,0x08,0xd6,0x66,0x36,0x03,0xf1,0x2a,0xc8,0x8a,
+    0x2a,0x61,0x2c,0x7c,0xcc,0x8d,0xbb,0xd4,0x1d,0x70,0x8e,0x80,0x02,0x23,0x38,0x52,
+    0xc6,0x98,0x85,0xc7,0x3b,0x7a,0x1a,0xfa,0x03,0xc1,0xf8,0xbc,0x1e,0xc4,0xa6,0x0b,
+    0x48,0xff,0x66,0xa6,0x20,0x42,0xee,0x9c,0x37,0x65,0x5e,0x83,0x2e,0xeb,0xcb,0xb6,
+    0x03,0x0c,0x16,0x27,0x5b,0xe3,0x7e,0x65,0x09,0xc7,0x7d,0xa8,0xe4,0x8e,0x8b,0x95,
+    0x1a,0xbd,0x34,0xf1,0xc0,0x8b,0x02,0x63,0xb7,0xfd,0x46,0x5c,0x1d,0x90,0x5f,0xe0,
+    0xaf,0xd4,0xd0,0xd4,0x35,0x5e,0x92,0xde,0xda,0xd7,0x9e,0x22,0x11,0x5b,0xf0,0x82,
+    0x01,0x47,0x65,0xb4,0x0e,0x20,0x2f,0x7d,0x82,0x61,0xf4,0x5a,0x8a,0x07,0x6d,0x1b,
+    0xa3,0x65,0x91,0x3f,0x81,0xdf,0x27,0xcd,0x40,0xb3,0xd3,0x62,0x07,0x7c,0xd3,0x82,
+    0x4f,0x6f,0x52,0x33,0xcc,0x91,0x9c,0x05,0x13,0x86,0x85,0x14,0x16,0x6d,0x93,0x14,
+    0x83,0x6d,0x09,0x6b,0xc1,0xb0,0x85,0xd7,0xdf,0x21,0x10,0x75,0xf2,0xfc,0x6c,0x7d,
+    0xff,0xce,0x64,0xb3,0x2f,0x23,0xfa,0xfd,0xfb,0xc7,0x0c,0x7f,0x6a,0xa2,0xcc,0x57,
+    0xcc,0x8a,0x7d,0xf2,0xe3,0xbd,0xb5,0xd7,0x49,0x0d,0x5e,0x3f,0xf7,0xf8,0x8e,0xa2,
+    0xb8,0xbb,0x1f,0x58,0x71,0x2a,0xb5,0x45,0x19,0x3b,0x0c,0x5f,0x4e,0x01,0x2e,0x38,
+    0xcd,0xe6,0x2a,0x7a,0x49,0xa4,0x5c,0x88,0xc1,0xb3,0x0f,0x01,0xf8,0x74,0xaf,0x0f,
+    0x71,0x0c,0xf2,0x0c,0xbe,0x2e,0xf6,0x4c,0xaf,0x4c,0x5d,0x6b,0x93,0x5a,0x33,0x00,
+    0x9e,0xb6,0x47,0x55,0xf7,0x5c,0x6b,0x5f,0x13,0xee,0x36,0xda,0x35,0xe0,0xe1,0x5d,
+    0x35,0xdf,0xc2,0x3c,0x18,0x11,0x60,0x62,0xd5,0x0e,0x62,0x47,0xe9,0x55,0x56,0xc7,
+    0x3b,0xd0,0xbb,0x74,0x36,0x18,0x66,0x7e,0xcd,0xbe,0x8b,0x92,0x8e,0xc8,0x7e,0x39,
+    0x8e,0xa7,0xcb,0xaa,0xd7,0x22,0x79,0x74,0xa8,0xe0,0xd9,0x2b,0x06,0xd9,0x70,0x72,
+    0xeb,0x52,0x1a,0xc8,0x9a,0x1b,0xda,0xaf,0xec,0xb3,0x73,0xc1,0x78,0xd8,0x29,0x2c,
+    0x90,0x4d,0x8f,0x4d,0x50,0xb0,0x13,0xfd,0xb7,0xa1,0x9e,0x72,0x79,0x46,0xfb,0x09,
+    0x07,0x13,0xfc,0x12,0x38,0x8e,0x16,0xd9,0xab,0x7e,0x87,0x2e,0x85,0x4f,0x98,0xfd,
+    0xf0,0xbe,0x32,0x04,0x1d,0x1e,0x1c,0x06,0x29,0xbb,0x09,0x81,0x2f,0x02,0x04,0x3f,
+    0xb0,0x66,0xbb,0xf3,0x21,0x5e,0x34,0xa5,0x98,0xe0,0x5d,0xeb,0x94,0xaa,0x6b,0x63,
+    0xb2,0xf7,0x5e,0x2a,0x35,0x5b,0x8d,0x1a,0x15,0x98,0x0a,0x2b,0x8a,0x0e,0xbd,0x00,
+    0x32,0x44,0x07,0xa9,0x99,0x8a,0x04,0xec,0x99,0xe3,0xcd,0x73,0xec,0x01,0x9d,0x05,
+    0x76,0x49,0x08,0x2b,0x38,0x8c,0x86,0x37,0xea,0x81,0xcc,0xe0,0xc0,0x1b,0x74,0xe8,
+    0x60,0x06,0xc1,0xf0,0x4c,0x37,0x2d,0x4c,0x58,0x08,0xec,0xf0,0xa5,0x3b,0xd9,0x18,
+    0x7d,0x38,0x5d,0xd2,0xd6,0x9d,0x44,0x63,0xe2,0xaa,0xe2,0x4e,0x31,0x8e,0x1b,0x36,
+    0x21,0x61,0x30,0x78,0x76,0x6c,0xea,0x9a,0x6e,0x51,0x40,0x71,0x45,0xa2,0x22,0xee,
+    0x44,0x08,0x8f,0x69,0x8f,0x7e,0xfa,0x0f,0xb7,0x9f,0x28,0xda,0x80,0x36,0x81,0xbf,
+    0x94,0x7e,0x14,0x82,0x17,0x33,0x80,0xe1,0x20,0xb6,0x8d,0x73,0xa0,0xbb,0x44,0xe1,
+    0xa0,0x69,0x13,0xcf,0xfb,0xf9,0x90,0x05,0x55,0x21,0xdd,0x6d,0x17,0xe1,0xad,0xcb,
+    0x85,0xbd,0x40,0x90,0xa4,0x4d,0xf8,0xad,0xbd,0x6d,0x8f,0x0f,0xaf,0x94,0xbb,0xaa,
+    0x62,0xa7,0x3c,0x6c,0x0c,0xc9,0xa3,0x13,0x20,0x3d,0x28,0x6a,0xa1,0x95,0xe5,0x9b,
+    0x7e,0xb0,0xb5,0x6e,0x6e,0x08,0x18,0x5a,0xcc,0x6d,0x1a,0x1e,0xeb,0xdb,0xec,0x84,
+    0xe3,0x31,0x78,0x12,0x01,0x07,0x95,0x27,0xcd,0xef,0x31,0x0b,0x79,0xca,0x14,0xbb,
+    0x88,0xa2,0xb0,0x05,0xab,0xf7,0x93,0x1d,0xb3,0x62,0x6e,0xf4,0x6a,0xd5,0x4b,0xcb,
+    0x9a,0xb5,0xd0,0xc3,0x1c,0x99,0xd6,0xb9,0x10,0xd5,0x35,0xec,0x29,0xad,0x71,0x40,
+    0x8a,0xec,0x04,0x50,0xd6,0x05,0x03,0x7c,0x49,0x80,0x1b,0x21,0x10,0x5f,0x6a,0x4d,
+    0x90,0x82,0x25,0x95,0x63,0x18,0x52,0x68,0x87,0xb0,0x5f,0x16,0x3a,0x08,0x1d,0x58,
+    0xdd,0xac,0xf5,0xdb,0x6f,0x56,0x00,0xb7,0x35,0x67,0x40,0x4f,0xd4,0xc1,0x14,0x3b,
+    0xdb,0xd4,0x6a,0xbf,0xfd,0xa6,0x05,0x04,0x08,0xff,0x21,0x3a,0x81,0xe5,0x14,0xf4,
+    0xa3,0x5c,0xea,0xd0,0x61,0x14,0x06,0xcb,0x03,0x45,0x58,0x5a,0xbc,0x13,0x10,0x00,
+    0xf9,0x63,0x12,0x9a,0xf3,0xd4,0xed,0x4b,0x27,0x51,0x3d,0x32,0xe9,0xb0,0x60,0x4f,
+    0x5b,0xf7,0x9b,0xb6,0xfe,0x8a,0x69,0xeb,0x7e,0xd3,0xd6,0x0f,0xa6,0x4d,0x26,0xa6,
+    0x1f,0x9b,0xb6,0xf0,0xdb,0x6f,0x42,0x40,0xc7,0xd3,0xd6,0x9d,0x69,0xe3,0xdc,0x29,
+    0xcc,0x3b,0x08,0x05,0xc0,0x60,0x07,0x21,0x9c,0x17,0xc6,0xa9,0xb2,0x82,0xfd,0x14,
+    0x50,0x84,0x78,0x8e,0x61,0xf2,0x70,0x92,0x22,0xda,0xa2,0x75,0x8f,0x9f,0x08,0xb2,
+    0x7b,0x01,0xa9,0xac,0x9d,0xb5,0x5c,0x93,0xca,0x38,0x09,0x77,0x61,0xe8,0xd3,0x0a,
+    0x36,0xbf,0x2f,0x2b,0xd4,0x5e,0xd2,0x8e,0x18,0xeb,0x73,0x8c,0xb0,0xbb,0x10,0xfe,
+    0xf6,0x9b,0x47,0xd8,0xd1,0x0a,0x89,0x58,0xb6,0xc3,0x5e,0xb6,0x78,0xc5,0x6d,0x37,
+    0xaf,0xe6,0xac,0x40,0x8e,0x40,0x93,0xd2,0xb6,0x3e,0x37,0x44,0x64,0xe7,0x95,0x30,
+    0x3f,0x3c,0x85,0x18,0x3e,0xe9,0x88,0xa3,0xaf,0xc3,0xec,0x21,0xa6,0x1a,0x1d,0xde,
+    0xf0,0x06,0xed,0x0b,0x83,0xb9,0xd6,0x44,0xca,0x06,0xe0,0xe2,0x81,0x1d,0xb4,0x67,
+    0x92,0x59,0x44,0x3e,0x00,0x49,0x46,0x66,0x17,0x22,0x28,0xad,0x60,0x00,0x89,0x3c,
+    0x1c,0xff,0x35,0xeb,0x41,0x31,0xda,0x68,0x96,0xea,0x40,0x11,0xef,0xc0,0xf6,0x64,
+    0xa9,0xa2,0x62,0xbe,0x6a,0x54,0x37,0xcb,0x77,0x74,0x22,0x6e,0x03,0x14,0xc5,0x4f,
+    0x65,0x05,0xc3,0xfb,0xd9,0x31,0xbb,0x98,0x0c,0xe0,0x35,0xa4,0xc8,0x19,0xdd,0x81,
+    0xe7,0x65,0x83,0x47,0x33,0x70,0x8e,0x80,0x98,0x1c,0xd2,0x6c,0x8f,0xb1,0x4e,0x1e,
+    0xc2,0x0b,0xd4,0x04,0xa9,0x39,0xda,0xde,0xae,0xa6,0x77,0x32,0x79,0xfa,0xcc,0x6e,
+    0x7e,0xd8,0x1a,0xd7,0xd1,0x24,0x3f,0x6a,0x6f,0x2e,0x90,0xcc,0x2f,0x21,0x31,0xf6,
+    0x48,0x9d,0x5d,0x06,0xbb,0x10,0x1b,0x33,0x3b,0x41,0x4a,0x17,0x04,0x4d,0x44,0x2a,
+    0xc9,0xcd,0x6d,0x87,0xc1,0xb9,0x44,0x7b,0xc1,0x00,0x0d,0x0f,0x3e,0x79,0xba,0x56,
+    0xa6,0x53,0x24,0x29,0x18,0x26,0x5d,0xce,0xb0,0xff,0xd1,0xca,0x8c,0xdf,0x9a,0xbf,
+    0xc9,0xa7,0xd9,0x59,0xac,0x2e,0x44,0xe5,0x46,0x01,0x96,0xca,0x40,0x30,0x64,0xc1,
+    0xbd,0xed,0x0b,0xc1,0x0d,0x0d,0x00,0x32,0x0c,0x1d,0xde,0xf1,0x98,0xc7,0xfa,0xa5,
+    0x3e,0x75,0x87,0xf7,0x4c,0x33,0xc2,0x82,0xd2,0x7c,0x71,0x26,0x5b,0xe6,0xd2,0xf4,
+    0xd9,0xf6,0xfa,0x6d,0x48,0xec,0xba,0xe7,0xfe,0xa3,0xb9,0xb0,0x33,0xdc,0xbb,0x61,
+    0xef,0x67,0xf7,0x31,0x7c,0xe6,0x93,0x25,0x2b,0x66,0x94,0xec,0x6b,0x6c,0x0c,0x40,
+    0xc0,0xbb,0xcf,0x91,0xf5,0x09,0xf8,0x76,0xb7,0x45,0xbe,0x80,0xc4,0x1a,0xd6,0xc5,
+    0x66,0x9b,0xc3,0x1e,0x23,0xb0,0x05,0x1c,0x3c,0x23,0x2d,0x1c,0x01,0xc0,0xbc,0xf3,
+    0x54,0x92,0x40,0xee,0x4d,0xfb,0x17,0x76,0x00,0x44,0x7b,0x05,0x64,0x68,0x69,0x8e,
+    0x90,0x61,0xf3,0xe6,0xbf,0xa8,0x1e,0xee,0x6a,0x6d,0xfc,0x49,0xb7,0x8a,0x52,0x40,
+    0x65,0x9c,0x4a,0xec,0x07,0xbe,0x30,0xf1,0x2c,0x6d,0x03,0x25,0x36,0x95,0x7e,0xdb,
+    0x24,0x44,0xdb,0xff,0x01,0xad,0x9f,0x19,0xc4,0x88,0x15,0xd1,0x48,0x98,0xab,0xd6,
+    0x0e,0xc7,0xb6,0xd3,0xc2,0xa4,0xb3,0x55,0x83,0x48,0x05,0x38,0x7a,0x86,0xbb,0xeb,
+    0x70,0x64,0xa6,0xa4,0x4b,0x0b,0x41,0x08,0x46,0xb6,0x0e,0x76,0x7c,0x98,0x8f,0xd1,
+    0x4f,0x1f,0xdc,0xb7,0xa8,0x1f,0xee,0xf8,0x60,0xc4,0xd9,0x38,0x59,0x69,0xa0,0x12,
+    0x17,0xfe,0xf6,0x9b,0x73,0xbf,0x94,0x15,0x51,0xfe,0xfe,0xdd,0x6f,0x3d,0xf3,0xda,
+    0x1a,0x3f,0x84,0xd0,0xa9,0x54,0xc7,0xca,0xb2,0x65,0xd1,0x6e,0x0b,0x54,0xc7,0x2e,
+    0x9a,0xb3,0xd4,0x66,0xd1,0x8e,0xd6,0x1d,0xd0,0xe0,0x95,0x32,0x94,0x45,0x2f,0x6e,
+    0x4e,0xec,0x30,0x91,0xc6,0x19,0x95,0x00,0xfa,0x72,0x62,0x4f,0xe2,0xcc,0x3a,0xb9,
+    0x91,0x12,0x7e,0xe5,0x48,0x36,0xa7,0x60,0x6d,0x3d,0x47,0x5f,0x02,0x2f,0x80,0xf4,
+    0xee,0x97,0xb0,0x20,0xf8,0xa7,0x76,0x4c,0x76,0xf6,0x56,0x76,0x77,0x75,0x76,0x75,
+    0xfc,0xb5,0x5a,0xb8,0x1b,0x85,0x6c,0x74,0x51,0x50,0xc9,0xa2,0xbc,0xa7,0x93,0x00,
+    0x42,0x79,0x44,0xfe,0x91,0xe2,0x66,0x33,0x79,0x57,0xb1,0x89,0xe1,0xdb,0x84,0x89,
+    0x78,0xbd,0x3f,0xaa,0xdb,0xee,0x46,0x78,0x16,0x85,0x4f,0xd6,0xb7,0xf1,0x5c,0x77,
+    0x76,0x87,0xc2,0xc7,0xd4,0x10,0xcb,0x73,0x55,0xd1,0x90,0x99,0xfd,0xe3,0xeb,0xc9,
+    0x46,0x85,0xb9,0x81,0xdb,0x65,0x19,0x7f,0x95,0x0c,0x9c,0xea,0x4b,0xf4,0xbc,0xa0,
+    0xcf,0x41,0xac,0x99,0xe0,0x51,0xdd,0xdd,0xd2,0xd6,0x67,0x09,0xf1,0x4e,0xcf,0xc9,
+    0x83,0xed,0x18,0x12,0x41,0xc2,0x16,0x3e,0x00,0x3a,0x24,0x83,0x37,0xeb,0xa9,0x22,
+    0x93,0x3b,0x68,0x4b,0xc2,0xc1,0xa0,0xbf,0xfa,0x6e,0x17,0x6d,0x44,0xd2,0x8b,0xaf,
+    0x94,0x13,0x88,0x33,0x1c,0xbe,0xda,0x5a,0xfd,0xa2,0xb5,0xf6,0x53,0xd7,0x5f,0x99,
+    0xf0,0x3e,0xee,0x38,0x7c,0xf7,0xc5,0xd3,0xad,0x7d,0x7a,0x99,0xb7,0xc8,0xe3,0x46,
+    0x44,0x4d,0x70,0xde,0x01,0xcb,0xff,0x68,0x7e,0xfb,0x8b,0xbe,0x1c,0x7f,0x2d,0x6f,
+    0x77,0x38,0x0b,0xd6,0xb2,0x8e,0xed,0x99,0x3c,0xd7,0x26,0x47,0x0c,0xe5,0x96,0x15,
+    0x78,0x1a,0x6f,0x34,0xf5,0x9e,0x90,0x7e,0xab,0x47,0x10,0x0c,0x78,0x7d,0x23,0x62,
+    0x68,0x70,0xbe,0x01,0x0b,0xc7,0x2d,0xce,0x43,0x40,0x84,0xf2,0xb4,0x9b,0xd8,0xb6,
+    0x36,0x8e,0x05,0xfa,0xc4,0xa2,0xb8,0x9b,0xc5,0x66,0xb9,0x14,0x54,0xe1,0x37,0x43,
+    0x30,0x90,0x1c,0xf6,0x38,0x83,0x6e,0xa6,0xeb,0xdc,0x27,0xd3,0xe5,0x27,0x8c,0x4e,
+    0x6a,0x8c,0xa4,0x1b,0x80,0xc5,0x53,0x05,0x5c,0x9e,0x8d,0xa3,0x4d,0x02,0x60,0x3b,
+    0x1c,0xc2,0xf5,0xb8,0x47,0x8b,0x84,0x5b,0xe7,0x08,0xa2,0x40,0x2c,0x41,0xd9,0x63,
+    0x4e,0xb9,0x1b,0x17,0x04,0xc3,0x7e,0x33,0xf4,0x44,0x0d,0x26,0x2c,0x7b,0xc1,0x2f,
+    0xd6,0x41,0xd1,0x99,0x16,0x20,0xd1,0x8e,0xb3,0x09,0x6c,0x1b,0x20,0xed,0x77,0x8b,
+    0x72,0x16,0x01,0xf0,0xe7,0x31,0x12,0x24,0x24,0xd9,0xc1,0x02,0x7f,0xe0,0x3a,0x6c,
+    0xfb,0x72,0x26,0x0e,0x2a,0x4f,0x5b,0xaa,0xe0,0xf3,0x5e,0x40,0x88,0x25,0xaa,0x31,
+    0x22,0xc3,0x6c,0x73,0x87,0x27,0x08,0xf4,0xee,0x0c,0x81,0x1d,0xeb,0xf9,0xe7,0x09,
+    0x7e,0xdd,0xe6,0x09,0xbe,0x7f,0x87,0xc8,0x6f,0x9b,0x1d,0x08,0x46,0x0d,0x53,0x05,
+    0x4d,0xa6,0x87,0x73,0x73,0x8d,0x9d,0x4b,0x44,0x0a,0xbe,0x68,0x67,0x56,0x30,0x20,
+    0x90,0x2c,0xc1,0x26,0xa2,0x26,0x2e,0x16,0x09,0x7f,0x77,0x73,0x07,0x9e,0xb8,0x74,
+    0x27,0x89,0xe0,0x2b,0x98,0x98,0x1e,0x0e,0xdb,0x36,0xd4,0xc0,0xa9,0x7e,0x50,0xd6,
+    0x29,0xf8,0x5f,0xb1,0xff,0xf7,0x47,0xb9,0xf6,0x35,0x16,0xc5,0x4f,0xee,0x04,0x0e,
+    0x44,0x1b,0xab,0xf4,0xac,0xa0,0x4f,0xc9,0xa3,0x5a,0x3b,0x00,0x02,0x5b,0x18,0x78,
+    0xcb,0x69,0xa6,0x0a,0x10,0xd0,0xc6,0x02,0xff,0x09,0x44,0xff,0xfb,0xcb,0x7f,0x82,
+    0xc1,0x58,0x98,0xa6,0x8f,0xf8,0x2e,0xbb,0x6a,0xfb,0xe4,0xb7,0x9f,0xe3,0x63,0xb8,
+    0x6c,0xa5,0x3a,0x3f,0x27,0x1d,0xfc,0x66,0xf7,0xa2,0x8d,0xfa,0xe3,0x15,0xa6,0xe8,
+    0x6b,0x30,0x48,0xb6,0x7a,0xce,0x8f,0x63,0xe5,0x6d,0x1e,0xca,0xb2,0xaf,0x31,0x70,
+    0x9f,0xb3,0x2f,0x22,0xe7,0x98,0x08,0xc7,0x00,0x50,0x47,0x5c,0x02,0x51,0x9f,0xce,
+    0x40,0x5e,0xd1,0x09,0xb7,0x95,0x24,0x60,0x8e,0x18,0x34,0xe0,0xc8,0xbe,0x86,0xf8,
+    0x70,0xf9,0xa3,0x08,0x79,0xb0,0x50,0xd6,0xc0,0xeb,0xc2,0x9c,0x0f,0xef,0x3b,0xe8,
+    0xc1,0x67,0x5f,0x49,0x71,0xdb,0x07,0x6c,0xde,0xef,0x27,0xa5,0x2d,0x4a,0x85,0x81,
+    0xfc,0x96,0x72,0x1f,0x46,0xd1,0xd1,0x68,0xf4,0x85,0xa6,0x6f,0x98,0xdb,0xeb,0xd7,
+    0xab,0xd7,0x09,0xd1,0xf9,0x2b,0x9a,0x7d,0x7a,0xad,0x0c,0xd9,0x2a,0x82,0x4d,0xd0,
+    0xc7,0xcc,0xd6,0xd1,0xf2,0x3d,0x09,0x3d,0x90,0xb3,0x5d,0xb5,0x3e,0x7f,0xdd,0xc4,
+    0x9f,0xdf,0x2f,0xe8,0xc7,0x65,0xdc,0x7f,0xc9,0x04,0xa6,0x38,0xfb,0x72,0xaf,0x63,
+    0x1e,0xd6,0xed,0x1d,0xec,0x76,0x33,0xfc,0x61,0xd7,0x4a,0x93,0x2c,0xb9,0x6d,0xea,
+    0x77,0x52,0x29,0xb6,0xc0,0xa1,0xad,0xe1,0x0f,0x73,0x6c,0x9a,0xd8,0x7b,0x77,0x5d,
+    0xe0,0x99,0xf8,0xce,0xbd,0x9d,0x68,0x75,0xef,0x77,0x97,0x08,0x07,0x08,0x59,0x2b,
+    0xc8,0x24,0x5e,0xeb,0x0f,0xfb,0x47,0x0a,0xbb,0xcf,0xac,0x56,0x4a,0xed,0xa0,0x97,
+    0xaf,0xaf,0x0c,0xa9,0xb3,0x9e,0x47,0xff,0x8e,0x49,0xc2,0xa1,0x02,0x1c,0x79,0x5c,
+    0x16,0xc2,0x34,0x3f,0x6a,0x0b,0x23,0x0b,0x19,0xc7,0xb6,0xb1,0x0e,0x66,0x11,0xa2,
+    0x29,0x98,0x86,0xa1,0x20,0xbc,0xe7,0x82,0x54,0xbc,0x17,0xe4,0x2f,0x5f,0x23,0x02,
+    0x3d,0x4c,0x9d,0x66,0x62,0xf0,0xfc,0x8d,0xc2,0xb7,0x3f,0x80,0x57,0x18,0x49,0x92,
+    0x84,0x04,0xf5,0xd7,0x4e,0x6a,0xc0,0xb3,0xb5,0x19,0x70,0x72,0x00,0x38,0x23,0xe0,
+    0x49,0x08,0xec,0x64,0x0a,0x3c,0x89,0x83,0x20,0x38,0x15,0xaf,0xc8,0x70,0x93,0xa7,
+    0x02,0x3d,0xb9,0x96,0x9d,0xb4,0xde,0xfe,0x33,0xa2,0xde,0x54,0x1b,0xae,0x53,0xa1,
+    0x2e,0x46,0xef,0x3d,0x4a,0xda,0x98,0xec,0x15,0x60,0x36,0x1d,0x05,0x8a,0x2b,0x01,
+    0xf0,0x6e,0x75,0x1b,0xc2,0xd7,0x76,0x05,0xcf,0xdd,0xce,0x1b,0xd4,0x04,0x4b,0xb6,
+    0x7d,0xce,0x60,0x6c,0x73,0x0d,0x6e,0x72,0xf0,0x3b,0xe3,0x78,0xc1,0xa1,0x00,0xb2,
+    0x6b,0x66,0xfa,0x12,0xd7,0x84,0x2d,0xbc,0xb8,0x6c,0x9e,0xc5,0x03,0xa6,0xd3,0xa1,
+    0x00,0x3d,0xa9,0x95,0x3b,0xcd,0xd2,0xa0,0x4f,0xff,0x61,0x45,0xd8,0xaf,0xdf,0xbf,
+    0x83,0x25,0x08,0xd1,0x79,0xfa,0x18,0x6e,0x8d,0xc9,0x06,0x85,0xb0,0xb6,0xb7,0xb9,
+    0x24,0x64,0x03,0x01,0x9f,0xe7,0x22,0xf7,0x1f,0x6e,0xce,0x6a,0xc1,0x83,0x07,0x25,
+    0x46,0x26,0x7e,0xc8,0x99,0x3c,0x81,0xe1,0xeb,0xb6,0xee,0x3e,0x08,0x9d,0xd5,0xa2,
+    0x76,0x87,0x60,0x58,0x3b,0x00,0x25,0x29,0xe6,0x04,0x13,0x8b,0x00,0x3b,0xb1,0xa3,
+    0x81,0xc1,0x46,0xec,0x64,0x65,0x44,0x01,0xb4,0x48,0x86,0x85,0xfe,0x34,0xfc,0x5c,
+    0x04,0x00,0x14,0x86,0x70,0xf6,0x29,0x36,0xfc,0x0c,0x44,0xf2,0x90,0x5f,0x8b,0xba,
+    0xe0,0x81,0x4a,0x61,0x0a,0x5a,0x5f,0x18,0x08,0x51,0xf9,0x35,0x4c,0xf2,0x64,0xf3,
+    0x88,0x7d,0xd9,0x35,0x21,0xba,0x05,0x37,0x7d,0xfb,0xd0,0x98,0x75,0x22,0x31,0x63,
+    0xe1,0x74,0x09,0x49,0x00,0xe2,0xbd,0x0e,0xcf,0x73,0x3f,0xe0,0xec,0xea,0x4b,0x77,
+    0xe1,0x8a,0xb0,0xe7,0xcc,0x27,0x74,0x8e,0x22,0x91,0xa0,0x10,0x95,0x10,0xb6,0xff,
+    0x2d,0xe0,0x38,0xda,0x76,0xb0,0x1f,0x63,0xd4,0x76,0xd2,0xb5,0xf6,0xc3,0x8c,0x36,
+    0x38,0xa7,0xe6,0x0f,0xeb,0x2b,0x89,0xe0,0xcf,0x11,0x31,0x9d,0xb6,0x6f,0x4a,0x83,
+    0x30,0x83,0x4c,0x9c,0xdb,0x8f,0x9c,0x7a,0x5a,0xe2,0x7c,0x4a,0xd8,0xcc,0xfe,0xfe,
+    0xc9,0x32,0x28,0xbc,0xd5,0x10,0xc1,0x35,0x59,0xfa,0xf7,0x10,0x0a,0xfd,0x4e,0x7f,
+    0xfe,0x1d,0xaa,0x02,0xfb,0xff,0x87,0x70,0x6b,0x89,0x22,0x39,0xa2,0x2c,0xa1,0xbf,
+    0x40,0x64,0xcc,0x84,0xf6,0xc1,0x50,0xe0,0xf7,0x4f,0x82,0x53,0x87,0x53,0x52,0x38,
+    0x8b,0x49,0x60,0xda,0x6d,0x68,0x4a,0xd7,0x88,0x42,0xe2,0xb7,0xe8,0xf1,0x1c,0x49,
+    0x24,0xf7,0x9f,0xdf,0xf1,0x78,0xf4,0xef,0xc1,0xff,0xd0,0x9f,0x81,0x44,0xa1,0xdf,
+    0x3f,0x99,0x8b,0xb1,0x0b,0x04,0xbf,0xa0,0xee,0x8c,0x40,0x7f,0xfe,0x34,0x07,0x73,
+    0xb5,0xc2,0x6f,0x40,0x9c,0xd9,0xef,0xb2,0xff,0x1b,0xaa,0x23,0x36,0x28,0xa8,0x8d,
+    0x41,0x35,0x7c,0x42,0xef,0xcf,0xbf,0x87,0xe8,0x4f,0x31,0x01,0xc0,0xbd,0x1e,0x23,
+    0x20,0xd5,0xda,0x07,0x9f,0x37,0xa3,0x83,0xe1,0xec,0x21,0x13,0x74,0xb0,0xc1,0x5f,
+    0x96,0xe4,0x60,0xb5,0x21,0xa2,0x2d,0xc5,0xe4,0xe9,0xa5,0xcf,0x64,0x64,0xa7,0x91,
+    0x5f,0x2b,0xcc,0x30,0x4a,0x56,0x24,0x09,0x69,0x91,0x15,0x26,0xb9,0x57,0x52,0xf5,
+    0xe0,0x76,0x00,0x7c,0x61,0x7c,0xa6,0x21,0x92,0x53,0xc0,0xc6,0x1b,0x16,0x96,0xa6,
+    0x1d,0x89,0xf3,0x3e,0xf4,0x68,0x7a,0x9c,0x50,0x0f,0x63,0x76,0xf7,0x20,0xb6,0x15,
+    0x47,0x32,0x48,0xbb,0xfa,0x1d,0xa2,0x71,0x90,0x76,0xf8,0x3c,0xbe,0x67,0x83,0xca,
+    0x25,0xf8,0xee,0x38,0x6e,0xf1,0x5b,0x46,0xd9,0x49,0x9b,0xdb,0x19,0xa2,0x8e,0xbe,
+    0xdd,0x95,0x78,0xeb,0xa6,0xc0,0x2b,0x73,0x4c,0xfb,0x3b,0x02,0xde,0x37,0x44,0x3e,
+    0x7e,0x43,0x40,0xd1,0x14,0x0b,0x06,0x03,0x56,0xbb,0xe8,0x42,0x10,0xef,0x37,0xb1,
+    0xdd,0x97,0x53,0xb2,0x7f,0x7c,0x3d,0x3f,0x6e,0x41,0xc1,0xc0,0x20,0x67,0x53,0x85,
+    0xf1,0xd8,0x26,0x6b,0x63,0x8d,0x5e,0x80,0x1e,0x9d,0xcd,0x4d,0x39,0xc0,0x60,0x28,
+    0x60,0x1a,0x31,0xeb,0x40,0xcb,0x54,0x5d,0x9c,0x78,0x16,0x1f,0xfb,0x55,0x9b,0x0d,
+    0xd2,0x3b,0x4f,0x27,0x1c,0xc3,0x4b,0xf3,0xf1,0xa2,0x77,0x47,0xc6,0x4f,0x3b,0x5a,
+    0xe7,0x5a,0xf6,0x25,0x04,0x0d,0x24,0xcd,0xc1,0x04,0x92,0xdd,0xc3,0xec,0x67,0x14,
+    0xb2,0xc2,0x4c,0x30,0xf6,0x52,0x27,0xc7,0xbc,0x0a,0x0e,0x69,0xb4,0x70,0x26,0x13,
+    0xcd,0x64,0x3e,0x09,0xee,0x13,0xb1,0x1e,0xef,0xcf,0x93,0x15,0x11,0xb6,0x34,0xd0,
+    0x74,0x0d,0xd1,0xcf,0xe1,0x38,0xac,0xe5,0x7b,0x59,0xf2,0xc3,0xbd,0x32,0xc7,0xa7,
+    0x0d,0x58,0xd9,0x3f,0xc0,0x71,0xb6,0xbe,0xba,0xe1,0xc6,0x27,0x9c,0xcf,0x7d,0x1a,
+    0x29,0x86,0x49,0x3a,0x65,0xad,0x3f,0x18,0xf7,0x39,0x75,0xe6,0x90,0x3a,0xfb,0x4b,
+    0xe8,0xe1,0x9a,0xed,0xfb,0x1c,0xf0,0x61,0xb3,0x93,0x8b,0xf1,0x7b,0xfb,0xe3,0x35,
+    0xd3,0x59,0xcc,0x5f,0x03,0x62,0xb3,0xe2,0xbe,0xb6,0xb1,0xbd,0x26,0x6f,0x68,0x45,
+    0x16,0xb6,0x10,0xf8,0x4b,0x9f,0x91,0xab,0xd3,0x17,0x9e,0x8d,0x80,0xa1,0x62,0x3f,
+    0x2e,0x66,0x5a,0xba,0x01,0x90,0x29,0x61,0x01,0xde,0x1a,0x39,0xfc,0x05,0xd4,0xdc,
+    0x4f,0xcf,0x1c,0x8e,0x84,0x69,0xd7,0x1e,0x44,0x86,0x82,0x41,0x96,0x11,0xb2,0x29,
+    0x02,0xb0,0x4a,0x82,0x28,0x07,0x6c,0x29,0xc2,0x0f,0x20,0xe3,0xd1,0x82,0xde,0xd8,
+    0x7e,0xb7,0xca,0xde,0xcb,0xb6,0xcb,0x88,0x40,0xcc,0x90,0xd8,0x35,0x54,0xb0,0x7e,
+    0x76,0x99,0xa5,0x63,0xd8,0x53,0x01,0xbf,0xd8,0x76,0x38,0x64,0x18,0xf7,0xde,0x07,
+    0x9d,0xd3,0xa4,0xd6,0x5c,0x7b,0x0d,0x70,0x41,0x93,0x8c,0xf9,0x1b,0x20,0x7b,0x61,
+    0x6c,0x9e,0xb2,0x71,0x5c,0x89,0x83,0xd4,0x21,0xb8,0x0c,0x24,0xe1,0xaa,0x1b,0xd3,
+    0x22,0x38,0x14,0xe7,0x7b,0x4f,0xc0,0x90,0xa4,0x9d,0xdf,0x43,0x30,0xbd,0x88,0x53,
+    0x80,0xa4,0xc8,0x9d,0x62,0xc9,0x80,0xde,0x2e,0x60,0xf2,0x18,0x8c,0x8d,0x90,0xcf,
+    0x93,0x16,0x1b,0x3b,0xbd,0xf3,0xac,0xc5,0x9e,0xe5,0x11,0xf0,0xbb,0x59,0xff,0x8d,
+    0x03,0x22,0xfc,0x46,0x64,0x0c,0xe7,0xed,0x2d,0x41,0xfd,0xfe,0x1d,0x4a,0xf1,0xb4,
+    0xf1,0x00,0x87,0x90,0xf7,0xd3,0xa0,0xbb,0x23,0x24,0xf6,0x1f,0x19,0x22,0x81,0xec,
+    0xe6,0x81,0xa1,0x80,0x1f,0x06,0x30,0xd6,0xc1,0xaa,0x18,0x3c,0x3b,0x80,0xe4,0x02,
+    0x01,0xbc,0x4c,0xe7,0x65,0x02,0xdb,0xe1,0x25,0x8f,0x66,0x3b,0x8f,0x04,0x99,0xc1,
+    0x67,0xe7,0x85,0xd1,0xa8,0xcf,0x29,0x40,0xee,0xcb,0xa4,0x51,0x9f,0xd3,0x80,0x36,
+    0x75,0x07,0xa7,0x02,0xcd,0xb4,0xf1,0xf9,0x10,0xd6,0xd7,0x64,0x22,0x0c,0x8e,0xf0,
+    0xee,0x29,0x40,0x61,0xe7,0x7d,0xd6,0x9d,0xb7,0x1b,0x1c,0x48,0x41,0xf0,0x76,0xec,
+    0x03,0x84,0xec,0x23,0x8c,0x9c,0x33,0x85,0xac,0xb5,0x8a,0x3e,0xff,0xf7,0xd3,0x50,
+    0x5f,0x61,0xef,0x05,0xd6,0xdb,0xb3,0xa1,0x6e,0x00,0xcf,0x23,0x50,0xf2,0x8c,0xdf,
+    0x5e,0x7d,0x1a,0xe9,0x9a,0x15,0x19,0xc1,0x5a,0xac,0xae,0xcf,0xe8,0x4b,0xa4,0x2e,
+    0x90,0xa5,0x88,0x02,0x55,0x47,0x73,0x98,0xeb,0xe6,0x3e,0x9c,0x33,0x40,0x2d,0xc3,
+    0xa6,0xa0,0x99,0x11,0xf0,0x68,0x94,0xd1,0x39,0xe9,0x87,0x35,0xfd,0x8c,0x4d,0xcc,
+    0x56,0xe7,0x38,0x25,0x16,0x91,0x91,0x32,0x96,0xad,0x33,0x36,0x9a,0x78,0xb6,0xe4,
+    0x27,0xbc,0xe7,0x1b,0x01,0x5d,0x1e,0x6b,0x67,0x2a,0x1a,0x59,0x76,0x8f,0xa5,0xdd,
+    0x24,0xc5,0x30,0x10,0x76,0xab,0xba,0x71,0xf6,0xef,0x78,0x3c,0xfe,0x6c,0x49,0x61,
+    0xe8,0x30,0x03,0x01,0xc0,0x28,0x32,0xe7,0x8e,0x29,0x3f,0x23,0xfe,0x7b,0x04,0xef,
+    0x7b,0x3f,0x93,0xcb,0x27,0x07,0x7b,0x73,0x26,0x88,0x76,0x4b,0xa7,0x00,0x60,0xa9,
+    0xc2,0xcc,0x44,0x67,0xee,0xc5,0xb3,0x60,0x8f,0x2f,0x21,0x51,0xb7,0x1f,0x15,0x3c,
+    0xc3,0xcb,0xc2,0x39,0x7e,0xb4,0x67,0x6c,0xe8,0x73,0x4d,0x8a,0xd8,0xe3,0x5b,0x06,
+    0xcc,0x09,0x22,0x30,0x90,0xbb,0x73,0x71,0x6e,0x98,0x50,0x34,0xd3,0x15,0xfc,0x8e,
+    0xe2,0x2e,0x82,0x9f,0x85,0xa7,0xcd,0x7d,0x4a,0x18,0xa6,0x9e,0x5d,0xa9,0x7f,0x22,
+    0x07,0x5d,0x9d,0x81,0x6c,0xfd,0xd7,0x39,0x78,0x34,0x1b,0x22,0xe0,0xfb,0x93,0xa3,
+    0xd9,0xa8,0x9f,0x99,0x3a,0x7e,0x88,0x94,0x9d,0xad,0xa8,0x7f,0x8f,0x58,0x31,0x95,
+    0x12,0xdd,0x39,0x19,0x82,0xa4,0xcc,0xcd,0x33,0x1e,0xa8,0xeb,0x8c,0x3c,0x94,0x52,
+    0x88,0x1d,0x9d,0x4f,0x05,0x63,0x0c,0x03,0x81,0x50,0x58,0xfa,0xf4,0x2c,0x39,0x5b,
+    0x6d,0x70,0x39,0x3b,0xc3,0x27,0x6a,0x4d,0x14,0x2b,0xe2,0x35,0x2f,0x7f,0x12,0x43,
+    0xa7,0xe2,0x28,0x76,0xde,0xd1,0xa7,0xfa,0xe3,0xee,0xd0,0xaf,0x81,0xef,0x99,0xa8,
+    0xdf,0x88,0xa7,0x66,0x47,0x5c,0x82,0x0f,0x19,0xe4,0xdf,0xf8,0x3c,0x30,0x01,0xa4,
+    0xd8,0x78,0x72,0xa5,0x6f,0xa4,0xa2,0xd5,0x39,0xfe,0x88,0x48,0x8a,0x81,0x88,0xd9,
+    0xc1,0xf2,0x35,0x9f,0x6a,0xcf,0xd1,0xb9,0x82,0x33,0x89,0x79,0xec,0x6d,0xed,0xb4,
+    0xc7,0x35,0x76,0xa9,0xcd,0x25,0x32,0x20,0x51,0x82,0x88,0x02,0x6e,0x87,0x79,0x86,
+    0x95,0x1b,0x2b,0x8b,0x53,0xe8,0x9c,0x42,0x46,0xfa,0x46,0x88,0x8f,0x72,0x7e,0x3f,
+    0x37,0x2d,0x65,0xb4,0xde,0x54,0x89,0x88,0x48,0xe3,0x21,0x56,0x4b,0x43,0x98,0x9d,
+    0xe1,0x8f,0xe7,0x28,0x09,0x8d,0x9c,0xa7,0xd1,0x5c,0x39,0x1d,0x8d,0x40,0x4b,0x15,
+    0x55,0xb5,0xaf,0x1c,0x19,0x00,0x69,0x39,0x77,0xf9,0x8f,0xaf,0x17,0xb0,0x3e,0x83,
+    0x7e,0xab,0x8e,0xa2,0x4e,0x21,0xba,0x51,0x91,0x03,0xcf,0x0e,0xb5,0x1c,0x70,0x40,
+    0xef,0xb5,0x0d,0x8e,0x5c,0xbd,0x0d,0x1c,0x04,0x06,0x1b,0x2a,0x29,0x1a,0xb1,0x15,
+    0xc4,0x51,0x3d,0x77,0x55,0x1e,0xfa,0x52,0x2c,0x07,0x00,0x76,0x65,0x9b,0xd9,0x37,
+    0x33,0x5e,0x1b,0x92,0x00,0x1b,0xb2,0x67,0x76,0xb8,0x34,0x9f,0x62,0x13,0xf1,0x73,
+    0x8f,0xe9,0x71,0xa8,0xb7,0x94,0x81,0xfc,0xc4,0x6e,0x20,0x30,0x04,0x98,0x68,0xfe,
+    0xb8,0x9e,0x5b,0xfa,0x5c,0x94,0x9d,0xa9,0x9f,0x81,0x13,0xa0,0xcc,0xe6,0x2a,0xb1,
+    0x1f,0xfb,0xd6,0x01,0x42,0x4c,0x30,0x44,0xe4,0xe1,0x66,0xc7,0xb4,0xd8,0xfa,0x8c,
+    0x35,0xd9,0xd6,0xe9,0xe3,0x52,0x88,0xa7,0xe2,0x67,0x9e,0x08,0xa5,0x36,0x8f,0x79,
+    0x3c,0x39,0x23,0x6a,0x3a,0x9e,0x8c,0xaa,0x2f,0x91,0x74,0xae,0x63,0xcb,0x67,0xad,
+    0xcf,0xa2,0x49,0xfe,0x19,0xbb,0x3e,0x53,0x22,0x26,0x86,0xae,0x3e,0x1d,0x90,0xf2,
+    0xb4,0x85,0x76,0x49,0xe5,0x08,0x0b,0xcf,0xf3,0x87,0xb6,0x80,0x08,0x8e,0xa7,0x94,
+    0x2c,0x51,0x47,0x26,0xfb,0x6f,0x51,0x14,0x7d,0x66,0xe9,0x6a,0x2c,0x59,0x81,0x64,
+    0x01,0xfc,0xc9,0x33,0x1c,0x13,0x5b,0x14,0x43,0x4c,0x1e,0xfe,0x33,0xc6,0x43,0x21,
+    0xc0,0x84,0xf1,0xbf,0x28,0x93,0xe2,0x83,0xe7,0x6f,0x69,0x7b,0x5c,0xe0,0x76,0xc5,
+    0x77,0x7f,0x2a,0x4e,0xa9,0x84,0x84,0x38,0xcf,0xed,0x59,0x04,0xdb,0xcc,0xda,0x40,
+    0x24,0x3b,0x18,0xdc,0xda,0x7e,0x47,0xb8,0x1c,0xfc,0x6c,0xcc,0x18,0xca,0x9f,0x52,
+    0xee,0xe4,0x31,0xe9,0xc1,0xcb,0x1b,0x63,0xba,0xe0,0x97,0x1f,0x2d,0x7d,0x16,0xc6,
+    0x3d,0x28,0x26,0xfc,0x6f,0xc4,0xe0,0x7f,0x14,0x36,0xc6,0x41,0x1f,0x08,0xfa,0x9f,
+    0xe9,0xec,0x0c,0xbf,0xe9,0x6a,0x83,0x0a,0xe3,0xd5,0x98,0xc2,0x60,0xc8,0x85,0xad,
+    0x6a,0xe1,0x91,0xa1,0x4f,0x03,0x18,0x2e,0xf8,0xd4,0x7a,0xc0,0x81,0x1c,0xf4,0x81,
+    0x7a,0x88,0x8f,0x0b,0xe2,0x25,0xac,0x0c,0x34,0x43,0x82,0x75,0x66,0x7f,0x45,0xf6,
+    0xed,0x30,0xc8,0x8f,0x4d,0xf2,0x6d,0x82,0x68,0xeb,0x11,0x50,0x78,0x9d,0x21,0xb5,
+    0x33,0x03,0xd0,0x30,0xd6,0x4f,0xa7,0x24,0xf4,0x04,0x8a,0x28,0x21,0x8c,0x12,0x71,
+    0x8c,0xa5,0x24,0xa6,0x12,0xec,0x9b,0xb1,0xf4,0xca,0x06,0x3e,0x37,0x04,0xb0,0xfb,
+    0xdf,0x45,0x05,0x96,0x02,0x1d,0xb7,0xc1,0x7a,0xbd,0x31,0xa7,0xdc,0xae,0x39,0x3d,
+    0x8b,0x24,0x5c,0xf2,0x91,0x27,0x18,0x9f,0xdc,0xa5,0x85,0xa6,0xcf,0x49,0x01,0x78,
+    0x85,0x10,0x71,0xef,0x78,0x5d,0x3b,0xe2,0xbf,0x35,0x49,0x87,0x2a,0x64,0x73,0xdb,
+    0xdf,0x4c,0xe0,0xd5,0xb0,0x29,0x68,0x48,0xdd,0x58,0x7f,0xdb,0xec,0x7b,0xbd,0x10,
+    0xbc,0x20,0xfb,0x1b,0x9e,0x03,0x13,0xe3,0xeb,0x81,0x90,0xa9,0x39,0xc3,0x60,0xef,
+    0xf8,0xe9,0x4d,0x12,0x9b,0x1a,0x31,0xc3,0x0c,0xe6,0xc1,0x28,0x3e,0x14,0x92,0x89,
+    0x97,0x79,0xe0,0x20,0x98,0x1e,0xc5,0xd3,0x0c,0xe3,0x87,0x79,0x4a,0x92,0x92,0x23,
+    0x7f,0xd7,0xc9,0x65,0x0f,0xcb,0x60,0xfe,0xec,0x7c,0x9c,0x6f,0xfc,0x72,0xb2,0xf0,
+    0x9d,0x5c,0x44,0x40,0x75,0x23,0x58,0x75,0x5d,0x0a,0xc4,0xb7,0xdd,0x71,0x15,0x11,
+    0x05,0x4f,0x1d,0xa6,0x4e,0xc7,0xe3,0x3d,0x9f,0x31,0xe7,0x5e,0x87,0x50,0x58,0x45,
+    0x3c,0xb7,0xaf,0x76,0xb0,0x4f,0x7b,0x8e,0x87,0x0b,0xb0,0xaf,0xa1,0xfe,0x55,0x99,
+    0xe2,0x23,0x64,0x05,0xcd,0xda,0x20,0xf9,0xd9,0x22,0x67,0xd8,0x5a,0x06,0x5c,0x3c,
+    0xed,0x75,0xb2,0x89,0xb3,0x47,0x2a,0x6e,0x2b,0x1f,0x92,0x24,0x79,0xe0,0xe0,0xf0,
+    0x86,0xc0,0x91,0xc2,0x3e,0x85,0xb2,0xa7,0x70,0xa4,0xeb,0xd6,0x41,0xcb,0x4d,0xa1,
+    0xb7,0xe5,0x06,0x37,0x29,0xec,0x8b,0xb0,0xcb,0xe1,0xf4,0xf1,0x05,0x77,0x6f,0x4e,
+    0x0e,0x79,0xb6,0xfc,0xf3,0x0a,0xfc,0xce,0x84,0x44,0x81,0xbc,0x40,0x15,0x72,0xc7,
+    0x3b,0x23,0x19,0x97,0x88,0x88,0xc3,0xc0,0x1d,0x84,0x4e,0x37,0xf4,0x4c,0x07,0xf8,
+    0x86,0x39,0x38,0x7b,0x05,0xc8,0xd3,0x2d,0xf7,0x49,0xb4,0x5b,0x7b,0x1c,0xec,0xcb,
+    0x8d,0xe5,0x27,0x0f,0x65,0x98,0x0d,0x31,0xf2,0xa4,0x10,0x49,0xbe,0x5c,0xf6,0xa9,
+    0x94,0x7d,0x2a,0x7d,0xb8,0xee,0x53,0xe9,0xd7,0xd3,0x47,0x0a,0x7c,0x2a,0x5d,0xd4,
+    0x0f,0x18,0x6a,0x47,0xb5,0xc3,0x77,0x82,0x73,0xe4,0xde,0x51,0x5a,0xce,0xa3,0xdf,
+    0x6e,0x27,0xff,0x71,0xfd,0x05,0x6f,0xd3,0x99,0x9c,0xc6,0xf4,0xb4,0xeb,0x7e,0xb3,
+    0x38,0x78,0xc1,0xb6,0xda,0x1e,0x0b,0x82,0x76,0xcf,0x68,0x55,0xb0,0x40,0x39,0x0c,
+    0x09,0x06,0xdc,0x0b,0xf5,0x37,0x6d,0xca,0x86,0xe2,0xcf,0xa2,0xbd,0x8a,0x23,0xa4,
+    0xf2,0x8c,0x9d,0xc4,0x36,0xd2,0xd5,0x2e,0xde,0x83,0x86,0xfb,0x32,0xde,0xd3,0x31,
+    0x3c,0xed,0x3d,0x72,0x4f,0x75,0x3c,0xee,0x4e,0xcb,0x51,0xce,0x78,0x26,0x71,0xd0,
+    0x9e,0xb2,0xa4,0x27,0x8f,0x03,0x1d,0x65,0x0d,0x34,0x05,0xce,0xc9,0x11,0x3b,0x2f,
+    0x84,0xf1,0xdf,0x86,0xd5,0x87,0x81,0xc9,0x96,0x27,0x64,0x2f,0x7c,0x43,0x58,0xa2,
+    0xdf,0x5e,0xec,0x9c,0xfa,0x0d,0x2d,0x5c,0x0b,0x62,0xb3,0x40,0x3b,0xdd,0x78,0x47,
+    0x62,0x0e,0xea,0x36,0x44,0x25,0x0e,0xbb,0x0b,0x17,0xf3,0x07,0xc7,0x08,0x9b,0x02,
+    0xb2,0x5c,0x90,0x2c,0x02,0x59,0xf1,0x89,0x9a,0xef,0x62,0x31,0x3d,0xcb,0xe0,0xf6,
+    0xba,0xa9,0x90,0x40,0xc5,0x40,0x38,0x20,0x5a,0xa0,0x73,0xdf,0x88,0xce,0x3f,0xaa,
+    0xb2,0x49,0x25,0xcc,0x2d,0xdd,0x33,0x4a,0xc4,0x8e,0x74,0x15,0x10,0xa0,0x1d,0xd7,
+    0xc3,0x69,0x1d,0xe7,0x31,0x61,0x6d,0x65,0x81,0x3a,0x7d,0x0e,0x51,0x32,0xde,0x7a,
+    0x3f,0x58,0x92,0x4c,0x04,0xab,0x0e,0x3e,0x28,0xc8,0xf1,0x76,0x18,0x8a,0xdb,0x99,
+    0xcd,0x67,0x7c,0xe9,0x35,0x2b,0x38,0xa2,0x0a,0x9c,0xe1,0x03,0x87,0xec,0xfb,0x20,
+    0x29,0x88,0x4a,0x86,0x3e,0x03,0xa7,0x1e,0x73,0x69,0x3c,0x56,0x51,0xf0,0xe9,0xd8,
+    0xa2,0xca,0xec,0x2e,0x41,0x7b,0x95,0xa7,0x46,0x76,0xe5,0x80,0x70,0x81,0xf1,0xa5,
+    0x05,0xe9,0x13,0x3e,0x5a,0xe3,0x30,0xe8,0x30,0x43,0xe6,0x38,0x82,0x84,0xd9,0x8e,
+    0x64,0xfe,0xd7,0x73,0x14,0x14,0xd3,0x10,0xec,0xb8,0x37,0x22,0x0c,0xf5,0x05,0xf2,
+    0x4a,0x62,0x0a,0x93,0x09,0xeb,0x6e,0xce,0x40,0x02,0x79,0x44,0x64,0x47,0x64,0x3c,
+    0x6e,0x81,0x37,0x65,0xe4,0xd1,0x9c,0x34,0x68,0x85,0x47,0x49,0x39,0xc6,0xd6,0x12,
+    0x07,0x62,0x43,0x23,0x4f,0x7b,0xbd,0x02,0xe6,0x73,0xd4,0xde,0x56,0x7d,0x5a,0x28,
+    0xa6,0x32,0x54,0x54,0x1c,0xe1,0xda,0x25,0xcf,0x9f,0x62,0x76,0x12,0xf3,0x97,0x5f,
+    0x3e,0xc5,0xec,0xd3,0xed,0x7f,0xf9,0x84,0x45,0x9c,0x72,0x9e,0x24,0xa6,0x77,0xce,
+    0xe0,0x23,0x1b,0x78,0x41,0xe7,0x48,0x75,0x3b,0x07,0x2a,0x29,0x0b,0x72,0x92,0xfb,
+    0x26,0xbf,0xe3,0xd4,0x6e,0x2a,0x9d,0x2d,0x5e,0x4f,0x46,0xc7,0xd3,0xe2,0xb0,0x95,
+    0x5f,0x0b,0xd2,0xca,0x3e,0x0c,0xcb,0x39,0xfc,0xdd,0xbe,0xa1,0xc9,0xc8,0x7b,0xa7,
+    0x64,0xed,0x6f,0x88,0x1f,0x6c,0x86,0x7b,0x5e,0x31,0xf4,0x4e,0xe7,0x60,0xc0,0xfd,
+    0xad,0x71,0x77,0x00,0xff,0xe6,0xa4,0x8b,0xdf,0xa6,0x39,0x48,0xa3,0x3e,0x8e,0x28,
+    0x9a,0xbb,0x6f,0xee,0x3f,0x18,0xd9,0x4c,0x3f,0x82,0xc7,0x4c,0xd0,0x3e,0x3b,0xc7,
+    0x86,0x41,0x3b,0x7c,0x77,0x48,0x9d,0x98,0x4d,0x85,0x3d,0xca,0xc6,0x80,0xb4,0xef,
+    0x22,0xf6,0x4e,0x2b,0xbc,0xe1,0x71,0x8c,0x48,0x64,0xcb,0xd7,0x61,0x0a,0x16,0x4c,
+    0xda,0xf9,0x19,0x00,0xfb,0xdd,0xb1,0xcd,0xfe,0xbe,0x27,0x93,0x82,0x39,0xe1,0x9e,
+    0xa0,0xe7,0xb4,0xdb,0x79,0x7c,0x8a,0xa6,0xc8,0x83,0x1d,0xb2,0xae,0x82,0x54,0x67,
+    0xe9,0x72,0x04,0x3f,0x19,0x45,0x45,0xa3,0x51,0x9b,0xdb,0x3b,0x2f,0xfa,0x1e,0x41,
+    0x6a,0x47,0x54,0xcc,0xf9,0x70,0xaa,0x58,0xfb,0x9d,0x1d,0xf9,0xd9,0x93,0x15,0x27,
+    0x1e,0xa3,0x29,0xf2,0x3b,0x04,0x59,0x72,0x46,0x02,0x65,0x63,0xe0,0x11,0x20,0x9f,
+    0xf7,0xb9,0x4e,0x4a,0x92,0xaf,0x34,0xb9,0x0f,0x5a,0x1c,0xed,0x71,0x42,0xa0,0x30,
+    0x02,0x27,0xc5,0xe9,0x05,0x91,0xda,0x8a,0x15,0x9e,0xe0,0x31,0x99,0x3a,0x2e,0x57,
+    0xc7,0x64,0xcb,0x2e,0xfa,0x4b,0xe5,0xcd,0x61,0x2d,0xd1,0xfb,0xdd,0x17,0xd0,0x5e,
+    0xe4,0xa5,0xfd,0xb2,0x87,0xe0,0xf0,0xd3,0x7e,0xeb,0x63,0xcb,0xd4,0xfd,0x57,0x2d,
+    0xff,0x56,0x86,0x3a,0x4f,0x4b,0x7c,0x0c,0x4b,0xc9,0x2c,0xde,0xc7,0xd4,0x0d,0x14,
+    0xfb,0xc7,0x39,0xf6,0xde,0x33,0x74,0xa7,0x6b,0xe1,0x04,0x9d,0x5d,0xf4,0xf9,0xe4,
+    0x38,0x47,0x99,0xe5,0xbc,0xc3,0x77,0x84,0x65,0xd4,0xe6,0xad,0x3c,0x97,0x77,0x76,
+    0x7b,0x67,0xcf,0xd6,0x97,0x69,0xde,0x17,0x49,0x6d,0xd6,0x6d,0xa0,0x64,0xb7,0x6f,
+    0xf9,0xfd,0x2d,0xec,0x8c,0x88,0x80,0xde,0xc7,0xf0,0xd2,0x9e,0xd1,0xff,0x45,0x05,
+    0xdd,0x5d,0xa6,0x5f,0x5a,0x92,0xbd,0xef,0xf3,0xbf,0x59,0xf1,0x5e,0x5e,0x97,0x8f,
+    0xb3,0xca,0x3e,0x2a,0xe0,0x43,0x78,0x45,0xce,0x2d,0xfc,0x13,0x6a,0xf7,0x2e,0xc2,
+    0xed,0x9c,0x6c,0xf0,0xf7,0x52,0xce,0xf3,0x28,0xe0,0x9f,0x23,0x5c,0x8b,0xcc,0xe1,
+    0xef,0xa6,0xdc,0xf6,0x88,0x87,0xbf,0x97,0x6e,0xe4,0xf5,0xf4,0x0f,0x32,0xf4,0xfa,
+    0xec,0xa3,0x4d,0xc3,0xb1,0xdb,0x8f,0x74,0xe4,0x77,0x5a,0x91,0xbc,0x32,0xe5,0x7c,
+    0xe3,0x37,0x83,0xf0,0x63,0x72,0xc7,0x6c,0xcb,0x61,0x4f,0x9c,0x91,0xa6,0x5f,0x22,
+    0x94,0x0b,0xf6,0x34,0xb1,0x0e,0x48,0xe2,0x3f,0x2c,0xc9,0x06,0x00,0xc2,0x9d,0xa1,
+    0x9a,0xb7,0x34,0x93,0x22,0x11,0xe2,0x0b,0x88,0xdb,0x3f,0x7a,0x65,0xbc,0x20,0x2e,
+    0xdb,0xc7,0x61,0x65,0x7d,0x0a,0xf1,0xbe,0x9d,0x71,0xa0,0x48,0xcc,0x86,0x63,0xf4,
+    0xf1,0x0b,0xf2,0xb6,0x8f,0xeb,0x26,0x9a,0xa5,0x0e,0xa2,0x54,0x9a,0x02,0x47,0x1c,
+    0x7b,0xe9,0xb8,0xfa,0x15,0x60,0xbd,0x6a,0xb6,0xa7,0x58,0xce,0x86,0xd1,0x66,0xa9,
+    0xc6,0xc7,0x7c,0x50,0x39,0x55,0xa5,0x02,0x65,0x2e,0x1d,0xf4,0x28,0x9c,0xf7,0xbc,
+    0x91,0x08,0x1b,0x7c,0xe5,0xa8,0x5b,0x2e,0xba,0x80,0x4f,0x71,0xf1,0x6d,0x86,0xe3,
+    0xcf,0xcc,0xb0,0x47,0xe1,0xb3,0x49,0xc8,0x24,0xa9,0xde,0xb1,0x69,0x32,0x6f,0x9f,
+    0x65,0x59,0xa7,0x6c,0xf8,0x3f,0xd8,0x34,0x33,0xdc,0xee,0x34,0x77,0x0e,0x74,0x79,
+    0xc7,0x3c,0xdb,0xc8,0xfa,0x4b,0x27,0x7a,0x42,0x9f,0xb7,0x4d,0x2c,0xe9,0x45,0x95,
+    0x7c,0xaf,0xca,0xf9,0xe4,0x97,0xde,0xa5,0x74,0xc2,0xd1,0xb0,0x66,0xc3,0x8a,0xed,
+    0x29,0x42,0x4c,0x38,0x82,0x4f,0x68,0x7f,0x13,0x33,0xde,0xe3,0xf6,0xbe,0x6e,0xa5,
+    0x53,0xc5,0x17,0xd7,0xb9,0x37,0xae,0x7b,0xfe,0xa2,0xd4,0xc3,0x93,0x7e,0x9b,0x14,
+    0x09,0x7f,0x19,0xf5,0xff,0x89,0xc4,0xff,0x41,0x68,0xff,0x0f,0x24,0xfd,0x8f,0x41,
+    0xf9,0xe8,0x3f,0x90,0xf4,0x4c,0xf4,0xe3,0x89,0xff,0x0f,0x5d,0xb3,0xa2,0xef,0x70,
+    0x06,0x7b,0xa1,0x37,0x32,0xe0,0xaf,0x96,0x3c,0xe3,0x2f,0x95,0xbc,0xbf,0x4c,0x77,
+    0xdf,0x45,0xfa,0x9f,0x84,0xff,0x00,0xc2,0x33,0xef,0xa2,0x3c,0xf3,0x93,0xf4,0x1f,
+    0x40,0xfa,0x77,0xd2,0x7e,0x43,0xfc,0x9f,0xd4,0xff,0xa0,0x05,0x8b,0xbc,0xc8,0xfb,
+    0x23,0xa6,0x4c,0xfe,0xea,0x04,0x49,0xdf,0x93,0x3e,0xe8,0x1f,0x4b,0x1f,0xb0,0xef,
+    0x4f,0x1f,0xf4,0x7f,0x8c,0xf4,0x41,0xdf,0x93,0x3e,0xe8,0x1f,0x4d,0x1f,0xb0,0x7f,
+    0x22,0x7d,0xd0,0xff,0x99,0x3e,0xf8,0x30,0xd3,0xc8,0xfe,0x23,0xd3,0x07,0xfd,0x1f,
+    0x24,0x7d,0xc0,0xfe,0x13,0xd3,0x07,0xfd,0x1f,0x23,0x7d,0xc0,0xfe,0x03,0xd3,0x07,
+    0xfd,0x1f,0x22,0x7d,0xc0,0xfe,0x13,0xd3,0x07,0xfd,0x9f,0xe9,0x83,0x8f,0x93,0x9f,
+    0xf7,0xa4,0x0f,0xfa,0x3f,0xd3,0x07,0x1f,0x42,0xfb,0x77,0x91,0xfe,0x27,0xe1,0x3f,
+    0x80,0xf0,0xcc,0xbb,0x28,0xff,0x33,0x7d,0xf0,0x11,0xa4,0x7f,0x27,0xed,0x7f,0xa6,
+    0x0f,0x7e,0xa6,0x0f,0x3e,0x28,0xae,0x1e,0x78,0xd2,0x07,0x83,0x63,0xe9,0x03,0xee,
+    0xfd,0xe9,0x83,0xc1,0x8f,0x91,0x3e,0x18,0x78,0xd2,0x07,0x83,0xa3,0xe9,0x03,0xee,
+    0x4f,0xa4,0x0f,0x06,0x3f,0xd3,0x07,0x1f,0x66,0x1a,0xb9,0x7f,0x64,0xfa,0x60,0xf0,
+    0x83,0xa4,0x0f,0xb8,0x7f,0x62,0xfa,0x60,0xf0,0x63,0xa4,0x0f,0xb8,0x7f,0x60,0xfa,
+    0x60,0xf0,0x43,0xa4,0x0f,0xb8,0x7f,0x62,0xfa,0x60,0xf0,0x33,0x7d,0xf0,0x71,0xf2,
+    0xf3,0x9e,0xf4,0xc1,0xe0,0x67,0xfa,0xe0,0x43,0x68,0xff,0x2e,0xd2,0xff,0x24,0xfc,
+    0x07,0x10,0x9e,0x79,0x17,0xe5,0x7f,0xa6,0x0f,0x3e,0x82,0xf4,0xef,0xa4,0xfd,0xcf,
+    0xf4,0xc1,0xdf,0x97,0x3e,0x38,0x02,0xfa,0xe5,0xf7,0x66,0xf6,0x97,0xb7,0x37,0xbd,
+    0x06,0xf3,0xc1,0xaf,0xbd,0xd8,0x6f,0x6d,0xbe,0xf7,0xa5,0x17,0xf2,0x5e,0x8b,0xcf,
+    0x6b,0x2f,0xee,0xf1,0x22,0xd4,0xce,0x79,0x1e,0x27,0x5f,0x7c,0x21,0x47,0x66,0xfc,
+    0x99,0x34,0x8d,0xbc,0x79,0xf3,0x54,0xf6,0xbc,0x78,0x6a,0xc9,0x2f,0xf7,0x23,0xaf,
+    0xb1,0xca,0xdf,0x7a,0xf4,0xe7,0xde,0x9b,0x3a,0xf4,0xe9,0xcf,0xfd,0x37,0x75,0x18,
+    0xd0,0x14,0x39,0x48,0x01,0x1f,0x98,0x60,0x1f,0x9f,0xe5,0x1e,0xbf,0x45,0x7f,0x1e,
+    0x9c,0x86,0xf4,0xa7,0xb3,0x58,0x7e,0xe4,0x69,0x3a,0xc7,0x89,0xbc,0x66,0x12,0x92,
+    0x3d,0x09,0x09,0x93,0x49,0x8b,0x09,0xaf,0xf2,0xf2,0xdc,0x2e,0xfd,0xb7,0x77,0x39,
+    0x45,0xaa,0x17,0x61,0xfd,0x25,0xc4,0x6a,0x5b,0x68,0x66,0xbe,0x89,0x52,0x26,0xf4,
+    0x78,0x07,0xb5,0x70,0xb7,0xfe,0xfb,0xba,0xfd,0x78,0x54,0xab,0x29,0x1a,0x79,0x9b,
+    0xf1,0x4d,0x84,0x9b,0x2a,0xda,0x3b,0xe8,0x06,0xbd,0xfa,0xef,0xea,0xf5,0x03,0x52,
+    0x4d,0x58,0xbd,0x83,0x6a,0xc2,0xea,0x3d,0x54,0x13,0x56,0xfd,0x77,0xf5,0xfa,0x11,
+    0x35,0x54,0xb0,0xd0,0x9b,0x48,0x66,0xe0,0x77,0x7b,0x49,0x37,0x9a,0x12,0x75,0x15,
+    0x2f,0x82,0x59,0x3a,0x7e,0x62,0x62,0xff,0x0b,0xb3,0xba,0x99,0xa3,0x39,0xaa,0x22,
+    0xed,0xed,0x13,0x73,0x7b,0xfe,0x1d,0x73,0x8b,0x9d,0x58,0xc0,0xa1,0x92,0x9c,0x34,
+    0xf7,0xe3,0xbf,0x62,0x4c,0x7e,0x62,0xc6,0x3e,0x40,0x22,0x32,0x3a,0x71,0x7e,0xc1,
+    0x3b,0x9d,0x2d,0x72,0xbe,0xdb,0x4b,0xe1,0xd1,0xde,0x81,0x18,0xdd,0xcd,0x4f,0x10,
+    0xe0,0xe3,0xf2,0x0f,0x5e,0x59,0x77,0xce,0x3f,0xdd,0x6c,0x89,0x74,0x7d,0x4e,0xbf,
+    0xf0,0xfb,0x3d,0x98,0x97,0x5e,0x67,0xdf,0x22,0x6d,0xf7,0x7e,0x11,0xeb,0x17,0xb7,
+    0x3d,0xf6,0x13,0x3a,0xe4,0xd0,0x53,0x2c,0x75,0xc7,0xdd,0xcb,0x17,0x5e,0xb7,0xc6,
+    0x14,0x3a,0xf8,0x01,0xac,0x3d,0xbe,0xb4,0xe7,0x43,0x18,0x83,0xe0,0xee,0x4c,0xe1,
+    0x14,0x54,0xf7,0x4c,0x73,0x17,0xc8,0xe6,0x8c,0x73,0xfb,0x1c,0x18,0x3c,0xe0,0xe1,
+    0x6f,0x46,0x50,0x60,0x0c,0xb3,0x34,0xc4,0x5e,0x34,0x65,0xff,0x5a,0x0a,0xcd,0x31,
+    0x1b,0x35,0x73,0xcf,0x08,0x23,0xbf,0x87,0x02,0x63,0xbb,0xdd,0xdf,0xe1,0x50,0xbb,
+    0x47,0x0b,0x52,0xde,0xd3,0x02,0xb7,0x1e,0xb6,0xa1,0xcc,0x1c,0x14,0xbd,0xbf,0xb8,
+    0x75,0xca,0x1c,0xd9,0x47,0x79,0x9d,0xb6,0x28,0xc6,0x2b,0x42,0x2c,0xb0,0x4b,0x10,
+    0xe0,0x3a,0x71,0x1f,0x6d,0xff,0x8e,0x96,0x60,0x01,0x42,0x20,0x12,0x40,0x02,0x37,
+    0xa0,0xcc,0xd9,0x3f,0x93,0xf5,0xca,0xb0,0xed,0x25,0x63,0xf7,0x9a,0x91,0x31,0x09,
+    0xec,0x9f,0x95,0x22,0x3f,0x7e,0x52,0x17,0xf0,0x09,0x12,0x7f,0xdb,0xe8,0xf8,0xd4,
+    0x42,0x58,0x94,0xe0,0xf3,0x83,0x06,0x7d,0xd1,0x04,0x9f,0x66,0xe8,0x8b,0x31,0xd6,
+    0xff,0x17,0x36,0xfc,0xa3,0xe3,0x63,0xe7,0x68,0xcb,0x37,0x5a,0xed,0xb6,0xb0,0x40,
+    0x05,0x5d,0x1b,0x29,0xe3,0x17,0x2d,0x36,0x6e,0xea,0xdd,0xb5,0xde,0xf4,0x0c,0xbc,
+    0xce,0x3e,0xe3,0xfe,0x3f,0x9a,0x75,0x7e,0x6d,0x5e,0xc0,0x73,0x7e,0x29,0xb5,0x77,
+    0x96,0xe8,0xdf,0x9f,0x2c,0x20,0x07,0xbd,0xd8,0x36,0xe2,0x0d,0x9e,0xd6,0xa6,0xd7,
+    0x09,0xcf,0xea,0x15,0xa6,0x04,0xad,0x2c,0xc1,0x40,0x9b,0x34,0xe1,0xde,0xf1,0x8d,
+    0xf4,0xc1,0x68,0xdf,0xc8,0x99,0x7a,0xc4,0x69,0x73,0xba,0xfe,0xaf,0x3e,0x23,0x73,
+    0x94,0x9e,0xb6,0x28,0xbf,0x9d,0xa2,0xae,0xf2,0xfc,0x05,0x34,0x25,0x87,0xf1,0xd1,
+    0x3e,0xa3,0xfd,0x1f,0xa0,0x69,0x5b,0x94,0x91,0x34,0x57,0xdf,0x26,0xa2,0x85,0xa9,
+    0xe4,0xf6,0xfb,0x1b,0x08,0xea,0x19,0xed,0xff,0x00,0x41,0x0b,0xe4,0x37,0xad,0x28,
+    0x22,0x05,0xf8,0x47,0x0c,0xdf,0x2e,0xa9,0xb8,0xd7,0x9f,0x22,0xab,0xfd,0xfb,0x25,
+    0x07,0x30,0xdb,0xa4,0xf8,0x35,0x00,0x62,0x36,0x84,0x57,0xb4,0xf4,0x2c,0x52,0xde,
+    0xa1,0xc8,0xb6,0x83,0xf7,0xc0,0xb0,0x9d,0x0a,0xbc,0x0e,0x81,0x55,0x7e,0xc3,0x83,
+    0x4d,0x78,0x61,0x20,0x5d,0x29,0xbc,0x38,0xe1,0x5f,0xcd,0x16,0xb1,0x82,0x19,0x53,
+    0xca,0xfe,0x09,0x31,0xf3,0xaf,0x7e,0xa8,0xef,0xaf,0xf7,0x64,0xbc,0xa7,0xe4,0xfd,
+    0xb2,0xd9,0x47,0x59,0x20,0xc3,0x04,0x1f,0x17,0xa2,0x81,0x28,0x4b,0x53,0xab,0xa9,
+    0xaa,0xe1,0xc7,0x06,0x2d,0x6b,0x76,0x16,0x8b,0x2d,0x97,0xcb,0xe8,0x32,0x1e,0xd5,
+    0x8d,0x71,0x8c,0x63,0x18,0x06,0xef,0x73,0x38,0x4d,0xce,0xc8,0xc6,0x89,0x5f,0x43,
+    0x36,0x93,0xc9,0xc4,0x48,0x2d,0x69,0x7a,0x46,0x4e,0x67,0xc2,0x31,0x08,0x32,0x91,
+    0x01,0x6e,0x83,0x07,0x35,0x73,0x3d,0x1d,0xea,0x2a,0x61,0xad,0xf7,0x3c,0x59,0x6a,
+    0xa1,0xa0,0x65,0x5e,0x87,0x00,0x85,0xc1,0x3f,0xe1,0x02,0x23,0x93,0x8f,0x7d,0x6f,
+    0xcb,0x67,0xcb,0xe5,0xd3,0x4c,0x00,0x8d,0x01,0x70,0x35,0x9e,0x87,0x4e,0x10,0xdf,
+    0xc8,0x09,0x86,0x79,0x60,0x93,0x3c,0x00,0xe2,0xf8,0x54,0x94,0xa7,0x22,0x19,0x2e,
+    0xca,0x5b,0xf8,0x83,0x8a,0x90,0x92,0x45,0x04,0x37,0x61,0xa8,0x08,0x6e,0x15,0xf1,
+    0x54,0x58,0x11,0x4f,0x0f,0x99,0xb4,0x8a,0x70,0x2c,0x00,0x8a,0xc4,0x79,0x28,0x66,
+    0x13,0xb8,0x09,0xfe,0xa4,0xf0,0xfd,0x82,0x25,0x50,0xa0,0xc1,0xa6,0xc8,0xda,0xb4,
+    0x93,0x13,0x3c,0xf3,0x90,0xc0,0x7d,0x53,0x0c,0x14,0x71,0x19,0xa8,0xc4,0x1f,0xe4,
+    0x76,0xc1,0x93,0x9e,0x50,0x1d,0xd9,0x94,0x59,0x91,0x4d,0x43,0x18,0x99,0x7f,0x71,
+    0x64,0xea,0xe8,0xd0,0x8f,0xb5,0x78,0x3c,0x4d,0xa5,0x93,0x29,0x35,0xce,0x25,0x60,
+    0x84,0x74,0x02,0xc8,0x01,0x93,0x4d,0x50,0xf8,0x2b,0x1e,0x07,0x40,0xe4,0x5b,0x8d,
+    0x6c,0xea,0x23,0x4e,0x83,0x08,0x97,0x82,0xc9,0x43,0x03,0x96,0xe2,0x92,0x0b,0x96,
+    0x67,0x64,0xa0,0xc8,0x69,0x54,0xb8,0x53,0x44,0x80,0xce,0x18,0x8a,0xd3,0x00,0x03,
+    0xb5,0xc8,0x08,0x8f,0x24,0xc8,0x14,0xf6,0x8d,0xd8,0xa7,0xd8,0xd8,0x2b,0xc6,0xb6,
+    0xb0,0x9c,0x90,0x1e,0x72,0x78,0xec,0x47,0xc8,0x8e,0xdd,0x8b,0x01,0x92,0x24,0xd2,
+    0x71,0x8a,0x4b,0x25,0x81,0x36,0x98,0x1c,0xf1,0x4c,0x66,0x91,0xe0,0xe2,0x32,0xbe,
+    0x50,0x59,0x36,0x93,0xa4,0x52,0x99,0xe4,0x22,0xc2,0x32,0x99,0xe4,0x63,0x0d,0x37,
+    0x4d,0x70,0x89,0x45,0x84,0x8b,0x33,0x6a,0x12,0x6e,0x32,0x7c,0xfc,0x91,0xb6,0x7f,
+    0x86,0x03,0xa7,0x65,0xc0,0x4b,0x16,0x05,0x15,0xd9,0x6f,0x64,0xd9,0xc5,0xf8,0x67,
+    0x31,0xc9,0x01,0x2f,0x1c,0xd9,0x3a,0xfd,0xf3,0x34,0xc0,0x0f,0xea,0x7c,0x04,0x01,
+    0xd2,0x69,0x9e,0xca,0x30,0x0c,0x4c,0x9b,0xe7,0x30,0xa3,0xe3,0xea,0xe6,0x22,0xc2,
+    0x66,0x80,0x65,0x6c,0x26,0xad,0x46,0x78,0x28,0x83,0x3f,0xd5,0xfe,0x66,0x3e,0x84,
+    0x8b,0x78,0xfb,0xf5,0x43,0x58,0xc8,0x24,0x13,0x14,0x9f,0x48,0x61,0x2c,0x41,0xaf,
+    0xe0,0x03,0x63,0x9e,0xa6,0x30,0xe2,0x30,0x0d,0x8a,0x4c,0xc5,0xbd,0x70,0x2a,0x3e,
+    0x48,0x0c,0xdd,0xb3,0x5c,0x3f,0xc2,0x88,0x31,0x1c,0xc8,0x61,0x3a,0xf3,0x00,0x96,
+    0x0c,0x1b,0x30,0x06,0x4f,0x05,0xdb,0x0e,0x36,0x0e,0x66,0x89,0xe5,0x93,0x51,0xfe,
+    0x21,0x11,0xa7,0x58,0x9e,0x4a,0x67,0xe0,0xf3,0x81,0x25,0x9a,0xc9,0x31,0xa0,0xbe,
+    0x69,0xa8,0xb3,0xd2,0x70,0x01,0x77,0xd0,0x0a,0xf4,0x35,0x93,0xa1,0x22,0x49,0x6c,
+    0xe6,0xd2,0x2c,0x68,0x2c,0x8f,0xaf,0x58,0xcc,0xe2,0x54,0xfa,0x70,0xc9,0x89,0x27,
+    0x41,0xcd,0xd9,0xb8,0x6d,0x22,0x58,0xac,0xbf,0x49,0xcb,0xbe,0x00,0xdb,0x00,0x7d,
+    0xd2,0x80,0x48,0x3c,0x09,0xa6,0x29,0xf3,0x10,0x49,0x65,0xb0,0x35,0x60,0x89,0x9a,
+    0xdb,0x66,0x13,0xe3,0x45,0xb1,0x71,0x7b,0xdc,0x64,0x86,0xc2,0x28,0x72,0xd8,0xea,
+    0xc2,0x5c,0xa8,0x24,0x34,0x01,0x13,0x02,0x04,0x07,0xdc,0xa8,0x78,0xfa,0x81,0xfc,
+    0x7e,0xd1,0x21,0x0a,0x09,0x98,0x51,0x3a,0x41,0xe6,0x1a,0x27,0xe0,0x12,0x16,0xb9,
+    0x87,0x0a,0x30,0x6a,0x54,0x2d,0x19,0xe7,0xa8,0x04,0x58,0x35,0x8e,0x8b,0x03,0x20,
+    0x2e,0xfd,0x00,0xe8,0x62,0xc3,0x95,0xc6,0x66,0x8b,0x18,0x6f,0x6c,0xc4,0x58,0x6c,
+    0x3f,0xd9,0x78,0x0a,0xd4,0x32,0x45,0xa8,0x00,0x84,0x8c,0x10,0xa3,0xce,0x92,0x46,
+    0xf8,0xf3,0x70,0x6c,0xdc,0x42,0xc6,0x34,0x7a,0x88,0x10,0xc2,0x93,0x66,0x14,0xe9,
+    0x80,0x2f,0xf0,0xdd,0x02,0xe0,0x11,0xc8,0xae,0x39,0x84,0xe1,0xf0,0x68,0x56,0x9a,
+    0xc2,0xc3,0x3f,0xc0,0x2a,0x08,0x8c,0x48,0x50,0x18,0x3d,0x82,0x5d,0x06,0xcf,0xd8,
+    0xa6,0x65,0xc6,0x8a,0x93,0x55,0x86,0xcd,0xbc,0xd6,0x40,0xb0,0x1f,0x65,0x20,0xc8,
+    0x09,0xbe,0xbb,0xa2,0xc9,0xb3,0xe4,0xef,0x4d,0x82,0xc9,0xf1,0x7c,0x98,0x29,0xb0,
+    0x60,0xd5,0x53,0x3c,0xf9,0x51,0xb5,0xcd,0x25,0xd4,0x98,0xce,0x0d,0x6e,0xe4,0xfc,
+    0x99,0xf0,0x17,0xd9,0x16,0xc3,0x32,0xc2,0xb7,0xe3,0x19,0x3e,0xca,0x39,0x5d,0xc2,
+    0x0c,0x70,0x34,0x9e,0x06,0xaa,0x84,0xe3,0x89,0x64,0x34,0x8d,0x75,0x33,0x9a,0x0a,
+    0xe3,0x8f,0x5f,0xfe,0xf5,0xaf,0x7f,0x55,0x09,0x98,0x0c,0x13,0x05,0x7d,0xce,0xb0,
+    0xd1,0x74,0x18,0x7f,0xd8,0x6d,0xc8,0x87,0x8a,0xef,0x23,0x76,0xe1,0xf6,0x72,0xb7,
+    0xda,0xee,0xb3,0x5b,0x4b,0x06,0xa8,0x12,0xc0,0x18,0x8b,0xaa,0x07,0x83,0x8f,0xb1,
+    0x66,0xe4,0x4c,0xd4,0x3d,0x4b,0x90,0x61,0xf1,0xdf,0xdb,0xac,0x19,0x9f,0x8e,0x66,
+    0x58,0x2e,0xcc,0x5c,0x82,0x00,0xa5,0xd2,0x5c,0x01,0x28,0xc9,0xc5,0x33,0x36,0xe5,
+    0xdd,0x4b,0xbb,0x6a,0xc1,0x82,0xf8,0xb1,0x71,0x11,0x2a,0x40,0x0c,0x13,0x09,0xb7,
+    0xde,0xae,0xdd,0xfd,0xc2,0xa4,0xfd,0x97,0xec,0x74,0x70,0x9a,0xbb,0x70,0x22,0x3b,
+    0xfd,0x22,0xf6,0xd7,0xad,0x3b,0x3c,0x50,0x2c,0x99,0xe1,0x5d,0xd8,0x6c,0x2a,0x19,
+    0x4d,0xf0,0x49,0x8c,0x8c,0x8b,0xe8,0xc7,0x90,0xcf,0x3e,0xc4,0x78,0x97,0x7e,0x89,
+    0x24,0xfc,0xff,0x36,0xea,0xc5,0xa3,0x99,0x74,0x2a,0xcc,0x88,0x11,0x2e,0x9a,0x4a,
+    0x02,0x72,0x11,0x10,0x26,0x8c,0x38,0x7c,0xf3,0x0b,0x10,0x81,0x4c,0x8a,0x07,0x7a,
+    0xe1,0xca,0x38,0xa9,0x48,0x87,0x79,0xfc,0xcf,0x04,0x39,0xb5,0xef,0x22,0xfc,0x2d,
+    0x5f,0x60,0xd3,0x04,0x8c,0x5d,0xc4,0x26,0x6d,0x71,0x77,0x61,0x3f,0xd2,0xb1,0x53,
+    0x28,0x00,0xdd,0x5e,0x8b,0x02,0x77,0x02,0x05,0x30,0xa9,0x2e,0x0a,0xc0,0x19,0xd0,
+    0xa6,0x84,0xc3,0x78,0x7f,0x1c,0xde,0x4a,0x6d,0x7c,0xf0,0xf1,0x2e,0xb1,0xb9,0x78,
+    0x1c,0xff,0xbd,0xcd,0x36,0x30,0xf1,0x68,0x2a,0xc3,0xe2,0x5f,0x5f,0x4f,0x72,0xe9,
+    0x2a,0x98,0xeb,0x38,0x43,0x70,0xce,0x24,0xc4,0x08,0x18,0xf0,0x64,0x0a,0x13,0x81,
+    0xcd,0x80,0x69,0xc5,0x53,0xc3,0x13,0x4c,0x26,0x89,0x0b,0xc9,0xb1,0xf6,0x0d,0xc8,
+    0xa5,0x88,0x4d,0x2e,0x1b,0xc7,0x94,0x82,0x0b,0x06,0x84,0x0b,0x28,0xcd,0x71,0xa9,
+    0xcd,0x1d,0x2c,0x2e,0xa9,0xf4,0x02,0x56,0xed,0x28,0x80,0xc5,0x94,0x4b,0xc7,0xe3,
+    0x11,0x06,0xff,0xb6,0xa3,0x5d,0x87,0xa5,0x72,0xdb,0x32,0x23,0x82,0xa4,0xa6,0xe3,
+    0x40,0xac,0x4c,0x34,0x83,0xcd,0x0d,0xc8,0x2b,0x1b,0xf6,0x8c,0x89,0xcd,0x8c,0xca,
+    0xf2,0x89,0x28,0xb8,0x71,0x91,0x4c,0x2a,0x1a,0x8f,0x83,0x46,0x70,0xd1,0x64,0x1a,
+    0x1b,0xfc,0x04,0xc0,0x84,0x1e,0x69,0x40,0x19,0x04,0x1d,0x68,0xbe,0x73,0xd7,0xe6,
+    0xf0,0x77,0x0a,0xbf,0x3f,0x07,0x28,0xa7,0x80,0x7f,0x3b,0x04,0xf8,0xb3,0x5c,0x91,
+    0x20,0x4e,0xb6,0xf6,0x95,0x00,0x16,0x1b,0xee,0x6d,0x4a,0x80,0xfd,0x6d,0x4c,0x9f,
+    0x38,0xcb,0xf1,0x54,0x01,0x96,0xdc,0x28,0x9b,0x4c,0x30,0xc9,0xf8,0xb6,0x10,0xf8,
+    0x94,0x88,0xa7,0x20,0x50,0xc2,0x74,0x4f,0xc3,0x6a,0x9a,0x8e,0x92,0xbb,0x14,0x9b,
+    0x4e,0xe1,0x2e,0xe9,0x28,0x38,0x1c,0xd0,0x8e,0x05,0x7e,0x26,0x92,0xe9,0x34,0xac,
+    0x87,0x99,0x24,0xae,0xe2,0xa0,0x43,0x12,0x18,0xba,0x29,0x88,0x53,0x55,0x2a,0x01,
+    0x9f,0x05,0x2a,0x8e,0x09,0xc4,0xe1,0x85,0x0f,0xff,0xdb,0xde,0x24,0xa0,0x05,0xe7,
+    0x7c,0x26,0xf1,0x67,0xc2,0xfd,0x22,0x65,0xb8,0x41,0x01,0x7f,0x6d,0xba,0x60,0xf7,
+    0x81,0x67,0x52,0xe0,0x77,0xe0,0xe5,0x94,0x8c,0x00,0xfa,0x68,0x23,0x8e,0x07,0xda,
+    0xdc,0x6c,0x90,0x01,0xf6,0xa7,0xc9,0x7c,0x36,0xf8,0x42,0x09,0xe7,0x9d,0x10,0xb0,
+    0x2d,0x49,0x66,0xb4,0x99,0x31,0xcb,0x83,0x18,0xf1,0x19,0x88,0x97,0x36,0x54,0x01,
+    0xdf,0x6a,0x73,0x3d,0xa0,0x08,0x19,0x39,0xe7,0xb6,0x8a,0x2b,0xb9,0x2d,0x49,0xc1,
+    0x01,0x4a,0x38,0x04,0x71,0xfb,0x3a,0x63,0x01,0x52,0x49,0x06,0xa8,0x47,0x4a,0xd2,
+    0x36,0x9a,0x9c,0x8b,0x05,0xef,0xe0,0x09,0x45,0xa9,0x54,0x3c,0x91,0xc0,0x25,0x2e,
+    0x61,0x13,0x09,0x16,0x98,0xb4,0x2d,0x21,0xf3,0x66,0xbc,0xf3,0x66,0x36,0xf3,0x76,
+    0xdb,0x32,0x0e,0x9f,0xb6,0xf0,0x18,0x67,0x30,0xcf,0xa0,0x50,0xe4,0xe0,0xe1,0x62,
+    0x86,0x55,0xc2,0x81,0xe4,0x60,0xbf,0x9d,0x29,0x9e,0x78,0x82,0x4a,0x11,0xb6,0x72,
+    0x78,0x58,0xf8,0x4a,0x00,0xf1,0x38,0x0c,0x9e,0x07,0xb9,0x49,0x01,0x21,0xb1,0x50,
+    0xa6,0xf0,0x47,0x15,0x7b,0x3a,0xf0,0x0d,0x1c,0x64,0xdc,0x46,0x58,0x60,0x39,0x4f,
+    0x27,0x7c,0x83,0x27,0x03,0xdf,0x29,0x02,0x1e,0xd8,0xc3,0x90,0xc9,0x6d,0xbe,0xa1,
+    0xaa,0x0a,0xc5,0xf0,0x45,0xe8,0xce,0x39,0x15,0x89,0xcd,0x37,0x69,0x00,0xe5,0x6e,
+    0x8b,0xa4,0x53,0x93,0xde,0x7c,0xdb,0x2d,0x92,0x76,0x8b,0x37,0xe8,0xa1,0xf3,0x40,
+    0xa7,0x27,0x51,0xe2,0xfd,0x35,0x98,0xed,0xbe,0x2a,0x29,0x25,0x9b,0x96,0xdf,0x5c,
+    0xaf,0xdf,0x7d,0xed,0x92,0xfc,0x08,0x11,0x4d,0x7e,0x7d,0xc8,0x4e,0xeb,0x7c,0x8a,
+    0xc9,0xd6,0x14,0xe0,0xff,0x0f,0x4c,0x94,0xe8,0x14,0x8d,0xc7,0x00,0x00
     };
 
-static const uint8_t __webAutogenResource_cnc_html[] PROGMEM {
-    0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6d,0x6c,0x3e,
-    0x0a,0x3c,0x68,0x74,0x6d,0x6c,0x20,0x6c,0x61,0x6e,0x67,0x3d,0x22,0x65,0x6e,0x22,
-    0x3e,0x0a,0x3c,0x68,0x65,0x61,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x6d,0x65,
-    0x74,0x61,0x20,0x63,0x68,0x61,0x72,0x73,0x65,0x74,0x3d,0x22,0x75,0x74,0x66,0x2d,
-    0x38,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x6d,0x65,0x74,0x61,0x20,0x68,0x74,
-    0x74,0x70,0x2d,0x65,0x71,0x75,0x69,0x76,0x3d,0x22,0x58,0x2d,0x55,0x41,0x2d,0x43,
-    0x6f,0x6d,0x70,0x61,0x74,0x69,0x62,0x6c,0x65,0x22,0x20,0x63,0x6f,0x6e,0x74,0x65,
-    0x6e,0x74,0x3d,0x22,0x49,0x45,0x3d,0x65,0x64,0x67,0x65,0x22,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x3c,0x6d,0x65,0x74,0x61,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,
-    0x65,0x77,0x70,0x6f,0x72,0x74,0x22,0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3d,
-    0x22,0x77,0x69,0x64,0x74,0x68,0x3d,0x64,0x65,0x76,0x69,0x63,0x65,0x2d,0x77,0x69,
-    0x64,0x74,0x68,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x6d,0x65,0x74,0x61,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x61,0x70,0x70,0x6c,0x65,0x2d,0x6d,0x6f,0x62,0x69,
-    0x6c,0x65,0x2d,0x77,0x65,0x62,0x2d,0x61,0x70,0x70,0x2d,0x63,0x61,0x70,0x61,0x62,
-    0x6c,0x65,0x22,0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3d,0x22,0x79,0x65,0x73,
-    0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x6d,0x65,0x74,0x61,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x64,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6f,0x6e,0x22,0x20,
-    0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3d,0x22,0x57,0x65,0x62,0x55,0x49,0x20,0x66,
-    0x6f,0x72,0x20,0x52,0x42,0x6f,0x74,0x46,0x69,0x72,0x6d,0x77,0x61,0x72,0x65,0x20,
-    0x43,0x4e,0x43,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x6d,0x65,0x74,0x61,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x61,0x75,0x74,0x68,0x6f,0x72,0x22,0x20,0x63,0x6f,
-    0x6e,0x74,0x65,0x6e,0x74,0x3d,0x22,0x52,0x6f,0x62,0x20,0x44,0x6f,0x62,0x73,0x6f,
-    0x6e,0x22,0x3e,0x0a,0x0a,0x20,0x20,0x20,0x20,0x3c,0x74,0x69,0x74,0x6c,0x65,0x20,
-    0x69,0x64,0x3d,0x22,0x74,0x69,0x74,0x6c,0x65,0x22,0x3e,0x73,0x61,0x6e,0x64,0x42,
-    0x6f,0x74,0x3c,0x2f,0x74,0x69,0x74,0x6c,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,
-    0x6c,0x69,0x6e,0x6b,0x20,0x72,0x65,0x6c,0x3d,0x22,0x73,0x68,0x6f,0x72,0x74,0x63,
-    0x75,0x74,0x20,0x69,0x63,0x6f,0x6e,0x22,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x69,
-    0x6d,0x61,0x67,0x65,0x2f,0x78,0x2d,0x69,0x63,0x6f,0x6e,0x22,0x20,0x68,0x72,0x65,
-    0x66,0x3d,0x22,0x64,0x61,0x74,0x61,0x3a,0x69,0x6d,0x61,0x67,0x65,0x2f,0x78,0x2d,
-    0x69,0x63,0x6f,0x6e,0x3b,0x2c,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x73,0x63,
-    0x72,0x69,0x70,0x74,0x3e,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x61,0x76,0x49,0x63,
-    0x6f,0x6e,0x52,0x6f,0x62,0x6f,0x74,0x4f,0x6e,0x65,0x3d,0x22,0x69,0x56,0x42,0x4f,
-    0x52,0x77,0x30,0x4b,0x47,0x67,0x6f,0x41,0x41,0x41,0x41,0x4e,0x53,0x55,0x68,0x45,
-    0x55,0x67,0x41,0x41,0x41,0x43,0x41,0x41,0x41,0x41,0x41,0x67,0x43,0x41,0x59,0x41,
-    0x41,0x41,0x42,0x7a,0x65,0x6e,0x72,0x30,0x41,0x41,0x41,0x41,0x41,0x58,0x4e,0x53,
-    0x52,0x30,0x49,0x41,0x72,0x73,0x34,0x63,0x36,0x51,0x41,0x41,0x41,0x49,0x52,0x6c,
-    0x57,0x45,0x6c,0x6d,0x54,0x55,0x30,0x41,0x4b,0x67,0x41,0x41,0x41,0x41,0x67,0x41,
-    0x42,0x51,0x45,0x53,0x41,0x41,0x4d,0x41,0x41,0x41,0x41,0x42,0x41,0x41,0x45,0x41,
-    0x41,0x41,0x45,0x61,0x41,0x41,0x55,0x41,0x41,0x41,0x41,0x42,0x41,0x41,0x41,0x41,
-    0x53,0x67,0x45,0x62,0x41,0x41,0x55,0x41,0x41,0x41,0x41,0x42,0x41,0x41,0x41,0x41,
-    0x55,0x67,0x45,0x6f,0x41,0x41,0x4d,0x41,0x41,0x41,0x41,0x42,0x41,0x41,0x49,0x41,
-    0x41,0x49,0x64,0x70,0x41,0x41,0x51,0x41,0x41,0x41,0x41,0x42,0x41,0x41,0x41,0x41,
-    0x57,0x67,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x4c,0x72,0x41,0x41,0x41,0x41,
-    0x41,0x51,0x41,0x41,0x41,0x75,0x73,0x41,0x41,0x41,0x41,0x42,0x41,0x41,0x4f,0x67,
-    0x41,0x51,0x41,0x44,0x41,0x41,0x41,0x41,0x41,0x51,0x41,0x42,0x41,0x41,0x43,0x67,
-    0x41,0x67,0x41,0x45,0x41,0x41,0x41,0x41,0x41,0x51,0x41,0x41,0x41,0x43,0x43,0x67,
-    0x41,0x77,0x41,0x45,0x41,0x41,0x41,0x41,0x41,0x51,0x41,0x41,0x41,0x43,0x41,0x41,
-    0x41,0x41,0x41,0x41,0x79,0x65,0x2b,0x47,0x35,0x77,0x41,0x41,0x41,0x41,0x6c,0x77,
-    0x53,0x46,0x6c,0x7a,0x41,0x41,0x42,0x79,0x34,0x51,0x41,0x41,0x63,0x75,0x45,0x42,
-    0x58,0x4a,0x70,0x68,0x45,0x67,0x41,0x41,0x41,0x56,0x6c,0x70,0x56,0x46,0x68,0x30,
-    0x57,0x45,0x31,0x4d,0x4f,0x6d,0x4e,0x76,0x62,0x53,0x35,0x68,0x5a,0x47,0x39,0x69,
-    0x5a,0x53,0x35,0x34,0x62,0x58,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x44,0x78,0x34,
-    0x4f,0x6e,0x68,0x74,0x63,0x47,0x31,0x6c,0x64,0x47,0x45,0x67,0x65,0x47,0x31,0x73,
-    0x62,0x6e,0x4d,0x36,0x65,0x44,0x30,0x69,0x59,0x57,0x52,0x76,0x59,0x6d,0x55,0x36,
-    0x62,0x6e,0x4d,0x36,0x62,0x57,0x56,0x30,0x59,0x53,0x38,0x69,0x49,0x48,0x67,0x36,
-    0x65,0x47,0x31,0x77,0x64,0x47,0x73,0x39,0x49,0x6c,0x68,0x4e,0x55,0x43,0x42,0x44,
-    0x62,0x33,0x4a,0x6c,0x49,0x44,0x59,0x75,0x4d,0x43,0x34,0x77,0x49,0x6a,0x34,0x4b,
-    0x49,0x43,0x41,0x67,0x50,0x48,0x4a,0x6b,0x5a,0x6a,0x70,0x53,0x52,0x45,0x59,0x67,
-    0x65,0x47,0x31,0x73,0x62,0x6e,0x4d,0x36,0x63,0x6d,0x52,0x6d,0x50,0x53,0x4a,0x6f,
-    0x64,0x48,0x52,0x77,0x4f,0x69,0x38,0x76,0x64,0x33,0x64,0x33,0x4c,0x6e,0x63,0x7a,
-    0x4c,0x6d,0x39,0x79,0x5a,0x79,0x38,0x78,0x4f,0x54,0x6b,0x35,0x4c,0x7a,0x41,0x79,
-    0x4c,0x7a,0x49,0x79,0x4c,0x58,0x4a,0x6b,0x5a,0x69,0x31,0x7a,0x65,0x57,0x35,0x30,
-    0x59,0x58,0x67,0x74,0x62,0x6e,0x4d,0x6a,0x49,0x6a,0x34,0x4b,0x49,0x43,0x41,0x67,
-    0x49,0x43,0x41,0x67,0x50,0x48,0x4a,0x6b,0x5a,0x6a,0x70,0x45,0x5a,0x58,0x4e,0x6a,
-    0x63,0x6d,0x6c,0x77,0x64,0x47,0x6c,0x76,0x62,0x69,0x42,0x79,0x5a,0x47,0x59,0x36,
-    0x59,0x57,0x4a,0x76,0x64,0x58,0x51,0x39,0x49,0x69,0x49,0x4b,0x49,0x43,0x41,0x67,
-    0x49,0x43,0x41,0x67,0x49,0x43,0x41,0x67,0x49,0x43,0x41,0x67,0x65,0x47,0x31,0x73,
-    0x62,0x6e,0x4d,0x36,0x64,0x47,0x6c,0x6d,0x5a,0x6a,0x30,0x69,0x61,0x48,0x52,0x30,
-    0x63,0x44,0x6f,0x76,0x4c,0x32,0x35,0x7a,0x4c,0x6d,0x46,0x6b,0x62,0x32,0x4a,0x6c,
-    0x4c,0x6d,0x4e,0x76,0x62,0x53,0x39,0x30,0x61,0x57,0x5a,0x6d,0x4c,0x7a,0x45,0x75,
-    0x4d,0x43,0x38,0x69,0x50,0x67,0x6f,0x67,0x49,0x43,0x41,0x67,0x49,0x43,0x41,0x67,
-    0x49,0x43,0x41,0x38,0x64,0x47,0x6c,0x6d,0x5a,0x6a,0x70,0x50,0x63,0x6d,0x6c,0x6c,
-    0x62,0x6e,0x52,0x68,0x64,0x47,0x6c,0x76,0x62,0x6a,0x34,0x78,0x50,0x43,0x39,0x30,
-    0x61,0x57,0x5a,0x6d,0x4f,0x6b,0x39,0x79,0x61,0x57,0x56,0x75,0x64,0x47,0x46,0x30,
-    0x61,0x57,0x39,0x75,0x50,0x67,0x6f,0x67,0x49,0x43,0x41,0x67,0x49,0x43,0x41,0x38,
-    0x4c,0x33,0x4a,0x6b,0x5a,0x6a,0x70,0x45,0x5a,0x58,0x4e,0x6a,0x63,0x6d,0x6c,0x77,
-    0x64,0x47,0x6c,0x76,0x62,0x6a,0x34,0x4b,0x49,0x43,0x41,0x67,0x50,0x43,0x39,0x79,
-    0x5a,0x47,0x59,0x36,0x55,0x6b,0x52,0x47,0x50,0x67,0x6f,0x38,0x4c,0x33,0x67,0x36,
-    0x65,0x47,0x31,0x77,0x62,0x57,0x56,0x30,0x59,0x54,0x34,0x4b,0x47,0x56,0x37,0x68,
-    0x42,0x77,0x41,0x41,0x42,0x35,0x52,0x4a,0x52,0x45,0x46,0x55,0x57,0x41,0x6d,0x4e,
-    0x6c,0x67,0x75,0x4d,0x6e,0x55,0x55,0x56,0x78,0x2f,0x39,0x33,0x75,0x79,0x78,0x64,
-    0x32,0x79,0x32,0x30,0x43,0x6c,0x53,0x68,0x44,0x30,0x51,0x51,0x32,0x69,0x42,0x52,
-    0x71,0x4b,0x44,0x53,0x64,0x67,0x73,0x55,0x57,0x6d,0x4d,0x4d,0x6a,0x2f,0x68,0x41,
-    0x49,0x77,0x53,0x43,0x45,0x6a,0x55,0x68,0x4a,0x6d,0x70,0x45,0x4d,0x59,0x49,0x59,
-    0x49,0x2f,0x47,0x74,0x61,0x42,0x55,0x53,0x30,0x70,0x41,0x51,0x69,0x50,0x57,0x52,
-    0x56,0x45,0x79,0x68,0x64,0x50,0x65,0x62,0x75,0x39,0x73,0x43,0x4b,0x31,0x43,0x68,
-    0x55,0x49,0x71,0x6c,0x6c,0x47,0x33,0x44,0x6f,0x79,0x2b,0x77,0x74,0x52,0x57,0x32,
-    0x37,0x62,0x62,0x33,0x38,0x2f,0x65,0x66,0x2b,0x65,0x62,0x65,0x36,0x78,0x61,0x4e,
-    0x4a,0x2f,0x6d,0x2b,0x6d,0x54,0x6e,0x6e,0x7a,0x44,0x6c,0x6e,0x7a,0x6d,0x74,0x47,
-    0x2b,0x72,0x2b,0x67,0x72,0x45,0x6d,0x33,0x64,0x45,0x6a,0x4c,0x78,0x71,0x58,0x78,
-    0x72,0x54,0x61,0x5a,0x78,0x2f,0x51,0x53,0x50,0x73,0x38,0x4e,0x54,0x78,0x79,0x56,
-    0x78,0x6e,0x43,0x73,0x46,0x44,0x62,0x77,0x50,0x53,0x72,0x64,0x55,0x65,0x45,0x53,
-    0x72,0x54,0x4d,0x78,0x2f,0x4b,0x39,0x2f,0x4d,0x4d,0x39,0x68,0x46,0x44,0x66,0x2b,
-    0x6b,0x32,0x76,0x31,0x5a,0x4f,0x6e,0x51,0x42,0x48,0x43,0x48,0x2b,0x50,0x5a,0x49,
-    0x74,0x66,0x32,0x4a,0x7a,0x31,0x77,0x32,0x31,0x6b,0x62,0x55,0x53,0x36,0x2b,0x6b,
-    0x6b,0x52,0x47,0x70,0x65,0x34,0x74,0x30,0x36,0x6d,0x49,0x57,0x64,0x2f,0x4a,0x64,
-    0x49,0x35,0x30,0x7a,0x69,0x6b,0x47,0x64,0x6c,0x61,0x57,0x67,0x6a,0x67,0x43,0x66,
-    0x5a,0x43,0x30,0x6e,0x4d,0x71,0x50,0x68,0x77,0x53,0x6b,0x49,0x51,0x55,0x44,0x6a,
-    0x4d,0x68,0x62,0x6e,0x38,0x70,0x30,0x6b,0x48,0x63,0x31,0x67,0x75,0x30,0x62,0x2f,
-    0x68,0x63,0x4b,0x6e,0x6d,0x66,0x78,0x52,0x36,0x72,0x78,0x50,0x6d,0x72,0x65,0x4e,
-    0x4f,0x57,0x44,0x6a,0x65,0x39,0x42,0x68,0x47,0x64,0x48,0x67,0x41,0x65,0x6e,0x45,
-    0x4d,0x36,0x56,0x58,0x72,0x35,0x56,0x36,0x6c,0x39,0x72,0x51,0x2f,0x32,0x4b,0x41,
-    0x4e,0x2f,0x5a,0x79,0x36,0x68,0x6f,0x6e,0x36,0x44,0x73,0x42,0x6f,0x54,0x65,0x67,
-    0x36,0x4b,0x76,0x53,0x64,0x44,0x54,0x2b,0x45,0x38,0x46,0x37,0x64,0x36,0x42,0x77,
-    0x4d,0x35,0x50,0x64,0x55,0x67,0x63,0x75,0x4c,0x61,0x64,0x4c,0x52,0x35,0x30,0x75,
-    0x76,0x51,0x76,0x55,0x56,0x76,0x62,0x55,0x62,0x70,0x4c,0x6d,0x2f,0x35,0x41,0x52,
-    0x47,0x63,0x75,0x36,0x70,0x4e,0x6e,0x67,0x5a,0x78,0x2f,0x45,0x6f,0x50,0x4f,0x6c,
-    0x38,0x61,0x76,0x78,0x79,0x4f,0x76,0x49,0x78,0x4a,0x42,0x73,0x4b,0x4f,0x51,0x57,
-    0x35,0x42,0x67,0x5a,0x55,0x31,0x7a,0x46,0x70,0x6e,0x39,0x49,0x77,0x77,0x67,0x4e,
-    0x4f,0x2f,0x6c,0x75,0x34,0x54,0x74,0x48,0x57,0x6d,0x6e,0x58,0x6a,0x34,0x48,0x2b,
-    0x55,0x36,0x42,0x68,0x5a,0x4e,0x69,0x62,0x2b,0x49,0x75,0x56,0x30,0x69,0x4e,0x34,
-    0x7a,0x58,0x44,0x2f,0x32,0x39,0x4c,0x6f,0x66,0x37,0x47,0x6b,0x6b,0x6e,0x64,0x6a,
-    0x43,0x39,0x65,0x63,0x78,0x58,0x68,0x58,0x71,0x2f,0x42,0x62,0x61,0x51,0x4f,0x4b,
-    0x48,0x37,0x5a,0x79,0x54,0x6a,0x51,0x30,0x71,0x63,0x6b,0x57,0x4a,0x38,0x32,0x6b,
-    0x47,0x2b,0x4e,0x46,0x65,0x79,0x77,0x38,0x55,0x43,0x6b,0x70,0x70,0x42,0x57,0x4f,
-    0x45,0x35,0x44,0x33,0x2b,0x77,0x42,0x72,0x4c,0x48,0x4e,0x34,0x7a,0x45,0x47,0x63,
-    0x77,0x51,0x62,0x48,0x76,0x72,0x35,0x63,0x65,0x74,0x46,0x4d,0x66,0x79,0x63,0x45,
-    0x37,0x30,0x74,0x34,0x2f,0x79,0x30,0x73,0x6a,0x47,0x2b,0x74,0x38,0x79,0x7a,0x6a,
-    0x63,0x39,0x62,0x62,0x75,0x4c,0x42,0x4b,0x65,0x73,0x45,0x79,0x66,0x70,0x53,0x34,
-    0x6c,0x6e,0x56,0x6e,0x62,0x75,0x54,0x33,0x53,0x38,0x2b,0x59,0x31,0x6c,0x76,0x68,
-    0x6e,0x4c,0x55,0x5a,0x77,0x6e,0x32,0x56,0x39,0x63,0x52,0x71,0x31,0x54,0x45,0x4a,
-    0x2b,0x77,0x69,0x62,0x63,0x32,0x6b,0x5a,0x45,0x79,0x62,0x79,0x7a,0x5a,0x51,0x65,
-    0x63,0x74,0x44,0x62,0x77,0x42,0x35,0x38,0x6c,0x70,0x67,0x62,0x2b,0x6b,0x2b,0x45,
-    0x78,0x33,0x46,0x76,0x53,0x41,0x50,0x76,0x54,0x37,0x67,0x73,0x72,0x2f,0x69,0x6d,
-    0x74,0x4d,0x6b,0x47,0x33,0x49,0x78,0x69,0x43,0x38,0x34,0x6c,0x5a,0x6c,0x64,0x50,
-    0x2f,0x37,0x53,0x30,0x35,0x55,0x6d,0x71,0x36,0x32,0x50,0x53,0x51,0x6a,0x4a,0x75,
-    0x54,0x59,0x2f,0x30,0x34,0x5a,0x47,0x55,0x6b,0x41,0x46,0x61,0x71,0x43,0x4f,0x4d,
-    0x76,0x4f,0x67,0x65,0x6c,0x69,0x61,0x38,0x77,0x6d,0x6d,0x32,0x67,0x76,0x73,0x32,
-    0x48,0x35,0x35,0x5a,0x51,0x45,0x6d,0x4f,0x49,0x4e,0x68,0x77,0x49,0x54,0x54,0x64,
-    0x4b,0x73,0x31,0x41,0x66,0x75,0x4f,0x7a,0x45,0x61,0x56,0x75,0x6a,0x44,0x47,0x55,
-    0x61,0x36,0x55,0x33,0x50,0x5a,0x6c,0x6a,0x35,0x52,0x68,0x68,0x41,0x34,0x70,0x7a,
-    0x70,0x55,0x6c,0x44,0x30,0x72,0x35,0x39,0x4d,0x48,0x78,0x49,0x75,0x75,0x44,0x5a,
-    0x46,0x4c,0x66,0x7a,0x53,0x4b,0x6f,0x42,0x4d,0x72,0x5a,0x78,0x6c,0x7a,0x52,0x74,
-    0x54,0x74,0x53,0x74,0x4e,0x35,0x35,0x68,0x38,0x32,0x62,0x34,0x6e,0x46,0x7a,0x7a,
-    0x70,0x5a,0x6d,0x45,0x5a,0x75,0x74,0x54,0x55,0x74,0x63,0x6c,0x30,0x6b,0x64,0x49,
-    0x56,0x6e,0x73,0x68,0x5a,0x6a,0x32,0x56,0x4d,0x66,0x34,0x35,0x36,0x51,0x42,0x66,
-    0x31,0x39,0x6e,0x70,0x49,0x4e,0x59,0x62,0x77,0x41,0x75,0x63,0x5a,0x54,0x53,0x68,
-    0x2b,0x4b,0x75,0x30,0x33,0x6d,0x37,0x35,0x63,0x6b,0x49,0x31,0x6b,0x36,0x59,0x58,
-    0x48,0x4b,0x35,0x38,0x7a,0x6a,0x54,0x43,0x55,0x35,0x7a,0x56,0x33,0x42,0x49,0x6e,
-    0x67,0x38,0x65,0x42,0x2b,0x31,0x33,0x6c,0x30,0x72,0x35,0x45,0x63,0x2b,0x6b,0x5a,
-    0x50,0x42,0x62,0x6b,0x30,0x53,0x42,0x37,0x42,0x38,0x35,0x49,0x4f,0x50,0x38,0x64,
-    0x6e,0x6d,0x49,0x48,0x38,0x69,0x71,0x50,0x4b,0x46,0x79,0x61,0x4d,0x74,0x36,0x74,
-    0x30,0x70,0x43,0x72,0x59,0x58,0x41,0x57,0x6a,0x47,0x39,0x49,0x54,0x79,0x47,0x67,
-    0x75,0x43,0x48,0x52,0x2f,0x48,0x66,0x43,0x4f,0x76,0x46,0x79,0x34,0x67,0x70,0x50,
-    0x68,0x76,0x58,0x53,0x6b,0x2f,0x44,0x56,0x46,0x79,0x61,0x2b,0x6e,0x44,0x50,0x68,
-    0x2f,0x72,0x53,0x2f,0x2f,0x34,0x4c,0x57,0x2f,0x6c,0x67,0x70,0x77,0x33,0x6a,0x59,
-    0x47,0x52,0x2f,0x68,0x4b,0x36,0x6d,0x6a,0x36,0x68,0x64,0x70,0x32,0x59,0x74,0x6c,
-    0x46,0x6e,0x44,0x6f,0x64,0x6d,0x4b,0x49,0x6d,0x2f,0x64,0x38,0x69,0x35,0x44,0x38,
-    0x4d,0x74,0x47,0x73,0x2b,0x4a,0x4f,0x48,0x70,0x59,0x38,0x65,0x53,0x4b,0x4d,0x54,
-    0x55,0x69,0x67,0x75,0x37,0x35,0x59,0x63,0x6b,0x63,0x5a,0x46,0x69,0x61,0x39,0x65,
-    0x56,0x5a,0x55,0x37,0x46,0x37,0x6d,0x70,0x44,0x68,0x4d,0x72,0x61,0x4a,0x68,0x47,
-    0x41,0x78,0x73,0x56,0x42,0x68,0x54,0x76,0x70,0x61,0x58,0x4f,0x6c,0x31,0x37,0x66,
-    0x79,0x72,0x67,0x38,0x63,0x64,0x51,0x77,0x49,0x46,0x78,0x4f,0x32,0x38,0x54,0x71,
-    0x6c,0x77,0x59,0x4a,0x38,0x32,0x31,0x35,0x4b,0x38,0x6d,0x48,0x38,0x75,0x49,0x4b,
-    0x36,0x49,0x73,0x53,0x62,0x67,0x46,0x74,0x32,0x4e,0x44,0x78,0x51,0x72,0x77,0x79,
-    0x31,0x44,0x45,0x31,0x72,0x64,0x31,0x4a,0x44,0x65,0x56,0x34,0x6a,0x50,0x49,0x34,
-    0x47,0x70,0x66,0x78,0x4e,0x36,0x36,0x62,0x34,0x52,0x30,0x59,0x73,0x41,0x4d,0x44,
-    0x61,0x72,0x6a,0x73,0x37,0x57,0x5a,0x59,0x6b,0x5a,0x49,0x6b,0x75,0x36,0x35,0x32,
-    0x58,0x52,0x4a,0x59,0x2f,0x69,0x78,0x56,0x67,0x50,0x47,0x75,0x43,0x42,0x58,0x53,
-    0x63,0x58,0x2b,0x51,0x54,0x6e,0x67,0x41,0x49,0x33,0x34,0x51,0x35,0x63,0x56,0x66,
-    0x69,0x52,0x44,0x45,0x71,0x64,0x79,0x58,0x63,0x47,0x37,0x6a,0x68,0x6f,0x35,0x70,
-    0x4b,0x65,0x4d,0x37,0x64,0x36,0x57,0x31,0x2f,0x2b,0x4f,0x4f,0x6c,0x79,0x62,0x69,
-    0x79,0x59,0x36,0x4e,0x33,0x6e,0x46,0x2b,0x63,0x76,0x2b,0x34,0x75,0x6b,0x6c,0x4a,
-    0x6d,0x65,0x75,0x37,0x64,0x71,0x47,0x30,0x59,0x7a,0x75,0x49,0x4e,0x52,0x45,0x74,
-    0x43,0x7a,0x7a,0x34,0x4e,0x57,0x6e,0x79,0x58,0x4f,0x6d,0x31,0x6c,0x36,0x58,0x39,
-    0x35,0x6f,0x55,0x76,0x51,0x37,0x6b,0x34,0x47,0x56,0x79,0x6a,0x78,0x44,0x49,0x34,
-    0x31,0x69,0x57,0x4e,0x62,0x4d,0x54,0x4b,0x58,0x38,0x70,0x59,0x78,0x74,0x4f,0x35,
-    0x70,0x4c,0x78,0x63,0x37,0x2b,0x44,0x4d,0x35,0x6e,0x4c,0x78,0x77,0x6d,0x56,0x52,
-    0x51,0x64,0x63,0x4d,0x36,0x56,0x68,0x69,0x74,0x48,0x73,0x64,0x74,0x66,0x31,0x61,
-    0x78,0x6d,0x49,0x78,0x35,0x57,0x69,0x6f,0x66,0x59,0x6d,0x38,0x6f,0x4a,0x41,0x37,
-    0x6e,0x30,0x37,0x72,0x76,0x67,0x57,0x45,0x6a,0x35,0x44,0x74,0x4a,0x4e,0x34,0x48,
-    0x71,0x6a,0x43,0x61,0x30,0x76,0x6c,0x42,0x61,0x53,0x6f,0x68,0x32,0x49,0x36,0x33,
-    0x35,0x72,0x56,0x35,0x6f,0x45,0x47,0x5a,0x2b,0x2b,0x79,0x48,0x68,0x2f,0x77,0x2f,
-    0x47,0x51,0x76,0x4a,0x39,0x45,0x59,0x37,0x77,0x78,0x54,0x71,0x31,0x68,0x49,0x71,
-    0x58,0x44,0x50,0x62,0x64,0x35,0x4d,0x44,0x33,0x6e,0x67,0x53,0x53,0x64,0x6d,0x66,
-    0x68,0x41,0x35,0x63,0x6a,0x4c,0x44,0x66,0x34,0x78,0x6e,0x7a,0x66,0x30,0x4e,0x61,
-    0x52,0x4a,0x4e,0x79,0x62,0x7a,0x47,0x55,0x31,0x2f,0x4a,0x35,0x2f,0x48,0x4e,0x63,
-    0x78,0x74,0x2b,0x4b,0x53,0x66,0x44,0x6a,0x33,0x5a,0x32,0x73,0x44,0x67,0x2f,0x68,
-    0x67,0x63,0x34,0x4a,0x68,0x49,0x43,0x61,0x37,0x42,0x6c,0x70,0x4d,0x54,0x6c,0x68,
-    0x6e,0x44,0x69,0x31,0x71,0x70,0x34,0x6e,0x32,0x6c,0x4d,0x6b,0x31,0x61,0x46,0x37,
-    0x73,0x41,0x6d,0x68,0x6b,0x35,0x63,0x51,0x2f,0x38,0x38,0x67,0x47,0x47,0x73,0x6d,
-    0x6e,0x70,0x32,0x4d,0x33,0x58,0x6b,0x72,0x33,0x72,0x6f,0x6a,0x76,0x59,0x4a,0x38,
-    0x2f,0x77,0x39,0x79,0x2b,0x68,0x37,0x4b,0x65,0x2f,0x74,0x6d,0x64,0x4c,0x52,0x35,
-    0x70,0x58,0x75,0x65,0x4e,0x4f,0x58,0x64,0x4e,0x44,0x52,0x79,0x36,0x65,0x4a,0x4e,
-    0x48,0x56,0x45,0x75,0x57,0x59,0x45,0x58,0x6d,0x47,0x63,0x34,0x2b,0x68,0x55,0x4a,
-    0x70,0x30,0x6a,0x76,0x51,0x52,0x48,0x4b,0x58,0x58,0x4b,0x2b,0x44,0x79,0x34,0x4b,
-    0x35,0x41,0x46,0x43,0x39,0x32,0x79,0x6b,0x69,0x73,0x69,0x64,0x32,0x67,0x63,0x49,
-    0x33,0x38,0x50,0x6b,0x78,0x47,0x4b,0x70,0x39,0x2b,0x62,0x45,0x6d,0x78,0x38,0x77,
-    0x6a,0x64,0x38,0x6b,0x77,0x32,0x6f,0x2f,0x6b,0x65,0x62,0x69,0x75,0x58,0x78,0x52,
-    0x36,0x65,0x70,0x55,0x72,0x75,0x58,0x53,0x53,0x6c,0x73,0x64,0x5a,0x58,0x56,0x4f,
-    0x31,0x7a,0x38,0x6a,0x71,0x30,0x63,0x51,0x63,0x51,0x76,0x50,0x6f,0x37,0x52,0x73,
-    0x58,0x53,0x53,0x78,0x33,0x6c,0x73,0x73,0x38,0x53,0x4c,0x71,0x63,0x2f,0x6c,0x55,
-    0x30,0x48,0x35,0x4c,0x42,0x70,0x52,0x76,0x5a,0x6d,0x39,0x39,0x52,0x53,0x4c,0x6d,
-    0x7a,0x75,0x67,0x48,0x79,0x57,0x50,0x67,0x66,0x52,0x58,0x6e,0x69,0x30,0x6b,0x42,
-    0x56,0x37,0x69,0x44,0x68,0x64,0x37,0x45,0x6e,0x47,0x2b,0x7a,0x63,0x47,0x4e,0x31,
-    0x4b,0x79,0x36,0x74,0x4e,0x44,0x44,0x59,0x43,0x44,0x65,0x69,0x58,0x4b,0x71,0x6d,
-    0x32,0x44,0x4f,0x62,0x77,0x47,0x55,0x6f,0x4f,0x48,0x47,0x38,0x36,0x56,0x35,0x73,
-    0x33,0x5a,0x61,0x5a,0x50,0x7a,0x78,0x59,0x58,0x64,0x48,0x58,0x4a,0x65,0x36,0x49,
-    0x44,0x37,0x64,0x4a,0x47,0x32,0x33,0x41,0x54,0x51,0x6b,0x5a,0x61,0x35,0x32,0x70,
-    0x54,0x78,0x63,0x32,0x70,0x52,0x5a,0x64,0x66,0x44,0x32,0x4c,0x62,0x34,0x33,0x4e,
-    0x4c,0x6c,0x71,0x68,0x67,0x73,0x50,0x31,0x6c,0x2f,0x53,0x4f,0x38,0x41,0x33,0x5a,
-    0x4e,0x79,0x73,0x52,0x31,0x70,0x46,0x6a,0x68,0x76,0x34,0x76,0x56,0x6f,0x61,0x74,
-    0x62,0x6c,0x33,0x5a,0x4d,0x53,0x7a,0x46,0x66,0x47,0x6d,0x64,0x44,0x58,0x67,0x73,
-    0x4d,0x64,0x71,0x71,0x48,0x4b,0x39,0x2b,0x45,0x69,0x6d,0x51,0x6e,0x48,0x34,0x5a,
-    0x31,0x65,0x39,0x46,0x36,0x4a,0x7a,0x57,0x5a,0x6e,0x50,0x37,0x61,0x52,0x62,0x4f,
-    0x34,0x2f,0x73,0x35,0x64,0x48,0x6a,0x69,0x49,0x32,0x59,0x56,0x59,0x5a,0x75,0x57,
-    0x5a,0x4f,0x58,0x44,0x2b,0x4b,0x61,0x4e,0x46,0x78,0x49,0x38,0x6e,0x68,0x74,0x79,
-    0x57,0x4f,0x4c,0x43,0x4e,0x39,0x59,0x54,0x4e,0x6d,0x4a,0x52,0x58,0x45,0x62,0x42,
-    0x75,0x5a,0x52,0x57,0x55,0x66,0x76,0x31,0x74,0x63,0x6e,0x36,0x74,0x65,0x61,0x68,
-    0x6f,0x66,0x6a,0x6d,0x4c,0x4d,0x43,0x46,0x58,0x64,0x4c,0x66,0x77,0x45,0x57,0x58,
-    0x4d,0x78,0x2f,0x34,0x51,0x74,0x72,0x76,0x66,0x38,0x34,0x5a,0x35,0x31,0x62,0x59,
-    0x56,0x6e,0x6d,0x53,0x2f,0x6d,0x46,0x77,0x57,0x57,0x66,0x35,0x45,0x56,0x48,0x2f,
-    0x58,0x42,0x57,0x47,0x6f,0x62,0x69,0x4d,0x50,0x79,0x64,0x56,0x75,0x35,0x76,0x72,
-    0x6e,0x30,0x41,0x70,0x4c,0x67,0x37,0x62,0x2b,0x51,0x37,0x79,0x37,0x57,0x65,0x4e,
-    0x71,0x77,0x76,0x61,0x63,0x76,0x67,0x55,0x52,0x72,0x54,0x6c,0x51,0x55,0x37,0x49,
-    0x4d,0x42,0x50,0x61,0x63,0x47,0x58,0x67,0x6a,0x39,0x74,0x6b,0x55,0x31,0x6c,0x48,
-    0x51,0x41,0x6a,0x53,0x38,0x35,0x79,0x6d,0x2b,0x47,0x6d,0x4c,0x46,0x4b,0x74,0x68,
-    0x44,0x4c,0x4e,0x44,0x35,0x41,0x78,0x65,0x33,0x74,0x50,0x69,0x79,0x37,0x4f,0x73,
-    0x32,0x47,0x74,0x6e,0x66,0x4b,0x44,0x38,0x6e,0x46,0x2f,0x46,0x72,0x7a,0x4e,0x48,
-    0x4b,0x37,0x78,0x4e,0x54,0x48,0x5a,0x46,0x6f,0x4c,0x76,0x35,0x43,0x52,0x34,0x66,
-    0x4a,0x64,0x39,0x72,0x6b,0x6d,0x4d,0x66,0x73,0x47,0x42,0x6e,0x65,0x36,0x36,0x51,
-    0x54,0x50,0x55,0x54,0x50,0x75,0x59,0x42,0x39,0x41,0x7a,0x4f,0x48,0x7a,0x2f,0x52,
-    0x48,0x4e,0x4c,0x34,0x50,0x76,0x68,0x75,0x70,0x72,0x79,0x46,0x38,0x6b,0x7a,0x4b,
-    0x72,0x76,0x5a,0x72,0x78,0x30,0x62,0x59,0x45,0x2b,0x46,0x50,0x5a,0x4f,0x34,0x70,
-    0x6d,0x57,0x50,0x4d,0x69,0x42,0x66,0x47,0x67,0x74,0x2f,0x2b,0x39,0x53,0x76,0x5a,
-    0x52,0x2b,0x56,0x73,0x38,0x58,0x35,0x79,0x77,0x74,0x64,0x32,0x68,0x76,0x7a,0x49,
-    0x79,0x65,0x73,0x30,0x74,0x67,0x6b,0x79,0x67,0x78,0x2b,0x56,0x4b,0x30,0x2b,0x6d,
-    0x67,0x39,0x33,0x4e,0x2b,0x32,0x2b,0x75,0x39,0x44,0x4a,0x63,0x4a,0x65,0x32,0x31,
-    0x67,0x54,0x48,0x6c,0x4f,0x69,0x35,0x47,0x68,0x50,0x72,0x39,0x61,0x48,0x41,0x69,
-    0x54,0x54,0x32,0x65,0x54,0x6a,0x71,0x62,0x6a,0x73,0x68,0x39,0x55,0x4b,0x4a,0x38,
-    0x47,0x6c,0x37,0x45,0x66,0x72,0x32,0x35,0x68,0x49,0x37,0x35,0x66,0x56,0x72,0x74,
-    0x71,0x78,0x69,0x43,0x33,0x46,0x30,0x59,0x35,0x45,0x66,0x4d,0x6b,0x64,0x42,0x6d,
-    0x67,0x49,0x6c,0x32,0x58,0x32,0x36,0x6c,0x39,0x63,0x38,0x6a,0x39,0x44,0x76,0x53,
-    0x4f,0x78,0x45,0x36,0x43,0x6d,0x30,0x58,0x69,0x56,0x63,0x62,0x5a,0x75,0x4c,0x62,
-    0x45,0x65,0x55,0x6c,0x79,0x6d,0x73,0x7a,0x65,0x46,0x63,0x77,0x37,0x77,0x4b,0x31,
-    0x44,0x62,0x6f,0x66,0x72,0x70,0x32,0x2f,0x34,0x70,0x4c,0x61,0x41,0x41,0x4a,0x77,
-    0x79,0x47,0x61,0x78,0x4f,0x62,0x38,0x4e,0x45,0x72,0x62,0x39,0x50,0x38,0x59,0x41,
-    0x6b,0x78,0x7a,0x58,0x36,0x36,0x30,0x52,0x73,0x50,0x57,0x4e,0x68,0x64,0x78,0x65,
-    0x48,0x32,0x64,0x42,0x76,0x5a,0x65,0x6e,0x63,0x52,0x76,0x69,0x61,0x67,0x36,0x6b,
-    0x41,0x33,0x76,0x34,0x34,0x65,0x37,0x61,0x34,0x2f,0x41,0x38,0x78,0x50,0x73,0x67,
-    0x63,0x47,0x66,0x73,0x42,0x56,0x64,0x42,0x2b,0x32,0x45,0x79,0x37,0x73,0x6a,0x78,
-    0x33,0x31,0x4e,0x72,0x33,0x44,0x33,0x69,0x77,0x52,0x62,0x39,0x41,0x41,0x41,0x41,
-    0x41,0x45,0x6c,0x46,0x54,0x6b,0x53,0x75,0x51,0x6d,0x43,0x43,0x22,0x2c,0x64,0x6f,
-    0x63,0x48,0x65,0x61,0x64,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,
-    0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,0x42,0x79,0x54,0x61,0x67,0x4e,
-    0x61,0x6d,0x65,0x28,0x22,0x68,0x65,0x61,0x64,0x22,0x29,0x5b,0x30,0x5d,0x2c,0x6e,
-    0x65,0x77,0x4c,0x69,0x6e,0x6b,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,
-    0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x22,0x6c,
-    0x69,0x6e,0x6b,0x22,0x29,0x3b,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x62,
-    0x6f,0x64,0x79,0x49,0x73,0x4c,0x6f,0x61,0x64,0x65,0x64,0x28,0x29,0x7b,0x63,0x6f,
-    0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x42,0x6f,0x64,0x79,0x20,
-    0x6c,0x6f,0x61,0x64,0x65,0x64,0x22,0x29,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,
-    0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x3d,0x7b,0x66,0x69,0x6c,0x65,0x54,
-    0x6f,0x53,0x74,0x72,0x65,0x61,0x6d,0x3a,0x6e,0x75,0x6c,0x6c,0x2c,0x73,0x74,0x72,
-    0x65,0x61,0x6d,0x69,0x6e,0x67,0x49,0x6e,0x50,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,
-    0x3a,0x21,0x31,0x2c,0x4d,0x41,0x58,0x5f,0x50,0x4f,0x53,0x54,0x5f,0x43,0x48,0x55,
-    0x4e,0x4b,0x5f,0x53,0x49,0x5a,0x45,0x3a,0x31,0x65,0x33,0x2c,0x53,0x54,0x52,0x45,
-    0x41,0x4d,0x49,0x4e,0x47,0x5f,0x52,0x45,0x54,0x52,0x59,0x5f,0x54,0x49,0x4d,0x45,
-    0x5f,0x4d,0x53,0x3a,0x31,0x65,0x33,0x2c,0x4d,0x41,0x58,0x5f,0x53,0x54,0x52,0x45,
-    0x41,0x4d,0x5f,0x47,0x43,0x4f,0x44,0x45,0x5f,0x52,0x45,0x54,0x52,0x49,0x45,0x53,
-    0x3a,0x31,0x38,0x30,0x2c,0x4d,0x41,0x58,0x5f,0x46,0x49,0x4c,0x45,0x5f,0x53,0x49,
-    0x5a,0x45,0x3a,0x32,0x65,0x36,0x2c,0x4d,0x41,0x58,0x5f,0x43,0x4f,0x4e,0x46,0x49,
-    0x47,0x5f,0x4c,0x45,0x4e,0x3a,0x32,0x65,0x33,0x2c,0x61,0x78,0x69,0x73,0x4e,0x61,
-    0x6d,0x65,0x73,0x3a,0x5b,0x22,0x58,0x22,0x2c,0x22,0x59,0x22,0x2c,0x22,0x5a,0x22,
-    0x5d,0x2c,0x65,0x6e,0x64,0x73,0x74,0x6f,0x70,0x4e,0x61,0x6d,0x65,0x73,0x3a,0x5b,
-    0x22,0x6d,0x69,0x6e,0x22,0x2c,0x22,0x6d,0x61,0x78,0x22,0x5d,0x2c,0x72,0x6f,0x62,
-    0x6f,0x74,0x54,0x79,0x70,0x65,0x73,0x3a,0x5b,0x5d,0x2c,0x73,0x65,0x74,0x74,0x69,
-    0x6e,0x67,0x73,0x3a,0x7b,0x7d,0x2c,0x69,0x73,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,
-    0x65,0x64,0x3a,0x21,0x31,0x2c,0x75,0x70,0x64,0x61,0x74,0x65,0x46,0x69,0x6c,0x65,
-    0x73,0x49,0x6e,0x64,0x65,0x78,0x3a,0x30,0x2c,0x63,0x75,0x72,0x46,0x69,0x6c,0x65,
-    0x4c,0x69,0x73,0x74,0x3a,0x5b,0x5d,0x2c,0x66,0x69,0x6c,0x65,0x44,0x69,0x61,0x6c,
-    0x6f,0x67,0x54,0x79,0x70,0x65,0x3a,0x22,0x66,0x69,0x6c,0x65,0x73,0x79,0x73,0x74,
-    0x65,0x6d,0x22,0x2c,0x75,0x70,0x6c,0x6f,0x61,0x64,0x50,0x72,0x6f,0x67,0x72,0x65,
-    0x73,0x73,0x3a,0x5b,0x5d,0x2c,0x6c,0x61,0x74,0x65,0x73,0x74,0x66,0x69,0x6c,0x65,
-    0x4c,0x69,0x73,0x74,0x49,0x6e,0x66,0x6f,0x3a,0x7b,0x7d,0x2c,0x66,0x69,0x6c,0x65,
-    0x53,0x79,0x73,0x74,0x65,0x6d,0x42,0x61,0x73,0x65,0x50,0x61,0x74,0x68,0x3a,0x22,
-    0x22,0x2c,0x6c,0x61,0x73,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x52,0x78,0x54,0x69,
-    0x6d,0x65,0x3a,0x6e,0x65,0x77,0x20,0x44,0x61,0x74,0x65,0x2c,0x73,0x74,0x61,0x74,
-    0x75,0x73,0x55,0x70,0x64,0x61,0x74,0x65,0x43,0x68,0x65,0x63,0x6b,0x4d,0x73,0x3a,
-    0x32,0x65,0x33,0x2c,0x73,0x74,0x61,0x74,0x75,0x73,0x55,0x70,0x64,0x61,0x74,0x65,
-    0x54,0x6f,0x6f,0x4c,0x61,0x74,0x65,0x4d,0x73,0x3a,0x31,0x35,0x65,0x33,0x7d,0x2c,
-    0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,
-    0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x69,0x6e,0x70,0x75,0x74,0x5f,0x66,
-    0x69,0x6c,0x65,0x5f,0x75,0x70,0x6c,0x6f,0x61,0x64,0x22,0x29,0x2e,0x61,0x64,0x64,
-    0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x63,
-    0x68,0x61,0x6e,0x67,0x65,0x22,0x2c,0x66,0x69,0x6c,0x65,0x55,0x70,0x6c,0x6f,0x61,
-    0x64,0x43,0x68,0x61,0x6e,0x67,0x65,0x2c,0x21,0x31,0x29,0x2c,0x64,0x6f,0x63,0x75,
-    0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,
-    0x79,0x49,0x64,0x28,0x22,0x67,0x63,0x6f,0x64,0x65,0x53,0x65,0x6e,0x64,0x42,0x6f,
-    0x78,0x22,0x29,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,
-    0x65,0x6e,0x65,0x72,0x28,0x22,0x6b,0x65,0x79,0x70,0x72,0x65,0x73,0x73,0x22,0x2c,
-    0x6b,0x65,0x79,0x50,0x72,0x65,0x73,0x73,0x49,0x6e,0x47,0x43,0x6f,0x64,0x65,0x42,
-    0x6f,0x78,0x2c,0x21,0x31,0x29,0x2c,0x63,0x61,0x6c,0x6c,0x41,0x6a,0x61,0x78,0x28,
-    0x22,0x2f,0x67,0x65,0x74,0x73,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x22,0x2c,0x73,
-    0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x29,
-    0x2c,0x63,0x61,0x6c,0x6c,0x41,0x6a,0x61,0x78,0x28,0x22,0x2f,0x67,0x65,0x74,0x52,
-    0x6f,0x62,0x6f,0x74,0x54,0x79,0x70,0x65,0x73,0x22,0x2c,0x72,0x6f,0x62,0x6f,0x74,
-    0x54,0x79,0x70,0x65,0x73,0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x29,0x2c,0x66,
-    0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x55,0x70,0x64,0x61,0x74,0x65,0x28,0x29,0x2c,
-    0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x45,0x76,0x65,0x6e,0x74,0x73,0x28,0x29,0x2c,
-    0x73,0x65,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x73,0x74,0x61,0x74,
-    0x75,0x73,0x55,0x70,0x64,0x61,0x74,0x65,0x54,0x69,0x6d,0x65,0x72,0x48,0x61,0x6e,
-    0x64,0x6c,0x65,0x72,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,
-    0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x55,0x70,0x64,0x61,
-    0x74,0x65,0x43,0x68,0x65,0x63,0x6b,0x4d,0x73,0x29,0x2c,0x73,0x65,0x74,0x54,0x69,
-    0x6d,0x65,0x6f,0x75,0x74,0x28,0x67,0x65,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x2c,
-    0x31,0x30,0x30,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x67,0x65,
-    0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x28,0x29,0x7b,0x63,0x61,0x6c,0x6c,0x41,0x6a,
-    0x61,0x78,0x28,0x22,0x2f,0x73,0x74,0x61,0x74,0x75,0x73,0x22,0x2c,0x73,0x74,0x61,
-    0x74,0x75,0x73,0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x29,0x7d,0x66,0x75,0x6e,
-    0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x55,0x70,0x64,0x61,
-    0x74,0x65,0x54,0x69,0x6d,0x65,0x72,0x48,0x61,0x6e,0x64,0x6c,0x65,0x72,0x28,0x29,
-    0x7b,0x76,0x61,0x72,0x20,0x65,0x3b,0x6e,0x65,0x77,0x20,0x44,0x61,0x74,0x65,0x2d,
-    0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,
-    0x2e,0x6c,0x61,0x73,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x52,0x78,0x54,0x69,0x6d,
-    0x65,0x3e,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,
-    0x74,0x65,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x55,0x70,0x64,0x61,0x74,0x65,0x54,
-    0x6f,0x6f,0x4c,0x61,0x74,0x65,0x4d,0x73,0x26,0x26,0x28,0x28,0x65,0x3d,0x64,0x6f,
-    0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,
-    0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x2d,0x63,0x6f,
-    0x6e,0x6e,0x65,0x63,0x74,0x22,0x29,0x29,0x2e,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,
-    0x64,0x3d,0x21,0x31,0x2c,0x65,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4c,0x69,0x73,0x74,
-    0x2e,0x72,0x65,0x6d,0x6f,0x76,0x65,0x28,0x22,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,
-    0x64,0x22,0x29,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x74,
-    0x61,0x74,0x75,0x73,0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x28,0x65,0x29,0x7b,
-    0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,
-    0x2e,0x69,0x73,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x65,0x64,0x3d,0x21,0x30,0x3b,
-    0x76,0x61,0x72,0x20,0x74,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,
-    0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x62,
-    0x75,0x74,0x74,0x6f,0x6e,0x2d,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x22,0x29,0x3b,
-    0x74,0x2e,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x3d,0x21,0x30,0x2c,0x74,0x2e,
-    0x63,0x6c,0x61,0x73,0x73,0x4c,0x69,0x73,0x74,0x2e,0x61,0x64,0x64,0x28,0x22,0x64,
-    0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x22,0x29,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,
-    0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x6c,0x61,0x73,0x74,0x53,
-    0x74,0x61,0x74,0x75,0x73,0x52,0x78,0x54,0x69,0x6d,0x65,0x3d,0x6e,0x65,0x77,0x20,
-    0x44,0x61,0x74,0x65,0x3b,0x6c,0x65,0x74,0x20,0x61,0x3d,0x7b,0x7d,0x3b,0x74,0x72,
-    0x79,0x7b,0x61,0x3d,0x4a,0x53,0x4f,0x4e,0x2e,0x70,0x61,0x72,0x73,0x65,0x28,0x65,
-    0x29,0x7d,0x63,0x61,0x74,0x63,0x68,0x28,0x65,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,
-    0x6c,0x65,0x2e,0x65,0x72,0x72,0x6f,0x72,0x28,0x22,0x46,0x61,0x69,0x6c,0x65,0x64,
-    0x20,0x74,0x6f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x73,0x74,0x61,0x74,0x75,0x73,
-    0x20,0x4a,0x53,0x4f,0x4e,0x22,0x29,0x7d,0x76,0x61,0x72,0x20,0x6f,0x3d,0x77,0x69,
-    0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x61,
-    0x78,0x69,0x73,0x4e,0x61,0x6d,0x65,0x73,0x2c,0x73,0x3d,0x77,0x69,0x6e,0x64,0x6f,
-    0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x65,0x6e,0x64,0x73,
-    0x74,0x6f,0x70,0x4e,0x61,0x6d,0x65,0x73,0x3b,0x69,0x66,0x28,0x61,0x2e,0x68,0x61,
-    0x73,0x4f,0x77,0x6e,0x50,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,0x22,0x58,0x59,
-    0x5a,0x22,0x29,0x29,0x66,0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,0x65,0x3d,0x30,0x3b,
-    0x65,0x3c,0x6f,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x65,0x2b,0x2b,0x29,0x64,
-    0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,
-    0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x74,0x64,0x5f,0x22,0x2b,0x6f,0x5b,0x65,
-    0x5d,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x61,0x2e,0x58,
-    0x59,0x5a,0x5b,0x65,0x5d,0x2e,0x74,0x6f,0x46,0x69,0x78,0x65,0x64,0x28,0x32,0x29,
-    0x3b,0x69,0x66,0x28,0x61,0x2e,0x68,0x61,0x73,0x4f,0x77,0x6e,0x50,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x28,0x22,0x41,0x42,0x43,0x22,0x29,0x29,0x66,0x6f,0x72,0x28,
-    0x6c,0x65,0x74,0x20,0x65,0x3d,0x30,0x3b,0x65,0x3c,0x6f,0x2e,0x6c,0x65,0x6e,0x67,
-    0x74,0x68,0x3b,0x65,0x2b,0x2b,0x29,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,
-    0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,
-    0x74,0x64,0x5f,0x73,0x74,0x65,0x70,0x22,0x2b,0x6f,0x5b,0x65,0x5d,0x29,0x2e,0x69,
-    0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x61,0x2e,0x41,0x42,0x43,0x5b,0x65,
-    0x5d,0x3b,0x69,0x66,0x28,0x61,0x2e,0x68,0x61,0x73,0x4f,0x77,0x6e,0x50,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x28,0x22,0x65,0x6e,0x64,0x22,0x29,0x29,0x66,0x6f,0x72,
-    0x28,0x6c,0x65,0x74,0x20,0x6e,0x3d,0x30,0x3b,0x6e,0x3c,0x6f,0x2e,0x6c,0x65,0x6e,
-    0x67,0x74,0x68,0x3b,0x6e,0x2b,0x2b,0x29,0x66,0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,
-    0x74,0x3d,0x30,0x3b,0x74,0x3c,0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x74,
-    0x2b,0x2b,0x29,0x7b,0x76,0x61,0x72,0x20,0x69,0x3d,0x61,0x2e,0x65,0x6e,0x64,0x5b,
-    0x6e,0x5d,0x5b,0x74,0x5d,0x3b,0x6c,0x65,0x74,0x20,0x65,0x3d,0x32,0x3d,0x3d,0x3d,
-    0x69,0x3f,0x22,0x22,0x3a,0x31,0x3d,0x3d,0x3d,0x69,0x3f,0x22,0x48,0x49,0x54,0x22,
-    0x3a,0x22,0x6e,0x2f,0x61,0x22,0x3b,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,
-    0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,
-    0x74,0x64,0x5f,0x22,0x2b,0x73,0x5b,0x74,0x5d,0x2b,0x6f,0x5b,0x6e,0x5d,0x29,0x2e,
-    0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x65,0x7d,0x61,0x2e,0x68,0x61,
-    0x73,0x4f,0x77,0x6e,0x50,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,0x22,0x70,0x61,
-    0x75,0x73,0x65,0x22,0x29,0x26,0x26,0x28,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,
-    0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,
-    0x22,0x74,0x64,0x5f,0x72,0x6f,0x62,0x6f,0x74,0x53,0x74,0x61,0x74,0x65,0x22,0x29,
-    0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x61,0x2e,0x70,0x61,0x75,
-    0x73,0x65,0x3f,0x22,0x50,0x61,0x75,0x73,0x65,0x64,0x22,0x3a,0x22,0x52,0x75,0x6e,
-    0x6e,0x69,0x6e,0x67,0x22,0x29,0x2c,0x61,0x2e,0x68,0x61,0x73,0x4f,0x77,0x6e,0x50,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,0x22,0x51,0x64,0x22,0x29,0x26,0x26,0x28,
-    0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,
-    0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x74,0x64,0x5f,0x72,0x6f,0x62,0x6f,
-    0x74,0x51,0x75,0x65,0x75,0x65,0x4c,0x65,0x6e,0x22,0x29,0x2e,0x69,0x6e,0x6e,0x65,
-    0x72,0x48,0x54,0x4d,0x4c,0x3d,0x61,0x2e,0x51,0x64,0x29,0x7d,0x66,0x75,0x6e,0x63,
-    0x74,0x69,0x6f,0x6e,0x20,0x72,0x6f,0x62,0x6f,0x74,0x54,0x79,0x70,0x65,0x73,0x43,
-    0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x28,0x65,0x29,0x7b,0x77,0x69,0x6e,0x64,0x6f,
-    0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x72,0x6f,0x62,0x6f,
-    0x74,0x54,0x79,0x70,0x65,0x73,0x3d,0x4a,0x53,0x4f,0x4e,0x2e,0x70,0x61,0x72,0x73,
-    0x65,0x28,0x65,0x29,0x3b,0x76,0x61,0x72,0x20,0x74,0x3d,0x64,0x6f,0x63,0x75,0x6d,
-    0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,
-    0x49,0x64,0x28,0x22,0x74,0x64,0x5f,0x52,0x6f,0x62,0x6f,0x74,0x54,0x79,0x70,0x65,
-    0x53,0x65,0x6c,0x65,0x63,0x74,0x22,0x29,0x3b,0x74,0x2e,0x69,0x6e,0x6e,0x65,0x72,
-    0x48,0x54,0x4d,0x4c,0x3d,0x22,0x22,0x3b,0x66,0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,
-    0x65,0x3d,0x30,0x3b,0x65,0x3c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,
-    0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x72,0x6f,0x62,0x6f,0x74,0x54,0x79,0x70,0x65,
-    0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x65,0x2b,0x2b,0x29,0x28,0x6f,0x70,
-    0x74,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,
-    0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x22,0x6f,0x70,0x74,0x69,0x6f,0x6e,
-    0x22,0x29,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x77,0x69,
-    0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x72,
-    0x6f,0x62,0x6f,0x74,0x54,0x79,0x70,0x65,0x73,0x5b,0x65,0x5d,0x2c,0x6f,0x70,0x74,
-    0x2e,0x76,0x61,0x6c,0x75,0x65,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,
-    0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x72,0x6f,0x62,0x6f,0x74,0x54,0x79,0x70,
-    0x65,0x73,0x5b,0x65,0x5d,0x2c,0x74,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,
-    0x69,0x6c,0x64,0x28,0x6f,0x70,0x74,0x29,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,
-    0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x65,0x74,0x74,0x69,0x6e,
-    0x67,0x73,0x2e,0x68,0x61,0x73,0x4f,0x77,0x6e,0x50,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x28,0x22,0x72,0x6f,0x62,0x6f,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x22,0x29,
-    0x26,0x26,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,
-    0x74,0x65,0x2e,0x73,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x2e,0x72,0x6f,0x62,0x6f,
-    0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x2e,0x68,0x61,0x73,0x4f,0x77,0x6e,0x50,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x28,0x22,0x72,0x6f,0x62,0x6f,0x74,0x54,0x79,0x70,
-    0x65,0x22,0x29,0x26,0x26,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,
-    0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x2e,0x72,
-    0x6f,0x62,0x6f,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x2e,0x72,0x6f,0x62,0x6f,0x74,
-    0x54,0x79,0x70,0x65,0x3d,0x3d,0x3d,0x6f,0x70,0x74,0x2e,0x76,0x61,0x6c,0x75,0x65,
-    0x26,0x26,0x28,0x74,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3d,0x6f,0x70,0x74,0x2e,0x76,
-    0x61,0x6c,0x75,0x65,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,
-    0x68,0x6f,0x77,0x53,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x28,0x29,0x7b,0x6c,0x65,
-    0x74,0x20,0x74,0x3d,0x21,0x31,0x3b,0x76,0x61,0x72,0x20,0x65,0x3d,0x77,0x69,0x6e,
-    0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x65,
-    0x74,0x74,0x69,0x6e,0x67,0x73,0x3b,0x69,0x66,0x28,0x65,0x2e,0x68,0x61,0x73,0x4f,
-    0x77,0x6e,0x50,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,0x22,0x72,0x6f,0x62,0x6f,
-    0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x22,0x29,0x26,0x26,0x28,0x64,0x6f,0x63,0x75,
-    0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,
-    0x79,0x49,0x64,0x28,0x22,0x74,0x64,0x5f,0x52,0x6f,0x62,0x6f,0x74,0x43,0x6f,0x6e,
-    0x66,0x69,0x67,0x5f,0x69,0x6e,0x70,0x75,0x74,0x22,0x29,0x2e,0x72,0x65,0x61,0x64,
-    0x4f,0x6e,0x6c,0x79,0x3d,0x21,0x31,0x2c,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,
-    0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,
-    0x22,0x74,0x64,0x5f,0x52,0x6f,0x62,0x6f,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x5f,
-    0x69,0x6e,0x70,0x75,0x74,0x22,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3d,0x4a,0x53,
-    0x4f,0x4e,0x2e,0x73,0x74,0x72,0x69,0x6e,0x67,0x69,0x66,0x79,0x28,0x65,0x2e,0x72,
-    0x6f,0x62,0x6f,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x29,0x2c,0x65,0x2e,0x72,0x6f,
-    0x62,0x6f,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x2e,0x68,0x61,0x73,0x4f,0x77,0x6e,
-    0x50,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,0x22,0x72,0x6f,0x62,0x6f,0x74,0x54,
-    0x79,0x70,0x65,0x22,0x29,0x29,0x29,0x7b,0x76,0x61,0x72,0x20,0x6e,0x3d,0x65,0x2e,
-    0x72,0x6f,0x62,0x6f,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x2e,0x72,0x6f,0x62,0x6f,
-    0x74,0x54,0x79,0x70,0x65,0x3b,0x66,0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,0x65,0x3d,
-    0x30,0x3b,0x65,0x3c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,
-    0x74,0x61,0x74,0x65,0x2e,0x72,0x6f,0x62,0x6f,0x74,0x54,0x79,0x70,0x65,0x73,0x2e,
-    0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x65,0x2b,0x2b,0x29,0x69,0x66,0x28,0x77,0x69,
-    0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x72,
-    0x6f,0x62,0x6f,0x74,0x54,0x79,0x70,0x65,0x73,0x5b,0x65,0x5d,0x3d,0x3d,0x3d,0x6e,
-    0x29,0x7b,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,
-    0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x74,0x64,0x5f,0x52,0x6f,
-    0x62,0x6f,0x74,0x54,0x79,0x70,0x65,0x53,0x65,0x6c,0x65,0x63,0x74,0x22,0x29,0x2e,
-    0x73,0x65,0x74,0x41,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x22,0x73,0x65,
-    0x6c,0x65,0x63,0x74,0x65,0x64,0x22,0x2c,0x6e,0x29,0x2c,0x74,0x3d,0x21,0x30,0x3b,
-    0x62,0x72,0x65,0x61,0x6b,0x7d,0x7d,0x74,0x7c,0x7c,0x30,0x3d,0x3d,0x77,0x69,0x6e,
-    0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x72,0x6f,
-    0x62,0x6f,0x74,0x54,0x79,0x70,0x65,0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x7c,
-    0x7c,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,
-    0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x74,0x64,0x5f,0x52,0x6f,0x62,
-    0x6f,0x74,0x54,0x79,0x70,0x65,0x53,0x65,0x6c,0x65,0x63,0x74,0x22,0x29,0x2e,0x73,
-    0x65,0x74,0x41,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x22,0x73,0x65,0x6c,
-    0x65,0x63,0x74,0x65,0x64,0x22,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,
-    0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x72,0x6f,0x62,0x6f,0x74,0x54,0x79,0x70,
-    0x65,0x73,0x5b,0x30,0x5d,0x29,0x2c,0x65,0x2e,0x68,0x61,0x73,0x4f,0x77,0x6e,0x50,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,0x22,0x6e,0x61,0x6d,0x65,0x22,0x29,0x26,
-    0x26,0x28,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,
-    0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x74,0x64,0x5f,0x52,0x6f,
-    0x62,0x6f,0x74,0x4e,0x61,0x6d,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x22,0x29,0x2e,
-    0x76,0x61,0x6c,0x75,0x65,0x3d,0x65,0x2e,0x6e,0x61,0x6d,0x65,0x29,0x2c,0x65,0x2e,
-    0x68,0x61,0x73,0x4f,0x77,0x6e,0x50,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,0x22,
-    0x63,0x6d,0x64,0x53,0x63,0x68,0x65,0x64,0x22,0x29,0x3f,0x64,0x6f,0x63,0x75,0x6d,
-    0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,
-    0x49,0x64,0x28,0x22,0x74,0x64,0x5f,0x43,0x6d,0x64,0x53,0x63,0x68,0x65,0x64,0x75,
-    0x6c,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x22,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,
-    0x3d,0x4a,0x53,0x4f,0x4e,0x2e,0x73,0x74,0x72,0x69,0x6e,0x67,0x69,0x66,0x79,0x28,
-    0x65,0x2e,0x63,0x6d,0x64,0x53,0x63,0x68,0x65,0x64,0x29,0x3a,0x64,0x6f,0x63,0x75,
-    0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,
-    0x79,0x49,0x64,0x28,0x22,0x74,0x64,0x5f,0x43,0x6d,0x64,0x53,0x63,0x68,0x65,0x64,
-    0x75,0x6c,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x22,0x29,0x2e,0x76,0x61,0x6c,0x75,
-    0x65,0x3d,0x4a,0x53,0x4f,0x4e,0x2e,0x73,0x74,0x72,0x69,0x6e,0x67,0x69,0x66,0x79,
-    0x28,0x7b,0x6a,0x6f,0x62,0x73,0x3a,0x5b,0x5d,0x7d,0x29,0x2c,0x63,0x68,0x65,0x63,
-    0x6b,0x4a,0x73,0x6f,0x6e,0x53,0x74,0x72,0x69,0x6e,0x67,0x73,0x28,0x21,0x31,0x29,
-    0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x65,0x74,0x74,0x69,0x6e,
-    0x67,0x73,0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x28,0x65,0x29,0x7b,0x77,0x69,
-    0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,
-    0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x3d,0x4a,0x53,0x4f,0x4e,0x2e,0x70,0x61,0x72,
-    0x73,0x65,0x28,0x65,0x29,0x2c,0x73,0x68,0x6f,0x77,0x53,0x65,0x74,0x74,0x69,0x6e,
-    0x67,0x73,0x28,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x63,0x68,
-    0x65,0x63,0x6b,0x4a,0x73,0x6f,0x6e,0x53,0x74,0x72,0x69,0x6e,0x67,0x73,0x28,0x65,
-    0x29,0x7b,0x69,0x66,0x28,0x65,0x29,0x74,0x72,0x79,0x7b,0x77,0x69,0x6e,0x64,0x6f,
-    0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x65,0x74,0x74,
-    0x69,0x6e,0x67,0x73,0x2e,0x72,0x6f,0x62,0x6f,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,
-    0x3d,0x4a,0x53,0x4f,0x4e,0x2e,0x70,0x61,0x72,0x73,0x65,0x28,0x64,0x6f,0x63,0x75,
-    0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,
-    0x79,0x49,0x64,0x28,0x22,0x74,0x64,0x5f,0x52,0x6f,0x62,0x6f,0x74,0x43,0x6f,0x6e,
-    0x66,0x69,0x67,0x5f,0x69,0x6e,0x70,0x75,0x74,0x22,0x29,0x2e,0x76,0x61,0x6c,0x75,
-    0x65,0x29,0x2c,0x30,0x21,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,
-    0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x74,
-    0x64,0x5f,0x43,0x6d,0x64,0x53,0x63,0x68,0x65,0x64,0x75,0x6c,0x65,0x5f,0x69,0x6e,
-    0x70,0x75,0x74,0x22,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2e,0x6c,0x65,0x6e,0x67,
-    0x74,0x68,0x3f,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,
-    0x61,0x74,0x65,0x2e,0x73,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x2e,0x63,0x6d,0x64,
-    0x53,0x63,0x68,0x65,0x64,0x3d,0x4a,0x53,0x4f,0x4e,0x2e,0x70,0x61,0x72,0x73,0x65,
-    0x28,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,
-    0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x74,0x64,0x5f,0x43,0x6d,0x64,
-    0x53,0x63,0x68,0x65,0x64,0x75,0x6c,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x22,0x29,
-    0x2e,0x76,0x61,0x6c,0x75,0x65,0x29,0x3a,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,
-    0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x65,0x74,0x74,0x69,0x6e,0x67,
-    0x73,0x2e,0x63,0x6d,0x64,0x53,0x63,0x68,0x65,0x64,0x3d,0x7b,0x6a,0x6f,0x62,0x73,
-    0x3a,0x5b,0x5d,0x7d,0x7d,0x63,0x61,0x74,0x63,0x68,0x28,0x65,0x29,0x7b,0x72,0x65,
-    0x74,0x75,0x72,0x6e,0x21,0x31,0x7d,0x72,0x65,0x74,0x75,0x72,0x6e,0x21,0x30,0x7d,
-    0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x61,0x76,0x65,0x43,0x6f,0x6e,
-    0x66,0x69,0x67,0x28,0x29,0x7b,0x76,0x61,0x72,0x20,0x65,0x3b,0x63,0x6f,0x6e,0x73,
-    0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x53,0x61,0x76,0x65,0x20,0x53,0x65,
-    0x74,0x74,0x69,0x6e,0x67,0x73,0x22,0x29,0x2c,0x63,0x68,0x65,0x63,0x6b,0x4a,0x73,
-    0x6f,0x6e,0x53,0x74,0x72,0x69,0x6e,0x67,0x73,0x28,0x21,0x30,0x29,0x3f,0x28,0x77,
-    0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,
-    0x73,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x2e,0x6e,0x61,0x6d,0x65,0x3d,0x64,0x6f,
-    0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,
-    0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x74,0x64,0x5f,0x52,0x6f,0x62,0x6f,0x74,0x4e,
-    0x61,0x6d,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x22,0x29,0x2e,0x76,0x61,0x6c,0x75,
-    0x65,0x2c,0x65,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,
-    0x74,0x61,0x74,0x65,0x2e,0x73,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x2c,0x4a,0x53,
-    0x4f,0x4e,0x2e,0x73,0x74,0x72,0x69,0x6e,0x67,0x69,0x66,0x79,0x28,0x65,0x29,0x2e,
-    0x6c,0x65,0x6e,0x67,0x74,0x68,0x3e,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,
-    0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x4d,0x41,0x58,0x5f,0x43,0x4f,0x4e,0x46,
-    0x49,0x47,0x5f,0x4c,0x45,0x4e,0x3f,0x61,0x6c,0x65,0x72,0x74,0x28,0x22,0x53,0x65,
-    0x74,0x74,0x69,0x6e,0x67,0x73,0x20,0x4a,0x53,0x4f,0x4e,0x20,0x69,0x73,0x20,0x74,
-    0x6f,0x6f,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x66,0x6f,0x72,0x20,0x45,0x45,0x50,0x52,
-    0x4f,0x4d,0x20,0x28,0x6d,0x61,0x78,0x20,0x22,0x2b,0x77,0x69,0x6e,0x64,0x6f,0x77,
-    0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x4d,0x41,0x58,0x5f,0x43,
-    0x4f,0x4e,0x46,0x49,0x47,0x5f,0x4c,0x45,0x4e,0x2b,0x22,0x29,0x20,0x70,0x6c,0x65,
-    0x61,0x73,0x65,0x20,0x73,0x68,0x6f,0x72,0x74,0x65,0x6e,0x22,0x29,0x3a,0x28,0x63,
-    0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x53,0x65,0x6e,0x64,
-    0x69,0x6e,0x67,0x20,0x63,0x6f,0x6e,0x66,0x69,0x67,0x20,0x73,0x74,0x72,0x22,0x2b,
-    0x4a,0x53,0x4f,0x4e,0x2e,0x73,0x74,0x72,0x69,0x6e,0x67,0x69,0x66,0x79,0x28,0x65,
-    0x29,0x29,0x2c,0x70,0x6f,0x73,0x74,0x4a,0x73,0x6f,0x6e,0x28,0x22,0x2f,0x70,0x6f,
-    0x73,0x74,0x73,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x2f,0x22,0x2c,0x4a,0x53,0x4f,
-    0x4e,0x2e,0x73,0x74,0x72,0x69,0x6e,0x67,0x69,0x66,0x79,0x28,0x65,0x29,0x2c,0x70,
-    0x6f,0x73,0x74,0x53,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x4f,0x6b,0x43,0x61,0x6c,
-    0x6c,0x62,0x61,0x63,0x6b,0x2c,0x70,0x6f,0x73,0x74,0x53,0x65,0x74,0x74,0x69,0x6e,
-    0x67,0x73,0x46,0x61,0x69,0x6c,0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x29,0x29,
-    0x29,0x3a,0x61,0x6c,0x65,0x72,0x74,0x28,0x22,0x53,0x65,0x74,0x74,0x69,0x6e,0x67,
-    0x73,0x20,0x4a,0x53,0x4f,0x4e,0x20,0x69,0x73,0x20,0x6e,0x6f,0x74,0x20,0x76,0x61,
-    0x6c,0x69,0x64,0x20,0x2d,0x20,0x70,0x6c,0x65,0x61,0x73,0x65,0x20,0x63,0x68,0x65,
-    0x63,0x6b,0x22,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x70,0x6f,
-    0x73,0x74,0x53,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x4f,0x6b,0x43,0x61,0x6c,0x6c,
-    0x62,0x61,0x63,0x6b,0x28,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,
-    0x6f,0x67,0x28,0x22,0x53,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x20,0x73,0x65,0x6e,
-    0x74,0x20,0x6f,0x6b,0x22,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,
-    0x70,0x6f,0x73,0x74,0x53,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x46,0x61,0x69,0x6c,
-    0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x28,0x29,0x7b,0x61,0x6c,0x65,0x72,0x74,
-    0x28,0x22,0x46,0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,0x20,0x73,0x65,0x6e,0x64,
-    0x20,0x6e,0x65,0x77,0x20,0x73,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x22,0x29,0x7d,
-    0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x72,0x6f,0x62,0x6f,0x74,0x54,0x79,
-    0x70,0x65,0x43,0x6c,0x69,0x63,0x6b,0x28,0x29,0x7b,0x76,0x61,0x72,0x20,0x65,0x3d,
-    0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,
-    0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x74,0x64,0x5f,0x52,0x6f,0x62,0x6f,
-    0x74,0x54,0x79,0x70,0x65,0x53,0x65,0x6c,0x65,0x63,0x74,0x22,0x29,0x2e,0x73,0x65,
-    0x6c,0x65,0x63,0x74,0x65,0x64,0x49,0x6e,0x64,0x65,0x78,0x2c,0x65,0x3d,0x64,0x6f,
-    0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,
-    0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x74,0x64,0x5f,0x52,0x6f,0x62,0x6f,0x74,0x54,
-    0x79,0x70,0x65,0x53,0x65,0x6c,0x65,0x63,0x74,0x22,0x29,0x2e,0x6f,0x70,0x74,0x69,
-    0x6f,0x6e,0x73,0x5b,0x65,0x5d,0x3b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,
-    0x6f,0x67,0x28,0x22,0x43,0x68,0x61,0x6e,0x67,0x65,0x20,0x72,0x6f,0x62,0x6f,0x74,
-    0x20,0x74,0x79,0x70,0x65,0x20,0x22,0x2b,0x65,0x2e,0x74,0x65,0x78,0x74,0x29,0x2c,
-    0x63,0x61,0x6c,0x6c,0x41,0x6a,0x61,0x78,0x28,0x22,0x2f,0x67,0x65,0x74,0x52,0x6f,
-    0x62,0x6f,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x75,0x72,0x61,0x74,0x69,0x6f,0x6e,
-    0x2f,0x22,0x2b,0x65,0x2e,0x74,0x65,0x78,0x74,0x2c,0x67,0x6f,0x74,0x52,0x6f,0x62,
-    0x6f,0x74,0x54,0x79,0x70,0x65,0x43,0x6f,0x6e,0x66,0x69,0x67,0x29,0x7d,0x66,0x75,
-    0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x67,0x6f,0x74,0x52,0x6f,0x62,0x6f,0x74,0x54,
-    0x79,0x70,0x65,0x43,0x6f,0x6e,0x66,0x69,0x67,0x28,0x65,0x29,0x7b,0x77,0x69,0x6e,
-    0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x65,
-    0x74,0x74,0x69,0x6e,0x67,0x73,0x2e,0x72,0x6f,0x62,0x6f,0x74,0x43,0x6f,0x6e,0x66,
-    0x69,0x67,0x3d,0x4a,0x53,0x4f,0x4e,0x2e,0x70,0x61,0x72,0x73,0x65,0x28,0x65,0x29,
-    0x2c,0x73,0x68,0x6f,0x77,0x53,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x28,0x29,0x7d,
-    0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x63,0x61,0x6c,0x6c,0x41,0x6a,0x61,
-    0x78,0x28,0x65,0x2c,0x74,0x2c,0x6e,0x29,0x7b,0x6c,0x65,0x74,0x20,0x61,0x3d,0x6e,
-    0x65,0x77,0x20,0x58,0x4d,0x4c,0x48,0x74,0x74,0x70,0x52,0x65,0x71,0x75,0x65,0x73,
-    0x74,0x3b,0x61,0x2e,0x6f,0x6e,0x72,0x65,0x61,0x64,0x79,0x73,0x74,0x61,0x74,0x65,
-    0x63,0x68,0x61,0x6e,0x67,0x65,0x3d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,
-    0x29,0x7b,0x34,0x3d,0x3d,0x3d,0x61,0x2e,0x72,0x65,0x61,0x64,0x79,0x53,0x74,0x61,
-    0x74,0x65,0x26,0x26,0x28,0x32,0x30,0x30,0x3d,0x3d,0x3d,0x61,0x2e,0x73,0x74,0x61,
-    0x74,0x75,0x73,0x3f,0x76,0x6f,0x69,0x64,0x20,0x30,0x21,0x3d,0x3d,0x74,0x26,0x26,
-    0x74,0x28,0x61,0x2e,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x54,0x65,0x78,0x74,
-    0x29,0x3a,0x76,0x6f,0x69,0x64,0x20,0x30,0x21,0x3d,0x3d,0x6e,0x26,0x26,0x6e,0x28,
-    0x61,0x29,0x29,0x7d,0x2c,0x61,0x2e,0x6f,0x70,0x65,0x6e,0x28,0x22,0x47,0x45,0x54,
-    0x22,0x2c,0x65,0x2c,0x21,0x30,0x29,0x2c,0x61,0x2e,0x73,0x65,0x6e,0x64,0x28,0x29,
-    0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x61,0x6a,0x61,0x78,0x43,0x61,
-    0x6c,0x6c,0x62,0x61,0x63,0x6b,0x28,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,
-    0x2e,0x6c,0x6f,0x67,0x28,0x22,0x41,0x6a,0x61,0x78,0x43,0x61,0x6c,0x6c,0x62,0x61,
-    0x63,0x6b,0x22,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x70,0x6f,
-    0x73,0x74,0x4a,0x73,0x6f,0x6e,0x28,0x65,0x2c,0x74,0x2c,0x6e,0x2c,0x61,0x29,0x7b,
-    0x6c,0x65,0x74,0x20,0x6f,0x3d,0x6e,0x65,0x77,0x20,0x58,0x4d,0x4c,0x48,0x74,0x74,
-    0x70,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x3b,0x6f,0x2e,0x6f,0x6e,0x72,0x65,0x61,
-    0x64,0x79,0x73,0x74,0x61,0x74,0x65,0x63,0x68,0x61,0x6e,0x67,0x65,0x3d,0x66,0x75,
-    0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x7b,0x34,0x3d,0x3d,0x3d,0x6f,0x2e,0x72,
-    0x65,0x61,0x64,0x79,0x53,0x74,0x61,0x74,0x65,0x26,0x26,0x28,0x32,0x30,0x30,0x3d,
-    0x3d,0x3d,0x6f,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x3f,0x76,0x6f,0x69,0x64,0x20,
-    0x30,0x21,0x3d,0x3d,0x6e,0x26,0x26,0x6e,0x28,0x6f,0x2e,0x72,0x65,0x73,0x70,0x6f,
-    0x6e,0x73,0x65,0x54,0x65,0x78,0x74,0x29,0x3a,0x76,0x6f,0x69,0x64,0x20,0x30,0x21,
-    0x3d,0x3d,0x61,0x26,0x26,0x61,0x28,0x6f,0x29,0x29,0x7d,0x2c,0x6f,0x2e,0x6f,0x70,
-    0x65,0x6e,0x28,0x22,0x50,0x4f,0x53,0x54,0x22,0x2c,0x65,0x29,0x2c,0x6f,0x2e,0x73,
-    0x65,0x74,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x48,0x65,0x61,0x64,0x65,0x72,0x28,
-    0x22,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,0x22,0x2c,0x22,
-    0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2f,0x6a,0x73,0x6f,0x6e,
-    0x22,0x29,0x2c,0x6f,0x2e,0x73,0x65,0x6e,0x64,0x28,0x74,0x29,0x7d,0x66,0x75,0x6e,
-    0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x65,0x6e,0x64,0x47,0x63,0x6f,0x64,0x65,0x46,
-    0x72,0x6f,0x6d,0x49,0x6e,0x70,0x75,0x74,0x28,0x29,0x7b,0x76,0x61,0x72,0x20,0x65,
-    0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,
-    0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x67,0x63,0x6f,0x64,0x65,0x53,
-    0x65,0x6e,0x64,0x42,0x6f,0x78,0x22,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x30,
-    0x21,0x3d,0x3d,0x65,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x26,0x26,0x63,0x61,0x6c,
-    0x6c,0x41,0x6a,0x61,0x78,0x28,0x22,0x2f,0x65,0x78,0x65,0x63,0x2f,0x22,0x2b,0x65,
-    0x2c,0x61,0x6a,0x61,0x78,0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x29,0x7d,0x66,
-    0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x45,
-    0x76,0x65,0x6e,0x74,0x73,0x28,0x29,0x7b,0x76,0x61,0x72,0x20,0x65,0x3b,0x77,0x69,
-    0x6e,0x64,0x6f,0x77,0x2e,0x45,0x76,0x65,0x6e,0x74,0x53,0x6f,0x75,0x72,0x63,0x65,
-    0x26,0x26,0x28,0x28,0x65,0x3d,0x6e,0x65,0x77,0x20,0x45,0x76,0x65,0x6e,0x74,0x53,
-    0x6f,0x75,0x72,0x63,0x65,0x28,0x22,0x2f,0x65,0x76,0x65,0x6e,0x74,0x73,0x22,0x29,
-    0x29,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,
-    0x65,0x72,0x28,0x22,0x6f,0x70,0x65,0x6e,0x22,0x2c,0x66,0x75,0x6e,0x63,0x74,0x69,
-    0x6f,0x6e,0x28,0x65,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,
-    0x67,0x28,0x22,0x41,0x73,0x79,0x6e,0x63,0x20,0x65,0x76,0x65,0x6e,0x74,0x73,0x20,
-    0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x65,0x64,0x22,0x29,0x7d,0x2c,0x21,0x31,0x29,
-    0x2c,0x65,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,
-    0x6e,0x65,0x72,0x28,0x22,0x65,0x72,0x72,0x6f,0x72,0x22,0x2c,0x66,0x75,0x6e,0x63,
-    0x74,0x69,0x6f,0x6e,0x28,0x65,0x29,0x7b,0x65,0x2e,0x74,0x61,0x72,0x67,0x65,0x74,
-    0x2e,0x72,0x65,0x61,0x64,0x79,0x53,0x74,0x61,0x74,0x65,0x21,0x3d,0x45,0x76,0x65,
-    0x6e,0x74,0x53,0x6f,0x75,0x72,0x63,0x65,0x2e,0x4f,0x50,0x45,0x4e,0x26,0x26,0x63,
-    0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x45,0x76,0x65,0x6e,
-    0x74,0x73,0x20,0x44,0x69,0x73,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x65,0x64,0x22,
-    0x29,0x7d,0x2c,0x21,0x31,0x29,0x2c,0x65,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,
-    0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x73,0x74,0x61,0x74,0x75,
-    0x73,0x22,0x2c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,0x29,0x7b,0x63,
-    0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x73,0x74,0x61,0x74,
-    0x75,0x73,0x22,0x2c,0x65,0x2e,0x64,0x61,0x74,0x61,0x29,0x2c,0x73,0x74,0x61,0x74,
-    0x75,0x73,0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x28,0x65,0x2e,0x64,0x61,0x74,
-    0x61,0x29,0x7d,0x2c,0x21,0x31,0x29,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,
-    0x6e,0x20,0x72,0x65,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x28,0x65,0x29,0x7b,0x63,
-    0x6f,0x6e,0x6e,0x65,0x63,0x74,0x45,0x76,0x65,0x6e,0x74,0x73,0x28,0x29,0x7d,0x66,
-    0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x70,0x61,0x75,0x73,0x65,0x52,0x6f,0x62,
-    0x6f,0x74,0x28,0x65,0x29,0x7b,0x63,0x61,0x6c,0x6c,0x41,0x6a,0x61,0x78,0x28,0x22,
-    0x2f,0x65,0x78,0x65,0x63,0x2f,0x70,0x61,0x75,0x73,0x65,0x22,0x29,0x7d,0x66,0x75,
-    0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x72,0x65,0x73,0x75,0x6d,0x65,0x52,0x6f,0x62,
-    0x6f,0x74,0x28,0x65,0x29,0x7b,0x63,0x61,0x6c,0x6c,0x41,0x6a,0x61,0x78,0x28,0x22,
-    0x2f,0x65,0x78,0x65,0x63,0x2f,0x72,0x65,0x73,0x75,0x6d,0x65,0x22,0x29,0x7d,0x66,
-    0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x74,0x6f,0x70,0x52,0x6f,0x62,0x6f,
-    0x74,0x28,0x29,0x7b,0x63,0x61,0x6c,0x6c,0x41,0x6a,0x61,0x78,0x28,0x22,0x2f,0x65,
-    0x78,0x65,0x63,0x2f,0x73,0x74,0x6f,0x70,0x22,0x29,0x2c,0x73,0x65,0x74,0x53,0x74,
-    0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x53,0x74,0x61,0x74,0x65,0x28,0x21,
-    0x31,0x29,0x2c,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x53,0x68,
-    0x6f,0x77,0x53,0x74,0x61,0x74,0x75,0x73,0x28,0x22,0x43,0x61,0x6e,0x63,0x65,0x6c,
-    0x6c,0x65,0x64,0x22,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6d,
-    0x6f,0x76,0x65,0x43,0x6c,0x69,0x63,0x6b,0x28,0x65,0x2c,0x74,0x29,0x7b,0x73,0x74,
-    0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x49,0x6d,0x6d,0x65,0x64,0x69,0x61,
-    0x74,0x65,0x28,0x22,0x47,0x39,0x31,0x5c,0x6e,0x47,0x30,0x20,0x22,0x2b,0x77,0x69,
-    0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x61,
-    0x78,0x69,0x73,0x4e,0x61,0x6d,0x65,0x73,0x5b,0x65,0x5d,0x2e,0x74,0x6f,0x55,0x70,
-    0x70,0x65,0x72,0x43,0x61,0x73,0x65,0x28,0x29,0x2b,0x74,0x2e,0x74,0x6f,0x53,0x74,
-    0x72,0x69,0x6e,0x67,0x28,0x29,0x2b,0x22,0x5c,0x6e,0x47,0x39,0x30,0x22,0x2c,0x21,
-    0x31,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x67,0x6f,0x48,0x6f,
-    0x6d,0x65,0x43,0x6c,0x69,0x63,0x6b,0x28,0x65,0x29,0x7b,0x63,0x61,0x6c,0x6c,0x41,
-    0x6a,0x61,0x78,0x28,0x2d,0x31,0x3d,0x3d,0x65,0x3f,0x22,0x2f,0x65,0x78,0x65,0x63,
-    0x2f,0x47,0x32,0x38,0x22,0x3a,0x22,0x2f,0x65,0x78,0x65,0x63,0x2f,0x47,0x32,0x38,
-    0x20,0x22,0x2b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,
-    0x61,0x74,0x65,0x2e,0x61,0x78,0x69,0x73,0x4e,0x61,0x6d,0x65,0x73,0x5b,0x65,0x5d,
-    0x2e,0x74,0x6f,0x55,0x70,0x70,0x65,0x72,0x43,0x61,0x73,0x65,0x28,0x29,0x29,0x7d,
-    0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x65,0x74,0x48,0x6f,0x6d,0x65,
-    0x43,0x6c,0x69,0x63,0x6b,0x28,0x65,0x29,0x7b,0x63,0x61,0x6c,0x6c,0x41,0x6a,0x61,
-    0x78,0x28,0x22,0x2f,0x65,0x78,0x65,0x63,0x2f,0x47,0x39,0x32,0x20,0x22,0x2b,0x77,
-    0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,
-    0x61,0x78,0x69,0x73,0x4e,0x61,0x6d,0x65,0x73,0x5b,0x65,0x5d,0x2e,0x74,0x6f,0x55,
-    0x70,0x70,0x65,0x72,0x43,0x61,0x73,0x65,0x28,0x29,0x29,0x7d,0x66,0x75,0x6e,0x63,
-    0x74,0x69,0x6f,0x6e,0x20,0x66,0x69,0x6c,0x65,0x55,0x70,0x6c,0x6f,0x61,0x64,0x43,
-    0x68,0x61,0x6e,0x67,0x65,0x28,0x65,0x29,0x7b,0x30,0x3c,0x74,0x68,0x69,0x73,0x2e,
-    0x66,0x69,0x6c,0x65,0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x26,0x26,0x28,0x22,
-    0x66,0x69,0x6c,0x65,0x73,0x79,0x73,0x74,0x65,0x6d,0x22,0x3d,0x3d,0x3d,0x77,0x69,
-    0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x66,
-    0x69,0x6c,0x65,0x44,0x69,0x61,0x6c,0x6f,0x67,0x54,0x79,0x70,0x65,0x3f,0x73,0x74,
-    0x61,0x72,0x74,0x46,0x69,0x6c,0x65,0x53,0x79,0x73,0x74,0x65,0x6d,0x55,0x70,0x6c,
-    0x6f,0x61,0x64,0x28,0x74,0x68,0x69,0x73,0x2e,0x66,0x69,0x6c,0x65,0x73,0x29,0x3a,
-    0x73,0x74,0x61,0x72,0x74,0x47,0x43,0x6f,0x64,0x65,0x53,0x74,0x72,0x65,0x61,0x6d,
-    0x28,0x74,0x68,0x69,0x73,0x2e,0x66,0x69,0x6c,0x65,0x73,0x5b,0x30,0x5d,0x29,0x2c,
-    0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,
-    0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x69,0x6e,0x70,0x75,0x74,0x5f,0x66,
-    0x69,0x6c,0x65,0x5f,0x75,0x70,0x6c,0x6f,0x61,0x64,0x22,0x29,0x2e,0x76,0x61,0x6c,
-    0x75,0x65,0x3d,0x22,0x22,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,
-    0x62,0x74,0x6e,0x53,0x74,0x72,0x65,0x61,0x6d,0x47,0x63,0x6f,0x64,0x65,0x28,0x65,
-    0x29,0x7b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,
-    0x74,0x65,0x2e,0x73,0x74,0x72,0x65,0x61,0x6d,0x69,0x6e,0x67,0x49,0x6e,0x50,0x72,
-    0x6f,0x67,0x72,0x65,0x73,0x73,0x3f,0x61,0x6c,0x65,0x72,0x74,0x28,0x22,0x53,0x74,
-    0x72,0x65,0x61,0x6d,0x69,0x6e,0x67,0x20,0x69,0x6e,0x20,0x70,0x72,0x6f,0x67,0x72,
-    0x65,0x73,0x73,0x22,0x29,0x3a,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,
-    0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x66,0x69,0x6c,0x65,0x44,0x69,0x61,0x6c,
-    0x6f,0x67,0x54,0x79,0x70,0x65,0x3d,0x22,0x73,0x74,0x72,0x65,0x61,0x6d,0x67,0x63,
-    0x6f,0x64,0x65,0x22,0x2c,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,
-    0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x69,0x6e,
-    0x70,0x75,0x74,0x5f,0x66,0x69,0x6c,0x65,0x5f,0x75,0x70,0x6c,0x6f,0x61,0x64,0x22,
-    0x29,0x2e,0x63,0x6c,0x69,0x63,0x6b,0x28,0x29,0x2c,0x65,0x2e,0x70,0x72,0x65,0x76,
-    0x65,0x6e,0x74,0x44,0x65,0x66,0x61,0x75,0x6c,0x74,0x28,0x29,0x29,0x7d,0x66,0x75,
-    0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x62,0x74,0x6e,0x53,0x74,0x72,0x65,0x61,0x6d,
-    0x47,0x43,0x6f,0x64,0x65,0x43,0x61,0x6e,0x63,0x65,0x6c,0x28,0x65,0x29,0x7b,0x63,
-    0x6c,0x65,0x61,0x72,0x54,0x69,0x6d,0x65,0x6f,0x75,0x74,0x28,0x77,0x69,0x6e,0x64,
-    0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x74,0x72,
-    0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x52,0x65,0x74,0x72,0x79,0x54,0x69,0x6d,
-    0x65,0x72,0x29,0x2c,0x63,0x61,0x6c,0x6c,0x41,0x6a,0x61,0x78,0x28,0x22,0x2f,0x65,
-    0x78,0x65,0x63,0x2f,0x73,0x74,0x6f,0x70,0x22,0x29,0x2c,0x73,0x65,0x74,0x53,0x74,
-    0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x53,0x74,0x61,0x74,0x65,0x28,0x21,
-    0x31,0x29,0x2c,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x53,0x68,
-    0x6f,0x77,0x53,0x74,0x61,0x74,0x75,0x73,0x28,0x22,0x43,0x61,0x6e,0x63,0x65,0x6c,
-    0x6c,0x65,0x64,0x22,0x29,0x2c,0x65,0x2e,0x70,0x72,0x65,0x76,0x65,0x6e,0x74,0x44,
-    0x65,0x66,0x61,0x75,0x6c,0x74,0x28,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,
-    0x6e,0x20,0x6b,0x65,0x79,0x50,0x72,0x65,0x73,0x73,0x49,0x6e,0x47,0x43,0x6f,0x64,
-    0x65,0x42,0x6f,0x78,0x28,0x65,0x29,0x7b,0x31,0x33,0x21,0x3d,0x3d,0x65,0x2e,0x6b,
-    0x65,0x79,0x43,0x6f,0x64,0x65,0x26,0x26,0x31,0x33,0x21,0x3d,0x3d,0x65,0x2e,0x77,
-    0x68,0x69,0x63,0x68,0x7c,0x7c,0x73,0x65,0x6e,0x64,0x47,0x63,0x6f,0x64,0x65,0x46,
-    0x72,0x6f,0x6d,0x49,0x6e,0x70,0x75,0x74,0x28,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,
-    0x69,0x6f,0x6e,0x20,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x53,
-    0x68,0x6f,0x77,0x53,0x74,0x61,0x74,0x75,0x73,0x28,0x65,0x29,0x7b,0x64,0x6f,0x63,
-    0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,
-    0x42,0x79,0x49,0x64,0x28,0x22,0x74,0x78,0x74,0x55,0x70,0x6c,0x6f,0x61,0x64,0x53,
-    0x74,0x61,0x74,0x75,0x73,0x22,0x29,0x2e,0x74,0x65,0x78,0x74,0x43,0x6f,0x6e,0x74,
-    0x65,0x6e,0x74,0x3d,0x65,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,
-    0x65,0x74,0x53,0x74,0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x53,0x74,0x61,
-    0x74,0x65,0x28,0x65,0x29,0x7b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,
-    0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x74,0x72,0x65,0x61,0x6d,0x69,0x6e,0x67,
-    0x49,0x6e,0x50,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x3d,0x65,0x3b,0x76,0x61,0x72,
-    0x20,0x74,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,
-    0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x62,0x74,0x6e,0x53,
-    0x74,0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x22,0x29,0x2c,0x74,0x3d,0x28,
-    0x65,0x3f,0x74,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4c,0x69,0x73,0x74,0x2e,0x61,0x64,
-    0x64,0x28,0x22,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x22,0x29,0x3a,0x74,0x2e,
-    0x63,0x6c,0x61,0x73,0x73,0x4c,0x69,0x73,0x74,0x2e,0x72,0x65,0x6d,0x6f,0x76,0x65,
-    0x28,0x22,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x22,0x29,0x2c,0x64,0x6f,0x63,
-    0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,
-    0x42,0x79,0x49,0x64,0x28,0x22,0x62,0x74,0x6e,0x53,0x74,0x72,0x65,0x61,0x6d,0x47,
-    0x43,0x6f,0x64,0x65,0x43,0x61,0x6e,0x63,0x65,0x6c,0x22,0x29,0x29,0x3b,0x65,0x3f,
-    0x28,0x74,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4c,0x69,0x73,0x74,0x2e,0x72,0x65,0x6d,
-    0x6f,0x76,0x65,0x28,0x22,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x22,0x29,0x2c,
-    0x74,0x2e,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x3d,0x21,0x31,0x29,0x3a,0x28,
-    0x74,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4c,0x69,0x73,0x74,0x2e,0x61,0x64,0x64,0x28,
-    0x22,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x22,0x29,0x2c,0x74,0x2e,0x64,0x69,
-    0x73,0x61,0x62,0x6c,0x65,0x64,0x3d,0x21,0x30,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,
-    0x69,0x6f,0x6e,0x20,0x73,0x74,0x61,0x72,0x74,0x47,0x43,0x6f,0x64,0x65,0x53,0x74,
-    0x72,0x65,0x61,0x6d,0x28,0x65,0x29,0x7b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,
-    0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x74,0x72,0x65,0x61,0x6d,0x69,
-    0x6e,0x67,0x49,0x6e,0x50,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x3f,0x63,0x6f,0x6e,
-    0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x53,0x74,0x72,0x65,0x61,0x6d,
-    0x69,0x6e,0x67,0x20,0x61,0x6c,0x72,0x65,0x61,0x64,0x79,0x20,0x69,0x6e,0x20,0x70,
-    0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x22,0x29,0x3a,0x65,0x2e,0x73,0x69,0x7a,0x65,
-    0x3e,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,
-    0x65,0x2e,0x4d,0x41,0x58,0x5f,0x46,0x49,0x4c,0x45,0x5f,0x53,0x49,0x5a,0x45,0x3f,
-    0x61,0x6c,0x65,0x72,0x74,0x28,0x22,0x53,0x74,0x72,0x65,0x61,0x6d,0x20,0x66,0x69,
-    0x6c,0x65,0x20,0x69,0x73,0x20,0x74,0x6f,0x6f,0x20,0x6c,0x61,0x72,0x67,0x65,0x22,
-    0x29,0x3a,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,
-    0x61,0x74,0x65,0x2e,0x66,0x69,0x6c,0x65,0x54,0x6f,0x53,0x74,0x72,0x65,0x61,0x6d,
-    0x3d,0x65,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,
-    0x61,0x74,0x65,0x2e,0x66,0x69,0x6c,0x65,0x54,0x6f,0x53,0x74,0x72,0x65,0x61,0x6d,
-    0x53,0x74,0x61,0x72,0x74,0x54,0x69,0x6d,0x65,0x3d,0x6e,0x65,0x77,0x20,0x44,0x61,
-    0x74,0x65,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,
-    0x61,0x74,0x65,0x2e,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x63,0x6f,0x64,0x65,0x4c,
-    0x69,0x6e,0x65,0x73,0x3d,0x5b,0x5d,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,
-    0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,
-    0x63,0x6f,0x64,0x65,0x43,0x75,0x72,0x4c,0x69,0x6e,0x65,0x3d,0x30,0x2c,0x73,0x65,
-    0x74,0x53,0x74,0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x53,0x74,0x61,0x74,
-    0x65,0x28,0x21,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,
-    0x74,0x61,0x74,0x65,0x2e,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x63,0x6f,0x64,0x65,
-    0x52,0x65,0x74,0x72,0x79,0x43,0x6f,0x75,0x6e,0x74,0x3d,0x30,0x29,0x29,0x2c,0x73,
-    0x74,0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x53,0x68,0x6f,0x77,0x53,0x74,
-    0x61,0x74,0x75,0x73,0x28,0x22,0x53,0x74,0x72,0x65,0x61,0x6d,0x69,0x6e,0x67,0x20,
-    0x22,0x2b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,
-    0x74,0x65,0x2e,0x66,0x69,0x6c,0x65,0x54,0x6f,0x53,0x74,0x72,0x65,0x61,0x6d,0x2e,
-    0x6e,0x61,0x6d,0x65,0x29,0x2c,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,
-    0x65,0x52,0x65,0x61,0x64,0x46,0x69,0x6c,0x65,0x28,0x29,0x2e,0x74,0x68,0x65,0x6e,
-    0x28,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x4c,0x69,0x6e,0x65,
-    0x73,0x2c,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x52,0x65,0x61,
-    0x64,0x46,0x61,0x69,0x6c,0x65,0x64,0x29,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,
-    0x6f,0x6e,0x20,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x49,0x6d,
-    0x6d,0x65,0x64,0x69,0x61,0x74,0x65,0x28,0x65,0x2c,0x74,0x3d,0x21,0x30,0x29,0x7b,
-    0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,
-    0x2e,0x73,0x74,0x72,0x65,0x61,0x6d,0x69,0x6e,0x67,0x49,0x6e,0x50,0x72,0x6f,0x67,
-    0x72,0x65,0x73,0x73,0x3f,0x74,0x26,0x26,0x61,0x6c,0x65,0x72,0x74,0x28,0x22,0x55,
-    0x70,0x6c,0x6f,0x61,0x64,0x20,0x69,0x6e,0x20,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,
-    0x73,0x22,0x29,0x3a,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,
-    0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x74,0x72,0x65,0x61,0x6d,0x69,0x6e,0x67,0x49,
-    0x6e,0x50,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x3d,0x21,0x30,0x2c,0x73,0x74,0x72,
-    0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x4c,0x69,0x6e,0x65,0x73,0x28,0x65,0x29,
-    0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x74,0x72,0x65,0x61,
-    0x6d,0x47,0x43,0x6f,0x64,0x65,0x4c,0x69,0x6e,0x65,0x73,0x28,0x65,0x29,0x7b,0x77,
-    0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,
-    0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x63,0x6f,0x64,0x65,0x4c,0x69,0x6e,0x65,0x73,
-    0x3d,0x65,0x2e,0x74,0x6f,0x53,0x74,0x72,0x69,0x6e,0x67,0x28,0x29,0x2e,0x73,0x70,
-    0x6c,0x69,0x74,0x28,0x22,0x5c,0x6e,0x22,0x29,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,
-    0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x74,0x72,0x65,0x61,
-    0x6d,0x47,0x63,0x6f,0x64,0x65,0x43,0x75,0x72,0x4c,0x69,0x6e,0x65,0x3d,0x30,0x2c,
-    0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,
-    0x2e,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x63,0x6f,0x64,0x65,0x52,0x65,0x74,0x72,
-    0x79,0x43,0x6f,0x75,0x6e,0x74,0x3d,0x30,0x2c,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,
-    0x43,0x6f,0x64,0x65,0x53,0x65,0x6e,0x64,0x4e,0x65,0x78,0x74,0x43,0x68,0x75,0x6e,
-    0x6b,0x28,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x74,0x72,
-    0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x52,0x65,0x61,0x64,0x46,0x61,0x69,0x6c,
-    0x65,0x64,0x28,0x65,0x29,0x7b,0x73,0x65,0x74,0x53,0x74,0x72,0x65,0x61,0x6d,0x47,
-    0x43,0x6f,0x64,0x65,0x53,0x74,0x61,0x74,0x65,0x28,0x21,0x31,0x29,0x2c,0x73,0x74,
-    0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x53,0x68,0x6f,0x77,0x53,0x74,0x61,
-    0x74,0x75,0x73,0x28,0x22,0x46,0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,0x20,0x73,
-    0x74,0x72,0x65,0x61,0x6d,0x20,0x66,0x69,0x6c,0x65,0x22,0x2b,0x65,0x29,0x7d,0x66,
-    0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x67,0x43,0x6f,0x64,0x65,0x43,0x68,0x65,
-    0x63,0x6b,0x46,0x69,0x6c,0x65,0x56,0x61,0x6c,0x69,0x64,0x28,0x74,0x29,0x7b,0x66,
-    0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,0x65,0x3d,0x30,0x3b,0x65,0x3c,0x74,0x2e,0x6c,
-    0x65,0x6e,0x67,0x74,0x68,0x26,0x26,0x65,0x3c,0x31,0x65,0x33,0x3b,0x65,0x2b,0x2b,
-    0x29,0x69,0x66,0x28,0x31,0x32,0x37,0x3c,0x74,0x2e,0x63,0x68,0x61,0x72,0x43,0x6f,
-    0x64,0x65,0x41,0x74,0x28,0x65,0x29,0x29,0x72,0x65,0x74,0x75,0x72,0x6e,0x21,0x31,
-    0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x21,0x30,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,
-    0x6f,0x6e,0x20,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x52,0x65,
-    0x61,0x64,0x46,0x69,0x6c,0x65,0x28,0x29,0x7b,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
-    0x6e,0x65,0x77,0x20,0x50,0x72,0x6f,0x6d,0x69,0x73,0x65,0x28,0x66,0x75,0x6e,0x63,
-    0x74,0x69,0x6f,0x6e,0x28,0x74,0x2c,0x6e,0x29,0x7b,0x76,0x61,0x72,0x20,0x65,0x3d,
-    0x6e,0x65,0x77,0x20,0x46,0x69,0x6c,0x65,0x52,0x65,0x61,0x64,0x65,0x72,0x3b,0x65,
-    0x2e,0x6f,0x6e,0x6c,0x6f,0x61,0x64,0x3d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
-    0x28,0x65,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,
-    0x65,0x2e,0x74,0x61,0x72,0x67,0x65,0x74,0x29,0x2c,0x67,0x43,0x6f,0x64,0x65,0x43,
-    0x68,0x65,0x63,0x6b,0x46,0x69,0x6c,0x65,0x56,0x61,0x6c,0x69,0x64,0x28,0x65,0x2e,
-    0x74,0x61,0x72,0x67,0x65,0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x29,0x3f,0x74,
-    0x28,0x65,0x2e,0x74,0x61,0x72,0x67,0x65,0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,
-    0x29,0x3a,0x6e,0x28,0x6e,0x65,0x77,0x20,0x45,0x72,0x72,0x6f,0x72,0x28,0x22,0x46,
-    0x69,0x6c,0x65,0x20,0x69,0x73,0x6e,0x27,0x74,0x20,0x47,0x43,0x6f,0x64,0x65,0x22,
-    0x29,0x29,0x7d,0x2c,0x65,0x2e,0x6f,0x6e,0x65,0x72,0x72,0x6f,0x72,0x3d,0x66,0x75,
-    0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,0x29,0x7b,0x6e,0x28,0x65,0x29,0x7d,0x2c,
-    0x65,0x2e,0x72,0x65,0x61,0x64,0x41,0x73,0x54,0x65,0x78,0x74,0x28,0x77,0x69,0x6e,
-    0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x66,0x69,
-    0x6c,0x65,0x54,0x6f,0x53,0x74,0x72,0x65,0x61,0x6d,0x29,0x7d,0x29,0x7d,0x66,0x75,
-    0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x65,0x6e,0x64,0x4c,0x69,0x6e,0x65,0x4f,
-    0x66,0x47,0x43,0x6f,0x64,0x65,0x28,0x65,0x29,0x7b,0x72,0x65,0x74,0x75,0x72,0x6e,
-    0x20,0x6e,0x65,0x77,0x20,0x50,0x72,0x6f,0x6d,0x69,0x73,0x65,0x28,0x66,0x75,0x6e,
-    0x63,0x74,0x69,0x6f,0x6e,0x28,0x74,0x2c,0x6e,0x29,0x7b,0x6c,0x65,0x74,0x20,0x61,
-    0x3d,0x6e,0x65,0x77,0x20,0x58,0x4d,0x4c,0x48,0x74,0x74,0x70,0x52,0x65,0x71,0x75,
-    0x65,0x73,0x74,0x3b,0x61,0x2e,0x6f,0x6e,0x72,0x65,0x61,0x64,0x79,0x73,0x74,0x61,
-    0x74,0x65,0x63,0x68,0x61,0x6e,0x67,0x65,0x3d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,
-    0x6e,0x28,0x29,0x7b,0x76,0x61,0x72,0x20,0x65,0x3b,0x34,0x3d,0x3d,0x3d,0x61,0x2e,
-    0x72,0x65,0x61,0x64,0x79,0x53,0x74,0x61,0x74,0x65,0x26,0x26,0x28,0x32,0x30,0x30,
-    0x21,0x3d,0x3d,0x61,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x7c,0x7c,0x28,0x65,0x3d,
-    0x61,0x2e,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x29,0x2e,0x72,0x73,0x6c,0x74,
-    0x26,0x26,0x22,0x62,0x75,0x73,0x79,0x22,0x3d,0x3d,0x3d,0x65,0x2e,0x72,0x73,0x6c,
-    0x74,0x3f,0x6e,0x3a,0x74,0x29,0x28,0x61,0x29,0x7d,0x2c,0x61,0x2e,0x72,0x65,0x73,
-    0x70,0x6f,0x6e,0x73,0x65,0x54,0x79,0x70,0x65,0x3d,0x22,0x6a,0x73,0x6f,0x6e,0x22,
-    0x2c,0x61,0x2e,0x6f,0x70,0x65,0x6e,0x28,0x22,0x47,0x45,0x54,0x22,0x2c,0x22,0x2f,
-    0x65,0x78,0x65,0x63,0x2f,0x22,0x2b,0x65,0x2c,0x21,0x30,0x29,0x2c,0x61,0x2e,0x73,
-    0x65,0x6e,0x64,0x28,0x29,0x7d,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
-    0x20,0x67,0x43,0x6f,0x64,0x65,0x43,0x68,0x65,0x63,0x6b,0x4c,0x69,0x6e,0x65,0x56,
-    0x61,0x6c,0x69,0x64,0x28,0x65,0x29,0x7b,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x65,
-    0x3d,0x65,0x2e,0x74,0x72,0x69,0x6d,0x28,0x29,0x2c,0x2f,0x5e,0x5b,0x47,0x4d,0x5d,
-    0x2f,0x2e,0x74,0x65,0x73,0x74,0x28,0x65,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,
-    0x6f,0x6e,0x20,0x67,0x43,0x6f,0x64,0x65,0x53,0x74,0x72,0x69,0x70,0x43,0x6f,0x6d,
-    0x6d,0x65,0x6e,0x74,0x73,0x28,0x65,0x29,0x7b,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
-    0x65,0x3d,0x28,0x65,0x3d,0x65,0x2e,0x74,0x72,0x69,0x6d,0x28,0x29,0x29,0x2e,0x72,
-    0x65,0x70,0x6c,0x61,0x63,0x65,0x28,0x2f,0x28,0x5c,0x28,0x2e,0x2a,0x3f,0x5c,0x29,
-    0x29,0x2f,0x2c,0x22,0x22,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,
-    0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x53,0x65,0x6e,0x64,0x4e,
-    0x65,0x78,0x74,0x43,0x68,0x75,0x6e,0x6b,0x28,0x29,0x7b,0x69,0x66,0x28,0x77,0x69,
-    0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,
-    0x74,0x72,0x65,0x61,0x6d,0x69,0x6e,0x67,0x49,0x6e,0x50,0x72,0x6f,0x67,0x72,0x65,
-    0x73,0x73,0x29,0x7b,0x66,0x6f,0x72,0x28,0x3b,0x3b,0x29,0x7b,0x69,0x66,0x28,0x67,
-    0x43,0x6f,0x64,0x65,0x43,0x68,0x65,0x63,0x6b,0x4c,0x69,0x6e,0x65,0x56,0x61,0x6c,
-    0x69,0x64,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,
-    0x61,0x74,0x65,0x2e,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x63,0x6f,0x64,0x65,0x4c,
-    0x69,0x6e,0x65,0x73,0x5b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,
-    0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x63,0x6f,0x64,
-    0x65,0x43,0x75,0x72,0x4c,0x69,0x6e,0x65,0x5d,0x29,0x29,0x62,0x72,0x65,0x61,0x6b,
-    0x3b,0x69,0x66,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,
-    0x74,0x61,0x74,0x65,0x2e,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x63,0x6f,0x64,0x65,
-    0x43,0x75,0x72,0x4c,0x69,0x6e,0x65,0x2b,0x3d,0x31,0x2c,0x77,0x69,0x6e,0x64,0x6f,
-    0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x74,0x72,0x65,
-    0x61,0x6d,0x47,0x63,0x6f,0x64,0x65,0x43,0x75,0x72,0x4c,0x69,0x6e,0x65,0x3e,0x3d,
-    0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,
-    0x2e,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x63,0x6f,0x64,0x65,0x4c,0x69,0x6e,0x65,
-    0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x29,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
-    0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x53,0x74,0x72,
-    0x65,0x61,0x6d,0x69,0x6e,0x67,0x20,0x63,0x6f,0x6d,0x70,0x6c,0x65,0x74,0x65,0x22,
-    0x29,0x2c,0x73,0x65,0x74,0x53,0x74,0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,
-    0x53,0x74,0x61,0x74,0x65,0x28,0x21,0x31,0x29,0x2c,0x76,0x6f,0x69,0x64,0x20,0x73,
-    0x74,0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x53,0x68,0x6f,0x77,0x53,0x74,
-    0x61,0x74,0x75,0x73,0x28,0x22,0x22,0x29,0x7d,0x73,0x65,0x6e,0x64,0x4c,0x69,0x6e,
-    0x65,0x4f,0x66,0x47,0x43,0x6f,0x64,0x65,0x28,0x67,0x43,0x6f,0x64,0x65,0x53,0x74,
-    0x72,0x69,0x70,0x43,0x6f,0x6d,0x6d,0x65,0x6e,0x74,0x73,0x28,0x77,0x69,0x6e,0x64,
-    0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x74,0x72,
-    0x65,0x61,0x6d,0x47,0x63,0x6f,0x64,0x65,0x4c,0x69,0x6e,0x65,0x73,0x5b,0x77,0x69,
-    0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,
-    0x74,0x72,0x65,0x61,0x6d,0x47,0x63,0x6f,0x64,0x65,0x43,0x75,0x72,0x4c,0x69,0x6e,
-    0x65,0x5d,0x29,0x29,0x2e,0x74,0x68,0x65,0x6e,0x28,0x73,0x74,0x72,0x65,0x61,0x6d,
-    0x47,0x43,0x6f,0x64,0x65,0x4d,0x6f,0x76,0x65,0x4e,0x65,0x78,0x74,0x2c,0x73,0x74,
-    0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x52,0x65,0x74,0x72,0x79,0x29,0x7d,
-    0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x74,0x72,0x65,0x61,0x6d,
-    0x47,0x43,0x6f,0x64,0x65,0x4d,0x6f,0x76,0x65,0x4e,0x65,0x78,0x74,0x28,0x29,0x7b,
-    0x66,0x6f,0x72,0x28,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,
-    0x22,0x53,0x65,0x6e,0x74,0x20,0x6c,0x69,0x6e,0x65,0x20,0x22,0x2b,0x77,0x69,0x6e,
-    0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x74,
-    0x72,0x65,0x61,0x6d,0x47,0x63,0x6f,0x64,0x65,0x43,0x75,0x72,0x4c,0x69,0x6e,0x65,
-    0x2b,0x22,0x2e,0x2e,0x2e,0x20,0x22,0x2b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,
-    0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,
-    0x63,0x6f,0x64,0x65,0x4c,0x69,0x6e,0x65,0x73,0x5b,0x77,0x69,0x6e,0x64,0x6f,0x77,
-    0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x74,0x72,0x65,0x61,
-    0x6d,0x47,0x63,0x6f,0x64,0x65,0x43,0x75,0x72,0x4c,0x69,0x6e,0x65,0x5d,0x29,0x2c,
-    0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,
-    0x2e,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x63,0x6f,0x64,0x65,0x52,0x65,0x74,0x72,
-    0x79,0x43,0x6f,0x75,0x6e,0x74,0x3d,0x30,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,
-    0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x74,0x72,0x65,0x61,0x6d,
-    0x47,0x63,0x6f,0x64,0x65,0x43,0x75,0x72,0x4c,0x69,0x6e,0x65,0x2b,0x3d,0x31,0x3b,
-    0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,
-    0x2e,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x63,0x6f,0x64,0x65,0x43,0x75,0x72,0x4c,
-    0x69,0x6e,0x65,0x3c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,
-    0x74,0x61,0x74,0x65,0x2e,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x63,0x6f,0x64,0x65,
-    0x4c,0x69,0x6e,0x65,0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x29,0x7b,0x69,
-    0x66,0x28,0x30,0x21,0x3d,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,
-    0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x63,0x6f,
-    0x64,0x65,0x4c,0x69,0x6e,0x65,0x73,0x5b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,
-    0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,
-    0x63,0x6f,0x64,0x65,0x43,0x75,0x72,0x4c,0x69,0x6e,0x65,0x5d,0x2e,0x74,0x72,0x69,
-    0x6d,0x28,0x29,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x29,0x72,0x65,0x74,0x75,0x72,
-    0x6e,0x20,0x76,0x6f,0x69,0x64,0x20,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,
-    0x64,0x65,0x53,0x65,0x6e,0x64,0x4e,0x65,0x78,0x74,0x43,0x68,0x75,0x6e,0x6b,0x28,
-    0x29,0x3b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,
-    0x74,0x65,0x2e,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x63,0x6f,0x64,0x65,0x43,0x75,
-    0x72,0x4c,0x69,0x6e,0x65,0x2b,0x3d,0x31,0x7d,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,
-    0x2e,0x6c,0x6f,0x67,0x28,0x22,0x53,0x74,0x72,0x65,0x61,0x6d,0x69,0x6e,0x67,0x20,
-    0x63,0x6f,0x6d,0x70,0x6c,0x65,0x74,0x65,0x22,0x29,0x2c,0x73,0x65,0x74,0x53,0x74,
-    0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x53,0x74,0x61,0x74,0x65,0x28,0x21,
-    0x31,0x29,0x2c,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x53,0x68,
-    0x6f,0x77,0x53,0x74,0x61,0x74,0x75,0x73,0x28,0x22,0x22,0x29,0x7d,0x66,0x75,0x6e,
-    0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,
-    0x65,0x52,0x65,0x74,0x72,0x79,0x28,0x65,0x29,0x7b,0x69,0x66,0x28,0x77,0x69,0x6e,
-    0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x74,
-    0x72,0x65,0x61,0x6d,0x47,0x63,0x6f,0x64,0x65,0x52,0x65,0x74,0x72,0x79,0x43,0x6f,
-    0x75,0x6e,0x74,0x2b,0x3d,0x31,0x2c,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,
-    0x6f,0x67,0x28,0x22,0x46,0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,0x20,0x73,0x65,
-    0x6e,0x64,0x2c,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x20,0x22,0x2b,0x65,0x2e,
-    0x73,0x74,0x61,0x74,0x75,0x73,0x2e,0x74,0x6f,0x53,0x74,0x72,0x69,0x6e,0x67,0x28,
-    0x29,0x2b,0x22,0x2e,0x2e,0x2e,0x20,0x22,0x2b,0x65,0x2e,0x72,0x65,0x73,0x70,0x6f,
-    0x6e,0x73,0x65,0x29,0x2c,0x32,0x31,0x38,0x3d,0x3d,0x3d,0x65,0x2e,0x73,0x74,0x61,
-    0x74,0x75,0x73,0x7c,0x7c,0x35,0x30,0x33,0x3d,0x3d,0x3d,0x65,0x2e,0x73,0x74,0x61,
-    0x74,0x75,0x73,0x7c,0x7c,0x32,0x30,0x30,0x3d,0x3d,0x3d,0x65,0x2e,0x73,0x74,0x61,
-    0x74,0x75,0x73,0x26,0x26,0x22,0x62,0x75,0x73,0x79,0x22,0x3d,0x3d,0x3d,0x65,0x2e,
-    0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x2e,0x72,0x73,0x6c,0x74,0x29,0x7b,0x69,
-    0x66,0x28,0x21,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,
-    0x74,0x61,0x74,0x65,0x2e,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x63,0x6f,0x64,0x65,
-    0x52,0x65,0x74,0x72,0x79,0x43,0x6f,0x75,0x6e,0x74,0x3e,0x77,0x69,0x6e,0x64,0x6f,
-    0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x4d,0x41,0x58,0x5f,
-    0x53,0x54,0x52,0x45,0x41,0x4d,0x49,0x4e,0x47,0x5f,0x52,0x45,0x54,0x52,0x49,0x45,
-    0x53,0x29,0x29,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x6f,0x69,0x64,0x28,0x77,
-    0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,
-    0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x52,0x65,0x74,0x72,0x79,
-    0x54,0x69,0x6d,0x65,0x72,0x3d,0x73,0x65,0x74,0x54,0x69,0x6d,0x65,0x6f,0x75,0x74,
-    0x28,0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x53,0x65,0x6e,0x64,
-    0x4e,0x65,0x78,0x74,0x43,0x68,0x75,0x6e,0x6b,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,
-    0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x53,0x54,0x52,0x45,0x41,
-    0x4d,0x49,0x4e,0x47,0x5f,0x52,0x45,0x54,0x52,0x59,0x5f,0x54,0x49,0x4d,0x45,0x5f,
-    0x4d,0x53,0x29,0x29,0x3b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,
-    0x28,0x22,0x46,0x61,0x69,0x6c,0x65,0x64,0x20,0x61,0x66,0x74,0x65,0x72,0x20,0x22,
-    0x2b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,
-    0x65,0x2e,0x4d,0x41,0x58,0x5f,0x53,0x54,0x52,0x45,0x41,0x4d,0x49,0x4e,0x47,0x5f,
-    0x52,0x45,0x54,0x52,0x49,0x45,0x53,0x2b,0x22,0x20,0x72,0x65,0x74,0x72,0x69,0x65,
-    0x73,0x22,0x29,0x7d,0x65,0x6c,0x73,0x65,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,
-    0x2e,0x6c,0x6f,0x67,0x28,0x22,0x53,0x74,0x72,0x65,0x61,0x6d,0x69,0x6e,0x67,0x20,
-    0x66,0x61,0x69,0x6c,0x65,0x64,0x2c,0x20,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,
-    0x20,0x22,0x2b,0x65,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x2e,0x74,0x6f,0x53,0x74,
-    0x72,0x69,0x6e,0x67,0x28,0x29,0x29,0x3b,0x73,0x65,0x74,0x53,0x74,0x72,0x65,0x61,
-    0x6d,0x47,0x43,0x6f,0x64,0x65,0x53,0x74,0x61,0x74,0x65,0x28,0x21,0x31,0x29,0x2c,
-    0x73,0x74,0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x53,0x68,0x6f,0x77,0x53,
-    0x74,0x61,0x74,0x75,0x73,0x28,0x22,0x53,0x74,0x72,0x65,0x61,0x6d,0x69,0x6e,0x67,
-    0x20,0x66,0x61,0x69,0x6c,0x65,0x64,0x22,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,
-    0x6f,0x6e,0x20,0x67,0x63,0x6f,0x64,0x65,0x49,0x6e,0x70,0x75,0x74,0x4b,0x65,0x79,
-    0x50,0x72,0x65,0x73,0x73,0x28,0x65,0x29,0x7b,0x72,0x65,0x74,0x75,0x72,0x6e,0x21,
-    0x28,0x65,0x2e,0x77,0x68,0x69,0x63,0x68,0x26,0x26,0x31,0x33,0x3d,0x3d,0x65,0x2e,
-    0x77,0x68,0x69,0x63,0x68,0x7c,0x7c,0x65,0x2e,0x6b,0x65,0x79,0x43,0x6f,0x64,0x65,
-    0x26,0x26,0x31,0x33,0x3d,0x3d,0x65,0x2e,0x6b,0x65,0x79,0x43,0x6f,0x64,0x65,0x29,
-    0x7c,0x7c,0x28,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,
-    0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x67,0x63,0x6f,0x64,
-    0x65,0x53,0x65,0x6e,0x64,0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0x29,0x2e,0x63,0x6c,
-    0x69,0x63,0x6b,0x28,0x29,0x2c,0x21,0x31,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,
-    0x6f,0x6e,0x20,0x66,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x55,0x70,0x64,0x61,0x74,
-    0x65,0x28,0x29,0x7b,0x63,0x61,0x6c,0x6c,0x41,0x6a,0x61,0x78,0x28,0x22,0x2f,0x66,
-    0x69,0x6c,0x65,0x6c,0x69,0x73,0x74,0x2f,0x22,0x2c,0x66,0x69,0x6c,0x65,0x4c,0x69,
-    0x73,0x74,0x55,0x70,0x64,0x61,0x74,0x65,0x4f,0x6b,0x2c,0x66,0x69,0x6c,0x65,0x4c,
-    0x69,0x73,0x74,0x55,0x70,0x64,0x61,0x74,0x65,0x46,0x61,0x69,0x6c,0x29,0x7d,0x66,
-    0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x66,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,
-    0x55,0x70,0x64,0x61,0x74,0x65,0x46,0x61,0x69,0x6c,0x28,0x29,0x7b,0x7d,0x66,0x75,
-    0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x66,0x69,0x6c,0x65,0x53,0x69,0x7a,0x65,0x53,
-    0x49,0x28,0x65,0x29,0x7b,0x76,0x61,0x72,0x20,0x74,0x3d,0x4d,0x61,0x74,0x68,0x2e,
-    0x6c,0x6f,0x67,0x28,0x65,0x29,0x2f,0x4d,0x61,0x74,0x68,0x2e,0x6c,0x6f,0x67,0x28,
-    0x31,0x65,0x33,0x29,0x7c,0x30,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x2b,0x28,0x65,
-    0x2f,0x4d,0x61,0x74,0x68,0x2e,0x70,0x6f,0x77,0x28,0x31,0x65,0x33,0x2c,0x74,0x29,
-    0x29,0x2e,0x74,0x6f,0x46,0x69,0x78,0x65,0x64,0x28,0x32,0x29,0x2b,0x22,0x20,0x22,
-    0x2b,0x28,0x22,0x6b,0x4d,0x47,0x54,0x50,0x45,0x5a,0x59,0x22,0x5b,0x74,0x2d,0x31,
-    0x5d,0x7c,0x7c,0x22,0x22,0x29,0x2b,0x22,0x42,0x22,0x7d,0x66,0x75,0x6e,0x63,0x74,
-    0x69,0x6f,0x6e,0x20,0x66,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x55,0x70,0x64,0x61,
-    0x74,0x65,0x4f,0x6b,0x28,0x65,0x29,0x7b,0x76,0x61,0x72,0x20,0x74,0x2c,0x6e,0x3d,
-    0x4a,0x53,0x4f,0x4e,0x2e,0x70,0x61,0x72,0x73,0x65,0x28,0x65,0x29,0x2c,0x61,0x3d,
-    0x28,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,
-    0x74,0x65,0x2e,0x6c,0x61,0x74,0x65,0x73,0x74,0x66,0x69,0x6c,0x65,0x4c,0x69,0x73,
-    0x74,0x49,0x6e,0x66,0x6f,0x3d,0x6e,0x29,0x2e,0x68,0x61,0x73,0x4f,0x77,0x6e,0x50,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,0x22,0x66,0x73,0x42,0x61,0x73,0x65,0x22,
-    0x29,0x26,0x26,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,
-    0x74,0x61,0x74,0x65,0x2e,0x66,0x69,0x6c,0x65,0x53,0x79,0x73,0x74,0x65,0x6d,0x42,
-    0x61,0x73,0x65,0x50,0x61,0x74,0x68,0x3d,0x6e,0x2e,0x66,0x73,0x42,0x61,0x73,0x65,
-    0x29,0x2c,0x6e,0x2e,0x68,0x61,0x73,0x4f,0x77,0x6e,0x50,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x28,0x22,0x64,0x69,0x73,0x6b,0x53,0x69,0x7a,0x65,0x22,0x29,0x26,0x26,
-    0x28,0x65,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,
-    0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x66,0x69,0x6c,0x65,
-    0x2d,0x73,0x79,0x73,0x74,0x65,0x6d,0x2d,0x69,0x6e,0x66,0x6f,0x22,0x29,0x2c,0x74,
-    0x3d,0x22,0x3c,0x62,0x3e,0x44,0x69,0x73,0x6b,0x20,0x53,0x69,0x7a,0x65,0x3a,0x3c,
-    0x2f,0x62,0x3e,0x20,0x22,0x2b,0x66,0x69,0x6c,0x65,0x53,0x69,0x7a,0x65,0x53,0x49,
-    0x28,0x6e,0x2e,0x64,0x69,0x73,0x6b,0x53,0x69,0x7a,0x65,0x29,0x2b,0x22,0x2c,0x20,
-    0x3c,0x62,0x3e,0x46,0x72,0x65,0x65,0x20,0x42,0x79,0x74,0x65,0x73,0x3a,0x3c,0x2f,
-    0x62,0x3e,0x20,0x22,0x2b,0x66,0x69,0x6c,0x65,0x53,0x69,0x7a,0x65,0x53,0x49,0x28,
-    0x6e,0x2e,0x64,0x69,0x73,0x6b,0x53,0x69,0x7a,0x65,0x2d,0x6e,0x2e,0x64,0x69,0x73,
-    0x6b,0x55,0x73,0x65,0x64,0x29,0x2c,0x65,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,
-    0x4d,0x4c,0x3d,0x74,0x29,0x2c,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,
-    0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x74,
-    0x61,0x62,0x6c,0x65,0x5f,0x66,0x69,0x6c,0x65,0x73,0x22,0x29,0x29,0x3b,0x66,0x6f,
-    0x72,0x28,0x6c,0x65,0x74,0x20,0x65,0x3d,0x61,0x2e,0x72,0x6f,0x77,0x73,0x2e,0x6c,
-    0x65,0x6e,0x67,0x74,0x68,0x2d,0x31,0x3b,0x30,0x3c,0x65,0x3b,0x65,0x2d,0x2d,0x29,
-    0x61,0x2e,0x64,0x65,0x6c,0x65,0x74,0x65,0x52,0x6f,0x77,0x28,0x65,0x29,0x3b,0x66,
-    0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,0x74,0x3d,0x30,0x3b,0x74,0x3c,0x6e,0x2e,0x66,
-    0x69,0x6c,0x65,0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x74,0x2b,0x2b,0x29,
-    0x7b,0x6c,0x65,0x74,0x20,0x65,0x3d,0x6e,0x2e,0x66,0x69,0x6c,0x65,0x73,0x5b,0x74,
-    0x5d,0x2e,0x6e,0x61,0x6d,0x65,0x3b,0x65,0x3d,0x65,0x2e,0x72,0x65,0x70,0x6c,0x61,
-    0x63,0x65,0x28,0x22,0x2f,0x22,0x2c,0x22,0x22,0x29,0x3b,0x76,0x61,0x72,0x20,0x6f,
-    0x3d,0x6e,0x2e,0x66,0x69,0x6c,0x65,0x73,0x5b,0x74,0x5d,0x2e,0x73,0x69,0x7a,0x65,
-    0x2c,0x73,0x3d,0x27,0x3c,0x74,0x72,0x20,0x64,0x61,0x74,0x61,0x2d,0x66,0x69,0x6c,
-    0x65,0x3d,0x22,0x27,0x2b,0x65,0x2b,0x27,0x22,0x3e,0x27,0x2c,0x73,0x3d,0x28,0x73,
-    0x3d,0x28,0x73,0x3d,0x28,0x73,0x3d,0x28,0x73,0x3d,0x28,0x73,0x3d,0x28,0x73,0x2b,
-    0x3d,0x27,0x3c,0x74,0x64,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x66,0x69,0x6c,0x65,
-    0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x22,0x3e,0x27,0x29,0x2b,0x28,0x27,0x3c,
-    0x61,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,
-    0x2d,0x66,0x69,0x6c,0x65,0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x20,0x6f,0x6e,0x63,
-    0x6c,0x69,0x63,0x6b,0x3d,0x22,0x64,0x65,0x6c,0x65,0x74,0x65,0x46,0x69,0x6c,0x65,
-    0x28,0x5c,0x27,0x27,0x2b,0x65,0x2b,0x22,0x27,0x29,0x5c,0x22,0x3e,0x22,0x29,0x29,
-    0x2b,0x27,0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,
-    0x6f,0x6e,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x3c,0x75,0x73,0x65,0x20,
-    0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,
-    0x2d,0x64,0x65,0x6c,0x65,0x74,0x65,0x22,0x3e,0x3c,0x2f,0x75,0x73,0x65,0x3e,0x3c,
-    0x2f,0x73,0x76,0x67,0x3e,0x27,0x2b,0x22,0x3c,0x2f,0x61,0x3e,0x22,0x29,0x2b,0x28,
-    0x27,0x3c,0x61,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,
-    0x74,0x6e,0x2d,0x66,0x69,0x6c,0x65,0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x20,0x6f,
-    0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x70,0x6c,0x61,0x79,0x46,0x69,0x6c,0x65,
-    0x28,0x5c,0x27,0x27,0x2b,0x65,0x2b,0x22,0x27,0x29,0x5c,0x22,0x3e,0x22,0x29,0x2b,
-    0x27,0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,
-    0x6e,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x3c,0x75,0x73,0x65,0x20,0x78,
-    0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,
-    0x70,0x6c,0x61,0x79,0x22,0x3e,0x3c,0x2f,0x75,0x73,0x65,0x3e,0x3c,0x2f,0x73,0x76,
-    0x67,0x3e,0x27,0x29,0x2b,0x22,0x3c,0x2f,0x61,0x3e,0x22,0x2b,0x22,0x3c,0x2f,0x74,
-    0x64,0x3e,0x22,0x29,0x2b,0x28,0x27,0x3c,0x74,0x64,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x22,0x66,0x69,0x6c,0x65,0x2d,0x6e,0x61,0x6d,0x65,0x22,0x3e,0x27,0x2b,0x65,
-    0x2b,0x22,0x3c,0x2f,0x74,0x64,0x3e,0x22,0x29,0x29,0x2b,0x28,0x27,0x3c,0x74,0x64,
-    0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x66,0x69,0x6c,0x65,0x2d,0x73,0x69,0x7a,
-    0x65,0x20,0x68,0x69,0x64,0x64,0x65,0x6e,0x2d,0x78,0x73,0x22,0x3e,0x27,0x2b,0x66,
-    0x69,0x6c,0x65,0x53,0x69,0x7a,0x65,0x53,0x49,0x28,0x6f,0x29,0x2b,0x22,0x3c,0x2f,
-    0x74,0x64,0x3e,0x22,0x29,0x2b,0x22,0x3c,0x2f,0x74,0x72,0x3e,0x22,0x3b,0x61,0x2e,
-    0x69,0x6e,0x73,0x65,0x72,0x74,0x52,0x6f,0x77,0x28,0x61,0x2e,0x72,0x6f,0x77,0x73,
-    0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,
-    0x4d,0x4c,0x3d,0x73,0x7d,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x64,
-    0x65,0x6c,0x65,0x74,0x65,0x46,0x69,0x6c,0x65,0x28,0x65,0x29,0x7b,0x63,0x61,0x6c,
-    0x6c,0x41,0x6a,0x61,0x78,0x28,0x22,0x2f,0x64,0x65,0x6c,0x65,0x74,0x65,0x46,0x69,
-    0x6c,0x65,0x22,0x2b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,
-    0x74,0x61,0x74,0x65,0x2e,0x66,0x69,0x6c,0x65,0x53,0x79,0x73,0x74,0x65,0x6d,0x42,
-    0x61,0x73,0x65,0x50,0x61,0x74,0x68,0x2b,0x22,0x2f,0x22,0x2b,0x65,0x29,0x2c,0x66,
-    0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x55,0x70,0x64,0x61,0x74,0x65,0x28,0x29,0x7d,
-    0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x70,0x6c,0x61,0x79,0x46,0x69,0x6c,
-    0x65,0x28,0x65,0x29,0x7b,0x63,0x61,0x6c,0x6c,0x41,0x6a,0x61,0x78,0x28,0x22,0x2f,
-    0x70,0x6c,0x61,0x79,0x46,0x69,0x6c,0x65,0x22,0x2b,0x77,0x69,0x6e,0x64,0x6f,0x77,
-    0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x66,0x69,0x6c,0x65,0x53,
-    0x79,0x73,0x74,0x65,0x6d,0x42,0x61,0x73,0x65,0x50,0x61,0x74,0x68,0x2b,0x22,0x2f,
-    0x22,0x2b,0x65,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x62,0x74,
-    0x6e,0x55,0x70,0x6c,0x6f,0x61,0x64,0x54,0x6f,0x46,0x69,0x6c,0x65,0x53,0x79,0x73,
-    0x74,0x65,0x6d,0x28,0x65,0x29,0x7b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,
-    0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x74,0x72,0x65,0x61,0x6d,0x69,0x6e,
-    0x67,0x49,0x6e,0x50,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x3f,0x61,0x6c,0x65,0x72,
-    0x74,0x28,0x22,0x55,0x70,0x6c,0x6f,0x61,0x64,0x20,0x69,0x6e,0x20,0x70,0x72,0x6f,
-    0x67,0x72,0x65,0x73,0x73,0x22,0x29,0x3a,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,
-    0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x66,0x69,0x6c,0x65,0x44,0x69,
-    0x61,0x6c,0x6f,0x67,0x54,0x79,0x70,0x65,0x3d,0x22,0x66,0x69,0x6c,0x65,0x73,0x79,
-    0x73,0x74,0x65,0x6d,0x22,0x2c,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,
-    0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x69,
-    0x6e,0x70,0x75,0x74,0x5f,0x66,0x69,0x6c,0x65,0x5f,0x75,0x70,0x6c,0x6f,0x61,0x64,
-    0x22,0x29,0x2e,0x63,0x6c,0x69,0x63,0x6b,0x28,0x29,0x2c,0x65,0x2e,0x70,0x72,0x65,
-    0x76,0x65,0x6e,0x74,0x44,0x65,0x66,0x61,0x75,0x6c,0x74,0x28,0x29,0x29,0x7d,0x66,
-    0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,
-    0x7a,0x65,0x50,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x28,0x74,0x2c,0x65,0x29,0x7b,
-    0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,
-    0x2e,0x75,0x70,0x6c,0x6f,0x61,0x64,0x50,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x3d,
-    0x5b,0x5d,0x3b,0x65,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,
-    0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x65,0x29,0x3b,
-    0x65,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3d,0x30,0x3b,0x66,0x6f,0x72,0x28,0x6c,0x65,
-    0x74,0x20,0x65,0x3d,0x74,0x3b,0x30,0x3c,0x65,0x3b,0x65,0x2d,0x2d,0x29,0x77,0x69,
-    0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x75,
-    0x70,0x6c,0x6f,0x61,0x64,0x50,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x2e,0x70,0x75,
-    0x73,0x68,0x28,0x30,0x29,0x3b,0x65,0x2e,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3d,
-    0x22,0x62,0x6c,0x6f,0x63,0x6b,0x22,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
-    0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x50,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x28,
-    0x65,0x2c,0x74,0x2c,0x6e,0x29,0x7b,0x6c,0x65,0x74,0x20,0x61,0x3d,0x64,0x6f,0x63,
-    0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,
-    0x42,0x79,0x49,0x64,0x28,0x6e,0x29,0x3b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,
-    0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x75,0x70,0x6c,0x6f,0x61,0x64,0x50,
-    0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x5b,0x65,0x5d,0x3d,0x74,0x3b,0x6e,0x3d,0x77,
-    0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,
-    0x75,0x70,0x6c,0x6f,0x61,0x64,0x50,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x2e,0x72,
-    0x65,0x64,0x75,0x63,0x65,0x28,0x28,0x65,0x2c,0x74,0x29,0x3d,0x3e,0x65,0x2b,0x74,
-    0x2c,0x30,0x29,0x2f,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,
-    0x74,0x61,0x74,0x65,0x2e,0x75,0x70,0x6c,0x6f,0x61,0x64,0x50,0x72,0x6f,0x67,0x72,
-    0x65,0x73,0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x61,0x2e,0x76,0x61,0x6c,
-    0x75,0x65,0x3d,0x6e,0x2c,0x39,0x39,0x2e,0x39,0x39,0x3c,0x61,0x2e,0x76,0x61,0x6c,
-    0x75,0x65,0x26,0x26,0x73,0x65,0x74,0x54,0x69,0x6d,0x65,0x6f,0x75,0x74,0x28,0x66,
-    0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x7b,0x61,0x2e,0x64,0x69,0x73,0x70,
-    0x6c,0x61,0x79,0x3d,0x22,0x6e,0x6f,0x6e,0x65,0x22,0x7d,0x2c,0x33,0x65,0x33,0x29,
-    0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x74,0x61,0x72,0x74,0x46,
-    0x69,0x6c,0x65,0x53,0x79,0x73,0x74,0x65,0x6d,0x55,0x70,0x6c,0x6f,0x61,0x64,0x28,
-    0x74,0x29,0x7b,0x69,0x66,0x28,0x21,0x28,0x28,0x74,0x3d,0x5b,0x2e,0x2e,0x2e,0x74,
-    0x5d,0x29,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3c,0x3d,0x30,0x29,0x29,0x7b,0x66,
-    0x69,0x72,0x73,0x74,0x46,0x69,0x6c,0x65,0x3d,0x74,0x5b,0x30,0x5d,0x3b,0x6c,0x65,
-    0x74,0x20,0x65,0x3d,0x30,0x3b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,
-    0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x68,0x61,0x73,0x4f,0x77,0x6e,0x50,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x28,0x22,0x6c,0x61,0x74,0x65,0x73,0x74,0x66,0x69,0x6c,
-    0x65,0x4c,0x69,0x73,0x74,0x49,0x6e,0x66,0x6f,0x22,0x29,0x26,0x26,0x77,0x69,0x6e,
-    0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x6c,0x61,
-    0x74,0x65,0x73,0x74,0x66,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x49,0x6e,0x66,0x6f,
-    0x2e,0x68,0x61,0x73,0x4f,0x77,0x6e,0x50,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,
-    0x22,0x64,0x69,0x73,0x6b,0x53,0x69,0x7a,0x65,0x22,0x29,0x26,0x26,0x77,0x69,0x6e,
-    0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x6c,0x61,
-    0x74,0x65,0x73,0x74,0x66,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x49,0x6e,0x66,0x6f,
-    0x2e,0x68,0x61,0x73,0x4f,0x77,0x6e,0x50,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,
-    0x22,0x64,0x69,0x73,0x6b,0x55,0x73,0x65,0x64,0x22,0x29,0x26,0x26,0x28,0x65,0x3d,
-    0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,
-    0x2e,0x6c,0x61,0x74,0x65,0x73,0x74,0x66,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x49,
-    0x6e,0x66,0x6f,0x2e,0x64,0x69,0x73,0x6b,0x53,0x69,0x7a,0x65,0x2d,0x77,0x69,0x6e,
-    0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x6c,0x61,
-    0x74,0x65,0x73,0x74,0x66,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x49,0x6e,0x66,0x6f,
-    0x2e,0x64,0x69,0x73,0x6b,0x55,0x73,0x65,0x64,0x29,0x2c,0x66,0x69,0x72,0x73,0x74,
-    0x46,0x69,0x6c,0x65,0x2e,0x73,0x69,0x7a,0x65,0x2b,0x31,0x65,0x33,0x3e,0x65,0x3f,
-    0x61,0x6c,0x65,0x72,0x74,0x28,0x22,0x46,0x69,0x6c,0x65,0x20,0x69,0x73,0x20,0x74,
-    0x6f,0x6f,0x20,0x62,0x69,0x67,0x20,0x66,0x6f,0x72,0x20,0x73,0x74,0x6f,0x72,0x61,
-    0x67,0x65,0x20,0x61,0x76,0x61,0x69,0x6c,0x61,0x62,0x6c,0x65,0x22,0x29,0x3a,0x28,
-    0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,0x50,0x72,0x6f,0x67,0x72,0x65,
-    0x73,0x73,0x28,0x74,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x2c,0x22,0x70,0x72,0x6f,
-    0x67,0x72,0x65,0x73,0x73,0x2d,0x62,0x61,0x72,0x2d,0x66,0x69,0x6c,0x65,0x22,0x29,
-    0x2c,0x74,0x2e,0x66,0x6f,0x72,0x45,0x61,0x63,0x68,0x28,0x75,0x70,0x6c,0x6f,0x61,
-    0x64,0x4f,0x6e,0x6c,0x79,0x46,0x69,0x6c,0x65,0x29,0x29,0x7d,0x7d,0x66,0x75,0x6e,
-    0x63,0x74,0x69,0x6f,0x6e,0x20,0x75,0x70,0x6c,0x6f,0x61,0x64,0x4f,0x6e,0x6c,0x79,
-    0x46,0x69,0x6c,0x65,0x28,0x65,0x2c,0x74,0x29,0x7b,0x75,0x70,0x6c,0x6f,0x61,0x64,
-    0x46,0x69,0x6c,0x65,0x53,0x70,0x65,0x63,0x55,0x72,0x6c,0x28,0x22,0x2f,0x75,0x70,
-    0x6c,0x6f,0x61,0x64,0x74,0x6f,0x66,0x69,0x6c,0x65,0x6d,0x61,0x6e,0x22,0x2c,0x22,
-    0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x2d,0x62,0x61,0x72,0x2d,0x66,0x69,0x6c,
-    0x65,0x22,0x2c,0x65,0x2c,0x74,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
-    0x20,0x75,0x70,0x6c,0x6f,0x61,0x64,0x41,0x6e,0x64,0x52,0x75,0x6e,0x46,0x69,0x6c,
-    0x65,0x28,0x65,0x2c,0x74,0x29,0x7b,0x75,0x70,0x6c,0x6f,0x61,0x64,0x46,0x69,0x6c,
-    0x65,0x53,0x70,0x65,0x63,0x55,0x72,0x6c,0x28,0x22,0x2f,0x75,0x70,0x6c,0x6f,0x61,
-    0x64,0x61,0x6e,0x64,0x72,0x75,0x6e,0x22,0x2c,0x22,0x70,0x72,0x6f,0x67,0x72,0x65,
-    0x73,0x73,0x2d,0x62,0x61,0x72,0x2d,0x66,0x69,0x6c,0x65,0x22,0x2c,0x65,0x2c,0x74,
-    0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x75,0x70,0x6c,0x6f,0x61,
-    0x64,0x46,0x69,0x6c,0x65,0x53,0x70,0x65,0x63,0x55,0x72,0x6c,0x28,0x65,0x2c,0x74,
-    0x2c,0x6e,0x2c,0x61,0x29,0x7b,0x76,0x61,0x72,0x20,0x6f,0x3d,0x6e,0x65,0x77,0x20,
-    0x58,0x4d,0x4c,0x48,0x74,0x74,0x70,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x2c,0x73,
-    0x3d,0x6e,0x65,0x77,0x20,0x46,0x6f,0x72,0x6d,0x44,0x61,0x74,0x61,0x3b,0x6f,0x2e,
-    0x6f,0x70,0x65,0x6e,0x28,0x22,0x50,0x4f,0x53,0x54,0x22,0x2c,0x65,0x2c,0x21,0x30,
-    0x29,0x2c,0x6f,0x2e,0x73,0x65,0x74,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x48,0x65,
-    0x61,0x64,0x65,0x72,0x28,0x22,0x58,0x2d,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x65,
-    0x64,0x2d,0x57,0x69,0x74,0x68,0x22,0x2c,0x22,0x58,0x4d,0x4c,0x48,0x74,0x74,0x70,
-    0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x22,0x29,0x2c,0x6f,0x2e,0x75,0x70,0x6c,0x6f,
-    0x61,0x64,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,
-    0x6e,0x65,0x72,0x28,0x22,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x22,0x2c,0x66,
-    0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,0x29,0x7b,0x75,0x70,0x64,0x61,0x74,
-    0x65,0x50,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x28,0x61,0x2c,0x31,0x30,0x30,0x2a,
-    0x65,0x2e,0x6c,0x6f,0x61,0x64,0x65,0x64,0x2f,0x65,0x2e,0x74,0x6f,0x74,0x61,0x6c,
-    0x7c,0x7c,0x31,0x30,0x30,0x2c,0x74,0x29,0x7d,0x29,0x2c,0x6f,0x2e,0x61,0x64,0x64,
-    0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x72,
-    0x65,0x61,0x64,0x79,0x73,0x74,0x61,0x74,0x65,0x63,0x68,0x61,0x6e,0x67,0x65,0x22,
-    0x2c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,0x29,0x7b,0x34,0x3d,0x3d,
-    0x6f,0x2e,0x72,0x65,0x61,0x64,0x79,0x53,0x74,0x61,0x74,0x65,0x26,0x26,0x32,0x30,
-    0x30,0x3d,0x3d,0x6f,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x3f,0x28,0x75,0x70,0x64,
-    0x61,0x74,0x65,0x50,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x28,0x61,0x2c,0x31,0x30,
-    0x30,0x2c,0x74,0x29,0x2c,0x66,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x55,0x70,0x64,
-    0x61,0x74,0x65,0x28,0x29,0x29,0x3a,0x34,0x3d,0x3d,0x6f,0x2e,0x72,0x65,0x61,0x64,
-    0x79,0x53,0x74,0x61,0x74,0x65,0x26,0x26,0x6f,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,
-    0x7d,0x29,0x2c,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x22,0x66,0x69,0x6c,
-    0x65,0x22,0x2c,0x6e,0x29,0x2c,0x6f,0x2e,0x73,0x65,0x6e,0x64,0x28,0x73,0x29,0x7d,
-    0x6e,0x65,0x77,0x4c,0x69,0x6e,0x6b,0x2e,0x72,0x65,0x6c,0x3d,0x22,0x73,0x68,0x6f,
-    0x72,0x74,0x63,0x75,0x74,0x20,0x69,0x63,0x6f,0x6e,0x22,0x2c,0x6e,0x65,0x77,0x4c,
-    0x69,0x6e,0x6b,0x2e,0x74,0x79,0x70,0x65,0x3d,0x22,0x69,0x6d,0x61,0x67,0x65,0x2f,
-    0x78,0x2d,0x69,0x63,0x6f,0x6e,0x22,0x2c,0x6e,0x65,0x77,0x4c,0x69,0x6e,0x6b,0x2e,
-    0x68,0x72,0x65,0x66,0x3d,0x22,0x64,0x61,0x74,0x61,0x3a,0x69,0x6d,0x61,0x67,0x65,
-    0x2f,0x70,0x6e,0x67,0x3b,0x62,0x61,0x73,0x65,0x36,0x34,0x2c,0x22,0x2b,0x66,0x61,
-    0x76,0x49,0x63,0x6f,0x6e,0x52,0x6f,0x62,0x6f,0x74,0x4f,0x6e,0x65,0x2c,0x64,0x6f,
-    0x63,0x48,0x65,0x61,0x64,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,
-    0x64,0x28,0x6e,0x65,0x77,0x4c,0x69,0x6e,0x6b,0x29,0x3c,0x2f,0x73,0x63,0x72,0x69,
-    0x70,0x74,0x3e,0x0a,0x0a,0x20,0x20,0x20,0x20,0x0a,0x20,0x20,0x20,0x20,0x3c,0x73,
-    0x74,0x79,0x6c,0x65,0x3e,0x2a,0x7b,0x62,0x6f,0x78,0x2d,0x73,0x69,0x7a,0x69,0x6e,
-    0x67,0x3a,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x62,0x6f,0x78,0x7d,0x62,0x6f,0x64,
-    0x79,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x22,0x48,
-    0x65,0x6c,0x76,0x65,0x74,0x69,0x63,0x61,0x20,0x4e,0x65,0x75,0x65,0x22,0x2c,0x48,
-    0x65,0x6c,0x76,0x65,0x74,0x69,0x63,0x61,0x2c,0x41,0x72,0x69,0x61,0x6c,0x2c,0x73,
-    0x61,0x6e,0x73,0x2d,0x73,0x65,0x72,0x69,0x66,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,
-    0x69,0x7a,0x65,0x3a,0x31,0x34,0x70,0x78,0x3b,0x6c,0x69,0x6e,0x65,0x2d,0x68,0x65,
-    0x69,0x67,0x68,0x74,0x3a,0x31,0x2e,0x34,0x7d,0x74,0x68,0x7b,0x74,0x65,0x78,0x74,
-    0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x6c,0x65,0x66,0x74,0x3b,0x66,0x6f,0x6e,0x74,
-    0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x37,0x30,0x30,0x3b,0x63,0x6f,0x6c,0x6f,
-    0x72,0x3a,0x23,0x33,0x33,0x33,0x7d,0x74,0x64,0x2c,0x74,0x68,0x7b,0x70,0x61,0x64,
-    0x64,0x69,0x6e,0x67,0x3a,0x30,0x3b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x74,
-    0x61,0x62,0x6c,0x65,0x2d,0x63,0x65,0x6c,0x6c,0x7d,0x74,0x61,0x62,0x6c,0x65,0x7b,
-    0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3a,0x30,
-    0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6c,0x61,0x70,0x73,0x65,
-    0x3a,0x63,0x6f,0x6c,0x6c,0x61,0x70,0x73,0x65,0x7d,0x61,0x7b,0x74,0x65,0x78,0x74,
-    0x2d,0x64,0x65,0x63,0x6f,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3a,0x6e,0x6f,0x6e,0x65,
-    0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,
-    0x72,0x3a,0x74,0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,0x6e,0x74,0x3b,0x63,0x75,
-    0x72,0x73,0x6f,0x72,0x3a,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x3b,0x63,0x6f,0x6c,
-    0x6f,0x72,0x3a,0x23,0x33,0x33,0x33,0x7d,0x74,0x64,0x3e,0x61,0x7b,0x63,0x6f,0x6c,
-    0x6f,0x72,0x3a,0x23,0x33,0x33,0x37,0x61,0x62,0x37,0x7d,0x70,0x72,0x6f,0x67,0x72,
-    0x65,0x73,0x73,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x30,0x30,0x25,0x3b,0x6d,
-    0x69,0x6e,0x2d,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x31,0x30,0x30,0x25,0x3b,0x62,
-    0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,
-    0x74,0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,0x6e,0x74,0x3b,0x62,0x6f,0x72,0x64,
-    0x65,0x72,0x3a,0x73,0x6f,0x6c,0x69,0x64,0x20,0x31,0x70,0x78,0x20,0x23,0x66,0x31,
-    0x63,0x37,0x37,0x63,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,
-    0x75,0x73,0x3a,0x35,0x70,0x78,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x62,0x64,
-    0x37,0x65,0x31,0x66,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x62,0x6f,0x74,0x74,
-    0x6f,0x6d,0x3a,0x36,0x70,0x78,0x7d,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x3a,
-    0x3a,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,
-    0x73,0x2d,0x62,0x61,0x72,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x30,0x30,0x25,
-    0x3b,0x6d,0x69,0x6e,0x2d,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x31,0x30,0x30,0x25,
-    0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,
-    0x72,0x3a,0x74,0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,0x6e,0x74,0x3b,0x62,0x6f,
-    0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x31,0x63,0x37,
-    0x37,0x63,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,
-    0x3a,0x35,0x70,0x78,0x7d,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x3a,0x3a,0x2d,
-    0x6d,0x6f,0x7a,0x2d,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x2d,0x62,0x61,0x72,
-    0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,
-    0x72,0x3a,0x74,0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,0x6e,0x74,0x3b,0x62,0x6f,
-    0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x35,0x70,0x78,0x3b,
-    0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x31,
-    0x63,0x37,0x37,0x63,0x7d,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x3a,0x3a,0x2d,
-    0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x2d,
-    0x76,0x61,0x6c,0x75,0x65,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,
-    0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x74,0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,
-    0x6e,0x74,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,
-    0x3a,0x35,0x70,0x78,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,
-    0x72,0x3a,0x23,0x66,0x31,0x63,0x37,0x37,0x63,0x7d,0x23,0x63,0x6f,0x6e,0x74,0x61,
-    0x69,0x6e,0x65,0x72,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x66,0x6c,0x65,
-    0x78,0x3b,0x66,0x6c,0x65,0x78,0x2d,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,
-    0x3a,0x63,0x6f,0x6c,0x75,0x6d,0x6e,0x7d,0x2e,0x75,0x69,0x4c,0x69,0x6e,0x65,0x42,
-    0x6c,0x6f,0x63,0x6b,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x66,0x6c,0x65,
-    0x78,0x7d,0x2e,0x75,0x69,0x42,0x6c,0x6f,0x63,0x6b,0x7b,0x6d,0x61,0x72,0x67,0x69,
-    0x6e,0x3a,0x35,0x70,0x78,0x3b,0x61,0x6c,0x69,0x67,0x6e,0x2d,0x69,0x74,0x65,0x6d,
-    0x73,0x3a,0x62,0x61,0x73,0x65,0x6c,0x69,0x6e,0x65,0x3b,0x61,0x6c,0x69,0x67,0x6e,
-    0x2d,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3a,0x66,0x6c,0x65,0x78,0x2d,0x73,0x74,
-    0x61,0x72,0x74,0x3b,0x6a,0x75,0x73,0x74,0x69,0x66,0x79,0x2d,0x63,0x6f,0x6e,0x74,
-    0x65,0x6e,0x74,0x3a,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x64,0x69,0x73,0x70,0x6c,
-    0x61,0x79,0x3a,0x66,0x6c,0x65,0x78,0x3b,0x66,0x6c,0x65,0x78,0x2d,0x77,0x72,0x61,
-    0x70,0x3a,0x77,0x72,0x61,0x70,0x7d,0x2e,0x69,0x63,0x6f,0x6e,0x2d,0x63,0x6f,0x6e,
-    0x6e,0x65,0x63,0x74,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x66,0x66,0x3b,
-    0x66,0x69,0x6c,0x6c,0x3a,0x23,0x66,0x66,0x66,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,
-    0x31,0x36,0x70,0x78,0x3b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x31,0x36,0x70,0x78,
-    0x3b,0x76,0x65,0x72,0x74,0x69,0x63,0x61,0x6c,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,
-    0x6d,0x69,0x64,0x64,0x6c,0x65,0x7d,0x2e,0x69,0x63,0x6f,0x6e,0x2d,0x61,0x63,0x74,
-    0x69,0x6f,0x6e,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x67,0x72,0x65,0x79,0x3b,0x66,
-    0x69,0x6c,0x6c,0x3a,0x67,0x72,0x65,0x79,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,
-    0x36,0x70,0x78,0x3b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x31,0x36,0x70,0x78,0x3b,
-    0x76,0x65,0x72,0x74,0x69,0x63,0x61,0x6c,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x6d,
-    0x69,0x64,0x64,0x6c,0x65,0x7d,0x2e,0x62,0x74,0x6e,0x7b,0x64,0x69,0x73,0x70,0x6c,
-    0x61,0x79,0x3a,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x62,0x6c,0x6f,0x63,0x6b,0x3b,
-    0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x36,0x70,0x78,0x20,0x31,0x32,0x70,0x78,
-    0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x30,
-    0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x34,0x70,0x78,0x3b,
-    0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x34,0x30,0x30,0x3b,
-    0x6c,0x69,0x6e,0x65,0x2d,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x31,0x2e,0x34,0x32,
-    0x38,0x35,0x37,0x31,0x34,0x33,0x3b,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,
-    0x6e,0x3a,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x77,0x68,0x69,0x74,0x65,0x2d,0x73,
-    0x70,0x61,0x63,0x65,0x3a,0x6e,0x6f,0x77,0x72,0x61,0x70,0x3b,0x76,0x65,0x72,0x74,
-    0x69,0x63,0x61,0x6c,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x6d,0x69,0x64,0x64,0x6c,
-    0x65,0x3b,0x74,0x6f,0x75,0x63,0x68,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x3a,0x6d,
-    0x61,0x6e,0x69,0x70,0x75,0x6c,0x61,0x74,0x69,0x6f,0x6e,0x3b,0x63,0x75,0x72,0x73,
-    0x6f,0x72,0x3a,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x3b,0x75,0x73,0x65,0x72,0x2d,
-    0x73,0x65,0x6c,0x65,0x63,0x74,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x62,0x6f,0x72,0x64,
-    0x65,0x72,0x3a,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x74,0x72,0x61,
-    0x6e,0x73,0x70,0x61,0x72,0x65,0x6e,0x74,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,
-    0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x34,0x70,0x78,0x3b,0x74,0x65,0x78,0x74,0x2d,
-    0x64,0x65,0x63,0x6f,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3a,0x6e,0x6f,0x6e,0x65,0x7d,
-    0x2e,0x62,0x74,0x6e,0x2e,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x7b,0x63,0x75,
-    0x72,0x73,0x6f,0x72,0x3a,0x6e,0x6f,0x74,0x2d,0x61,0x6c,0x6c,0x6f,0x77,0x65,0x64,
-    0x3b,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x3a,0x2e,0x36,0x35,0x7d,0x2e,0x66,0x6f,
-    0x72,0x6d,0x2d,0x63,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x7b,0x70,0x61,0x64,0x64,0x69,
-    0x6e,0x67,0x3a,0x36,0x70,0x78,0x20,0x31,0x32,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,
-    0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x34,0x70,0x78,0x3b,0x6c,0x69,0x6e,0x65,0x2d,
-    0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x31,0x2e,0x34,0x32,0x38,0x35,0x37,0x31,0x34,
-    0x33,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x35,0x35,0x35,0x3b,0x62,0x61,0x63,
-    0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,
-    0x66,0x66,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x69,0x6d,
-    0x61,0x67,0x65,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,
-    0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,0x63,0x63,0x63,0x3b,0x62,
-    0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x34,0x70,0x78,
-    0x3b,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,0x62,0x6f,0x78,0x2d,0x73,0x68,0x61,
-    0x64,0x6f,0x77,0x3a,0x69,0x6e,0x73,0x65,0x74,0x20,0x30,0x20,0x31,0x70,0x78,0x20,
-    0x31,0x70,0x78,0x20,0x72,0x67,0x62,0x61,0x28,0x30,0x2c,0x30,0x2c,0x30,0x2c,0x2e,
-    0x30,0x37,0x35,0x29,0x3b,0x62,0x6f,0x78,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x3a,
-    0x69,0x6e,0x73,0x65,0x74,0x20,0x30,0x20,0x31,0x70,0x78,0x20,0x31,0x70,0x78,0x20,
-    0x72,0x67,0x62,0x61,0x28,0x30,0x2c,0x30,0x2c,0x30,0x2c,0x2e,0x30,0x37,0x35,0x29,
-    0x3b,0x76,0x65,0x72,0x74,0x69,0x63,0x61,0x6c,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,
-    0x6d,0x69,0x64,0x64,0x6c,0x65,0x7d,0x2e,0x62,0x74,0x6e,0x2d,0x61,0x63,0x74,0x69,
-    0x6f,0x6e,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x66,0x66,0x3b,0x62,0x61,
-    0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,
-    0x64,0x65,0x61,0x33,0x35,0x32,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,
-    0x6c,0x6f,0x72,0x3a,0x23,0x62,0x64,0x37,0x65,0x31,0x66,0x7d,0x2e,0x62,0x74,0x6e,
-    0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,
-    0x33,0x33,0x33,0x3b,0x74,0x65,0x78,0x74,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x3a,
-    0x30,0x20,0x31,0x70,0x78,0x20,0x30,0x20,0x23,0x66,0x66,0x66,0x3b,0x62,0x61,0x63,
-    0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x69,0x6d,0x61,0x67,0x65,0x3a,0x2d,0x77,
-    0x65,0x62,0x6b,0x69,0x74,0x2d,0x6c,0x69,0x6e,0x65,0x61,0x72,0x2d,0x67,0x72,0x61,
-    0x64,0x69,0x65,0x6e,0x74,0x28,0x74,0x6f,0x70,0x2c,0x23,0x66,0x66,0x66,0x20,0x30,
-    0x2c,0x23,0x65,0x30,0x65,0x30,0x65,0x30,0x20,0x31,0x30,0x30,0x25,0x29,0x3b,0x62,
-    0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x69,0x6d,0x61,0x67,0x65,0x3a,
-    0x2d,0x6f,0x2d,0x6c,0x69,0x6e,0x65,0x61,0x72,0x2d,0x67,0x72,0x61,0x64,0x69,0x65,
-    0x6e,0x74,0x28,0x74,0x6f,0x70,0x2c,0x23,0x66,0x66,0x66,0x20,0x30,0x2c,0x23,0x65,
-    0x30,0x65,0x30,0x65,0x30,0x20,0x31,0x30,0x30,0x25,0x29,0x3b,0x62,0x61,0x63,0x6b,
-    0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x69,0x6d,0x61,0x67,0x65,0x3a,0x2d,0x77,0x65,
-    0x62,0x6b,0x69,0x74,0x2d,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x28,0x6c,0x69,
-    0x6e,0x65,0x61,0x72,0x2c,0x6c,0x65,0x66,0x74,0x20,0x74,0x6f,0x70,0x2c,0x6c,0x65,
-    0x66,0x74,0x20,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x2c,0x66,0x72,0x6f,0x6d,0x28,0x23,
-    0x66,0x66,0x66,0x29,0x2c,0x74,0x6f,0x28,0x23,0x65,0x30,0x65,0x30,0x65,0x30,0x29,
-    0x29,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x69,0x6d,0x61,
-    0x67,0x65,0x3a,0x6c,0x69,0x6e,0x65,0x61,0x72,0x2d,0x67,0x72,0x61,0x64,0x69,0x65,
-    0x6e,0x74,0x28,0x74,0x6f,0x20,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x2c,0x23,0x66,0x66,
-    0x66,0x20,0x30,0x2c,0x23,0x65,0x30,0x65,0x30,0x65,0x30,0x20,0x31,0x30,0x30,0x25,
-    0x29,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x72,0x65,0x70,
-    0x65,0x61,0x74,0x3a,0x72,0x65,0x70,0x65,0x61,0x74,0x2d,0x78,0x3b,0x62,0x6f,0x72,
-    0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x63,0x63,0x63,0x7d,0x2e,
-    0x62,0x74,0x6e,0x2d,0x66,0x69,0x6c,0x65,0x61,0x63,0x74,0x69,0x6f,0x6e,0x7b,0x70,
-    0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x30,0x20,0x35,0x70,0x78,0x7d,0x2e,0x62,0x74,
-    0x6e,0x2d,0x70,0x72,0x69,0x6d,0x61,0x72,0x79,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,
-    0x23,0x66,0x66,0x66,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,
-    0x69,0x6d,0x61,0x67,0x65,0x3a,0x6c,0x69,0x6e,0x65,0x61,0x72,0x2d,0x67,0x72,0x61,
-    0x64,0x69,0x65,0x6e,0x74,0x28,0x74,0x6f,0x20,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x2c,
-    0x23,0x65,0x34,0x61,0x66,0x34,0x33,0x20,0x30,0x2c,0x23,0x64,0x63,0x37,0x34,0x31,
-    0x30,0x20,0x31,0x30,0x30,0x25,0x29,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,
-    0x6e,0x64,0x2d,0x72,0x65,0x70,0x65,0x61,0x74,0x3a,0x72,0x65,0x70,0x65,0x61,0x74,
-    0x2d,0x78,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,
-    0x23,0x62,0x64,0x37,0x65,0x31,0x66,0x7d,0x2e,0x62,0x74,0x6e,0x2d,0x68,0x65,0x61,
-    0x64,0x69,0x6e,0x67,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x66,0x66,0x3b,
-    0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x69,0x6d,0x61,0x67,0x65,
-    0x3a,0x6c,0x69,0x6e,0x65,0x61,0x72,0x2d,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,
-    0x28,0x74,0x6f,0x20,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x2c,0x23,0x65,0x34,0x61,0x66,
-    0x34,0x33,0x20,0x30,0x2c,0x23,0x64,0x63,0x37,0x34,0x31,0x30,0x20,0x31,0x30,0x30,
-    0x25,0x29,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x72,0x65,
-    0x70,0x65,0x61,0x74,0x3a,0x72,0x65,0x70,0x65,0x61,0x74,0x2d,0x78,0x3b,0x62,0x6f,
-    0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x62,0x64,0x37,0x65,
-    0x31,0x66,0x3b,0x66,0x6c,0x6f,0x61,0x74,0x3a,0x72,0x69,0x67,0x68,0x74,0x3b,0x70,
-    0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x32,0x70,0x78,0x20,0x31,0x32,0x70,0x78,0x3b,
-    0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x2d,0x34,0x70,0x78,0x7d,0x2e,0x62,0x74,0x6e,
-    0x2d,0x63,0x6c,0x65,0x61,0x72,0x7b,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3a,0x22,
-    0x22,0x3b,0x63,0x6c,0x65,0x61,0x72,0x3a,0x62,0x6f,0x74,0x68,0x3b,0x64,0x69,0x73,
-    0x70,0x6c,0x61,0x79,0x3a,0x74,0x61,0x62,0x6c,0x65,0x7d,0x2e,0x62,0x74,0x6e,0x2d,
-    0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x2e,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,
-    0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,
-    0x72,0x3a,0x23,0x65,0x30,0x65,0x30,0x65,0x30,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,
-    0x6f,0x75,0x6e,0x64,0x2d,0x69,0x6d,0x61,0x67,0x65,0x3a,0x6e,0x6f,0x6e,0x65,0x7d,
-    0x2e,0x75,0x69,0x50,0x61,0x6e,0x65,0x6c,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,
-    0x3a,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x6d,0x69,0x6e,0x2d,0x68,0x65,0x69,0x67,0x68,
-    0x74,0x3a,0x31,0x70,0x78,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,
-    0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x66,0x66,0x3b,0x62,0x6f,0x72,0x64,
-    0x65,0x72,0x3a,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,0x66,0x31,
-    0x63,0x37,0x37,0x63,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,
-    0x75,0x73,0x3a,0x34,0x70,0x78,0x7d,0x2e,0x75,0x69,0x50,0x61,0x6e,0x65,0x6c,0x48,
-    0x65,0x61,0x64,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x69,
-    0x6d,0x61,0x67,0x65,0x3a,0x6c,0x69,0x6e,0x65,0x61,0x72,0x2d,0x67,0x72,0x61,0x64,
-    0x69,0x65,0x6e,0x74,0x28,0x74,0x6f,0x20,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x2c,0x23,
-    0x66,0x37,0x66,0x30,0x62,0x39,0x20,0x30,0x2c,0x23,0x66,0x33,0x62,0x61,0x36,0x34,
-    0x20,0x31,0x30,0x30,0x25,0x29,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,
-    0x64,0x2d,0x72,0x65,0x70,0x65,0x61,0x74,0x3a,0x72,0x65,0x70,0x65,0x61,0x74,0x2d,
-    0x78,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x38,0x66,0x33,0x38,0x30,0x30,0x3b,
-    0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,
-    0x3a,0x23,0x66,0x37,0x64,0x64,0x36,0x66,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,
-    0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x31,0x63,0x37,0x37,0x63,0x3b,0x70,0x61,
-    0x64,0x64,0x69,0x6e,0x67,0x3a,0x31,0x30,0x70,0x78,0x20,0x31,0x30,0x70,0x78,0x20,
-    0x31,0x30,0x70,0x78,0x20,0x31,0x30,0x70,0x78,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,
-    0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,
-    0x64,0x20,0x74,0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,0x6e,0x74,0x3b,0x62,0x6f,
-    0x72,0x64,0x65,0x72,0x2d,0x74,0x6f,0x70,0x2d,0x6c,0x65,0x66,0x74,0x2d,0x72,0x61,
-    0x64,0x69,0x75,0x73,0x3a,0x33,0x70,0x78,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,
-    0x74,0x6f,0x70,0x2d,0x72,0x69,0x67,0x68,0x74,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,
-    0x3a,0x33,0x70,0x78,0x7d,0x2e,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x7b,0x62,0x6f,
-    0x72,0x64,0x65,0x72,0x3a,0x30,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x30,0x30,
-    0x25,0x3b,0x6d,0x61,0x78,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x30,0x30,0x25,
-    0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3a,
-    0x30,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6c,0x61,0x70,0x73,
-    0x65,0x3a,0x63,0x6f,0x6c,0x6c,0x61,0x70,0x73,0x65,0x3b,0x62,0x61,0x63,0x6b,0x67,
-    0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x74,0x72,0x61,0x6e,
-    0x73,0x70,0x61,0x72,0x65,0x6e,0x74,0x3b,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,
-    0x67,0x6e,0x3a,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x76,0x65,0x72,0x74,0x69,0x63,
-    0x61,0x6c,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x6d,0x69,0x64,0x64,0x6c,0x65,0x21,
-    0x69,0x6d,0x70,0x6f,0x72,0x74,0x61,0x6e,0x74,0x7d,0x2e,0x75,0x69,0x54,0x61,0x62,
-    0x6c,0x65,0x3e,0x74,0x68,0x65,0x61,0x64,0x3e,0x74,0x72,0x3e,0x74,0x68,0x7b,0x76,
-    0x65,0x72,0x74,0x69,0x63,0x61,0x6c,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x62,0x6f,
-    0x74,0x74,0x6f,0x6d,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x62,0x6f,0x74,0x74,
-    0x6f,0x6d,0x3a,0x32,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,0x64,0x64,
-    0x64,0x7d,0x2e,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x3e,0x74,0x62,0x6f,0x64,0x79,
-    0x3e,0x74,0x72,0x3e,0x74,0x64,0x2c,0x2e,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x3e,
-    0x74,0x62,0x6f,0x64,0x79,0x3e,0x74,0x72,0x3e,0x74,0x68,0x2c,0x2e,0x75,0x69,0x54,
-    0x61,0x62,0x6c,0x65,0x3e,0x74,0x66,0x6f,0x6f,0x74,0x3e,0x74,0x72,0x3e,0x74,0x64,
-    0x2c,0x2e,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x3e,0x74,0x66,0x6f,0x6f,0x74,0x3e,
-    0x74,0x72,0x3e,0x74,0x68,0x2c,0x2e,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x3e,0x74,
-    0x68,0x65,0x61,0x64,0x3e,0x74,0x72,0x3e,0x74,0x64,0x2c,0x2e,0x75,0x69,0x54,0x61,
-    0x62,0x6c,0x65,0x3e,0x74,0x68,0x65,0x61,0x64,0x3e,0x74,0x72,0x3e,0x74,0x68,0x7b,
-    0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x38,0x70,0x78,0x3b,0x6c,0x69,0x6e,0x65,
-    0x2d,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x31,0x2e,0x34,0x32,0x38,0x35,0x37,0x31,
-    0x34,0x33,0x3b,0x76,0x65,0x72,0x74,0x69,0x63,0x61,0x6c,0x2d,0x61,0x6c,0x69,0x67,
-    0x6e,0x3a,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,
-    0x74,0x6f,0x70,0x3a,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,0x64,
-    0x64,0x64,0x7d,0x2e,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x3e,0x63,0x61,0x70,0x74,
-    0x69,0x6f,0x6e,0x2b,0x74,0x68,0x65,0x61,0x64,0x3e,0x74,0x72,0x3a,0x66,0x69,0x72,
-    0x73,0x74,0x2d,0x63,0x68,0x69,0x6c,0x64,0x3e,0x74,0x64,0x2c,0x2e,0x75,0x69,0x54,
-    0x61,0x62,0x6c,0x65,0x3e,0x63,0x61,0x70,0x74,0x69,0x6f,0x6e,0x2b,0x74,0x68,0x65,
-    0x61,0x64,0x3e,0x74,0x72,0x3a,0x66,0x69,0x72,0x73,0x74,0x2d,0x63,0x68,0x69,0x6c,
-    0x64,0x3e,0x74,0x68,0x2c,0x2e,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x3e,0x63,0x6f,
-    0x6c,0x67,0x72,0x6f,0x75,0x70,0x2b,0x74,0x68,0x65,0x61,0x64,0x3e,0x74,0x72,0x3a,
-    0x66,0x69,0x72,0x73,0x74,0x2d,0x63,0x68,0x69,0x6c,0x64,0x3e,0x74,0x64,0x2c,0x2e,
-    0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x3e,0x63,0x6f,0x6c,0x67,0x72,0x6f,0x75,0x70,
-    0x2b,0x74,0x68,0x65,0x61,0x64,0x3e,0x74,0x72,0x3a,0x66,0x69,0x72,0x73,0x74,0x2d,
-    0x63,0x68,0x69,0x6c,0x64,0x3e,0x74,0x68,0x2c,0x2e,0x75,0x69,0x54,0x61,0x62,0x6c,
-    0x65,0x3e,0x74,0x68,0x65,0x61,0x64,0x3a,0x66,0x69,0x72,0x73,0x74,0x2d,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x74,0x72,0x3a,0x66,0x69,0x72,0x73,0x74,0x2d,0x63,0x68,0x69,
-    0x6c,0x64,0x3e,0x74,0x64,0x2c,0x2e,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x3e,0x74,
-    0x68,0x65,0x61,0x64,0x3a,0x66,0x69,0x72,0x73,0x74,0x2d,0x63,0x68,0x69,0x6c,0x64,
-    0x3e,0x74,0x72,0x3a,0x66,0x69,0x72,0x73,0x74,0x2d,0x63,0x68,0x69,0x6c,0x64,0x3e,
-    0x74,0x68,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x74,0x6f,0x70,0x3a,0x30,0x7d,
-    0x2e,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x42,0x6f,0x72,0x64,0x65,0x72,0x65,0x64,
-    0x3e,0x74,0x62,0x6f,0x64,0x79,0x3e,0x74,0x72,0x3e,0x74,0x64,0x2c,0x2e,0x75,0x69,
-    0x54,0x61,0x62,0x6c,0x65,0x42,0x6f,0x72,0x64,0x65,0x72,0x65,0x64,0x3e,0x74,0x62,
-    0x6f,0x64,0x79,0x3e,0x74,0x72,0x3e,0x74,0x68,0x2c,0x2e,0x75,0x69,0x54,0x61,0x62,
-    0x6c,0x65,0x42,0x6f,0x72,0x64,0x65,0x72,0x65,0x64,0x3e,0x74,0x66,0x6f,0x6f,0x74,
-    0x3e,0x74,0x72,0x3e,0x74,0x64,0x2c,0x2e,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x42,
-    0x6f,0x72,0x64,0x65,0x72,0x65,0x64,0x3e,0x74,0x66,0x6f,0x6f,0x74,0x3e,0x74,0x72,
-    0x3e,0x74,0x68,0x2c,0x2e,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x42,0x6f,0x72,0x64,
-    0x65,0x72,0x65,0x64,0x3e,0x74,0x68,0x65,0x61,0x64,0x3e,0x74,0x72,0x3e,0x74,0x64,
-    0x2c,0x2e,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x42,0x6f,0x72,0x64,0x65,0x72,0x65,
-    0x64,0x3e,0x74,0x68,0x65,0x61,0x64,0x3e,0x74,0x72,0x3e,0x74,0x68,0x7b,0x62,0x6f,
-    0x72,0x64,0x65,0x72,0x3a,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,
-    0x64,0x64,0x64,0x7d,0x2e,0x74,0x61,0x62,0x6c,0x65,0x2d,0x62,0x6f,0x72,0x64,0x65,
-    0x72,0x65,0x64,0x3e,0x74,0x68,0x65,0x61,0x64,0x3e,0x74,0x72,0x3e,0x74,0x64,0x2c,
-    0x2e,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x42,0x6f,0x72,0x64,0x65,0x72,0x65,0x64,
-    0x3e,0x74,0x68,0x65,0x61,0x64,0x3e,0x74,0x72,0x3e,0x74,0x68,0x7b,0x62,0x6f,0x72,
-    0x64,0x65,0x72,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x2d,0x77,0x69,0x64,0x74,0x68,
-    0x3a,0x32,0x70,0x78,0x7d,0x2e,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x42,0x6f,0x72,
-    0x64,0x65,0x72,0x65,0x64,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x31,0x70,0x78,
-    0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,0x64,0x64,0x64,0x3b,0x76,0x65,0x72,0x74,
-    0x69,0x63,0x61,0x6c,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x63,0x65,0x6e,0x74,0x65,
-    0x72,0x7d,0x2e,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x46,0x69,0x6c,0x65,0x73,0x7b,
-    0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x31,0x35,
-    0x70,0x78,0x3b,0x6d,0x69,0x6e,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x37,0x30,0x30,
-    0x70,0x78,0x7d,0x2e,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x4c,0x65,0x66,0x74,0x41,
-    0x6c,0x69,0x67,0x6e,0x65,0x64,0x7b,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,
-    0x6e,0x3a,0x6c,0x65,0x66,0x74,0x7d,0x2e,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x47,
-    0x72,0x69,0x64,0x3e,0x74,0x62,0x6f,0x64,0x79,0x3e,0x74,0x72,0x3e,0x74,0x64,0x2c,
-    0x2e,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x47,0x72,0x69,0x64,0x3e,0x74,0x62,0x6f,
-    0x64,0x79,0x3e,0x74,0x72,0x3e,0x74,0x68,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,
-    0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,0x64,0x64,0x64,0x3b,0x6d,
-    0x69,0x6e,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x36,0x30,0x70,0x78,0x3b,0x70,0x61,
-    0x64,0x64,0x69,0x6e,0x67,0x3a,0x35,0x70,0x78,0x7d,0x2e,0x75,0x69,0x54,0x61,0x62,
-    0x6c,0x65,0x53,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x7b,0x6d,0x69,0x6e,0x2d,0x77,
-    0x69,0x64,0x74,0x68,0x3a,0x37,0x30,0x30,0x70,0x78,0x7d,0x2e,0x75,0x69,0x54,0x61,
-    0x62,0x6c,0x65,0x53,0x74,0x61,0x74,0x75,0x73,0x7b,0x6d,0x69,0x6e,0x2d,0x77,0x69,
-    0x64,0x74,0x68,0x3a,0x33,0x33,0x35,0x70,0x78,0x3b,0x6d,0x69,0x6e,0x2d,0x68,0x65,
-    0x69,0x67,0x68,0x74,0x3a,0x33,0x39,0x34,0x70,0x78,0x7d,0x2e,0x75,0x69,0x54,0x61,
-    0x62,0x6c,0x65,0x53,0x74,0x61,0x74,0x75,0x73,0x20,0x74,0x64,0x7b,0x66,0x6f,0x6e,
-    0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x2e,0x31,0x72,0x65,0x6d,0x7d,0x2e,0x74,
-    0x68,0x2d,0x73,0x74,0x61,0x74,0x75,0x73,0x47,0x72,0x69,0x64,0x7b,0x77,0x69,0x64,
-    0x74,0x68,0x3a,0x31,0x30,0x30,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,
-    0x69,0x67,0x68,0x74,0x3a,0x34,0x30,0x30,0x7d,0x2e,0x75,0x69,0x54,0x61,0x62,0x6c,
-    0x65,0x42,0x75,0x74,0x74,0x6f,0x6e,0x73,0x7b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,
-    0x74,0x6f,0x70,0x3a,0x31,0x30,0x70,0x78,0x7d,0x2e,0x75,0x69,0x54,0x61,0x62,0x6c,
-    0x65,0x42,0x75,0x74,0x74,0x6f,0x6e,0x73,0x3e,0x74,0x62,0x6f,0x64,0x79,0x3e,0x74,
-    0x72,0x7b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6e,
-    0x3a,0x31,0x30,0x70,0x78,0x7d,0x2e,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x42,0x75,
-    0x74,0x74,0x6f,0x6e,0x73,0x3e,0x74,0x62,0x6f,0x64,0x79,0x3e,0x74,0x72,0x3e,0x74,
-    0x64,0x2c,0x2e,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x42,0x75,0x74,0x74,0x6f,0x6e,
-    0x73,0x3e,0x74,0x62,0x6f,0x64,0x79,0x3e,0x74,0x72,0x3e,0x74,0x68,0x7b,0x62,0x6f,
-    0x72,0x64,0x65,0x72,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,
-    0x67,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x36,0x70,0x78,0x3b,0x70,0x61,0x64,0x64,0x69,
-    0x6e,0x67,0x2d,0x72,0x69,0x67,0x68,0x74,0x3a,0x36,0x70,0x78,0x7d,0x2e,0x62,0x74,
-    0x6e,0x2d,0x67,0x72,0x6f,0x75,0x70,0x7b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,
-    0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x39,0x70,0x78,0x3b,0x70,0x6f,0x73,0x69,0x74,
-    0x69,0x6f,0x6e,0x3a,0x72,0x65,0x6c,0x61,0x74,0x69,0x76,0x65,0x3b,0x64,0x69,0x73,
-    0x70,0x6c,0x61,0x79,0x3a,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x62,0x6c,0x6f,0x63,
-    0x6b,0x3b,0x76,0x65,0x72,0x74,0x69,0x63,0x61,0x6c,0x2d,0x61,0x6c,0x69,0x67,0x6e,
-    0x3a,0x6d,0x69,0x64,0x64,0x6c,0x65,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x61,0x75,
-    0x74,0x6f,0x7d,0x2e,0x62,0x74,0x6e,0x2d,0x67,0x72,0x6f,0x75,0x70,0x2d,0x6a,0x75,
-    0x73,0x74,0x69,0x66,0x69,0x65,0x64,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,
-    0x74,0x61,0x62,0x6c,0x65,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x33,0x35,0x30,0x70,
-    0x78,0x3b,0x74,0x61,0x62,0x6c,0x65,0x2d,0x6c,0x61,0x79,0x6f,0x75,0x74,0x3a,0x66,
-    0x69,0x78,0x65,0x64,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6c,
-    0x61,0x70,0x73,0x65,0x3a,0x73,0x65,0x70,0x61,0x72,0x61,0x74,0x65,0x3b,0x6d,0x61,
-    0x72,0x67,0x69,0x6e,0x3a,0x30,0x20,0x32,0x70,0x78,0x7d,0x2e,0x62,0x74,0x6e,0x2d,
-    0x67,0x72,0x6f,0x75,0x70,0x3e,0x2e,0x62,0x74,0x6e,0x3a,0x66,0x69,0x72,0x73,0x74,
-    0x2d,0x63,0x68,0x69,0x6c,0x64,0x3a,0x6e,0x6f,0x74,0x28,0x3a,0x6c,0x61,0x73,0x74,
-    0x2d,0x63,0x68,0x69,0x6c,0x64,0x29,0x3a,0x6e,0x6f,0x74,0x28,0x2e,0x64,0x72,0x6f,
-    0x70,0x64,0x6f,0x77,0x6e,0x2d,0x74,0x6f,0x67,0x67,0x6c,0x65,0x29,0x7b,0x62,0x6f,
-    0x72,0x64,0x65,0x72,0x2d,0x74,0x6f,0x70,0x2d,0x72,0x69,0x67,0x68,0x74,0x2d,0x72,
-    0x61,0x64,0x69,0x75,0x73,0x3a,0x30,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x62,
-    0x6f,0x74,0x74,0x6f,0x6d,0x2d,0x72,0x69,0x67,0x68,0x74,0x2d,0x72,0x61,0x64,0x69,
-    0x75,0x73,0x3a,0x30,0x7d,0x2e,0x62,0x74,0x6e,0x2d,0x67,0x72,0x6f,0x75,0x70,0x3e,
-    0x2e,0x62,0x74,0x6e,0x3a,0x66,0x69,0x72,0x73,0x74,0x2d,0x63,0x68,0x69,0x6c,0x64,
-    0x7b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x30,0x7d,0x2e,
-    0x62,0x74,0x6e,0x2d,0x67,0x72,0x6f,0x75,0x70,0x2d,0x6a,0x75,0x73,0x74,0x69,0x66,
-    0x69,0x65,0x64,0x3e,0x2e,0x62,0x74,0x6e,0x2c,0x2e,0x62,0x74,0x6e,0x2d,0x67,0x72,
-    0x6f,0x75,0x70,0x2d,0x6a,0x75,0x73,0x74,0x69,0x66,0x69,0x65,0x64,0x3e,0x2e,0x62,
-    0x74,0x6e,0x2d,0x67,0x72,0x6f,0x75,0x70,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,
-    0x3a,0x74,0x61,0x62,0x6c,0x65,0x2d,0x63,0x65,0x6c,0x6c,0x3b,0x66,0x6c,0x6f,0x61,
-    0x74,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x25,0x7d,
-    0x2e,0x65,0x78,0x74,0x72,0x61,0x2d,0x73,0x70,0x61,0x63,0x65,0x2d,0x61,0x62,0x6f,
-    0x76,0x65,0x7b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x74,0x6f,0x70,0x3a,0x37,0x70,
-    0x78,0x7d,0x2e,0x74,0x65,0x78,0x74,0x41,0x72,0x65,0x61,0x49,0x6e,0x70,0x75,0x74,
-    0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x77,0x69,0x64,
-    0x74,0x68,0x3a,0x31,0x30,0x30,0x25,0x3b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x31,
-    0x30,0x30,0x25,0x3b,0x6d,0x69,0x6e,0x2d,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x38,
-    0x72,0x65,0x6d,0x3b,0x6d,0x69,0x6e,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x32,0x30,
-    0x72,0x65,0x6d,0x7d,0x2e,0x74,0x65,0x78,0x74,0x41,0x72,0x65,0x61,0x4f,0x6e,0x65,
-    0x4c,0x69,0x6e,0x65,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x6e,0x6f,0x6e,0x65,
-    0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x30,0x30,0x25,0x3b,0x68,0x65,0x69,0x67,
-    0x68,0x74,0x3a,0x31,0x30,0x30,0x25,0x7d,0x2e,0x68,0x69,0x64,0x64,0x65,0x6e,0x7b,
-    0x76,0x69,0x73,0x69,0x62,0x69,0x6c,0x69,0x74,0x79,0x3a,0x68,0x69,0x64,0x64,0x65,
-    0x6e,0x7d,0x3c,0x2f,0x73,0x74,0x79,0x6c,0x65,0x3e,0x0a,0x0a,0x3c,0x2f,0x68,0x65,
-    0x61,0x64,0x3e,0x0a,0x0a,0x3c,0x62,0x6f,0x64,0x79,0x20,0x6f,0x6e,0x6c,0x6f,0x61,
-    0x64,0x3d,0x22,0x62,0x6f,0x64,0x79,0x49,0x73,0x4c,0x6f,0x61,0x64,0x65,0x64,0x28,
-    0x65,0x76,0x65,0x6e,0x74,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x0a,0x20,0x20,
-    0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x22,0x63,0x6f,0x6e,0x74,0x61,
-    0x69,0x6e,0x65,0x72,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x75,0x69,0x4c,0x69,0x6e,
-    0x65,0x42,0x6c,0x6f,0x63,0x6b,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-    0x22,0x75,0x69,0x42,0x6c,0x6f,0x63,0x6b,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x75,0x74,0x74,
-    0x6f,0x6e,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,
-    0x20,0x69,0x64,0x3d,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x2d,0x63,0x6f,0x6e,0x6e,
-    0x65,0x63,0x74,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,
-    0x62,0x74,0x6e,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x20,0x6f,0x6e,0x63,0x6c,
-    0x69,0x63,0x6b,0x3d,0x22,0x72,0x65,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x28,0x65,
-    0x76,0x65,0x6e,0x74,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x76,0x67,
-    0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x63,0x6f,0x6e,
-    0x6e,0x65,0x63,0x74,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,
-    0x23,0x69,0x63,0x6f,0x6e,0x2d,0x6c,0x6f,0x67,0x2d,0x69,0x6e,0x22,0x3e,0x3c,0x2f,
-    0x75,0x73,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x43,0x6f,0x6e,0x6e,0x65,0x63,
-    0x74,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,
-    0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x64,0x69,0x76,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x75,0x69,
-    0x42,0x6c,0x6f,0x63,0x6b,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x22,0x75,0x69,0x46,0x6f,0x72,0x6d,0x22,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,
-    0x78,0x74,0x22,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x67,0x63,0x6f,0x64,0x65,0x22,
-    0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x66,0x6f,0x72,0x6d,0x2d,0x63,0x6f,0x6e,
-    0x74,0x72,0x6f,0x6c,0x22,0x20,0x6f,0x6e,0x6b,0x65,0x79,0x70,0x72,0x65,0x73,0x73,
-    0x3d,0x22,0x67,0x63,0x6f,0x64,0x65,0x49,0x6e,0x70,0x75,0x74,0x4b,0x65,0x79,0x50,
-    0x72,0x65,0x73,0x73,0x22,0x20,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,
-    0x72,0x3d,0x22,0x47,0x2d,0x43,0x6f,0x64,0x65,0x20,0x2e,0x2e,0x2e,0x22,0x20,0x69,
-    0x64,0x3d,0x22,0x67,0x63,0x6f,0x64,0x65,0x53,0x65,0x6e,0x64,0x42,0x6f,0x78,0x22,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x74,0x79,
-    0x70,0x65,0x3d,0x22,0x73,0x75,0x62,0x6d,0x69,0x74,0x22,0x20,0x69,0x64,0x3d,0x22,
-    0x67,0x63,0x6f,0x64,0x65,0x53,0x65,0x6e,0x64,0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,
-    0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,
-    0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x20,0x74,0x69,0x74,0x6c,0x65,0x3d,0x22,
-    0x53,0x65,0x6e,0x64,0x20,0x47,0x2d,0x43,0x6f,0x64,0x65,0x22,0x20,0x6f,0x6e,0x63,
-    0x6c,0x69,0x63,0x6b,0x3d,0x22,0x73,0x65,0x6e,0x64,0x47,0x63,0x6f,0x64,0x65,0x46,
-    0x72,0x6f,0x6d,0x49,0x6e,0x70,0x75,0x74,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x22,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x76,0x67,0x20,0x63,
-    0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x61,0x63,0x74,0x69,0x6f,
-    0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,
-    0x22,0x23,0x69,0x63,0x6f,0x6e,0x2d,0x73,0x65,0x6e,0x64,0x22,0x3e,0x3c,0x2f,0x75,
-    0x73,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x76,
-    0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,
-    0x3e,0x53,0x65,0x6e,0x64,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x64,0x69,0x76,0x3e,0x0a,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x75,0x69,
-    0x42,0x6c,0x6f,0x63,0x6b,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x22,0x75,0x69,0x46,0x6f,0x72,0x6d,0x22,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x69,0x64,0x3d,0x22,0x62,0x74,0x6e,
-    0x53,0x74,0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x22,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,0x64,0x65,0x66,0x61,
-    0x75,0x6c,0x74,0x22,0x20,0x74,0x69,0x74,0x6c,0x65,0x3d,0x22,0x53,0x74,0x72,0x65,
-    0x61,0x6d,0x20,0x61,0x20,0x47,0x2d,0x43,0x6f,0x64,0x65,0x20,0x66,0x69,0x6c,0x65,
-    0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x62,0x74,0x6e,0x53,0x74,
-    0x72,0x65,0x61,0x6d,0x47,0x63,0x6f,0x64,0x65,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,
-    0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x76,0x67,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x61,0x63,0x74,0x69,
-    0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,
-    0x3d,0x22,0x23,0x69,0x63,0x6f,0x6e,0x2d,0x75,0x70,0x6c,0x6f,0x61,0x64,0x22,0x3e,
-    0x3c,0x2f,0x75,0x73,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x73,0x76,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,
-    0x70,0x61,0x6e,0x3e,0x53,0x74,0x72,0x65,0x61,0x6d,0x3c,0x2f,0x73,0x70,0x61,0x6e,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x20,0x69,0x64,0x3d,0x22,0x74,0x78,
-    0x74,0x55,0x70,0x6c,0x6f,0x61,0x64,0x53,0x74,0x61,0x74,0x75,0x73,0x22,0x20,0x63,
-    0x6c,0x61,0x73,0x73,0x3d,0x22,0x74,0x78,0x74,0x2d,0x73,0x74,0x61,0x74,0x75,0x73,
-    0x22,0x3e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,
-    0x75,0x74,0x74,0x6f,0x6e,0x20,0x69,0x64,0x3d,0x22,0x62,0x74,0x6e,0x53,0x74,0x72,
-    0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x43,0x61,0x6e,0x63,0x65,0x6c,0x22,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,0x64,
-    0x65,0x66,0x61,0x75,0x6c,0x74,0x20,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x22,
-    0x20,0x74,0x69,0x74,0x6c,0x65,0x3d,0x22,0x43,0x61,0x6e,0x63,0x65,0x6c,0x20,0x75,
-    0x70,0x6c,0x6f,0x61,0x64,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,
-    0x62,0x74,0x6e,0x53,0x74,0x72,0x65,0x61,0x6d,0x47,0x43,0x6f,0x64,0x65,0x43,0x61,
-    0x6e,0x63,0x65,0x6c,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x22,0x20,0x64,0x69,0x73,
-    0x61,0x62,0x6c,0x65,0x64,0x3d,0x22,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x22,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x76,0x67,0x20,0x63,
-    0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x61,0x63,0x74,0x69,0x6f,
-    0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,
-    0x22,0x23,0x69,0x63,0x6f,0x2d,0x63,0x6e,0x63,0x6c,0x22,0x3e,0x3c,0x2f,0x75,0x73,
-    0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x76,0x67,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,
-    0x43,0x61,0x6e,0x63,0x65,0x6c,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,
-    0x76,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x64,0x69,0x76,0x3e,0x0a,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x75,
-    0x69,0x42,0x6c,0x6f,0x63,0x6b,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,
-    0x61,0x73,0x73,0x3d,0x22,0x75,0x69,0x46,0x6f,0x72,0x6d,0x22,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,
-    0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,
-    0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x20,0x6f,
-    0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x70,0x61,0x75,0x73,0x65,0x52,0x6f,0x62,
-    0x6f,0x74,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-    0x69,0x63,0x6f,0x6e,0x2d,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x22,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x75,0x73,0x65,0x20,
-    0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,
-    0x2d,0x70,0x61,0x75,0x73,0x65,0x22,0x3e,0x3c,0x2f,0x75,0x73,0x65,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x50,0x61,0x75,0x73,
-    0x65,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x62,
-    0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x75,0x74,0x74,
-    0x6f,0x6e,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,
-    0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,
-    0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,
-    0x22,0x72,0x65,0x73,0x75,0x6d,0x65,0x52,0x6f,0x62,0x6f,0x74,0x28,0x65,0x76,0x65,
-    0x6e,0x74,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,
-    0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x63,
-    0x6f,0x6e,0x6e,0x65,0x63,0x74,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,
-    0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x70,0x6c,0x61,0x79,0x22,
-    0x3e,0x3c,0x2f,0x75,0x73,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x73,0x70,0x61,0x6e,0x3e,0x52,0x65,0x73,0x75,0x6d,0x65,0x3c,0x2f,0x73,0x70,0x61,
-    0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x74,0x79,0x70,
-    0x65,0x3d,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,
-    0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x73,0x74,0x6f,0x70,0x52,
-    0x6f,0x62,0x6f,0x74,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x22,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x22,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x75,0x73,
-    0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x69,
-    0x63,0x6f,0x2d,0x73,0x74,0x6f,0x70,0x22,0x3e,0x3c,0x2f,0x75,0x73,0x65,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x53,0x74,0x6f,
-    0x70,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x62,
-    0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x22,0x75,0x69,0x4c,0x69,0x6e,0x65,0x42,0x6c,0x6f,0x63,0x6b,0x22,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,
-    0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x75,0x69,0x42,0x6c,0x6f,0x63,
-    0x6b,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-    0x75,0x69,0x50,0x61,0x6e,0x65,0x6c,0x20,0x75,0x69,0x50,0x61,0x6e,0x65,0x6c,0x4d,
-    0x6f,0x76,0x65,0x6d,0x65,0x6e,0x74,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,
-    0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x75,0x69,0x50,0x61,0x6e,0x65,
-    0x6c,0x48,0x65,0x61,0x64,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x73,0x70,0x61,0x6e,0x3e,0x4d,0x6f,0x76,0x65,0x6d,0x65,0x6e,0x74,0x3c,0x2f,
-    0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-    0x22,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x20,0x75,0x69,0x54,0x62,0x6c,0x42,0x74,
-    0x6e,0x73,0x20,0x74,0x61,0x62,0x6c,0x65,0x4d,0x6f,0x76,0x65,0x6d,0x65,0x6e,0x74,
-    0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x72,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x64,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x68,0x6f,0x6d,0x65,0x2d,0x62,0x75,0x74,0x74,
-    0x6f,0x6e,0x73,0x20,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x2d,0x6c,0x67,0x22,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,
-    0x2d,0x67,0x72,0x6f,0x75,0x70,0x20,0x65,0x78,0x74,0x72,0x61,0x2d,0x73,0x70,0x61,
-    0x63,0x65,0x2d,0x61,0x62,0x6f,0x76,0x65,0x22,0x20,0x72,0x6f,0x6c,0x65,0x3d,0x22,
-    0x67,0x72,0x6f,0x75,0x70,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x75,0x74,
-    0x74,0x6f,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,
-    0x74,0x6e,0x2d,0x70,0x72,0x69,0x6d,0x61,0x72,0x79,0x22,0x20,0x74,0x69,0x74,0x6c,
-    0x65,0x3d,0x22,0x48,0x6f,0x6d,0x65,0x20,0x41,0x6c,0x6c,0x20,0x28,0x47,0x32,0x38,
-    0x29,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x67,0x6f,0x48,0x6f,
-    0x6d,0x65,0x43,0x6c,0x69,0x63,0x6b,0x28,0x2d,0x31,0x29,0x22,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x48,0x6f,0x6d,0x65,
-    0x20,0x41,0x6c,0x6c,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,
-    0x75,0x74,0x74,0x6f,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,
-    0x20,0x62,0x74,0x6e,0x2d,0x70,0x72,0x69,0x6d,0x61,0x72,0x79,0x22,0x20,0x74,0x69,
-    0x74,0x6c,0x65,0x3d,0x22,0x48,0x6f,0x6d,0x65,0x20,0x58,0x20,0x61,0x78,0x69,0x73,
-    0x20,0x28,0x47,0x32,0x38,0x20,0x58,0x29,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,
-    0x6b,0x3d,0x22,0x67,0x6f,0x48,0x6f,0x6d,0x65,0x43,0x6c,0x69,0x63,0x6b,0x28,0x30,
-    0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,
-    0x6e,0x3e,0x47,0x6f,0x20,0x48,0x6f,0x6d,0x65,0x20,0x58,0x3c,0x2f,0x73,0x70,0x61,
-    0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,0x70,0x72,0x69,0x6d,
-    0x61,0x72,0x79,0x22,0x20,0x74,0x69,0x74,0x6c,0x65,0x3d,0x22,0x48,0x6f,0x6d,0x65,
-    0x20,0x58,0x20,0x61,0x78,0x69,0x73,0x20,0x28,0x47,0x39,0x32,0x20,0x58,0x29,0x22,
-    0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x73,0x65,0x74,0x48,0x6f,0x6d,
-    0x65,0x43,0x6c,0x69,0x63,0x6b,0x28,0x30,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x53,0x65,0x74,0x20,0x48,0x6f,
-    0x6d,0x65,0x20,0x58,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,
-    0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x74,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-    0x62,0x74,0x6e,0x2d,0x67,0x72,0x6f,0x75,0x70,0x20,0x62,0x74,0x6e,0x2d,0x67,0x72,
-    0x6f,0x75,0x70,0x2d,0x6a,0x75,0x73,0x74,0x69,0x66,0x69,0x65,0x64,0x22,0x20,0x72,
-    0x6f,0x6c,0x65,0x3d,0x22,0x67,0x72,0x6f,0x75,0x70,0x22,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x61,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,
-    0x74,0x6e,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x20,0x6f,0x6e,0x63,0x6c,
-    0x69,0x63,0x6b,0x3d,0x22,0x6d,0x6f,0x76,0x65,0x43,0x6c,0x69,0x63,0x6b,0x28,0x30,
-    0x2c,0x2d,0x31,0x30,0x30,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,
-    0x6e,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,
-    0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x6c,0x63,0x22,
-    0x3e,0x3c,0x2f,0x75,0x73,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x73,0x70,0x61,0x6e,0x3e,0x58,0x2d,0x31,0x30,0x30,0x3c,0x2f,0x73,0x70,0x61,0x6e,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x61,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x61,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,
-    0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,
-    0x6b,0x3d,0x22,0x6d,0x6f,0x76,0x65,0x43,0x6c,0x69,0x63,0x6b,0x28,0x30,0x2c,0x2d,
-    0x31,0x30,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,
-    0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x61,
-    0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,
-    0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x6c,0x63,0x22,0x3e,0x3c,0x2f,
-    0x75,0x73,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,
-    0x76,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,
-    0x6e,0x3e,0x58,0x2d,0x31,0x30,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x61,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x61,0x20,0x63,0x6c,
-    0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,0x64,0x65,0x66,
-    0x61,0x75,0x6c,0x74,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x6d,
-    0x6f,0x76,0x65,0x43,0x6c,0x69,0x63,0x6b,0x28,0x30,0x2c,0x2d,0x31,0x29,0x22,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,
-    0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,
-    0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,
-    0x23,0x69,0x63,0x6f,0x2d,0x6c,0x63,0x22,0x3e,0x3c,0x2f,0x75,0x73,0x65,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x58,0x2d,0x31,
-    0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x61,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x61,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,
-    0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x20,
-    0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x6d,0x6f,0x76,0x65,0x43,0x6c,0x69,
-    0x63,0x6b,0x28,0x30,0x2c,0x2d,0x2e,0x31,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-    0x69,0x63,0x6f,0x6e,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x75,0x73,0x65,0x20,0x78,
-    0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,
-    0x6c,0x63,0x22,0x3e,0x3c,0x2f,0x75,0x73,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x58,0x2d,0x30,0x2e,0x31,0x3c,0x2f,0x73,
-    0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x61,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x64,0x69,0x76,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x74,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x2d,0x67,0x72,0x6f,0x75,0x70,0x20,0x62,0x74,
-    0x6e,0x2d,0x67,0x72,0x6f,0x75,0x70,0x2d,0x6a,0x75,0x73,0x74,0x69,0x66,0x69,0x65,
-    0x64,0x22,0x20,0x72,0x6f,0x6c,0x65,0x3d,0x22,0x67,0x72,0x6f,0x75,0x70,0x22,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x61,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,
-    0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x20,
-    0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x6d,0x6f,0x76,0x65,0x43,0x6c,0x69,
-    0x63,0x6b,0x28,0x30,0x2c,0x2e,0x31,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x58,0x2b,0x30,0x2e,0x31,0x3c,0x2f,
-    0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,
-    0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x61,
-    0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,
-    0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x72,0x63,0x22,0x3e,0x3c,0x2f,
-    0x75,0x73,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,
-    0x76,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x61,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x61,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,
-    0x74,0x6e,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x20,0x6f,0x6e,0x63,0x6c,
-    0x69,0x63,0x6b,0x3d,0x22,0x6d,0x6f,0x76,0x65,0x43,0x6c,0x69,0x63,0x6b,0x28,0x30,
-    0x2c,0x31,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,
-    0x70,0x61,0x6e,0x3e,0x58,0x2b,0x31,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x75,0x73,
-    0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x69,
-    0x63,0x6f,0x2d,0x72,0x63,0x22,0x3e,0x3c,0x2f,0x75,0x73,0x65,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x61,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x61,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,0x64,0x65,0x66,0x61,
-    0x75,0x6c,0x74,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x6d,0x6f,
-    0x76,0x65,0x43,0x6c,0x69,0x63,0x6b,0x28,0x30,0x2c,0x31,0x30,0x29,0x22,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x58,0x2b,
-    0x31,0x30,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,
-    0x6f,0x6e,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,
-    0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x72,0x63,
-    0x22,0x3e,0x3c,0x2f,0x75,0x73,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x61,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x61,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,
-    0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x20,
-    0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x6d,0x6f,0x76,0x65,0x43,0x6c,0x69,
-    0x63,0x6b,0x28,0x30,0x2c,0x31,0x30,0x30,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x58,0x2b,0x31,0x30,0x30,0x3c,
-    0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,
-    0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,
-    0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x72,0x63,0x22,0x3e,
-    0x3c,0x2f,0x75,0x73,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x73,0x76,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x61,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x64,0x69,0x76,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x74,0x72,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,
-    0x72,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x74,0x64,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x68,0x6f,0x6d,0x65,0x2d,0x62,
-    0x75,0x74,0x74,0x6f,0x6e,0x73,0x20,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x2d,0x6c,
-    0x67,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-    0x62,0x74,0x6e,0x2d,0x67,0x72,0x6f,0x75,0x70,0x22,0x20,0x72,0x6f,0x6c,0x65,0x3d,
-    0x22,0x67,0x72,0x6f,0x75,0x70,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x75,
-    0x74,0x74,0x6f,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,
-    0x62,0x74,0x6e,0x2d,0x70,0x72,0x69,0x6d,0x61,0x72,0x79,0x22,0x20,0x74,0x69,0x74,
-    0x6c,0x65,0x3d,0x22,0x48,0x6f,0x6d,0x65,0x20,0x59,0x20,0x61,0x78,0x69,0x73,0x20,
-    0x28,0x47,0x32,0x38,0x20,0x59,0x29,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,
-    0x3d,0x22,0x67,0x6f,0x48,0x6f,0x6d,0x65,0x43,0x6c,0x69,0x63,0x6b,0x28,0x31,0x29,
-    0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,
-    0x3e,0x47,0x6f,0x20,0x48,0x6f,0x6d,0x65,0x20,0x59,0x3c,0x2f,0x73,0x70,0x61,0x6e,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,0x70,0x72,0x69,0x6d,0x61,
-    0x72,0x79,0x22,0x20,0x74,0x69,0x74,0x6c,0x65,0x3d,0x22,0x48,0x6f,0x6d,0x65,0x20,
-    0x59,0x20,0x61,0x78,0x69,0x73,0x20,0x28,0x47,0x39,0x32,0x20,0x59,0x29,0x22,0x20,
-    0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x73,0x65,0x74,0x48,0x6f,0x6d,0x65,
-    0x43,0x6c,0x69,0x63,0x6b,0x28,0x31,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x53,0x65,0x74,0x20,0x48,0x6f,0x6d,
-    0x65,0x20,0x59,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,
-    0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,
-    0x74,0x6e,0x2d,0x67,0x72,0x6f,0x75,0x70,0x20,0x62,0x74,0x6e,0x2d,0x67,0x72,0x6f,
-    0x75,0x70,0x2d,0x6a,0x75,0x73,0x74,0x69,0x66,0x69,0x65,0x64,0x22,0x20,0x72,0x6f,
-    0x6c,0x65,0x3d,0x22,0x67,0x72,0x6f,0x75,0x70,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x61,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,
-    0x6e,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,
-    0x63,0x6b,0x3d,0x22,0x6d,0x6f,0x76,0x65,0x43,0x6c,0x69,0x63,0x6b,0x28,0x31,0x2c,
-    0x2d,0x31,0x30,0x30,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,
-    0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,
-    0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x6c,0x63,0x22,0x3e,
-    0x3c,0x2f,0x75,0x73,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x73,0x76,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,
-    0x70,0x61,0x6e,0x3e,0x59,0x2d,0x31,0x30,0x30,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x61,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x61,
-    0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,
-    0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,
-    0x3d,0x22,0x6d,0x6f,0x76,0x65,0x43,0x6c,0x69,0x63,0x6b,0x28,0x31,0x2c,0x2d,0x31,
-    0x30,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x76,
-    0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x61,0x63,
-    0x74,0x69,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,
-    0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x6c,0x63,0x22,0x3e,0x3c,0x2f,0x75,
-    0x73,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x76,
-    0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,
-    0x3e,0x59,0x2d,0x31,0x30,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x61,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x61,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,0x64,0x65,0x66,0x61,
-    0x75,0x6c,0x74,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x6d,0x6f,
-    0x76,0x65,0x43,0x6c,0x69,0x63,0x6b,0x28,0x31,0x2c,0x2d,0x31,0x29,0x22,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x75,
-    0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,
-    0x69,0x63,0x6f,0x2d,0x6c,0x63,0x22,0x3e,0x3c,0x2f,0x75,0x73,0x65,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x59,0x2d,0x31,0x3c,
-    0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x61,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x61,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,
-    0x6e,0x20,0x62,0x74,0x6e,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x20,0x6f,
-    0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x6d,0x6f,0x76,0x65,0x43,0x6c,0x69,0x63,
-    0x6b,0x28,0x31,0x2c,0x2d,0x2e,0x31,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,
-    0x63,0x6f,0x6e,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,
-    0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x6c,
-    0x63,0x22,0x3e,0x3c,0x2f,0x75,0x73,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x59,0x2d,0x30,0x2e,0x31,0x3c,0x2f,0x73,0x70,
-    0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x61,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,
-    0x69,0x76,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x74,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x22,0x62,0x74,0x6e,0x2d,0x67,0x72,0x6f,0x75,0x70,0x20,0x62,0x74,0x6e,
-    0x2d,0x67,0x72,0x6f,0x75,0x70,0x2d,0x6a,0x75,0x73,0x74,0x69,0x66,0x69,0x65,0x64,
-    0x22,0x20,0x72,0x6f,0x6c,0x65,0x3d,0x22,0x67,0x72,0x6f,0x75,0x70,0x22,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x61,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,
-    0x6e,0x20,0x62,0x74,0x6e,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x20,0x6f,
-    0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x6d,0x6f,0x76,0x65,0x43,0x6c,0x69,0x63,
-    0x6b,0x28,0x31,0x2c,0x2e,0x31,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x59,0x2b,0x30,0x2e,0x31,0x3c,0x2f,0x73,
-    0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x76,
-    0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x61,0x63,
-    0x74,0x69,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,
-    0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x72,0x63,0x22,0x3e,0x3c,0x2f,0x75,
-    0x73,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x76,
-    0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x61,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x61,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,
-    0x6e,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,
-    0x63,0x6b,0x3d,0x22,0x6d,0x6f,0x76,0x65,0x43,0x6c,0x69,0x63,0x6b,0x28,0x31,0x2c,
-    0x31,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,
-    0x61,0x6e,0x3e,0x59,0x2b,0x31,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x75,0x73,0x65,
-    0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,
-    0x6f,0x2d,0x72,0x63,0x22,0x3e,0x3c,0x2f,0x75,0x73,0x65,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x61,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x61,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,0x64,0x65,0x66,0x61,0x75,
-    0x6c,0x74,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x6d,0x6f,0x76,
-    0x65,0x43,0x6c,0x69,0x63,0x6b,0x28,0x31,0x2c,0x31,0x30,0x29,0x22,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x59,0x2b,0x31,
-    0x30,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,
-    0x6e,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,
-    0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x72,0x63,0x22,
-    0x3e,0x3c,0x2f,0x75,0x73,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x61,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x61,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,
-    0x6e,0x20,0x62,0x74,0x6e,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x20,0x6f,
-    0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x6d,0x6f,0x76,0x65,0x43,0x6c,0x69,0x63,
-    0x6b,0x28,0x31,0x2c,0x31,0x30,0x30,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x59,0x2b,0x31,0x30,0x30,0x3c,0x2f,
-    0x73,0x70,0x61,0x6e,0x3e,0x0a,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x73,0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,
-    0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,
-    0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x72,0x63,0x22,0x3e,0x3c,
-    0x2f,0x75,0x73,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x73,0x76,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x61,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x64,0x69,0x76,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x74,0x72,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x72,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,
-    0x64,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x68,0x6f,0x6d,0x65,0x2d,0x62,0x75,
-    0x74,0x74,0x6f,0x6e,0x73,0x20,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x2d,0x6c,0x67,
-    0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,
-    0x74,0x6e,0x2d,0x67,0x72,0x6f,0x75,0x70,0x22,0x20,0x72,0x6f,0x6c,0x65,0x3d,0x22,
-    0x67,0x72,0x6f,0x75,0x70,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x75,0x74,
-    0x74,0x6f,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,
-    0x74,0x6e,0x2d,0x70,0x72,0x69,0x6d,0x61,0x72,0x79,0x22,0x20,0x74,0x69,0x74,0x6c,
-    0x65,0x3d,0x22,0x48,0x6f,0x6d,0x65,0x20,0x5a,0x20,0x61,0x78,0x69,0x73,0x20,0x28,
-    0x47,0x32,0x38,0x20,0x5a,0x29,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,
-    0x22,0x67,0x6f,0x48,0x6f,0x6d,0x65,0x43,0x6c,0x69,0x63,0x6b,0x28,0x32,0x29,0x22,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,
-    0x47,0x6f,0x20,0x48,0x6f,0x6d,0x65,0x20,0x5a,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,0x70,0x72,0x69,0x6d,0x61,0x72,
-    0x79,0x22,0x20,0x74,0x69,0x74,0x6c,0x65,0x3d,0x22,0x48,0x6f,0x6d,0x65,0x20,0x5a,
-    0x20,0x61,0x78,0x69,0x73,0x20,0x28,0x47,0x39,0x32,0x20,0x5a,0x29,0x22,0x20,0x6f,
-    0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x73,0x65,0x74,0x48,0x6f,0x6d,0x65,0x43,
-    0x6c,0x69,0x63,0x6b,0x28,0x32,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x53,0x65,0x74,0x20,0x48,0x6f,0x6d,0x65,
-    0x20,0x5a,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x64,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,
-    0x6e,0x2d,0x67,0x72,0x6f,0x75,0x70,0x20,0x62,0x74,0x6e,0x2d,0x67,0x72,0x6f,0x75,
-    0x70,0x2d,0x6a,0x75,0x73,0x74,0x69,0x66,0x69,0x65,0x64,0x22,0x20,0x72,0x6f,0x6c,
-    0x65,0x3d,0x22,0x67,0x72,0x6f,0x75,0x70,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x61,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,
-    0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,
-    0x6b,0x3d,0x22,0x6d,0x6f,0x76,0x65,0x43,0x6c,0x69,0x63,0x6b,0x28,0x32,0x2c,0x2d,
-    0x31,0x30,0x30,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x73,0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,
-    0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,
-    0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x6c,0x63,0x22,0x3e,0x3c,
-    0x2f,0x75,0x73,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x73,0x76,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,
-    0x61,0x6e,0x3e,0x5a,0x2d,0x31,0x30,0x30,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x61,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x61,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,0x64,
-    0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,
-    0x22,0x6d,0x6f,0x76,0x65,0x43,0x6c,0x69,0x63,0x6b,0x28,0x32,0x2c,0x2d,0x31,0x30,
-    0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x76,0x67,
-    0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x61,0x63,0x74,
-    0x69,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,
-    0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x6c,0x63,0x22,0x3e,0x3c,0x2f,0x75,0x73,
-    0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x76,0x67,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,
-    0x5a,0x2d,0x31,0x30,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x61,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x61,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,0x64,0x65,0x66,0x61,0x75,
-    0x6c,0x74,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x6d,0x6f,0x76,
-    0x65,0x43,0x6c,0x69,0x63,0x6b,0x28,0x32,0x2c,0x2d,0x31,0x29,0x22,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x75,0x73,
-    0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x69,
-    0x63,0x6f,0x2d,0x6c,0x63,0x22,0x3e,0x3c,0x2f,0x75,0x73,0x65,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x5a,0x2d,0x31,0x3c,0x2f,
-    0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x61,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x61,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,
-    0x20,0x62,0x74,0x6e,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x20,0x6f,0x6e,
-    0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x6d,0x6f,0x76,0x65,0x43,0x6c,0x69,0x63,0x6b,
-    0x28,0x32,0x2c,0x2d,0x2e,0x31,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,
-    0x6f,0x6e,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,
-    0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x6c,0x63,
-    0x22,0x3e,0x3c,0x2f,0x75,0x73,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x73,0x70,0x61,0x6e,0x3e,0x5a,0x2d,0x30,0x2e,0x31,0x3c,0x2f,0x73,0x70,0x61,
-    0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x61,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,
-    0x76,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x74,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x74,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x22,0x62,0x74,0x6e,0x2d,0x67,0x72,0x6f,0x75,0x70,0x20,0x62,0x74,0x6e,0x2d,
-    0x67,0x72,0x6f,0x75,0x70,0x2d,0x6a,0x75,0x73,0x74,0x69,0x66,0x69,0x65,0x64,0x22,
-    0x20,0x72,0x6f,0x6c,0x65,0x3d,0x22,0x67,0x72,0x6f,0x75,0x70,0x22,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x61,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,
-    0x20,0x62,0x74,0x6e,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x20,0x6f,0x6e,
-    0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x6d,0x6f,0x76,0x65,0x43,0x6c,0x69,0x63,0x6b,
-    0x28,0x32,0x2c,0x2e,0x31,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x5a,0x2b,0x30,0x2e,0x31,0x3c,0x2f,0x73,0x70,
-    0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x76,0x67,
-    0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x61,0x63,0x74,
-    0x69,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,
-    0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x72,0x63,0x22,0x3e,0x3c,0x2f,0x75,0x73,
-    0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x76,0x67,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x61,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x61,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,
-    0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,
-    0x6b,0x3d,0x22,0x6d,0x6f,0x76,0x65,0x43,0x6c,0x69,0x63,0x6b,0x28,0x32,0x2c,0x31,
-    0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,
-    0x6e,0x3e,0x5a,0x2b,0x31,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-    0x22,0x69,0x63,0x6f,0x6e,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x75,0x73,0x65,0x20,
-    0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,
-    0x2d,0x72,0x63,0x22,0x3e,0x3c,0x2f,0x75,0x73,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x61,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x61,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,
-    0x74,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x6d,0x6f,0x76,0x65,
-    0x43,0x6c,0x69,0x63,0x6b,0x28,0x32,0x2c,0x31,0x30,0x29,0x22,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x5a,0x2b,0x31,0x30,
-    0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,
-    0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,
-    0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x72,0x63,0x22,0x3e,
-    0x3c,0x2f,0x75,0x73,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x73,0x76,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x61,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x61,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,
-    0x20,0x62,0x74,0x6e,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x20,0x6f,0x6e,
-    0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x6d,0x6f,0x76,0x65,0x43,0x6c,0x69,0x63,0x6b,
-    0x28,0x32,0x2c,0x31,0x30,0x30,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x5a,0x2b,0x31,0x30,0x30,0x3c,0x2f,0x73,
-    0x70,0x61,0x6e,0x3e,0x0a,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,
-    0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x61,
-    0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,
-    0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x72,0x63,0x22,0x3e,0x3c,0x2f,
-    0x75,0x73,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,
-    0x76,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x61,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,
-    0x69,0x76,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x74,0x72,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x64,0x69,0x76,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-    0x22,0x75,0x69,0x42,0x6c,0x6f,0x63,0x6b,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x75,0x69,0x50,0x61,0x6e,0x65,0x6c,0x22,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-    0x22,0x75,0x69,0x50,0x61,0x6e,0x65,0x6c,0x48,0x65,0x61,0x64,0x22,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x53,0x74,0x61,
-    0x74,0x75,0x73,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x64,0x69,0x76,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x61,0x62,0x6c,0x65,
-    0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x20,
-    0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x47,0x72,0x69,0x64,0x20,0x75,0x69,0x54,0x61,
-    0x62,0x6c,0x65,0x53,0x74,0x61,0x74,0x75,0x73,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x74,0x72,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-    0x74,0x68,0x2d,0x73,0x74,0x61,0x74,0x75,0x73,0x22,0x3e,0x3c,0x2f,0x74,0x68,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,
-    0x20,0x69,0x64,0x3d,0x22,0x74,0x68,0x5f,0x58,0x22,0x3e,0x58,0x3c,0x2f,0x74,0x68,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,
-    0x68,0x20,0x69,0x64,0x3d,0x22,0x74,0x68,0x5f,0x59,0x22,0x3e,0x59,0x3c,0x2f,0x74,
-    0x68,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x74,0x68,0x20,0x69,0x64,0x3d,0x22,0x74,0x68,0x5f,0x5a,0x22,0x20,0x73,0x74,0x79,
-    0x6c,0x65,0x3d,0x22,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x69,0x67,0x68,0x74,
-    0x3a,0x31,0x70,0x78,0x22,0x3e,0x5a,0x3c,0x2f,0x74,0x68,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x72,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x74,0x72,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x74,
-    0x68,0x2d,0x73,0x74,0x61,0x74,0x75,0x73,0x22,0x3e,0x50,0x6f,0x73,0x69,0x74,0x69,
-    0x6f,0x6e,0x3c,0x2f,0x74,0x68,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x74,0x64,0x20,0x69,0x64,0x3d,0x22,0x74,0x64,0x5f,0x58,
-    0x22,0x3e,0x6e,0x2f,0x61,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x64,0x20,0x69,0x64,0x3d,0x22,0x74,
-    0x64,0x5f,0x59,0x22,0x3e,0x6e,0x2f,0x61,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x64,0x20,0x69,0x64,
-    0x3d,0x22,0x74,0x64,0x5f,0x5a,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x62,
-    0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x69,0x67,0x68,0x74,0x3a,0x31,0x70,0x78,0x22,
-    0x3e,0x6e,0x2f,0x61,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x74,0x72,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x74,0x72,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x74,0x68,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x74,0x68,0x2d,0x73,
-    0x74,0x61,0x74,0x75,0x73,0x22,0x3e,0x53,0x74,0x65,0x70,0x73,0x3c,0x2f,0x74,0x68,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,
-    0x64,0x20,0x69,0x64,0x3d,0x22,0x74,0x64,0x5f,0x73,0x74,0x65,0x70,0x58,0x22,0x3e,
-    0x6e,0x2f,0x61,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x64,0x20,0x69,0x64,0x3d,0x22,0x74,0x64,0x5f,
-    0x73,0x74,0x65,0x70,0x59,0x22,0x3e,0x6e,0x2f,0x61,0x3c,0x2f,0x74,0x64,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x64,0x20,
-    0x69,0x64,0x3d,0x22,0x74,0x64,0x5f,0x73,0x74,0x65,0x70,0x5a,0x22,0x20,0x73,0x74,
-    0x79,0x6c,0x65,0x3d,0x22,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x69,0x67,0x68,
-    0x74,0x3a,0x31,0x70,0x78,0x22,0x3e,0x6e,0x2f,0x61,0x3c,0x2f,0x74,0x64,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x72,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x72,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x22,0x74,0x68,0x2d,0x73,0x74,0x61,0x74,0x75,0x73,0x22,0x3e,0x4d,0x69,0x6e,
-    0x2d,0x73,0x74,0x6f,0x70,0x3c,0x2f,0x74,0x68,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x64,0x20,0x69,0x64,0x3d,0x22,0x74,
-    0x64,0x5f,0x6d,0x69,0x6e,0x58,0x22,0x3e,0x6e,0x2f,0x61,0x3c,0x2f,0x74,0x64,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x64,
-    0x20,0x69,0x64,0x3d,0x22,0x74,0x64,0x5f,0x6d,0x69,0x6e,0x59,0x22,0x3e,0x6e,0x2f,
-    0x61,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x74,0x64,0x20,0x69,0x64,0x3d,0x22,0x74,0x64,0x5f,0x6d,0x69,
-    0x6e,0x5a,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x62,0x6f,0x72,0x64,0x65,
-    0x72,0x2d,0x72,0x69,0x67,0x68,0x74,0x3a,0x31,0x70,0x78,0x22,0x3e,0x6e,0x2f,0x61,
-    0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x74,0x72,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x72,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,
-    0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x74,0x68,0x2d,0x73,0x74,0x61,0x74,0x75,
-    0x73,0x22,0x3e,0x4d,0x61,0x78,0x2d,0x73,0x74,0x6f,0x70,0x3c,0x2f,0x74,0x68,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x64,
-    0x20,0x69,0x64,0x3d,0x22,0x74,0x64,0x5f,0x6d,0x61,0x78,0x58,0x22,0x3e,0x6e,0x2f,
-    0x61,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x74,0x64,0x20,0x69,0x64,0x3d,0x22,0x74,0x64,0x5f,0x6d,0x61,
-    0x78,0x59,0x22,0x3e,0x6e,0x2f,0x61,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x64,0x20,0x69,0x64,0x3d,
-    0x22,0x74,0x64,0x5f,0x6d,0x61,0x78,0x5a,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
-    0x22,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x69,0x67,0x68,0x74,0x3a,0x31,0x70,
-    0x78,0x22,0x3e,0x6e,0x2f,0x61,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x72,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x74,0x72,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x74,0x68,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x74,0x68,
-    0x2d,0x73,0x74,0x61,0x74,0x75,0x73,0x22,0x3e,0x53,0x74,0x61,0x74,0x65,0x3c,0x2f,
-    0x74,0x68,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x74,0x64,0x20,0x69,0x64,0x3d,0x22,0x74,0x64,0x5f,0x72,0x6f,0x62,0x6f,0x74,
-    0x53,0x74,0x61,0x74,0x65,0x22,0x20,0x63,0x6f,0x6c,0x73,0x70,0x61,0x6e,0x3d,0x22,
-    0x33,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x62,0x6f,0x72,0x64,0x65,0x72,
-    0x2d,0x72,0x69,0x67,0x68,0x74,0x3a,0x31,0x70,0x78,0x22,0x3e,0x3c,0x2f,0x74,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x72,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x72,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x22,0x74,0x68,0x2d,0x73,0x74,0x61,0x74,0x75,0x73,0x22,0x3e,0x51,
-    0x75,0x65,0x75,0x65,0x4c,0x65,0x6e,0x3c,0x2f,0x74,0x68,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x64,0x20,0x69,0x64,0x3d,
-    0x22,0x74,0x64,0x5f,0x72,0x6f,0x62,0x6f,0x74,0x51,0x75,0x65,0x75,0x65,0x4c,0x65,
-    0x6e,0x22,0x20,0x63,0x6f,0x6c,0x73,0x70,0x61,0x6e,0x3d,0x22,0x33,0x22,0x20,0x73,
-    0x74,0x79,0x6c,0x65,0x3d,0x22,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x69,0x67,
-    0x68,0x74,0x3a,0x31,0x70,0x78,0x22,0x3e,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x72,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x74,0x61,0x62,0x6c,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,
-    0x69,0x76,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,
-    0x76,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x75,0x69,0x4c,0x69,0x6e,0x65,0x42,0x6c,0x6f,
-    0x63,0x6b,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x75,0x69,0x42,
-    0x6c,0x6f,0x63,0x6b,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x22,0x75,0x69,0x50,0x61,0x6e,0x65,0x6c,0x20,0x66,0x69,0x6c,0x65,0x2d,
-    0x75,0x70,0x6c,0x6f,0x61,0x64,0x2d,0x66,0x6f,0x72,0x6d,0x22,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x75,0x69,
-    0x50,0x61,0x6e,0x65,0x6c,0x48,0x65,0x61,0x64,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x46,0x69,0x6c,0x65,0x73,0x3c,
-    0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x69,0x64,0x3d,0x22,0x62,0x74,0x6e,0x55,0x70,
-    0x6c,0x6f,0x61,0x64,0x46,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x22,0x20,0x63,0x6c,
-    0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,0x68,0x65,0x61,
-    0x64,0x69,0x6e,0x67,0x22,0x20,0x74,0x69,0x74,0x6c,0x65,0x3d,0x22,0x55,0x70,0x6c,
-    0x6f,0x61,0x64,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x62,0x74,
-    0x6e,0x55,0x70,0x6c,0x6f,0x61,0x64,0x54,0x6f,0x46,0x69,0x6c,0x65,0x53,0x79,0x73,
-    0x74,0x65,0x6d,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x55,
-    0x70,0x6c,0x6f,0x61,0x64,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x22,0x62,0x74,0x6e,0x2d,0x63,0x6c,0x65,0x61,0x72,0x22,0x3e,0x3c,0x2f,
-    0x64,0x69,0x76,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x22,0x66,0x69,0x6c,
-    0x65,0x2d,0x73,0x79,0x73,0x74,0x65,0x6d,0x2d,0x69,0x6e,0x66,0x6f,0x22,0x20,0x63,
-    0x6c,0x61,0x73,0x73,0x3d,0x22,0x75,0x69,0x50,0x61,0x6e,0x65,0x6c,0x53,0x75,0x62,
-    0x22,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,
-    0x2f,0x64,0x69,0x76,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x67,0x72,
-    0x65,0x73,0x73,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x70,0x72,0x6f,0x67,0x72,
-    0x65,0x73,0x73,0x2d,0x66,0x69,0x6c,0x65,0x22,0x20,0x69,0x64,0x3d,0x22,0x70,0x72,
-    0x6f,0x67,0x72,0x65,0x73,0x73,0x2d,0x62,0x61,0x72,0x2d,0x66,0x69,0x6c,0x65,0x22,
-    0x20,0x6d,0x61,0x78,0x3d,0x22,0x31,0x30,0x30,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,
-    0x3d,0x22,0x32,0x30,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x64,0x69,0x73,
-    0x70,0x6c,0x61,0x79,0x3a,0x6e,0x6f,0x6e,0x65,0x22,0x3e,0x3c,0x2f,0x70,0x72,0x6f,
-    0x67,0x72,0x65,0x73,0x73,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x61,0x62,0x6c,
-    0x65,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,
-    0x20,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x42,0x6f,0x72,0x64,0x65,0x72,0x65,0x64,
-    0x20,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x46,0x69,0x6c,0x65,0x73,0x20,0x75,0x69,
-    0x54,0x61,0x62,0x6c,0x65,0x53,0x74,0x72,0x69,0x70,0x65,0x22,0x20,0x69,0x64,0x3d,
-    0x22,0x74,0x61,0x62,0x6c,0x65,0x5f,0x66,0x69,0x6c,0x65,0x73,0x22,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x65,0x61,0x64,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x72,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x74,0x68,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x22,0x20,
-    0x64,0x61,0x74,0x61,0x2d,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x3d,0x22,
-    0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x41,0x63,0x74,0x69,0x6f,0x6e,0x73,0x3c,
-    0x2f,0x61,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x68,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x3e,0x3c,0x61,
-    0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x22,0x20,0x64,0x61,0x74,0x61,0x2d,0x61,
-    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x3d,0x22,0x66,0x69,0x6c,0x65,0x6e,0x61,
-    0x6d,0x65,0x22,0x3e,0x46,0x69,0x6c,0x65,0x20,0x4e,0x61,0x6d,0x65,0x3c,0x2f,0x61,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x74,0x68,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x3e,0x3c,0x61,0x20,0x68,
-    0x72,0x65,0x66,0x3d,0x22,0x23,0x22,0x20,0x64,0x61,0x74,0x61,0x2d,0x61,0x74,0x74,
-    0x72,0x69,0x62,0x75,0x74,0x65,0x3d,0x22,0x73,0x69,0x7a,0x65,0x22,0x3e,0x53,0x69,
-    0x7a,0x65,0x3c,0x2f,0x61,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x68,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x72,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x68,0x65,0x61,0x64,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x62,0x6f,0x64,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x61,0x62,0x6c,0x65,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x64,0x69,0x76,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x75,0x69,0x4c,0x69,0x6e,
-    0x65,0x42,0x6c,0x6f,0x63,0x6b,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-    0x22,0x75,0x69,0x42,0x6c,0x6f,0x63,0x6b,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x75,0x69,0x50,0x61,0x6e,0x65,0x6c,0x22,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-    0x22,0x75,0x69,0x50,0x61,0x6e,0x65,0x6c,0x48,0x65,0x61,0x64,0x22,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x53,0x65,0x74,
-    0x74,0x69,0x6e,0x67,0x73,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x69,0x64,0x3d,
-    0x22,0x62,0x74,0x6e,0x53,0x61,0x76,0x65,0x43,0x6f,0x6e,0x66,0x69,0x67,0x22,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,0x68,
-    0x65,0x61,0x64,0x69,0x6e,0x67,0x22,0x20,0x74,0x69,0x74,0x6c,0x65,0x3d,0x22,0x53,
-    0x61,0x76,0x65,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x73,0x61,
-    0x76,0x65,0x43,0x6f,0x6e,0x66,0x69,0x67,0x28,0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x53,
-    0x61,0x76,0x65,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-    0x22,0x62,0x74,0x6e,0x2d,0x63,0x6c,0x65,0x61,0x72,0x22,0x3e,0x3c,0x2f,0x64,0x69,
-    0x76,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-    0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x20,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x47,
-    0x72,0x69,0x64,0x20,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x4c,0x65,0x66,0x74,0x41,
-    0x6c,0x69,0x67,0x6e,0x65,0x64,0x20,0x75,0x69,0x54,0x61,0x62,0x6c,0x65,0x53,0x65,
-    0x74,0x74,0x69,0x6e,0x67,0x73,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x74,0x72,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x74,0x68,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x74,0x68,0x2d,
-    0x73,0x74,0x61,0x74,0x75,0x73,0x22,0x3e,0x52,0x6f,0x62,0x6f,0x74,0x4e,0x61,0x6d,
-    0x65,0x3c,0x2f,0x74,0x68,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x74,0x64,0x20,0x69,0x64,0x3d,0x22,0x74,0x64,0x5f,0x52,0x6f,
-    0x62,0x6f,0x74,0x4e,0x61,0x6d,0x65,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
-    0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x69,0x67,0x68,0x74,0x3a,0x31,0x70,0x78,
-    0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x74,0x65,0x78,0x74,0x61,0x72,0x65,0x61,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x22,0x74,0x65,0x78,0x74,0x41,0x72,0x65,0x61,0x4f,0x6e,0x65,0x4c,
-    0x69,0x6e,0x65,0x22,0x20,0x69,0x64,0x3d,0x22,0x74,0x64,0x5f,0x52,0x6f,0x62,0x6f,
-    0x74,0x4e,0x61,0x6d,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x22,0x3e,0x3c,0x2f,0x74,
-    0x65,0x78,0x74,0x61,0x72,0x65,0x61,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x2f,0x74,0x72,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x74,0x72,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x74,0x68,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x74,0x68,0x2d,
-    0x73,0x74,0x61,0x74,0x75,0x73,0x22,0x3e,0x52,0x6f,0x62,0x6f,0x74,0x43,0x6f,0x6e,
-    0x66,0x69,0x67,0x3c,0x2f,0x74,0x68,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x64,0x20,0x69,0x64,0x3d,0x22,0x74,0x64,0x5f,
-    0x52,0x6f,0x62,0x6f,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x22,0x20,0x73,0x74,0x79,
-    0x6c,0x65,0x3d,0x22,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x69,0x67,0x68,0x74,
-    0x3a,0x31,0x70,0x78,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x65,0x78,0x74,0x61,0x72,0x65,0x61,
-    0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x74,0x65,0x78,0x74,0x41,0x72,0x65,0x61,
-    0x49,0x6e,0x70,0x75,0x74,0x22,0x20,0x69,0x64,0x3d,0x22,0x74,0x64,0x5f,0x52,0x6f,
-    0x62,0x6f,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x5f,0x69,0x6e,0x70,0x75,0x74,0x22,
-    0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x61,0x72,0x65,0x61,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x72,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x72,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-    0x22,0x74,0x68,0x2d,0x73,0x74,0x61,0x74,0x75,0x73,0x22,0x3e,0x53,0x63,0x68,0x65,
-    0x64,0x75,0x6c,0x65,0x3c,0x2f,0x74,0x68,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x64,0x20,0x69,0x64,0x3d,0x22,0x74,0x64,
-    0x5f,0x43,0x6d,0x64,0x53,0x63,0x68,0x65,0x64,0x75,0x6c,0x65,0x22,0x20,0x73,0x74,
-    0x79,0x6c,0x65,0x3d,0x22,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x69,0x67,0x68,
-    0x74,0x3a,0x31,0x70,0x78,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x65,0x78,0x74,0x61,0x72,0x65,
-    0x61,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x74,0x65,0x78,0x74,0x41,0x72,0x65,
-    0x61,0x49,0x6e,0x70,0x75,0x74,0x22,0x20,0x69,0x64,0x3d,0x22,0x74,0x64,0x5f,0x43,
-    0x6d,0x64,0x53,0x63,0x68,0x65,0x64,0x75,0x6c,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
-    0x22,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x61,0x72,0x65,0x61,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x64,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x72,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x72,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x22,0x74,0x68,0x2d,0x73,0x74,0x61,0x74,0x75,0x73,0x22,0x3e,0x43,0x68,0x61,
-    0x6e,0x67,0x65,0x20,0x52,0x6f,0x62,0x6f,0x74,0x54,0x79,0x70,0x65,0x3c,0x2f,0x74,
-    0x68,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x74,0x64,0x20,0x69,0x64,0x3d,0x22,0x74,0x64,0x5f,0x52,0x6f,0x62,0x6f,0x74,0x54,
-    0x79,0x70,0x65,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x62,0x6f,0x72,0x64,
-    0x65,0x72,0x2d,0x72,0x69,0x67,0x68,0x74,0x3a,0x31,0x70,0x78,0x22,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x73,0x65,0x6c,0x65,0x63,0x74,0x20,0x69,0x64,0x3d,0x22,0x74,0x64,0x5f,0x52,0x6f,
-    0x62,0x6f,0x74,0x54,0x79,0x70,0x65,0x53,0x65,0x6c,0x65,0x63,0x74,0x22,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x73,0x65,0x6c,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x75,0x74,0x74,0x6f,
-    0x6e,0x20,0x69,0x64,0x3d,0x22,0x74,0x64,0x5f,0x52,0x6f,0x62,0x6f,0x74,0x54,0x79,
-    0x70,0x65,0x43,0x6c,0x69,0x63,0x6b,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,
-    0x3d,0x22,0x72,0x6f,0x62,0x6f,0x74,0x54,0x79,0x70,0x65,0x43,0x6c,0x69,0x63,0x6b,
-    0x28,0x29,0x22,0x3e,0x53,0x65,0x74,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x64,0x69,0x76,0x3e,0x43,0x6c,0x69,0x63,0x6b,0x20,0x53,0x61,0x76,0x65,
-    0x20,0x74,0x6f,0x20,0x63,0x6f,0x6e,0x66,0x69,0x72,0x6d,0x20,0x63,0x68,0x61,0x6e,
-    0x67,0x65,0x73,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x72,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x74,0x61,0x62,0x6c,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x0a,0x20,0x20,0x20,
-    0x20,0x0a,0x20,0x20,0x20,0x20,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,0x72,0x73,0x69,
-    0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3d,0x22,
-    0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,
-    0x67,0x2f,0x32,0x30,0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,0x78,0x6d,0x6c,0x6e,
-    0x73,0x3a,0x78,0x6c,0x69,0x6e,0x6b,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,
-    0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x31,0x39,0x39,0x39,0x2f,
-    0x78,0x6c,0x69,0x6e,0x6b,0x22,0x20,0x78,0x6d,0x6c,0x3a,0x73,0x70,0x61,0x63,0x65,
-    0x3d,0x22,0x70,0x72,0x65,0x73,0x65,0x72,0x76,0x65,0x22,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x20,0x69,0x64,0x3d,
-    0x22,0x69,0x63,0x6f,0x6e,0x2d,0x6c,0x6f,0x67,0x2d,0x69,0x6e,0x22,0x20,0x76,0x69,
-    0x65,0x77,0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x31,0x32,0x30,0x30,0x20,
-    0x31,0x32,0x30,0x30,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,
-    0x4d,0x35,0x35,0x30,0x20,0x31,0x31,0x30,0x30,0x68,0x34,0x30,0x30,0x71,0x31,0x36,
-    0x35,0x20,0x30,0x20,0x32,0x35,0x37,0x2e,0x35,0x20,0x2d,0x39,0x32,0x2e,0x35,0x74,
-    0x39,0x32,0x2e,0x35,0x20,0x2d,0x32,0x35,0x37,0x2e,0x35,0x76,0x2d,0x34,0x30,0x30,
-    0x71,0x30,0x20,0x2d,0x31,0x36,0x35,0x20,0x2d,0x39,0x32,0x2e,0x35,0x20,0x2d,0x32,
-    0x35,0x37,0x2e,0x35,0x74,0x2d,0x32,0x35,0x37,0x2e,0x35,0x20,0x2d,0x39,0x32,0x2e,
-    0x35,0x68,0x2d,0x34,0x30,0x30,0x71,0x2d,0x32,0x31,0x20,0x30,0x20,0x2d,0x33,0x35,
-    0x2e,0x35,0x20,0x31,0x34,0x2e,0x35,0x74,0x2d,0x31,0x34,0x2e,0x35,0x20,0x33,0x35,
-    0x2e,0x35,0x76,0x31,0x30,0x30,0x71,0x30,0x20,0x32,0x31,0x20,0x31,0x34,0x2e,0x35,
-    0x20,0x33,0x35,0x2e,0x35,0x74,0x33,0x35,0x2e,0x35,0x20,0x31,0x34,0x2e,0x35,0x68,
-    0x34,0x35,0x30,0x71,0x34,0x31,0x20,0x30,0x20,0x37,0x30,0x2e,0x35,0x20,0x32,0x39,
-    0x2e,0x35,0x74,0x32,0x39,0x2e,0x35,0x20,0x37,0x30,0x2e,0x35,0x76,0x35,0x30,0x30,
-    0x71,0x30,0x20,0x34,0x31,0x20,0x2d,0x32,0x39,0x2e,0x35,0x20,0x37,0x30,0x2e,0x35,
-    0x74,0x2d,0x37,0x30,0x2e,0x35,0x20,0x32,0x39,0x2e,0x35,0x68,0x2d,0x34,0x35,0x30,
-    0x71,0x2d,0x32,0x31,0x20,0x30,0x20,0x2d,0x33,0x35,0x2e,0x35,0x20,0x31,0x34,0x2e,
-    0x35,0x74,0x2d,0x31,0x34,0x2e,0x35,0x20,0x33,0x35,0x2e,0x35,0x76,0x31,0x30,0x30,
-    0x20,0x71,0x30,0x20,0x32,0x31,0x20,0x31,0x34,0x2e,0x35,0x20,0x33,0x35,0x2e,0x35,
-    0x74,0x33,0x35,0x2e,0x35,0x20,0x31,0x34,0x2e,0x35,0x7a,0x4d,0x33,0x33,0x38,0x20,
-    0x38,0x36,0x37,0x6c,0x33,0x32,0x34,0x20,0x2d,0x32,0x38,0x34,0x71,0x31,0x36,0x20,
-    0x2d,0x31,0x34,0x20,0x31,0x36,0x20,0x2d,0x33,0x33,0x74,0x2d,0x31,0x36,0x20,0x2d,
-    0x33,0x33,0x6c,0x2d,0x33,0x32,0x34,0x20,0x2d,0x32,0x38,0x34,0x71,0x2d,0x31,0x36,
-    0x20,0x2d,0x31,0x34,0x20,0x2d,0x32,0x37,0x20,0x2d,0x39,0x74,0x2d,0x31,0x31,0x20,
-    0x32,0x36,0x76,0x31,0x35,0x30,0x68,0x2d,0x32,0x35,0x30,0x71,0x2d,0x32,0x31,0x20,
-    0x30,0x20,0x2d,0x33,0x35,0x2e,0x35,0x20,0x31,0x34,0x2e,0x35,0x74,0x2d,0x31,0x34,
-    0x2e,0x35,0x20,0x33,0x35,0x2e,0x35,0x76,0x32,0x30,0x30,0x71,0x30,0x20,0x32,0x31,
-    0x20,0x31,0x34,0x2e,0x35,0x20,0x33,0x35,0x2e,0x35,0x74,0x33,0x35,0x2e,0x35,0x20,
-    0x31,0x34,0x2e,0x35,0x68,0x32,0x35,0x30,0x76,0x31,0x35,0x30,0x71,0x30,0x20,0x32,
-    0x31,0x20,0x31,0x31,0x20,0x32,0x36,0x74,0x32,0x37,0x20,0x2d,0x39,0x7a,0x22,0x3e,
-    0x3c,0x2f,0x70,0x61,0x74,0x68,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x20,0x69,0x64,0x3d,0x22,0x69,
-    0x63,0x6f,0x6e,0x2d,0x73,0x65,0x6e,0x64,0x22,0x20,0x76,0x69,0x65,0x77,0x42,0x6f,
-    0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x31,0x32,0x30,0x30,0x20,0x31,0x32,0x30,0x30,
-    0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x31,0x32,0x30,
-    0x30,0x20,0x31,0x30,0x33,0x6c,0x2d,0x34,0x38,0x33,0x20,0x32,0x37,0x36,0x6c,0x2d,
-    0x33,0x31,0x34,0x20,0x2d,0x33,0x39,0x39,0x76,0x34,0x32,0x33,0x68,0x2d,0x33,0x39,
-    0x39,0x6c,0x31,0x31,0x39,0x36,0x20,0x37,0x39,0x36,0x76,0x2d,0x31,0x30,0x39,0x36,
-    0x7a,0x4d,0x34,0x38,0x33,0x20,0x34,0x32,0x34,0x76,0x2d,0x32,0x33,0x30,0x6c,0x36,
-    0x38,0x33,0x20,0x39,0x35,0x33,0x7a,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,
-    0x72,0x6d,0x3d,0x22,0x73,0x63,0x61,0x6c,0x65,0x28,0x31,0x2c,0x2d,0x31,0x29,0x20,
-    0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x65,0x28,0x30,0x2c,0x2d,0x31,0x32,0x30,
-    0x30,0x29,0x22,0x3e,0x3c,0x2f,0x70,0x61,0x74,0x68,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x67,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x20,0x69,
-    0x64,0x3d,0x22,0x69,0x63,0x6f,0x2d,0x6c,0x63,0x22,0x20,0x76,0x69,0x65,0x77,0x42,
-    0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x31,0x32,0x30,0x30,0x20,0x31,0x32,0x30,
-    0x30,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x38,0x38,
-    0x35,0x20,0x39,0x30,0x30,0x6c,0x2d,0x33,0x35,0x32,0x20,0x2d,0x33,0x35,0x33,0x6c,
-    0x33,0x35,0x32,0x20,0x2d,0x33,0x35,0x33,0x6c,0x2d,0x31,0x39,0x37,0x20,0x2d,0x31,
-    0x39,0x38,0x6c,0x2d,0x35,0x35,0x32,0x20,0x35,0x35,0x32,0x6c,0x35,0x35,0x32,0x20,
-    0x35,0x35,0x30,0x7a,0x22,0x3e,0x3c,0x2f,0x70,0x61,0x74,0x68,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x67,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x79,0x6d,0x62,0x6f,0x6c,
-    0x20,0x69,0x64,0x3d,0x22,0x69,0x63,0x6f,0x2d,0x72,0x63,0x22,0x20,0x76,0x69,0x65,
-    0x77,0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x31,0x32,0x30,0x30,0x20,0x31,
-    0x32,0x30,0x30,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,
-    0x31,0x30,0x36,0x34,0x20,0x35,0x34,0x37,0x6c,0x2d,0x35,0x35,0x31,0x20,0x2d,0x35,
-    0x35,0x31,0x6c,0x2d,0x31,0x39,0x38,0x20,0x31,0x39,0x38,0x6c,0x33,0x35,0x33,0x20,
-    0x33,0x35,0x33,0x6c,0x2d,0x33,0x35,0x33,0x20,0x33,0x35,0x33,0x6c,0x31,0x39,0x38,
-    0x20,0x31,0x39,0x38,0x7a,0x22,0x3e,0x3c,0x2f,0x70,0x61,0x74,0x68,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x67,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x79,0x6d,0x62,0x6f,0x6c,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x79,0x6d,0x62,0x6f,
-    0x6c,0x20,0x69,0x64,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x75,0x70,0x6c,0x6f,0x61,
-    0x64,0x22,0x20,0x76,0x69,0x65,0x77,0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,
-    0x31,0x32,0x30,0x30,0x20,0x31,0x32,0x30,0x30,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x74,
-    0x68,0x20,0x64,0x3d,0x22,0x4d,0x35,0x30,0x32,0x20,0x31,0x30,0x38,0x39,0x71,0x31,
-    0x31,0x30,0x20,0x30,0x20,0x32,0x30,0x31,0x20,0x2d,0x35,0x39,0x2e,0x35,0x74,0x31,
-    0x33,0x35,0x20,0x2d,0x31,0x35,0x36,0x2e,0x35,0x71,0x34,0x33,0x20,0x31,0x35,0x20,
-    0x38,0x39,0x20,0x31,0x35,0x71,0x31,0x32,0x31,0x20,0x30,0x20,0x32,0x30,0x36,0x20,
-    0x2d,0x38,0x36,0x2e,0x35,0x74,0x38,0x36,0x20,0x2d,0x32,0x30,0x36,0x2e,0x35,0x71,
-    0x30,0x20,0x2d,0x39,0x39,0x20,0x2d,0x36,0x30,0x20,0x2d,0x31,0x38,0x31,0x74,0x2d,
-    0x31,0x35,0x30,0x20,0x2d,0x31,0x31,0x30,0x6c,0x2d,0x33,0x37,0x38,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x33,
-    0x36,0x30,0x71,0x2d,0x31,0x33,0x20,0x31,0x36,0x20,0x2d,0x33,0x31,0x2e,0x35,0x20,
-    0x31,0x36,0x74,0x2d,0x33,0x31,0x2e,0x35,0x20,0x2d,0x31,0x36,0x6c,0x2d,0x33,0x38,
-    0x31,0x20,0x2d,0x33,0x36,0x35,0x68,0x2d,0x39,0x71,0x2d,0x37,0x39,0x20,0x30,0x20,
-    0x2d,0x31,0x33,0x35,0x2e,0x35,0x20,0x35,0x37,0x2e,0x35,0x74,0x2d,0x35,0x36,0x2e,
-    0x35,0x20,0x31,0x33,0x36,0x2e,0x35,0x71,0x30,0x20,0x36,0x39,0x20,0x34,0x33,0x20,
-    0x31,0x32,0x32,0x2e,0x35,0x74,0x31,0x30,0x38,0x20,0x36,0x37,0x2e,0x35,0x71,0x2d,
-    0x32,0x20,0x31,0x39,0x20,0x2d,0x32,0x20,0x33,0x38,0x71,0x30,0x20,0x31,0x30,0x30,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x34,0x39,0x20,0x31,0x38,0x34,0x2e,0x35,0x74,0x31,0x33,0x33,0x2e,0x35,
-    0x20,0x31,0x33,0x34,0x74,0x31,0x38,0x34,0x2e,0x35,0x20,0x34,0x39,0x2e,0x35,0x7a,
-    0x20,0x4d,0x36,0x33,0x32,0x20,0x34,0x36,0x37,0x6c,0x32,0x32,0x33,0x20,0x2d,0x32,
-    0x32,0x38,0x71,0x31,0x33,0x20,0x2d,0x31,0x36,0x20,0x38,0x20,0x2d,0x32,0x37,0x2e,
-    0x35,0x74,0x2d,0x32,0x36,0x20,0x2d,0x31,0x31,0x2e,0x35,0x68,0x2d,0x31,0x33,0x37,
-    0x76,0x2d,0x32,0x37,0x35,0x71,0x30,0x20,0x2d,0x31,0x30,0x20,0x2d,0x37,0x2e,0x35,
-    0x20,0x2d,0x31,0x37,0x2e,0x35,0x74,0x2d,0x31,0x37,0x2e,0x35,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2d,0x37,
-    0x2e,0x35,0x68,0x2d,0x31,0x35,0x30,0x71,0x2d,0x31,0x30,0x20,0x30,0x20,0x2d,0x31,
-    0x37,0x2e,0x35,0x20,0x37,0x2e,0x35,0x74,0x2d,0x37,0x2e,0x35,0x20,0x31,0x37,0x2e,
-    0x35,0x76,0x32,0x37,0x35,0x68,0x2d,0x31,0x33,0x37,0x71,0x2d,0x32,0x31,0x20,0x30,
-    0x20,0x2d,0x32,0x36,0x20,0x31,0x31,0x2e,0x35,0x74,0x38,0x20,0x32,0x37,0x2e,0x35,
-    0x71,0x31,0x39,0x39,0x20,0x32,0x30,0x34,0x20,0x32,0x32,0x33,0x20,0x32,0x32,0x38,
-    0x71,0x31,0x39,0x20,0x31,0x39,0x20,0x33,0x31,0x2e,0x35,0x20,0x31,0x39,0x74,0x33,
-    0x32,0x2e,0x35,0x20,0x2d,0x31,0x39,0x7a,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,
-    0x6f,0x72,0x6d,0x3d,0x22,0x73,0x63,0x61,0x6c,0x65,0x28,0x31,0x2c,0x2d,0x31,0x29,
-    0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x65,0x28,0x30,0x2c,0x2d,0x31,0x31,
-    0x30,0x30,0x29,0x22,0x3e,0x3c,0x2f,0x70,0x61,0x74,0x68,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x67,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x20,
-    0x69,0x64,0x3d,0x22,0x69,0x63,0x6f,0x2d,0x63,0x6e,0x63,0x6c,0x22,0x20,0x76,0x69,
-    0x65,0x77,0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x35,0x31,0x30,0x20,0x35,
-    0x31,0x30,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x32,
-    0x35,0x35,0x2c,0x30,0x43,0x31,0x31,0x34,0x2e,0x37,0x35,0x2c,0x30,0x2c,0x30,0x2c,
-    0x31,0x31,0x34,0x2e,0x37,0x35,0x2c,0x30,0x2c,0x32,0x35,0x35,0x73,0x31,0x31,0x34,
-    0x2e,0x37,0x35,0x2c,0x32,0x35,0x35,0x2c,0x32,0x35,0x35,0x2c,0x32,0x35,0x35,0x73,
-    0x32,0x35,0x35,0x2d,0x31,0x31,0x34,0x2e,0x37,0x35,0x2c,0x32,0x35,0x35,0x2d,0x32,
-    0x35,0x35,0x53,0x33,0x39,0x35,0x2e,0x32,0x35,0x2c,0x30,0x2c,0x32,0x35,0x35,0x2c,
-    0x30,0x7a,0x20,0x4d,0x33,0x38,0x32,0x2e,0x35,0x2c,0x33,0x34,0x36,0x2e,0x38,0x6c,
-    0x2d,0x33,0x35,0x2e,0x37,0x2c,0x33,0x35,0x2e,0x37,0x0a,0x09,0x09,0x09,0x4c,0x32,
-    0x35,0x35,0x2c,0x32,0x39,0x30,0x2e,0x37,0x6c,0x2d,0x39,0x31,0x2e,0x38,0x2c,0x39,
-    0x31,0x2e,0x38,0x6c,0x2d,0x33,0x35,0x2e,0x37,0x2d,0x33,0x35,0x2e,0x37,0x6c,0x39,
-    0x31,0x2e,0x38,0x2d,0x39,0x31,0x2e,0x38,0x6c,0x2d,0x39,0x31,0x2e,0x38,0x2d,0x39,
-    0x31,0x2e,0x38,0x6c,0x33,0x35,0x2e,0x37,0x2d,0x33,0x35,0x2e,0x37,0x6c,0x39,0x31,
-    0x2e,0x38,0x2c,0x39,0x31,0x2e,0x38,0x6c,0x39,0x31,0x2e,0x38,0x2d,0x39,0x31,0x2e,
-    0x38,0x6c,0x33,0x35,0x2e,0x37,0x2c,0x33,0x35,0x2e,0x37,0x4c,0x32,0x39,0x30,0x2e,
-    0x37,0x2c,0x32,0x35,0x35,0x4c,0x33,0x38,0x32,0x2e,0x35,0x2c,0x33,0x34,0x36,0x2e,
-    0x38,0x7a,0x22,0x3e,0x3c,0x2f,0x70,0x61,0x74,0x68,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x67,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x20,0x69,
-    0x64,0x3d,0x22,0x69,0x63,0x6f,0x2d,0x73,0x74,0x6f,0x70,0x22,0x20,0x76,0x69,0x65,
-    0x77,0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x31,0x39,0x31,0x20,0x31,0x39,
-    0x31,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x31,0x35,
-    0x38,0x2e,0x39,0x31,0x32,0x2c,0x30,0x48,0x33,0x31,0x2e,0x37,0x38,0x32,0x43,0x31,
-    0x34,0x2e,0x32,0x33,0x39,0x2c,0x30,0x2c,0x30,0x2c,0x31,0x34,0x2e,0x32,0x33,0x39,
-    0x2c,0x30,0x2c,0x33,0x31,0x2e,0x37,0x38,0x32,0x76,0x31,0x32,0x37,0x2e,0x31,0x33,
-    0x63,0x30,0x2c,0x31,0x37,0x2e,0x35,0x34,0x34,0x2c,0x31,0x34,0x2e,0x32,0x33,0x39,
-    0x2c,0x33,0x31,0x2e,0x37,0x38,0x32,0x2c,0x33,0x31,0x2e,0x37,0x38,0x32,0x2c,0x33,
-    0x31,0x2e,0x37,0x38,0x32,0x0a,0x09,0x09,0x09,0x09,0x68,0x31,0x32,0x37,0x2e,0x31,
-    0x33,0x63,0x31,0x37,0x2e,0x35,0x34,0x34,0x2c,0x30,0x2c,0x33,0x31,0x2e,0x37,0x38,
-    0x32,0x2d,0x31,0x34,0x2e,0x32,0x33,0x39,0x2c,0x33,0x31,0x2e,0x37,0x38,0x32,0x2d,
-    0x33,0x31,0x2e,0x37,0x38,0x32,0x56,0x33,0x31,0x2e,0x37,0x38,0x32,0x43,0x31,0x39,
-    0x30,0x2e,0x36,0x39,0x35,0x2c,0x31,0x34,0x2e,0x32,0x33,0x39,0x2c,0x31,0x37,0x36,
-    0x2e,0x34,0x35,0x36,0x2c,0x30,0x2c,0x31,0x35,0x38,0x2e,0x39,0x31,0x32,0x2c,0x30,
-    0x7a,0x22,0x3e,0x3c,0x2f,0x70,0x61,0x74,0x68,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x20,0x69,0x64,
-    0x3d,0x22,0x69,0x63,0x6f,0x2d,0x70,0x61,0x75,0x73,0x65,0x22,0x20,0x76,0x69,0x65,
-    0x77,0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x34,0x36,0x20,0x34,0x36,0x22,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x67,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x31,0x33,0x2e,0x39,
-    0x38,0x37,0x2c,0x30,0x63,0x2d,0x32,0x2e,0x37,0x36,0x32,0x2c,0x30,0x2d,0x35,0x2c,
-    0x32,0x2e,0x32,0x33,0x39,0x2d,0x35,0x2c,0x35,0x76,0x33,0x35,0x2e,0x39,0x37,0x35,
-    0x63,0x30,0x2c,0x32,0x2e,0x37,0x36,0x33,0x2c,0x32,0x2e,0x32,0x33,0x38,0x2c,0x35,
-    0x2c,0x35,0x2c,0x35,0x73,0x35,0x2d,0x32,0x2e,0x32,0x33,0x38,0x2c,0x35,0x2d,0x35,
-    0x56,0x35,0x43,0x31,0x38,0x2e,0x39,0x38,0x37,0x2c,0x32,0x2e,0x32,0x33,0x38,0x2c,
-    0x31,0x36,0x2e,0x37,0x35,0x2c,0x30,0x2c,0x31,0x33,0x2e,0x39,0x38,0x37,0x2c,0x30,
-    0x7a,0x22,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x33,
-    0x31,0x2e,0x39,0x38,0x37,0x2c,0x30,0x63,0x2d,0x32,0x2e,0x37,0x36,0x32,0x2c,0x30,
-    0x2d,0x35,0x2c,0x32,0x2e,0x32,0x33,0x39,0x2d,0x35,0x2c,0x35,0x76,0x33,0x35,0x2e,
-    0x39,0x37,0x35,0x63,0x30,0x2c,0x32,0x2e,0x37,0x36,0x32,0x2c,0x32,0x2e,0x32,0x33,
-    0x38,0x2c,0x35,0x2c,0x35,0x2c,0x35,0x73,0x35,0x2d,0x32,0x2e,0x32,0x33,0x38,0x2c,
-    0x35,0x2d,0x35,0x56,0x35,0x43,0x33,0x36,0x2e,0x39,0x38,0x37,0x2c,0x32,0x2e,0x32,
-    0x33,0x39,0x2c,0x33,0x34,0x2e,0x37,0x34,0x39,0x2c,0x30,0x2c,0x33,0x31,0x2e,0x39,
-    0x38,0x37,0x2c,0x30,0x7a,0x22,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x20,0x69,0x64,0x3d,0x22,
-    0x69,0x63,0x6f,0x2d,0x70,0x6c,0x61,0x79,0x22,0x20,0x76,0x69,0x65,0x77,0x42,0x6f,
-    0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x32,0x33,0x33,0x20,0x32,0x33,0x33,0x22,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x67,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x32,0x30,0x33,0x2e,0x37,
-    0x39,0x31,0x2c,0x39,0x39,0x2e,0x36,0x32,0x38,0x4c,0x34,0x39,0x2e,0x33,0x30,0x37,
-    0x2c,0x32,0x2e,0x32,0x39,0x34,0x63,0x2d,0x34,0x2e,0x35,0x36,0x37,0x2d,0x32,0x2e,
-    0x37,0x31,0x39,0x2d,0x31,0x30,0x2e,0x32,0x33,0x38,0x2d,0x32,0x2e,0x32,0x36,0x36,
-    0x2d,0x31,0x34,0x2e,0x35,0x32,0x31,0x2d,0x32,0x2e,0x32,0x36,0x36,0x0a,0x09,0x09,
-    0x63,0x2d,0x31,0x37,0x2e,0x31,0x33,0x32,0x2c,0x30,0x2d,0x31,0x37,0x2e,0x30,0x35,
-    0x36,0x2c,0x31,0x33,0x2e,0x32,0x32,0x37,0x2d,0x31,0x37,0x2e,0x30,0x35,0x36,0x2c,
-    0x31,0x36,0x2e,0x35,0x37,0x38,0x76,0x31,0x39,0x38,0x2e,0x39,0x34,0x63,0x30,0x2c,
-    0x32,0x2e,0x38,0x33,0x33,0x2d,0x30,0x2e,0x30,0x37,0x35,0x2c,0x31,0x36,0x2e,0x35,
-    0x37,0x39,0x2c,0x31,0x37,0x2e,0x30,0x35,0x36,0x2c,0x31,0x36,0x2e,0x35,0x37,0x39,
-    0x63,0x34,0x2e,0x32,0x38,0x33,0x2c,0x30,0x2c,0x39,0x2e,0x39,0x35,0x35,0x2c,0x30,
-    0x2e,0x34,0x35,0x31,0x2c,0x31,0x34,0x2e,0x35,0x32,0x31,0x2d,0x32,0x2e,0x32,0x36,
-    0x37,0x0a,0x09,0x09,0x6c,0x31,0x35,0x34,0x2e,0x34,0x38,0x33,0x2d,0x39,0x37,0x2e,
-    0x33,0x33,0x33,0x63,0x31,0x32,0x2e,0x36,0x38,0x2d,0x37,0x2e,0x35,0x34,0x35,0x2c,
-    0x31,0x30,0x2e,0x34,0x38,0x39,0x2d,0x31,0x36,0x2e,0x34,0x34,0x39,0x2c,0x31,0x30,
-    0x2e,0x34,0x38,0x39,0x2d,0x31,0x36,0x2e,0x34,0x34,0x39,0x53,0x32,0x31,0x36,0x2e,
-    0x34,0x37,0x31,0x2c,0x31,0x30,0x37,0x2e,0x31,0x37,0x32,0x2c,0x32,0x30,0x33,0x2e,
-    0x37,0x39,0x31,0x2c,0x39,0x39,0x2e,0x36,0x32,0x38,0x7a,0x22,0x2f,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x67,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x79,0x6d,0x62,0x6f,0x6c,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x79,0x6d,0x62,0x6f,
-    0x6c,0x20,0x69,0x64,0x3d,0x22,0x69,0x63,0x6f,0x2d,0x64,0x65,0x6c,0x65,0x74,0x65,
-    0x22,0x20,0x76,0x69,0x65,0x77,0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x32,
-    0x36,0x20,0x32,0x36,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,
-    0x4d,0x20,0x31,0x31,0x20,0x2d,0x30,0x2e,0x30,0x33,0x31,0x32,0x35,0x20,0x43,0x20,
-    0x31,0x30,0x2e,0x31,0x36,0x34,0x30,0x36,0x33,0x20,0x2d,0x30,0x2e,0x30,0x33,0x31,
-    0x32,0x35,0x20,0x39,0x2e,0x33,0x34,0x33,0x37,0x35,0x20,0x30,0x2e,0x31,0x33,0x32,
-    0x38,0x31,0x33,0x20,0x38,0x2e,0x37,0x35,0x20,0x30,0x2e,0x37,0x31,0x38,0x37,0x35,
-    0x20,0x43,0x20,0x38,0x2e,0x31,0x35,0x36,0x32,0x35,0x20,0x31,0x2e,0x33,0x30,0x34,
-    0x36,0x38,0x38,0x20,0x37,0x2e,0x39,0x36,0x38,0x37,0x35,0x20,0x32,0x2e,0x31,0x33,
-    0x36,0x37,0x31,0x39,0x20,0x37,0x2e,0x39,0x36,0x38,0x37,0x35,0x20,0x33,0x20,0x4c,
-    0x20,0x34,0x20,0x33,0x20,0x43,0x20,0x33,0x2e,0x34,0x34,0x39,0x32,0x31,0x39,0x20,
-    0x33,0x20,0x33,0x20,0x33,0x2e,0x34,0x34,0x39,0x32,0x31,0x39,0x20,0x33,0x20,0x34,
-    0x20,0x4c,0x20,0x32,0x20,0x34,0x20,0x4c,0x20,0x32,0x20,0x36,0x20,0x4c,0x20,0x32,
-    0x34,0x20,0x36,0x20,0x4c,0x20,0x32,0x34,0x20,0x34,0x20,0x4c,0x20,0x32,0x33,0x20,
-    0x34,0x20,0x43,0x20,0x32,0x33,0x20,0x33,0x2e,0x34,0x34,0x39,0x32,0x31,0x39,0x20,
-    0x32,0x32,0x2e,0x35,0x35,0x30,0x37,0x38,0x31,0x20,0x33,0x20,0x32,0x32,0x20,0x33,
-    0x20,0x4c,0x20,0x31,0x38,0x2e,0x30,0x33,0x31,0x32,0x35,0x20,0x33,0x20,0x43,0x20,
-    0x31,0x38,0x2e,0x30,0x33,0x31,0x32,0x35,0x20,0x32,0x2e,0x31,0x33,0x36,0x37,0x31,
-    0x39,0x20,0x31,0x37,0x2e,0x38,0x34,0x33,0x37,0x35,0x20,0x31,0x2e,0x33,0x30,0x34,
-    0x36,0x38,0x38,0x20,0x31,0x37,0x2e,0x32,0x35,0x20,0x30,0x2e,0x37,0x31,0x38,0x37,
-    0x35,0x20,0x43,0x20,0x31,0x36,0x2e,0x36,0x35,0x36,0x32,0x35,0x20,0x30,0x2e,0x31,
-    0x33,0x32,0x38,0x31,0x33,0x20,0x31,0x35,0x2e,0x38,0x33,0x35,0x39,0x33,0x38,0x20,
-    0x2d,0x30,0x2e,0x30,0x33,0x31,0x32,0x35,0x20,0x31,0x35,0x20,0x2d,0x30,0x2e,0x30,
-    0x33,0x31,0x32,0x35,0x20,0x5a,0x20,0x4d,0x20,0x31,0x31,0x20,0x32,0x2e,0x30,0x33,
-    0x31,0x32,0x35,0x20,0x4c,0x20,0x31,0x35,0x20,0x32,0x2e,0x30,0x33,0x31,0x32,0x35,
-    0x20,0x43,0x20,0x31,0x35,0x2e,0x35,0x34,0x36,0x38,0x37,0x35,0x20,0x32,0x2e,0x30,
-    0x33,0x31,0x32,0x35,0x20,0x31,0x35,0x2e,0x37,0x31,0x38,0x37,0x35,0x20,0x32,0x2e,
-    0x31,0x36,0x30,0x31,0x35,0x36,0x20,0x31,0x35,0x2e,0x37,0x38,0x31,0x32,0x35,0x20,
-    0x32,0x2e,0x32,0x31,0x38,0x37,0x35,0x20,0x43,0x20,0x31,0x35,0x2e,0x38,0x34,0x33,
-    0x37,0x35,0x20,0x32,0x2e,0x32,0x37,0x37,0x33,0x34,0x34,0x20,0x31,0x35,0x2e,0x39,
-    0x36,0x38,0x37,0x35,0x20,0x32,0x2e,0x34,0x34,0x31,0x34,0x30,0x36,0x20,0x31,0x35,
-    0x2e,0x39,0x36,0x38,0x37,0x35,0x20,0x33,0x20,0x4c,0x20,0x31,0x30,0x2e,0x30,0x33,
-    0x31,0x32,0x35,0x20,0x33,0x20,0x43,0x20,0x31,0x30,0x2e,0x30,0x33,0x31,0x32,0x35,
-    0x20,0x32,0x2e,0x34,0x34,0x31,0x34,0x30,0x36,0x20,0x31,0x30,0x2e,0x31,0x35,0x36,
-    0x32,0x35,0x20,0x32,0x2e,0x32,0x37,0x37,0x33,0x34,0x34,0x20,0x31,0x30,0x2e,0x32,
-    0x31,0x38,0x37,0x35,0x20,0x32,0x2e,0x32,0x31,0x38,0x37,0x35,0x20,0x43,0x20,0x31,
-    0x30,0x2e,0x32,0x38,0x31,0x32,0x35,0x20,0x32,0x2e,0x31,0x36,0x30,0x31,0x35,0x36,
-    0x20,0x31,0x30,0x2e,0x34,0x35,0x33,0x31,0x32,0x35,0x20,0x32,0x2e,0x30,0x33,0x31,
-    0x32,0x35,0x20,0x31,0x31,0x20,0x32,0x2e,0x30,0x33,0x31,0x32,0x35,0x20,0x5a,0x20,
-    0x4d,0x20,0x34,0x20,0x37,0x20,0x4c,0x20,0x34,0x20,0x32,0x33,0x20,0x43,0x20,0x34,
-    0x20,0x32,0x34,0x2e,0x36,0x35,0x32,0x33,0x34,0x34,0x20,0x35,0x2e,0x33,0x34,0x37,
-    0x36,0x35,0x36,0x20,0x32,0x36,0x20,0x37,0x20,0x32,0x36,0x20,0x4c,0x20,0x31,0x39,
-    0x20,0x32,0x36,0x20,0x43,0x20,0x32,0x30,0x2e,0x36,0x35,0x32,0x33,0x34,0x34,0x20,
-    0x32,0x36,0x20,0x32,0x32,0x20,0x32,0x34,0x2e,0x36,0x35,0x32,0x33,0x34,0x34,0x20,
-    0x32,0x32,0x20,0x32,0x33,0x20,0x4c,0x20,0x32,0x32,0x20,0x37,0x20,0x5a,0x20,0x4d,
-    0x20,0x38,0x20,0x31,0x30,0x20,0x4c,0x20,0x31,0x30,0x20,0x31,0x30,0x20,0x4c,0x20,
-    0x31,0x30,0x20,0x32,0x32,0x20,0x4c,0x20,0x38,0x20,0x32,0x32,0x20,0x5a,0x20,0x4d,
-    0x20,0x31,0x32,0x20,0x31,0x30,0x20,0x4c,0x20,0x31,0x34,0x20,0x31,0x30,0x20,0x4c,
-    0x20,0x31,0x34,0x20,0x32,0x32,0x20,0x4c,0x20,0x31,0x32,0x20,0x32,0x32,0x20,0x5a,
-    0x20,0x4d,0x20,0x31,0x36,0x20,0x31,0x30,0x20,0x4c,0x20,0x31,0x38,0x20,0x31,0x30,
-    0x20,0x4c,0x20,0x31,0x38,0x20,0x32,0x32,0x20,0x4c,0x20,0x31,0x36,0x20,0x32,0x32,
-    0x20,0x5a,0x20,0x22,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x2f,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x73,0x76,0x67,0x3e,0x0a,0x0a,0x20,0x20,0x20,0x20,0x0a,0x20,0x20,0x20,0x20,0x3c,
-    0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x66,0x69,0x6c,0x65,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x69,0x6e,0x70,0x75,0x74,0x5f,0x66,0x69,0x6c,0x65,
-    0x5f,0x75,0x70,0x6c,0x6f,0x61,0x64,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-    0x68,0x69,0x64,0x64,0x65,0x6e,0x22,0x3e,0x0a,0x0a,0x3c,0x2f,0x62,0x6f,0x64,0x79,
-    0x3e,0x0a,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,0x0a
+// index.html 1554 bytes (gzip 844 bytes)
+static const uint8_t __webAutogenResource_index_html[] PROGMEM {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x75,0x55,0x6d,0x6f,0xdb,0x36,
+    0x10,0xfe,0xee,0x5f,0xc1,0x70,0x80,0x20,0x61,0x92,0xec,0x14,0x01,0x3a,0xd8,0x96,
+    0x83,0xc4,0x4d,0x17,0x0f,0x49,0x5b,0xa4,0x2e,0xd6,0x7d,0xa4,0xa4,0xb3,0xc4,0x8d,
+    0x22,0x35,0x92,0x92,0xa2,0x39,0xfe,0xef,0x3d,0xaa,0x8e,0x6b,0x67,0xa9,0x0d,0x48,
+    0xe2,0xbd,0xdf,0xa3,0xe7,0x4e,0xa3,0xf9,0xd9,0xbb,0x8f,0xcb,0xf5,0x5f,0x9f,0x6e,
+    0x48,0x69,0x2b,0xb1,0x18,0xcd,0xdd,0x8d,0x08,0x26,0x8b,0x84,0x82,0xa4,0x4e,0x00,
+    0x2c,0x5f,0x8c,0x08,0xfe,0xe6,0x15,0x58,0x46,0xb2,0x92,0x69,0x03,0x36,0xa1,0x8d,
+    0xdd,0x44,0xbf,0xd1,0x63,0x55,0x69,0x6d,0x1d,0xc1,0xbf,0x0d,0x6f,0x13,0xfa,0x35,
+    0xfa,0x72,0x15,0x2d,0x55,0x55,0x33,0xcb,0x53,0x01,0x94,0x64,0x4a,0x5a,0x90,0xe8,
+    0xb7,0xba,0x49,0x20,0x2f,0xe0,0xc4,0x53,0xb2,0x0a,0x12,0xda,0x72,0xe8,0x6a,0xa5,
+    0xed,0x91,0x71,0xc7,0x73,0x5b,0x26,0x39,0xb4,0x3c,0x83,0x68,0x38,0xbc,0xe2,0xc7,
+    0xea,0x5a,0x40,0x54,0xa9,0x94,0xe3,0xad,0x83,0x34,0x42,0x41,0x94,0xb1,0x9a,0x9d,
+    0x26,0xee,0xc1,0xbc,0xe2,0x9c,0x83,0xc9,0x34,0xaf,0x2d,0x57,0xf2,0xc8,0xf6,0x4f,
+    0x48,0xbf,0xac,0xc8,0x46,0x69,0xf2,0x70,0xad,0xec,0x7b,0xae,0xab,0x8e,0xe9,0xd7,
+    0x6a,0x66,0x8d,0x2d,0x95,0x3e,0xf2,0x7c,0x50,0x29,0x79,0xa7,0x52,0xa3,0xe4,0xb3,
+    0xb5,0xe5,0x56,0x00,0xe1,0x79,0x42,0x87,0x27,0xba,0x30,0x4c,0xe6,0x18,0x75,0x3e,
+    0x1e,0xce,0x7b,0xab,0xef,0x55,0x2c,0x36,0x8d,0xcc,0x5c,0x2d,0x24,0x55,0x79,0xbf,
+    0x32,0x77,0x8a,0xe5,0x90,0xfb,0xc1,0x16,0xe3,0x1b,0x25,0x20,0x16,0xaa,0xf0,0xe9,
+    0x35,0xea,0x88,0x18,0x54,0x34,0x08,0x3b,0x2e,0x73,0xd5,0xc5,0xc6,0x7e,0xb6,0xcc,
+    0x42,0xb2,0xd5,0x8d,0x5c,0xc9,0x35,0x18,0x7b,0xaf,0x72,0x98,0x52,0xa1,0x32,0x26,
+    0x4a,0x65,0x2c,0x4d,0x92,0xc4,0x1d,0x5c,0xf8,0xd8,0x09,0x5c,0x07,0x4f,0x4f,0xf4,
+    0xfc,0xcd,0xdb,0x78,0x82,0xff,0xf3,0x9f,0x19,0xbc,0x2a,0xdf,0xbd,0xc8,0x1b,0x9f,
+    0xa4,0xbd,0xf4,0x73,0x95,0x35,0x15,0x22,0x12,0x17,0x60,0x6f,0x04,0xb8,0xc7,0xeb,
+    0x7e,0x95,0xfb,0xd4,0xd4,0x82,0x99,0xf2,0x13,0x2b,0x60,0x0d,0x8f,0x16,0xeb,0x3f,
+    0x15,0xc4,0x5c,0x4a,0xd0,0xb7,0xeb,0xfb,0x3b,0xa4,0x0a,0xa9,0x1a,0x63,0x09,0x46,
+    0x26,0x88,0x08,0x23,0x06,0x74,0x0b,0xfa,0x8c,0x06,0x53,0x6c,0x49,0x5c,0xfd,0xcd,
+    0x1e,0x7d,0x3a,0xc6,0xf8,0xc8,0x47,0xcb,0x65,0x61,0x68,0xf8,0xfc,0xb4,0x44,0x7d,
+    0xca,0xb2,0x7f,0x82,0xdd,0x01,0xd0,0x97,0x2a,0x5f,0x05,0x5b,0x01,0x96,0x20,0x62,
+    0xbb,0x99,0xd5,0xfd,0x16,0x92,0x3f,0x3e,0x7f,0xfc,0x10,0xd7,0x8e,0xdf,0xa8,0xdc,
+    0x61,0xc3,0x59,0xe9,0xc3,0x0f,0xec,0x41,0x6b,0xa5,0x7d,0xfa,0x9e,0x21,0xcf,0x72,
+    0x62,0x15,0x19,0x4c,0x89,0xf3,0x3a,0x44,0x27,0xf4,0x57,0x15,0x84,0xa7,0x1e,0x10,
+    0xec,0x64,0x23,0xc4,0x59,0x92,0x40,0xdc,0xf0,0x75,0x5f,0x83,0xe7,0x51,0x47,0x02,
+    0x07,0xec,0xb3,0xe8,0xe9,0x09,0x21,0x54,0xa9,0xb2,0x4b,0x25,0x37,0xbc,0xf0,0xbc,
+    0x93,0x63,0x8c,0xb4,0x6e,0xf8,0x89,0xdb,0xff,0xb4,0xb1,0x55,0x77,0xaa,0x03,0xbd,
+    0x64,0x58,0x7f,0x70,0xb9,0x7f,0x3d,0x87,0x17,0xa7,0x01,0x71,0xce,0xc0,0x1f,0x42,
+    0xc4,0x6e,0xce,0x11,0xc7,0x9f,0x1a,0x65,0x32,0xdb,0xdb,0xfc,0x40,0xf0,0x00,0x3a,
+    0x84,0x2a,0xb4,0xc1,0xb6,0x65,0x9a,0xc8,0x44,0x42,0x47,0xbe,0xde,0xdf,0xdd,0xe2,
+    0xf0,0x3f,0xe0,0xf0,0x23,0x01,0x66,0x32,0x56,0x52,0xe3,0xde,0xe8,0x8d,0x63,0x06,
+    0x6e,0x0c,0x59,0x40,0xf2,0x1c,0x06,0xc9,0x7c,0x81,0x0d,0xb8,0x5c,0x68,0x31,0x70,
+    0xc7,0xf3,0xfc,0x37,0x93,0xc9,0x20,0x74,0x1e,0x8d,0xb9,0x6c,0x15,0xcf,0xc9,0x04,
+    0x11,0x53,0x9e,0xa7,0x7c,0x67,0x6b,0x6a,0xc4,0x74,0x60,0x48,0x30,0x3d,0x68,0xad,
+    0xe7,0x59,0x5f,0x06,0xc1,0x2e,0xc4,0x94,0x35,0x48,0x9f,0xfe,0x7e,0xb3,0xa6,0x21,
+    0x84,0x67,0x93,0x00,0x45,0x06,0x24,0xce,0xce,0x6e,0x3e,0xde,0x0f,0xd7,0x68,0x3e,
+    0x3e,0x5a,0x67,0xc6,0xf6,0x38,0x7d,0x6e,0xce,0xb6,0x1b,0x9c,0xde,0x68,0xc3,0x2a,
+    0x2e,0xfa,0x29,0xbd,0x05,0xd1,0x82,0xe5,0x19,0x23,0x1f,0xa0,0x01,0x1a,0x1e,0xce,
+    0xe1,0x95,0xe6,0x4c,0x84,0x88,0x9f,0x89,0x90,0x8a,0x7c,0x33,0x1b,0xfc,0x0c,0xff,
+    0x0f,0xa6,0xe7,0x17,0xf5,0xe3,0x4c,0x70,0x09,0x51,0x09,0xbc,0x28,0xed,0xf4,0x3c,
+    0xbe,0xd8,0xfd,0xe2,0xb6,0x02,0x43,0xa1,0xde,0xe6,0xdc,0xd1,0xbc,0x9f,0x6e,0x04,
+    0x3c,0xce,0xdc,0x25,0xea,0x34,0xab,0xa7,0xee,0xe2,0xea,0x1b,0x4a,0x19,0x8d,0x46,
+    0x73,0x57,0x0e,0x92,0xdd,0x0d,0x77,0x42,0x4f,0x76,0x00,0xb4,0x38,0x42,0xc1,0x7e,
+    0xa9,0x7c,0xef,0x20,0xe7,0xed,0xb0,0x57,0x0e,0x69,0xf6,0xda,0x41,0x59,0x0f,0xaa,
+    0x17,0xd3,0xb6,0x98,0x8f,0xeb,0x7d,0xfb,0x63,0xf4,0x76,0x88,0xb8,0x24,0x03,0x32,
+    0xc3,0x07,0xe0,0x1b,0x05,0xd8,0x18,0xbd,0x12,0x06,0x00,0x00
     };
 
+// sand.html 44307 bytes (gzip 13312 bytes)
 static const uint8_t __webAutogenResource_sand_html[] PROGMEM {
-    0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6d,0x6c,0x3e,0x0a,
-    0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x0a,0x09,0x3c,0x68,0x65,0x61,0x64,0x3e,0x0a,0x09,
-    0x3c,0x6d,0x65,0x74,0x61,0x20,0x63,0x68,0x61,0x72,0x73,0x65,0x74,0x3d,0x22,0x75,
-    0x74,0x66,0x2d,0x38,0x22,0x3e,0x0a,0x09,0x3c,0x74,0x69,0x74,0x6c,0x65,0x3e,0x53,
-    0x61,0x6e,0x64,0x20,0x54,0x61,0x62,0x6c,0x65,0x3c,0x2f,0x74,0x69,0x74,0x6c,0x65,
-    0x3e,0x0a,0x09,0x3c,0x6d,0x65,0x74,0x61,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,
-    0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x22,0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,
-    0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x3d,0x64,0x65,0x76,0x69,0x63,0x65,0x2d,0x77,
-    0x69,0x64,0x74,0x68,0x2c,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x2d,0x73,0x63,0x61,
-    0x6c,0x65,0x3d,0x31,0x22,0x3e,0x0a,0x09,0x3c,0x73,0x63,0x72,0x69,0x70,0x74,0x20,
-    0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x2f,0x6a,0x61,0x76,0x61,0x73,
-    0x63,0x72,0x69,0x70,0x74,0x22,0x3e,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,
-    0x62,0x6f,0x64,0x79,0x49,0x73,0x4c,0x6f,0x61,0x64,0x65,0x64,0x28,0x29,0x7b,0x77,
-    0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x3d,0x7b,0x64,
-    0x65,0x66,0x61,0x75,0x6c,0x74,0x54,0x61,0x62,0x6c,0x65,0x53,0x69,0x7a,0x65,0x4d,
-    0x4d,0x3a,0x33,0x37,0x30,0x2c,0x63,0x75,0x72,0x50,0x61,0x67,0x65,0x3a,0x22,0x22,
-    0x2c,0x63,0x75,0x72,0x46,0x69,0x6c,0x65,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x4a,
-    0x73,0x6f,0x6e,0x3a,0x22,0x22,0x2c,0x6e,0x6f,0x6e,0x53,0x65,0x72,0x76,0x65,0x72,
-    0x48,0x6f,0x73,0x74,0x57,0x61,0x72,0x6e,0x3a,0x22,0x22,0x3d,0x3d,0x3d,0x6c,0x6f,
-    0x63,0x61,0x74,0x69,0x6f,0x6e,0x2e,0x68,0x6f,0x73,0x74,0x6e,0x61,0x6d,0x65,0x2c,
-    0x66,0x69,0x6c,0x65,0x45,0x78,0x63,0x6c,0x75,0x64,0x65,0x73,0x3a,0x5b,0x22,0x52,
-    0x4f,0x42,0x4f,0x54,0x2e,0x4a,0x53,0x4f,0x4e,0x22,0x5d,0x2c,0x6c,0x61,0x74,0x65,
-    0x73,0x74,0x46,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x49,0x6e,0x66,0x6f,0x3a,0x7b,
-    0x7d,0x2c,0x63,0x75,0x72,0x46,0x69,0x6c,0x65,0x54,0x79,0x70,0x65,0x3a,0x22,0x70,
-    0x61,0x72,0x61,0x6d,0x22,0x2c,0x6e,0x65,0x77,0x46,0x69,0x6c,0x65,0x54,0x79,0x70,
-    0x65,0x3a,0x22,0x70,0x61,0x72,0x61,0x6d,0x22,0x2c,0x66,0x69,0x6c,0x65,0x53,0x79,
-    0x73,0x74,0x65,0x6d,0x42,0x61,0x73,0x65,0x50,0x61,0x74,0x68,0x3a,0x22,0x22,0x2c,
-    0x6c,0x61,0x73,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x52,0x78,0x54,0x69,0x6d,0x65,
-    0x3a,0x6e,0x65,0x77,0x20,0x44,0x61,0x74,0x65,0x2c,0x73,0x74,0x61,0x74,0x75,0x73,
-    0x55,0x70,0x64,0x61,0x74,0x65,0x43,0x68,0x65,0x63,0x6b,0x4d,0x73,0x3a,0x32,0x65,
-    0x33,0x2c,0x73,0x74,0x61,0x74,0x75,0x73,0x55,0x70,0x64,0x61,0x74,0x65,0x54,0x6f,
-    0x6f,0x4c,0x61,0x74,0x65,0x4d,0x73,0x3a,0x31,0x35,0x65,0x33,0x2c,0x6d,0x61,0x78,
-    0x49,0x74,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x73,0x49,0x6e,0x45,0x76,0x61,0x6c,
-    0x3a,0x35,0x30,0x30,0x2c,0x6d,0x61,0x78,0x49,0x74,0x65,0x72,0x61,0x74,0x69,0x6f,
-    0x6e,0x73,0x49,0x6e,0x54,0x6f,0x74,0x61,0x6c,0x3a,0x31,0x65,0x35,0x2c,0x70,0x61,
-    0x74,0x74,0x65,0x72,0x6e,0x45,0x76,0x61,0x6c,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,
-    0x6c,0x4d,0x73,0x3a,0x31,0x30,0x30,0x2c,0x74,0x61,0x62,0x6c,0x65,0x43,0x61,0x6e,
-    0x76,0x61,0x73,0x50,0x74,0x49,0x73,0x56,0x61,0x6c,0x69,0x64,0x3a,0x21,0x31,0x2c,
-    0x66,0x69,0x6c,0x65,0x54,0x79,0x70,0x65,0x73,0x3a,0x5b,0x5b,0x22,0x70,0x61,0x72,
-    0x61,0x6d,0x22,0x2c,0x22,0x50,0x61,0x72,0x61,0x6d,0x65,0x74,0x72,0x69,0x63,0x22,
-    0x5d,0x2c,0x5b,0x22,0x67,0x63,0x6f,0x64,0x65,0x22,0x2c,0x22,0x47,0x2d,0x43,0x6f,
-    0x64,0x65,0x22,0x5d,0x2c,0x5b,0x22,0x74,0x68,0x72,0x22,0x2c,0x22,0x54,0x68,0x65,
-    0x74,0x61,0x2d,0x52,0x68,0x6f,0x22,0x5d,0x2c,0x5b,0x22,0x73,0x65,0x71,0x22,0x2c,
-    0x22,0x53,0x65,0x71,0x75,0x65,0x6e,0x63,0x65,0x22,0x5d,0x5d,0x2c,0x66,0x69,0x6c,
-    0x65,0x54,0x79,0x70,0x65,0x4c,0x6f,0x6f,0x6b,0x75,0x70,0x3a,0x7b,0x7d,0x2c,0x70,
-    0x61,0x72,0x61,0x6d,0x4e,0x65,0x77,0x4a,0x73,0x6f,0x6e,0x3a,0x7b,0x73,0x65,0x74,
-    0x75,0x70,0x3a,0x22,0x74,0x3d,0x30,0x5c,0x6e,0x52,0x3d,0x73,0x69,0x7a,0x65,0x58,
-    0x2f,0x32,0x5c,0x6e,0x22,0x2c,0x6c,0x6f,0x6f,0x70,0x3a,0x22,0x78,0x3d,0x52,0x2a,
-    0x73,0x69,0x6e,0x28,0x74,0x29,0x5c,0x6e,0x79,0x3d,0x52,0x2a,0x63,0x6f,0x73,0x28,
-    0x74,0x29,0x5c,0x6e,0x52,0x3d,0x52,0x2d,0x30,0x2e,0x33,0x5c,0x6e,0x74,0x3d,0x74,
-    0x2b,0x30,0x2e,0x31,0x5c,0x6e,0x73,0x74,0x6f,0x70,0x3d,0x52,0x3c,0x32,0x30,0x5c,
-    0x6e,0x22,0x7d,0x2c,0x74,0x68,0x72,0x4e,0x65,0x77,0x43,0x6f,0x6e,0x74,0x65,0x6e,
-    0x74,0x3a,0x22,0x30,0x20,0x30,0x5c,0x6e,0x36,0x32,0x2e,0x38,0x20,0x31,0x22,0x2c,
-    0x63,0x61,0x6e,0x76,0x61,0x73,0x42,0x6f,0x72,0x64,0x65,0x72,0x3a,0x31,0x30,0x2c,
-    0x63,0x61,0x6e,0x76,0x61,0x73,0x53,0x69,0x7a,0x65,0x3a,0x32,0x30,0x30,0x2c,0x74,
-    0x68,0x72,0x4d,0x61,0x78,0x54,0x68,0x65,0x74,0x61,0x49,0x6e,0x63,0x3a,0x4d,0x61,
-    0x74,0x68,0x2e,0x50,0x49,0x2f,0x36,0x34,0x7d,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,
-    0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x3d,0x7b,0x6d,0x61,0x78,0x43,
-    0x66,0x67,0x4c,0x65,0x6e,0x3a,0x32,0x65,0x33,0x2c,0x6e,0x61,0x6d,0x65,0x3a,0x22,
-    0x53,0x61,0x6e,0x64,0x20,0x54,0x61,0x62,0x6c,0x65,0x22,0x2c,0x73,0x74,0x61,0x72,
-    0x74,0x75,0x70,0x3a,0x22,0x22,0x7d,0x3b,0x76,0x61,0x72,0x20,0x65,0x2c,0x74,0x3d,
-    0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x66,
-    0x69,0x6c,0x65,0x54,0x79,0x70,0x65,0x73,0x3b,0x66,0x6f,0x72,0x28,0x6c,0x65,0x74,
-    0x20,0x65,0x3d,0x30,0x3b,0x65,0x3c,0x74,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,
-    0x65,0x2b,0x2b,0x29,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,
-    0x74,0x65,0x2e,0x66,0x69,0x6c,0x65,0x54,0x79,0x70,0x65,0x4c,0x6f,0x6f,0x6b,0x75,
-    0x70,0x5b,0x74,0x5b,0x65,0x5d,0x5b,0x30,0x5d,0x5d,0x3d,0x74,0x5b,0x65,0x5d,0x5b,
-    0x31,0x5d,0x3b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,
-    0x65,0x2e,0x6e,0x6f,0x6e,0x53,0x65,0x72,0x76,0x65,0x72,0x48,0x6f,0x73,0x74,0x57,
-    0x61,0x72,0x6e,0x3f,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,
-    0x53,0x74,0x61,0x74,0x65,0x2e,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x53,0x61,0x6e,0x64,
-    0x20,0x54,0x61,0x62,0x6c,0x65,0x20,0x2d,0x20,0x49,0x20,0x6d,0x75,0x73,0x74,0x20,
-    0x72,0x75,0x6e,0x20,0x6f,0x6e,0x20,0x61,0x20,0x73,0x65,0x72,0x76,0x65,0x72,0x21,
-    0x22,0x2c,0x73,0x61,0x6e,0x64,0x54,0x61,0x62,0x6c,0x65,0x53,0x65,0x74,0x74,0x69,
-    0x6e,0x67,0x73,0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x4f,0x6b,0x28,0x4a,0x53,
-    0x4f,0x4e,0x2e,0x73,0x74,0x72,0x69,0x6e,0x67,0x69,0x66,0x79,0x28,0x77,0x69,0x6e,
-    0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x29,0x29,0x29,
-    0x3a,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x45,0x76,0x65,0x6e,0x74,0x53,0x6f,
-    0x75,0x72,0x63,0x65,0x26,0x26,0x28,0x28,0x65,0x3d,0x6e,0x65,0x77,0x20,0x45,0x76,
-    0x65,0x6e,0x74,0x53,0x6f,0x75,0x72,0x63,0x65,0x28,0x22,0x2f,0x65,0x76,0x65,0x6e,
-    0x74,0x73,0x22,0x29,0x29,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,
-    0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x6f,0x70,0x65,0x6e,0x22,0x2c,0x66,0x75,
-    0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,
-    0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x41,0x73,0x79,0x6e,0x63,0x20,0x65,0x76,0x65,
-    0x6e,0x74,0x73,0x20,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x65,0x64,0x22,0x29,0x7d,
-    0x2c,0x21,0x31,0x29,0x2c,0x65,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,
-    0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x65,0x72,0x72,0x6f,0x72,0x22,0x2c,
-    0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,0x29,0x7b,0x65,0x2e,0x74,0x61,
-    0x72,0x67,0x65,0x74,0x2e,0x72,0x65,0x61,0x64,0x79,0x53,0x74,0x61,0x74,0x65,0x21,
-    0x3d,0x45,0x76,0x65,0x6e,0x74,0x53,0x6f,0x75,0x72,0x63,0x65,0x2e,0x4f,0x50,0x45,
-    0x4e,0x26,0x26,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,
-    0x45,0x76,0x65,0x6e,0x74,0x73,0x20,0x44,0x69,0x73,0x63,0x6f,0x6e,0x6e,0x65,0x63,
-    0x74,0x65,0x64,0x22,0x29,0x7d,0x2c,0x21,0x31,0x29,0x2c,0x65,0x2e,0x61,0x64,0x64,
-    0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x73,
-    0x74,0x61,0x74,0x75,0x73,0x22,0x2c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,
-    0x65,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,
-    0x73,0x74,0x61,0x74,0x75,0x73,0x22,0x2c,0x65,0x2e,0x64,0x61,0x74,0x61,0x29,0x3b,
-    0x74,0x72,0x79,0x7b,0x76,0x61,0x72,0x20,0x74,0x3d,0x4a,0x53,0x4f,0x4e,0x2e,0x70,
-    0x61,0x72,0x73,0x65,0x28,0x65,0x2e,0x64,0x61,0x74,0x61,0x29,0x2c,0x61,0x3d,0x28,
-    0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,
-    0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x73,0x74,0x61,0x74,0x75,0x73,0x2d,
-    0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x65,0x64,0x22,0x29,0x2e,0x63,0x6c,0x61,0x73,
-    0x73,0x4c,0x69,0x73,0x74,0x2e,0x61,0x64,0x64,0x28,0x22,0x6e,0x6f,0x64,0x69,0x73,
-    0x70,0x6c,0x61,0x79,0x22,0x29,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,
-    0x53,0x74,0x61,0x74,0x65,0x2e,0x6c,0x61,0x73,0x74,0x53,0x74,0x61,0x74,0x75,0x73,
-    0x52,0x78,0x54,0x69,0x6d,0x65,0x3d,0x6e,0x65,0x77,0x20,0x44,0x61,0x74,0x65,0x2c,
-    0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,
-    0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x73,0x74,0x61,0x74,0x75,0x73,0x2d,
-    0x70,0x61,0x75,0x73,0x65,0x64,0x22,0x29,0x29,0x3b,0x30,0x3d,0x3d,0x74,0x2e,0x70,
-    0x61,0x75,0x73,0x65,0x3f,0x61,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4c,0x69,0x73,0x74,
-    0x2e,0x61,0x64,0x64,0x28,0x22,0x6e,0x6f,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x22,
-    0x29,0x3a,0x61,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4c,0x69,0x73,0x74,0x2e,0x72,0x65,
-    0x6d,0x6f,0x76,0x65,0x28,0x22,0x6e,0x6f,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x22,
-    0x29,0x7d,0x63,0x61,0x74,0x63,0x68,0x28,0x65,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,
-    0x6c,0x65,0x2e,0x65,0x72,0x72,0x6f,0x72,0x28,0x22,0x46,0x61,0x69,0x6c,0x65,0x64,
-    0x20,0x74,0x6f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x73,0x74,0x61,0x74,0x75,0x73,
-    0x20,0x4a,0x53,0x4f,0x4e,0x22,0x29,0x7d,0x7d,0x2c,0x21,0x31,0x29,0x29,0x2c,0x72,
-    0x65,0x71,0x46,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x41,0x6e,0x64,0x55,0x70,0x64,
-    0x61,0x74,0x65,0x28,0x29,0x2c,0x73,0x65,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,
-    0x6c,0x28,0x73,0x74,0x61,0x74,0x75,0x73,0x55,0x70,0x64,0x61,0x74,0x65,0x54,0x69,
-    0x6d,0x65,0x72,0x48,0x61,0x6e,0x64,0x6c,0x65,0x72,0x2c,0x77,0x69,0x6e,0x64,0x6f,
-    0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,
-    0x55,0x70,0x64,0x61,0x74,0x65,0x43,0x68,0x65,0x63,0x6b,0x4d,0x73,0x29,0x2c,0x77,
-    0x69,0x6e,0x64,0x6f,0x77,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,
-    0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x72,0x65,0x73,0x69,0x7a,0x65,0x22,0x2c,
-    0x72,0x65,0x73,0x69,0x7a,0x65,0x45,0x76,0x65,0x6e,0x74,0x48,0x61,0x6e,0x64,0x6c,
-    0x65,0x72,0x29,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x74,
-    0x61,0x74,0x75,0x73,0x55,0x70,0x64,0x61,0x74,0x65,0x54,0x69,0x6d,0x65,0x72,0x48,
-    0x61,0x6e,0x64,0x6c,0x65,0x72,0x28,0x29,0x7b,0x6e,0x65,0x77,0x20,0x44,0x61,0x74,
-    0x65,0x2d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,
-    0x2e,0x6c,0x61,0x73,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x52,0x78,0x54,0x69,0x6d,
-    0x65,0x3e,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,
-    0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x55,0x70,0x64,0x61,0x74,0x65,0x54,0x6f,0x6f,
-    0x4c,0x61,0x74,0x65,0x4d,0x73,0x26,0x26,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,
-    0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,
-    0x22,0x73,0x74,0x61,0x74,0x75,0x73,0x2d,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x65,
-    0x64,0x22,0x29,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4c,0x69,0x73,0x74,0x2e,0x72,0x65,
-    0x6d,0x6f,0x76,0x65,0x28,0x22,0x6e,0x6f,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x22,
-    0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x72,0x65,0x73,0x69,0x7a,
-    0x65,0x45,0x76,0x65,0x6e,0x74,0x48,0x61,0x6e,0x64,0x6c,0x65,0x72,0x28,0x29,0x7b,
-    0x73,0x65,0x74,0x43,0x61,0x6e,0x76,0x61,0x73,0x53,0x68,0x61,0x70,0x65,0x41,0x6e,
-    0x64,0x53,0x69,0x7a,0x65,0x28,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
-    0x20,0x72,0x65,0x71,0x46,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x41,0x6e,0x64,0x55,
-    0x70,0x64,0x61,0x74,0x65,0x28,0x29,0x7b,0x63,0x61,0x6c,0x6c,0x41,0x6a,0x61,0x78,
-    0x28,0x22,0x2f,0x66,0x69,0x6c,0x65,0x6c,0x69,0x73,0x74,0x2f,0x22,0x2c,0x66,0x69,
-    0x6c,0x65,0x4c,0x69,0x73,0x74,0x55,0x70,0x64,0x61,0x74,0x65,0x4f,0x6b,0x2c,0x66,
-    0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x55,0x70,0x64,0x61,0x74,0x65,0x46,0x61,0x69,
-    0x6c,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x66,0x69,0x6c,0x65,
-    0x4c,0x69,0x73,0x74,0x55,0x70,0x64,0x61,0x74,0x65,0x46,0x61,0x69,0x6c,0x28,0x29,
-    0x7b,0x72,0x65,0x71,0x53,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x41,0x6e,0x64,0x55,
-    0x70,0x64,0x61,0x74,0x65,0x28,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
-    0x20,0x66,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x55,0x70,0x64,0x61,0x74,0x65,0x4f,
-    0x6b,0x28,0x65,0x29,0x7b,0x74,0x72,0x79,0x7b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,
-    0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x6c,0x61,0x74,0x65,0x73,0x74,0x46,0x69,
-    0x6c,0x65,0x4c,0x69,0x73,0x74,0x49,0x6e,0x66,0x6f,0x3d,0x4a,0x53,0x4f,0x4e,0x2e,
-    0x70,0x61,0x72,0x73,0x65,0x28,0x65,0x29,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,
-    0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x66,0x69,0x6c,0x65,0x53,0x79,0x73,0x74,
-    0x65,0x6d,0x42,0x61,0x73,0x65,0x50,0x61,0x74,0x68,0x3d,0x77,0x69,0x6e,0x64,0x6f,
-    0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x6c,0x61,0x74,0x65,0x73,0x74,
-    0x46,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x49,0x6e,0x66,0x6f,0x2e,0x66,0x73,0x42,
-    0x61,0x73,0x65,0x7d,0x63,0x61,0x74,0x63,0x68,0x28,0x65,0x29,0x7b,0x63,0x6f,0x6e,
-    0x73,0x6f,0x6c,0x65,0x2e,0x65,0x72,0x72,0x6f,0x72,0x28,0x22,0x46,0x61,0x69,0x6c,
-    0x65,0x64,0x20,0x74,0x6f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x72,0x65,0x63,0x65,
-    0x69,0x76,0x65,0x64,0x20,0x4a,0x53,0x4f,0x4e,0x20,0x66,0x69,0x6c,0x65,0x20,0x6c,
-    0x69,0x73,0x74,0x22,0x29,0x2c,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x65,0x72,
-    0x72,0x6f,0x72,0x28,0x65,0x29,0x7d,0x72,0x65,0x71,0x53,0x65,0x74,0x74,0x69,0x6e,
-    0x67,0x73,0x41,0x6e,0x64,0x55,0x70,0x64,0x61,0x74,0x65,0x28,0x29,0x7d,0x66,0x75,
-    0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x72,0x65,0x71,0x53,0x65,0x74,0x74,0x69,0x6e,
-    0x67,0x73,0x41,0x6e,0x64,0x55,0x70,0x64,0x61,0x74,0x65,0x28,0x29,0x7b,0x63,0x61,
-    0x6c,0x6c,0x41,0x6a,0x61,0x78,0x28,0x22,0x2f,0x67,0x65,0x74,0x73,0x65,0x74,0x74,
-    0x69,0x6e,0x67,0x73,0x22,0x2c,0x73,0x61,0x6e,0x64,0x54,0x61,0x62,0x6c,0x65,0x53,
-    0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x4f,
-    0x6b,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x61,0x6e,0x64,
-    0x54,0x61,0x62,0x6c,0x65,0x53,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x43,0x61,0x6c,
-    0x6c,0x62,0x61,0x63,0x6b,0x4f,0x6b,0x28,0x65,0x29,0x7b,0x69,0x66,0x28,0x22,0x22,
-    0x21,0x3d,0x3d,0x65,0x26,0x26,0x22,0x7b,0x7d,0x22,0x21,0x3d,0x3d,0x65,0x29,0x7b,
-    0x76,0x61,0x72,0x20,0x74,0x3b,0x74,0x72,0x79,0x7b,0x74,0x3d,0x4a,0x53,0x4f,0x4e,
-    0x2e,0x70,0x61,0x72,0x73,0x65,0x28,0x65,0x29,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,
-    0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x3d,0x74,0x7d,0x63,0x61,0x74,
-    0x63,0x68,0x28,0x65,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x65,0x72,
-    0x72,0x6f,0x72,0x28,0x22,0x46,0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,0x20,0x70,
-    0x61,0x72,0x73,0x65,0x20,0x4a,0x53,0x4f,0x4e,0x20,0x73,0x65,0x74,0x74,0x69,0x6e,
-    0x67,0x73,0x20,0x22,0x2b,0x6a,0x73,0x6f,0x6e,0x29,0x2c,0x63,0x6f,0x6e,0x73,0x6f,
-    0x6c,0x65,0x2e,0x65,0x72,0x72,0x6f,0x72,0x28,0x65,0x29,0x7d,0x7d,0x75,0x70,0x64,
-    0x61,0x74,0x65,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,0x28,0x29,0x7d,0x66,0x75,0x6e,
-    0x63,0x74,0x69,0x6f,0x6e,0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x44,0x69,0x73,0x70,
-    0x6c,0x61,0x79,0x28,0x29,0x7b,0x67,0x65,0x6e,0x50,0x61,0x67,0x65,0x48,0x65,0x61,
-    0x64,0x65,0x72,0x28,0x29,0x2c,0x67,0x65,0x6e,0x50,0x61,0x67,0x65,0x42,0x6f,0x64,
-    0x79,0x28,0x29,0x2c,0x69,0x63,0x6f,0x6e,0x47,0x65,0x6e,0x28,0x22,0x6c,0x6f,0x67,
-    0x6f,0x43,0x61,0x6e,0x76,0x61,0x73,0x22,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,
-    0x6f,0x6e,0x20,0x75,0x73,0x65,0x72,0x41,0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,0x2c,
-    0x74,0x2c,0x61,0x2c,0x6e,0x29,0x7b,0x69,0x66,0x28,0x22,0x64,0x65,0x6c,0x65,0x74,
-    0x65,0x22,0x3d,0x3d,0x3d,0x74,0x29,0x63,0x6f,0x6e,0x66,0x69,0x72,0x6d,0x28,0x22,
-    0x41,0x72,0x65,0x20,0x79,0x6f,0x75,0x20,0x73,0x75,0x72,0x65,0x20,0x79,0x6f,0x75,
-    0x20,0x77,0x61,0x6e,0x74,0x20,0x74,0x6f,0x20,0x64,0x65,0x6c,0x65,0x74,0x65,0x3f,
-    0x22,0x29,0x26,0x26,0x28,0x63,0x61,0x6c,0x6c,0x41,0x6a,0x61,0x78,0x28,0x22,0x2f,
-    0x64,0x65,0x6c,0x65,0x74,0x65,0x46,0x69,0x6c,0x65,0x22,0x2b,0x77,0x69,0x6e,0x64,
-    0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x66,0x69,0x6c,0x65,0x53,
-    0x79,0x73,0x74,0x65,0x6d,0x42,0x61,0x73,0x65,0x50,0x61,0x74,0x68,0x2b,0x22,0x2f,
-    0x22,0x2b,0x61,0x2c,0x66,0x69,0x6c,0x65,0x44,0x65,0x6c,0x65,0x74,0x65,0x4f,0x6b,
-    0x2c,0x66,0x69,0x6c,0x65,0x44,0x65,0x6c,0x65,0x74,0x65,0x46,0x61,0x69,0x6c,0x29,
-    0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,
-    0x63,0x75,0x72,0x50,0x61,0x67,0x65,0x3d,0x22,0x22,0x2c,0x72,0x65,0x71,0x46,0x69,
-    0x6c,0x65,0x4c,0x69,0x73,0x74,0x41,0x6e,0x64,0x55,0x70,0x64,0x61,0x74,0x65,0x28,
-    0x29,0x29,0x3b,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x28,0x22,0x73,0x61,0x76,0x65,
-    0x22,0x3d,0x3d,0x3d,0x74,0x29,0x7b,0x76,0x61,0x72,0x20,0x6f,0x3d,0x64,0x6f,0x63,
-    0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,
-    0x42,0x79,0x49,0x64,0x28,0x22,0x66,0x69,0x6c,0x65,0x4e,0x61,0x6d,0x65,0x4e,0x6f,
-    0x45,0x78,0x74,0x65,0x6e,0x73,0x69,0x6f,0x6e,0x22,0x29,0x3b,0x6c,0x65,0x74,0x20,
-    0x6e,0x3d,0x22,0x22,0x3b,0x69,0x66,0x28,0x30,0x21,0x3d,0x3d,0x28,0x6e,0x3d,0x28,
-    0x6e,0x3d,0x28,0x6e,0x3d,0x28,0x6e,0x3d,0x28,0x22,0x70,0x61,0x74,0x45,0x64,0x69,
-    0x74,0x22,0x3d,0x3d,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,
-    0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x50,0x61,0x67,0x65,0x2e,0x74,0x72,0x69,0x6d,
-    0x28,0x29,0x3f,0x6f,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3a,0x6f,
-    0x2e,0x76,0x61,0x6c,0x75,0x65,0x29,0x2e,0x74,0x72,0x69,0x6d,0x28,0x29,0x29,0x2e,
-    0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x28,0x27,0x22,0x27,0x2c,0x22,0x22,0x29,0x29,
-    0x2e,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x28,0x22,0x5c,0x5c,0x22,0x2c,0x22,0x22,
-    0x29,0x29,0x2e,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x28,0x22,0x3f,0x22,0x2c,0x22,
-    0x22,0x29,0x29,0x2e,0x74,0x72,0x69,0x6d,0x28,0x29,0x2e,0x6c,0x65,0x6e,0x67,0x74,
-    0x68,0x29,0x7b,0x6c,0x65,0x74,0x20,0x65,0x3d,0x22,0x22,0x3b,0x65,0x3d,0x22,0x70,
-    0x61,0x72,0x61,0x6d,0x22,0x3d,0x3d,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,
-    0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x46,0x69,0x6c,0x65,0x54,0x79,
-    0x70,0x65,0x3f,0x28,0x6f,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,
-    0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x70,
-    0x61,0x74,0x73,0x65,0x74,0x75,0x70,0x22,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,
-    0x69,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,
-    0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x70,0x61,0x74,0x6c,0x6f,
-    0x6f,0x70,0x22,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,0x4a,0x53,0x4f,0x4e,0x2e,
-    0x73,0x74,0x72,0x69,0x6e,0x67,0x69,0x66,0x79,0x28,0x7b,0x73,0x65,0x74,0x75,0x70,
-    0x3a,0x6f,0x2c,0x6c,0x6f,0x6f,0x70,0x3a,0x69,0x7d,0x29,0x29,0x3a,0x64,0x6f,0x63,
-    0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,
-    0x42,0x79,0x49,0x64,0x28,0x22,0x74,0x65,0x78,0x74,0x63,0x6f,0x6e,0x74,0x65,0x6e,
-    0x74,0x73,0x22,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x76,0x61,0x72,0x20,0x6f,
-    0x3d,0x6e,0x65,0x77,0x20,0x46,0x6f,0x72,0x6d,0x44,0x61,0x74,0x61,0x2c,0x69,0x3d,
-    0x6e,0x65,0x77,0x20,0x42,0x6c,0x6f,0x62,0x28,0x5b,0x65,0x5d,0x2c,0x7b,0x74,0x79,
-    0x70,0x65,0x3a,0x22,0x70,0x6c,0x61,0x69,0x6e,0x2f,0x74,0x65,0x78,0x74,0x22,0x7d,
-    0x29,0x3b,0x6f,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x22,0x66,0x69,0x6c,0x65,
-    0x22,0x2c,0x69,0x2c,0x6e,0x2b,0x22,0x2e,0x22,0x2b,0x77,0x69,0x6e,0x64,0x6f,0x77,
-    0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x46,0x69,0x6c,0x65,
-    0x54,0x79,0x70,0x65,0x29,0x3b,0x6c,0x65,0x74,0x20,0x74,0x3d,0x6e,0x65,0x77,0x20,
-    0x58,0x4d,0x4c,0x48,0x74,0x74,0x70,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x2c,0x61,
-    0x3d,0x66,0x69,0x6c,0x65,0x53,0x61,0x76,0x65,0x46,0x61,0x69,0x6c,0x3b,0x74,0x2e,
-    0x6f,0x6e,0x72,0x65,0x61,0x64,0x79,0x73,0x74,0x61,0x74,0x65,0x63,0x68,0x61,0x6e,
-    0x67,0x65,0x3d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x7b,0x34,0x3d,
-    0x3d,0x3d,0x74,0x2e,0x72,0x65,0x61,0x64,0x79,0x53,0x74,0x61,0x74,0x65,0x26,0x26,
-    0x28,0x32,0x30,0x30,0x3d,0x3d,0x3d,0x74,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x3f,
-    0x28,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x53,0x61,
-    0x76,0x65,0x20,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x20,0x22,0x2b,0x74,0x2e,
-    0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x54,0x65,0x78,0x74,0x29,0x2c,0x77,0x69,
-    0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,
-    0x50,0x61,0x67,0x65,0x3d,0x22,0x22,0x2c,0x75,0x73,0x65,0x72,0x41,0x63,0x74,0x69,
-    0x6f,0x6e,0x53,0x61,0x76,0x65,0x46,0x69,0x6c,0x65,0x4f,0x6b,0x28,0x29,0x29,0x3a,
-    0x76,0x6f,0x69,0x64,0x20,0x30,0x21,0x3d,0x3d,0x61,0x26,0x26,0x76,0x6f,0x69,0x64,
-    0x20,0x30,0x21,0x3d,0x3d,0x61,0x26,0x26,0x28,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,
-    0x2e,0x6c,0x6f,0x67,0x28,0x22,0x53,0x61,0x76,0x65,0x20,0x66,0x61,0x69,0x6c,0x65,
-    0x64,0x20,0x22,0x2b,0x74,0x2e,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x54,0x65,
-    0x78,0x74,0x29,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,
-    0x74,0x65,0x2e,0x63,0x75,0x72,0x50,0x61,0x67,0x65,0x3d,0x22,0x22,0x2c,0x75,0x73,
-    0x65,0x72,0x41,0x63,0x74,0x69,0x6f,0x6e,0x53,0x61,0x76,0x65,0x46,0x69,0x6c,0x65,
-    0x46,0x61,0x69,0x6c,0x28,0x29,0x29,0x29,0x7d,0x2c,0x74,0x2e,0x6f,0x70,0x65,0x6e,
-    0x28,0x22,0x50,0x4f,0x53,0x54,0x22,0x2c,0x22,0x2f,0x75,0x70,0x6c,0x6f,0x61,0x64,
-    0x74,0x6f,0x66,0x69,0x6c,0x65,0x6d,0x61,0x6e,0x22,0x29,0x2c,0x74,0x2e,0x73,0x65,
-    0x6e,0x64,0x28,0x6f,0x29,0x7d,0x7d,0x65,0x6c,0x73,0x65,0x22,0x63,0x61,0x6e,0x63,
-    0x65,0x6c,0x22,0x3d,0x3d,0x3d,0x74,0x3f,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,
-    0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x50,0x61,0x67,0x65,0x3d,
-    0x22,0x22,0x2c,0x75,0x70,0x64,0x61,0x74,0x65,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,
-    0x28,0x29,0x29,0x3a,0x22,0x61,0x64,0x64,0x22,0x3d,0x3d,0x3d,0x74,0x3f,0x28,0x22,
-    0x66,0x69,0x6c,0x65,0x22,0x3d,0x3d,0x3d,0x65,0x26,0x26,0x28,0x77,0x69,0x6e,0x64,
-    0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x50,0x61,
-    0x67,0x65,0x3d,0x22,0x70,0x61,0x74,0x41,0x64,0x64,0x22,0x29,0x2c,0x77,0x69,0x6e,
-    0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x49,
-    0x74,0x65,0x6d,0x3d,0x22,0x22,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,
-    0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x46,0x69,0x6c,0x65,0x43,0x6f,0x6e,
-    0x74,0x65,0x6e,0x74,0x4a,0x73,0x6f,0x6e,0x3d,0x22,0x22,0x2c,0x77,0x69,0x6e,0x64,
-    0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x46,0x69,
-    0x6c,0x65,0x54,0x79,0x70,0x65,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,
-    0x53,0x74,0x61,0x74,0x65,0x2e,0x6e,0x65,0x77,0x46,0x69,0x6c,0x65,0x54,0x79,0x70,
-    0x65,0x2c,0x75,0x70,0x64,0x61,0x74,0x65,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,0x28,
-    0x29,0x29,0x3a,0x22,0x65,0x64,0x69,0x74,0x22,0x3d,0x3d,0x3d,0x74,0x3f,0x28,0x77,
-    0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,
-    0x72,0x49,0x74,0x65,0x6d,0x3d,0x61,0x2c,0x63,0x61,0x6c,0x6c,0x41,0x6a,0x61,0x78,
-    0x28,0x22,0x2f,0x66,0x69,0x6c,0x65,0x73,0x22,0x2b,0x77,0x69,0x6e,0x64,0x6f,0x77,
-    0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x66,0x69,0x6c,0x65,0x53,0x79,0x73,
-    0x74,0x65,0x6d,0x42,0x61,0x73,0x65,0x50,0x61,0x74,0x68,0x2b,0x22,0x2f,0x22,0x2b,
-    0x61,0x2c,0x66,0x69,0x6c,0x65,0x52,0x65,0x61,0x64,0x54,0x6f,0x45,0x64,0x69,0x74,
-    0x29,0x29,0x3a,0x22,0x72,0x75,0x6e,0x22,0x3d,0x3d,0x3d,0x74,0x3f,0x63,0x61,0x6c,
-    0x6c,0x41,0x6a,0x61,0x78,0x28,0x22,0x2f,0x70,0x6c,0x61,0x79,0x46,0x69,0x6c,0x65,
-    0x22,0x2b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,
-    0x2e,0x66,0x69,0x6c,0x65,0x53,0x79,0x73,0x74,0x65,0x6d,0x42,0x61,0x73,0x65,0x50,
-    0x61,0x74,0x68,0x2b,0x22,0x2f,0x22,0x2b,0x61,0x2c,0x61,0x6a,0x61,0x78,0x44,0x65,
-    0x66,0x61,0x75,0x6c,0x74,0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x29,0x3a,0x22,
-    0x72,0x75,0x6e,0x41,0x74,0x53,0x74,0x61,0x72,0x74,0x22,0x3d,0x3d,0x3d,0x74,0x26,
-    0x26,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,
-    0x74,0x65,0x2e,0x73,0x74,0x61,0x72,0x74,0x75,0x70,0x3d,0x6e,0x3f,0x22,0x22,0x3a,
-    0x61,0x2c,0x70,0x6f,0x73,0x74,0x53,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x28,0x29,
-    0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x66,0x69,0x6c,0x65,0x44,
-    0x65,0x6c,0x65,0x74,0x65,0x4f,0x6b,0x28,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,
-    0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x44,0x65,0x6c,0x65,0x74,0x65,0x64,0x20,0x66,
-    0x69,0x6c,0x65,0x20,0x6f,0x6b,0x22,0x29,0x2c,0x72,0x65,0x71,0x46,0x69,0x6c,0x65,
-    0x4c,0x69,0x73,0x74,0x41,0x6e,0x64,0x55,0x70,0x64,0x61,0x74,0x65,0x28,0x29,0x7d,
-    0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x66,0x69,0x6c,0x65,0x44,0x65,0x6c,
-    0x65,0x74,0x65,0x46,0x61,0x69,0x6c,0x28,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,
-    0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x44,0x65,0x6c,0x65,0x74,0x65,0x20,0x66,0x69,
-    0x6c,0x65,0x20,0x66,0x61,0x69,0x6c,0x65,0x64,0x22,0x29,0x2c,0x72,0x65,0x71,0x46,
-    0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x41,0x6e,0x64,0x55,0x70,0x64,0x61,0x74,0x65,
-    0x28,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x66,0x69,0x6c,0x65,
-    0x53,0x61,0x76,0x65,0x46,0x61,0x69,0x6c,0x28,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,
-    0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x53,0x61,0x76,0x65,0x20,0x66,0x69,0x6c,
-    0x65,0x20,0x66,0x61,0x69,0x6c,0x65,0x64,0x22,0x29,0x2c,0x72,0x65,0x71,0x46,0x69,
-    0x6c,0x65,0x4c,0x69,0x73,0x74,0x41,0x6e,0x64,0x55,0x70,0x64,0x61,0x74,0x65,0x28,
-    0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x70,0x6f,0x73,0x74,0x53,
-    0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x28,0x29,0x7b,0x6c,0x65,0x74,0x20,0x65,0x3d,
-    0x4a,0x53,0x4f,0x4e,0x2e,0x73,0x74,0x72,0x69,0x6e,0x67,0x69,0x66,0x79,0x28,0x77,
-    0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x29,
-    0x3b,0x65,0x3d,0x65,0x2e,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x28,0x22,0x5c,0x6e,
-    0x22,0x2c,0x22,0x5c,0x5c,0x6e,0x22,0x29,0x2c,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,
-    0x2e,0x6c,0x6f,0x67,0x28,0x22,0x50,0x4f,0x53,0x54,0x49,0x4e,0x47,0x20,0x22,0x2b,
-    0x65,0x29,0x2c,0x70,0x6f,0x73,0x74,0x4a,0x73,0x6f,0x6e,0x28,0x22,0x2f,0x70,0x6f,
-    0x73,0x74,0x73,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x22,0x2c,0x65,0x2c,0x70,0x6f,
-    0x73,0x74,0x53,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x4f,0x6b,0x43,0x61,0x6c,0x6c,
-    0x62,0x61,0x63,0x6b,0x2c,0x70,0x6f,0x73,0x74,0x53,0x65,0x74,0x74,0x69,0x6e,0x67,
-    0x73,0x46,0x61,0x69,0x6c,0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x29,0x7d,0x66,
-    0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x70,0x6f,0x73,0x74,0x53,0x65,0x74,0x74,
-    0x69,0x6e,0x67,0x73,0x4f,0x6b,0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x28,0x29,
-    0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x50,0x6f,
-    0x73,0x74,0x65,0x64,0x20,0x73,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x20,0x6f,0x6b,
-    0x22,0x29,0x2c,0x75,0x70,0x64,0x61,0x74,0x65,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,
-    0x28,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x70,0x6f,0x73,0x74,
-    0x53,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x46,0x61,0x69,0x6c,0x43,0x61,0x6c,0x6c,
-    0x62,0x61,0x63,0x6b,0x28,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,
-    0x6f,0x67,0x28,0x22,0x50,0x6f,0x73,0x74,0x20,0x73,0x65,0x74,0x74,0x69,0x6e,0x67,
-    0x73,0x20,0x46,0x41,0x49,0x4c,0x45,0x44,0x22,0x29,0x2c,0x75,0x70,0x64,0x61,0x74,
-    0x65,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,0x28,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,
-    0x69,0x6f,0x6e,0x20,0x75,0x73,0x65,0x72,0x41,0x63,0x74,0x69,0x6f,0x6e,0x53,0x61,
-    0x76,0x65,0x46,0x69,0x6c,0x65,0x4f,0x6b,0x28,0x29,0x7b,0x72,0x65,0x71,0x46,0x69,
-    0x6c,0x65,0x4c,0x69,0x73,0x74,0x41,0x6e,0x64,0x55,0x70,0x64,0x61,0x74,0x65,0x28,
-    0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x75,0x73,0x65,0x72,0x41,
-    0x63,0x74,0x69,0x6f,0x6e,0x53,0x61,0x76,0x65,0x46,0x69,0x6c,0x65,0x46,0x61,0x69,
-    0x6c,0x28,0x29,0x7b,0x72,0x65,0x71,0x46,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x41,
-    0x6e,0x64,0x55,0x70,0x64,0x61,0x74,0x65,0x28,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,
-    0x69,0x6f,0x6e,0x20,0x67,0x65,0x6e,0x42,0x75,0x74,0x74,0x6f,0x6e,0x28,0x65,0x2c,
-    0x74,0x2c,0x61,0x2c,0x6e,0x2c,0x6f,0x2c,0x69,0x2c,0x73,0x2c,0x6c,0x29,0x7b,0x6c,
-    0x65,0x74,0x20,0x72,0x3d,0x22,0x22,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x65,
-    0x3d,0x65,0x2e,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x28,0x22,0x7e,0x6b,0x65,0x79,
-    0x7e,0x22,0x2c,0x74,0x29,0x2c,0x72,0x2b,0x3d,0x22,0x3c,0x73,0x70,0x61,0x6e,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x22,0x2b,0x69,0x2b,0x22,0x20,0x62,0x74,0x6e,
-    0x27,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x27,0x22,0x2b,0x65,0x2b,0x22,
-    0x27,0x20,0x22,0x2b,0x28,0x6c,0x3f,0x22,0x22,0x3a,0x22,0x64,0x69,0x73,0x61,0x62,
-    0x6c,0x65,0x64,0x22,0x29,0x2b,0x22,0x3e,0x22,0x2c,0x22,0x45,0x64,0x69,0x74,0x22,
-    0x3d,0x3d,0x3d,0x6f,0x3f,0x72,0x2b,0x3d,0x27,0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,
-    0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,
-    0x22,0x3e,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,
-    0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x65,0x64,0x69,0x74,0x22,0x3e,0x3c,0x2f,
-    0x75,0x73,0x65,0x3e,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x27,0x3a,0x22,0x52,0x75,0x6e,
-    0x22,0x3d,0x3d,0x3d,0x6f,0x3f,0x72,0x2b,0x3d,0x27,0x3c,0x73,0x76,0x67,0x20,0x63,
-    0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x61,0x63,0x74,0x69,0x6f,
-    0x6e,0x22,0x3e,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,
-    0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x70,0x6c,0x61,0x79,0x22,0x3e,0x3c,
-    0x2f,0x75,0x73,0x65,0x3e,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x27,0x3a,0x22,0x41,0x64,
-    0x64,0x22,0x3d,0x3d,0x3d,0x6f,0x3f,0x72,0x2b,0x3d,0x27,0x3c,0x73,0x76,0x67,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x61,0x63,0x74,0x69,
-    0x6f,0x6e,0x22,0x3e,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,
-    0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x61,0x64,0x64,0x22,0x3e,0x3c,
-    0x2f,0x75,0x73,0x65,0x3e,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x27,0x3a,0x22,0x52,0x75,
-    0x6e,0x41,0x74,0x53,0x74,0x61,0x72,0x74,0x22,0x3d,0x3d,0x3d,0x6f,0x3f,0x72,0x2b,
-    0x3d,0x27,0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,
-    0x6f,0x6e,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x3c,0x75,0x73,0x65,0x20,
-    0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,
-    0x2d,0x72,0x75,0x6e,0x2d,0x61,0x74,0x2d,0x73,0x74,0x61,0x72,0x74,0x22,0x20,0x73,
-    0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x27,0x2b,0x28,0x73,0x3f,
-    0x22,0x23,0x34,0x30,0x37,0x65,0x61,0x36,0x22,0x3a,0x22,0x23,0x66,0x61,0x66,0x63,
-    0x65,0x65,0x22,0x29,0x2b,0x27,0x22,0x3e,0x3c,0x2f,0x75,0x73,0x65,0x3e,0x3c,0x2f,
-    0x73,0x76,0x67,0x3e,0x27,0x3a,0x22,0x50,0x6c,0x61,0x79,0x2d,0x50,0x61,0x75,0x73,
-    0x65,0x22,0x3d,0x3d,0x3d,0x6f,0x3f,0x72,0x2b,0x3d,0x27,0x3c,0x73,0x76,0x67,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x74,0x6f,0x6f,0x6c,
-    0x62,0x61,0x72,0x22,0x3e,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,
-    0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x70,0x6c,0x61,0x79,0x70,
-    0x61,0x75,0x73,0x65,0x22,0x3e,0x3c,0x2f,0x75,0x73,0x65,0x3e,0x3c,0x2f,0x73,0x76,
-    0x67,0x3e,0x27,0x3a,0x22,0x50,0x61,0x75,0x73,0x65,0x22,0x3d,0x3d,0x3d,0x6f,0x3f,
-    0x72,0x2b,0x3d,0x27,0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-    0x69,0x63,0x6f,0x6e,0x2d,0x74,0x6f,0x6f,0x6c,0x62,0x61,0x72,0x22,0x3e,0x3c,0x75,
-    0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,
-    0x69,0x63,0x6f,0x2d,0x70,0x61,0x75,0x73,0x65,0x22,0x3e,0x3c,0x2f,0x75,0x73,0x65,
-    0x3e,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x27,0x3a,0x22,0x53,0x74,0x6f,0x70,0x22,0x3d,
-    0x3d,0x3d,0x6f,0x3f,0x72,0x2b,0x3d,0x27,0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x74,0x6f,0x6f,0x6c,0x62,0x61,0x72,
-    0x22,0x3e,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,
-    0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x73,0x74,0x6f,0x70,0x22,0x3e,0x3c,0x2f,
-    0x75,0x73,0x65,0x3e,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x27,0x3a,0x22,0x48,0x6f,0x6d,
-    0x65,0x22,0x3d,0x3d,0x3d,0x6f,0x3f,0x72,0x2b,0x3d,0x27,0x3c,0x73,0x76,0x67,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x74,0x6f,0x6f,0x6c,
-    0x62,0x61,0x72,0x22,0x3e,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,
-    0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x69,0x63,0x6f,0x2d,0x63,0x65,0x6e,0x74,0x72,
-    0x65,0x22,0x3e,0x3c,0x2f,0x75,0x73,0x65,0x3e,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x27,
-    0x3a,0x22,0x53,0x69,0x6d,0x75,0x6c,0x61,0x74,0x65,0x22,0x3d,0x3d,0x3d,0x6f,0x26,
-    0x26,0x28,0x72,0x2b,0x3d,0x27,0x3c,0x73,0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x22,0x3e,0x3c,
-    0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,
-    0x23,0x69,0x63,0x6f,0x2d,0x73,0x70,0x69,0x72,0x61,0x6c,0x2d,0x6f,0x75,0x74,0x22,
-    0x3e,0x3c,0x2f,0x75,0x73,0x65,0x3e,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x27,0x29,0x2c,
-    0x30,0x3c,0x61,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x26,0x26,0x28,0x72,0x2b,0x3d,
-    0x61,0x29,0x2c,0x72,0x2b,0x3d,0x22,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x22,0x7d,
-    0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x67,0x65,0x6e,0x41,0x6a,0x61,0x78,
-    0x42,0x75,0x74,0x74,0x6f,0x6e,0x28,0x65,0x2c,0x74,0x2c,0x61,0x2c,0x6e,0x2c,0x6f,
-    0x2c,0x69,0x29,0x7b,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x67,0x65,0x6e,0x42,0x75,
-    0x74,0x74,0x6f,0x6e,0x28,0x27,0x63,0x61,0x6c,0x6c,0x41,0x6a,0x61,0x78,0x28,0x22,
-    0x27,0x2b,0x65,0x2b,0x27,0x22,0x2c,0x61,0x6a,0x61,0x78,0x44,0x65,0x66,0x61,0x75,
-    0x6c,0x74,0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x29,0x27,0x2c,0x74,0x2c,0x61,
-    0x2c,0x6e,0x2c,0x6f,0x2c,0x69,0x2c,0x21,0x31,0x2c,0x21,0x30,0x29,0x7d,0x66,0x75,
-    0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x67,0x65,0x6e,0x50,0x61,0x67,0x65,0x48,0x65,
-    0x61,0x64,0x65,0x72,0x28,0x29,0x7b,0x76,0x61,0x72,0x20,0x65,0x3d,0x77,0x69,0x6e,
-    0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2c,0x74,0x3d,
-    0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,
-    0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x70,0x61,0x67,0x65,0x48,0x65,0x61,
-    0x64,0x65,0x72,0x22,0x29,0x2c,0x61,0x3d,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,
-    0x61,0x73,0x73,0x3d,0x27,0x70,0x61,0x67,0x65,0x2d,0x68,0x65,0x61,0x64,0x65,0x72,
-    0x20,0x62,0x61,0x63,0x6b,0x48,0x65,0x61,0x64,0x27,0x3e,0x22,0x2c,0x61,0x3d,0x28,
-    0x61,0x3d,0x28,0x61,0x2b,0x3d,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x27,0x70,0x61,0x67,0x65,0x2d,0x68,0x65,0x61,0x64,0x65,0x72,0x2d,0x6c,
-    0x6f,0x67,0x6f,0x27,0x3e,0x22,0x29,0x2b,0x28,0x27,0x3c,0x63,0x61,0x6e,0x76,0x61,
-    0x73,0x20,0x69,0x64,0x3d,0x22,0x6c,0x6f,0x67,0x6f,0x43,0x61,0x6e,0x76,0x61,0x73,
-    0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x70,0x61,0x67,0x65,0x2d,0x6c,0x6f,
-    0x67,0x6f,0x20,0x62,0x61,0x63,0x6b,0x48,0x65,0x61,0x64,0x22,0x20,0x77,0x69,0x64,
-    0x74,0x68,0x3d,0x22,0x27,0x2b,0x6c,0x6f,0x67,0x6f,0x43,0x61,0x6e,0x76,0x61,0x73,
-    0x57,0x69,0x64,0x74,0x68,0x2b,0x27,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,
-    0x22,0x27,0x2b,0x6c,0x6f,0x67,0x6f,0x43,0x61,0x6e,0x76,0x61,0x73,0x48,0x65,0x69,
-    0x67,0x68,0x74,0x2b,0x27,0x22,0x3e,0x4f,0x6f,0x70,0x73,0x3c,0x2f,0x63,0x61,0x6e,
-    0x76,0x61,0x73,0x3e,0x27,0x29,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x29,
-    0x2b,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x70,0x61,
-    0x67,0x65,0x2d,0x68,0x65,0x61,0x64,0x65,0x72,0x2d,0x74,0x65,0x78,0x74,0x27,0x3e,
-    0x22,0x2b,0x65,0x2e,0x6e,0x61,0x6d,0x65,0x3b,0x74,0x2e,0x69,0x6e,0x6e,0x65,0x72,
-    0x48,0x54,0x4d,0x4c,0x3d,0x61,0x3d,0x61,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,
-    0x22,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x7d,0x66,0x75,0x6e,0x63,0x74,
-    0x69,0x6f,0x6e,0x20,0x67,0x65,0x6e,0x42,0x6f,0x64,0x79,0x48,0x65,0x61,0x64,0x69,
-    0x6e,0x67,0x53,0x65,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x7b,0x76,0x61,0x72,0x20,
-    0x65,0x3d,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,
-    0x6f,0x64,0x79,0x2d,0x63,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x73,0x27,0x3e,0x22,0x3b,
-    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x65,0x2b,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,
-    0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x70,0x61,0x72,0x74,0x2d,
-    0x62,0x75,0x74,0x74,0x6f,0x6e,0x73,0x20,0x62,0x61,0x63,0x6b,0x47,0x72,0x61,0x64,
-    0x31,0x27,0x3e,0x22,0x2b,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x73,0x27,
-    0x3e,0x22,0x2b,0x28,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-    0x27,0x62,0x6f,0x64,0x79,0x2d,0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x73,0x2d,0x69,
-    0x74,0x65,0x6d,0x27,0x3e,0x22,0x2b,0x67,0x65,0x6e,0x41,0x6a,0x61,0x78,0x42,0x75,
-    0x74,0x74,0x6f,0x6e,0x28,0x22,0x2f,0x65,0x78,0x65,0x63,0x2f,0x67,0x32,0x38,0x22,
-    0x2c,0x22,0x22,0x2c,0x22,0x22,0x2c,0x22,0x48,0x6f,0x6d,0x65,0x20,0x74,0x68,0x65,
-    0x20,0x72,0x6f,0x62,0x6f,0x74,0x22,0x2c,0x22,0x48,0x6f,0x6d,0x65,0x22,0x2c,0x22,
-    0x62,0x6f,0x64,0x79,0x2d,0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x73,0x2d,0x62,0x75,
-    0x74,0x74,0x6f,0x6e,0x22,0x29,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x29,
-    0x2b,0x28,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,
-    0x6f,0x64,0x79,0x2d,0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x73,0x2d,0x69,0x74,0x65,
-    0x6d,0x27,0x3e,0x22,0x2b,0x67,0x65,0x6e,0x41,0x6a,0x61,0x78,0x42,0x75,0x74,0x74,
-    0x6f,0x6e,0x28,0x22,0x2f,0x65,0x78,0x65,0x63,0x2f,0x70,0x6c,0x61,0x79,0x70,0x61,
-    0x75,0x73,0x65,0x22,0x2c,0x22,0x22,0x2c,0x22,0x22,0x2c,0x22,0x54,0x6f,0x67,0x67,
-    0x6c,0x65,0x20,0x70,0x6c,0x61,0x79,0x2f,0x70,0x61,0x75,0x73,0x65,0x22,0x2c,0x22,
-    0x50,0x6c,0x61,0x79,0x2d,0x50,0x61,0x75,0x73,0x65,0x22,0x2c,0x22,0x62,0x6f,0x64,
-    0x79,0x2d,0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x73,0x2d,0x62,0x75,0x74,0x74,0x6f,
-    0x6e,0x22,0x29,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x29,0x2b,0x28,0x22,
-    0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,
-    0x2d,0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x73,0x2d,0x69,0x74,0x65,0x6d,0x27,0x3e,
-    0x22,0x2b,0x67,0x65,0x6e,0x41,0x6a,0x61,0x78,0x42,0x75,0x74,0x74,0x6f,0x6e,0x28,
-    0x22,0x2f,0x65,0x78,0x65,0x63,0x2f,0x73,0x74,0x6f,0x70,0x22,0x2c,0x22,0x22,0x2c,
-    0x22,0x22,0x2c,0x22,0x53,0x74,0x6f,0x70,0x22,0x2c,0x22,0x53,0x74,0x6f,0x70,0x22,
-    0x2c,0x22,0x62,0x6f,0x64,0x79,0x2d,0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x73,0x2d,
-    0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x29,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,
-    0x22,0x29,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x2b,0x22,0x3c,0x2f,0x64,
-    0x69,0x76,0x3e,0x22,0x2b,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x73,0x65,0x70,0x27,0x3e,0x22,0x2b,0x22,0x3c,
-    0x2f,0x64,0x69,0x76,0x3e,0x22,0x2b,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x70,0x61,0x72,0x74,0x2d,0x73,0x74,
-    0x61,0x74,0x75,0x73,0x20,0x62,0x61,0x63,0x6b,0x47,0x72,0x61,0x64,0x31,0x27,0x3e,
-    0x22,0x2b,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,
-    0x6f,0x64,0x79,0x2d,0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x73,0x27,0x3e,0x22,0x2b,
-    0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,
-    0x79,0x2d,0x73,0x74,0x61,0x74,0x75,0x73,0x2d,0x62,0x6f,0x78,0x27,0x3e,0x22,0x2b,
-    0x22,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x27,0x73,0x74,0x61,0x74,0x75,0x73,
-    0x2d,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x65,0x64,0x27,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x27,0x6e,0x6f,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x27,0x3e,0x3c,0x73,
-    0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x69,0x63,0x6f,0x6e,0x2d,0x74,
-    0x6f,0x6f,0x6c,0x62,0x61,0x72,0x27,0x3e,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,
-    0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,0x27,0x23,0x69,0x63,0x6f,0x2d,0x62,0x72,
-    0x6f,0x6b,0x65,0x6e,0x27,0x3e,0x3c,0x2f,0x75,0x73,0x65,0x3e,0x3c,0x2f,0x73,0x76,
-    0x67,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,
-    0x3e,0x22,0x2b,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,
-    0x62,0x6f,0x64,0x79,0x2d,0x73,0x74,0x61,0x74,0x75,0x73,0x2d,0x62,0x6f,0x78,0x27,
-    0x3e,0x22,0x2b,0x22,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x27,0x73,0x74,0x61,
-    0x74,0x75,0x73,0x2d,0x70,0x61,0x75,0x73,0x65,0x64,0x27,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x27,0x6e,0x6f,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x27,0x3e,0x3c,0x73,
-    0x76,0x67,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x69,0x63,0x6f,0x6e,0x2d,0x74,
-    0x6f,0x6f,0x6c,0x62,0x61,0x72,0x20,0x69,0x63,0x6f,0x6e,0x2d,0x72,0x65,0x64,0x27,
-    0x3e,0x3c,0x75,0x73,0x65,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,
-    0x3d,0x27,0x23,0x69,0x63,0x6f,0x2d,0x70,0x61,0x75,0x73,0x65,0x27,0x3e,0x3c,0x2f,
-    0x75,0x73,0x65,0x3e,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,
-    0x22,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x2b,0x22,0x3c,0x2f,0x64,0x69,
-    0x76,0x3e,0x22,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x2b,0x22,0x3c,0x2f,
-    0x64,0x69,0x76,0x3e,0x22,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x67,
-    0x65,0x6e,0x50,0x61,0x74,0x74,0x65,0x72,0x6e,0x73,0x42,0x6f,0x64,0x79,0x28,0x29,
-    0x7b,0x76,0x61,0x72,0x20,0x65,0x3d,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x67,0x72,0x6f,0x75,0x70,0x20,0x62,
-    0x61,0x63,0x6b,0x47,0x72,0x61,0x64,0x32,0x27,0x3e,0x22,0x3b,0x72,0x65,0x74,0x75,
-    0x72,0x6e,0x28,0x65,0x2b,0x3d,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x67,0x72,0x6f,0x75,0x70,0x2d,0x68,0x65,
-    0x61,0x64,0x65,0x72,0x27,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x50,0x61,0x74,0x74,
-    0x65,0x72,0x6e,0x73,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x22,0x29,0x2b,0x22,0x3c,
-    0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,
-    0x67,0x72,0x6f,0x75,0x70,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x27,0x3e,0x22,
-    0x2b,0x27,0x3c,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x20,0x69,0x64,0x3d,0x22,
-    0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x2d,0x62,0x61,0x72,0x2d,0x66,0x69,0x6c,
-    0x65,0x2d,0x6d,0x61,0x6e,0x61,0x67,0x65,0x72,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x22,0x62,0x6f,0x64,0x79,0x2d,0x67,0x72,0x6f,0x75,0x70,0x2d,0x62,0x75,0x74,
-    0x74,0x6f,0x6e,0x20,0x68,0x69,0x64,0x64,0x65,0x6e,0x22,0x20,0x6d,0x61,0x78,0x3d,
-    0x31,0x30,0x30,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x30,0x3e,0x3c,0x2f,0x70,0x72,
-    0x6f,0x67,0x72,0x65,0x73,0x73,0x3e,0x27,0x2b,0x67,0x65,0x6e,0x42,0x75,0x74,0x74,
-    0x6f,0x6e,0x28,0x27,0x75,0x73,0x65,0x72,0x41,0x63,0x74,0x69,0x6f,0x6e,0x28,0x22,
-    0x66,0x69,0x6c,0x65,0x22,0x2c,0x22,0x61,0x64,0x64,0x22,0x2c,0x22,0x22,0x29,0x27,
-    0x2c,0x22,0x22,0x2c,0x22,0x22,0x2c,0x22,0x4e,0x65,0x77,0x20,0x70,0x61,0x74,0x74,
-    0x65,0x72,0x6e,0x22,0x2c,0x22,0x41,0x64,0x64,0x22,0x2c,0x22,0x62,0x6f,0x64,0x79,
-    0x2d,0x67,0x72,0x6f,0x75,0x70,0x2d,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x2c,0x21,
-    0x31,0x2c,0x21,0x30,0x29,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x2b,0x22,
-    0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x2b,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,
-    0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x6c,0x69,0x73,0x74,0x20,0x64,
-    0x72,0x6f,0x70,0x2d,0x7a,0x6f,0x6e,0x65,0x27,0x20,0x69,0x64,0x3d,0x27,0x70,0x61,
-    0x74,0x74,0x65,0x72,0x6e,0x73,0x4c,0x69,0x73,0x74,0x27,0x3e,0x22,0x2b,0x22,0x3c,
-    0x2f,0x64,0x69,0x76,0x3e,0x22,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x7d,
-    0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x67,0x65,0x6e,0x48,0x6f,0x6d,0x65,
-    0x50,0x61,0x67,0x65,0x42,0x6f,0x64,0x79,0x28,0x29,0x7b,0x76,0x61,0x72,0x20,0x65,
-    0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,
-    0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x70,0x61,0x67,0x65,0x42,0x6f,
-    0x64,0x79,0x48,0x65,0x61,0x64,0x22,0x29,0x2c,0x74,0x3d,0x67,0x65,0x6e,0x42,0x6f,
-    0x64,0x79,0x48,0x65,0x61,0x64,0x69,0x6e,0x67,0x53,0x65,0x63,0x74,0x69,0x6f,0x6e,
-    0x28,0x29,0x2c,0x65,0x3d,0x28,0x65,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,
-    0x4c,0x3d,0x74,0x2c,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,
-    0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x70,0x61,0x67,
-    0x65,0x42,0x6f,0x64,0x79,0x46,0x6f,0x72,0x6d,0x22,0x29,0x29,0x2c,0x74,0x3d,0x67,
-    0x65,0x6e,0x50,0x61,0x74,0x74,0x65,0x72,0x6e,0x73,0x42,0x6f,0x64,0x79,0x28,0x29,
-    0x3b,0x65,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x74,0x7d,0x66,
-    0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x67,0x65,0x6e,0x4f,0x70,0x74,0x69,0x6f,
-    0x6e,0x53,0x74,0x72,0x28,0x65,0x2c,0x74,0x2c,0x61,0x29,0x7b,0x72,0x65,0x74,0x75,
-    0x72,0x6e,0x27,0x3c,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x20,0x76,0x61,0x6c,0x75,0x65,
-    0x3d,0x22,0x27,0x2b,0x65,0x2b,0x27,0x22,0x20,0x27,0x2b,0x28,0x61,0x3d,0x3d,0x3d,
-    0x65,0x3f,0x27,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x3d,0x22,0x73,0x65,0x6c,
-    0x65,0x63,0x74,0x65,0x64,0x22,0x27,0x3a,0x22,0x22,0x29,0x2b,0x22,0x3e,0x22,0x2b,
-    0x74,0x2b,0x22,0x3c,0x2f,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x3e,0x22,0x7d,0x66,0x75,
-    0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x67,0x65,0x6e,0x45,0x64,0x69,0x74,0x50,0x61,
-    0x67,0x65,0x41,0x63,0x74,0x69,0x6f,0x6e,0x73,0x28,0x65,0x2c,0x74,0x2c,0x61,0x29,
-    0x7b,0x6c,0x65,0x74,0x20,0x6e,0x3d,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x67,0x72,0x6f,0x75,0x70,0x27,0x3e,
-    0x22,0x3b,0x69,0x66,0x28,0x6e,0x2b,0x3d,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,
-    0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x67,0x72,0x6f,0x75,0x70,0x2d,
-    0x68,0x65,0x61,0x64,0x65,0x72,0x27,0x3e,0x22,0x2c,0x61,0x29,0x7b,0x6e,0x3d,0x6e,
-    0x2b,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,
-    0x64,0x79,0x2d,0x67,0x72,0x6f,0x75,0x70,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x20,
-    0x73,0x65,0x6c,0x65,0x63,0x74,0x2d,0x73,0x74,0x79,0x6c,0x65,0x27,0x3e,0x22,0x2b,
-    0x27,0x3c,0x73,0x65,0x6c,0x65,0x63,0x74,0x20,0x69,0x64,0x3d,0x22,0x66,0x69,0x6c,
-    0x65,0x54,0x79,0x70,0x65,0x53,0x65,0x6c,0x65,0x63,0x74,0x22,0x3e,0x27,0x3b,0x76,
-    0x61,0x72,0x20,0x6f,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,
-    0x61,0x74,0x65,0x2e,0x66,0x69,0x6c,0x65,0x54,0x79,0x70,0x65,0x73,0x3b,0x66,0x6f,
-    0x72,0x28,0x6c,0x65,0x74,0x20,0x65,0x3d,0x30,0x3b,0x65,0x3c,0x6f,0x2e,0x6c,0x65,
-    0x6e,0x67,0x74,0x68,0x3b,0x65,0x2b,0x2b,0x29,0x6e,0x2b,0x3d,0x67,0x65,0x6e,0x4f,
-    0x70,0x74,0x69,0x6f,0x6e,0x53,0x74,0x72,0x28,0x6f,0x5b,0x65,0x5d,0x5b,0x30,0x5d,
-    0x2c,0x6f,0x5b,0x65,0x5d,0x5b,0x31,0x5d,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,
-    0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x46,0x69,0x6c,0x65,0x54,
-    0x79,0x70,0x65,0x29,0x3b,0x6e,0x3d,0x6e,0x2b,0x22,0x3c,0x2f,0x73,0x65,0x6c,0x65,
-    0x63,0x74,0x3e,0x22,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x7d,0x65,0x6c,
-    0x73,0x65,0x20,0x6e,0x2b,0x3d,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x67,0x72,0x6f,0x75,0x70,0x2d,0x69,0x6e,
-    0x66,0x6f,0x27,0x3e,0x22,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,
-    0x74,0x61,0x74,0x65,0x2e,0x66,0x69,0x6c,0x65,0x54,0x79,0x70,0x65,0x4c,0x6f,0x6f,
-    0x6b,0x75,0x70,0x2e,0x68,0x61,0x73,0x4f,0x77,0x6e,0x50,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,
-    0x65,0x2e,0x63,0x75,0x72,0x46,0x69,0x6c,0x65,0x54,0x79,0x70,0x65,0x29,0x3f,0x6e,
-    0x2b,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,
-    0x2e,0x66,0x69,0x6c,0x65,0x54,0x79,0x70,0x65,0x4c,0x6f,0x6f,0x6b,0x75,0x70,0x5b,
-    0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,
-    0x75,0x72,0x46,0x69,0x6c,0x65,0x54,0x79,0x70,0x65,0x5d,0x3a,0x6e,0x2b,0x3d,0x77,
-    0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,
-    0x72,0x46,0x69,0x6c,0x65,0x54,0x79,0x70,0x65,0x2c,0x6e,0x3d,0x28,0x6e,0x2b,0x3d,
-    0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x67,0x72,0x6f,0x75,0x70,0x2d,0x61,0x63,
-    0x74,0x69,0x6f,0x6e,0x73,0x27,0x3e,0x22,0x29,0x2b,0x67,0x65,0x6e,0x42,0x75,0x74,
-    0x74,0x6f,0x6e,0x28,0x27,0x75,0x73,0x65,0x72,0x41,0x63,0x74,0x69,0x6f,0x6e,0x28,
-    0x22,0x27,0x2b,0x65,0x2b,0x27,0x22,0x2c,0x22,0x64,0x65,0x6c,0x65,0x74,0x65,0x22,
-    0x2c,0x22,0x7e,0x6b,0x65,0x79,0x7e,0x22,0x29,0x27,0x2c,0x74,0x2c,0x22,0x44,0x65,
-    0x6c,0x65,0x74,0x65,0x22,0x2c,0x22,0x44,0x65,0x6c,0x65,0x74,0x65,0x20,0x70,0x61,
-    0x74,0x74,0x65,0x72,0x6e,0x22,0x2c,0x22,0x44,0x65,0x6c,0x65,0x74,0x65,0x22,0x2c,
-    0x22,0x62,0x6f,0x64,0x79,0x2d,0x67,0x72,0x6f,0x75,0x70,0x2d,0x62,0x75,0x74,0x74,
-    0x6f,0x6e,0x22,0x2c,0x21,0x31,0x2c,0x21,0x61,0x29,0x2b,0x22,0x3c,0x2f,0x64,0x69,
-    0x76,0x3e,0x22,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6e,0x3d,0x28,0x6e,0x3d,
-    0x28,0x6e,0x3d,0x28,0x6e,0x3d,0x28,0x6e,0x2b,0x3d,0x22,0x3c,0x64,0x69,0x76,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x67,0x72,0x6f,0x75,
-    0x70,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x27,0x3e,0x22,0x29,0x2b,0x67,0x65,
-    0x6e,0x42,0x75,0x74,0x74,0x6f,0x6e,0x28,0x27,0x75,0x73,0x65,0x72,0x41,0x63,0x74,
-    0x69,0x6f,0x6e,0x28,0x22,0x27,0x2b,0x65,0x2b,0x27,0x22,0x2c,0x22,0x73,0x61,0x76,
-    0x65,0x22,0x2c,0x22,0x7e,0x6b,0x65,0x79,0x7e,0x22,0x29,0x27,0x2c,0x74,0x2c,0x22,
-    0x53,0x61,0x76,0x65,0x22,0x2c,0x22,0x53,0x61,0x76,0x65,0x20,0x70,0x61,0x74,0x74,
-    0x65,0x72,0x6e,0x22,0x2c,0x22,0x53,0x61,0x76,0x65,0x22,0x2c,0x22,0x62,0x6f,0x64,
-    0x79,0x2d,0x67,0x72,0x6f,0x75,0x70,0x2d,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x2c,
-    0x21,0x31,0x2c,0x21,0x30,0x29,0x29,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,
-    0x2b,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,
-    0x64,0x79,0x2d,0x67,0x72,0x6f,0x75,0x70,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,
-    0x27,0x3e,0x22,0x29,0x2b,0x67,0x65,0x6e,0x42,0x75,0x74,0x74,0x6f,0x6e,0x28,0x27,
-    0x75,0x73,0x65,0x72,0x41,0x63,0x74,0x69,0x6f,0x6e,0x28,0x22,0x27,0x2b,0x65,0x2b,
-    0x27,0x22,0x2c,0x22,0x63,0x61,0x6e,0x63,0x65,0x6c,0x22,0x2c,0x22,0x7e,0x6b,0x65,
-    0x79,0x7e,0x22,0x29,0x27,0x2c,0x74,0x2c,0x22,0x43,0x61,0x6e,0x63,0x65,0x6c,0x22,
-    0x2c,0x22,0x43,0x61,0x6e,0x63,0x65,0x6c,0x22,0x2c,0x22,0x43,0x61,0x6e,0x63,0x65,
-    0x6c,0x22,0x2c,0x22,0x62,0x6f,0x64,0x79,0x2d,0x67,0x72,0x6f,0x75,0x70,0x2d,0x62,
-    0x75,0x74,0x74,0x6f,0x6e,0x22,0x2c,0x21,0x31,0x2c,0x21,0x30,0x29,0x29,0x2b,0x22,
-    0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,
-    0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x65,0x74,0x46,0x69,0x6c,
-    0x65,0x54,0x79,0x70,0x65,0x28,0x29,0x7b,0x76,0x61,0x72,0x20,0x65,0x3d,0x64,0x6f,
-    0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,
-    0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x66,0x69,0x6c,0x65,0x54,0x79,0x70,0x65,0x53,
-    0x65,0x6c,0x65,0x63,0x74,0x22,0x29,0x3b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,
-    0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x46,0x69,0x6c,0x65,0x54,0x79,
-    0x70,0x65,0x3d,0x65,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,0x77,0x69,0x6e,0x64,0x6f,
-    0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x6e,0x65,0x77,0x46,0x69,0x6c,
-    0x65,0x54,0x79,0x70,0x65,0x3d,0x65,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,0x63,0x6f,
-    0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,
-    0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x46,0x69,0x6c,0x65,
-    0x54,0x79,0x70,0x65,0x29,0x2c,0x67,0x65,0x6e,0x46,0x69,0x6c,0x65,0x45,0x64,0x69,
-    0x74,0x46,0x6f,0x72,0x6d,0x28,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
-    0x20,0x67,0x65,0x6e,0x46,0x69,0x6c,0x65,0x45,0x64,0x69,0x74,0x46,0x6f,0x72,0x6d,
-    0x28,0x29,0x7b,0x76,0x61,0x72,0x20,0x65,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,
-    0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x49,0x74,0x65,0x6d,0x2c,
-    0x65,0x3d,0x65,0x2e,0x73,0x75,0x62,0x73,0x74,0x72,0x28,0x30,0x2c,0x65,0x2e,0x6c,
-    0x61,0x73,0x74,0x49,0x6e,0x64,0x65,0x78,0x4f,0x66,0x28,0x22,0x2e,0x22,0x29,0x29,
-    0x2c,0x74,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,
-    0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x70,0x61,0x67,0x65,
-    0x42,0x6f,0x64,0x79,0x46,0x6f,0x72,0x6d,0x22,0x29,0x3b,0x6c,0x65,0x74,0x20,0x61,
-    0x3d,0x22,0x22,0x3b,0x69,0x66,0x28,0x61,0x3d,0x28,0x61,0x3d,0x61,0x2b,0x22,0x3c,
-    0x66,0x6f,0x72,0x6d,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,
-    0x2d,0x66,0x6f,0x72,0x6d,0x27,0x3e,0x22,0x2b,0x22,0x3c,0x66,0x69,0x65,0x6c,0x64,
-    0x73,0x65,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,
-    0x66,0x69,0x65,0x6c,0x64,0x73,0x65,0x74,0x27,0x3e,0x22,0x29,0x2b,0x22,0x3c,0x64,
-    0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x66,
-    0x6f,0x72,0x6d,0x2d,0x6c,0x69,0x6e,0x65,0x27,0x3e,0x22,0x2b,0x22,0x3c,0x64,0x69,
-    0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,
-    0x72,0x6d,0x2d,0x6c,0x61,0x62,0x65,0x6c,0x27,0x3e,0x4e,0x61,0x6d,0x65,0x3c,0x2f,
-    0x64,0x69,0x76,0x3e,0x22,0x2c,0x22,0x70,0x61,0x74,0x45,0x64,0x69,0x74,0x22,0x3d,
-    0x3d,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,
-    0x2e,0x63,0x75,0x72,0x50,0x61,0x67,0x65,0x2e,0x74,0x72,0x69,0x6d,0x28,0x29,0x3f,
-    0x61,0x2b,0x3d,0x22,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x27,0x66,0x69,0x6c,
-    0x65,0x4e,0x61,0x6d,0x65,0x4e,0x6f,0x45,0x78,0x74,0x65,0x6e,0x73,0x69,0x6f,0x6e,
-    0x27,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,
-    0x72,0x6d,0x2d,0x66,0x69,0x65,0x6c,0x64,0x27,0x3e,0x22,0x2b,0x65,0x2b,0x22,0x3c,
-    0x2f,0x64,0x69,0x76,0x3e,0x22,0x3a,0x61,0x2b,0x3d,0x22,0x3c,0x69,0x6e,0x70,0x75,
-    0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,
-    0x3d,0x27,0x66,0x69,0x6c,0x65,0x4e,0x61,0x6d,0x65,0x4e,0x6f,0x45,0x78,0x74,0x65,
-    0x6e,0x73,0x69,0x6f,0x6e,0x27,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,
-    0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x66,0x69,0x65,0x6c,0x64,0x27,0x3e,0x22,
-    0x2b,0x65,0x2b,0x22,0x3c,0x2f,0x69,0x6e,0x70,0x75,0x74,0x3e,0x22,0x2c,0x61,0x2b,
-    0x3d,0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x2c,0x22,0x70,0x61,0x72,0x61,0x6d,
-    0x22,0x3d,0x3d,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,
-    0x74,0x65,0x2e,0x63,0x75,0x72,0x46,0x69,0x6c,0x65,0x54,0x79,0x70,0x65,0x29,0x7b,
-    0x6c,0x65,0x74,0x20,0x65,0x3d,0x7b,0x73,0x65,0x74,0x75,0x70,0x3a,0x22,0x22,0x2c,
-    0x6c,0x6f,0x6f,0x70,0x3a,0x22,0x22,0x7d,0x3b,0x69,0x66,0x28,0x30,0x3c,0x77,0x69,
-    0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,
-    0x46,0x69,0x6c,0x65,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x4a,0x73,0x6f,0x6e,0x2e,
-    0x6c,0x65,0x6e,0x67,0x74,0x68,0x29,0x74,0x72,0x79,0x7b,0x28,0x65,0x3d,0x4a,0x53,
-    0x4f,0x4e,0x2e,0x70,0x61,0x72,0x73,0x65,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,
-    0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x46,0x69,0x6c,0x65,0x43,
-    0x6f,0x6e,0x74,0x65,0x6e,0x74,0x4a,0x73,0x6f,0x6e,0x29,0x29,0x2e,0x73,0x65,0x74,
-    0x75,0x70,0x3d,0x65,0x2e,0x73,0x65,0x74,0x75,0x70,0x2e,0x72,0x65,0x70,0x6c,0x61,
-    0x63,0x65,0x28,0x2f,0x3b,0x2f,0x67,0x2c,0x22,0x5c,0x6e,0x22,0x29,0x2c,0x65,0x2e,
-    0x6c,0x6f,0x6f,0x70,0x3d,0x65,0x2e,0x6c,0x6f,0x6f,0x70,0x2e,0x72,0x65,0x70,0x6c,
-    0x61,0x63,0x65,0x28,0x2f,0x3b,0x2f,0x67,0x2c,0x22,0x5c,0x6e,0x22,0x29,0x7d,0x63,
-    0x61,0x74,0x63,0x68,0x28,0x65,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,
-    0x65,0x72,0x72,0x6f,0x72,0x28,0x22,0x46,0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,
-    0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x4a,0x53,0x4f,0x4e,0x20,0x73,0x65,0x74,0x74,
-    0x69,0x6e,0x67,0x73,0x20,0x22,0x2b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,
-    0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x46,0x69,0x6c,0x65,0x43,0x6f,0x6e,
-    0x74,0x65,0x6e,0x74,0x4a,0x73,0x6f,0x6e,0x29,0x2c,0x63,0x6f,0x6e,0x73,0x6f,0x6c,
-    0x65,0x2e,0x65,0x72,0x72,0x6f,0x72,0x28,0x65,0x29,0x7d,0x65,0x6c,0x73,0x65,0x20,
-    0x65,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,
-    0x2e,0x70,0x61,0x72,0x61,0x6d,0x4e,0x65,0x77,0x4a,0x73,0x6f,0x6e,0x3b,0x61,0x3d,
-    0x28,0x61,0x3d,0x28,0x61,0x3d,0x28,0x61,0x3d,0x61,0x2b,0x22,0x3c,0x64,0x69,0x76,
-    0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,
-    0x6d,0x2d,0x6c,0x69,0x6e,0x65,0x27,0x3e,0x22,0x2b,0x22,0x3c,0x64,0x69,0x76,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,
-    0x2d,0x6c,0x61,0x62,0x65,0x6c,0x27,0x3e,0x53,0x65,0x74,0x75,0x70,0x20,0x65,0x78,
-    0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x73,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,
-    0x29,0x2b,0x28,0x22,0x3c,0x74,0x65,0x78,0x74,0x61,0x72,0x65,0x61,0x20,0x69,0x64,
-    0x3d,0x27,0x70,0x61,0x74,0x73,0x65,0x74,0x75,0x70,0x27,0x20,0x6f,0x6e,0x69,0x6e,
-    0x70,0x75,0x74,0x3d,0x27,0x70,0x61,0x74,0x53,0x65,0x74,0x75,0x70,0x43,0x68,0x61,
-    0x6e,0x67,0x65,0x28,0x29,0x3b,0x27,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,
-    0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x66,0x69,0x65,0x6c,0x64,0x27,0x20,
-    0x63,0x6f,0x6c,0x73,0x3d,0x27,0x35,0x30,0x27,0x20,0x72,0x6f,0x77,0x73,0x3d,0x27,
-    0x33,0x27,0x3e,0x22,0x2b,0x65,0x2e,0x73,0x65,0x74,0x75,0x70,0x2b,0x22,0x3c,0x2f,
-    0x74,0x65,0x78,0x74,0x61,0x72,0x65,0x61,0x3e,0x22,0x29,0x2b,0x22,0x3c,0x2f,0x64,
-    0x69,0x76,0x3e,0x22,0x29,0x2b,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x6c,0x69,0x6e,
-    0x65,0x27,0x3e,0x22,0x2b,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x6c,0x61,0x62,0x65,
-    0x6c,0x27,0x3e,0x4c,0x6f,0x6f,0x70,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,
-    0x6f,0x6e,0x73,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x29,0x2b,0x28,0x22,0x3c,0x74,
-    0x65,0x78,0x74,0x61,0x72,0x65,0x61,0x20,0x69,0x64,0x3d,0x27,0x70,0x61,0x74,0x6c,
-    0x6f,0x6f,0x70,0x27,0x20,0x6f,0x6e,0x69,0x6e,0x70,0x75,0x74,0x3d,0x27,0x70,0x61,
-    0x74,0x4c,0x6f,0x6f,0x70,0x43,0x68,0x61,0x6e,0x67,0x65,0x28,0x29,0x3b,0x27,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,
-    0x2d,0x66,0x69,0x65,0x6c,0x64,0x27,0x20,0x63,0x6f,0x6c,0x73,0x3d,0x27,0x35,0x30,
-    0x27,0x20,0x72,0x6f,0x77,0x73,0x3d,0x27,0x31,0x30,0x27,0x3e,0x22,0x2b,0x65,0x2e,
-    0x6c,0x6f,0x6f,0x70,0x2b,0x22,0x3c,0x2f,0x74,0x65,0x78,0x74,0x61,0x72,0x65,0x61,
-    0x3e,0x22,0x29,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x7d,0x65,0x6c,0x73,
-    0x65,0x20,0x69,0x66,0x28,0x22,0x73,0x65,0x71,0x22,0x3d,0x3d,0x3d,0x77,0x69,0x6e,
-    0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x46,
-    0x69,0x6c,0x65,0x54,0x79,0x70,0x65,0x29,0x61,0x3d,0x28,0x61,0x3d,0x28,0x61,0x3d,
-    0x28,0x61,0x3d,0x28,0x61,0x3d,0x28,0x61,0x2b,0x3d,0x22,0x3c,0x64,0x69,0x76,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,
-    0x2d,0x6c,0x69,0x6e,0x65,0x27,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x6c,0x61,0x62,
-    0x65,0x6c,0x27,0x3e,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x73,0x3c,0x2f,0x64,0x69,
-    0x76,0x3e,0x22,0x29,0x2b,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x32,0x2d,0x63,0x6f,
-    0x6c,0x27,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,
-    0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x63,0x6f,0x6c,0x27,0x3e,0x22,0x29,
-    0x2b,0x22,0x3c,0x74,0x65,0x78,0x74,0x61,0x72,0x65,0x61,0x20,0x69,0x64,0x3d,0x27,
-    0x74,0x65,0x78,0x74,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x73,0x27,0x20,0x6f,0x6e,
-    0x69,0x6e,0x70,0x75,0x74,0x3d,0x27,0x66,0x69,0x6c,0x65,0x43,0x6f,0x6e,0x74,0x65,
-    0x6e,0x74,0x43,0x68,0x61,0x6e,0x67,0x65,0x28,0x29,0x27,0x20,0x6f,0x6e,0x64,0x72,
-    0x6f,0x70,0x3d,0x27,0x73,0x65,0x71,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x44,0x72,
-    0x6f,0x70,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x27,0x20,0x6f,0x6e,0x64,0x72,0x61,
-    0x67,0x6f,0x76,0x65,0x72,0x3d,0x27,0x73,0x65,0x71,0x43,0x6f,0x6e,0x74,0x65,0x6e,
-    0x74,0x41,0x6c,0x6c,0x6f,0x77,0x44,0x72,0x6f,0x70,0x28,0x65,0x76,0x65,0x6e,0x74,
-    0x29,0x27,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x66,
-    0x6f,0x72,0x6d,0x2d,0x66,0x69,0x65,0x6c,0x64,0x20,0x62,0x6f,0x64,0x79,0x2d,0x66,
-    0x6f,0x72,0x6d,0x2d,0x74,0x65,0x78,0x74,0x61,0x72,0x65,0x61,0x27,0x20,0x63,0x6f,
-    0x6c,0x73,0x3d,0x27,0x35,0x30,0x27,0x20,0x72,0x6f,0x77,0x73,0x3d,0x27,0x31,0x30,
-    0x27,0x3e,0x22,0x2b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,
-    0x74,0x65,0x2e,0x63,0x75,0x72,0x46,0x69,0x6c,0x65,0x43,0x6f,0x6e,0x74,0x65,0x6e,
-    0x74,0x4a,0x73,0x6f,0x6e,0x2b,0x22,0x3c,0x2f,0x74,0x65,0x78,0x74,0x61,0x72,0x65,
-    0x61,0x3e,0x22,0x29,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,
-    0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,
-    0x6d,0x2d,0x63,0x6f,0x6c,0x73,0x65,0x70,0x27,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,
-    0x22,0x29,0x2b,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,
-    0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x63,0x6f,0x6c,0x20,0x62,0x6f,
-    0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x66,0x69,0x65,0x6c,0x64,0x27,0x20,0x69,
-    0x64,0x3d,0x27,0x70,0x61,0x74,0x74,0x65,0x72,0x6e,0x73,0x4c,0x69,0x73,0x74,0x27,
-    0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x29,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,
-    0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x3b,0x65,0x6c,0x73,0x65,0x7b,0x61,0x3d,
-    0x61,0x2b,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,
-    0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x6c,0x69,0x6e,0x65,0x27,0x3e,0x22,
-    0x2b,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,
-    0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x6c,0x61,0x62,0x65,0x6c,0x27,0x3e,0x43,
-    0x6f,0x6e,0x74,0x65,0x6e,0x74,0x73,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x3b,0x6c,
-    0x65,0x74,0x20,0x65,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,
-    0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x46,0x69,0x6c,0x65,0x43,0x6f,0x6e,0x74,0x65,
-    0x6e,0x74,0x4a,0x73,0x6f,0x6e,0x3b,0x30,0x3d,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,
-    0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x46,0x69,0x6c,0x65,
-    0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x4a,0x73,0x6f,0x6e,0x2e,0x6c,0x65,0x6e,0x67,
-    0x74,0x68,0x26,0x26,0x22,0x70,0x61,0x74,0x41,0x64,0x64,0x22,0x3d,0x3d,0x3d,0x77,
-    0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,
-    0x72,0x50,0x61,0x67,0x65,0x2e,0x74,0x72,0x69,0x6d,0x28,0x29,0x26,0x26,0x22,0x74,
-    0x68,0x72,0x22,0x3d,0x3d,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,
-    0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x46,0x69,0x6c,0x65,0x54,0x79,0x70,0x65,
-    0x26,0x26,0x28,0x65,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,
-    0x61,0x74,0x65,0x2e,0x74,0x68,0x72,0x4e,0x65,0x77,0x43,0x6f,0x6e,0x74,0x65,0x6e,
-    0x74,0x29,0x2c,0x61,0x3d,0x61,0x2b,0x28,0x22,0x3c,0x74,0x65,0x78,0x74,0x61,0x72,
-    0x65,0x61,0x20,0x69,0x64,0x3d,0x27,0x74,0x65,0x78,0x74,0x63,0x6f,0x6e,0x74,0x65,
-    0x6e,0x74,0x73,0x27,0x20,0x6f,0x6e,0x69,0x6e,0x70,0x75,0x74,0x3d,0x27,0x66,0x69,
-    0x6c,0x65,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x43,0x68,0x61,0x6e,0x67,0x65,0x28,
-    0x29,0x27,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x66,
-    0x6f,0x72,0x6d,0x2d,0x66,0x69,0x65,0x6c,0x64,0x27,0x20,0x63,0x6f,0x6c,0x73,0x3d,
-    0x27,0x35,0x30,0x27,0x20,0x72,0x6f,0x77,0x73,0x3d,0x27,0x31,0x30,0x27,0x3e,0x22,
-    0x2b,0x65,0x2b,0x22,0x3c,0x2f,0x74,0x65,0x78,0x74,0x61,0x72,0x65,0x61,0x3e,0x22,
-    0x29,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x7d,0x22,0x73,0x65,0x71,0x22,
-    0x21,0x3d,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,
-    0x65,0x2e,0x63,0x75,0x72,0x46,0x69,0x6c,0x65,0x54,0x79,0x70,0x65,0x26,0x26,0x28,
-    0x61,0x3d,0x28,0x61,0x3d,0x28,0x61,0x3d,0x28,0x61,0x3d,0x28,0x61,0x3d,0x28,0x61,
-    0x3d,0x28,0x61,0x3d,0x28,0x61,0x3d,0x28,0x61,0x3d,0x28,0x61,0x2b,0x3d,0x22,0x3c,
-    0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,
-    0x66,0x6f,0x72,0x6d,0x2d,0x6c,0x69,0x6e,0x65,0x27,0x3e,0x22,0x29,0x2b,0x22,0x3c,
-    0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,
-    0x66,0x6f,0x72,0x6d,0x2d,0x6c,0x61,0x62,0x65,0x6c,0x27,0x3e,0x3c,0x64,0x69,0x76,
-    0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,
-    0x6d,0x2d,0x6c,0x61,0x62,0x65,0x6c,0x2d,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,
-    0x72,0x27,0x3e,0x56,0x61,0x6c,0x69,0x64,0x69,0x74,0x79,0x20,0x63,0x68,0x65,0x63,
-    0x6b,0x22,0x29,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,
-    0x2d,0x6c,0x61,0x62,0x65,0x6c,0x2d,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,
-    0x27,0x3e,0x22,0x29,0x2b,0x67,0x65,0x6e,0x42,0x75,0x74,0x74,0x6f,0x6e,0x28,0x22,
-    0x70,0x61,0x74,0x74,0x65,0x72,0x6e,0x53,0x69,0x6d,0x75,0x6c,0x61,0x74,0x65,0x28,
-    0x29,0x22,0x2c,0x22,0x22,0x2c,0x22,0x45,0x76,0x61,0x6c,0x75,0x61,0x74,0x65,0x20,
-    0x4e,0x6f,0x77,0x22,0x2c,0x22,0x45,0x76,0x61,0x6c,0x75,0x61,0x74,0x65,0x22,0x2c,
-    0x22,0x53,0x69,0x6d,0x75,0x6c,0x61,0x74,0x65,0x22,0x2c,0x22,0x62,0x6f,0x64,0x79,
-    0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x2c,0x21,0x31,
-    0x2c,0x21,0x30,0x29,0x29,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x6c,0x61,
-    0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,
-    0x66,0x6f,0x72,0x6d,0x2d,0x6c,0x61,0x62,0x65,0x6c,0x2d,0x63,0x68,0x65,0x63,0x6b,
-    0x62,0x6f,0x78,0x27,0x3e,0x41,0x75,0x74,0x6f,0x20,0x45,0x76,0x61,0x6c,0x75,0x61,
-    0x74,0x65,0x22,0x29,0x2b,0x22,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x63,0x68,
-    0x65,0x63,0x6b,0x62,0x6f,0x78,0x27,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x63,0x68,
-    0x65,0x63,0x6b,0x62,0x6f,0x78,0x27,0x20,0x69,0x64,0x3d,0x27,0x61,0x75,0x74,0x6f,
-    0x2d,0x65,0x76,0x61,0x6c,0x75,0x61,0x74,0x65,0x27,0x20,0x6f,0x6e,0x63,0x6c,0x69,
-    0x63,0x6b,0x3d,0x27,0x61,0x75,0x74,0x6f,0x45,0x76,0x61,0x6c,0x43,0x6c,0x69,0x63,
-    0x6b,0x65,0x64,0x28,0x29,0x27,0x20,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x3e,0x3c,
-    0x2f,0x69,0x6e,0x70,0x75,0x74,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x63,0x68,
-    0x65,0x63,0x6b,0x6d,0x61,0x72,0x6b,0x27,0x3e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,
-    0x22,0x29,0x2b,0x22,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x2f,0x64,0x69,
-    0x76,0x3e,0x22,0x29,0x2b,0x22,0x3c,0x74,0x65,0x78,0x74,0x61,0x72,0x65,0x61,0x20,
-    0x72,0x65,0x61,0x64,0x6f,0x6e,0x6c,0x79,0x20,0x69,0x64,0x3d,0x27,0x76,0x61,0x6c,
-    0x69,0x64,0x69,0x74,0x79,0x2d,0x63,0x68,0x65,0x63,0x6b,0x27,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x66,0x69,
-    0x65,0x6c,0x64,0x27,0x20,0x63,0x6f,0x6c,0x73,0x3d,0x27,0x35,0x30,0x27,0x20,0x72,
-    0x6f,0x77,0x73,0x3d,0x27,0x31,0x27,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x61,0x72,
-    0x65,0x61,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x29,0x2b,0x22,0x3c,0x64,0x69,
-    0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,
-    0x72,0x6d,0x2d,0x6c,0x69,0x6e,0x65,0x27,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,
-    0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x6c,
-    0x61,0x62,0x65,0x6c,0x27,0x3e,0x56,0x69,0x65,0x77,0x3c,0x2f,0x64,0x69,0x76,0x3e,
-    0x22,0x29,0x2b,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,
-    0x62,0x6f,0x64,0x79,0x2d,0x76,0x69,0x65,0x77,0x27,0x20,0x69,0x64,0x3d,0x27,0x74,
-    0x61,0x62,0x6c,0x65,0x2d,0x76,0x69,0x65,0x77,0x27,0x3e,0x3c,0x63,0x61,0x6e,0x76,
-    0x61,0x73,0x20,0x69,0x64,0x3d,0x27,0x74,0x61,0x62,0x6c,0x65,0x2d,0x63,0x61,0x6e,
-    0x76,0x61,0x73,0x27,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,
-    0x2d,0x63,0x61,0x6e,0x76,0x61,0x73,0x27,0x3e,0x3c,0x2f,0x63,0x61,0x6e,0x76,0x61,
-    0x73,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x29,
-    0x2c,0x61,0x3d,0x28,0x61,0x2b,0x3d,0x22,0x3c,0x2f,0x66,0x69,0x65,0x6c,0x64,0x73,
-    0x65,0x74,0x3e,0x22,0x29,0x2b,0x22,0x3c,0x2f,0x66,0x6f,0x72,0x6d,0x3e,0x3c,0x2f,
-    0x64,0x69,0x76,0x3e,0x22,0x2c,0x74,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,
-    0x4c,0x3d,0x61,0x2c,0x73,0x65,0x74,0x43,0x61,0x6e,0x76,0x61,0x73,0x53,0x68,0x61,
-    0x70,0x65,0x41,0x6e,0x64,0x53,0x69,0x7a,0x65,0x28,0x29,0x2c,0x22,0x73,0x65,0x71,
-    0x22,0x3d,0x3d,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,
-    0x74,0x65,0x2e,0x63,0x75,0x72,0x46,0x69,0x6c,0x65,0x54,0x79,0x70,0x65,0x26,0x26,
-    0x66,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x53,0x68,0x6f,0x77,0x28,0x21,0x30,0x2c,
-    0x5b,0x22,0x52,0x65,0x70,0x65,0x61,0x74,0x4d,0x6f,0x64,0x65,0x22,0x2c,0x22,0x4e,
-    0x6f,0x52,0x65,0x70,0x65,0x61,0x74,0x4d,0x6f,0x64,0x65,0x22,0x2c,0x22,0x53,0x68,
-    0x75,0x66,0x66,0x6c,0x65,0x4d,0x6f,0x64,0x65,0x22,0x2c,0x22,0x4e,0x6f,0x53,0x68,
-    0x75,0x66,0x66,0x6c,0x65,0x4d,0x6f,0x64,0x65,0x22,0x5d,0x29,0x7d,0x66,0x75,0x6e,
-    0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x65,0x71,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,
-    0x41,0x6c,0x6c,0x6f,0x77,0x44,0x72,0x6f,0x70,0x28,0x65,0x29,0x7b,0x65,0x2e,0x70,
-    0x72,0x65,0x76,0x65,0x6e,0x74,0x44,0x65,0x66,0x61,0x75,0x6c,0x74,0x28,0x29,0x7d,
-    0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x65,0x71,0x43,0x6f,0x6e,0x74,
-    0x65,0x6e,0x74,0x44,0x72,0x6f,0x70,0x28,0x65,0x29,0x7b,0x65,0x3d,0x65,0x2e,0x64,
-    0x61,0x74,0x61,0x54,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x2e,0x67,0x65,0x74,0x44,
-    0x61,0x74,0x61,0x28,0x22,0x66,0x69,0x6c,0x65,0x4e,0x61,0x6d,0x65,0x22,0x29,0x3b,
-    0x61,0x64,0x64,0x54,0x6f,0x54,0x65,0x78,0x74,0x61,0x72,0x65,0x61,0x28,0x64,0x6f,
-    0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,
-    0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x74,0x65,0x78,0x74,0x63,0x6f,0x6e,0x74,0x65,
-    0x6e,0x74,0x73,0x22,0x29,0x2c,0x65,0x2b,0x22,0x5c,0x6e,0x22,0x29,0x7d,0x66,0x75,
-    0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x61,0x64,0x64,0x54,0x6f,0x54,0x65,0x78,0x74,
-    0x61,0x72,0x65,0x61,0x28,0x65,0x2c,0x74,0x29,0x7b,0x76,0x61,0x72,0x20,0x61,0x3d,
-    0x65,0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,0x69,0x6f,0x6e,0x53,0x74,0x61,0x72,0x74,
-    0x2c,0x6e,0x3d,0x65,0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,0x69,0x6f,0x6e,0x45,0x6e,
-    0x64,0x2c,0x6f,0x3d,0x65,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,0x69,0x3d,0x6f,0x2e,
-    0x73,0x75,0x62,0x73,0x74,0x72,0x69,0x6e,0x67,0x28,0x30,0x2c,0x61,0x29,0x2c,0x6e,
-    0x3d,0x6f,0x2e,0x73,0x75,0x62,0x73,0x74,0x72,0x69,0x6e,0x67,0x28,0x6e,0x2c,0x6f,
-    0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x29,0x3b,0x65,0x2e,0x76,0x61,0x6c,0x75,0x65,
-    0x3d,0x69,0x2b,0x74,0x2b,0x6e,0x2c,0x65,0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,0x69,
-    0x6f,0x6e,0x53,0x74,0x61,0x72,0x74,0x3d,0x65,0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,
-    0x69,0x6f,0x6e,0x45,0x6e,0x64,0x3d,0x61,0x2b,0x74,0x2e,0x6c,0x65,0x6e,0x67,0x74,
-    0x68,0x2c,0x65,0x2e,0x66,0x6f,0x63,0x75,0x73,0x28,0x29,0x7d,0x66,0x75,0x6e,0x63,
-    0x74,0x69,0x6f,0x6e,0x20,0x73,0x65,0x74,0x43,0x61,0x6e,0x76,0x61,0x73,0x53,0x68,
-    0x61,0x70,0x65,0x41,0x6e,0x64,0x53,0x69,0x7a,0x65,0x28,0x29,0x7b,0x76,0x61,0x72,
-    0x20,0x65,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,
-    0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x74,0x61,0x62,0x6c,
-    0x65,0x2d,0x76,0x69,0x65,0x77,0x22,0x29,0x2c,0x74,0x3d,0x64,0x6f,0x63,0x75,0x6d,
-    0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,
-    0x49,0x64,0x28,0x22,0x74,0x61,0x62,0x6c,0x65,0x2d,0x63,0x61,0x6e,0x76,0x61,0x73,
-    0x22,0x29,0x3b,0x65,0x26,0x26,0x74,0x26,0x26,0x28,0x74,0x2e,0x77,0x69,0x64,0x74,
-    0x68,0x3d,0x31,0x30,0x2c,0x63,0x61,0x6e,0x76,0x61,0x73,0x4d,0x61,0x72,0x67,0x69,
-    0x6e,0x3d,0x2e,0x30,0x33,0x2a,0x65,0x2e,0x63,0x6c,0x69,0x65,0x6e,0x74,0x57,0x69,
-    0x64,0x74,0x68,0x2c,0x63,0x61,0x6e,0x76,0x61,0x73,0x53,0x69,0x7a,0x65,0x3d,0x65,
-    0x2e,0x63,0x6c,0x69,0x65,0x6e,0x74,0x57,0x69,0x64,0x74,0x68,0x2d,0x32,0x2a,0x63,
-    0x61,0x6e,0x76,0x61,0x73,0x4d,0x61,0x72,0x67,0x69,0x6e,0x2c,0x74,0x2e,0x77,0x69,
-    0x64,0x74,0x68,0x3d,0x63,0x61,0x6e,0x76,0x61,0x73,0x53,0x69,0x7a,0x65,0x2c,0x74,
-    0x2e,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x63,0x61,0x6e,0x76,0x61,0x73,0x53,0x69,
-    0x7a,0x65,0x2c,0x74,0x2e,0x73,0x74,0x79,0x6c,0x65,0x2e,0x6d,0x61,0x72,0x67,0x69,
-    0x6e,0x54,0x6f,0x70,0x3d,0x63,0x61,0x6e,0x76,0x61,0x73,0x4d,0x61,0x72,0x67,0x69,
-    0x6e,0x2c,0x74,0x2e,0x73,0x74,0x79,0x6c,0x65,0x2e,0x6d,0x61,0x72,0x67,0x69,0x6e,
-    0x42,0x6f,0x74,0x74,0x6f,0x6d,0x3d,0x63,0x61,0x6e,0x76,0x61,0x73,0x4d,0x61,0x72,
-    0x67,0x69,0x6e,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,
-    0x74,0x65,0x2e,0x63,0x61,0x6e,0x76,0x61,0x73,0x42,0x6f,0x72,0x64,0x65,0x72,0x3d,
-    0x2e,0x30,0x32,0x2a,0x63,0x61,0x6e,0x76,0x61,0x73,0x53,0x69,0x7a,0x65,0x2c,0x77,
-    0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x61,
-    0x6e,0x76,0x61,0x73,0x53,0x69,0x7a,0x65,0x3d,0x63,0x61,0x6e,0x76,0x61,0x73,0x53,
-    0x69,0x7a,0x65,0x2d,0x32,0x2a,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,
-    0x74,0x61,0x74,0x65,0x2e,0x63,0x61,0x6e,0x76,0x61,0x73,0x42,0x6f,0x72,0x64,0x65,
-    0x72,0x29,0x2c,0x70,0x61,0x74,0x74,0x65,0x72,0x6e,0x56,0x61,0x6c,0x69,0x64,0x61,
-    0x74,0x65,0x28,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x67,0x65,
-    0x6e,0x46,0x69,0x6c,0x65,0x45,0x64,0x69,0x74,0x48,0x65,0x61,0x64,0x69,0x6e,0x67,
-    0x28,0x29,0x7b,0x76,0x61,0x72,0x20,0x65,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,
-    0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,
-    0x28,0x22,0x70,0x61,0x67,0x65,0x42,0x6f,0x64,0x79,0x48,0x65,0x61,0x64,0x22,0x29,
-    0x2c,0x74,0x3d,0x67,0x65,0x6e,0x42,0x6f,0x64,0x79,0x48,0x65,0x61,0x64,0x69,0x6e,
-    0x67,0x53,0x65,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x3b,0x74,0x2b,0x3d,0x67,0x65,
-    0x6e,0x45,0x64,0x69,0x74,0x50,0x61,0x67,0x65,0x41,0x63,0x74,0x69,0x6f,0x6e,0x73,
-    0x28,0x22,0x66,0x69,0x6c,0x65,0x22,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,
-    0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x49,0x74,0x65,0x6d,0x2c,0x22,
-    0x70,0x61,0x74,0x41,0x64,0x64,0x22,0x3d,0x3d,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,
-    0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x50,0x61,0x67,0x65,
-    0x2e,0x74,0x72,0x69,0x6d,0x28,0x29,0x29,0x2c,0x65,0x2e,0x69,0x6e,0x6e,0x65,0x72,
-    0x48,0x54,0x4d,0x4c,0x3d,0x74,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,
-    0x67,0x65,0x6e,0x50,0x61,0x67,0x65,0x42,0x6f,0x64,0x79,0x28,0x29,0x7b,0x22,0x70,
-    0x61,0x74,0x45,0x64,0x69,0x74,0x22,0x3d,0x3d,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,
-    0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x50,0x61,0x67,0x65,
-    0x2e,0x74,0x72,0x69,0x6d,0x28,0x29,0x7c,0x7c,0x22,0x70,0x61,0x74,0x41,0x64,0x64,
-    0x22,0x3d,0x3d,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,
-    0x74,0x65,0x2e,0x63,0x75,0x72,0x50,0x61,0x67,0x65,0x2e,0x74,0x72,0x69,0x6d,0x28,
-    0x29,0x3f,0x28,0x67,0x65,0x6e,0x46,0x69,0x6c,0x65,0x45,0x64,0x69,0x74,0x48,0x65,
-    0x61,0x64,0x69,0x6e,0x67,0x28,0x29,0x2c,0x67,0x65,0x6e,0x46,0x69,0x6c,0x65,0x45,
-    0x64,0x69,0x74,0x46,0x6f,0x72,0x6d,0x28,0x29,0x2c,0x74,0x68,0x69,0x73,0x2e,0x73,
-    0x65,0x74,0x75,0x70,0x53,0x65,0x6c,0x65,0x63,0x74,0x28,0x74,0x68,0x69,0x73,0x2e,
-    0x73,0x65,0x74,0x46,0x69,0x6c,0x65,0x54,0x79,0x70,0x65,0x29,0x29,0x3a,0x28,0x67,
-    0x65,0x6e,0x48,0x6f,0x6d,0x65,0x50,0x61,0x67,0x65,0x42,0x6f,0x64,0x79,0x28,0x29,
-    0x2c,0x66,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x53,0x68,0x6f,0x77,0x28,0x21,0x31,
-    0x29,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x69,0x74,0x65,0x6d,
-    0x4c,0x69,0x73,0x74,0x53,0x68,0x6f,0x77,0x49,0x6e,0x45,0x64,0x69,0x74,0x6f,0x72,
-    0x28,0x65,0x29,0x7b,0x76,0x61,0x72,0x20,0x74,0x3d,0x22,0x22,0x3b,0x72,0x65,0x74,
-    0x75,0x72,0x6e,0x28,0x74,0x2b,0x3d,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x6c,0x69,0x73,0x74,0x2d,0x6c,0x69,
-    0x6e,0x65,0x20,0x62,0x6f,0x64,0x79,0x2d,0x6c,0x69,0x73,0x74,0x2d,0x73,0x6d,0x61,
-    0x6c,0x6c,0x27,0x3e,0x22,0x29,0x2b,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x6c,0x69,0x73,0x74,0x2d,0x64,0x72,
-    0x61,0x67,0x67,0x61,0x62,0x6c,0x65,0x27,0x3e,0x22,0x2b,0x28,0x22,0x3c,0x73,0x70,
-    0x61,0x6e,0x20,0x64,0x72,0x61,0x67,0x67,0x61,0x62,0x6c,0x65,0x3d,0x27,0x74,0x72,
-    0x75,0x65,0x27,0x20,0x6f,0x6e,0x64,0x72,0x61,0x67,0x73,0x74,0x61,0x72,0x74,0x3d,
-    0x27,0x66,0x69,0x6c,0x65,0x49,0x74,0x65,0x6d,0x44,0x72,0x61,0x67,0x53,0x74,0x61,
-    0x72,0x74,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x27,0x3e,0x22,0x2b,0x65,0x2b,0x22,
-    0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x22,0x29,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,
-    0x3e,0x22,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x7d,0x66,0x75,0x6e,0x63,
-    0x74,0x69,0x6f,0x6e,0x20,0x69,0x74,0x65,0x6d,0x4c,0x69,0x73,0x74,0x53,0x68,0x6f,
-    0x77,0x4d,0x61,0x69,0x6e,0x46,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x28,0x65,0x29,
-    0x7b,0x76,0x61,0x72,0x20,0x74,0x3d,0x65,0x2e,0x73,0x75,0x62,0x73,0x74,0x72,0x28,
-    0x65,0x2e,0x6c,0x61,0x73,0x74,0x49,0x6e,0x64,0x65,0x78,0x4f,0x66,0x28,0x22,0x2e,
-    0x22,0x29,0x2b,0x31,0x29,0x2e,0x74,0x6f,0x55,0x70,0x70,0x65,0x72,0x43,0x61,0x73,
-    0x65,0x28,0x29,0x2c,0x61,0x3d,0x65,0x2e,0x73,0x75,0x62,0x73,0x74,0x72,0x28,0x30,
-    0x2c,0x65,0x2e,0x6c,0x61,0x73,0x74,0x49,0x6e,0x64,0x65,0x78,0x4f,0x66,0x28,0x22,
-    0x2e,0x22,0x29,0x29,0x3b,0x6c,0x65,0x74,0x20,0x6e,0x3d,0x22,0x22,0x3b,0x72,0x65,
-    0x74,0x75,0x72,0x6e,0x20,0x6e,0x3d,0x28,0x6e,0x3d,0x28,0x6e,0x3d,0x28,0x6e,0x3d,
-    0x28,0x6e,0x3d,0x28,0x6e,0x3d,0x28,0x6e,0x3d,0x28,0x6e,0x2b,0x3d,0x22,0x3c,0x64,
-    0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x6c,
-    0x69,0x73,0x74,0x2d,0x6c,0x69,0x6e,0x65,0x27,0x3e,0x22,0x29,0x2b,0x67,0x65,0x6e,
-    0x41,0x6a,0x61,0x78,0x42,0x75,0x74,0x74,0x6f,0x6e,0x28,0x22,0x2f,0x70,0x6c,0x61,
-    0x79,0x46,0x69,0x6c,0x65,0x2f,0x22,0x2b,0x65,0x2c,0x22,0x22,0x2c,0x74,0x2c,0x22,
-    0x50,0x6c,0x61,0x79,0x20,0x66,0x69,0x6c,0x65,0x22,0x2c,0x22,0x22,0x2c,0x22,0x62,
-    0x6f,0x64,0x79,0x2d,0x6c,0x69,0x73,0x74,0x2d,0x66,0x69,0x6c,0x65,0x74,0x79,0x70,
-    0x65,0x22,0x29,0x2b,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-    0x27,0x62,0x6f,0x64,0x79,0x2d,0x6c,0x69,0x73,0x74,0x2d,0x69,0x74,0x65,0x6d,0x27,
-    0x3e,0x22,0x29,0x2b,0x28,0x22,0x4a,0x53,0x4f,0x4e,0x22,0x3d,0x3d,0x3d,0x74,0x3f,
-    0x22,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x22,0x2b,0x65,0x2b,0x22,0x3c,0x2f,0x73,0x70,
-    0x61,0x6e,0x3e,0x22,0x3a,0x67,0x65,0x6e,0x41,0x6a,0x61,0x78,0x42,0x75,0x74,0x74,
-    0x6f,0x6e,0x28,0x22,0x2f,0x70,0x6c,0x61,0x79,0x46,0x69,0x6c,0x65,0x2f,0x22,0x2b,
-    0x65,0x2c,0x22,0x22,0x2c,0x61,0x2c,0x22,0x50,0x6c,0x61,0x79,0x20,0x66,0x69,0x6c,
-    0x65,0x22,0x2c,0x22,0x22,0x2c,0x22,0x62,0x6f,0x64,0x79,0x2d,0x67,0x72,0x6f,0x75,
-    0x70,0x2d,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x29,0x29,0x29,0x2b,0x22,0x3c,0x2f,
-    0x64,0x69,0x76,0x3e,0x22,0x2b,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x27,0x62,0x6f,0x64,0x79,0x2d,0x6c,0x69,0x73,0x74,0x2d,0x61,0x63,0x74,
-    0x69,0x6f,0x6e,0x73,0x27,0x3e,0x22,0x29,0x2b,0x67,0x65,0x6e,0x42,0x75,0x74,0x74,
-    0x6f,0x6e,0x28,0x27,0x75,0x73,0x65,0x72,0x41,0x63,0x74,0x69,0x6f,0x6e,0x28,0x22,
-    0x66,0x69,0x6c,0x65,0x22,0x2c,0x22,0x72,0x75,0x6e,0x22,0x2c,0x22,0x7e,0x6b,0x65,
-    0x79,0x7e,0x22,0x29,0x27,0x2c,0x65,0x2c,0x22,0x22,0x2c,0x22,0x52,0x75,0x6e,0x20,
-    0x70,0x61,0x74,0x74,0x65,0x72,0x6e,0x22,0x2c,0x22,0x52,0x75,0x6e,0x22,0x2c,0x22,
-    0x62,0x6f,0x64,0x79,0x2d,0x67,0x72,0x6f,0x75,0x70,0x2d,0x62,0x75,0x74,0x74,0x6f,
-    0x6e,0x22,0x2c,0x21,0x31,0x2c,0x21,0x30,0x29,0x29,0x2b,0x67,0x65,0x6e,0x42,0x75,
-    0x74,0x74,0x6f,0x6e,0x28,0x27,0x75,0x73,0x65,0x72,0x41,0x63,0x74,0x69,0x6f,0x6e,
-    0x28,0x22,0x66,0x69,0x6c,0x65,0x22,0x2c,0x22,0x72,0x75,0x6e,0x41,0x74,0x53,0x74,
-    0x61,0x72,0x74,0x22,0x2c,0x22,0x7e,0x6b,0x65,0x79,0x7e,0x22,0x2c,0x27,0x2b,0x28,
-    0x65,0x3d,0x3d,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,
-    0x74,0x61,0x74,0x65,0x2e,0x73,0x74,0x61,0x72,0x74,0x75,0x70,0x29,0x2b,0x22,0x29,
-    0x22,0x2c,0x65,0x2c,0x22,0x22,0x2c,0x22,0x52,0x75,0x6e,0x20,0x61,0x74,0x20,0x73,
-    0x74,0x61,0x72,0x74,0x75,0x70,0x22,0x2c,0x22,0x52,0x75,0x6e,0x41,0x74,0x53,0x74,
-    0x61,0x72,0x74,0x22,0x2c,0x22,0x62,0x6f,0x64,0x79,0x2d,0x67,0x72,0x6f,0x75,0x70,
-    0x2d,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x2c,0x65,0x3d,0x3d,0x3d,0x77,0x69,0x6e,
-    0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x73,0x74,
-    0x61,0x72,0x74,0x75,0x70,0x2c,0x21,0x30,0x29,0x29,0x2b,0x67,0x65,0x6e,0x42,0x75,
-    0x74,0x74,0x6f,0x6e,0x28,0x27,0x75,0x73,0x65,0x72,0x41,0x63,0x74,0x69,0x6f,0x6e,
-    0x28,0x22,0x66,0x69,0x6c,0x65,0x22,0x2c,0x22,0x65,0x64,0x69,0x74,0x22,0x2c,0x22,
-    0x7e,0x6b,0x65,0x79,0x7e,0x22,0x29,0x27,0x2c,0x65,0x2c,0x22,0x22,0x2c,0x22,0x45,
-    0x64,0x69,0x74,0x20,0x70,0x61,0x74,0x74,0x65,0x72,0x6e,0x22,0x2c,0x22,0x45,0x64,
-    0x69,0x74,0x22,0x2c,0x22,0x62,0x6f,0x64,0x79,0x2d,0x67,0x72,0x6f,0x75,0x70,0x2d,
-    0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x2c,0x21,0x31,0x2c,0x21,0x30,0x29,0x29,0x2b,
-    0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,
-    0x22,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x66,0x69,0x6c,0x65,0x4c,
-    0x69,0x73,0x74,0x53,0x68,0x6f,0x77,0x28,0x61,0x2c,0x74,0x3d,0x5b,0x5d,0x29,0x7b,
-    0x76,0x61,0x72,0x20,0x65,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,
-    0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x70,
-    0x61,0x74,0x74,0x65,0x72,0x6e,0x73,0x4c,0x69,0x73,0x74,0x22,0x29,0x3b,0x6c,0x65,
-    0x74,0x20,0x6e,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,
-    0x74,0x65,0x2e,0x6c,0x61,0x74,0x65,0x73,0x74,0x46,0x69,0x6c,0x65,0x4c,0x69,0x73,
-    0x74,0x49,0x6e,0x66,0x6f,0x2e,0x66,0x69,0x6c,0x65,0x73,0x3b,0x6e,0x3d,0x6e,0x7c,
-    0x7c,0x5b,0x5d,0x2c,0x6c,0x69,0x73,0x74,0x53,0x74,0x72,0x3d,0x22,0x22,0x3b,0x66,
-    0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,0x74,0x3d,0x30,0x3b,0x74,0x3c,0x6e,0x2e,0x6c,
-    0x65,0x6e,0x67,0x74,0x68,0x3b,0x74,0x2b,0x2b,0x29,0x7b,0x6c,0x65,0x74,0x20,0x65,
-    0x3d,0x6e,0x5b,0x74,0x5d,0x2e,0x6e,0x61,0x6d,0x65,0x3b,0x65,0x3d,0x65,0x2e,0x72,
-    0x65,0x70,0x6c,0x61,0x63,0x65,0x28,0x22,0x2f,0x22,0x2c,0x22,0x22,0x29,0x2c,0x77,
-    0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x66,0x69,
-    0x6c,0x65,0x45,0x78,0x63,0x6c,0x75,0x64,0x65,0x73,0x2e,0x69,0x6e,0x63,0x6c,0x75,
-    0x64,0x65,0x73,0x28,0x65,0x2e,0x74,0x6f,0x55,0x70,0x70,0x65,0x72,0x43,0x61,0x73,
-    0x65,0x28,0x29,0x29,0x7c,0x7c,0x28,0x6c,0x69,0x73,0x74,0x53,0x74,0x72,0x2b,0x3d,
-    0x28,0x61,0x3f,0x69,0x74,0x65,0x6d,0x4c,0x69,0x73,0x74,0x53,0x68,0x6f,0x77,0x49,
-    0x6e,0x45,0x64,0x69,0x74,0x6f,0x72,0x3a,0x69,0x74,0x65,0x6d,0x4c,0x69,0x73,0x74,
-    0x53,0x68,0x6f,0x77,0x4d,0x61,0x69,0x6e,0x46,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,
-    0x29,0x28,0x65,0x29,0x29,0x7d,0x66,0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,0x65,0x3d,
-    0x30,0x3b,0x65,0x3c,0x74,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x65,0x2b,0x2b,
-    0x29,0x6c,0x69,0x73,0x74,0x53,0x74,0x72,0x2b,0x3d,0x69,0x74,0x65,0x6d,0x4c,0x69,
-    0x73,0x74,0x53,0x68,0x6f,0x77,0x49,0x6e,0x45,0x64,0x69,0x74,0x6f,0x72,0x28,0x74,
-    0x5b,0x65,0x5d,0x29,0x3b,0x65,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,
-    0x3d,0x6c,0x69,0x73,0x74,0x53,0x74,0x72,0x2c,0x61,0x7c,0x7c,0x28,0x65,0x3d,0x64,
-    0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,
-    0x6e,0x74,0x73,0x42,0x79,0x43,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x28,0x22,
-    0x64,0x72,0x6f,0x70,0x2d,0x7a,0x6f,0x6e,0x65,0x22,0x29,0x2c,0x41,0x72,0x72,0x61,
-    0x79,0x2e,0x66,0x72,0x6f,0x6d,0x28,0x65,0x29,0x2e,0x66,0x6f,0x72,0x45,0x61,0x63,
-    0x68,0x28,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x74,0x29,0x7b,0x5b,0x22,
-    0x64,0x72,0x61,0x67,0x65,0x6e,0x74,0x65,0x72,0x22,0x2c,0x22,0x64,0x72,0x61,0x67,
-    0x6f,0x76,0x65,0x72,0x22,0x2c,0x22,0x64,0x72,0x61,0x67,0x6c,0x65,0x61,0x76,0x65,
-    0x22,0x2c,0x22,0x64,0x72,0x6f,0x70,0x22,0x5d,0x2e,0x66,0x6f,0x72,0x45,0x61,0x63,
-    0x68,0x28,0x65,0x3d,0x3e,0x7b,0x74,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,
-    0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x65,0x2c,0x70,0x72,0x65,0x76,0x65,
-    0x6e,0x74,0x44,0x65,0x66,0x61,0x75,0x6c,0x74,0x73,0x2c,0x21,0x31,0x29,0x2c,0x64,
-    0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x62,0x6f,0x64,0x79,0x2e,0x61,0x64,0x64,
-    0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x65,0x2c,
-    0x70,0x72,0x65,0x76,0x65,0x6e,0x74,0x44,0x65,0x66,0x61,0x75,0x6c,0x74,0x73,0x2c,
-    0x21,0x31,0x29,0x7d,0x29,0x2c,0x5b,0x22,0x64,0x72,0x61,0x67,0x65,0x6e,0x74,0x65,
-    0x72,0x22,0x2c,0x22,0x64,0x72,0x61,0x67,0x6f,0x76,0x65,0x72,0x22,0x5d,0x2e,0x66,
-    0x6f,0x72,0x45,0x61,0x63,0x68,0x28,0x65,0x3d,0x3e,0x7b,0x74,0x2e,0x61,0x64,0x64,
-    0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x65,0x2c,
-    0x68,0x69,0x67,0x68,0x6c,0x69,0x67,0x68,0x74,0x2c,0x21,0x31,0x29,0x7d,0x29,0x2c,
-    0x5b,0x22,0x64,0x72,0x61,0x67,0x6c,0x65,0x61,0x76,0x65,0x22,0x2c,0x22,0x64,0x72,
-    0x6f,0x70,0x22,0x5d,0x2e,0x66,0x6f,0x72,0x45,0x61,0x63,0x68,0x28,0x65,0x3d,0x3e,
-    0x7b,0x74,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,
-    0x6e,0x65,0x72,0x28,0x65,0x2c,0x75,0x6e,0x68,0x69,0x67,0x68,0x6c,0x69,0x67,0x68,
-    0x74,0x2c,0x21,0x31,0x29,0x7d,0x29,0x2c,0x74,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,
-    0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x64,0x72,0x6f,0x70,
-    0x22,0x2c,0x68,0x61,0x6e,0x64,0x6c,0x65,0x44,0x72,0x6f,0x70,0x2c,0x21,0x31,0x29,
-    0x7d,0x29,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x66,0x69,0x6c,
-    0x65,0x49,0x74,0x65,0x6d,0x44,0x72,0x61,0x67,0x53,0x74,0x61,0x72,0x74,0x28,0x65,
-    0x29,0x7b,0x65,0x2e,0x64,0x61,0x74,0x61,0x54,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,
-    0x2e,0x73,0x65,0x74,0x44,0x61,0x74,0x61,0x28,0x22,0x66,0x69,0x6c,0x65,0x4e,0x61,
-    0x6d,0x65,0x22,0x2c,0x65,0x2e,0x74,0x61,0x72,0x67,0x65,0x74,0x2e,0x69,0x6e,0x6e,
-    0x65,0x72,0x48,0x54,0x4d,0x4c,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
-    0x20,0x66,0x69,0x6c,0x65,0x52,0x65,0x61,0x64,0x54,0x6f,0x45,0x64,0x69,0x74,0x28,
-    0x65,0x29,0x7b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,
-    0x65,0x2e,0x63,0x75,0x72,0x50,0x61,0x67,0x65,0x3d,0x22,0x70,0x61,0x74,0x45,0x64,
-    0x69,0x74,0x22,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,
-    0x74,0x65,0x2e,0x63,0x75,0x72,0x46,0x69,0x6c,0x65,0x43,0x6f,0x6e,0x74,0x65,0x6e,
-    0x74,0x4a,0x73,0x6f,0x6e,0x3d,0x65,0x3b,0x65,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,
-    0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x49,0x74,0x65,0x6d,
-    0x2c,0x65,0x3d,0x65,0x2e,0x73,0x75,0x62,0x73,0x74,0x72,0x28,0x65,0x2e,0x6c,0x61,
-    0x73,0x74,0x49,0x6e,0x64,0x65,0x78,0x4f,0x66,0x28,0x22,0x2e,0x22,0x29,0x2b,0x31,
-    0x29,0x2e,0x74,0x6f,0x4c,0x6f,0x77,0x65,0x72,0x43,0x61,0x73,0x65,0x28,0x29,0x3b,
-    0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,
-    0x75,0x72,0x46,0x69,0x6c,0x65,0x54,0x79,0x70,0x65,0x3d,0x65,0x2c,0x75,0x70,0x64,
-    0x61,0x74,0x65,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,0x28,0x29,0x7d,0x66,0x75,0x6e,
-    0x63,0x74,0x69,0x6f,0x6e,0x20,0x70,0x72,0x65,0x76,0x65,0x6e,0x74,0x44,0x65,0x66,
-    0x61,0x75,0x6c,0x74,0x73,0x28,0x65,0x29,0x7b,0x65,0x2e,0x70,0x72,0x65,0x76,0x65,
-    0x6e,0x74,0x44,0x65,0x66,0x61,0x75,0x6c,0x74,0x28,0x29,0x2c,0x65,0x2e,0x73,0x74,
-    0x6f,0x70,0x50,0x72,0x6f,0x70,0x61,0x67,0x61,0x74,0x69,0x6f,0x6e,0x28,0x29,0x7d,
-    0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x6c,0x69,0x67,
-    0x68,0x74,0x28,0x65,0x29,0x7b,0x65,0x3d,0x65,0x2e,0x63,0x75,0x72,0x72,0x65,0x6e,
-    0x74,0x54,0x61,0x72,0x67,0x65,0x74,0x2e,0x69,0x64,0x3b,0x64,0x6f,0x63,0x75,0x6d,
-    0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,
-    0x49,0x64,0x28,0x65,0x29,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4c,0x69,0x73,0x74,0x2e,
-    0x61,0x64,0x64,0x28,0x22,0x68,0x69,0x67,0x68,0x6c,0x69,0x67,0x68,0x74,0x22,0x29,
-    0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x75,0x6e,0x68,0x69,0x67,0x68,
-    0x6c,0x69,0x67,0x68,0x74,0x28,0x65,0x29,0x7b,0x65,0x3d,0x65,0x2e,0x63,0x75,0x72,
-    0x72,0x65,0x6e,0x74,0x54,0x61,0x72,0x67,0x65,0x74,0x2e,0x69,0x64,0x3b,0x64,0x6f,
-    0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,
-    0x74,0x42,0x79,0x49,0x64,0x28,0x65,0x29,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4c,0x69,
-    0x73,0x74,0x2e,0x72,0x65,0x6d,0x6f,0x76,0x65,0x28,0x22,0x68,0x69,0x67,0x68,0x6c,
-    0x69,0x67,0x68,0x74,0x22,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,
-    0x68,0x61,0x6e,0x64,0x6c,0x65,0x44,0x72,0x6f,0x70,0x28,0x65,0x29,0x7b,0x75,0x70,
-    0x6c,0x6f,0x61,0x64,0x54,0x6f,0x46,0x69,0x6c,0x65,0x4d,0x61,0x6e,0x61,0x67,0x65,
-    0x72,0x28,0x65,0x2e,0x64,0x61,0x74,0x61,0x54,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,
-    0x2e,0x66,0x69,0x6c,0x65,0x73,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
-    0x20,0x75,0x70,0x6c,0x6f,0x61,0x64,0x54,0x6f,0x46,0x69,0x6c,0x65,0x4d,0x61,0x6e,
-    0x61,0x67,0x65,0x72,0x28,0x65,0x29,0x7b,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,
-    0x7a,0x65,0x50,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x28,0x28,0x65,0x3d,0x5b,0x2e,
-    0x2e,0x2e,0x65,0x5d,0x29,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x2c,0x22,0x70,0x72,
-    0x6f,0x67,0x72,0x65,0x73,0x73,0x2d,0x62,0x61,0x72,0x2d,0x66,0x69,0x6c,0x65,0x2d,
-    0x6d,0x61,0x6e,0x61,0x67,0x65,0x72,0x22,0x29,0x2c,0x65,0x2e,0x66,0x6f,0x72,0x45,
-    0x61,0x63,0x68,0x28,0x75,0x70,0x6c,0x6f,0x61,0x64,0x4f,0x6e,0x6c,0x79,0x46,0x69,
-    0x6c,0x65,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x69,0x6e,0x69,
-    0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,0x50,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x28,
-    0x65,0x2c,0x74,0x29,0x7b,0x74,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,
-    0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x74,
-    0x29,0x3b,0x74,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4c,0x69,0x73,0x74,0x2e,0x72,0x65,
-    0x6d,0x6f,0x76,0x65,0x28,0x22,0x68,0x69,0x64,0x64,0x65,0x6e,0x22,0x29,0x2c,0x74,
-    0x2e,0x76,0x61,0x6c,0x75,0x65,0x3d,0x30,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,
-    0x6e,0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x50,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,
-    0x28,0x65,0x2c,0x74,0x2c,0x61,0x29,0x7b,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,
-    0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,
-    0x61,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3d,0x74,0x7d,0x66,0x75,0x6e,0x63,0x74,
-    0x69,0x6f,0x6e,0x20,0x75,0x70,0x6c,0x6f,0x61,0x64,0x4f,0x6e,0x6c,0x79,0x46,0x69,
-    0x6c,0x65,0x28,0x65,0x2c,0x74,0x29,0x7b,0x75,0x70,0x6c,0x6f,0x61,0x64,0x46,0x69,
-    0x6c,0x65,0x53,0x70,0x65,0x63,0x55,0x72,0x6c,0x28,0x22,0x2f,0x75,0x70,0x6c,0x6f,
-    0x61,0x64,0x74,0x6f,0x66,0x69,0x6c,0x65,0x6d,0x61,0x6e,0x22,0x2c,0x22,0x70,0x72,
-    0x6f,0x67,0x72,0x65,0x73,0x73,0x2d,0x62,0x61,0x72,0x2d,0x66,0x69,0x6c,0x65,0x2d,
-    0x6d,0x61,0x6e,0x61,0x67,0x65,0x72,0x22,0x2c,0x65,0x2c,0x74,0x29,0x7d,0x66,0x75,
-    0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x75,0x70,0x6c,0x6f,0x61,0x64,0x46,0x69,0x6c,
-    0x65,0x53,0x70,0x65,0x63,0x55,0x72,0x6c,0x28,0x65,0x2c,0x74,0x2c,0x61,0x2c,0x6e,
-    0x29,0x7b,0x76,0x61,0x72,0x20,0x6f,0x3d,0x6e,0x65,0x77,0x20,0x58,0x4d,0x4c,0x48,
-    0x74,0x74,0x70,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x2c,0x69,0x3d,0x6e,0x65,0x77,
-    0x20,0x46,0x6f,0x72,0x6d,0x44,0x61,0x74,0x61,0x3b,0x6f,0x2e,0x6f,0x70,0x65,0x6e,
-    0x28,0x22,0x50,0x4f,0x53,0x54,0x22,0x2c,0x65,0x2c,0x21,0x30,0x29,0x2c,0x6f,0x2e,
-    0x73,0x65,0x74,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x48,0x65,0x61,0x64,0x65,0x72,
-    0x28,0x22,0x58,0x2d,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x65,0x64,0x2d,0x57,0x69,
-    0x74,0x68,0x22,0x2c,0x22,0x58,0x4d,0x4c,0x48,0x74,0x74,0x70,0x52,0x65,0x71,0x75,
-    0x65,0x73,0x74,0x22,0x29,0x2c,0x6f,0x2e,0x75,0x70,0x6c,0x6f,0x61,0x64,0x2e,0x61,
-    0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,
-    0x22,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x22,0x2c,0x66,0x75,0x6e,0x63,0x74,
-    0x69,0x6f,0x6e,0x28,0x65,0x29,0x7b,0x75,0x70,0x64,0x61,0x74,0x65,0x50,0x72,0x6f,
-    0x67,0x72,0x65,0x73,0x73,0x28,0x6e,0x2c,0x31,0x30,0x30,0x2a,0x65,0x2e,0x6c,0x6f,
-    0x61,0x64,0x65,0x64,0x2f,0x65,0x2e,0x74,0x6f,0x74,0x61,0x6c,0x7c,0x7c,0x31,0x30,
-    0x30,0x2c,0x74,0x29,0x7d,0x29,0x2c,0x6f,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,
-    0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x72,0x65,0x61,0x64,0x79,
-    0x73,0x74,0x61,0x74,0x65,0x63,0x68,0x61,0x6e,0x67,0x65,0x22,0x2c,0x66,0x75,0x6e,
-    0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,0x29,0x7b,0x34,0x3d,0x3d,0x3d,0x6f,0x2e,0x72,
-    0x65,0x61,0x64,0x79,0x53,0x74,0x61,0x74,0x65,0x26,0x26,0x32,0x30,0x30,0x3d,0x3d,
-    0x3d,0x6f,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x3f,0x28,0x75,0x70,0x64,0x61,0x74,
-    0x65,0x50,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x28,0x6e,0x2c,0x31,0x30,0x30,0x2c,
-    0x74,0x29,0x2c,0x72,0x65,0x71,0x46,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x41,0x6e,
-    0x64,0x55,0x70,0x64,0x61,0x74,0x65,0x28,0x29,0x29,0x3a,0x34,0x3d,0x3d,0x3d,0x6f,
-    0x2e,0x72,0x65,0x61,0x64,0x79,0x53,0x74,0x61,0x74,0x65,0x26,0x26,0x6f,0x2e,0x73,
-    0x74,0x61,0x74,0x75,0x73,0x7d,0x29,0x2c,0x69,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,
-    0x28,0x22,0x66,0x69,0x6c,0x65,0x22,0x2c,0x61,0x29,0x2c,0x6f,0x2e,0x73,0x65,0x6e,
-    0x64,0x28,0x69,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x65,0x76,
-    0x61,0x6c,0x49,0x6e,0x43,0x6f,0x6e,0x74,0x65,0x78,0x74,0x28,0x65,0x2c,0x74,0x29,
-    0x7b,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6e,0x65,0x77,0x20,0x46,0x75,0x6e,0x63,
-    0x74,0x69,0x6f,0x6e,0x28,0x22,0x73,0x65,0x6c,0x66,0x22,0x2c,0x22,0x77,0x69,0x6e,
-    0x64,0x6f,0x77,0x22,0x2c,0x22,0x74,0x6f,0x70,0x22,0x2c,0x22,0x77,0x69,0x74,0x68,
-    0x28,0x74,0x68,0x69,0x73,0x29,0x20,0x7b,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
-    0x28,0x22,0x2b,0x65,0x2b,0x22,0x29,0x7d,0x22,0x29,0x2e,0x63,0x61,0x6c,0x6c,0x28,
-    0x74,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x62,0x6a,0x43,
-    0x6c,0x6f,0x6e,0x65,0x28,0x65,0x29,0x7b,0x69,0x66,0x28,0x6e,0x75,0x6c,0x6c,0x3d,
-    0x3d,0x65,0x7c,0x7c,0x22,0x6f,0x62,0x6a,0x65,0x63,0x74,0x22,0x21,0x3d,0x74,0x79,
-    0x70,0x65,0x6f,0x66,0x20,0x65,0x29,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x65,0x3b,
-    0x76,0x61,0x72,0x20,0x74,0x2c,0x61,0x3d,0x65,0x2e,0x63,0x6f,0x6e,0x73,0x74,0x72,
-    0x75,0x63,0x74,0x6f,0x72,0x28,0x29,0x3b,0x66,0x6f,0x72,0x28,0x74,0x20,0x69,0x6e,
-    0x20,0x65,0x29,0x65,0x2e,0x68,0x61,0x73,0x4f,0x77,0x6e,0x50,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x28,0x74,0x29,0x26,0x26,0x28,0x61,0x5b,0x74,0x5d,0x3d,0x65,0x5b,
-    0x74,0x5d,0x29,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x7d,0x66,0x75,0x6e,
-    0x63,0x74,0x69,0x6f,0x6e,0x20,0x65,0x78,0x74,0x72,0x61,0x63,0x74,0x54,0x61,0x62,
-    0x6c,0x65,0x53,0x69,0x7a,0x65,0x28,0x65,0x29,0x7b,0x76,0x61,0x72,0x20,0x74,0x3b,
-    0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,
-    0x2e,0x72,0x6f,0x62,0x6f,0x74,0x47,0x65,0x6f,0x6d,0x26,0x26,0x77,0x69,0x6e,0x64,
-    0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x72,0x6f,0x62,
-    0x6f,0x74,0x47,0x65,0x6f,0x6d,0x2e,0x61,0x78,0x69,0x73,0x30,0x26,0x26,0x77,0x69,
-    0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x72,
-    0x6f,0x62,0x6f,0x74,0x47,0x65,0x6f,0x6d,0x2e,0x61,0x78,0x69,0x73,0x30,0x2e,0x6d,
-    0x61,0x78,0x56,0x61,0x6c,0x26,0x26,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,
-    0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x72,0x6f,0x62,0x6f,0x74,0x47,0x65,0x6f,
-    0x6d,0x2e,0x61,0x78,0x69,0x73,0x31,0x26,0x26,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,
-    0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x72,0x6f,0x62,0x6f,0x74,0x47,
-    0x65,0x6f,0x6d,0x2e,0x61,0x78,0x69,0x73,0x31,0x2e,0x6d,0x61,0x78,0x56,0x61,0x6c,
-    0x26,0x26,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,
-    0x74,0x65,0x2e,0x72,0x6f,0x62,0x6f,0x74,0x47,0x65,0x6f,0x6d,0x3f,0x22,0x53,0x69,
-    0x6e,0x67,0x6c,0x65,0x41,0x72,0x6d,0x53,0x63,0x61,0x72,0x61,0x22,0x3d,0x3d,0x3d,
-    0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,
-    0x2e,0x72,0x6f,0x62,0x6f,0x74,0x47,0x65,0x6f,0x6d,0x3f,0x28,0x74,0x3d,0x77,0x69,
-    0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x72,
-    0x6f,0x62,0x6f,0x74,0x47,0x65,0x6f,0x6d,0x2e,0x61,0x78,0x69,0x73,0x30,0x2e,0x6d,
-    0x61,0x78,0x56,0x61,0x6c,0x2b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,
-    0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x72,0x6f,0x62,0x6f,0x74,0x47,0x65,0x6f,0x6d,
-    0x2e,0x61,0x78,0x69,0x73,0x31,0x2e,0x6d,0x61,0x78,0x56,0x61,0x6c,0x2c,0x65,0x2e,
-    0x73,0x69,0x7a,0x65,0x58,0x3d,0x32,0x2a,0x74,0x2c,0x65,0x2e,0x73,0x69,0x7a,0x65,
-    0x59,0x3d,0x32,0x2a,0x74,0x2c,0x65,0x2e,0x6f,0x72,0x69,0x67,0x69,0x6e,0x58,0x3d,
-    0x74,0x2c,0x65,0x2e,0x6f,0x72,0x69,0x67,0x69,0x6e,0x59,0x3d,0x74,0x29,0x3a,0x28,
-    0x65,0x2e,0x73,0x69,0x7a,0x65,0x58,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,
-    0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x72,0x6f,0x62,0x6f,0x74,0x47,0x65,
-    0x6f,0x6d,0x2e,0x61,0x78,0x69,0x73,0x30,0x2e,0x6d,0x61,0x78,0x56,0x61,0x6c,0x2c,
-    0x65,0x2e,0x73,0x69,0x7a,0x65,0x59,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,
-    0x61,0x67,0x65,0x53,0x74,0x61,0x74,0x65,0x2e,0x72,0x6f,0x62,0x6f,0x74,0x47,0x65,
-    0x6f,0x6d,0x2e,0x61,0x78,0x69,0x73,0x31,0x2e,0x6d,0x61,0x78,0x56,0x61,0x6c,0x2c,
-    0x65,0x2e,0x6f,0x72,0x69,0x67,0x69,0x6e,0x58,0x3d,0x30,0x2c,0x65,0x2e,0x6f,0x72,
-    0x69,0x67,0x69,0x6e,0x59,0x3d,0x30,0x29,0x3a,0x28,0x74,0x3d,0x77,0x69,0x6e,0x64,
-    0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x64,0x65,0x66,0x61,0x75,
-    0x6c,0x74,0x54,0x61,0x62,0x6c,0x65,0x53,0x69,0x7a,0x65,0x4d,0x4d,0x2c,0x65,0x2e,
-    0x73,0x69,0x7a,0x65,0x58,0x3d,0x74,0x2c,0x65,0x2e,0x73,0x69,0x7a,0x65,0x59,0x3d,
-    0x74,0x2c,0x65,0x2e,0x6f,0x72,0x69,0x67,0x69,0x6e,0x58,0x3d,0x74,0x2f,0x32,0x2c,
-    0x65,0x2e,0x6f,0x72,0x69,0x67,0x69,0x6e,0x59,0x3d,0x74,0x2f,0x32,0x29,0x7d,0x66,
-    0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x72,
-    0x69,0x63,0x53,0x68,0x6f,0x77,0x56,0x61,0x6c,0x69,0x64,0x69,0x74,0x79,0x28,0x65,
-    0x2c,0x74,0x29,0x7b,0x76,0x61,0x72,0x20,0x61,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,
-    0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,
-    0x64,0x28,0x22,0x76,0x61,0x6c,0x69,0x64,0x69,0x74,0x79,0x2d,0x63,0x68,0x65,0x63,
-    0x6b,0x22,0x29,0x3b,0x61,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,
-    0x65,0x2c,0x74,0x3f,0x61,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4c,0x69,0x73,0x74,0x2e,
-    0x61,0x64,0x64,0x28,0x22,0x77,0x61,0x72,0x6e,0x69,0x6e,0x67,0x22,0x29,0x3a,0x61,
-    0x2e,0x63,0x6c,0x61,0x73,0x73,0x4c,0x69,0x73,0x74,0x2e,0x72,0x65,0x6d,0x6f,0x76,
-    0x65,0x28,0x22,0x77,0x61,0x72,0x6e,0x69,0x6e,0x67,0x22,0x29,0x7d,0x66,0x75,0x6e,
-    0x63,0x74,0x69,0x6f,0x6e,0x20,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x72,0x69,0x63,
-    0x41,0x64,0x64,0x4d,0x61,0x74,0x68,0x73,0x54,0x6f,0x43,0x6f,0x6e,0x74,0x65,0x78,
-    0x74,0x28,0x65,0x29,0x7b,0x65,0x2e,0x73,0x69,0x6e,0x3d,0x4d,0x61,0x74,0x68,0x2e,
-    0x73,0x69,0x6e,0x2c,0x65,0x2e,0x63,0x6f,0x73,0x3d,0x4d,0x61,0x74,0x68,0x2e,0x63,
-    0x6f,0x73,0x2c,0x65,0x2e,0x74,0x61,0x6e,0x3d,0x4d,0x61,0x74,0x68,0x2e,0x74,0x61,
-    0x6e,0x2c,0x65,0x2e,0x61,0x73,0x69,0x6e,0x3d,0x4d,0x61,0x74,0x68,0x2e,0x61,0x73,
-    0x69,0x6e,0x2c,0x65,0x2e,0x61,0x63,0x6f,0x73,0x3d,0x4d,0x61,0x74,0x68,0x2e,0x61,
-    0x63,0x6f,0x73,0x2c,0x65,0x2e,0x61,0x74,0x61,0x6e,0x3d,0x4d,0x61,0x74,0x68,0x2e,
-    0x61,0x74,0x61,0x6e,0x2c,0x65,0x2e,0x61,0x74,0x61,0x6e,0x32,0x3d,0x4d,0x61,0x74,
-    0x68,0x2e,0x61,0x74,0x61,0x6e,0x32,0x2c,0x65,0x2e,0x73,0x69,0x6e,0x68,0x3d,0x4d,
-    0x61,0x74,0x68,0x2e,0x73,0x69,0x6e,0x68,0x2c,0x65,0x2e,0x63,0x6f,0x73,0x68,0x3d,
-    0x4d,0x61,0x74,0x68,0x2e,0x63,0x6f,0x73,0x68,0x2c,0x65,0x2e,0x74,0x61,0x6e,0x68,
-    0x3d,0x4d,0x61,0x74,0x68,0x2e,0x74,0x61,0x6e,0x68,0x2c,0x65,0x2e,0x61,0x73,0x69,
-    0x6e,0x68,0x3d,0x4d,0x61,0x74,0x68,0x2e,0x61,0x73,0x69,0x6e,0x68,0x2c,0x65,0x2e,
-    0x61,0x63,0x6f,0x73,0x68,0x3d,0x4d,0x61,0x74,0x68,0x2e,0x61,0x63,0x6f,0x73,0x68,
-    0x2c,0x65,0x2e,0x61,0x74,0x61,0x6e,0x68,0x3d,0x4d,0x61,0x74,0x68,0x2e,0x61,0x74,
-    0x61,0x6e,0x68,0x2c,0x65,0x2e,0x61,0x62,0x73,0x3d,0x4d,0x61,0x74,0x68,0x2e,0x61,
-    0x62,0x73,0x2c,0x65,0x2e,0x63,0x65,0x69,0x6c,0x3d,0x4d,0x61,0x74,0x68,0x2e,0x63,
-    0x65,0x69,0x6c,0x2c,0x65,0x2e,0x66,0x6c,0x6f,0x6f,0x72,0x3d,0x4d,0x61,0x74,0x68,
-    0x2e,0x66,0x6c,0x6f,0x6f,0x72,0x2c,0x65,0x2e,0x72,0x6f,0x75,0x6e,0x64,0x3d,0x4d,
-    0x61,0x74,0x68,0x2e,0x72,0x6f,0x75,0x6e,0x64,0x2c,0x65,0x2e,0x74,0x72,0x75,0x6e,
-    0x63,0x3d,0x4d,0x61,0x74,0x68,0x2e,0x74,0x72,0x75,0x6e,0x63,0x2c,0x65,0x2e,0x73,
-    0x69,0x67,0x6e,0x3d,0x4d,0x61,0x74,0x68,0x2e,0x73,0x69,0x67,0x6e,0x2c,0x65,0x2e,
-    0x65,0x78,0x70,0x3d,0x4d,0x61,0x74,0x68,0x2e,0x65,0x78,0x70,0x2c,0x65,0x2e,0x70,
-    0x6f,0x77,0x3d,0x4d,0x61,0x74,0x68,0x2e,0x70,0x6f,0x77,0x2c,0x65,0x2e,0x73,0x71,
-    0x72,0x74,0x3d,0x4d,0x61,0x74,0x68,0x2e,0x73,0x71,0x72,0x74,0x2c,0x65,0x2e,0x65,
-    0x3d,0x4d,0x61,0x74,0x68,0x2e,0x45,0x2c,0x65,0x2e,0x6c,0x6f,0x67,0x3d,0x4d,0x61,
-    0x74,0x68,0x2e,0x6c,0x6f,0x67,0x31,0x30,0x2c,0x65,0x2e,0x6c,0x6f,0x67,0x31,0x30,
-    0x3d,0x4d,0x61,0x74,0x68,0x2e,0x6c,0x6f,0x67,0x31,0x30,0x2c,0x65,0x2e,0x6c,0x6f,
-    0x67,0x32,0x3d,0x4d,0x61,0x74,0x68,0x2e,0x6c,0x6f,0x67,0x32,0x2c,0x65,0x2e,0x6c,
-    0x6e,0x3d,0x4d,0x61,0x74,0x68,0x2e,0x6c,0x6f,0x67,0x2c,0x65,0x2e,0x70,0x69,0x3d,
-    0x4d,0x61,0x74,0x68,0x2e,0x50,0x49,0x2c,0x65,0x2e,0x6d,0x61,0x78,0x3d,0x4d,0x61,
-    0x74,0x68,0x2e,0x6d,0x61,0x78,0x2c,0x65,0x2e,0x6d,0x69,0x6e,0x3d,0x4d,0x61,0x74,
-    0x68,0x2e,0x6d,0x69,0x6e,0x2c,0x65,0x2e,0x72,0x61,0x6e,0x64,0x6f,0x6d,0x3d,0x4d,
-    0x61,0x74,0x68,0x2e,0x72,0x61,0x6e,0x64,0x6f,0x6d,0x7d,0x66,0x75,0x6e,0x63,0x74,
-    0x69,0x6f,0x6e,0x20,0x72,0x65,0x66,0x6f,0x72,0x6d,0x61,0x74,0x50,0x61,0x72,0x73,
-    0x65,0x52,0x65,0x73,0x75,0x6c,0x74,0x28,0x65,0x29,0x7b,0x72,0x65,0x74,0x75,0x72,
-    0x6e,0x20,0x65,0x2e,0x73,0x74,0x61,0x72,0x74,0x73,0x57,0x69,0x74,0x68,0x28,0x22,
-    0x55,0x6e,0x65,0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x20,0x74,0x6f,0x6b,0x65,0x6e,
-    0x20,0x29,0x22,0x29,0x3f,0x22,0x20,0x2d,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,
-    0x69,0x6f,0x6e,0x20,0x69,0x6e,0x63,0x6f,0x6d,0x70,0x6c,0x65,0x74,0x65,0x22,0x3a,
-    0x22,0x20,0x2d,0x20,0x22,0x2b,0x65,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x72,0x69,0x63,0x53,0x65,0x74,0x75,0x70,
-    0x43,0x6f,0x6e,0x74,0x65,0x78,0x74,0x28,0x74,0x2c,0x61,0x29,0x7b,0x69,0x66,0x28,
-    0x65,0x78,0x74,0x72,0x61,0x63,0x74,0x54,0x61,0x62,0x6c,0x65,0x53,0x69,0x7a,0x65,
-    0x28,0x74,0x29,0x2c,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x72,0x69,0x63,0x41,0x64,
-    0x64,0x4d,0x61,0x74,0x68,0x73,0x54,0x6f,0x43,0x6f,0x6e,0x74,0x65,0x78,0x74,0x28,
-    0x74,0x29,0x2c,0x21,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,
-    0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x70,0x61,0x74,
-    0x73,0x65,0x74,0x75,0x70,0x22,0x29,0x29,0x72,0x65,0x74,0x75,0x72,0x6e,0x22,0x22,
-    0x3b,0x76,0x61,0x72,0x20,0x65,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,
-    0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,
-    0x70,0x61,0x74,0x73,0x65,0x74,0x75,0x70,0x22,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,
-    0x2e,0x73,0x70,0x6c,0x69,0x74,0x28,0x2f,0x5b,0x5c,0x72,0x5c,0x6e,0x5d,0x2b,0x2f,
-    0x29,0x2c,0x6e,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,
-    0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x70,0x61,0x74,
-    0x6c,0x6f,0x6f,0x70,0x22,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2e,0x73,0x70,0x6c,
-    0x69,0x74,0x28,0x2f,0x5b,0x5c,0x72,0x5c,0x6e,0x5d,0x2b,0x2f,0x29,0x2c,0x6f,0x3d,
-    0x2f,0x28,0x5b,0x61,0x2d,0x7a,0x41,0x2d,0x5a,0x5f,0x5d,0x5b,0x61,0x2d,0x7a,0x41,
-    0x2d,0x5a,0x30,0x2d,0x39,0x5f,0x5d,0x2a,0x29,0x5c,0x73,0x2a,0x3d,0x5b,0x5e,0x3b,
-    0x3d,0x5d,0x2f,0x3b,0x65,0x78,0x70,0x72,0x4c,0x69,0x73,0x74,0x3d,0x5b,0x65,0x2c,
-    0x6e,0x5d,0x3b,0x6c,0x65,0x74,0x20,0x69,0x3d,0x30,0x2c,0x73,0x3d,0x22,0x22,0x3b,
-    0x74,0x72,0x79,0x7b,0x66,0x6f,0x72,0x28,0x69,0x3d,0x30,0x3b,0x69,0x3c,0x65,0x78,
-    0x70,0x72,0x4c,0x69,0x73,0x74,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x69,0x2b,
-    0x2b,0x29,0x7b,0x76,0x61,0x72,0x20,0x6c,0x3d,0x65,0x78,0x70,0x72,0x4c,0x69,0x73,
-    0x74,0x5b,0x69,0x5d,0x3b,0x66,0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,0x65,0x3d,0x30,
-    0x3b,0x65,0x3c,0x6c,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x65,0x2b,0x2b,0x29,
-    0x7b,0x76,0x61,0x72,0x20,0x72,0x3d,0x6c,0x5b,0x65,0x5d,0x2e,0x6d,0x61,0x74,0x63,
-    0x68,0x28,0x6f,0x29,0x3b,0x6e,0x75,0x6c,0x6c,0x21,0x3d,0x3d,0x72,0x26,0x26,0x31,
-    0x3c,0x72,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x26,0x26,0x28,0x74,0x5b,0x72,0x5b,
-    0x31,0x5d,0x5d,0x3d,0x30,0x2c,0x31,0x3d,0x3d,0x3d,0x69,0x29,0x26,0x26,0x28,0x61,
-    0x5b,0x72,0x5b,0x31,0x5d,0x5d,0x3d,0x30,0x29,0x7d,0x7d,0x7d,0x63,0x61,0x74,0x63,
-    0x68,0x28,0x65,0x29,0x7b,0x73,0x3d,0x22,0x45,0x72,0x72,0x6f,0x72,0x20,0x69,0x6e,
-    0x20,0x22,0x2b,0x28,0x30,0x3d,0x3d,0x3d,0x69,0x3f,0x22,0x53,0x65,0x74,0x75,0x70,
-    0x22,0x3a,0x22,0x4c,0x6f,0x6f,0x70,0x22,0x29,0x2b,0x22,0x20,0x65,0x78,0x70,0x72,
-    0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x6c,0x69,0x6e,0x65,0x20,0x31,0x22,0x2b,0x72,
-    0x65,0x66,0x6f,0x72,0x6d,0x61,0x74,0x50,0x61,0x72,0x73,0x65,0x52,0x65,0x73,0x75,
-    0x6c,0x74,0x28,0x65,0x2e,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x2c,0x63,0x6f,
-    0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x45,0x72,0x72,0x6f,0x72,
-    0x20,0x70,0x72,0x6f,0x63,0x65,0x73,0x73,0x69,0x6e,0x67,0x20,0x73,0x65,0x74,0x75,
-    0x70,0x20,0x22,0x2b,0x65,0x2e,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x7d,0x72,
-    0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x72,0x69,0x63,0x45,0x76,0x61,0x6c,0x53,
-    0x65,0x74,0x75,0x70,0x28,0x65,0x29,0x7b,0x76,0x61,0x72,0x20,0x6e,0x3d,0x64,0x6f,
-    0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,
-    0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x70,0x61,0x74,0x73,0x65,0x74,0x75,0x70,0x22,
-    0x29,0x3b,0x69,0x66,0x28,0x6e,0x29,0x7b,0x76,0x61,0x72,0x20,0x6f,0x3d,0x6e,0x2e,
-    0x76,0x61,0x6c,0x75,0x65,0x2e,0x73,0x70,0x6c,0x69,0x74,0x28,0x2f,0x5b,0x5c,0x72,
-    0x5c,0x6e,0x5d,0x2b,0x2f,0x29,0x3b,0x6c,0x65,0x74,0x20,0x74,0x3d,0x30,0x2c,0x61,
-    0x3d,0x22,0x22,0x3b,0x74,0x72,0x79,0x7b,0x66,0x6f,0x72,0x28,0x74,0x3d,0x30,0x3b,
-    0x74,0x3c,0x6f,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x74,0x2b,0x2b,0x29,0x7b,
-    0x76,0x61,0x72,0x20,0x69,0x3d,0x6f,0x5b,0x74,0x5d,0x2e,0x74,0x72,0x69,0x6d,0x28,
-    0x29,0x3b,0x30,0x3c,0x69,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x26,0x26,0x65,0x76,
-    0x61,0x6c,0x49,0x6e,0x43,0x6f,0x6e,0x74,0x65,0x78,0x74,0x28,0x69,0x2c,0x65,0x29,
-    0x7d,0x7d,0x63,0x61,0x74,0x63,0x68,0x28,0x65,0x29,0x7b,0x61,0x3d,0x22,0x45,0x72,
-    0x72,0x6f,0x72,0x20,0x69,0x6e,0x20,0x53,0x65,0x74,0x75,0x70,0x20,0x65,0x78,0x70,
-    0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x6c,0x69,0x6e,0x65,0x20,0x22,0x2b,0x28,
-    0x74,0x2b,0x31,0x29,0x2b,0x72,0x65,0x66,0x6f,0x72,0x6d,0x61,0x74,0x50,0x61,0x72,
-    0x73,0x65,0x52,0x65,0x73,0x75,0x6c,0x74,0x28,0x65,0x2e,0x6d,0x65,0x73,0x73,0x61,
-    0x67,0x65,0x29,0x2c,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,
-    0x22,0x45,0x72,0x72,0x6f,0x72,0x20,0x65,0x76,0x61,0x6c,0x75,0x61,0x74,0x69,0x6e,
-    0x67,0x20,0x73,0x65,0x74,0x75,0x70,0x20,0x22,0x2b,0x65,0x2e,0x6d,0x65,0x73,0x73,
-    0x61,0x67,0x65,0x29,0x7d,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x7d,0x7d,0x66,
-    0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x72,
-    0x69,0x63,0x45,0x76,0x61,0x6c,0x4c,0x6f,0x6f,0x70,0x28,0x65,0x29,0x7b,0x6c,0x65,
-    0x74,0x20,0x6e,0x3d,0x5b,0x5d,0x3b,0x74,0x72,0x79,0x7b,0x76,0x61,0x72,0x20,0x74,
-    0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,
-    0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x70,0x61,0x74,0x6c,0x6f,0x6f,
-    0x70,0x22,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x6e,0x3d,0x74,0x2e,0x73,0x70,
-    0x6c,0x69,0x74,0x28,0x2f,0x5b,0x5c,0x72,0x5c,0x6e,0x5d,0x2b,0x2f,0x29,0x7d,0x63,
-    0x61,0x74,0x63,0x68,0x28,0x65,0x29,0x7b,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,
-    0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x46,0x61,0x69,0x6c,
-    0x65,0x64,0x20,0x74,0x6f,0x20,0x67,0x65,0x74,0x20,0x70,0x61,0x74,0x6c,0x6f,0x6f,
-    0x70,0x20,0x2d,0x20,0x70,0x72,0x6f,0x62,0x61,0x62,0x6c,0x79,0x20,0x65,0x78,0x69,
-    0x74,0x65,0x64,0x20,0x65,0x64,0x69,0x74,0x20,0x6d,0x6f,0x64,0x65,0x22,0x29,0x2c,
-    0x22,0x4e,0x6f,0x20,0x6c,0x6f,0x6e,0x67,0x65,0x72,0x20,0x69,0x6e,0x20,0x65,0x64,
-    0x69,0x74,0x20,0x6d,0x6f,0x64,0x65,0x22,0x7d,0x69,0x66,0x28,0x30,0x21,0x3d,0x3d,
-    0x6e,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x29,0x7b,0x6c,0x65,0x74,0x20,0x74,0x3d,
-    0x30,0x2c,0x61,0x3d,0x22,0x22,0x3b,0x74,0x72,0x79,0x7b,0x66,0x6f,0x72,0x28,0x74,
-    0x3d,0x30,0x3b,0x74,0x3c,0x6e,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x74,0x2b,
-    0x2b,0x29,0x7b,0x76,0x61,0x72,0x20,0x6f,0x3d,0x6e,0x5b,0x74,0x5d,0x2e,0x74,0x72,
-    0x69,0x6d,0x28,0x29,0x3b,0x30,0x3c,0x6f,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x26,
-    0x26,0x65,0x76,0x61,0x6c,0x49,0x6e,0x43,0x6f,0x6e,0x74,0x65,0x78,0x74,0x28,0x6f,
-    0x2c,0x65,0x29,0x7d,0x7d,0x63,0x61,0x74,0x63,0x68,0x28,0x65,0x29,0x7b,0x61,0x3d,
-    0x22,0x45,0x72,0x72,0x6f,0x72,0x20,0x69,0x6e,0x20,0x4c,0x6f,0x6f,0x70,0x20,0x65,
-    0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x6c,0x69,0x6e,0x65,0x20,0x22,
-    0x2b,0x28,0x74,0x2b,0x31,0x29,0x2b,0x72,0x65,0x66,0x6f,0x72,0x6d,0x61,0x74,0x50,
-    0x61,0x72,0x73,0x65,0x52,0x65,0x73,0x75,0x6c,0x74,0x28,0x65,0x2e,0x6d,0x65,0x73,
-    0x73,0x61,0x67,0x65,0x29,0x2c,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,
-    0x67,0x28,0x22,0x45,0x72,0x72,0x6f,0x72,0x20,0x65,0x76,0x61,0x6c,0x75,0x61,0x74,
-    0x69,0x6e,0x67,0x20,0x22,0x2b,0x65,0x2e,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,
-    0x7d,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x7d,0x7d,0x66,0x75,0x6e,0x63,0x74,
-    0x69,0x6f,0x6e,0x20,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x72,0x69,0x63,0x56,0x61,
-    0x6c,0x69,0x64,0x61,0x74,0x65,0x28,0x29,0x7b,0x76,0x61,0x72,0x20,0x65,0x3d,0x7b,
-    0x7d,0x2c,0x74,0x3d,0x7b,0x7d,0x3b,0x6c,0x65,0x74,0x20,0x61,0x3d,0x70,0x61,0x72,
-    0x61,0x6d,0x65,0x74,0x72,0x69,0x63,0x53,0x65,0x74,0x75,0x70,0x43,0x6f,0x6e,0x74,
-    0x65,0x78,0x74,0x28,0x65,0x2c,0x74,0x29,0x3b,0x30,0x3c,0x61,0x2e,0x6c,0x65,0x6e,
-    0x67,0x74,0x68,0x7c,0x7c,0x30,0x3c,0x28,0x61,0x3d,0x70,0x61,0x72,0x61,0x6d,0x65,
-    0x74,0x72,0x69,0x63,0x45,0x76,0x61,0x6c,0x53,0x65,0x74,0x75,0x70,0x28,0x65,0x29,
-    0x29,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3f,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,
-    0x72,0x69,0x63,0x53,0x68,0x6f,0x77,0x56,0x61,0x6c,0x69,0x64,0x69,0x74,0x79,0x28,
-    0x61,0x2c,0x21,0x30,0x29,0x3a,0x28,0x74,0x2e,0x68,0x61,0x73,0x4f,0x77,0x6e,0x50,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,0x22,0x78,0x22,0x29,0x7c,0x7c,0x28,0x61,
-    0x2b,0x3d,0x22,0x78,0x22,0x29,0x2c,0x74,0x2e,0x68,0x61,0x73,0x4f,0x77,0x6e,0x50,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,0x22,0x79,0x22,0x29,0x7c,0x7c,0x28,0x61,
-    0x2b,0x3d,0x28,0x30,0x3c,0x61,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3f,0x22,0x2c,
-    0x20,0x22,0x3a,0x22,0x22,0x29,0x2b,0x22,0x79,0x22,0x29,0x2c,0x74,0x2e,0x68,0x61,
-    0x73,0x4f,0x77,0x6e,0x50,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,0x22,0x73,0x74,
-    0x6f,0x70,0x22,0x29,0x7c,0x7c,0x28,0x61,0x2b,0x3d,0x28,0x30,0x3c,0x61,0x2e,0x6c,
-    0x65,0x6e,0x67,0x74,0x68,0x3f,0x22,0x20,0x61,0x6e,0x64,0x20,0x22,0x3a,0x22,0x22,
-    0x29,0x2b,0x22,0x73,0x74,0x6f,0x70,0x22,0x29,0x2c,0x30,0x3c,0x61,0x2e,0x6c,0x65,
-    0x6e,0x67,0x74,0x68,0x3f,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x72,0x69,0x63,0x53,
-    0x68,0x6f,0x77,0x56,0x61,0x6c,0x69,0x64,0x69,0x74,0x79,0x28,0x61,0x3d,0x22,0x4c,
-    0x6f,0x6f,0x70,0x20,0x6d,0x75,0x73,0x74,0x20,0x73,0x65,0x74,0x20,0x76,0x61,0x72,
-    0x69,0x61,0x62,0x6c,0x65,0x28,0x73,0x29,0x20,0x22,0x2b,0x61,0x2c,0x21,0x30,0x29,
-    0x3a,0x30,0x3c,0x28,0x61,0x3d,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x72,0x69,0x63,
-    0x45,0x76,0x61,0x6c,0x4c,0x6f,0x6f,0x70,0x28,0x65,0x29,0x29,0x2e,0x6c,0x65,0x6e,
-    0x67,0x74,0x68,0x3f,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x72,0x69,0x63,0x53,0x68,
-    0x6f,0x77,0x56,0x61,0x6c,0x69,0x64,0x69,0x74,0x79,0x28,0x61,0x2c,0x21,0x30,0x29,
-    0x3a,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x72,0x69,0x63,0x53,0x68,0x6f,0x77,0x56,
-    0x61,0x6c,0x69,0x64,0x69,0x74,0x79,0x28,0x22,0x50,0x61,0x73,0x73,0x65,0x64,0x22,
-    0x2c,0x21,0x31,0x29,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x70,
-    0x61,0x74,0x74,0x65,0x72,0x6e,0x56,0x61,0x6c,0x69,0x64,0x61,0x74,0x65,0x28,0x29,
-    0x7b,0x69,0x66,0x28,0x22,0x73,0x65,0x71,0x22,0x21,0x3d,0x3d,0x77,0x69,0x6e,0x64,
-    0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x46,0x69,
-    0x6c,0x65,0x54,0x79,0x70,0x65,0x29,0x7b,0x22,0x70,0x61,0x72,0x61,0x6d,0x22,0x3d,
-    0x3d,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,
-    0x2e,0x63,0x75,0x72,0x46,0x69,0x6c,0x65,0x54,0x79,0x70,0x65,0x26,0x26,0x70,0x61,
-    0x72,0x61,0x6d,0x65,0x74,0x72,0x69,0x63,0x56,0x61,0x6c,0x69,0x64,0x61,0x74,0x65,
-    0x28,0x29,0x3b,0x74,0x72,0x79,0x7b,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,
-    0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,
-    0x61,0x75,0x74,0x6f,0x2d,0x65,0x76,0x61,0x6c,0x75,0x61,0x74,0x65,0x22,0x29,0x2e,
-    0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x26,0x26,0x70,0x61,0x74,0x74,0x65,0x72,0x6e,
-    0x53,0x69,0x6d,0x75,0x6c,0x61,0x74,0x65,0x28,0x29,0x7d,0x63,0x61,0x74,0x63,0x68,
-    0x28,0x65,0x29,0x7b,0x7d,0x7d,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,
-    0x66,0x69,0x6c,0x65,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x43,0x68,0x61,0x6e,0x67,
-    0x65,0x28,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,
-    0x22,0x70,0x61,0x74,0x73,0x65,0x74,0x75,0x70,0x63,0x68,0x61,0x6e,0x67,0x65,0x22,
-    0x29,0x2c,0x70,0x61,0x74,0x74,0x65,0x72,0x6e,0x56,0x61,0x6c,0x69,0x64,0x61,0x74,
-    0x65,0x28,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x70,0x61,0x74,
-    0x53,0x65,0x74,0x75,0x70,0x43,0x68,0x61,0x6e,0x67,0x65,0x28,0x29,0x7b,0x63,0x6f,
-    0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x70,0x61,0x74,0x73,0x65,
-    0x74,0x75,0x70,0x63,0x68,0x61,0x6e,0x67,0x65,0x22,0x29,0x2c,0x70,0x61,0x74,0x74,
-    0x65,0x72,0x6e,0x56,0x61,0x6c,0x69,0x64,0x61,0x74,0x65,0x28,0x29,0x7d,0x66,0x75,
-    0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x70,0x61,0x74,0x4c,0x6f,0x6f,0x70,0x43,0x68,
-    0x61,0x6e,0x67,0x65,0x28,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,
-    0x6f,0x67,0x28,0x22,0x70,0x61,0x74,0x6c,0x6f,0x6f,0x70,0x63,0x68,0x61,0x6e,0x67,
-    0x65,0x22,0x29,0x2c,0x70,0x61,0x74,0x74,0x65,0x72,0x6e,0x56,0x61,0x6c,0x69,0x64,
-    0x61,0x74,0x65,0x28,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x61,
-    0x75,0x74,0x6f,0x45,0x76,0x61,0x6c,0x43,0x6c,0x69,0x63,0x6b,0x65,0x64,0x28,0x29,
-    0x7b,0x70,0x61,0x74,0x74,0x65,0x72,0x6e,0x56,0x61,0x6c,0x69,0x64,0x61,0x74,0x65,
-    0x28,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x70,0x61,0x74,0x74,
-    0x65,0x72,0x6e,0x53,0x69,0x6d,0x75,0x6c,0x61,0x74,0x65,0x28,0x29,0x7b,0x22,0x70,
-    0x61,0x72,0x61,0x6d,0x22,0x3d,0x3d,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,
-    0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x46,0x69,0x6c,0x65,0x54,0x79,
-    0x70,0x65,0x3f,0x70,0x61,0x72,0x61,0x6d,0x53,0x69,0x6d,0x75,0x6c,0x61,0x74,0x65,
-    0x28,0x29,0x3a,0x22,0x67,0x63,0x6f,0x64,0x65,0x22,0x21,0x3d,0x3d,0x77,0x69,0x6e,
-    0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x46,
-    0x69,0x6c,0x65,0x54,0x79,0x70,0x65,0x26,0x26,0x22,0x74,0x68,0x72,0x22,0x21,0x3d,
-    0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,
-    0x63,0x75,0x72,0x46,0x69,0x6c,0x65,0x54,0x79,0x70,0x65,0x7c,0x7c,0x74,0x65,0x78,
-    0x74,0x46,0x69,0x6c,0x65,0x53,0x69,0x6d,0x75,0x6c,0x61,0x74,0x65,0x28,0x29,0x7d,
-    0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x70,0x61,0x72,0x61,0x6d,0x53,0x69,
-    0x6d,0x75,0x6c,0x61,0x74,0x65,0x28,0x29,0x7b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,
-    0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x72,
-    0x69,0x63,0x43,0x6f,0x6e,0x74,0x65,0x78,0x74,0x3d,0x7b,0x7d,0x3b,0x76,0x61,0x72,
-    0x20,0x65,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,
-    0x65,0x2e,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x72,0x69,0x63,0x43,0x6f,0x6e,0x74,
-    0x65,0x78,0x74,0x2c,0x74,0x3d,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x72,0x69,0x63,
-    0x53,0x65,0x74,0x75,0x70,0x43,0x6f,0x6e,0x74,0x65,0x78,0x74,0x28,0x65,0x2c,0x7b,
-    0x7d,0x29,0x3b,0x30,0x3c,0x74,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x7c,0x7c,0x65,
-    0x2e,0x68,0x61,0x73,0x4f,0x77,0x6e,0x50,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,
-    0x22,0x78,0x22,0x29,0x26,0x26,0x65,0x2e,0x68,0x61,0x73,0x4f,0x77,0x6e,0x50,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x28,0x22,0x79,0x22,0x29,0x26,0x26,0x65,0x2e,0x68,
-    0x61,0x73,0x4f,0x77,0x6e,0x50,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,0x22,0x73,
-    0x74,0x6f,0x70,0x22,0x29,0x26,0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x72,
-    0x69,0x63,0x45,0x76,0x61,0x6c,0x53,0x65,0x74,0x75,0x70,0x28,0x65,0x2c,0x74,0x29,
-    0x2c,0x30,0x3c,0x74,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x7c,0x7c,0x28,0x77,0x69,
-    0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x69,0x6e,0x74,
-    0x65,0x72,0x70,0x49,0x74,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3d,0x30,0x2c,0x74,
-    0x61,0x62,0x6c,0x65,0x53,0x68,0x6f,0x77,0x53,0x74,0x61,0x72,0x74,0x28,0x65,0x29,
-    0x2c,0x70,0x61,0x72,0x61,0x6d,0x53,0x74,0x65,0x70,0x28,0x29,0x29,0x29,0x7d,0x66,
-    0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x70,0x61,0x72,0x61,0x6d,0x53,0x74,0x65,
-    0x70,0x28,0x29,0x7b,0x76,0x61,0x72,0x20,0x74,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,
-    0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,
-    0x72,0x69,0x63,0x43,0x6f,0x6e,0x74,0x65,0x78,0x74,0x3b,0x66,0x6f,0x72,0x28,0x6c,
-    0x65,0x74,0x20,0x65,0x3d,0x30,0x3b,0x65,0x3c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,
-    0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x6d,0x61,0x78,0x49,0x74,0x65,0x72,0x61,
-    0x74,0x69,0x6f,0x6e,0x73,0x49,0x6e,0x45,0x76,0x61,0x6c,0x3b,0x65,0x2b,0x2b,0x29,
-    0x7b,0x69,0x66,0x28,0x30,0x3c,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x72,0x69,0x63,
-    0x45,0x76,0x61,0x6c,0x4c,0x6f,0x6f,0x70,0x28,0x74,0x29,0x2e,0x6c,0x65,0x6e,0x67,
-    0x74,0x68,0x29,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x69,0x66,0x28,0x74,0x61,0x62,
-    0x6c,0x65,0x53,0x68,0x6f,0x77,0x4e,0x65,0x78,0x74,0x50,0x6f,0x69,0x6e,0x74,0x28,
-    0x74,0x29,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,
-    0x65,0x2e,0x69,0x6e,0x74,0x65,0x72,0x70,0x49,0x74,0x65,0x72,0x61,0x74,0x69,0x6f,
-    0x6e,0x2b,0x2b,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,
-    0x74,0x65,0x2e,0x69,0x6e,0x74,0x65,0x72,0x70,0x49,0x74,0x65,0x72,0x61,0x74,0x69,
-    0x6f,0x6e,0x3e,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,
-    0x74,0x65,0x2e,0x6d,0x61,0x78,0x49,0x74,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x73,
-    0x49,0x6e,0x54,0x6f,0x74,0x61,0x6c,0x29,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x69,
-    0x66,0x28,0x74,0x2e,0x73,0x74,0x6f,0x70,0x29,0x72,0x65,0x74,0x75,0x72,0x6e,0x7d,
-    0x73,0x65,0x74,0x54,0x69,0x6d,0x65,0x6f,0x75,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,
-    0x53,0x74,0x65,0x70,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,
-    0x61,0x74,0x65,0x2e,0x70,0x61,0x74,0x74,0x65,0x72,0x6e,0x45,0x76,0x61,0x6c,0x49,
-    0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x4d,0x73,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,
-    0x69,0x6f,0x6e,0x20,0x67,0x63,0x6f,0x64,0x65,0x45,0x76,0x61,0x6c,0x53,0x65,0x72,
-    0x76,0x69,0x63,0x65,0x28,0x74,0x29,0x7b,0x69,0x66,0x28,0x74,0x2e,0x6c,0x69,0x6e,
-    0x65,0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3c,0x3d,0x74,0x2e,0x6c,0x69,0x6e,
-    0x65,0x49,0x64,0x78,0x29,0x72,0x65,0x74,0x75,0x72,0x6e,0x22,0x64,0x6f,0x6e,0x65,
-    0x22,0x3b,0x76,0x61,0x72,0x20,0x61,0x2c,0x65,0x3d,0x74,0x2e,0x6c,0x69,0x6e,0x65,
-    0x73,0x5b,0x74,0x2e,0x6c,0x69,0x6e,0x65,0x49,0x64,0x78,0x5d,0x2c,0x6e,0x3d,0x28,
-    0x74,0x2e,0x6c,0x69,0x6e,0x65,0x49,0x64,0x78,0x2b,0x2b,0x2c,0x65,0x2e,0x73,0x70,
-    0x6c,0x69,0x74,0x28,0x22,0x20,0x22,0x29,0x29,0x3b,0x69,0x66,0x28,0x21,0x6e,0x5b,
-    0x30,0x5d,0x2e,0x74,0x6f,0x4c,0x6f,0x77,0x65,0x72,0x43,0x61,0x73,0x65,0x28,0x29,
-    0x2e,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x73,0x28,0x22,0x67,0x30,0x22,0x29,0x26,
-    0x26,0x21,0x6e,0x5b,0x30,0x5d,0x2e,0x74,0x6f,0x4c,0x6f,0x77,0x65,0x72,0x43,0x61,
-    0x73,0x65,0x28,0x29,0x2e,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x73,0x28,0x22,0x67,
-    0x31,0x22,0x29,0x29,0x72,0x65,0x74,0x75,0x72,0x6e,0x22,0x69,0x67,0x6e,0x6f,0x72,
-    0x65,0x22,0x3b,0x69,0x66,0x28,0x6e,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3c,0x33,
-    0x29,0x72,0x65,0x74,0x75,0x72,0x6e,0x22,0x69,0x67,0x6e,0x6f,0x72,0x65,0x22,0x3b,
-    0x6c,0x65,0x74,0x20,0x6f,0x3d,0x21,0x31,0x2c,0x69,0x3d,0x21,0x31,0x3b,0x66,0x6f,
-    0x72,0x28,0x6c,0x65,0x74,0x20,0x65,0x3d,0x31,0x3b,0x65,0x3c,0x6e,0x2e,0x6c,0x65,
-    0x6e,0x67,0x74,0x68,0x3b,0x65,0x2b,0x2b,0x29,0x6e,0x5b,0x65,0x5d,0x2e,0x74,0x72,
-    0x69,0x6d,0x28,0x29,0x2e,0x74,0x6f,0x4c,0x6f,0x77,0x65,0x72,0x43,0x61,0x73,0x65,
-    0x28,0x29,0x2e,0x73,0x74,0x61,0x72,0x74,0x73,0x57,0x69,0x74,0x68,0x28,0x22,0x78,
-    0x22,0x29,0x26,0x26,0x28,0x61,0x3d,0x70,0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,
-    0x74,0x28,0x6e,0x5b,0x65,0x5d,0x2e,0x74,0x72,0x69,0x6d,0x28,0x29,0x2e,0x73,0x75,
-    0x62,0x73,0x74,0x72,0x28,0x31,0x29,0x29,0x2c,0x69,0x73,0x4e,0x61,0x4e,0x28,0x61,
-    0x29,0x7c,0x7c,0x28,0x6f,0x3d,0x21,0x30,0x2c,0x74,0x2e,0x78,0x3d,0x61,0x29,0x29,
-    0x2c,0x6e,0x5b,0x65,0x5d,0x2e,0x74,0x72,0x69,0x6d,0x28,0x29,0x2e,0x74,0x6f,0x4c,
-    0x6f,0x77,0x65,0x72,0x43,0x61,0x73,0x65,0x28,0x29,0x2e,0x73,0x74,0x61,0x72,0x74,
-    0x73,0x57,0x69,0x74,0x68,0x28,0x22,0x79,0x22,0x29,0x26,0x26,0x28,0x61,0x3d,0x70,
-    0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,0x74,0x28,0x6e,0x5b,0x65,0x5d,0x2e,0x74,
-    0x72,0x69,0x6d,0x28,0x29,0x2e,0x73,0x75,0x62,0x73,0x74,0x72,0x28,0x31,0x29,0x29,
-    0x2c,0x69,0x73,0x4e,0x61,0x4e,0x28,0x61,0x29,0x7c,0x7c,0x28,0x69,0x3d,0x21,0x30,
-    0x2c,0x74,0x2e,0x79,0x3d,0x61,0x29,0x29,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
-    0x6f,0x26,0x26,0x69,0x3f,0x22,0x22,0x3a,0x22,0x69,0x6e,0x76,0x61,0x6c,0x69,0x64,
-    0x22,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x74,0x68,0x72,0x50,0x72,
-    0x6f,0x63,0x50,0x6f,0x69,0x6e,0x74,0x28,0x65,0x2c,0x74,0x29,0x7b,0x69,0x66,0x28,
-    0x65,0x2e,0x69,0x6e,0x74,0x65,0x72,0x70,0x6f,0x6c,0x61,0x74,0x65,0x49,0x64,0x78,
-    0x3d,0x30,0x2c,0x21,0x65,0x2e,0x68,0x61,0x73,0x4f,0x77,0x6e,0x50,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x28,0x22,0x6e,0x65,0x78,0x74,0x50,0x6f,0x69,0x6e,0x74,0x22,
-    0x29,0x29,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x65,0x2e,0x6e,0x65,0x78,0x74,0x50,
-    0x6f,0x69,0x6e,0x74,0x3d,0x74,0x2c,0x22,0x69,0x67,0x6e,0x6f,0x72,0x65,0x22,0x3b,
-    0x65,0x2e,0x70,0x72,0x65,0x76,0x50,0x6f,0x69,0x6e,0x74,0x3d,0x65,0x2e,0x6e,0x65,
-    0x78,0x74,0x50,0x6f,0x69,0x6e,0x74,0x2c,0x65,0x2e,0x6e,0x65,0x78,0x74,0x50,0x6f,
-    0x69,0x6e,0x74,0x3d,0x74,0x2c,0x65,0x2e,0x64,0x65,0x6c,0x74,0x61,0x54,0x68,0x65,
-    0x74,0x61,0x3d,0x65,0x2e,0x6e,0x65,0x78,0x74,0x50,0x6f,0x69,0x6e,0x74,0x5b,0x30,
-    0x5d,0x2d,0x65,0x2e,0x70,0x72,0x65,0x76,0x50,0x6f,0x69,0x6e,0x74,0x5b,0x30,0x5d,
-    0x2c,0x65,0x2e,0x74,0x68,0x65,0x74,0x61,0x49,0x6e,0x63,0x3d,0x30,0x3c,0x3d,0x65,
-    0x2e,0x64,0x65,0x6c,0x74,0x61,0x54,0x68,0x65,0x74,0x61,0x3f,0x77,0x69,0x6e,0x64,
-    0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x74,0x68,0x72,0x4d,0x61,
-    0x78,0x54,0x68,0x65,0x74,0x61,0x49,0x6e,0x63,0x3a,0x2d,0x77,0x69,0x6e,0x64,0x6f,
-    0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x74,0x68,0x72,0x4d,0x61,0x78,
-    0x54,0x68,0x65,0x74,0x61,0x49,0x6e,0x63,0x3b,0x74,0x3d,0x65,0x2e,0x6e,0x65,0x78,
-    0x74,0x50,0x6f,0x69,0x6e,0x74,0x5b,0x31,0x5d,0x2d,0x65,0x2e,0x70,0x72,0x65,0x76,
-    0x50,0x6f,0x69,0x6e,0x74,0x5b,0x31,0x5d,0x3b,0x69,0x66,0x28,0x4d,0x61,0x74,0x68,
-    0x2e,0x61,0x62,0x73,0x28,0x65,0x2e,0x64,0x65,0x6c,0x74,0x61,0x54,0x68,0x65,0x74,
-    0x61,0x29,0x3c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,
-    0x65,0x2e,0x74,0x68,0x72,0x4d,0x61,0x78,0x54,0x68,0x65,0x74,0x61,0x49,0x6e,0x63,
-    0x29,0x65,0x2e,0x74,0x68,0x65,0x74,0x61,0x49,0x6e,0x63,0x3d,0x65,0x2e,0x64,0x65,
-    0x6c,0x74,0x61,0x54,0x68,0x65,0x74,0x61,0x2c,0x65,0x2e,0x69,0x6e,0x74,0x65,0x72,
-    0x70,0x6f,0x6c,0x61,0x74,0x65,0x53,0x74,0x65,0x70,0x73,0x3d,0x31,0x2c,0x65,0x2e,
-    0x72,0x68,0x6f,0x49,0x6e,0x63,0x3d,0x74,0x3b,0x65,0x6c,0x73,0x65,0x7b,0x69,0x66,
-    0x28,0x65,0x2e,0x69,0x6e,0x74,0x65,0x72,0x70,0x6f,0x6c,0x61,0x74,0x65,0x53,0x74,
-    0x65,0x70,0x73,0x3d,0x4d,0x61,0x74,0x68,0x2e,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x4d,
-    0x61,0x74,0x68,0x2e,0x61,0x62,0x73,0x28,0x65,0x2e,0x64,0x65,0x6c,0x74,0x61,0x54,
-    0x68,0x65,0x74,0x61,0x29,0x2f,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,
-    0x74,0x61,0x74,0x65,0x2e,0x74,0x68,0x72,0x4d,0x61,0x78,0x54,0x68,0x65,0x74,0x61,
-    0x49,0x6e,0x63,0x29,0x2c,0x65,0x2e,0x69,0x6e,0x74,0x65,0x72,0x70,0x6f,0x6c,0x61,
-    0x74,0x65,0x53,0x74,0x65,0x70,0x73,0x3c,0x31,0x29,0x72,0x65,0x74,0x75,0x72,0x6e,
-    0x22,0x69,0x67,0x6e,0x6f,0x72,0x65,0x22,0x3b,0x65,0x2e,0x72,0x68,0x6f,0x49,0x6e,
-    0x63,0x3d,0x74,0x2a,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,
-    0x74,0x65,0x2e,0x74,0x68,0x72,0x4d,0x61,0x78,0x54,0x68,0x65,0x74,0x61,0x49,0x6e,
-    0x63,0x2f,0x4d,0x61,0x74,0x68,0x2e,0x61,0x62,0x73,0x28,0x65,0x2e,0x64,0x65,0x6c,
-    0x74,0x61,0x54,0x68,0x65,0x74,0x61,0x29,0x7d,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
-    0x65,0x2e,0x63,0x75,0x72,0x54,0x68,0x65,0x74,0x61,0x3d,0x65,0x2e,0x70,0x72,0x65,
-    0x76,0x50,0x6f,0x69,0x6e,0x74,0x5b,0x30,0x5d,0x2c,0x65,0x2e,0x63,0x75,0x72,0x52,
-    0x68,0x6f,0x3d,0x65,0x2e,0x70,0x72,0x65,0x76,0x50,0x6f,0x69,0x6e,0x74,0x5b,0x31,
-    0x5d,0x2c,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x54,
-    0x68,0x65,0x74,0x61,0x20,0x22,0x2b,0x66,0x6f,0x72,0x6d,0x61,0x74,0x46,0x50,0x28,
-    0x65,0x2e,0x6e,0x65,0x78,0x74,0x50,0x6f,0x69,0x6e,0x74,0x5b,0x30,0x5d,0x2c,0x36,
-    0x29,0x2b,0x22,0x20,0x52,0x68,0x6f,0x20,0x22,0x2b,0x66,0x6f,0x72,0x6d,0x61,0x74,
-    0x46,0x50,0x28,0x65,0x2e,0x6e,0x65,0x78,0x74,0x50,0x6f,0x69,0x6e,0x74,0x5b,0x31,
-    0x5d,0x2c,0x36,0x29,0x2b,0x22,0x20,0x43,0x75,0x72,0x54,0x68,0x65,0x74,0x61,0x20,
-    0x22,0x2b,0x66,0x6f,0x72,0x6d,0x61,0x74,0x46,0x50,0x28,0x65,0x2e,0x63,0x75,0x72,
-    0x54,0x68,0x65,0x74,0x61,0x2c,0x36,0x29,0x2b,0x22,0x20,0x43,0x75,0x72,0x52,0x68,
-    0x6f,0x20,0x22,0x2b,0x66,0x6f,0x72,0x6d,0x61,0x74,0x46,0x50,0x28,0x65,0x2e,0x63,
-    0x75,0x72,0x52,0x68,0x6f,0x2c,0x36,0x29,0x2b,0x22,0x20,0x54,0x6f,0x74,0x61,0x6c,
-    0x53,0x74,0x65,0x70,0x73,0x20,0x22,0x2b,0x65,0x2e,0x69,0x6e,0x74,0x65,0x72,0x70,
-    0x6f,0x6c,0x61,0x74,0x65,0x53,0x74,0x65,0x70,0x73,0x2b,0x22,0x20,0x54,0x68,0x65,
-    0x74,0x61,0x49,0x6e,0x63,0x20,0x22,0x2b,0x66,0x6f,0x72,0x6d,0x61,0x74,0x46,0x50,
-    0x28,0x65,0x2e,0x74,0x68,0x65,0x74,0x61,0x49,0x6e,0x63,0x2c,0x36,0x29,0x2b,0x22,
-    0x20,0x52,0x68,0x6f,0x49,0x6e,0x63,0x20,0x22,0x2b,0x66,0x6f,0x72,0x6d,0x61,0x74,
-    0x46,0x50,0x28,0x65,0x2e,0x72,0x68,0x6f,0x49,0x6e,0x63,0x2c,0x36,0x29,0x2b,0x22,
-    0x20,0x41,0x62,0x73,0x44,0x65,0x6c,0x74,0x61,0x54,0x68,0x65,0x74,0x61,0x20,0x22,
-    0x2b,0x66,0x6f,0x72,0x6d,0x61,0x74,0x46,0x50,0x28,0x4d,0x61,0x74,0x68,0x2e,0x61,
-    0x62,0x73,0x28,0x65,0x2e,0x64,0x65,0x6c,0x74,0x61,0x54,0x68,0x65,0x74,0x61,0x29,
-    0x2c,0x36,0x29,0x2b,0x22,0x20,0x53,0x74,0x65,0x70,0x41,0x6e,0x67,0x20,0x22,0x2b,
-    0x66,0x6f,0x72,0x6d,0x61,0x74,0x46,0x50,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,
-    0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x74,0x68,0x72,0x4d,0x61,0x78,0x54,0x68,
-    0x65,0x74,0x61,0x49,0x6e,0x63,0x2c,0x36,0x29,0x29,0x2c,0x74,0x68,0x72,0x50,0x72,
-    0x6f,0x63,0x49,0x6e,0x74,0x65,0x72,0x70,0x28,0x65,0x29,0x3f,0x22,0x22,0x3a,0x22,
-    0x69,0x67,0x6e,0x6f,0x72,0x65,0x22,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
-    0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,0x46,0x50,0x28,0x65,0x2c,0x74,0x29,0x7b,0x76,
-    0x61,0x72,0x20,0x61,0x3d,0x4d,0x61,0x74,0x68,0x2e,0x70,0x6f,0x77,0x28,0x31,0x30,
-    0x2c,0x74,0x29,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x70,0x61,0x72,0x73,0x65,
-    0x46,0x6c,0x6f,0x61,0x74,0x28,0x65,0x2a,0x61,0x2f,0x61,0x29,0x2e,0x74,0x6f,0x46,
-    0x69,0x78,0x65,0x64,0x28,0x74,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
-    0x20,0x74,0x68,0x72,0x50,0x72,0x6f,0x63,0x49,0x6e,0x74,0x65,0x72,0x70,0x28,0x65,
-    0x29,0x7b,0x72,0x65,0x74,0x75,0x72,0x6e,0x21,0x28,0x65,0x2e,0x69,0x6e,0x74,0x65,
-    0x72,0x70,0x6f,0x6c,0x61,0x74,0x65,0x49,0x64,0x78,0x3e,0x3d,0x65,0x2e,0x69,0x6e,
-    0x74,0x65,0x72,0x70,0x6f,0x6c,0x61,0x74,0x65,0x53,0x74,0x65,0x70,0x73,0x7c,0x7c,
-    0x28,0x65,0x2e,0x69,0x6e,0x74,0x65,0x72,0x70,0x6f,0x6c,0x61,0x74,0x65,0x49,0x64,
-    0x78,0x2b,0x2b,0x2c,0x65,0x2e,0x78,0x3d,0x65,0x2e,0x73,0x69,0x7a,0x65,0x58,0x2f,
-    0x32,0x2a,0x65,0x2e,0x63,0x75,0x72,0x52,0x68,0x6f,0x2a,0x4d,0x61,0x74,0x68,0x2e,
-    0x73,0x69,0x6e,0x28,0x65,0x2e,0x63,0x75,0x72,0x54,0x68,0x65,0x74,0x61,0x29,0x2c,
-    0x65,0x2e,0x79,0x3d,0x65,0x2e,0x73,0x69,0x7a,0x65,0x59,0x2f,0x32,0x2a,0x65,0x2e,
-    0x63,0x75,0x72,0x52,0x68,0x6f,0x2a,0x4d,0x61,0x74,0x68,0x2e,0x63,0x6f,0x73,0x28,
-    0x65,0x2e,0x63,0x75,0x72,0x54,0x68,0x65,0x74,0x61,0x29,0x2c,0x65,0x2e,0x63,0x75,
-    0x72,0x52,0x68,0x6f,0x2b,0x3d,0x65,0x2e,0x72,0x68,0x6f,0x49,0x6e,0x63,0x2c,0x65,
-    0x2e,0x63,0x75,0x72,0x54,0x68,0x65,0x74,0x61,0x2b,0x3d,0x65,0x2e,0x74,0x68,0x65,
-    0x74,0x61,0x49,0x6e,0x63,0x2c,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,
-    0x67,0x28,0x22,0x47,0x30,0x20,0x55,0x22,0x2b,0x66,0x6f,0x72,0x6d,0x61,0x74,0x46,
-    0x50,0x28,0x4d,0x61,0x74,0x68,0x2e,0x72,0x6f,0x75,0x6e,0x64,0x28,0x65,0x2e,0x63,
-    0x75,0x72,0x54,0x68,0x65,0x74,0x61,0x29,0x2c,0x36,0x29,0x2b,0x22,0x20,0x56,0x22,
-    0x2b,0x66,0x6f,0x72,0x6d,0x61,0x74,0x46,0x50,0x28,0x4d,0x61,0x74,0x68,0x2e,0x72,
-    0x6f,0x75,0x6e,0x64,0x28,0x65,0x2e,0x63,0x75,0x72,0x52,0x68,0x6f,0x29,0x2c,0x36,
-    0x29,0x29,0x2c,0x30,0x29,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,
-    0x74,0x68,0x72,0x45,0x76,0x61,0x6c,0x53,0x65,0x72,0x76,0x69,0x63,0x65,0x28,0x65,
-    0x29,0x7b,0x76,0x61,0x72,0x20,0x74,0x2c,0x61,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,
-    0x20,0x30,0x21,0x3d,0x65,0x2e,0x69,0x6e,0x74,0x65,0x72,0x70,0x6f,0x6c,0x61,0x74,
-    0x65,0x49,0x64,0x78,0x26,0x26,0x74,0x68,0x72,0x50,0x72,0x6f,0x63,0x49,0x6e,0x74,
-    0x65,0x72,0x70,0x28,0x65,0x29,0x3f,0x22,0x22,0x3a,0x65,0x2e,0x6c,0x69,0x6e,0x65,
-    0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3c,0x3d,0x65,0x2e,0x6c,0x69,0x6e,0x65,
-    0x49,0x64,0x78,0x3f,0x22,0x64,0x6f,0x6e,0x65,0x22,0x3a,0x28,0x61,0x3d,0x65,0x2e,
-    0x6c,0x69,0x6e,0x65,0x73,0x5b,0x65,0x2e,0x6c,0x69,0x6e,0x65,0x49,0x64,0x78,0x5d,
-    0x2c,0x65,0x2e,0x6c,0x69,0x6e,0x65,0x49,0x64,0x78,0x2b,0x2b,0x2c,0x61,0x2e,0x69,
-    0x6e,0x63,0x6c,0x75,0x64,0x65,0x73,0x28,0x22,0x23,0x22,0x29,0x7c,0x7c,0x28,0x61,
-    0x3d,0x61,0x2e,0x73,0x70,0x6c,0x69,0x74,0x28,0x22,0x20,0x22,0x29,0x29,0x2e,0x6c,
-    0x65,0x6e,0x67,0x74,0x68,0x3c,0x32,0x7c,0x7c,0x28,0x74,0x3d,0x70,0x61,0x72,0x73,
-    0x65,0x46,0x6c,0x6f,0x61,0x74,0x28,0x61,0x5b,0x30,0x5d,0x29,0x2c,0x61,0x3d,0x70,
-    0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,0x74,0x28,0x61,0x5b,0x31,0x5d,0x29,0x2c,
-    0x69,0x73,0x4e,0x61,0x4e,0x28,0x74,0x29,0x29,0x7c,0x7c,0x69,0x73,0x4e,0x61,0x4e,
-    0x28,0x61,0x29,0x3f,0x22,0x69,0x67,0x6e,0x6f,0x72,0x65,0x22,0x3a,0x74,0x68,0x72,
-    0x50,0x72,0x6f,0x63,0x50,0x6f,0x69,0x6e,0x74,0x28,0x65,0x2c,0x5b,0x74,0x2c,0x61,
-    0x5d,0x29,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x74,0x65,0x78,
-    0x74,0x46,0x69,0x6c,0x65,0x53,0x69,0x6d,0x75,0x6c,0x61,0x74,0x65,0x28,0x29,0x7b,
-    0x6c,0x65,0x74,0x20,0x65,0x3d,0x5b,0x5d,0x3b,0x74,0x72,0x79,0x7b,0x76,0x61,0x72,
-    0x20,0x74,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,
-    0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x74,0x65,0x78,0x74,
-    0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x73,0x22,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,
-    0x3b,0x30,0x3c,0x74,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x26,0x26,0x28,0x65,0x3d,
-    0x74,0x2e,0x73,0x70,0x6c,0x69,0x74,0x28,0x2f,0x5b,0x5c,0x72,0x5c,0x6e,0x5d,0x2b,
-    0x2f,0x29,0x29,0x7d,0x63,0x61,0x74,0x63,0x68,0x28,0x65,0x29,0x7b,0x72,0x65,0x74,
-    0x75,0x72,0x6e,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,
-    0x22,0x46,0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,0x20,0x67,0x65,0x74,0x20,0x74,
-    0x65,0x78,0x74,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x73,0x20,0x2d,0x20,0x70,0x72,
-    0x6f,0x62,0x61,0x62,0x6c,0x79,0x20,0x65,0x78,0x69,0x74,0x65,0x64,0x20,0x65,0x64,
-    0x69,0x74,0x20,0x6d,0x6f,0x64,0x65,0x22,0x29,0x2c,0x22,0x4e,0x6f,0x20,0x6c,0x6f,
-    0x6e,0x67,0x65,0x72,0x20,0x69,0x6e,0x20,0x65,0x64,0x69,0x74,0x20,0x6d,0x6f,0x64,
-    0x65,0x22,0x7d,0x30,0x21,0x3d,0x3d,0x65,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x26,
-    0x26,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,
-    0x2e,0x74,0x65,0x78,0x74,0x46,0x69,0x6c,0x65,0x43,0x6f,0x6e,0x74,0x65,0x78,0x74,
-    0x3d,0x7b,0x66,0x69,0x6c,0x65,0x54,0x79,0x70,0x65,0x3a,0x77,0x69,0x6e,0x64,0x6f,
-    0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x75,0x72,0x46,0x69,0x6c,
-    0x65,0x54,0x79,0x70,0x65,0x2c,0x6c,0x69,0x6e,0x65,0x49,0x64,0x78,0x3a,0x30,0x2c,
-    0x69,0x6e,0x74,0x65,0x72,0x70,0x6f,0x6c,0x61,0x74,0x65,0x49,0x64,0x78,0x3a,0x30,
-    0x2c,0x6c,0x69,0x6e,0x65,0x73,0x3a,0x65,0x2c,0x73,0x74,0x6f,0x70,0x3a,0x21,0x31,
-    0x2c,0x78,0x3a,0x30,0x2c,0x79,0x3a,0x30,0x7d,0x2c,0x65,0x78,0x74,0x72,0x61,0x63,
-    0x74,0x54,0x61,0x62,0x6c,0x65,0x53,0x69,0x7a,0x65,0x28,0x77,0x69,0x6e,0x64,0x6f,
-    0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x74,0x65,0x78,0x74,0x46,0x69,
-    0x6c,0x65,0x43,0x6f,0x6e,0x74,0x65,0x78,0x74,0x29,0x2c,0x74,0x61,0x62,0x6c,0x65,
-    0x53,0x68,0x6f,0x77,0x53,0x74,0x61,0x72,0x74,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,
-    0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x74,0x65,0x78,0x74,0x46,0x69,0x6c,
-    0x65,0x43,0x6f,0x6e,0x74,0x65,0x78,0x74,0x29,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,
-    0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x69,0x6e,0x74,0x65,0x72,0x70,0x49,
-    0x74,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3d,0x30,0x2c,0x74,0x65,0x78,0x74,0x46,
-    0x69,0x6c,0x65,0x53,0x74,0x65,0x70,0x28,0x29,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,
-    0x69,0x6f,0x6e,0x20,0x74,0x65,0x78,0x74,0x46,0x69,0x6c,0x65,0x53,0x74,0x65,0x70,
-    0x28,0x29,0x7b,0x76,0x61,0x72,0x20,0x74,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,
-    0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x74,0x65,0x78,0x74,0x46,0x69,0x6c,0x65,
-    0x43,0x6f,0x6e,0x74,0x65,0x78,0x74,0x3b,0x66,0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,
-    0x65,0x3d,0x30,0x3b,0x65,0x3c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,
-    0x74,0x61,0x74,0x65,0x2e,0x6d,0x61,0x78,0x49,0x74,0x65,0x72,0x61,0x74,0x69,0x6f,
-    0x6e,0x73,0x49,0x6e,0x45,0x76,0x61,0x6c,0x3b,0x65,0x2b,0x2b,0x29,0x7b,0x6c,0x65,
-    0x74,0x20,0x65,0x3d,0x22,0x22,0x3b,0x69,0x66,0x28,0x30,0x3c,0x28,0x65,0x3d,0x28,
-    0x22,0x67,0x63,0x6f,0x64,0x65,0x22,0x3d,0x3d,0x3d,0x74,0x2e,0x66,0x69,0x6c,0x65,
-    0x54,0x79,0x70,0x65,0x3f,0x67,0x63,0x6f,0x64,0x65,0x45,0x76,0x61,0x6c,0x53,0x65,
-    0x72,0x76,0x69,0x63,0x65,0x3a,0x74,0x68,0x72,0x45,0x76,0x61,0x6c,0x53,0x65,0x72,
-    0x76,0x69,0x63,0x65,0x29,0x28,0x74,0x29,0x29,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,
-    0x29,0x7b,0x69,0x66,0x28,0x22,0x69,0x67,0x6e,0x6f,0x72,0x65,0x22,0x3d,0x3d,0x3d,
-    0x65,0x7c,0x7c,0x22,0x69,0x6e,0x76,0x61,0x6c,0x69,0x64,0x22,0x3d,0x3d,0x3d,0x65,
-    0x29,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,
-    0x20,0x76,0x6f,0x69,0x64,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,
-    0x67,0x28,0x22,0x52,0x65,0x73,0x20,0x74,0x6f,0x6f,0x20,0x73,0x68,0x6f,0x72,0x74,
-    0x22,0x29,0x7d,0x69,0x66,0x28,0x74,0x61,0x62,0x6c,0x65,0x53,0x68,0x6f,0x77,0x4e,
-    0x65,0x78,0x74,0x50,0x6f,0x69,0x6e,0x74,0x28,0x74,0x29,0x2c,0x77,0x69,0x6e,0x64,
-    0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x69,0x6e,0x74,0x65,0x72,
-    0x70,0x49,0x74,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x2b,0x2b,0x2c,0x77,0x69,0x6e,
-    0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x69,0x6e,0x74,0x65,
-    0x72,0x70,0x49,0x74,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3e,0x3d,0x77,0x69,0x6e,
-    0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x6d,0x61,0x78,0x49,
-    0x74,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x73,0x49,0x6e,0x54,0x6f,0x74,0x61,0x6c,
-    0x29,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x6f,0x69,0x64,0x20,0x63,0x6f,0x6e,
-    0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x4d,0x61,0x78,0x20,0x49,0x74,
-    0x65,0x72,0x22,0x29,0x3b,0x69,0x66,0x28,0x74,0x2e,0x73,0x74,0x6f,0x70,0x29,0x72,
-    0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x6f,0x69,0x64,0x20,0x63,0x6f,0x6e,0x73,0x6f,
-    0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x53,0x74,0x6f,0x70,0x20,0x72,0x65,0x71,
-    0x22,0x29,0x7d,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,
-    0x52,0x65,0x71,0x20,0x54,0x53,0x22,0x29,0x2c,0x73,0x65,0x74,0x54,0x69,0x6d,0x65,
-    0x6f,0x75,0x74,0x28,0x74,0x65,0x78,0x74,0x46,0x69,0x6c,0x65,0x53,0x74,0x65,0x70,
-    0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,
-    0x70,0x61,0x74,0x74,0x65,0x72,0x6e,0x45,0x76,0x61,0x6c,0x49,0x6e,0x74,0x65,0x72,
-    0x76,0x61,0x6c,0x4d,0x73,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,
-    0x74,0x61,0x62,0x6c,0x65,0x53,0x68,0x6f,0x77,0x53,0x74,0x61,0x72,0x74,0x28,0x65,
-    0x29,0x7b,0x76,0x61,0x72,0x20,0x74,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,
-    0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,
-    0x22,0x74,0x61,0x62,0x6c,0x65,0x2d,0x63,0x61,0x6e,0x76,0x61,0x73,0x22,0x29,0x2c,
-    0x61,0x3d,0x74,0x2e,0x67,0x65,0x74,0x43,0x6f,0x6e,0x74,0x65,0x78,0x74,0x28,0x22,
-    0x32,0x64,0x22,0x29,0x3b,0x61,0x2e,0x63,0x6c,0x6f,0x73,0x65,0x50,0x61,0x74,0x68,
-    0x28,0x29,0x2c,0x61,0x2e,0x63,0x6c,0x65,0x61,0x72,0x52,0x65,0x63,0x74,0x28,0x30,
-    0x2c,0x30,0x2c,0x74,0x2e,0x77,0x69,0x64,0x74,0x68,0x2c,0x74,0x2e,0x68,0x65,0x69,
-    0x67,0x68,0x74,0x29,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,
-    0x61,0x74,0x65,0x2e,0x74,0x61,0x62,0x6c,0x65,0x43,0x61,0x6e,0x76,0x61,0x73,0x50,
-    0x74,0x49,0x73,0x56,0x61,0x6c,0x69,0x64,0x3d,0x21,0x31,0x2c,0x61,0x2e,0x73,0x74,
-    0x72,0x6f,0x6b,0x65,0x53,0x74,0x79,0x6c,0x65,0x3d,0x22,0x23,0x34,0x30,0x37,0x65,
-    0x61,0x36,0x22,0x2c,0x61,0x2e,0x6c,0x69,0x6e,0x65,0x57,0x69,0x64,0x74,0x68,0x3d,
-    0x31,0x30,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,
-    0x61,0x74,0x65,0x2e,0x72,0x6f,0x62,0x6f,0x74,0x47,0x65,0x6f,0x6d,0x26,0x26,0x22,
-    0x53,0x69,0x6e,0x67,0x6c,0x65,0x41,0x72,0x6d,0x53,0x63,0x61,0x72,0x61,0x22,0x21,
-    0x3d,0x3d,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x70,0x61,0x67,0x65,0x53,0x74,0x61,
-    0x74,0x65,0x2e,0x72,0x6f,0x62,0x6f,0x74,0x47,0x65,0x6f,0x6d,0x7c,0x7c,0x28,0x61,
-    0x2e,0x62,0x65,0x67,0x69,0x6e,0x50,0x61,0x74,0x68,0x28,0x29,0x2c,0x65,0x2e,0x78,
-    0x3d,0x30,0x2c,0x65,0x2e,0x79,0x3d,0x30,0x2c,0x74,0x3d,0x67,0x65,0x74,0x43,0x61,
-    0x6e,0x76,0x61,0x73,0x58,0x59,0x28,0x74,0x2c,0x65,0x29,0x2c,0x61,0x2e,0x61,0x72,
-    0x63,0x28,0x74,0x5b,0x30,0x5d,0x2c,0x74,0x5b,0x31,0x5d,0x2c,0x77,0x69,0x6e,0x64,
-    0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x61,0x6e,0x76,0x61,
-    0x73,0x53,0x69,0x7a,0x65,0x2f,0x32,0x2c,0x30,0x2c,0x32,0x2a,0x4d,0x61,0x74,0x68,
-    0x2e,0x50,0x49,0x29,0x2c,0x61,0x2e,0x73,0x74,0x72,0x6f,0x6b,0x65,0x28,0x29,0x2c,
-    0x61,0x2e,0x63,0x6c,0x6f,0x73,0x65,0x50,0x61,0x74,0x68,0x28,0x29,0x29,0x2c,0x61,
-    0x2e,0x73,0x74,0x72,0x6f,0x6b,0x65,0x53,0x74,0x79,0x6c,0x65,0x3d,0x22,0x23,0x65,
-    0x33,0x63,0x64,0x61,0x36,0x22,0x2c,0x61,0x2e,0x6c,0x69,0x6e,0x65,0x57,0x69,0x64,
-    0x74,0x68,0x3d,0x31,0x2c,0x61,0x2e,0x62,0x65,0x67,0x69,0x6e,0x50,0x61,0x74,0x68,
-    0x28,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x74,0x61,0x62,0x6c,
-    0x65,0x53,0x68,0x6f,0x77,0x4e,0x65,0x78,0x74,0x50,0x6f,0x69,0x6e,0x74,0x28,0x65,
-    0x29,0x7b,0x76,0x61,0x72,0x20,0x74,0x2c,0x61,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,
-    0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,
-    0x64,0x28,0x22,0x74,0x61,0x62,0x6c,0x65,0x2d,0x63,0x61,0x6e,0x76,0x61,0x73,0x22,
-    0x29,0x3b,0x61,0x26,0x26,0x28,0x74,0x3d,0x61,0x2e,0x67,0x65,0x74,0x43,0x6f,0x6e,
-    0x74,0x65,0x78,0x74,0x28,0x22,0x32,0x64,0x22,0x29,0x2c,0x61,0x3d,0x67,0x65,0x74,
-    0x43,0x61,0x6e,0x76,0x61,0x73,0x58,0x59,0x28,0x61,0x2c,0x65,0x29,0x2c,0x77,0x69,
-    0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x74,0x61,0x62,
-    0x6c,0x65,0x43,0x61,0x6e,0x76,0x61,0x73,0x50,0x74,0x49,0x73,0x56,0x61,0x6c,0x69,
-    0x64,0x3f,0x28,0x74,0x2e,0x6c,0x69,0x6e,0x65,0x54,0x6f,0x28,0x61,0x5b,0x30,0x5d,
-    0x2c,0x61,0x5b,0x31,0x5d,0x29,0x2c,0x74,0x2e,0x73,0x74,0x72,0x6f,0x6b,0x65,0x28,
-    0x29,0x29,0x3a,0x74,0x2e,0x6d,0x6f,0x76,0x65,0x54,0x6f,0x28,0x61,0x5b,0x30,0x5d,
-    0x2c,0x61,0x5b,0x31,0x5d,0x29,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,
-    0x53,0x74,0x61,0x74,0x65,0x2e,0x74,0x61,0x62,0x6c,0x65,0x43,0x61,0x6e,0x76,0x61,
-    0x73,0x50,0x74,0x49,0x73,0x56,0x61,0x6c,0x69,0x64,0x3d,0x21,0x30,0x29,0x7d,0x66,
-    0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x67,0x65,0x74,0x43,0x61,0x6e,0x76,0x61,
-    0x73,0x58,0x59,0x28,0x65,0x2c,0x74,0x29,0x7b,0x72,0x65,0x74,0x75,0x72,0x6e,0x5b,
-    0x28,0x74,0x2e,0x78,0x2b,0x74,0x2e,0x6f,0x72,0x69,0x67,0x69,0x6e,0x58,0x29,0x2f,
-    0x74,0x2e,0x73,0x69,0x7a,0x65,0x58,0x2a,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,
-    0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x61,0x6e,0x76,0x61,0x73,0x53,0x69,0x7a,
-    0x65,0x2b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,
-    0x2e,0x63,0x61,0x6e,0x76,0x61,0x73,0x42,0x6f,0x72,0x64,0x65,0x72,0x2c,0x65,0x2e,
-    0x68,0x65,0x69,0x67,0x68,0x74,0x2d,0x28,0x28,0x74,0x2e,0x79,0x2b,0x74,0x2e,0x6f,
-    0x72,0x69,0x67,0x69,0x6e,0x59,0x29,0x2f,0x74,0x2e,0x73,0x69,0x7a,0x65,0x59,0x2a,
-    0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,
-    0x61,0x6e,0x76,0x61,0x73,0x53,0x69,0x7a,0x65,0x2b,0x77,0x69,0x6e,0x64,0x6f,0x77,
-    0x2e,0x73,0x74,0x53,0x74,0x61,0x74,0x65,0x2e,0x63,0x61,0x6e,0x76,0x61,0x73,0x42,
-    0x6f,0x72,0x64,0x65,0x72,0x29,0x5d,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
-    0x20,0x63,0x61,0x6c,0x6c,0x41,0x6a,0x61,0x78,0x28,0x65,0x2c,0x74,0x2c,0x61,0x29,
-    0x7b,0x63,0x6f,0x6e,0x73,0x74,0x20,0x6e,0x3d,0x6e,0x65,0x77,0x20,0x58,0x4d,0x4c,
-    0x48,0x74,0x74,0x70,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x3b,0x6e,0x2e,0x6f,0x6e,
-    0x72,0x65,0x61,0x64,0x79,0x73,0x74,0x61,0x74,0x65,0x63,0x68,0x61,0x6e,0x67,0x65,
-    0x3d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x7b,0x34,0x3d,0x3d,0x3d,
-    0x6e,0x2e,0x72,0x65,0x61,0x64,0x79,0x53,0x74,0x61,0x74,0x65,0x26,0x26,0x28,0x32,
-    0x30,0x30,0x3d,0x3d,0x3d,0x6e,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x3f,0x74,0x28,
-    0x6e,0x2e,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x54,0x65,0x78,0x74,0x29,0x3a,
-    0x76,0x6f,0x69,0x64,0x20,0x30,0x21,0x3d,0x3d,0x61,0x26,0x26,0x61,0x28,0x6e,0x29,
-    0x29,0x7d,0x2c,0x6e,0x2e,0x6f,0x70,0x65,0x6e,0x28,0x22,0x47,0x45,0x54,0x22,0x2c,
-    0x65,0x73,0x63,0x61,0x70,0x65,0x28,0x65,0x29,0x2c,0x21,0x30,0x29,0x2c,0x6e,0x2e,
-    0x73,0x65,0x6e,0x64,0x28,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,
-    0x61,0x6a,0x61,0x78,0x44,0x65,0x66,0x61,0x75,0x6c,0x74,0x43,0x61,0x6c,0x6c,0x62,
-    0x61,0x63,0x6b,0x28,0x29,0x7b,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,
-    0x70,0x6f,0x73,0x74,0x4a,0x73,0x6f,0x6e,0x28,0x65,0x2c,0x74,0x2c,0x61,0x2c,0x6e,
-    0x29,0x7b,0x63,0x6f,0x6e,0x73,0x74,0x20,0x6f,0x3d,0x6e,0x65,0x77,0x20,0x58,0x4d,
-    0x4c,0x48,0x74,0x74,0x70,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x3b,0x6f,0x2e,0x6f,
-    0x6e,0x72,0x65,0x61,0x64,0x79,0x73,0x74,0x61,0x74,0x65,0x63,0x68,0x61,0x6e,0x67,
-    0x65,0x3d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x7b,0x34,0x3d,0x3d,
-    0x3d,0x6f,0x2e,0x72,0x65,0x61,0x64,0x79,0x53,0x74,0x61,0x74,0x65,0x26,0x26,0x28,
-    0x32,0x30,0x30,0x3d,0x3d,0x3d,0x6f,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x3f,0x76,
-    0x6f,0x69,0x64,0x20,0x30,0x21,0x3d,0x3d,0x61,0x26,0x26,0x61,0x28,0x6f,0x2e,0x72,
-    0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x54,0x65,0x78,0x74,0x29,0x3a,0x76,0x6f,0x69,
-    0x64,0x20,0x30,0x21,0x3d,0x3d,0x6e,0x26,0x26,0x6e,0x28,0x6f,0x29,0x29,0x7d,0x2c,
-    0x6f,0x2e,0x6f,0x70,0x65,0x6e,0x28,0x22,0x50,0x4f,0x53,0x54,0x22,0x2c,0x65,0x29,
-    0x2c,0x6f,0x2e,0x73,0x65,0x74,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x48,0x65,0x61,
-    0x64,0x65,0x72,0x28,0x22,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,
-    0x65,0x22,0x2c,0x22,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2f,
-    0x6a,0x73,0x6f,0x6e,0x22,0x29,0x2c,0x6f,0x2e,0x73,0x65,0x6e,0x64,0x28,0x74,0x29,
-    0x7d,0x6c,0x65,0x74,0x20,0x6c,0x6f,0x67,0x6f,0x43,0x61,0x6e,0x76,0x61,0x73,0x57,
-    0x69,0x64,0x74,0x68,0x3d,0x31,0x30,0x30,0x2c,0x6c,0x6f,0x67,0x6f,0x43,0x61,0x6e,
-    0x76,0x61,0x73,0x48,0x65,0x69,0x67,0x68,0x74,0x3d,0x31,0x30,0x30,0x3b,0x66,0x75,
-    0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x69,0x63,0x6f,0x6e,0x47,0x65,0x6e,0x28,0x65,
-    0x29,0x7b,0x6c,0x65,0x74,0x20,0x74,0x2c,0x61,0x2c,0x6e,0x2c,0x6f,0x3b,0x76,0x61,
-    0x72,0x20,0x69,0x3d,0x6c,0x6f,0x67,0x6f,0x43,0x61,0x6e,0x76,0x61,0x73,0x57,0x69,
-    0x64,0x74,0x68,0x2f,0x32,0x2c,0x73,0x3d,0x6c,0x6f,0x67,0x6f,0x43,0x61,0x6e,0x76,
-    0x61,0x73,0x48,0x65,0x69,0x67,0x68,0x74,0x2f,0x32,0x3b,0x76,0x61,0x72,0x20,0x6c,
-    0x2c,0x72,0x2c,0x64,0x2c,0x63,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,
-    0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x65,
-    0x29,0x2e,0x67,0x65,0x74,0x43,0x6f,0x6e,0x74,0x65,0x78,0x74,0x28,0x22,0x32,0x64,
-    0x22,0x29,0x3b,0x63,0x2e,0x62,0x65,0x67,0x69,0x6e,0x50,0x61,0x74,0x68,0x28,0x29,
-    0x2c,0x63,0x2e,0x6c,0x69,0x6e,0x65,0x57,0x69,0x64,0x74,0x68,0x3d,0x32,0x2c,0x74,
-    0x3d,0x30,0x2c,0x6f,0x3d,0x21,0x31,0x3b,0x6c,0x65,0x74,0x20,0x75,0x3d,0x30,0x3b,
-    0x66,0x6f,0x72,0x28,0x3b,0x21,0x28,0x6f,0x7c,0x7c,0x28,0x72,0x3d,0x64,0x3d,0x72,
-    0x3d,0x6c,0x3d,0x76,0x6f,0x69,0x64,0x20,0x30,0x2c,0x6c,0x3d,0x32,0x2a,0x74,0x2a,
-    0x4d,0x61,0x74,0x68,0x2e,0x50,0x49,0x2a,0x31,0x2e,0x30,0x33,0x2f,0x32,0x30,0x30,
-    0x2c,0x72,0x3d,0x4d,0x61,0x74,0x68,0x2e,0x73,0x69,0x6e,0x28,0x32,0x30,0x2a,0x74,
-    0x2a,0x32,0x2a,0x4d,0x61,0x74,0x68,0x2e,0x50,0x49,0x2f,0x32,0x30,0x30,0x29,0x2c,
-    0x64,0x3d,0x31,0x38,0x30,0x2b,0x2d,0x31,0x33,0x2a,0x74,0x2f,0x32,0x30,0x30,0x2c,
-    0x72,0x3d,0x64,0x2b,0x31,0x30,0x2a,0x72,0x2a,0x28,0x31,0x2d,0x2e,0x36,0x2a,0x28,
-    0x31,0x2d,0x28,0x64,0x2d,0x4d,0x61,0x74,0x68,0x2e,0x6d,0x69,0x6e,0x28,0x31,0x38,
-    0x30,0x2c,0x31,0x30,0x29,0x29,0x2f,0x4d,0x61,0x74,0x68,0x2e,0x61,0x62,0x73,0x28,
-    0x31,0x37,0x30,0x29,0x29,0x29,0x2c,0x61,0x3d,0x72,0x2a,0x4d,0x61,0x74,0x68,0x2e,
-    0x73,0x69,0x6e,0x28,0x6c,0x29,0x2a,0x6c,0x6f,0x67,0x6f,0x43,0x61,0x6e,0x76,0x61,
-    0x73,0x57,0x69,0x64,0x74,0x68,0x2f,0x34,0x30,0x30,0x2c,0x6e,0x3d,0x72,0x2a,0x4d,
-    0x61,0x74,0x68,0x2e,0x63,0x6f,0x73,0x28,0x6c,0x29,0x2a,0x6c,0x6f,0x67,0x6f,0x43,
-    0x61,0x6e,0x76,0x61,0x73,0x48,0x65,0x69,0x67,0x68,0x74,0x2f,0x34,0x30,0x30,0x2c,
-    0x74,0x2b,0x3d,0x31,0x2c,0x6f,0x3d,0x64,0x3e,0x4d,0x61,0x74,0x68,0x2e,0x6d,0x61,
-    0x78,0x28,0x31,0x38,0x30,0x2c,0x31,0x30,0x29,0x7c,0x7c,0x64,0x3c,0x4d,0x61,0x74,
-    0x68,0x2e,0x6d,0x69,0x6e,0x28,0x31,0x38,0x30,0x2c,0x31,0x30,0x29,0x2c,0x30,0x3d,
-    0x3d,0x3d,0x75,0x3f,0x63,0x2e,0x6d,0x6f,0x76,0x65,0x54,0x6f,0x28,0x69,0x2b,0x61,
-    0x2c,0x73,0x2b,0x6e,0x29,0x3a,0x63,0x2e,0x6c,0x69,0x6e,0x65,0x54,0x6f,0x28,0x69,
-    0x2b,0x61,0x2c,0x73,0x2b,0x6e,0x29,0x2c,0x31,0x65,0x34,0x3c,0x75,0x29,0x29,0x3b,
-    0x29,0x75,0x2b,0x2b,0x3b,0x63,0x2e,0x73,0x74,0x72,0x6f,0x6b,0x65,0x53,0x74,0x79,
-    0x6c,0x65,0x3d,0x22,0x23,0x65,0x30,0x65,0x30,0x65,0x30,0x22,0x2c,0x63,0x2e,0x73,
-    0x74,0x72,0x6f,0x6b,0x65,0x28,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
-    0x20,0x73,0x65,0x74,0x75,0x70,0x53,0x65,0x6c,0x65,0x63,0x74,0x28,0x74,0x29,0x7b,
-    0x76,0x61,0x72,0x20,0x61,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,
-    0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,0x42,0x79,0x43,0x6c,0x61,0x73,
-    0x73,0x4e,0x61,0x6d,0x65,0x28,0x22,0x73,0x65,0x6c,0x65,0x63,0x74,0x2d,0x73,0x74,
-    0x79,0x6c,0x65,0x22,0x29,0x3b,0x66,0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,0x65,0x3d,
-    0x30,0x3b,0x65,0x3c,0x61,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x65,0x2b,0x2b,
-    0x29,0x69,0x66,0x28,0x30,0x21,0x3d,0x3d,0x28,0x73,0x65,0x6c,0x45,0x6c,0x3d,0x61,
-    0x5b,0x65,0x5d,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,0x42,
-    0x79,0x54,0x61,0x67,0x4e,0x61,0x6d,0x65,0x28,0x22,0x73,0x65,0x6c,0x65,0x63,0x74,
-    0x22,0x29,0x5b,0x30,0x5d,0x29,0x2e,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x73,0x2e,0x6c,
-    0x65,0x6e,0x67,0x74,0x68,0x29,0x7b,0x76,0x61,0x72,0x20,0x6f,0x3d,0x64,0x6f,0x63,
-    0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,
-    0x65,0x6e,0x74,0x28,0x22,0x64,0x69,0x76,0x22,0x29,0x2c,0x73,0x3d,0x28,0x6f,0x2e,
-    0x73,0x65,0x74,0x41,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x22,0x63,0x6c,
-    0x61,0x73,0x73,0x22,0x2c,0x22,0x73,0x65,0x6c,0x65,0x63,0x74,0x2d,0x73,0x65,0x6c,
-    0x65,0x63,0x74,0x65,0x64,0x22,0x29,0x2c,0x6f,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,
-    0x54,0x4d,0x4c,0x3d,0x73,0x65,0x6c,0x45,0x6c,0x2e,0x6f,0x70,0x74,0x69,0x6f,0x6e,
-    0x73,0x5b,0x73,0x65,0x6c,0x45,0x6c,0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,
-    0x49,0x6e,0x64,0x65,0x78,0x5d,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,
-    0x2c,0x61,0x5b,0x65,0x5d,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,
-    0x64,0x28,0x6f,0x29,0x2c,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,
-    0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x22,0x64,0x69,0x76,
-    0x22,0x29,0x29,0x3b,0x73,0x2e,0x73,0x65,0x74,0x41,0x74,0x74,0x72,0x69,0x62,0x75,
-    0x74,0x65,0x28,0x22,0x63,0x6c,0x61,0x73,0x73,0x22,0x2c,0x22,0x73,0x65,0x6c,0x65,
-    0x63,0x74,0x2d,0x69,0x74,0x65,0x6d,0x73,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x2d,
-    0x68,0x69,0x64,0x65,0x22,0x29,0x3b,0x66,0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,0x65,
-    0x3d,0x30,0x3b,0x65,0x3c,0x73,0x65,0x6c,0x45,0x6c,0x2e,0x6c,0x65,0x6e,0x67,0x74,
-    0x68,0x3b,0x65,0x2b,0x2b,0x29,0x7b,0x76,0x61,0x72,0x20,0x6c,0x3d,0x64,0x6f,0x63,
-    0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,
-    0x65,0x6e,0x74,0x28,0x22,0x64,0x69,0x76,0x22,0x29,0x3b,0x6c,0x2e,0x69,0x6e,0x6e,
-    0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x73,0x65,0x6c,0x45,0x6c,0x2e,0x6f,0x70,0x74,
-    0x69,0x6f,0x6e,0x73,0x5b,0x65,0x5d,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,
-    0x4c,0x2c,0x6c,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,
-    0x65,0x6e,0x65,0x72,0x28,0x22,0x63,0x6c,0x69,0x63,0x6b,0x22,0x2c,0x66,0x75,0x6e,
-    0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,0x29,0x7b,0x76,0x61,0x72,0x20,0x74,0x3d,0x74,
-    0x68,0x69,0x73,0x2e,0x70,0x61,0x72,0x65,0x6e,0x74,0x4e,0x6f,0x64,0x65,0x2e,0x70,
-    0x61,0x72,0x65,0x6e,0x74,0x4e,0x6f,0x64,0x65,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,
-    0x6d,0x65,0x6e,0x74,0x73,0x42,0x79,0x54,0x61,0x67,0x4e,0x61,0x6d,0x65,0x28,0x22,
-    0x73,0x65,0x6c,0x65,0x63,0x74,0x22,0x29,0x5b,0x30,0x5d,0x2c,0x61,0x3d,0x74,0x68,
-    0x69,0x73,0x2e,0x70,0x61,0x72,0x65,0x6e,0x74,0x4e,0x6f,0x64,0x65,0x2e,0x70,0x72,
-    0x65,0x76,0x69,0x6f,0x75,0x73,0x53,0x69,0x62,0x6c,0x69,0x6e,0x67,0x3b,0x66,0x6f,
-    0x72,0x28,0x6c,0x65,0x74,0x20,0x65,0x3d,0x30,0x3b,0x65,0x3c,0x74,0x2e,0x6c,0x65,
-    0x6e,0x67,0x74,0x68,0x3b,0x65,0x2b,0x2b,0x29,0x69,0x66,0x28,0x74,0x2e,0x6f,0x70,
-    0x74,0x69,0x6f,0x6e,0x73,0x5b,0x65,0x5d,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,
-    0x4d,0x4c,0x3d,0x3d,0x74,0x68,0x69,0x73,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,
-    0x4d,0x4c,0x29,0x7b,0x74,0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x49,0x6e,
-    0x64,0x65,0x78,0x3d,0x65,0x2c,0x61,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,
-    0x4c,0x3d,0x74,0x68,0x69,0x73,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,
-    0x3b,0x76,0x61,0x72,0x20,0x6f,0x3d,0x74,0x68,0x69,0x73,0x2e,0x70,0x61,0x72,0x65,
-    0x6e,0x74,0x4e,0x6f,0x64,0x65,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,
-    0x74,0x73,0x42,0x79,0x43,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x28,0x22,0x73,
-    0x61,0x6d,0x65,0x2d,0x61,0x73,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x22,
-    0x29,0x3b,0x66,0x6f,0x72,0x28,0x6e,0x3d,0x30,0x3b,0x6e,0x3c,0x6f,0x2e,0x6c,0x65,
-    0x6e,0x67,0x74,0x68,0x3b,0x6e,0x2b,0x2b,0x29,0x6f,0x5b,0x6e,0x5d,0x2e,0x72,0x65,
-    0x6d,0x6f,0x76,0x65,0x41,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x22,0x63,
-    0x6c,0x61,0x73,0x73,0x22,0x29,0x3b,0x74,0x68,0x69,0x73,0x2e,0x73,0x65,0x74,0x41,
-    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x22,0x63,0x6c,0x61,0x73,0x73,0x22,
-    0x2c,0x22,0x73,0x61,0x6d,0x65,0x2d,0x61,0x73,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,
-    0x65,0x64,0x22,0x29,0x3b,0x62,0x72,0x65,0x61,0x6b,0x7d,0x61,0x2e,0x63,0x6c,0x69,
-    0x63,0x6b,0x28,0x29,0x7d,0x29,0x2c,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,
-    0x68,0x69,0x6c,0x64,0x28,0x6c,0x29,0x2c,0x65,0x3d,0x3d,0x73,0x65,0x6c,0x45,0x6c,
-    0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x2d,0x31,0x26,0x26,0x6c,0x2e,0x73,0x65,0x74,
-    0x41,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x22,0x63,0x6c,0x61,0x73,0x73,
-    0x22,0x2c,0x22,0x73,0x65,0x6c,0x65,0x63,0x74,0x2d,0x6c,0x61,0x73,0x74,0x2d,0x6f,
-    0x70,0x74,0x69,0x6f,0x6e,0x22,0x29,0x7d,0x61,0x5b,0x65,0x5d,0x2e,0x61,0x70,0x70,
-    0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x73,0x29,0x2c,0x6f,0x2e,0x61,0x64,
-    0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,
-    0x63,0x6c,0x69,0x63,0x6b,0x22,0x2c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,
-    0x65,0x29,0x7b,0x65,0x2e,0x73,0x74,0x6f,0x70,0x50,0x72,0x6f,0x70,0x61,0x67,0x61,
-    0x74,0x69,0x6f,0x6e,0x28,0x29,0x2c,0x72,0x28,0x74,0x68,0x69,0x73,0x29,0x2c,0x74,
-    0x68,0x69,0x73,0x2e,0x6e,0x65,0x78,0x74,0x53,0x69,0x62,0x6c,0x69,0x6e,0x67,0x2e,
-    0x63,0x6c,0x61,0x73,0x73,0x4c,0x69,0x73,0x74,0x2e,0x74,0x6f,0x67,0x67,0x6c,0x65,
-    0x28,0x22,0x73,0x65,0x6c,0x65,0x63,0x74,0x2d,0x68,0x69,0x64,0x65,0x22,0x29,0x2c,
-    0x74,0x68,0x69,0x73,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4c,0x69,0x73,0x74,0x2e,0x74,
-    0x6f,0x67,0x67,0x6c,0x65,0x28,0x22,0x73,0x65,0x6c,0x65,0x63,0x74,0x2d,0x61,0x72,
-    0x72,0x6f,0x77,0x2d,0x61,0x63,0x74,0x69,0x76,0x65,0x22,0x29,0x2c,0x74,0x28,0x29,
-    0x7d,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x72,0x28,0x74,0x29,
-    0x7b,0x76,0x61,0x72,0x20,0x61,0x3d,0x5b,0x5d,0x2c,0x65,0x3d,0x64,0x6f,0x63,0x75,
-    0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,
-    0x42,0x79,0x43,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x28,0x22,0x73,0x65,0x6c,
-    0x65,0x63,0x74,0x2d,0x69,0x74,0x65,0x6d,0x73,0x22,0x29,0x2c,0x6e,0x3d,0x64,0x6f,
-    0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,
-    0x74,0x73,0x42,0x79,0x43,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x28,0x22,0x73,
-    0x65,0x6c,0x65,0x63,0x74,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x22,0x29,
-    0x3b,0x66,0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,0x65,0x3d,0x30,0x3b,0x65,0x3c,0x6e,
-    0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x65,0x2b,0x2b,0x29,0x74,0x3d,0x3d,0x6e,
-    0x5b,0x65,0x5d,0x3f,0x61,0x2e,0x70,0x75,0x73,0x68,0x28,0x65,0x29,0x3a,0x6e,0x5b,
-    0x65,0x5d,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4c,0x69,0x73,0x74,0x2e,0x72,0x65,0x6d,
-    0x6f,0x76,0x65,0x28,0x22,0x73,0x65,0x6c,0x65,0x63,0x74,0x2d,0x61,0x72,0x72,0x6f,
-    0x77,0x2d,0x61,0x63,0x74,0x69,0x76,0x65,0x22,0x29,0x3b,0x66,0x6f,0x72,0x28,0x69,
-    0x3d,0x30,0x3b,0x69,0x3c,0x65,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x69,0x2b,
-    0x2b,0x29,0x61,0x2e,0x69,0x6e,0x64,0x65,0x78,0x4f,0x66,0x28,0x69,0x29,0x26,0x26,
-    0x65,0x5b,0x69,0x5d,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4c,0x69,0x73,0x74,0x2e,0x61,
-    0x64,0x64,0x28,0x22,0x73,0x65,0x6c,0x65,0x63,0x74,0x2d,0x68,0x69,0x64,0x65,0x22,
-    0x29,0x7d,0x30,0x3c,0x61,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x26,0x26,0x64,0x6f,
-    0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,
-    0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x63,0x6c,0x69,0x63,0x6b,0x22,0x2c,
-    0x72,0x29,0x7d,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0a,0x09,0x3c,0x73,
-    0x74,0x79,0x6c,0x65,0x3e,0x62,0x6f,0x64,0x79,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x66,
-    0x61,0x6d,0x69,0x6c,0x79,0x3a,0x43,0x65,0x6e,0x74,0x75,0x72,0x79,0x20,0x47,0x6f,
-    0x74,0x68,0x69,0x63,0x2c,0x73,0x61,0x6e,0x73,0x2d,0x73,0x65,0x72,0x69,0x66,0x3b,
-    0x6c,0x69,0x6e,0x65,0x2d,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x31,0x2e,0x34,0x65,
-    0x6d,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x34,0x70,0x74,
-    0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,
-    0x72,0x3a,0x23,0x65,0x33,0x63,0x64,0x61,0x36,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,
-    0x73,0x69,0x6c,0x76,0x65,0x72,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x30,0x7d,
-    0x2e,0x6e,0x6f,0x73,0x65,0x6c,0x65,0x63,0x74,0x7b,0x2d,0x77,0x65,0x62,0x6b,0x69,
-    0x74,0x2d,0x74,0x6f,0x75,0x63,0x68,0x2d,0x63,0x61,0x6c,0x6c,0x6f,0x75,0x74,0x3a,
-    0x6e,0x6f,0x6e,0x65,0x3b,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,0x75,0x73,0x65,
-    0x72,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x2d,0x6b,
-    0x68,0x74,0x6d,0x6c,0x2d,0x75,0x73,0x65,0x72,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,
-    0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x2d,0x6d,0x6f,0x7a,0x2d,0x75,0x73,0x65,0x72,0x2d,
-    0x73,0x65,0x6c,0x65,0x63,0x74,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x2d,0x6d,0x73,0x2d,
-    0x75,0x73,0x65,0x72,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x3a,0x6e,0x6f,0x6e,0x65,
-    0x3b,0x75,0x73,0x65,0x72,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x3a,0x6e,0x6f,0x6e,
-    0x65,0x7d,0x2e,0x70,0x61,0x67,0x65,0x2d,0x68,0x65,0x61,0x64,0x65,0x72,0x7b,0x70,
-    0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x74,0x6f,0x70,0x3a,0x32,0x30,0x70,0x78,0x3b,
-    0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x32,
-    0x30,0x70,0x78,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,
-    0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x65,0x33,0x63,0x64,0x61,0x36,0x3b,0x77,0x69,0x64,
-    0x74,0x68,0x3a,0x31,0x30,0x30,0x25,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,
-    0x65,0x3a,0x31,0x2e,0x35,0x65,0x6d,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,
-    0x30,0x66,0x30,0x66,0x30,0x3b,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,
-    0x3a,0x63,0x65,0x6e,0x74,0x65,0x72,0x7d,0x2e,0x70,0x61,0x67,0x65,0x2d,0x68,0x65,
-    0x61,0x64,0x65,0x72,0x2d,0x74,0x65,0x78,0x74,0x7b,0x6d,0x61,0x72,0x67,0x69,0x6e,
-    0x2d,0x74,0x6f,0x70,0x3a,0x31,0x30,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x66,
-    0x61,0x6d,0x69,0x6c,0x79,0x3a,0x43,0x6f,0x70,0x70,0x65,0x72,0x70,0x6c,0x61,0x74,
-    0x65,0x2c,0x43,0x6f,0x70,0x70,0x65,0x72,0x70,0x6c,0x61,0x74,0x65,0x20,0x47,0x6f,
-    0x74,0x68,0x69,0x63,0x20,0x4c,0x69,0x67,0x68,0x74,0x2c,0x73,0x61,0x6e,0x73,0x2d,
-    0x73,0x65,0x72,0x69,0x66,0x7d,0x2e,0x70,0x61,0x67,0x65,0x2d,0x6c,0x6f,0x67,0x6f,
-    0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x6e,0x6f,0x6e,0x65,0x7d,0x2e,0x62,0x6f,
-    0x64,0x79,0x2d,0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x73,0x7b,0x77,0x69,0x64,0x74,
-    0x68,0x3a,0x38,0x30,0x25,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x72,0x69,0x67,
-    0x68,0x74,0x3a,0x61,0x75,0x74,0x6f,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,
-    0x74,0x6f,0x70,0x3a,0x32,0x30,0x70,0x78,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,
-    0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x32,0x30,0x70,0x78,0x3b,0x64,0x69,0x73,
-    0x70,0x6c,0x61,0x79,0x3a,0x66,0x6c,0x65,0x78,0x3b,0x6a,0x75,0x73,0x74,0x69,0x66,
-    0x79,0x2d,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3a,0x73,0x70,0x61,0x63,0x65,0x2d,
-    0x65,0x76,0x65,0x6e,0x6c,0x79,0x3b,0x6c,0x69,0x73,0x74,0x2d,0x73,0x74,0x79,0x6c,
-    0x65,0x2d,0x74,0x79,0x70,0x65,0x3a,0x6e,0x6f,0x6e,0x65,0x7d,0x2e,0x62,0x6f,0x64,
-    0x79,0x2d,0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x73,0x2d,0x62,0x75,0x74,0x74,0x6f,
-    0x6e,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x2e,0x32,0x65,
-    0x6d,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x61,0x66,0x63,0x65,0x65,0x3b,
-    0x63,0x75,0x72,0x73,0x6f,0x72,0x3a,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x7d,0x2e,
-    0x62,0x6f,0x64,0x79,0x2d,0x70,0x61,0x72,0x74,0x2d,0x62,0x75,0x74,0x74,0x6f,0x6e,
-    0x73,0x7b,0x66,0x6c,0x65,0x78,0x2d,0x67,0x72,0x6f,0x77,0x3a,0x31,0x7d,0x2e,0x62,
-    0x6f,0x64,0x79,0x2d,0x70,0x61,0x72,0x74,0x2d,0x73,0x74,0x61,0x74,0x75,0x73,0x7b,
-    0x66,0x6c,0x65,0x78,0x2d,0x67,0x72,0x6f,0x77,0x3a,0x2e,0x32,0x7d,0x2e,0x62,0x6f,
-    0x64,0x79,0x2d,0x73,0x65,0x70,0x7b,0x66,0x6c,0x65,0x78,0x2d,0x67,0x72,0x6f,0x77,
-    0x3a,0x2e,0x30,0x31,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,
-    0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x34,0x30,0x37,0x65,0x61,0x36,0x7d,0x2e,0x62,
-    0x6f,0x64,0x79,0x2d,0x63,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x73,0x7b,0x64,0x69,0x73,
-    0x70,0x6c,0x61,0x79,0x3a,0x66,0x6c,0x65,0x78,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,
-    0x67,0x72,0x6f,0x75,0x70,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,
-    0x3a,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,0x6c,0x69,0x6e,0x65,0x61,0x72,0x2d,
-    0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x28,0x74,0x6f,0x70,0x2c,0x23,0x62,0x39,
-    0x61,0x38,0x38,0x38,0x20,0x30,0x2c,0x23,0x63,0x39,0x62,0x36,0x39,0x33,0x20,0x31,
-    0x30,0x70,0x78,0x2c,0x23,0x65,0x33,0x63,0x64,0x61,0x36,0x20,0x31,0x30,0x30,0x25,
-    0x29,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x67,0x72,0x6f,0x75,0x70,0x2d,0x68,0x65,
-    0x61,0x64,0x65,0x72,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,
-    0x3a,0x43,0x6f,0x70,0x70,0x65,0x72,0x70,0x6c,0x61,0x74,0x65,0x2c,0x43,0x6f,0x70,
-    0x70,0x65,0x72,0x70,0x6c,0x61,0x74,0x65,0x20,0x47,0x6f,0x74,0x68,0x69,0x63,0x20,
-    0x4c,0x69,0x67,0x68,0x74,0x2c,0x73,0x61,0x6e,0x73,0x2d,0x73,0x65,0x72,0x69,0x66,
-    0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x32,0x30,0x70,
-    0x78,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x74,0x6f,0x70,0x3a,0x32,0x30,
-    0x70,0x78,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x36,0x34,0x35,0x32,0x33,0x63,
-    0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x2e,0x32,0x65,0x6d,
-    0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x67,0x72,0x6f,0x75,0x70,0x2d,0x62,0x75,0x74,
-    0x74,0x6f,0x6e,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x36,0x34,0x35,0x32,0x33,
-    0x63,0x3b,0x74,0x65,0x78,0x74,0x2d,0x64,0x65,0x63,0x6f,0x72,0x61,0x74,0x69,0x6f,
-    0x6e,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x63,0x75,0x72,0x73,0x6f,0x72,0x3a,0x70,0x6f,
-    0x69,0x6e,0x74,0x65,0x72,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x67,0x72,0x6f,0x75,
-    0x70,0x2d,0x62,0x75,0x74,0x74,0x6f,0x6e,0x2d,0x69,0x63,0x6f,0x6e,0x7b,0x63,0x75,
-    0x72,0x73,0x6f,0x72,0x3a,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x7d,0x2e,0x62,0x6f,
-    0x64,0x79,0x2d,0x67,0x72,0x6f,0x75,0x70,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,
-    0x7b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x72,0x69,0x67,0x68,0x74,0x3a,0x32,0x30,
-    0x70,0x78,0x3b,0x66,0x6c,0x6f,0x61,0x74,0x3a,0x72,0x69,0x67,0x68,0x74,0x3b,0x63,
-    0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x36,0x34,0x35,0x32,0x33,0x63,0x3b,0x66,0x6f,0x6e,
-    0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x37,0x30,0x30,0x7d,0x2e,0x62,0x6f,
-    0x64,0x79,0x2d,0x67,0x72,0x6f,0x75,0x70,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x7b,
-    0x66,0x6c,0x6f,0x61,0x74,0x3a,0x6c,0x65,0x66,0x74,0x7d,0x2e,0x62,0x6f,0x64,0x79,
-    0x2d,0x67,0x72,0x6f,0x75,0x70,0x2d,0x69,0x6e,0x66,0x6f,0x7b,0x64,0x69,0x73,0x70,
-    0x6c,0x61,0x79,0x3a,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x3b,0x66,0x6f,0x6e,0x74,0x2d,
-    0x73,0x69,0x7a,0x65,0x3a,0x31,0x2e,0x32,0x65,0x6d,0x7d,0x2e,0x62,0x6f,0x64,0x79,
-    0x2d,0x6e,0x61,0x6d,0x65,0x7b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x31,0x30,
-    0x70,0x78,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,
-    0x6c,0x6f,0x72,0x3a,0x23,0x33,0x30,0x33,0x30,0x33,0x30,0x3b,0x77,0x69,0x64,0x74,
-    0x68,0x3a,0x31,0x30,0x30,0x25,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,
-    0x3a,0x31,0x2e,0x35,0x65,0x6d,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x66,
-    0x66,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x7b,0x64,0x69,0x73,
-    0x70,0x6c,0x61,0x79,0x3a,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x63,0x6c,0x65,0x61,0x72,
-    0x3a,0x62,0x6f,0x74,0x68,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,
-    0x2d,0x32,0x2d,0x63,0x6f,0x6c,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x66,
-    0x6c,0x65,0x78,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x63,
-    0x6f,0x6c,0x7b,0x66,0x6c,0x65,0x78,0x3a,0x35,0x30,0x25,0x7d,0x2e,0x62,0x6f,0x64,
-    0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x63,0x6f,0x6c,0x73,0x65,0x70,0x7b,0x77,0x69,
-    0x64,0x74,0x68,0x3a,0x31,0x35,0x70,0x78,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x66,
-    0x6f,0x72,0x6d,0x2d,0x6c,0x69,0x6e,0x65,0x7b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,
-    0x3a,0x35,0x70,0x78,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,
-    0x6c,0x61,0x62,0x65,0x6c,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x36,0x34,0x35,
-    0x32,0x33,0x63,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,
-    0x37,0x30,0x30,0x3b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x66,0x6c,0x65,0x78,
-    0x3b,0x6a,0x75,0x73,0x74,0x69,0x66,0x79,0x2d,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,
-    0x3a,0x73,0x70,0x61,0x63,0x65,0x2d,0x62,0x65,0x74,0x77,0x65,0x65,0x6e,0x7d,0x2e,
-    0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x66,0x69,0x65,0x6c,0x64,0x7b,
-    0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x30,0x30,0x25,0x3b,0x62,0x61,0x63,0x6b,0x67,
-    0x72,0x6f,0x75,0x6e,0x64,0x3a,0x23,0x61,0x38,0x39,0x30,0x36,0x32,0x3b,0x63,0x6f,
-    0x6c,0x6f,0x72,0x3a,0x23,0x66,0x66,0x66,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,
-    0x6e,0x6f,0x6e,0x65,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,
-    0x34,0x70,0x74,0x7d,0x74,0x65,0x78,0x74,0x61,0x72,0x65,0x61,0x2e,0x62,0x6f,0x64,
-    0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x66,0x69,0x65,0x6c,0x64,0x7b,0x62,0x6f,0x78,
-    0x2d,0x73,0x69,0x7a,0x69,0x6e,0x67,0x3a,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x62,
-    0x6f,0x78,0x3b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x31,0x30,0x30,0x25,0x7d,0x2e,
-    0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x6c,0x61,0x62,0x65,0x6c,0x2d,
-    0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x7b,0x6d,0x61,0x72,0x67,0x69,0x6e,
-    0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x31,0x32,0x70,0x78,0x3b,0x2d,0x77,0x65,
-    0x62,0x6b,0x69,0x74,0x2d,0x75,0x73,0x65,0x72,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,
-    0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x2d,0x6d,0x6f,0x7a,0x2d,0x75,0x73,0x65,0x72,0x2d,
-    0x73,0x65,0x6c,0x65,0x63,0x74,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x2d,0x6d,0x73,0x2d,
-    0x75,0x73,0x65,0x72,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x3a,0x6e,0x6f,0x6e,0x65,
-    0x3b,0x75,0x73,0x65,0x72,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x3a,0x6e,0x6f,0x6e,
-    0x65,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x6c,0x61,0x62,
-    0x65,0x6c,0x2d,0x63,0x68,0x65,0x63,0x6b,0x62,0x6f,0x78,0x7b,0x64,0x69,0x73,0x70,
-    0x6c,0x61,0x79,0x3a,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x70,0x6f,0x73,0x69,0x74,0x69,
-    0x6f,0x6e,0x3a,0x72,0x65,0x6c,0x61,0x74,0x69,0x76,0x65,0x3b,0x70,0x61,0x64,0x64,
-    0x69,0x6e,0x67,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x33,0x35,0x70,0x78,0x3b,0x6d,0x61,
-    0x72,0x67,0x69,0x6e,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x31,0x32,0x70,0x78,
-    0x3b,0x63,0x75,0x72,0x73,0x6f,0x72,0x3a,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x3b,
-    0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,0x75,0x73,0x65,0x72,0x2d,0x73,0x65,0x6c,
-    0x65,0x63,0x74,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x2d,0x6d,0x6f,0x7a,0x2d,0x75,0x73,
-    0x65,0x72,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x2d,
-    0x6d,0x73,0x2d,0x75,0x73,0x65,0x72,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x3a,0x6e,
-    0x6f,0x6e,0x65,0x3b,0x75,0x73,0x65,0x72,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x3a,
-    0x6e,0x6f,0x6e,0x65,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,
-    0x6c,0x61,0x62,0x65,0x6c,0x2d,0x63,0x68,0x65,0x63,0x6b,0x62,0x6f,0x78,0x20,0x69,
-    0x6e,0x70,0x75,0x74,0x7b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,0x62,
-    0x73,0x6f,0x6c,0x75,0x74,0x65,0x3b,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x3a,0x30,
-    0x3b,0x63,0x75,0x72,0x73,0x6f,0x72,0x3a,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x3b,
-    0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x30,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x30,
-    0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x63,0x68,0x65,0x63,
-    0x6b,0x6d,0x61,0x72,0x6b,0x7b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,
-    0x62,0x73,0x6f,0x6c,0x75,0x74,0x65,0x3b,0x74,0x6f,0x70,0x3a,0x30,0x3b,0x6c,0x65,
-    0x66,0x74,0x3a,0x30,0x3b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x32,0x35,0x70,0x78,
-    0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x32,0x35,0x70,0x78,0x3b,0x62,0x61,0x63,0x6b,
-    0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x65,0x65,
-    0x65,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x6c,0x61,0x62,
-    0x65,0x6c,0x2d,0x63,0x68,0x65,0x63,0x6b,0x62,0x6f,0x78,0x3a,0x68,0x6f,0x76,0x65,
-    0x72,0x20,0x69,0x6e,0x70,0x75,0x74,0x7e,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,
-    0x72,0x6d,0x2d,0x63,0x68,0x65,0x63,0x6b,0x6d,0x61,0x72,0x6b,0x7b,0x62,0x61,0x63,
-    0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x37,
-    0x34,0x62,0x35,0x62,0x31,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,
-    0x2d,0x6c,0x61,0x62,0x65,0x6c,0x2d,0x63,0x68,0x65,0x63,0x6b,0x62,0x6f,0x78,0x20,
-    0x69,0x6e,0x70,0x75,0x74,0x3a,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x7e,0x2e,0x62,
-    0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x63,0x68,0x65,0x63,0x6b,0x6d,0x61,
-    0x72,0x6b,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,
-    0x6c,0x6f,0x72,0x3a,0x23,0x34,0x30,0x37,0x65,0x61,0x36,0x7d,0x2e,0x62,0x6f,0x64,
-    0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x63,0x68,0x65,0x63,0x6b,0x6d,0x61,0x72,0x6b,
-    0x3a,0x61,0x66,0x74,0x65,0x72,0x7b,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3a,0x22,
-    0x22,0x3b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,0x62,0x73,0x6f,0x6c,
-    0x75,0x74,0x65,0x3b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x6e,0x6f,0x6e,0x65,
-    0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x6c,0x61,0x62,0x65,
-    0x6c,0x2d,0x63,0x68,0x65,0x63,0x6b,0x62,0x6f,0x78,0x20,0x69,0x6e,0x70,0x75,0x74,
-    0x3a,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x7e,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x66,
-    0x6f,0x72,0x6d,0x2d,0x63,0x68,0x65,0x63,0x6b,0x6d,0x61,0x72,0x6b,0x3a,0x61,0x66,
-    0x74,0x65,0x72,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x62,0x6c,0x6f,0x63,
-    0x6b,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x6c,0x61,0x62,
-    0x65,0x6c,0x2d,0x63,0x68,0x65,0x63,0x6b,0x62,0x6f,0x78,0x20,0x2e,0x62,0x6f,0x64,
-    0x79,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x63,0x68,0x65,0x63,0x6b,0x6d,0x61,0x72,0x6b,
-    0x3a,0x61,0x66,0x74,0x65,0x72,0x7b,0x6c,0x65,0x66,0x74,0x3a,0x39,0x70,0x78,0x3b,
-    0x74,0x6f,0x70,0x3a,0x35,0x70,0x78,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x35,0x70,
-    0x78,0x3b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x31,0x30,0x70,0x78,0x3b,0x62,0x6f,
-    0x72,0x64,0x65,0x72,0x3a,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,0x66,0x66,0x66,0x3b,
-    0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x30,0x20,0x33,
-    0x70,0x78,0x20,0x33,0x70,0x78,0x20,0x30,0x3b,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,
-    0x2d,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3a,0x72,0x6f,0x74,0x61,0x74,
-    0x65,0x28,0x34,0x35,0x64,0x65,0x67,0x29,0x3b,0x2d,0x6d,0x73,0x2d,0x74,0x72,0x61,
-    0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3a,0x72,0x6f,0x74,0x61,0x74,0x65,0x28,0x34,0x35,
-    0x64,0x65,0x67,0x29,0x3b,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3a,0x72,
-    0x6f,0x74,0x61,0x74,0x65,0x28,0x34,0x35,0x64,0x65,0x67,0x29,0x7d,0x2e,0x62,0x6f,
-    0x64,0x79,0x2d,0x76,0x69,0x65,0x77,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x30,
-    0x30,0x25,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,
-    0x6c,0x6f,0x72,0x3a,0x23,0x61,0x38,0x39,0x30,0x36,0x32,0x3b,0x64,0x69,0x73,0x70,
-    0x6c,0x61,0x79,0x3a,0x66,0x6c,0x65,0x78,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x63,
-    0x61,0x6e,0x76,0x61,0x73,0x7b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x32,0x30,0x70,
-    0x78,0x20,0x61,0x75,0x74,0x6f,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x66,0x69,0x65,
-    0x6c,0x64,0x73,0x65,0x74,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x6e,0x6f,0x6e,
-    0x65,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x6c,0x69,0x73,0x74,0x7b,0x70,0x61,0x64,
-    0x64,0x69,0x6e,0x67,0x3a,0x35,0x70,0x78,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,
-    0x6c,0x65,0x66,0x74,0x3a,0x61,0x75,0x74,0x6f,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,
-    0x2d,0x72,0x69,0x67,0x68,0x74,0x3a,0x61,0x75,0x74,0x6f,0x3b,0x77,0x69,0x64,0x74,
-    0x68,0x3a,0x31,0x30,0x30,0x25,0x3b,0x6d,0x69,0x6e,0x2d,0x68,0x65,0x69,0x67,0x68,
-    0x74,0x3a,0x34,0x30,0x70,0x78,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x6c,0x69,0x73,
-    0x74,0x2d,0x6c,0x69,0x6e,0x65,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x62,
-    0x6c,0x6f,0x63,0x6b,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x31,0x30,0x70,
-    0x78,0x3b,0x63,0x6c,0x65,0x61,0x72,0x3a,0x62,0x6f,0x74,0x68,0x7d,0x2e,0x62,0x6f,
-    0x64,0x79,0x2d,0x6c,0x69,0x73,0x74,0x2d,0x64,0x72,0x61,0x67,0x67,0x61,0x62,0x6c,
-    0x65,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x23,0x34,0x30,
-    0x37,0x65,0x61,0x36,0x3b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x69,0x6e,0x6c,
-    0x69,0x6e,0x65,0x2d,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,
-    0x67,0x3a,0x34,0x70,0x78,0x20,0x38,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,
-    0x69,0x7a,0x65,0x3a,0x31,0x65,0x6d,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,
-    0x61,0x66,0x63,0x65,0x65,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,
-    0x69,0x75,0x73,0x3a,0x36,0x70,0x78,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x6c,0x69,
-    0x73,0x74,0x2d,0x69,0x74,0x65,0x6d,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,
-    0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x70,0x61,0x64,
-    0x64,0x69,0x6e,0x67,0x3a,0x31,0x30,0x70,0x78,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,
-    0x67,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x32,0x30,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,
-    0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x2e,0x32,0x65,0x6d,0x3b,0x63,0x6f,0x6c,0x6f,
-    0x72,0x3a,0x23,0x66,0x61,0x66,0x63,0x65,0x65,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,
-    0x6c,0x69,0x73,0x74,0x2d,0x73,0x6d,0x61,0x6c,0x6c,0x7b,0x70,0x61,0x64,0x64,0x69,
-    0x6e,0x67,0x3a,0x35,0x70,0x78,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x6c,0x69,0x73,
-    0x74,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x7b,0x6d,0x61,0x72,0x67,0x69,0x6e,
-    0x2d,0x72,0x69,0x67,0x68,0x74,0x3a,0x32,0x30,0x70,0x78,0x3b,0x66,0x6c,0x6f,0x61,
-    0x74,0x3a,0x72,0x69,0x67,0x68,0x74,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,
-    0x74,0x6f,0x70,0x3a,0x31,0x30,0x70,0x78,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x6c,
-    0x69,0x73,0x74,0x2d,0x66,0x69,0x6c,0x65,0x74,0x79,0x70,0x65,0x7b,0x62,0x61,0x63,
-    0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x23,0x37,0x34,0x62,0x35,0x62,0x31,0x3b,
-    0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x62,
-    0x6c,0x6f,0x63,0x6b,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x33,0x70,0x78,
-    0x20,0x36,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x2e,
-    0x38,0x65,0x6d,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x61,0x66,0x63,0x65,
-    0x65,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,
-    0x36,0x70,0x78,0x3b,0x6c,0x69,0x6e,0x65,0x2d,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,
-    0x31,0x2e,0x32,0x65,0x6d,0x3b,0x6d,0x69,0x6e,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,
-    0x35,0x65,0x6d,0x3b,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x63,
-    0x65,0x6e,0x74,0x65,0x72,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x6c,0x69,0x73,0x74,
-    0x2d,0x69,0x74,0x65,0x6d,0x20,0x73,0x70,0x61,0x6e,0x7b,0x63,0x6f,0x6c,0x6f,0x72,
-    0x3a,0x23,0x66,0x61,0x66,0x63,0x65,0x65,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x6c,
-    0x69,0x73,0x74,0x2d,0x65,0x64,0x69,0x74,0x20,0x73,0x70,0x61,0x6e,0x7b,0x63,0x6f,
-    0x6c,0x6f,0x72,0x3a,0x23,0x66,0x61,0x66,0x63,0x65,0x65,0x7d,0x2e,0x62,0x6f,0x64,
-    0x79,0x2d,0x6c,0x69,0x73,0x74,0x2d,0x62,0x75,0x74,0x74,0x6f,0x6e,0x7b,0x63,0x6f,
-    0x6c,0x6f,0x72,0x3a,0x23,0x39,0x34,0x66,0x33,0x66,0x66,0x3b,0x63,0x75,0x72,0x73,
-    0x6f,0x72,0x3a,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x7d,0x2e,0x62,0x6f,0x64,0x79,
-    0x2d,0x73,0x74,0x61,0x74,0x75,0x73,0x2d,0x62,0x6f,0x78,0x7b,0x63,0x6f,0x6c,0x6f,
-    0x72,0x3a,0x23,0x64,0x35,0x33,0x35,0x34,0x65,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,
-    0x63,0x6f,0x6e,0x66,0x69,0x67,0x7b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x32,
-    0x30,0x70,0x78,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x74,0x6f,0x70,0x3a,0x33,
-    0x30,0x70,0x78,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x30,0x30,0x25,0x3b,0x66,
-    0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x2e,0x35,0x65,0x6d,0x3b,0x63,
-    0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x30,0x66,0x30,0x66,0x30,0x7d,0x2e,0x62,0x6f,
-    0x64,0x79,0x2d,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x64,0x7b,0x70,0x61,0x64,0x64,
-    0x69,0x6e,0x67,0x2d,0x74,0x6f,0x70,0x3a,0x31,0x30,0x70,0x78,0x3b,0x70,0x61,0x64,
-    0x64,0x69,0x6e,0x67,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x31,0x30,0x70,0x78,
-    0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x74,0x6f,0x70,0x3a,0x33,0x30,0x70,0x78,
-    0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,
-    0x72,0x3a,0x23,0x32,0x30,0x32,0x30,0x32,0x30,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,
-    0x31,0x30,0x30,0x25,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,
-    0x2e,0x32,0x65,0x6d,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x30,0x30,0x30,0x3b,
-    0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x63,0x65,0x6e,0x74,0x65,
-    0x72,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x64,
-    0x20,0x61,0x7b,0x74,0x65,0x78,0x74,0x2d,0x64,0x65,0x63,0x6f,0x72,0x61,0x74,0x69,
-    0x6f,0x6e,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x67,0x72,
-    0x65,0x79,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x6e,0x61,0x6d,0x65,0x2d,0x65,0x64,
-    0x69,0x74,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x65,0x6d,
-    0x7d,0x2e,0x62,0x6f,0x64,0x79,0x2d,0x6e,0x75,0x6d,0x2d,0x65,0x64,0x69,0x74,0x7b,
-    0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x65,0x6d,0x7d,0x2e,0x62,
-    0x6f,0x64,0x79,0x2d,0x6e,0x61,0x6d,0x65,0x2d,0x65,0x64,0x69,0x74,0x7b,0x66,0x6f,
-    0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x65,0x6d,0x7d,0x2e,0x62,0x75,0x74,
-    0x74,0x6f,0x6e,0x2d,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x7b,0x70,0x61,0x64,0x64,
-    0x69,0x6e,0x67,0x2d,0x72,0x69,0x67,0x68,0x74,0x3a,0x31,0x35,0x70,0x78,0x7d,0x2e,
-    0x62,0x61,0x63,0x6b,0x48,0x65,0x61,0x64,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,
-    0x75,0x6e,0x64,0x3a,0x23,0x34,0x30,0x37,0x65,0x61,0x36,0x7d,0x2e,0x62,0x61,0x63,
-    0x6b,0x47,0x72,0x61,0x64,0x31,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,
-    0x64,0x3a,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,0x6c,0x69,0x6e,0x65,0x61,0x72,
-    0x2d,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x28,0x74,0x6f,0x70,0x2c,0x23,0x34,
-    0x65,0x39,0x61,0x38,0x63,0x20,0x30,0x2c,0x23,0x37,0x30,0x61,0x62,0x39,0x66,0x20,
-    0x31,0x30,0x70,0x78,0x2c,0x23,0x37,0x38,0x62,0x66,0x63,0x31,0x20,0x31,0x30,0x30,
-    0x25,0x29,0x7d,0x2e,0x62,0x61,0x63,0x6b,0x47,0x72,0x61,0x64,0x32,0x7b,0x62,0x61,
-    0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,
-    0x2d,0x6c,0x69,0x6e,0x65,0x61,0x72,0x2d,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,
-    0x28,0x74,0x6f,0x70,0x2c,0x23,0x62,0x34,0x39,0x65,0x37,0x33,0x20,0x30,0x2c,0x23,
-    0x63,0x30,0x61,0x38,0x37,0x61,0x20,0x31,0x30,0x70,0x78,0x2c,0x23,0x63,0x30,0x61,
-    0x38,0x37,0x61,0x20,0x31,0x30,0x30,0x25,0x29,0x7d,0x2e,0x62,0x61,0x63,0x6b,0x47,
-    0x72,0x61,0x64,0x33,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,
-    0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,0x6c,0x69,0x6e,0x65,0x61,0x72,0x2d,0x67,
-    0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x28,0x74,0x6f,0x70,0x2c,0x23,0x62,0x39,0x61,
-    0x38,0x38,0x38,0x20,0x30,0x2c,0x23,0x63,0x39,0x62,0x36,0x39,0x33,0x20,0x31,0x30,
-    0x70,0x78,0x2c,0x23,0x65,0x33,0x63,0x64,0x61,0x36,0x20,0x31,0x30,0x30,0x25,0x29,
-    0x7d,0x2e,0x64,0x72,0x6f,0x70,0x2d,0x7a,0x6f,0x6e,0x65,0x2e,0x68,0x69,0x67,0x68,
-    0x6c,0x69,0x67,0x68,0x74,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,
-    0x3a,0x23,0x39,0x34,0x37,0x65,0x35,0x33,0x7d,0x2e,0x68,0x69,0x64,0x64,0x65,0x6e,
-    0x7b,0x76,0x69,0x73,0x69,0x62,0x69,0x6c,0x69,0x74,0x79,0x3a,0x68,0x69,0x64,0x64,
-    0x65,0x6e,0x7d,0x2e,0x6e,0x6f,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x7b,0x76,0x69,
-    0x73,0x69,0x62,0x69,0x6c,0x69,0x74,0x79,0x3a,0x68,0x69,0x64,0x64,0x65,0x6e,0x7d,
-    0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,
-    0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x61,0x66,0x63,0x65,
-    0x65,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,
-    0x66,0x61,0x66,0x63,0x65,0x65,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,
-    0x64,0x69,0x75,0x73,0x3a,0x35,0x70,0x78,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,
-    0x34,0x30,0x37,0x65,0x61,0x36,0x7d,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x3a,
-    0x3a,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,
-    0x73,0x2d,0x62,0x61,0x72,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,
-    0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x34,0x30,0x37,0x65,0x61,0x36,0x3b,0x62,
-    0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x61,0x66,
-    0x63,0x65,0x65,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,
-    0x73,0x3a,0x35,0x70,0x78,0x7d,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x3a,0x3a,
-    0x2d,0x6d,0x6f,0x7a,0x2d,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x2d,0x62,0x61,
-    0x72,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,
-    0x6f,0x72,0x3a,0x23,0x34,0x30,0x37,0x65,0x61,0x36,0x3b,0x62,0x6f,0x72,0x64,0x65,
-    0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x35,0x70,0x78,0x3b,0x62,0x6f,0x72,
-    0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x61,0x66,0x63,0x65,
-    0x65,0x7d,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x3a,0x3a,0x2d,0x77,0x65,0x62,
-    0x6b,0x69,0x74,0x2d,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x2d,0x76,0x61,0x6c,
-    0x75,0x65,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,
-    0x6c,0x6f,0x72,0x3a,0x23,0x34,0x30,0x37,0x65,0x61,0x36,0x3b,0x62,0x6f,0x72,0x64,
-    0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x35,0x70,0x78,0x3b,0x62,0x6f,
-    0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x61,0x66,0x63,
-    0x65,0x65,0x7d,0x2e,0x69,0x63,0x6f,0x6e,0x2d,0x74,0x6f,0x6f,0x6c,0x62,0x61,0x72,
-    0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x61,0x66,0x63,0x65,0x65,0x3b,0x66,
-    0x69,0x6c,0x6c,0x3a,0x23,0x66,0x61,0x66,0x63,0x65,0x65,0x3b,0x77,0x69,0x64,0x74,
-    0x68,0x3a,0x34,0x38,0x70,0x78,0x3b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x34,0x38,
-    0x70,0x78,0x3b,0x76,0x65,0x72,0x74,0x69,0x63,0x61,0x6c,0x2d,0x61,0x6c,0x69,0x67,
-    0x6e,0x3a,0x6d,0x69,0x64,0x64,0x6c,0x65,0x7d,0x2e,0x69,0x63,0x6f,0x6e,0x2d,0x61,
-    0x63,0x74,0x69,0x6f,0x6e,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x61,0x66,
-    0x63,0x65,0x65,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x66,0x61,0x66,0x63,0x65,0x65,
-    0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x33,0x32,0x70,0x78,0x3b,0x68,0x65,0x69,0x67,
-    0x68,0x74,0x3a,0x33,0x32,0x70,0x78,0x3b,0x76,0x65,0x72,0x74,0x69,0x63,0x61,0x6c,
-    0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x6d,0x69,0x64,0x64,0x6c,0x65,0x3b,0x70,0x61,
-    0x64,0x64,0x69,0x6e,0x67,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x31,0x35,0x70,0x78,0x7d,
-    0x2e,0x69,0x63,0x6f,0x6e,0x2d,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x7b,0x63,0x6f,0x6c,
-    0x6f,0x72,0x3a,0x23,0x66,0x61,0x66,0x63,0x65,0x65,0x3b,0x66,0x69,0x6c,0x6c,0x3a,
-    0x23,0x66,0x61,0x66,0x63,0x65,0x65,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x33,0x32,
-    0x70,0x78,0x3b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x33,0x32,0x70,0x78,0x3b,0x76,
-    0x65,0x72,0x74,0x69,0x63,0x61,0x6c,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x6d,0x69,
-    0x64,0x64,0x6c,0x65,0x7d,0x2e,0x72,0x69,0x67,0x68,0x74,0x7b,0x66,0x6c,0x6f,0x61,
-    0x74,0x3a,0x72,0x69,0x67,0x68,0x74,0x7d,0x2e,0x69,0x63,0x6f,0x6e,0x2d,0x72,0x65,
-    0x64,0x7b,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x64,0x35,0x33,0x35,0x34,0x65,0x3b,0x63,
-    0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x64,0x35,0x33,0x35,0x34,0x65,0x7d,0x2e,0x77,0x61,
-    0x72,0x6e,0x69,0x6e,0x67,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x64,0x35,0x33,
-    0x35,0x34,0x65,0x7d,0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,0x2d,0x73,0x74,0x79,0x6c,
-    0x65,0x7b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x72,0x65,0x6c,0x61,0x74,
-    0x69,0x76,0x65,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x35,0x72,0x65,0x6d,0x7d,
-    0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,0x2d,0x73,0x74,0x79,0x6c,0x65,0x20,0x73,0x65,
-    0x6c,0x65,0x63,0x74,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x6e,0x6f,0x6e,
-    0x65,0x7d,0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,
-    0x65,0x64,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,
-    0x6c,0x6f,0x72,0x3a,0x23,0x61,0x38,0x39,0x30,0x36,0x32,0x7d,0x2e,0x73,0x65,0x6c,
-    0x65,0x63,0x74,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x3a,0x61,0x66,0x74,
-    0x65,0x72,0x7b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,0x62,0x73,0x6f,
-    0x6c,0x75,0x74,0x65,0x3b,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3a,0x22,0x22,0x3b,
-    0x74,0x6f,0x70,0x3a,0x31,0x34,0x70,0x78,0x3b,0x72,0x69,0x67,0x68,0x74,0x3a,0x31,
-    0x30,0x70,0x78,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x30,0x3b,0x68,0x65,0x69,0x67,
-    0x68,0x74,0x3a,0x30,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x36,0x70,0x78,0x20,
-    0x73,0x6f,0x6c,0x69,0x64,0x20,0x74,0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,0x6e,
-    0x74,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,
-    0x36,0x34,0x35,0x32,0x33,0x63,0x20,0x74,0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,
-    0x6e,0x74,0x20,0x74,0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,0x6e,0x74,0x20,0x74,
-    0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,0x6e,0x74,0x7d,0x2e,0x73,0x65,0x6c,0x65,
-    0x63,0x74,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x2e,0x73,0x65,0x6c,0x65,
-    0x63,0x74,0x2d,0x61,0x72,0x72,0x6f,0x77,0x2d,0x61,0x63,0x74,0x69,0x76,0x65,0x3a,
-    0x61,0x66,0x74,0x65,0x72,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,
-    0x6f,0x72,0x3a,0x74,0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,0x6e,0x74,0x20,0x74,
-    0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,0x6e,0x74,0x20,0x23,0x36,0x34,0x35,0x32,
-    0x33,0x63,0x20,0x74,0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,0x6e,0x74,0x3b,0x74,
-    0x6f,0x70,0x3a,0x37,0x70,0x78,0x7d,0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,0x2d,0x69,
-    0x74,0x65,0x6d,0x73,0x20,0x64,0x69,0x76,0x2c,0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,
-    0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x7b,0x70,0x61,0x64,0x64,0x69,0x6e,
-    0x67,0x3a,0x38,0x70,0x78,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x31,0x70,0x78,
-    0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x74,0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,
-    0x6e,0x74,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,
-    0x74,0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,0x6e,0x74,0x20,0x74,0x72,0x61,0x6e,
-    0x73,0x70,0x61,0x72,0x65,0x6e,0x74,0x20,0x72,0x67,0x62,0x61,0x28,0x30,0x2c,0x30,
-    0x2c,0x30,0x2c,0x2e,0x31,0x29,0x20,0x74,0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,
-    0x6e,0x74,0x3b,0x63,0x75,0x72,0x73,0x6f,0x72,0x3a,0x70,0x6f,0x69,0x6e,0x74,0x65,
-    0x72,0x3b,0x75,0x73,0x65,0x72,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x3a,0x6e,0x6f,
-    0x6e,0x65,0x7d,0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,0x2d,0x73,0x65,0x6c,0x65,0x63,
-    0x74,0x65,0x64,0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,0x2d,0x61,0x72,0x72,0x6f,0x77,
-    0x2d,0x61,0x63,0x74,0x69,0x76,0x65,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x62,
-    0x6f,0x74,0x74,0x6f,0x6d,0x2d,0x6c,0x65,0x66,0x74,0x2d,0x72,0x61,0x64,0x69,0x75,
-    0x73,0x3a,0x30,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x62,0x6f,0x74,0x74,0x6f,
-    0x6d,0x2d,0x72,0x69,0x67,0x68,0x74,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x30,
-    0x7d,0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,0x2d,0x6c,0x61,0x73,0x74,0x2d,0x6f,0x70,
-    0x74,0x69,0x6f,0x6e,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x62,0x6f,0x74,0x74,
-    0x6f,0x6d,0x2d,0x6c,0x65,0x66,0x74,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x35,
-    0x70,0x78,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,
-    0x2d,0x72,0x69,0x67,0x68,0x74,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x35,0x70,
-    0x78,0x7d,0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,0x2d,0x69,0x74,0x65,0x6d,0x73,0x7b,
-    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,0x62,0x73,0x6f,0x6c,0x75,0x74,
-    0x65,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,
-    0x6f,0x72,0x3a,0x23,0x61,0x61,0x38,0x36,0x34,0x39,0x3b,0x74,0x6f,0x70,0x3a,0x31,
-    0x30,0x30,0x25,0x3b,0x6c,0x65,0x66,0x74,0x3a,0x30,0x3b,0x72,0x69,0x67,0x68,0x74,
-    0x3a,0x30,0x3b,0x7a,0x2d,0x69,0x6e,0x64,0x65,0x78,0x3a,0x39,0x39,0x3b,0x62,0x6f,
-    0x72,0x64,0x65,0x72,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x2d,0x6c,0x65,0x66,0x74,
-    0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x35,0x70,0x78,0x3b,0x62,0x6f,0x72,0x64,
-    0x65,0x72,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x2d,0x72,0x69,0x67,0x68,0x74,0x2d,
-    0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x35,0x70,0x78,0x7d,0x2e,0x73,0x65,0x6c,0x65,
-    0x63,0x74,0x2d,0x68,0x69,0x64,0x65,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,
-    0x6e,0x6f,0x6e,0x65,0x7d,0x2e,0x73,0x61,0x6d,0x65,0x2d,0x61,0x73,0x2d,0x73,0x65,
-    0x6c,0x65,0x63,0x74,0x65,0x64,0x2c,0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,0x2d,0x69,
-    0x74,0x65,0x6d,0x73,0x20,0x64,0x69,0x76,0x3a,0x68,0x6f,0x76,0x65,0x72,0x7b,0x62,
-    0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,
-    0x72,0x67,0x62,0x61,0x28,0x30,0x2c,0x30,0x2c,0x30,0x2c,0x2e,0x31,0x29,0x7d,0x3c,
-    0x2f,0x73,0x74,0x79,0x6c,0x65,0x3e,0x0a,0x3c,0x2f,0x68,0x65,0x61,0x64,0x3e,0x0a,
-    0x3c,0x62,0x6f,0x64,0x79,0x20,0x6f,0x6e,0x6c,0x6f,0x61,0x64,0x3d,0x22,0x62,0x6f,
-    0x64,0x79,0x49,0x73,0x4c,0x6f,0x61,0x64,0x65,0x64,0x28,0x29,0x22,0x20,0x63,0x6c,
-    0x61,0x73,0x73,0x3d,0x22,0x6e,0x6f,0x73,0x65,0x6c,0x65,0x63,0x74,0x22,0x3e,0x0a,
-    0x0a,0x09,0x3c,0x64,0x69,0x76,0x3e,0x0a,0x09,0x09,0x3c,0x64,0x69,0x76,0x20,0x69,
-    0x64,0x3d,0x22,0x70,0x61,0x67,0x65,0x48,0x65,0x61,0x64,0x65,0x72,0x22,0x3e,0x3c,
-    0x2f,0x64,0x69,0x76,0x3e,0x0a,0x09,0x09,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,
-    0x22,0x70,0x61,0x67,0x65,0x42,0x6f,0x64,0x79,0x48,0x65,0x61,0x64,0x22,0x3e,0x3c,
-    0x2f,0x64,0x69,0x76,0x3e,0x0a,0x09,0x09,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,
-    0x22,0x70,0x61,0x67,0x65,0x42,0x6f,0x64,0x79,0x46,0x6f,0x72,0x6d,0x22,0x3e,0x3c,
-    0x2f,0x64,0x69,0x76,0x3e,0x0a,0x09,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x09,0x3c,
-    0x73,0x76,0x67,0x20,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,
-    0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x32,0x30,0x30,0x30,0x2f,
-    0x73,0x76,0x67,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,0x6b,
-    0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,
-    0x6f,0x72,0x67,0x2f,0x31,0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,0x6b,0x22,0x20,
-    0x78,0x6d,0x6c,0x3a,0x73,0x70,0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,0x73,0x65,
-    0x72,0x76,0x65,0x22,0x3e,0x0a,0x0a,0x09,0x3c,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x20,
-    0x69,0x64,0x3d,0x22,0x69,0x63,0x6f,0x2d,0x73,0x74,0x6f,0x70,0x22,0x20,0x76,0x69,
-    0x65,0x77,0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x31,0x39,0x31,0x20,0x31,
-    0x39,0x31,0x22,0x3e,0x0a,0x09,0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x70,
-    0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x31,0x35,0x38,0x2e,0x39,0x31,0x32,0x2c,
-    0x30,0x48,0x33,0x31,0x2e,0x37,0x38,0x32,0x43,0x31,0x34,0x2e,0x32,0x33,0x39,0x2c,
-    0x30,0x2c,0x30,0x2c,0x31,0x34,0x2e,0x32,0x33,0x39,0x2c,0x30,0x2c,0x33,0x31,0x2e,
-    0x37,0x38,0x32,0x76,0x31,0x32,0x37,0x2e,0x31,0x33,0x63,0x30,0x2c,0x31,0x37,0x2e,
-    0x35,0x34,0x34,0x2c,0x31,0x34,0x2e,0x32,0x33,0x39,0x2c,0x33,0x31,0x2e,0x37,0x38,
-    0x32,0x2c,0x33,0x31,0x2e,0x37,0x38,0x32,0x2c,0x33,0x31,0x2e,0x37,0x38,0x32,0x0a,
-    0x09,0x09,0x09,0x68,0x31,0x32,0x37,0x2e,0x31,0x33,0x63,0x31,0x37,0x2e,0x35,0x34,
-    0x34,0x2c,0x30,0x2c,0x33,0x31,0x2e,0x37,0x38,0x32,0x2d,0x31,0x34,0x2e,0x32,0x33,
-    0x39,0x2c,0x33,0x31,0x2e,0x37,0x38,0x32,0x2d,0x33,0x31,0x2e,0x37,0x38,0x32,0x56,
-    0x33,0x31,0x2e,0x37,0x38,0x32,0x43,0x31,0x39,0x30,0x2e,0x36,0x39,0x35,0x2c,0x31,
-    0x34,0x2e,0x32,0x33,0x39,0x2c,0x31,0x37,0x36,0x2e,0x34,0x35,0x36,0x2c,0x30,0x2c,
-    0x31,0x35,0x38,0x2e,0x39,0x31,0x32,0x2c,0x30,0x7a,0x22,0x3e,0x3c,0x2f,0x70,0x61,
-    0x74,0x68,0x3e,0x0a,0x09,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x09,0x3c,0x2f,0x73,0x79,
-    0x6d,0x62,0x6f,0x6c,0x3e,0x0a,0x09,0x3c,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x20,0x69,
-    0x64,0x3d,0x22,0x69,0x63,0x6f,0x2d,0x70,0x61,0x75,0x73,0x65,0x22,0x20,0x76,0x69,
-    0x65,0x77,0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x34,0x36,0x20,0x34,0x36,
-    0x22,0x3e,0x0a,0x09,0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x70,0x61,0x74,
-    0x68,0x20,0x64,0x3d,0x22,0x4d,0x31,0x33,0x2e,0x39,0x38,0x37,0x2c,0x30,0x63,0x2d,
-    0x32,0x2e,0x37,0x36,0x32,0x2c,0x30,0x2d,0x35,0x2c,0x32,0x2e,0x32,0x33,0x39,0x2d,
-    0x35,0x2c,0x35,0x76,0x33,0x35,0x2e,0x39,0x37,0x35,0x63,0x30,0x2c,0x32,0x2e,0x37,
-    0x36,0x33,0x2c,0x32,0x2e,0x32,0x33,0x38,0x2c,0x35,0x2c,0x35,0x2c,0x35,0x73,0x35,
-    0x2d,0x32,0x2e,0x32,0x33,0x38,0x2c,0x35,0x2d,0x35,0x56,0x35,0x43,0x31,0x38,0x2e,
-    0x39,0x38,0x37,0x2c,0x32,0x2e,0x32,0x33,0x38,0x2c,0x31,0x36,0x2e,0x37,0x35,0x2c,
-    0x30,0x2c,0x31,0x33,0x2e,0x39,0x38,0x37,0x2c,0x30,0x7a,0x22,0x2f,0x3e,0x0a,0x09,
-    0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x33,0x31,0x2e,0x39,
-    0x38,0x37,0x2c,0x30,0x63,0x2d,0x32,0x2e,0x37,0x36,0x32,0x2c,0x30,0x2d,0x35,0x2c,
-    0x32,0x2e,0x32,0x33,0x39,0x2d,0x35,0x2c,0x35,0x76,0x33,0x35,0x2e,0x39,0x37,0x35,
-    0x63,0x30,0x2c,0x32,0x2e,0x37,0x36,0x32,0x2c,0x32,0x2e,0x32,0x33,0x38,0x2c,0x35,
-    0x2c,0x35,0x2c,0x35,0x73,0x35,0x2d,0x32,0x2e,0x32,0x33,0x38,0x2c,0x35,0x2d,0x35,
-    0x56,0x35,0x43,0x33,0x36,0x2e,0x39,0x38,0x37,0x2c,0x32,0x2e,0x32,0x33,0x39,0x2c,
-    0x33,0x34,0x2e,0x37,0x34,0x39,0x2c,0x30,0x2c,0x33,0x31,0x2e,0x39,0x38,0x37,0x2c,
-    0x30,0x7a,0x22,0x20,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,
-    0x3d,0x22,0x30,0x22,0x2f,0x3e,0x0a,0x09,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x09,0x3c,
-    0x2f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x3e,0x0a,0x09,0x3c,0x73,0x79,0x6d,0x62,0x6f,
-    0x6c,0x20,0x69,0x64,0x3d,0x22,0x69,0x63,0x6f,0x2d,0x70,0x6c,0x61,0x79,0x22,0x20,
-    0x76,0x69,0x65,0x77,0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x32,0x33,0x33,
-    0x20,0x32,0x33,0x33,0x22,0x3e,0x0a,0x09,0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x09,
-    0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x32,0x30,0x33,0x2e,0x37,0x39,
-    0x31,0x2c,0x39,0x39,0x2e,0x36,0x32,0x38,0x4c,0x34,0x39,0x2e,0x33,0x30,0x37,0x2c,
-    0x32,0x2e,0x32,0x39,0x34,0x63,0x2d,0x34,0x2e,0x35,0x36,0x37,0x2d,0x32,0x2e,0x37,
-    0x31,0x39,0x2d,0x31,0x30,0x2e,0x32,0x33,0x38,0x2d,0x32,0x2e,0x32,0x36,0x36,0x2d,
-    0x31,0x34,0x2e,0x35,0x32,0x31,0x2d,0x32,0x2e,0x32,0x36,0x36,0x0a,0x09,0x09,0x09,
-    0x63,0x2d,0x31,0x37,0x2e,0x31,0x33,0x32,0x2c,0x30,0x2d,0x31,0x37,0x2e,0x30,0x35,
-    0x36,0x2c,0x31,0x33,0x2e,0x32,0x32,0x37,0x2d,0x31,0x37,0x2e,0x30,0x35,0x36,0x2c,
-    0x31,0x36,0x2e,0x35,0x37,0x38,0x76,0x31,0x39,0x38,0x2e,0x39,0x34,0x63,0x30,0x2c,
-    0x32,0x2e,0x38,0x33,0x33,0x2d,0x30,0x2e,0x30,0x37,0x35,0x2c,0x31,0x36,0x2e,0x35,
-    0x37,0x39,0x2c,0x31,0x37,0x2e,0x30,0x35,0x36,0x2c,0x31,0x36,0x2e,0x35,0x37,0x39,
-    0x63,0x34,0x2e,0x32,0x38,0x33,0x2c,0x30,0x2c,0x39,0x2e,0x39,0x35,0x35,0x2c,0x30,
-    0x2e,0x34,0x35,0x31,0x2c,0x31,0x34,0x2e,0x35,0x32,0x31,0x2d,0x32,0x2e,0x32,0x36,
-    0x37,0x0a,0x09,0x09,0x09,0x6c,0x31,0x35,0x34,0x2e,0x34,0x38,0x33,0x2d,0x39,0x37,
-    0x2e,0x33,0x33,0x33,0x63,0x31,0x32,0x2e,0x36,0x38,0x2d,0x37,0x2e,0x35,0x34,0x35,
-    0x2c,0x31,0x30,0x2e,0x34,0x38,0x39,0x2d,0x31,0x36,0x2e,0x34,0x34,0x39,0x2c,0x31,
-    0x30,0x2e,0x34,0x38,0x39,0x2d,0x31,0x36,0x2e,0x34,0x34,0x39,0x53,0x32,0x31,0x36,
-    0x2e,0x34,0x37,0x31,0x2c,0x31,0x30,0x37,0x2e,0x31,0x37,0x32,0x2c,0x32,0x30,0x33,
-    0x2e,0x37,0x39,0x31,0x2c,0x39,0x39,0x2e,0x36,0x32,0x38,0x7a,0x22,0x20,0x73,0x74,
-    0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x30,0x22,0x2f,0x3e,
-    0x0a,0x09,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x09,0x3c,0x2f,0x73,0x79,0x6d,0x62,0x6f,
-    0x6c,0x3e,0x0a,0x09,0x3c,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x20,0x69,0x64,0x3d,0x22,
-    0x69,0x63,0x6f,0x2d,0x70,0x6c,0x61,0x79,0x70,0x61,0x75,0x73,0x65,0x22,0x20,0x76,
-    0x69,0x65,0x77,0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x34,0x36,0x20,0x34,
-    0x36,0x22,0x3e,0x0a,0x09,0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x70,0x61,
-    0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x39,0x2e,0x36,0x32,0x39,0x2c,0x34,0x34,0x2e,
-    0x36,0x38,0x20,0x63,0x20,0x2d,0x31,0x2e,0x31,0x35,0x34,0x2c,0x31,0x2e,0x31,0x36,
-    0x20,0x2d,0x32,0x2e,0x38,0x39,0x35,0x2c,0x31,0x2e,0x35,0x31,0x20,0x2d,0x34,0x2e,
-    0x34,0x30,0x37,0x2c,0x30,0x2e,0x38,0x38,0x35,0x20,0x2d,0x31,0x2e,0x35,0x31,0x33,
-    0x2c,0x2d,0x30,0x2e,0x36,0x32,0x33,0x20,0x2d,0x32,0x2e,0x35,0x2c,0x2d,0x32,0x2e,
-    0x31,0x20,0x2d,0x32,0x2e,0x35,0x2c,0x2d,0x33,0x2e,0x37,0x33,0x35,0x20,0x56,0x20,
-    0x34,0x2e,0x30,0x34,0x33,0x20,0x0a,0x09,0x09,0x09,0x63,0x20,0x30,0x2c,0x2d,0x31,
-    0x2e,0x36,0x33,0x37,0x20,0x30,0x2e,0x39,0x38,0x37,0x2c,0x2d,0x33,0x2e,0x31,0x31,
-    0x32,0x20,0x32,0x2e,0x35,0x2c,0x2d,0x33,0x2e,0x37,0x33,0x36,0x20,0x31,0x2e,0x35,
-    0x31,0x33,0x2c,0x2d,0x30,0x2e,0x36,0x32,0x35,0x20,0x33,0x2e,0x32,0x35,0x33,0x2c,
-    0x2d,0x30,0x2e,0x32,0x37,0x35,0x20,0x34,0x2e,0x34,0x30,0x37,0x2c,0x30,0x2e,0x38,
-    0x38,0x35,0x20,0x6c,0x20,0x31,0x37,0x2e,0x38,0x36,0x32,0x2c,0x31,0x37,0x2e,0x39,
-    0x35,0x31,0x20,0x63,0x20,0x32,0x2e,0x30,0x38,0x38,0x2c,0x32,0x2e,0x30,0x39,0x38,
-    0x20,0x32,0x2e,0x30,0x38,0x38,0x2c,0x35,0x2e,0x34,0x38,0x38,0x20,0x30,0x2c,0x37,
-    0x2e,0x35,0x38,0x35,0x20,0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x70,0x61,
-    0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x33,0x38,0x2e,0x32,0x35,0x32,0x2c,0x34,0x35,
-    0x2e,0x39,0x37,0x35,0x20,0x63,0x20,0x2d,0x32,0x2e,0x37,0x36,0x33,0x2c,0x30,0x20,
-    0x2d,0x35,0x2c,0x2d,0x32,0x2e,0x32,0x33,0x38,0x20,0x2d,0x35,0x2c,0x2d,0x35,0x20,
-    0x56,0x20,0x35,0x20,0x63,0x20,0x30,0x2c,0x2d,0x32,0x2e,0x37,0x36,0x32,0x20,0x32,
-    0x2e,0x32,0x33,0x37,0x2c,0x2d,0x35,0x20,0x35,0x2c,0x2d,0x35,0x20,0x32,0x2e,0x37,
-    0x36,0x32,0x2c,0x30,0x20,0x35,0x2c,0x32,0x2e,0x32,0x33,0x38,0x20,0x35,0x2c,0x35,
-    0x20,0x76,0x20,0x33,0x35,0x2e,0x39,0x37,0x35,0x20,0x0a,0x09,0x09,0x09,0x63,0x20,
-    0x30,0x2c,0x32,0x2e,0x37,0x36,0x31,0x20,0x2d,0x32,0x2e,0x32,0x33,0x39,0x2c,0x35,
-    0x20,0x2d,0x35,0x2c,0x35,0x20,0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x09,0x3c,0x2f,0x67,
-    0x3e,0x0a,0x09,0x3c,0x2f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x3e,0x0a,0x09,0x3c,0x73,
-    0x79,0x6d,0x62,0x6f,0x6c,0x20,0x69,0x64,0x3d,0x22,0x69,0x63,0x6f,0x2d,0x64,0x65,
-    0x6c,0x65,0x74,0x65,0x22,0x20,0x76,0x69,0x65,0x77,0x42,0x6f,0x78,0x3d,0x22,0x30,
-    0x20,0x30,0x20,0x32,0x36,0x20,0x32,0x36,0x22,0x3e,0x0a,0x09,0x09,0x3c,0x67,0x3e,
-    0x0a,0x09,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x20,0x31,
-    0x31,0x20,0x2d,0x30,0x2e,0x30,0x33,0x31,0x32,0x35,0x20,0x43,0x20,0x31,0x30,0x2e,
-    0x31,0x36,0x34,0x30,0x36,0x33,0x20,0x2d,0x30,0x2e,0x30,0x33,0x31,0x32,0x35,0x20,
-    0x39,0x2e,0x33,0x34,0x33,0x37,0x35,0x20,0x30,0x2e,0x31,0x33,0x32,0x38,0x31,0x33,
-    0x20,0x38,0x2e,0x37,0x35,0x20,0x30,0x2e,0x37,0x31,0x38,0x37,0x35,0x20,0x43,0x20,
-    0x38,0x2e,0x31,0x35,0x36,0x32,0x35,0x20,0x31,0x2e,0x33,0x30,0x34,0x36,0x38,0x38,
-    0x20,0x37,0x2e,0x39,0x36,0x38,0x37,0x35,0x20,0x32,0x2e,0x31,0x33,0x36,0x37,0x31,
-    0x39,0x20,0x37,0x2e,0x39,0x36,0x38,0x37,0x35,0x20,0x33,0x20,0x4c,0x20,0x34,0x20,
-    0x33,0x20,0x43,0x20,0x33,0x2e,0x34,0x34,0x39,0x32,0x31,0x39,0x20,0x33,0x20,0x33,
-    0x20,0x33,0x2e,0x34,0x34,0x39,0x32,0x31,0x39,0x20,0x33,0x20,0x34,0x20,0x4c,0x20,
-    0x32,0x20,0x34,0x20,0x4c,0x20,0x32,0x20,0x36,0x20,0x4c,0x20,0x32,0x34,0x20,0x36,
-    0x20,0x4c,0x20,0x32,0x34,0x20,0x34,0x20,0x4c,0x20,0x32,0x33,0x20,0x34,0x20,0x43,
-    0x20,0x32,0x33,0x20,0x33,0x2e,0x34,0x34,0x39,0x32,0x31,0x39,0x20,0x32,0x32,0x2e,
-    0x35,0x35,0x30,0x37,0x38,0x31,0x20,0x33,0x20,0x32,0x32,0x20,0x33,0x20,0x4c,0x20,
-    0x31,0x38,0x2e,0x30,0x33,0x31,0x32,0x35,0x20,0x33,0x20,0x43,0x20,0x31,0x38,0x2e,
-    0x30,0x33,0x31,0x32,0x35,0x20,0x32,0x2e,0x31,0x33,0x36,0x37,0x31,0x39,0x20,0x31,
-    0x37,0x2e,0x38,0x34,0x33,0x37,0x35,0x20,0x31,0x2e,0x33,0x30,0x34,0x36,0x38,0x38,
-    0x20,0x31,0x37,0x2e,0x32,0x35,0x20,0x30,0x2e,0x37,0x31,0x38,0x37,0x35,0x20,0x43,
-    0x20,0x31,0x36,0x2e,0x36,0x35,0x36,0x32,0x35,0x20,0x30,0x2e,0x31,0x33,0x32,0x38,
-    0x31,0x33,0x20,0x31,0x35,0x2e,0x38,0x33,0x35,0x39,0x33,0x38,0x20,0x2d,0x30,0x2e,
-    0x30,0x33,0x31,0x32,0x35,0x20,0x31,0x35,0x20,0x2d,0x30,0x2e,0x30,0x33,0x31,0x32,
-    0x35,0x20,0x5a,0x20,0x4d,0x20,0x31,0x31,0x20,0x32,0x2e,0x30,0x33,0x31,0x32,0x35,
-    0x20,0x4c,0x20,0x31,0x35,0x20,0x32,0x2e,0x30,0x33,0x31,0x32,0x35,0x20,0x43,0x20,
-    0x31,0x35,0x2e,0x35,0x34,0x36,0x38,0x37,0x35,0x20,0x32,0x2e,0x30,0x33,0x31,0x32,
-    0x35,0x20,0x31,0x35,0x2e,0x37,0x31,0x38,0x37,0x35,0x20,0x32,0x2e,0x31,0x36,0x30,
-    0x31,0x35,0x36,0x20,0x31,0x35,0x2e,0x37,0x38,0x31,0x32,0x35,0x20,0x32,0x2e,0x32,
-    0x31,0x38,0x37,0x35,0x20,0x43,0x20,0x31,0x35,0x2e,0x38,0x34,0x33,0x37,0x35,0x20,
-    0x32,0x2e,0x32,0x37,0x37,0x33,0x34,0x34,0x20,0x31,0x35,0x2e,0x39,0x36,0x38,0x37,
-    0x35,0x20,0x32,0x2e,0x34,0x34,0x31,0x34,0x30,0x36,0x20,0x31,0x35,0x2e,0x39,0x36,
-    0x38,0x37,0x35,0x20,0x33,0x20,0x4c,0x20,0x31,0x30,0x2e,0x30,0x33,0x31,0x32,0x35,
-    0x20,0x33,0x20,0x43,0x20,0x31,0x30,0x2e,0x30,0x33,0x31,0x32,0x35,0x20,0x32,0x2e,
-    0x34,0x34,0x31,0x34,0x30,0x36,0x20,0x31,0x30,0x2e,0x31,0x35,0x36,0x32,0x35,0x20,
-    0x32,0x2e,0x32,0x37,0x37,0x33,0x34,0x34,0x20,0x31,0x30,0x2e,0x32,0x31,0x38,0x37,
-    0x35,0x20,0x32,0x2e,0x32,0x31,0x38,0x37,0x35,0x20,0x43,0x20,0x31,0x30,0x2e,0x32,
-    0x38,0x31,0x32,0x35,0x20,0x32,0x2e,0x31,0x36,0x30,0x31,0x35,0x36,0x20,0x31,0x30,
-    0x2e,0x34,0x35,0x33,0x31,0x32,0x35,0x20,0x32,0x2e,0x30,0x33,0x31,0x32,0x35,0x20,
-    0x31,0x31,0x20,0x32,0x2e,0x30,0x33,0x31,0x32,0x35,0x20,0x5a,0x20,0x4d,0x20,0x34,
-    0x20,0x37,0x20,0x4c,0x20,0x34,0x20,0x32,0x33,0x20,0x43,0x20,0x34,0x20,0x32,0x34,
-    0x2e,0x36,0x35,0x32,0x33,0x34,0x34,0x20,0x35,0x2e,0x33,0x34,0x37,0x36,0x35,0x36,
-    0x20,0x32,0x36,0x20,0x37,0x20,0x32,0x36,0x20,0x4c,0x20,0x31,0x39,0x20,0x32,0x36,
-    0x20,0x43,0x20,0x32,0x30,0x2e,0x36,0x35,0x32,0x33,0x34,0x34,0x20,0x32,0x36,0x20,
-    0x32,0x32,0x20,0x32,0x34,0x2e,0x36,0x35,0x32,0x33,0x34,0x34,0x20,0x32,0x32,0x20,
-    0x32,0x33,0x20,0x4c,0x20,0x32,0x32,0x20,0x37,0x20,0x5a,0x20,0x4d,0x20,0x38,0x20,
-    0x31,0x30,0x20,0x4c,0x20,0x31,0x30,0x20,0x31,0x30,0x20,0x4c,0x20,0x31,0x30,0x20,
-    0x32,0x32,0x20,0x4c,0x20,0x38,0x20,0x32,0x32,0x20,0x5a,0x20,0x4d,0x20,0x31,0x32,
-    0x20,0x31,0x30,0x20,0x4c,0x20,0x31,0x34,0x20,0x31,0x30,0x20,0x4c,0x20,0x31,0x34,
-    0x20,0x32,0x32,0x20,0x4c,0x20,0x31,0x32,0x20,0x32,0x32,0x20,0x5a,0x20,0x4d,0x20,
-    0x31,0x36,0x20,0x31,0x30,0x20,0x4c,0x20,0x31,0x38,0x20,0x31,0x30,0x20,0x4c,0x20,
-    0x31,0x38,0x20,0x32,0x32,0x20,0x4c,0x20,0x31,0x36,0x20,0x32,0x32,0x20,0x5a,0x20,
-    0x22,0x20,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,
-    0x30,0x22,0x2f,0x3e,0x0a,0x09,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x09,0x3c,0x2f,0x73,
-    0x79,0x6d,0x62,0x6f,0x6c,0x3e,0x0a,0x09,0x3c,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x20,
-    0x69,0x64,0x3d,0x22,0x69,0x63,0x6f,0x2d,0x63,0x65,0x6e,0x74,0x72,0x65,0x22,0x20,
-    0x76,0x69,0x65,0x77,0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x35,0x30,0x20,
-    0x35,0x30,0x22,0x3e,0x0a,0x09,0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x70,
-    0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x20,0x34,0x36,0x2e,0x37,0x37,0x34,0x35,
-    0x34,0x37,0x2c,0x32,0x34,0x2e,0x35,0x37,0x33,0x36,0x35,0x36,0x20,0x41,0x20,0x32,
-    0x31,0x2e,0x31,0x36,0x36,0x36,0x36,0x36,0x2c,0x32,0x31,0x2e,0x31,0x36,0x36,0x36,
-    0x36,0x36,0x20,0x30,0x20,0x30,0x20,0x31,0x20,0x32,0x35,0x2e,0x36,0x30,0x37,0x38,
-    0x38,0x35,0x2c,0x34,0x35,0x2e,0x37,0x34,0x30,0x33,0x32,0x36,0x20,0x32,0x31,0x2e,
-    0x31,0x36,0x36,0x36,0x36,0x36,0x2c,0x32,0x31,0x2e,0x31,0x36,0x36,0x36,0x36,0x36,
-    0x20,0x30,0x20,0x30,0x20,0x31,0x20,0x34,0x2e,0x34,0x34,0x31,0x32,0x31,0x39,0x36,
-    0x2c,0x32,0x34,0x2e,0x35,0x37,0x33,0x36,0x35,0x36,0x20,0x32,0x31,0x2e,0x31,0x36,
-    0x36,0x36,0x36,0x36,0x2c,0x32,0x31,0x2e,0x31,0x36,0x36,0x36,0x36,0x36,0x20,0x30,
-    0x20,0x30,0x20,0x31,0x20,0x32,0x35,0x2e,0x36,0x30,0x37,0x38,0x38,0x35,0x2c,0x33,
-    0x2e,0x34,0x30,0x36,0x39,0x39,0x35,0x37,0x20,0x32,0x31,0x2e,0x31,0x36,0x36,0x36,
-    0x36,0x36,0x2c,0x32,0x31,0x2e,0x31,0x36,0x36,0x36,0x36,0x36,0x20,0x30,0x20,0x30,
-    0x20,0x31,0x20,0x34,0x36,0x2e,0x37,0x37,0x34,0x35,0x34,0x37,0x2c,0x32,0x34,0x2e,
-    0x35,0x37,0x33,0x36,0x35,0x36,0x20,0x5a,0x22,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,
-    0x6e,0x6f,0x6e,0x65,0x22,0x20,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,
-    0x74,0x68,0x3d,0x22,0x36,0x22,0x20,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3d,0x22,0x23,
-    0x66,0x61,0x66,0x63,0x65,0x65,0x22,0x2f,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x70,0x61,
-    0x74,0x68,0x20,0x64,0x3d,0x22,0x6d,0x20,0x32,0x32,0x2e,0x30,0x31,0x33,0x33,0x37,
-    0x35,0x2c,0x32,0x30,0x2e,0x35,0x36,0x30,0x35,0x37,0x36,0x20,0x37,0x2e,0x38,0x34,
-    0x33,0x30,0x39,0x39,0x2c,0x38,0x2e,0x31,0x32,0x30,0x33,0x36,0x22,0x20,0x66,0x69,
-    0x6c,0x6c,0x3d,0x22,0x6e,0x6f,0x6e,0x65,0x22,0x20,0x73,0x74,0x72,0x6f,0x6b,0x65,
-    0x2d,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x34,0x22,0x20,0x73,0x74,0x72,0x6f,0x6b,
-    0x65,0x3d,0x22,0x23,0x66,0x61,0x66,0x63,0x65,0x65,0x22,0x2f,0x3e,0x0a,0x09,0x09,
-    0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x6d,0x20,0x32,0x32,0x2e,0x31,
-    0x37,0x37,0x34,0x39,0x33,0x2c,0x32,0x38,0x2e,0x37,0x34,0x33,0x39,0x38,0x36,0x20,
-    0x37,0x2e,0x36,0x31,0x36,0x34,0x35,0x35,0x2c,0x2d,0x38,0x2e,0x33,0x33,0x33,0x33,
-    0x22,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x6e,0x6f,0x6e,0x65,0x22,0x20,0x73,0x74,
-    0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x34,0x22,0x20,0x73,
-    0x74,0x72,0x6f,0x6b,0x65,0x3d,0x22,0x23,0x66,0x61,0x66,0x63,0x65,0x65,0x22,0x2f,
-    0x3e,0x0a,0x09,0x20,0x20,0x20,0x3c,0x2f,0x67,0x3e,0x0a,0x09,0x3c,0x2f,0x73,0x79,
-    0x6d,0x62,0x6f,0x6c,0x3e,0x0a,0x09,0x3c,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x20,0x69,
-    0x64,0x3d,0x22,0x69,0x63,0x6f,0x2d,0x72,0x75,0x6e,0x2d,0x61,0x74,0x2d,0x73,0x74,
-    0x61,0x72,0x74,0x22,0x20,0x76,0x69,0x65,0x77,0x42,0x6f,0x78,0x3d,0x22,0x31,0x30,
-    0x30,0x20,0x35,0x30,0x20,0x31,0x32,0x30,0x20,0x31,0x35,0x30,0x22,0x3e,0x0a,0x09,
-    0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,
-    0x22,0x6d,0x20,0x32,0x30,0x30,0x2c,0x32,0x30,0x30,0x20,0x63,0x20,0x2d,0x34,0x2e,
-    0x33,0x35,0x38,0x37,0x38,0x2c,0x2d,0x31,0x2e,0x31,0x34,0x37,0x39,0x34,0x20,0x2d,
-    0x35,0x2e,0x34,0x39,0x30,0x31,0x35,0x2c,0x2d,0x33,0x2e,0x37,0x39,0x35,0x34,0x20,
-    0x2d,0x38,0x2e,0x32,0x34,0x38,0x35,0x2c,0x2d,0x31,0x39,0x2e,0x33,0x30,0x31,0x39,
-    0x35,0x20,0x2d,0x32,0x2e,0x31,0x39,0x36,0x38,0x32,0x2c,0x2d,0x31,0x32,0x2e,0x33,
-    0x34,0x39,0x38,0x33,0x20,0x2d,0x32,0x2e,0x36,0x36,0x31,0x30,0x33,0x2c,0x2d,0x31,
-    0x33,0x2e,0x36,0x34,0x30,0x30,0x37,0x20,0x2d,0x39,0x2e,0x32,0x38,0x31,0x38,0x34,
-    0x2c,0x2d,0x32,0x35,0x2e,0x37,0x39,0x38,0x31,0x20,0x2d,0x33,0x2e,0x38,0x33,0x33,
-    0x31,0x36,0x2c,0x2d,0x37,0x2e,0x30,0x33,0x38,0x39,0x36,0x20,0x2d,0x37,0x2e,0x31,
-    0x38,0x37,0x30,0x35,0x2c,0x2d,0x31,0x32,0x2e,0x35,0x38,0x30,0x34,0x32,0x20,0x2d,
-    0x37,0x2e,0x34,0x35,0x33,0x31,0x31,0x2c,0x2d,0x31,0x32,0x2e,0x33,0x31,0x34,0x33,
-    0x36,0x20,0x2d,0x30,0x2e,0x32,0x36,0x36,0x30,0x36,0x2c,0x30,0x2e,0x32,0x36,0x36,
-    0x30,0x35,0x20,0x2d,0x32,0x2e,0x31,0x35,0x33,0x30,0x35,0x2c,0x37,0x2e,0x31,0x35,
-    0x30,0x32,0x20,0x2d,0x34,0x2e,0x31,0x39,0x33,0x33,0x33,0x2c,0x31,0x35,0x2e,0x32,
-    0x39,0x38,0x31,0x20,0x6c,0x20,0x2d,0x33,0x2e,0x37,0x30,0x39,0x35,0x38,0x2c,0x31,
-    0x34,0x2e,0x38,0x31,0x34,0x33,0x36,0x20,0x2d,0x32,0x30,0x2e,0x37,0x31,0x33,0x32,
-    0x2c,0x30,0x2e,0x32,0x37,0x30,0x33,0x36,0x20,0x2d,0x32,0x30,0x2e,0x37,0x31,0x33,
-    0x32,0x2c,0x30,0x2e,0x32,0x37,0x30,0x33,0x37,0x20,0x2d,0x32,0x2e,0x34,0x37,0x34,
-    0x39,0x31,0x2c,0x2d,0x32,0x2e,0x34,0x37,0x34,0x39,0x31,0x20,0x63,0x20,0x2d,0x34,
-    0x2e,0x33,0x35,0x38,0x37,0x31,0x2c,0x2d,0x34,0x2e,0x33,0x35,0x38,0x37,0x31,0x20,
-    0x2d,0x32,0x2e,0x37,0x38,0x30,0x36,0x34,0x2c,0x2d,0x39,0x2e,0x37,0x37,0x33,0x31,
-    0x31,0x20,0x33,0x2e,0x33,0x35,0x38,0x36,0x36,0x2c,0x2d,0x31,0x31,0x2e,0x35,0x32,
-    0x33,0x36,0x33,0x20,0x31,0x2e,0x38,0x33,0x33,0x34,0x37,0x2c,0x2d,0x30,0x2e,0x35,
-    0x32,0x32,0x37,0x38,0x20,0x38,0x2e,0x38,0x30,0x33,0x39,0x35,0x2c,0x2d,0x30,0x2e,
-    0x38,0x37,0x36,0x36,0x31,0x20,0x31,0x35,0x2e,0x34,0x38,0x39,0x39,0x37,0x2c,0x2d,
-    0x30,0x2e,0x37,0x38,0x36,0x32,0x39,0x20,0x31,0x32,0x2e,0x31,0x30,0x39,0x32,0x2c,
-    0x30,0x2e,0x31,0x36,0x33,0x35,0x38,0x20,0x31,0x32,0x2e,0x31,0x35,0x39,0x32,0x34,
-    0x2c,0x30,0x2e,0x31,0x35,0x34,0x36,0x37,0x20,0x31,0x32,0x2e,0x38,0x39,0x32,0x31,
-    0x33,0x2c,0x2d,0x32,0x2e,0x32,0x39,0x35,0x38,0x34,0x20,0x30,0x2e,0x34,0x30,0x34,
-    0x36,0x36,0x2c,0x2d,0x31,0x2e,0x33,0x35,0x33,0x30,0x33,0x20,0x31,0x2e,0x36,0x37,
-    0x31,0x36,0x33,0x2c,0x2d,0x31,0x30,0x2e,0x38,0x38,0x35,0x38,0x31,0x20,0x32,0x2e,
-    0x38,0x31,0x35,0x34,0x39,0x2c,0x2d,0x32,0x31,0x2e,0x31,0x38,0x33,0x39,0x34,0x20,
-    0x6c,0x20,0x32,0x2e,0x30,0x37,0x39,0x37,0x35,0x2c,0x2d,0x31,0x38,0x2e,0x37,0x32,
-    0x33,0x38,0x38,0x20,0x38,0x2e,0x31,0x31,0x34,0x33,0x39,0x2c,0x2d,0x31,0x33,0x2e,
-    0x31,0x31,0x32,0x31,0x33,0x20,0x63,0x20,0x36,0x2e,0x31,0x32,0x32,0x35,0x34,0x2c,
-    0x2d,0x39,0x2e,0x38,0x39,0x33,0x34,0x38,0x20,0x37,0x2e,0x37,0x39,0x31,0x31,0x36,
-    0x2c,0x2d,0x31,0x33,0x2e,0x33,0x31,0x31,0x39,0x20,0x36,0x2e,0x37,0x39,0x37,0x36,
-    0x32,0x2c,0x2d,0x31,0x33,0x2e,0x39,0x32,0x35,0x39,0x35,0x20,0x2d,0x31,0x2e,0x30,
-    0x36,0x30,0x32,0x37,0x2c,0x2d,0x30,0x2e,0x36,0x35,0x35,0x32,0x38,0x20,0x2d,0x31,
-    0x37,0x2e,0x32,0x36,0x33,0x31,0x34,0x2c,0x2d,0x34,0x2e,0x30,0x31,0x34,0x31,0x36,
-    0x20,0x2d,0x31,0x39,0x2e,0x33,0x36,0x33,0x38,0x38,0x2c,0x2d,0x34,0x2e,0x30,0x31,
-    0x34,0x31,0x36,0x20,0x2d,0x30,0x2e,0x33,0x30,0x34,0x38,0x37,0x2c,0x30,0x20,0x2d,
-    0x32,0x2e,0x36,0x34,0x32,0x31,0x33,0x2c,0x33,0x2e,0x38,0x33,0x30,0x31,0x38,0x20,
-    0x2d,0x35,0x2e,0x31,0x39,0x33,0x39,0x33,0x2c,0x38,0x2e,0x35,0x31,0x31,0x35,0x32,
-    0x20,0x2d,0x32,0x2e,0x35,0x35,0x31,0x38,0x2c,0x34,0x2e,0x36,0x38,0x31,0x33,0x33,
-    0x20,0x2d,0x35,0x2e,0x35,0x31,0x37,0x33,0x36,0x2c,0x38,0x2e,0x39,0x38,0x31,0x32,
-    0x36,0x20,0x2d,0x36,0x2e,0x35,0x39,0x30,0x31,0x34,0x2c,0x39,0x2e,0x35,0x35,0x35,
-    0x34,0x20,0x2d,0x32,0x2e,0x38,0x32,0x31,0x31,0x37,0x2c,0x31,0x2e,0x35,0x30,0x39,
-    0x38,0x34,0x20,0x2d,0x35,0x2e,0x37,0x36,0x36,0x38,0x32,0x2c,0x30,0x2e,0x32,0x31,
-    0x31,0x39,0x20,0x2d,0x36,0x2e,0x35,0x34,0x34,0x32,0x2c,0x2d,0x32,0x2e,0x38,0x38,
-    0x33,0x35,0x37,0x20,0x2d,0x30,0x2e,0x35,0x33,0x33,0x30,0x36,0x2c,0x2d,0x32,0x2e,
-    0x31,0x32,0x32,0x36,0x31,0x20,0x30,0x2e,0x36,0x36,0x38,0x30,0x33,0x2c,0x2d,0x35,
-    0x2e,0x32,0x36,0x36,0x37,0x36,0x20,0x35,0x2e,0x37,0x34,0x37,0x36,0x38,0x2c,0x2d,
-    0x31,0x35,0x2e,0x30,0x34,0x35,0x39,0x38,0x20,0x33,0x2e,0x35,0x33,0x31,0x38,0x35,
-    0x2c,0x2d,0x36,0x2e,0x37,0x39,0x39,0x34,0x34,0x20,0x36,0x2e,0x39,0x39,0x39,0x34,
-    0x2c,0x2d,0x31,0x32,0x2e,0x35,0x39,0x30,0x39,0x37,0x20,0x37,0x2e,0x37,0x30,0x35,
-    0x36,0x35,0x2c,0x2d,0x31,0x32,0x2e,0x38,0x37,0x30,0x30,0x37,0x20,0x32,0x2e,0x32,
-    0x37,0x35,0x32,0x39,0x2c,0x2d,0x30,0x2e,0x38,0x39,0x39,0x31,0x35,0x20,0x33,0x31,
-    0x2e,0x35,0x35,0x36,0x30,0x37,0x2c,0x34,0x2e,0x38,0x30,0x32,0x34,0x31,0x20,0x33,
-    0x35,0x2e,0x35,0x35,0x32,0x39,0x38,0x2c,0x36,0x2e,0x39,0x32,0x32,0x38,0x38,0x20,
-    0x35,0x2e,0x31,0x36,0x31,0x34,0x38,0x2c,0x32,0x2e,0x37,0x33,0x38,0x33,0x20,0x36,
-    0x2e,0x33,0x30,0x35,0x36,0x31,0x2c,0x31,0x2e,0x34,0x36,0x39,0x32,0x32,0x20,0x34,
-    0x2e,0x32,0x31,0x38,0x32,0x35,0x2c,0x2d,0x34,0x2e,0x36,0x37,0x38,0x39,0x35,0x20,
-    0x2d,0x32,0x2e,0x30,0x33,0x39,0x37,0x32,0x2c,0x2d,0x36,0x2e,0x30,0x30,0x37,0x38,
-    0x35,0x20,0x2d,0x31,0x2e,0x32,0x31,0x32,0x32,0x31,0x2c,0x2d,0x31,0x30,0x2e,0x36,
-    0x39,0x33,0x34,0x39,0x20,0x32,0x2e,0x36,0x36,0x39,0x32,0x35,0x2c,0x2d,0x31,0x35,
-    0x2e,0x31,0x31,0x34,0x32,0x33,0x20,0x35,0x2e,0x38,0x32,0x39,0x32,0x39,0x2c,0x2d,
-    0x36,0x2e,0x36,0x33,0x39,0x32,0x20,0x31,0x35,0x2e,0x37,0x36,0x30,0x30,0x36,0x2c,
-    0x2d,0x36,0x2e,0x35,0x39,0x35,0x33,0x33,0x20,0x32,0x31,0x2e,0x36,0x33,0x34,0x37,
-    0x35,0x2c,0x30,0x2e,0x30,0x39,0x35,0x36,0x20,0x37,0x2e,0x33,0x32,0x37,0x30,0x32,
-    0x2c,0x38,0x2e,0x33,0x34,0x35,0x30,0x32,0x20,0x33,0x2e,0x37,0x31,0x34,0x36,0x39,
-    0x2c,0x32,0x30,0x2e,0x35,0x34,0x31,0x38,0x36,0x20,0x2d,0x36,0x2e,0x39,0x39,0x31,
-    0x37,0x32,0x2c,0x32,0x33,0x2e,0x36,0x30,0x37,0x31,0x34,0x20,0x2d,0x37,0x2e,0x38,
-    0x33,0x38,0x34,0x35,0x2c,0x32,0x2e,0x32,0x34,0x34,0x31,0x37,0x20,0x2d,0x38,0x2e,
-    0x35,0x33,0x31,0x34,0x37,0x2c,0x33,0x2e,0x36,0x39,0x37,0x35,0x36,0x20,0x2d,0x33,
-    0x2e,0x34,0x31,0x39,0x34,0x38,0x2c,0x37,0x2e,0x31,0x37,0x31,0x32,0x35,0x20,0x31,
-    0x2e,0x38,0x39,0x36,0x34,0x37,0x2c,0x31,0x2e,0x32,0x38,0x38,0x36,0x39,0x20,0x37,
-    0x2e,0x30,0x36,0x32,0x32,0x35,0x2c,0x36,0x2e,0x38,0x36,0x36,0x34,0x36,0x20,0x31,
-    0x31,0x2e,0x34,0x37,0x39,0x35,0x31,0x2c,0x31,0x32,0x2e,0x33,0x39,0x35,0x30,0x36,
-    0x20,0x38,0x2e,0x30,0x32,0x31,0x33,0x2c,0x31,0x30,0x2e,0x30,0x33,0x39,0x33,0x37,
-    0x20,0x38,0x2e,0x30,0x33,0x39,0x30,0x32,0x2c,0x31,0x30,0x2e,0x30,0x35,0x33,0x36,
-    0x32,0x20,0x31,0x34,0x2e,0x31,0x30,0x35,0x30,0x38,0x2c,0x31,0x31,0x2e,0x33,0x34,
-    0x30,0x39,0x32,0x20,0x39,0x2e,0x39,0x39,0x31,0x33,0x38,0x2c,0x32,0x2e,0x31,0x32,
-    0x30,0x33,0x32,0x20,0x31,0x33,0x2e,0x39,0x32,0x36,0x34,0x34,0x2c,0x37,0x2e,0x30,
-    0x30,0x38,0x30,0x34,0x20,0x38,0x2e,0x35,0x30,0x33,0x30,0x34,0x2c,0x31,0x30,0x2e,
-    0x35,0x36,0x31,0x35,0x38,0x20,0x2d,0x32,0x2e,0x32,0x37,0x35,0x38,0x35,0x2c,0x31,
-    0x2e,0x34,0x39,0x31,0x32,0x20,0x2d,0x33,0x2e,0x30,0x39,0x37,0x36,0x37,0x2c,0x31,
-    0x2e,0x34,0x37,0x39,0x31,0x37,0x20,0x2d,0x31,0x30,0x2e,0x37,0x35,0x2c,0x2d,0x30,
-    0x2e,0x31,0x35,0x37,0x32,0x39,0x20,0x6c,0x20,0x2d,0x38,0x2e,0x32,0x38,0x35,0x37,
-    0x36,0x2c,0x2d,0x31,0x2e,0x37,0x37,0x31,0x39,0x32,0x20,0x2d,0x39,0x2e,0x30,0x38,
-    0x30,0x33,0x37,0x2c,0x2d,0x39,0x2e,0x34,0x39,0x37,0x30,0x33,0x20,0x2d,0x39,0x2e,
-    0x30,0x38,0x30,0x33,0x38,0x2c,0x2d,0x39,0x2e,0x34,0x39,0x37,0x30,0x32,0x20,0x2d,
-    0x36,0x2e,0x31,0x32,0x31,0x38,0x35,0x2c,0x31,0x31,0x2e,0x31,0x32,0x30,0x37,0x36,
-    0x20,0x2d,0x36,0x2e,0x31,0x32,0x31,0x38,0x34,0x2c,0x31,0x31,0x2e,0x31,0x32,0x30,
-    0x37,0x36,0x20,0x37,0x2e,0x34,0x33,0x30,0x35,0x2c,0x31,0x37,0x2e,0x32,0x34,0x30,
-    0x30,0x39,0x20,0x63,0x20,0x36,0x2e,0x38,0x36,0x33,0x36,0x35,0x2c,0x31,0x35,0x2e,
-    0x39,0x32,0x34,0x38,0x38,0x20,0x37,0x2e,0x36,0x37,0x32,0x39,0x38,0x2c,0x31,0x38,
-    0x2e,0x35,0x35,0x36,0x33,0x20,0x31,0x30,0x2e,0x36,0x30,0x38,0x38,0x33,0x2c,0x33,
-    0x34,0x2e,0x34,0x39,0x33,0x31,0x33,0x20,0x32,0x2e,0x39,0x35,0x37,0x32,0x32,0x2c,
-    0x31,0x36,0x2e,0x30,0x35,0x32,0x38,0x35,0x20,0x33,0x2e,0x30,0x36,0x37,0x35,0x36,
-    0x2c,0x31,0x37,0x2e,0x34,0x32,0x32,0x30,0x38,0x20,0x31,0x2e,0x35,0x38,0x36,0x31,
-    0x32,0x2c,0x31,0x39,0x2e,0x36,0x38,0x33,0x30,0x35,0x20,0x2d,0x31,0x2e,0x39,0x33,
-    0x36,0x39,0x32,0x2c,0x32,0x2e,0x39,0x35,0x36,0x31,0x31,0x20,0x2d,0x34,0x2e,0x31,
-    0x39,0x32,0x33,0x31,0x2c,0x33,0x2e,0x36,0x32,0x32,0x34,0x32,0x20,0x2d,0x38,0x2e,
-    0x34,0x35,0x38,0x34,0x33,0x2c,0x32,0x2e,0x34,0x39,0x38,0x39,0x20,0x7a,0x22,0x2f,
-    0x3e,0x0a,0x09,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x09,0x3c,0x2f,0x73,0x79,0x6d,0x62,
-    0x6f,0x6c,0x3e,0x0a,0x09,0x3c,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x20,0x69,0x64,0x3d,
-    0x22,0x69,0x63,0x6f,0x2d,0x65,0x64,0x69,0x74,0x22,0x20,0x76,0x69,0x65,0x77,0x42,
-    0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x35,0x33,0x30,0x20,0x35,0x33,0x30,0x22,
-    0x3e,0x0a,0x09,0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,
-    0x20,0x64,0x3d,0x22,0x4d,0x33,0x32,0x38,0x2e,0x38,0x38,0x33,0x2c,0x38,0x39,0x2e,
-    0x31,0x32,0x35,0x6c,0x31,0x30,0x37,0x2e,0x35,0x39,0x2c,0x31,0x30,0x37,0x2e,0x35,
-    0x38,0x39,0x6c,0x2d,0x32,0x37,0x32,0x2e,0x33,0x34,0x2c,0x32,0x37,0x32,0x2e,0x33,
-    0x34,0x4c,0x35,0x36,0x2e,0x36,0x30,0x34,0x2c,0x33,0x36,0x31,0x2e,0x34,0x36,0x35,
-    0x4c,0x33,0x32,0x38,0x2e,0x38,0x38,0x33,0x2c,0x38,0x39,0x2e,0x31,0x32,0x35,0x7a,
-    0x20,0x4d,0x35,0x31,0x38,0x2e,0x31,0x31,0x33,0x2c,0x36,0x33,0x2e,0x31,0x37,0x37,
-    0x6c,0x2d,0x34,0x37,0x2e,0x39,0x38,0x31,0x2d,0x34,0x37,0x2e,0x39,0x38,0x31,0x20,
-    0x20,0x20,0x63,0x2d,0x31,0x38,0x2e,0x35,0x34,0x33,0x2d,0x31,0x38,0x2e,0x35,0x34,
-    0x33,0x2d,0x34,0x38,0x2e,0x36,0x35,0x33,0x2d,0x31,0x38,0x2e,0x35,0x34,0x33,0x2d,
-    0x36,0x37,0x2e,0x32,0x35,0x39,0x2c,0x30,0x6c,0x2d,0x34,0x35,0x2e,0x39,0x36,0x31,
-    0x2c,0x34,0x35,0x2e,0x39,0x36,0x31,0x6c,0x31,0x30,0x37,0x2e,0x35,0x39,0x2c,0x31,
-    0x30,0x37,0x2e,0x35,0x39,0x6c,0x35,0x33,0x2e,0x36,0x31,0x31,0x2d,0x35,0x33,0x2e,
-    0x36,0x31,0x31,0x20,0x20,0x20,0x43,0x35,0x33,0x32,0x2e,0x34,0x39,0x35,0x2c,0x31,
-    0x30,0x30,0x2e,0x37,0x35,0x33,0x2c,0x35,0x33,0x32,0x2e,0x34,0x39,0x35,0x2c,0x37,
-    0x37,0x2e,0x35,0x35,0x39,0x2c,0x35,0x31,0x38,0x2e,0x31,0x31,0x33,0x2c,0x36,0x33,
-    0x2e,0x31,0x37,0x37,0x7a,0x20,0x4d,0x30,0x2e,0x33,0x2c,0x35,0x31,0x32,0x2e,0x36,
-    0x39,0x63,0x2d,0x31,0x2e,0x39,0x35,0x38,0x2c,0x38,0x2e,0x38,0x31,0x32,0x2c,0x35,
-    0x2e,0x39,0x39,0x38,0x2c,0x31,0x36,0x2e,0x37,0x30,0x38,0x2c,0x31,0x34,0x2e,0x38,
-    0x31,0x31,0x2c,0x31,0x34,0x2e,0x35,0x36,0x35,0x6c,0x31,0x31,0x39,0x2e,0x38,0x39,
-    0x31,0x2d,0x32,0x39,0x2e,0x30,0x36,0x39,0x20,0x4c,0x32,0x37,0x2e,0x34,0x37,0x33,
-    0x2c,0x33,0x39,0x30,0x2e,0x35,0x39,0x37,0x4c,0x30,0x2e,0x33,0x2c,0x35,0x31,0x32,
-    0x2e,0x36,0x39,0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x09,
-    0x3c,0x2f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x3e,0x0a,0x09,0x3c,0x73,0x79,0x6d,0x62,
-    0x6f,0x6c,0x20,0x69,0x64,0x3d,0x22,0x69,0x63,0x6f,0x2d,0x61,0x64,0x64,0x22,0x20,
-    0x76,0x69,0x65,0x77,0x42,0x6f,0x78,0x3d,0x22,0x31,0x37,0x30,0x20,0x36,0x30,0x20,
-    0x32,0x30,0x30,0x20,0x31,0x35,0x30,0x22,0x3e,0x0a,0x09,0x09,0x3c,0x67,0x3e,0x0a,
-    0x09,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x6d,0x20,0x32,0x35,
-    0x30,0x2c,0x35,0x30,0x20,0x30,0x2c,0x31,0x35,0x30,0x20,0x6d,0x20,0x37,0x35,0x2c,
-    0x2d,0x37,0x35,0x20,0x2d,0x31,0x35,0x30,0x2c,0x30,0x22,0x20,0x73,0x74,0x79,0x6c,
-    0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x73,0x74,0x72,
-    0x6f,0x6b,0x65,0x3a,0x23,0x66,0x61,0x66,0x63,0x65,0x65,0x3b,0x73,0x74,0x72,0x6f,
-    0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x32,0x32,0x3b,0x73,0x74,0x72,0x6f,
-    0x6b,0x65,0x2d,0x6c,0x69,0x6e,0x65,0x63,0x61,0x70,0x3a,0x72,0x6f,0x75,0x6e,0x64,
-    0x22,0x2f,0x3e,0x0a,0x09,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x09,0x3c,0x2f,0x73,0x79,
-    0x6d,0x62,0x6f,0x6c,0x3e,0x0a,0x09,0x3c,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x20,0x69,
-    0x64,0x3d,0x22,0x69,0x63,0x6f,0x2d,0x73,0x70,0x69,0x72,0x61,0x6c,0x2d,0x6f,0x75,
-    0x74,0x22,0x20,0x76,0x69,0x65,0x77,0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,
-    0x36,0x30,0x20,0x36,0x30,0x22,0x3e,0x0a,0x09,0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,
-    0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x20,0x31,0x36,0x2e,0x36,
-    0x32,0x36,0x32,0x36,0x39,0x20,0x33,0x37,0x2e,0x39,0x33,0x30,0x34,0x38,0x34,0x20,
-    0x43,0x20,0x31,0x31,0x2e,0x30,0x36,0x39,0x35,0x38,0x35,0x20,0x33,0x32,0x2e,0x31,
-    0x36,0x39,0x32,0x35,0x37,0x20,0x31,0x30,0x2e,0x39,0x31,0x35,0x34,0x34,0x36,0x20,
-    0x32,0x32,0x2e,0x37,0x36,0x39,0x39,0x32,0x37,0x20,0x31,0x36,0x2e,0x30,0x35,0x39,
-    0x33,0x32,0x34,0x20,0x31,0x36,0x2e,0x35,0x34,0x36,0x36,0x30,0x38,0x20,0x43,0x20,
-    0x32,0x32,0x2e,0x32,0x35,0x39,0x30,0x38,0x20,0x39,0x2e,0x30,0x34,0x35,0x38,0x33,
-    0x35,0x20,0x33,0x33,0x2e,0x36,0x39,0x31,0x32,0x30,0x38,0x20,0x38,0x2e,0x34,0x32,
-    0x33,0x31,0x36,0x38,0x32,0x20,0x34,0x31,0x2e,0x30,0x34,0x38,0x37,0x33,0x31,0x20,
-    0x31,0x34,0x2e,0x35,0x37,0x36,0x32,0x37,0x32,0x20,0x43,0x20,0x34,0x39,0x2e,0x32,
-    0x31,0x36,0x39,0x37,0x35,0x20,0x32,0x31,0x2e,0x34,0x30,0x37,0x33,0x38,0x34,0x20,
-    0x34,0x39,0x2e,0x38,0x37,0x33,0x34,0x33,0x32,0x20,0x33,0x33,0x2e,0x39,0x32,0x30,
-    0x35,0x33,0x20,0x34,0x33,0x2e,0x30,0x39,0x33,0x32,0x31,0x39,0x20,0x34,0x31,0x2e,
-    0x39,0x34,0x39,0x31,0x35,0x34,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,
-    0x69,0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,
-    0x23,0x66,0x61,0x66,0x63,0x65,0x65,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,
-    0x69,0x64,0x74,0x68,0x3a,0x34,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x6c,0x69,
-    0x6e,0x65,0x63,0x61,0x70,0x3a,0x72,0x6f,0x75,0x6e,0x64,0x22,0x2f,0x3e,0x0a,0x09,
-    0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x20,0x32,0x32,0x2e,
-    0x36,0x37,0x32,0x36,0x31,0x36,0x20,0x33,0x34,0x2e,0x33,0x30,0x37,0x35,0x35,0x34,
-    0x20,0x43,0x20,0x32,0x32,0x2e,0x36,0x33,0x39,0x36,0x33,0x35,0x20,0x33,0x34,0x2e,
-    0x32,0x38,0x34,0x34,0x30,0x36,0x20,0x32,0x32,0x2e,0x36,0x30,0x36,0x38,0x31,0x33,
-    0x20,0x33,0x34,0x2e,0x32,0x36,0x30,0x39,0x38,0x33,0x20,0x32,0x32,0x2e,0x35,0x37,
-    0x34,0x31,0x35,0x32,0x20,0x33,0x34,0x2e,0x32,0x33,0x37,0x32,0x38,0x37,0x20,0x43,
-    0x20,0x31,0x38,0x2e,0x34,0x30,0x30,0x33,0x35,0x20,0x33,0x31,0x2e,0x32,0x30,0x39,
-    0x30,0x37,0x34,0x20,0x31,0x37,0x2e,0x39,0x34,0x37,0x35,0x31,0x39,0x20,0x32,0x35,
-    0x2e,0x31,0x35,0x38,0x38,0x33,0x34,0x20,0x32,0x30,0x2e,0x39,0x37,0x34,0x35,0x37,
-    0x37,0x20,0x32,0x31,0x2e,0x31,0x36,0x35,0x32,0x35,0x33,0x20,0x43,0x20,0x32,0x34,
-    0x2e,0x36,0x34,0x30,0x37,0x35,0x31,0x20,0x31,0x36,0x2e,0x33,0x32,0x38,0x34,0x39,
-    0x31,0x20,0x33,0x31,0x2e,0x37,0x36,0x31,0x37,0x39,0x37,0x20,0x31,0x35,0x2e,0x38,
-    0x34,0x31,0x34,0x33,0x32,0x20,0x33,0x36,0x2e,0x34,0x33,0x30,0x30,0x38,0x36,0x20,
-    0x31,0x39,0x2e,0x34,0x39,0x31,0x35,0x32,0x36,0x20,0x43,0x20,0x34,0x31,0x2e,0x30,
-    0x32,0x36,0x37,0x38,0x31,0x20,0x32,0x33,0x2e,0x30,0x38,0x35,0x36,0x34,0x31,0x20,
-    0x34,0x32,0x2e,0x31,0x34,0x36,0x35,0x31,0x20,0x32,0x39,0x2e,0x33,0x39,0x38,0x35,
-    0x31,0x20,0x33,0x39,0x2e,0x38,0x39,0x36,0x39,0x36,0x38,0x20,0x33,0x34,0x2e,0x34,
-    0x39,0x33,0x35,0x39,0x38,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,
-    0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,
-    0x66,0x61,0x66,0x63,0x65,0x65,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,
-    0x64,0x74,0x68,0x3a,0x34,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x6c,0x69,0x6e,
-    0x65,0x63,0x61,0x70,0x3a,0x72,0x6f,0x75,0x6e,0x64,0x22,0x2f,0x3e,0x0a,0x09,0x09,
-    0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x20,0x32,0x35,0x2e,0x36,
-    0x31,0x31,0x36,0x36,0x39,0x20,0x32,0x37,0x2e,0x30,0x38,0x34,0x35,0x36,0x32,0x20,
-    0x43,0x20,0x32,0x35,0x2e,0x36,0x30,0x39,0x36,0x38,0x36,0x20,0x32,0x36,0x2e,0x36,
-    0x32,0x36,0x34,0x39,0x35,0x20,0x32,0x35,0x2e,0x37,0x30,0x35,0x39,0x39,0x36,0x20,
-    0x32,0x36,0x2e,0x31,0x36,0x38,0x32,0x35,0x38,0x20,0x32,0x35,0x2e,0x38,0x38,0x39,
-    0x38,0x33,0x31,0x20,0x32,0x35,0x2e,0x37,0x38,0x33,0x38,0x39,0x37,0x20,0x43,0x20,
-    0x32,0x36,0x2e,0x39,0x34,0x37,0x39,0x38,0x35,0x20,0x32,0x33,0x2e,0x35,0x37,0x31,
-    0x35,0x32,0x31,0x20,0x32,0x39,0x2e,0x38,0x36,0x33,0x37,0x35,0x32,0x20,0x32,0x33,
-    0x2e,0x32,0x32,0x35,0x34,0x38,0x36,0x20,0x33,0x31,0x2e,0x38,0x31,0x31,0x34,0x34,
-    0x31,0x20,0x32,0x34,0x2e,0x34,0x30,0x36,0x37,0x38,0x20,0x43,0x20,0x33,0x34,0x2e,
-    0x36,0x36,0x39,0x37,0x35,0x34,0x20,0x32,0x36,0x2e,0x31,0x34,0x30,0x33,0x37,0x35,
-    0x20,0x33,0x35,0x2e,0x30,0x35,0x32,0x35,0x37,0x33,0x20,0x33,0x30,0x2e,0x30,0x37,
-    0x35,0x36,0x38,0x38,0x20,0x33,0x33,0x2e,0x32,0x36,0x32,0x37,0x31,0x32,0x20,0x33,
-    0x32,0x2e,0x37,0x31,0x31,0x38,0x36,0x34,0x20,0x43,0x20,0x33,0x33,0x2e,0x30,0x36,
-    0x38,0x32,0x37,0x35,0x20,0x33,0x32,0x2e,0x39,0x39,0x38,0x32,0x33,0x37,0x20,0x33,
-    0x32,0x2e,0x38,0x35,0x36,0x35,0x36,0x34,0x20,0x33,0x33,0x2e,0x32,0x36,0x34,0x30,
-    0x34,0x38,0x20,0x33,0x32,0x2e,0x36,0x32,0x39,0x38,0x38,0x39,0x20,0x33,0x33,0x2e,
-    0x35,0x30,0x39,0x34,0x34,0x33,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,
-    0x69,0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,
-    0x23,0x66,0x61,0x66,0x63,0x65,0x65,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,
-    0x69,0x64,0x74,0x68,0x3a,0x34,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x6c,0x69,
-    0x6e,0x65,0x63,0x61,0x70,0x3a,0x72,0x6f,0x75,0x6e,0x64,0x22,0x2f,0x3e,0x0a,0x09,
-    0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x20,0x32,0x39,0x2e,
-    0x35,0x35,0x35,0x30,0x38,0x37,0x2c,0x32,0x39,0x2e,0x32,0x38,0x36,0x32,0x30,0x37,
-    0x20,0x56,0x20,0x33,0x39,0x2e,0x37,0x32,0x35,0x30,0x36,0x33,0x22,0x20,0x73,0x74,
-    0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x73,
-    0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x66,0x61,0x66,0x63,0x65,0x65,0x3b,0x73,0x74,
-    0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x34,0x3b,0x73,0x74,0x72,
-    0x6f,0x6b,0x65,0x2d,0x6c,0x69,0x6e,0x65,0x63,0x61,0x70,0x3a,0x72,0x6f,0x75,0x6e,
-    0x64,0x22,0x2f,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,
-    0x22,0x6d,0x20,0x32,0x30,0x2e,0x31,0x34,0x32,0x39,0x37,0x32,0x2c,0x33,0x38,0x2e,
-    0x32,0x35,0x36,0x36,0x36,0x35,0x20,0x31,0x38,0x2e,0x37,0x33,0x34,0x34,0x36,0x32,
-    0x2c,0x30,0x2e,0x30,0x38,0x32,0x33,0x33,0x20,0x2d,0x39,0x2e,0x32,0x30,0x39,0x39,
-    0x33,0x31,0x2c,0x39,0x2e,0x37,0x35,0x35,0x31,0x37,0x31,0x20,0x7a,0x22,0x20,0x73,
-    0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x66,0x61,0x66,0x63,
-    0x65,0x65,0x3b,0x66,0x69,0x6c,0x6c,0x2d,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x3a,
-    0x31,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x66,0x61,0x66,0x63,0x65,0x65,
-    0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x32,0x2e,
-    0x35,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x6c,0x69,0x6e,0x65,0x63,0x61,0x70,
-    0x3a,0x72,0x6f,0x75,0x6e,0x64,0x22,0x2f,0x3e,0x0a,0x09,0x09,0x3c,0x2f,0x67,0x3e,
-    0x0a,0x09,0x3c,0x2f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x3e,0x0a,0x09,0x3c,0x73,0x79,
-    0x6d,0x62,0x6f,0x6c,0x20,0x69,0x64,0x3d,0x22,0x69,0x63,0x6f,0x2d,0x62,0x72,0x6f,
-    0x6b,0x65,0x6e,0x22,0x20,0x76,0x69,0x65,0x77,0x42,0x6f,0x78,0x3d,0x22,0x2d,0x31,
-    0x20,0x2d,0x31,0x20,0x35,0x35,0x20,0x35,0x35,0x22,0x3e,0x0a,0x09,0x09,0x3c,0x67,
-    0x3e,0x0a,0x09,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x32,
-    0x34,0x2e,0x30,0x30,0x38,0x2c,0x31,0x33,0x2e,0x34,0x30,0x31,0x4c,0x33,0x33,0x2e,
-    0x32,0x2c,0x34,0x2e,0x32,0x30,0x38,0x20,0x63,0x34,0x2e,0x32,0x37,0x38,0x2d,0x34,
-    0x2e,0x32,0x37,0x38,0x2c,0x31,0x31,0x2e,0x32,0x37,0x38,0x2d,0x34,0x2e,0x32,0x37,
-    0x38,0x2c,0x31,0x35,0x2e,0x35,0x35,0x36,0x2c,0x30,0x6c,0x30,0x2c,0x30,0x63,0x34,
-    0x2e,0x32,0x37,0x38,0x2c,0x34,0x2e,0x32,0x37,0x38,0x2c,0x34,0x2e,0x32,0x37,0x38,
-    0x2c,0x31,0x31,0x2e,0x32,0x37,0x38,0x2c,0x30,0x2c,0x31,0x35,0x2e,0x35,0x35,0x36,
-    0x4c,0x33,0x36,0x2e,0x37,0x33,0x35,0x2c,0x33,0x31,0x2e,0x37,0x38,0x36,0x63,0x2d,
-    0x34,0x2e,0x32,0x37,0x38,0x2c,0x34,0x2e,0x32,0x37,0x38,0x2d,0x31,0x31,0x2e,0x32,
-    0x37,0x38,0x2c,0x34,0x2e,0x32,0x37,0x38,0x2d,0x31,0x35,0x2e,0x35,0x35,0x36,0x2c,
-    0x30,0x6c,0x30,0x2c,0x30,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,
-    0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,
-    0x64,0x35,0x33,0x35,0x34,0x65,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,
-    0x64,0x74,0x68,0x3a,0x34,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x6c,0x69,0x6e,
-    0x65,0x63,0x61,0x70,0x3a,0x72,0x6f,0x75,0x6e,0x64,0x3b,0x73,0x74,0x72,0x6f,0x6b,
-    0x65,0x2d,0x6d,0x69,0x74,0x65,0x72,0x6c,0x69,0x6d,0x69,0x74,0x3a,0x31,0x30,0x22,
-    0x2f,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,
-    0x32,0x37,0x2e,0x35,0x34,0x33,0x2c,0x34,0x30,0x2e,0x39,0x37,0x38,0x6c,0x2d,0x37,
-    0x2e,0x37,0x37,0x38,0x2c,0x37,0x2e,0x37,0x37,0x38,0x20,0x63,0x2d,0x34,0x2e,0x32,
-    0x37,0x38,0x2c,0x34,0x2e,0x32,0x37,0x38,0x2d,0x31,0x31,0x2e,0x32,0x37,0x38,0x2c,
-    0x34,0x2e,0x32,0x37,0x38,0x2d,0x31,0x35,0x2e,0x35,0x35,0x36,0x2c,0x30,0x6c,0x30,
-    0x2c,0x30,0x63,0x2d,0x34,0x2e,0x32,0x37,0x38,0x2d,0x34,0x2e,0x32,0x37,0x38,0x2d,
-    0x34,0x2e,0x32,0x37,0x38,0x2d,0x31,0x31,0x2e,0x32,0x37,0x38,0x2c,0x30,0x2d,0x31,
-    0x35,0x2e,0x35,0x35,0x36,0x6c,0x31,0x31,0x2e,0x33,0x31,0x34,0x2d,0x31,0x31,0x2e,
-    0x33,0x31,0x34,0x63,0x34,0x2e,0x32,0x37,0x38,0x2d,0x34,0x2e,0x32,0x37,0x38,0x2c,
-    0x31,0x31,0x2e,0x32,0x37,0x38,0x2d,0x34,0x2e,0x32,0x37,0x38,0x2c,0x31,0x35,0x2e,
-    0x35,0x35,0x36,0x2c,0x30,0x6c,0x30,0x2c,0x30,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,
-    0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x73,0x74,0x72,0x6f,
-    0x6b,0x65,0x3a,0x23,0x64,0x35,0x33,0x35,0x34,0x65,0x3b,0x73,0x74,0x72,0x6f,0x6b,
-    0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x34,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,
-    0x2d,0x6c,0x69,0x6e,0x65,0x63,0x61,0x70,0x3a,0x72,0x6f,0x75,0x6e,0x64,0x3b,0x73,
-    0x74,0x72,0x6f,0x6b,0x65,0x2d,0x6d,0x69,0x74,0x65,0x72,0x6c,0x69,0x6d,0x69,0x74,
-    0x3a,0x31,0x30,0x22,0x2f,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,
-    0x64,0x3d,0x22,0x6d,0x20,0x33,0x33,0x2e,0x39,0x36,0x35,0x2c,0x34,0x35,0x20,0x76,
-    0x20,0x36,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,
-    0x6e,0x6f,0x6e,0x65,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x64,0x35,0x33,
-    0x35,0x34,0x65,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,
-    0x3a,0x34,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x6c,0x69,0x6e,0x65,0x63,0x61,
-    0x70,0x3a,0x72,0x6f,0x75,0x6e,0x64,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x6d,
-    0x69,0x74,0x65,0x72,0x6c,0x69,0x6d,0x69,0x74,0x3a,0x31,0x30,0x22,0x2f,0x3e,0x0a,
-    0x09,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x6d,0x20,0x33,0x37,
-    0x2e,0x37,0x32,0x32,0x2c,0x34,0x33,0x20,0x34,0x2e,0x32,0x34,0x33,0x2c,0x34,0x2e,
-    0x32,0x34,0x33,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,
-    0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x64,0x35,
-    0x33,0x35,0x34,0x65,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,
-    0x68,0x3a,0x34,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x6c,0x69,0x6e,0x65,0x63,
-    0x61,0x70,0x3a,0x72,0x6f,0x75,0x6e,0x64,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,
-    0x6d,0x69,0x74,0x65,0x72,0x6c,0x69,0x6d,0x69,0x74,0x3a,0x31,0x30,0x22,0x2f,0x3e,
-    0x0a,0x09,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x6d,0x20,0x33,
-    0x38,0x2e,0x39,0x36,0x35,0x2c,0x33,0x39,0x20,0x68,0x20,0x36,0x22,0x20,0x73,0x74,
-    0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x73,
-    0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x64,0x35,0x33,0x35,0x34,0x65,0x3b,0x73,0x74,
-    0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x34,0x3b,0x73,0x74,0x72,
-    0x6f,0x6b,0x65,0x2d,0x6c,0x69,0x6e,0x65,0x63,0x61,0x70,0x3a,0x72,0x6f,0x75,0x6e,
-    0x64,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x6d,0x69,0x74,0x65,0x72,0x6c,0x69,
-    0x6d,0x69,0x74,0x3a,0x31,0x30,0x22,0x2f,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x70,0x61,
-    0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x20,0x31,0x35,0x2e,0x39,0x36,0x35,0x2c,0x31,
-    0x30,0x20,0x56,0x20,0x34,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,
-    0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,
-    0x64,0x35,0x33,0x35,0x34,0x65,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,
-    0x64,0x74,0x68,0x3a,0x34,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x6c,0x69,0x6e,
-    0x65,0x63,0x61,0x70,0x3a,0x72,0x6f,0x75,0x6e,0x64,0x3b,0x73,0x74,0x72,0x6f,0x6b,
-    0x65,0x2d,0x6d,0x69,0x74,0x65,0x72,0x6c,0x69,0x6d,0x69,0x74,0x3a,0x31,0x30,0x22,
-    0x2f,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,
-    0x20,0x31,0x32,0x2e,0x32,0x30,0x37,0x2c,0x31,0x32,0x20,0x37,0x2e,0x39,0x36,0x35,
-    0x30,0x30,0x30,0x32,0x2c,0x37,0x2e,0x37,0x35,0x37,0x22,0x20,0x73,0x74,0x79,0x6c,
-    0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x73,0x74,0x72,
-    0x6f,0x6b,0x65,0x3a,0x23,0x64,0x35,0x33,0x35,0x34,0x65,0x3b,0x73,0x74,0x72,0x6f,
-    0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x34,0x3b,0x73,0x74,0x72,0x6f,0x6b,
-    0x65,0x2d,0x6c,0x69,0x6e,0x65,0x63,0x61,0x70,0x3a,0x72,0x6f,0x75,0x6e,0x64,0x3b,
-    0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x6d,0x69,0x74,0x65,0x72,0x6c,0x69,0x6d,0x69,
-    0x74,0x3a,0x31,0x30,0x22,0x2f,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,
-    0x20,0x64,0x3d,0x22,0x4d,0x20,0x31,0x30,0x2e,0x39,0x36,0x35,0x2c,0x31,0x36,0x20,
-    0x48,0x20,0x34,0x2e,0x39,0x36,0x35,0x30,0x30,0x30,0x32,0x22,0x20,0x73,0x74,0x79,
-    0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x73,0x74,
-    0x72,0x6f,0x6b,0x65,0x3a,0x23,0x64,0x35,0x33,0x35,0x34,0x65,0x3b,0x73,0x74,0x72,
-    0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x34,0x3b,0x73,0x74,0x72,0x6f,
-    0x6b,0x65,0x2d,0x6c,0x69,0x6e,0x65,0x63,0x61,0x70,0x3a,0x72,0x6f,0x75,0x6e,0x64,
-    0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x6d,0x69,0x74,0x65,0x72,0x6c,0x69,0x6d,
-    0x69,0x74,0x3a,0x31,0x30,0x22,0x2f,0x3e,0x0a,0x09,0x09,0x3c,0x2f,0x67,0x3e,0x0a,
-    0x09,0x3c,0x2f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x3e,0x0a,0x0a,0x3c,0x2f,0x73,0x76,
-    0x67,0x3e,0x0a,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,0x2f,0x68,0x74,0x6d,
-    0x6c,0x3e,0x0a
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xcd,0x7d,0x69,0x73,0xdb,0x46,
+    0xb6,0xf6,0xe7,0x99,0x5f,0x01,0x23,0x75,0x25,0xd2,0x02,0x29,0xec,0x24,0x48,0x41,
+    0x2a,0xc7,0x71,0x12,0xdf,0xf2,0x56,0x96,0x27,0x33,0xb9,0x8a,0xde,0x5b,0x10,0x09,
+    0x89,0x18,0x43,0x00,0x03,0x40,0x5b,0x14,0xcd,0x6f,0xbf,0xcf,0xe9,0x05,0x1b,0xc1,
+    0xc5,0xce,0x4c,0xea,0x9d,0x78,0x44,0xa2,0xbb,0x71,0xfa,0xf4,0xd9,0x4f,0x6f,0x3c,
+    0x7a,0xf6,0xdd,0xfb,0x97,0x9f,0x7e,0xfe,0xf0,0x4a,0x59,0x14,0xd7,0xf1,0xf1,0x5f,
+    0x8f,0xf8,0xc7,0x5f,0x8e,0x16,0x61,0x30,0xa7,0xcf,0xeb,0xb0,0x08,0x94,0xd9,0x22,
+    0xc8,0xf2,0xb0,0xf0,0xd5,0x9b,0xe2,0x72,0x30,0x56,0xa9,0xbc,0x88,0x8a,0x38,0x3c,
+    0x3e,0x0d,0x92,0xb9,0xf2,0x29,0xb8,0x88,0xc3,0xa3,0x43,0x5e,0x22,0x5f,0x49,0x82,
+    0xeb,0xd0,0x57,0x6f,0xa3,0xf0,0x6e,0x99,0x66,0x85,0xaa,0xcc,0xd2,0xa4,0x08,0x13,
+    0x80,0xb8,0x8b,0xe6,0xc5,0xc2,0x9f,0x87,0xb7,0xd1,0x2c,0x1c,0xb0,0x07,0x2d,0x4a,
+    0xa2,0x22,0x0a,0xe2,0x41,0x3e,0x0b,0xe2,0xd0,0x37,0x18,0xfc,0x7c,0x96,0x45,0xcb,
+    0x42,0x29,0x1e,0x96,0x00,0x53,0x84,0xf7,0xc5,0xe1,0x3f,0x83,0xdb,0x80,0x97,0xaa,
+    0xc7,0x97,0x37,0xc9,0xac,0x88,0xd2,0x44,0xb9,0x48,0xe7,0x0f,0xaf,0xf3,0x37,0x69,
+    0x30,0x0f,0xe7,0xbd,0xfe,0xe3,0x5d,0x94,0xcc,0xd3,0xbb,0x61,0x5e,0x9c,0x16,0x41,
+    0x11,0xfa,0x8f,0xf3,0xf0,0x32,0xb8,0x89,0x0b,0x86,0xe1,0x69,0xf4,0x5b,0xf8,0xf6,
+    0xed,0xc4,0x1a,0xe9,0xda,0xec,0x26,0xfb,0x10,0x5c,0x85,0x13,0x55,0xa5,0xaf,0xdf,
+    0x47,0x71,0xf8,0x92,0xa3,0xf7,0xdf,0x79,0x9a,0x50,0x69,0x92,0x26,0xa7,0x61,0x76,
+    0x1b,0x66,0x3f,0xa6,0x79,0xf1,0xf7,0x20,0xa3,0x42,0xdf,0xf7,0xe3,0x74,0x16,0x50,
+    0xb7,0xc3,0x05,0x8a,0x69,0x84,0xda,0x25,0xde,0x7d,0x75,0x3f,0x8b,0x6f,0xe6,0x61,
+    0x3e,0x39,0x53,0x3f,0xbe,0xff,0xf6,0xfd,0xa7,0xe1,0x7f,0x9f,0xbe,0x7f,0xa7,0x9e,
+    0x6b,0x31,0x50,0xc8,0x0b,0x82,0xfe,0x26,0xca,0x8b,0xd7,0xc9,0x65,0x3a,0x79,0x7c,
+    0x92,0x1d,0x7e,0xc2,0xc0,0x26,0xea,0x32,0xc8,0x82,0x6b,0x74,0x17,0xde,0xad,0x94,
+    0x11,0xe4,0xd3,0x87,0xbc,0x08,0xaf,0xbf,0x0d,0xf2,0xf0,0x43,0x50,0x2c,0x08,0xb1,
+    0x38,0xe0,0x63,0xbb,0xc9,0x3f,0xde,0x7f,0x8a,0xae,0xc3,0x09,0x5e,0x55,0xbe,0x43,
+    0x47,0x5a,0xce,0x4a,0xff,0xb6,0x9c,0xe3,0xe1,0xe5,0x22,0x9c,0x7d,0x7e,0x9b,0x4f,
+    0xcc,0xd0,0x6a,0x94,0x7f,0x4a,0xd3,0x37,0xf8,0x40,0x8d,0xe1,0xa0,0xea,0x3a,0xb8,
+    0x7f,0x5d,0x84,0x19,0x1b,0x52,0xfe,0x3a,0x79,0x75,0x1b,0xc4,0x13,0x47,0xd7,0xdb,
+    0xe5,0x9f,0xd2,0x02,0x15,0x46,0xe8,0x68,0xcb,0xa0,0x40,0x39,0x6b,0xf8,0x1a,0xf4,
+    0xca,0xf0,0x49,0xb0,0xf0,0x4a,0x41,0x14,0x7e,0x19,0x24,0x60,0xd1,0x87,0xe2,0x75,
+    0xfe,0x53,0x10,0x47,0xf3,0xc9,0x33,0x83,0x8d,0x82,0x86,0x05,0xe2,0x9c,0xc9,0x91,
+    0xa9,0x1f,0xe8,0x33,0x2c,0xb2,0x68,0x06,0x2a,0x9d,0xa9,0x57,0xb3,0x74,0x1e,0xa2,
+    0xf8,0x87,0xc1,0x4b,0xfa,0x42,0x45,0xc5,0x22,0x43,0xc1,0xa7,0x05,0x24,0x69,0xf0,
+    0x71,0x91,0xb2,0xb2,0x3c,0xfc,0x15,0x65,0xa7,0xe1,0xaf,0x37,0x61,0x32,0x43,0xb3,
+    0xf3,0x12,0xf8,0x9b,0x34,0xfd,0x7c,0xb3,0x24,0xe2,0xb2,0x1e,0xde,0x85,0x77,0x8c,
+    0x8f,0x8f,0x10,0x59,0x14,0xab,0x85,0xaf,0xff,0x92,0x7c,0xf4,0x73,0xf0,0xff,0x1f,
+    0x87,0xe6,0x2f,0x09,0xa8,0x98,0xa6,0x28,0xbf,0xf7,0x3f,0x3e,0xcf,0xa3,0xa4,0x57,
+    0xf4,0x7f,0x49,0x1e,0xf0,0x7d,0x96,0xe6,0xec,0xfb,0x47,0xff,0xe3,0x40,0x1f,0x5a,
+    0xbf,0x40,0x5a,0x8b,0x03,0x7d,0x68,0xfc,0x92,0xe4,0x45,0xba,0xf4,0x3f,0x1e,0x99,
+    0x80,0xa3,0x3e,0x69,0x40,0x0e,0x5d,0x08,0x89,0x99,0xa8,0xba,0x82,0x62,0xd7,0x1c,
+    0x8e,0x15,0x03,0xe2,0xc4,0x48,0xf0,0x6d,0x9a,0xcd,0xc3,0x0c,0x84,0x11,0xcf,0x24,
+    0x7a,0x13,0x93,0xc8,0xb4,0xc8,0xde,0x06,0xf7,0x6c,0x5c,0xaf,0x93,0xd9,0xe4,0x2d,
+    0xb8,0x3a,0xfc,0xf0,0xfa,0xd0,0xb5,0x9f,0x34,0x21,0xba,0x4b,0xc8,0xa5,0x10,0x5e,
+    0xb0,0xe1,0xe5,0xe5,0xd5,0x9b,0x30,0x61,0x7c,0x24,0x71,0x9b,0xa8,0x95,0xc2,0xa9,
+    0xc4,0xd9,0x8c,0x0d,0x50,0x7d,0x9a,0xde,0x06,0x99,0x12,0x6a,0x85,0xdf,0x54,0x80,
+    0x61,0x49,0xfe,0xe9,0x65,0x9a,0xf5,0xe2,0xb0,0x50,0x42,0x5f,0x9f,0x86,0x47,0xc5,
+    0x30,0x0e,0x93,0xab,0x62,0x31,0x0d,0x0f,0x0e,0xfa,0x6b,0xde,0xe1,0x54,0x3d,0x2b,
+    0xce,0xc2,0xf3,0x33,0xfd,0xfc,0xdc,0x67,0x5f,0x8c,0xf3,0x69,0xab,0xf9,0x8a,0xaa,
+    0x9c,0xf4,0xda,0x43,0x19,0x72,0x63,0x50,0xe1,0xae,0x0c,0x94,0xd7,0xca,0xf5,0x4d,
+    0x5e,0x28,0xd9,0x4d,0xa2,0x40,0x8d,0x03,0x25,0x67,0x30,0x9e,0x61,0x54,0x68,0xc5,
+    0xf5,0x35,0x2c,0x8a,0x28,0xb9,0xca,0x5f,0x06,0x71,0x7c,0x11,0xcc,0x3e,0xbf,0xff,
+    0xdc,0x23,0xc5,0x42,0xc7,0x19,0x8a,0xa3,0xcb,0x87,0x95,0x7e,0xfa,0xfd,0xfe,0x44,
+    0x16,0xbe,0xba,0x05,0x73,0x4e,0xd3,0x9b,0x6c,0x16,0xee,0xed,0xf5,0x7a,0xa1,0x4f,
+    0x8a,0x52,0x2b,0xec,0xa9,0x87,0x21,0x3d,0xe5,0x6a,0xbf,0x3f,0x0c,0xe6,0x73,0x56,
+    0x45,0x7a,0x1a,0x26,0x61,0xd6,0x53,0xd3,0x65,0x08,0x39,0x91,0x66,0xa6,0x17,0xf6,
+    0x1f,0x61,0xc0,0xf2,0x34,0x0e,0x87,0x71,0x7a,0xd5,0x53,0x5f,0xe4,0x0f,0xc9,0x4c,
+    0xe1,0x00,0xc8,0xb4,0x25,0xe1,0xac,0x08,0xe7,0x6a,0xff,0x49,0x7b,0x66,0xf4,0xb5,
+    0xb0,0x03,0x60,0x98,0x65,0x69,0xd6,0x84,0x18,0x0e,0xc1,0xc0,0xab,0xb0,0x18,0x66,
+    0xb0,0xb5,0x0f,0x6c,0x04,0xcf,0xfc,0x1a,0x8a,0xc3,0xf7,0x1f,0x5e,0xbd,0xdb,0xdb,
+    0x6b,0x74,0xfc,0x8a,0x77,0xf9,0x5d,0x94,0xef,0xd4,0x2b,0x57,0xfe,0x0d,0x03,0x91,
+    0x0d,0xc2,0x21,0xec,0x43,0xd0,0x9f,0x16,0xd9,0xc3,0x23,0xc9,0x52,0xe1,0x33,0x5a,
+    0x2f,0xc9,0xee,0xf7,0x44,0xa5,0x16,0xf8,0xbd,0x79,0x3a,0xbb,0xb9,0x46,0x17,0x43,
+    0xe0,0xfd,0x2a,0x0e,0xe9,0xeb,0xb7,0x0f,0xaf,0xe7,0x12,0xd0,0xa0,0x86,0xd5,0x70,
+    0x06,0x63,0x95,0x13,0x2e,0x84,0x58,0x4f,0x4d,0xd2,0x79,0x94,0x2f,0xe3,0xe0,0x41,
+    0xed,0x6b,0x2d,0x19,0x6a,0x5b,0x35,0xbf,0xb4,0x6a,0xdb,0xfa,0x5b,0x06,0x37,0x39,
+    0x75,0xd6,0x9f,0xea,0xbe,0x5f,0x0c,0xd9,0xe3,0x49,0xb0,0xa1,0xeb,0x49,0xbd,0x32,
+    0x0b,0xaf,0xd3,0xdb,0xb0,0x51,0xff,0x04,0x0b,0x3f,0x5b,0xd4,0xe9,0xc4,0x38,0xd7,
+    0x53,0xbf,0x0f,0xa0,0x17,0x73,0xa5,0x48,0x15,0x46,0x14,0x85,0x23,0xa0,0x30,0x5b,
+    0xdf,0x7f,0x62,0x2c,0xe8,0x6b,0x59,0xf8,0xab,0xb4,0xf7,0x2f,0x92,0x39,0x37,0xba,
+    0xbd,0xbe,0x06,0x43,0x24,0xed,0x65,0xaf,0x61,0x8f,0x31,0xd6,0xec,0x47,0x08,0x7c,
+    0x1c,0x66,0x6d,0x9a,0x74,0xd8,0xf3,0x92,0x6e,0xab,0x8c,0xce,0x42,0x32,0x6f,0xaa,
+    0xc6,0x3f,0x59,0xa5,0x80,0xdb,0xef,0x3f,0x95,0xde,0x72,0x5d,0xdf,0xf0,0x9c,0x92,
+    0xe2,0x83,0x2d,0xac,0x39,0xde,0x80,0x66,0xe9,0x5e,0xf6,0xf6,0xbe,0x4e,0x4e,0xba,
+    0xf8,0x51,0x22,0xbf,0x3a,0x34,0xa0,0x0d,0xca,0x72,0xaf,0x73,0xba,0x08,0x96,0x21,
+    0x68,0x4e,0xa6,0xb6,0xd7,0x78,0xab,0x8b,0x23,0x8f,0x88,0x34,0xe2,0x17,0xff,0x0c,
+    0xee,0x61,0x06,0xc8,0xde,0xc5,0xa8,0x3e,0xe4,0x3e,0x97,0x5a,0xf2,0x66,0xef,0x3f,
+    0xb7,0x0a,0x48,0x04,0x6a,0xa0,0x57,0x2b,0x01,0x18,0xfd,0x49,0xc3,0x55,0xeb,0x6f,
+    0xdd,0x4b,0xb0,0x69,0x90,0x34,0x52,0xba,0x15,0xb2,0xb7,0x63,0x87,0x86,0x42,0xae,
+    0x68,0xd0,0x6a,0xb4,0xe0,0x6f,0x85,0x38,0xbc,0xcc,0xa9,0xf1,0xce,0x12,0x9f,0x85,
+    0xb3,0x30,0xba,0x45,0x09,0x61,0xc2,0x06,0xa2,0x10,0xdd,0xa0,0xce,0xcd,0x17,0xc3,
+    0xfe,0xd3,0x36,0x2a,0x74,0xd7,0xd7,0xb9,0x02,0xb9,0xc9,0x45,0x8b,0x8d,0x3e,0xa1,
+    0x2e,0xdd,0x1b,0x3c,0x07,0x46,0x17,0x5d,0xf6,0x54,0xf5,0x99,0xef,0xc3,0x1f,0xa8,
+    0x8f,0x4f,0xec,0x5b,0x9f,0xdb,0x3a,0x66,0xf5,0x8a,0x6e,0x02,0x57,0xfe,0xb8,0xd8,
+    0x99,0x50,0x8c,0x3e,0x12,0x7b,0x45,0x3d,0xf8,0x27,0xa2,0x91,0x0e,0x22,0x3d,0xdd,
+    0xb0,0x71,0x7f,0xc7,0x45,0xbd,0x4e,0x9e,0x56,0xc5,0xe3,0x55,0x98,0x50,0xbc,0xfa,
+    0x23,0xfc,0x04,0x49,0xbd,0x26,0x9e,0xbf,0x45,0xf0,0x8b,0xa7,0x08,0x90,0x7f,0x08,
+    0x93,0x9e,0x0a,0x8b,0x9e,0x72,0x6d,0xa8,0xeb,0x0d,0x2c,0x62,0xf6,0x42,0x58,0x7f,
+    0xad,0xd0,0x02,0x2d,0xe1,0xb4,0x98,0x87,0x88,0x07,0x42,0x0a,0x6b,0x8b,0x3e,0x20,
+    0x5c,0x46,0xd9,0x35,0x1c,0x5b,0x16,0x2a,0x0f,0xe9,0x8d,0x92,0xdf,0x88,0x2f,0x77,
+    0x41,0x52,0xd0,0xc8,0x78,0xeb,0x13,0xb5,0x0f,0x6f,0x5a,0x63,0x13,0x2f,0x26,0xa9,
+    0x52,0x0f,0xb6,0x8a,0xe4,0x81,0x7a,0xa8,0x1e,0x04,0x4c,0xa9,0xbe,0x63,0xef,0x09,
+    0x0d,0xe3,0x0f,0x4c,0xbb,0xda,0x72,0x2d,0x22,0x75,0x5f,0x55,0xd7,0xd8,0xd6,0xfe,
+    0x34,0x8c,0x41,0x72,0x1a,0x50,0x1e,0xdc,0x8a,0xe1,0x30,0xb6,0xa6,0xfe,0x5a,0x23,
+    0x44,0x9d,0xbe,0x43,0x4c,0xf2,0x2e,0x7d,0x75,0x0f,0x03,0x9a,0x83,0x36,0x6a,0x7f,
+    0x4a,0xe1,0x51,0x82,0x9e,0xa6,0x00,0xa6,0x43,0x3c,0x7a,0x49,0xed,0x1f,0x82,0xd7,
+    0xe2,0xd5,0x3c,0x2a,0xa8,0x83,0x6e,0x1c,0x87,0x88,0x4b,0xae,0x7b,0xfd,0x93,0x74,
+    0x18,0xc1,0xb6,0x65,0x3f,0x7e,0x7a,0xfb,0x66,0x92,0x0e,0x61,0xf2,0x6f,0xc2,0xbe,
+    0xa8,0xeb,0xc3,0xc2,0x81,0xa5,0x88,0x3e,0xf6,0xd5,0x7d,0x4d,0x55,0x6b,0x05,0xea,
+    0x2f,0xbf,0xa8,0xad,0x92,0x13,0x51,0xc0,0xdf,0x15,0x11,0x5b,0xff,0x91,0x47,0x71,
+    0x40,0x13,0x7f,0x78,0x44,0xdd,0x89,0x92,0x4c,0x28,0x4e,0x7a,0x1b,0x08,0x81,0x41,
+    0xb1,0x20,0x19,0x56,0x98,0x21,0xaa,0x45,0x1b,0xdb,0x52,0xdc,0x5c,0x36,0x6d,0x05,
+    0x63,0x22,0xda,0x4e,0x79,0x70,0x1d,0x3d,0x21,0x16,0x5b,0x0b,0x8a,0xf2,0x39,0x91,
+    0x10,0xe6,0x12,0xde,0x94,0xf3,0x8c,0xfc,0xd0,0xf7,0x69,0x76,0x0d,0x5f,0x14,0x00,
+    0x1b,0x7a,0xfc,0x36,0x4e,0x2f,0x7a,0x08,0x3e,0xb5,0xc7,0x82,0x27,0x48,0x71,0x10,
+    0x25,0x87,0x04,0x43,0x7d,0xea,0x4f,0xd3,0x61,0xb0,0x44,0xb0,0x26,0xb8,0xaa,0x6a,
+    0x91,0x96,0x1c,0xa8,0xc3,0x15,0x69,0xac,0x51,0x84,0x73,0xba,0x60,0xb0,0xff,0xf1,
+    0xf6,0xcd,0x8f,0x45,0xb1,0xfc,0x48,0x59,0x45,0x0e,0xe5,0xf0,0x99,0xd4,0x42,0x90,
+    0x48,0x1a,0xa7,0xc5,0x30,0x4d,0x58,0x70,0x46,0x5e,0x2b,0x44,0x16,0x9c,0x40,0x14,
+    0xcb,0x58,0xaa,0xff,0x68,0x93,0xb4,0xd5,0xc2,0x37,0xe8,0x06,0xa2,0x7c,0x56,0xc8,
+    0xfd,0xdc,0x49,0xaf,0x11,0x6d,0x11,0x60,0xf2,0x63,0x4b,0x14,0x86,0x30,0x0c,0xf4,
+    0x2e,0x7f,0xf8,0x84,0xd1,0x6c,0x12,0xfe,0x4a,0x89,0x19,0x72,0x40,0x12,0x46,0x0d,
+    0x24,0xbe,0x4d,0xa3,0xb9,0x42,0xc2,0x1a,0xec,0xed,0xd5,0xbf,0x77,0xf4,0x7b,0xc9,
+    0xad,0xd4,0x1f,0xeb,0x95,0x7b,0x39,0xc4,0x14,0x1a,0x68,0xb3,0x24,0xa3,0xf3,0xe1,
+    0xfd,0xe9,0x27,0x08,0xea,0xe1,0xcd,0x32,0x46,0x16,0x5e,0xa4,0x44,0xc0,0xeb,0x00,
+    0xfa,0x84,0x16,0x39,0xf1,0x25,0x85,0xa5,0x23,0x1d,0x55,0x91,0x0b,0xcd,0xc2,0x98,
+    0x69,0x68,0x99,0x23,0x74,0x75,0xda,0x34,0x7e,0xfd,0x89,0x8a,0x70,0x47,0xbc,0xc5,
+    0x79,0xec,0x33,0x23,0xbe,0x16,0x04,0x04,0xf5,0x05,0xde,0xe8,0x1a,0x18,0xd2,0xda,
+    0x6b,0xea,0xa3,0x5b,0x38,0x6a,0x93,0x00,0xeb,0x1b,0x91,0x04,0xb5,0xd5,0xad,0x96,
+    0xbf,0x77,0xa0,0x1f,0x0a,0xb3,0xd1,0x39,0x6a,0x86,0x51,0xa0,0xb5,0xe2,0x91,0xfc,
+    0xcb,0xac,0xe9,0x47,0x48,0xe0,0xa7,0x94,0xcc,0x13,0xf5,0x87,0x9c,0x8a,0x77,0x57,
+    0x03,0x4a,0xc8,0x7c,0x99,0x95,0x0e,0xf0,0xe2,0x77,0x7c,0xfa,0x44,0xfa,0x51,0x0e,
+    0xfb,0x05,0xbd,0x99,0xf1,0x11,0x55,0x5c,0xa8,0x92,0x3d,0x91,0x96,0xfa,0xc9,0x89,
+    0xaa,0x4e,0x02,0x6d,0x89,0xb4,0x50,0x3a,0xe4,0x5e,0xbf,0x15,0x09,0x49,0x37,0xd0,
+    0x6b,0xa5,0x25,0xbc,0x7c,0xce,0x83,0x8c,0xf4,0xb3,0xba,0x2e,0xb2,0xee,0x82,0x26,
+    0x02,0xb1,0x0e,0x78,0x1c,0x1c,0xd7,0x83,0x1d,0x41,0x4a,0x53,0xd0,0x06,0xc8,0x35,
+    0xea,0x8b,0xc0,0x35,0x09,0x21,0xcc,0xf8,0xb6,0x8c,0x16,0x46,0x3e,0xac,0xf9,0x08,
+    0xe4,0xa4,0x70,0x14,0x49,0x2d,0xe4,0x62,0xd8,0x90,0x0e,0xbe,0x7e,0xf7,0x03,0x74,
+    0x1b,0x81,0x0b,0xf5,0x43,0x22,0x4c,0x5c,0xc7,0xd7,0x2a,0x8a,0x0a,0x1b,0xbc,0x78,
+    0xff,0x59,0xb2,0xb5,0x51,0x4c,0x83,0x2d,0xf9,0xdd,0x8d,0x7c,0xf5,0x66,0x9b,0x2a,
+    0x1f,0xd0,0x0a,0x5c,0x2b,0x43,0x1f,0xc6,0xb9,0xb5,0x51,0xce,0xba,0x6e,0xbb,0xa0,
+    0x56,0x30,0xbf,0x7f,0xf1,0xfa,0xcd,0xab,0xef,0x36,0xc1,0xed,0xb6,0x95,0x8f,0xdb,
+    0xf8,0xb3,0xce,0xd8,0x6d,0x7d,0x11,0xd1,0xd8,0xb7,0x37,0x45,0x51,0xc5,0x57,0x5a,
+    0x0a,0x2f,0x94,0x6b,0x31,0x67,0x72,0x46,0xbe,0x3a,0x83,0x73,0xcc,0x12,0xa5,0xc1,
+    0xcd,0x7f,0x7d,0x0e,0x1f,0xfe,0xa5,0x6a,0xb0,0xc0,0xd9,0x81,0xaf,0x1e,0xe5,0xcb,
+    0x20,0x51,0x58,0x2e,0xe4,0xef,0xab,0x07,0xd1,0x81,0xaa,0x5c,0x14,0xc9,0xbe,0x92,
+    0x26,0xb3,0x38,0x9a,0x7d,0xa6,0xb2,0xf0,0x40,0xdd,0x07,0x8f,0x7b,0x31,0x69,0x96,
+    0x8a,0x14,0x89,0x82,0x5d,0x88,0xde,0x81,0x7a,0x0c,0xb9,0x90,0xd1,0x49,0x7a,0x02,
+    0x70,0xfb,0x47,0xf9,0xed,0x95,0x80,0xa6,0x52,0x80,0x38,0x08,0x18,0xb2,0xea,0xf1,
+    0x11,0xc6,0xa9,0xdc,0xc7,0x51,0xf2,0x79,0xb2,0xc8,0xc2,0x4b,0x5f,0xfd,0x06,0xd5,
+    0x03,0x66,0xa3,0x8e,0x8f,0x0e,0x51,0x89,0xbf,0x78,0xf7,0x78,0x7f,0xa2,0x7e,0xe4,
+    0x86,0xe4,0xab,0x00,0xb2,0xec,0xad,0x0d,0xf0,0x05,0x37,0xe4,0x5f,0x05,0x90,0x9c,
+    0x40,0x07,0x82,0x35,0x6b,0xf4,0x55,0x60,0x61,0xd0,0x06,0x41,0x31,0x60,0x46,0x4b,
+    0x45,0x82,0xfc,0x10,0xc3,0x83,0x40,0xb1,0xe3,0xc9,0xfe,0x41,0x2f,0x3f,0x51,0xbf,
+    0xb1,0xf5,0x51,0x18,0xb8,0xa0,0xf7,0x37,0x97,0xc1,0xe5,0x2c,0x0c,0x41,0xee,0xfd,
+    0x15,0x44,0x3e,0x60,0xb4,0x83,0x0f,0x34,0xf9,0xb0,0x01,0x91,0x22,0x4d,0x21,0xdf,
+    0xd9,0x26,0x8a,0xb1,0xf9,0x8b,0x55,0xe8,0x7f,0x10,0x70,0x27,0xd0,0xd3,0x02,0xb1,
+    0xdc,0x57,0xc3,0xa4,0x19,0xd1,0x15,0x90,0x3f,0xa6,0xd7,0x7f,0x00,0xcd,0x19,0x5c,
+    0x6f,0xd6,0x81,0x67,0x74,0x7d,0x43,0xb9,0x2b,0x03,0x0c,0x7f,0xd3,0x09,0x3a,0x4a,
+    0x00,0x2d,0x5c,0x8b,0xec,0x32,0xca,0x82,0x78,0x90,0xde,0xb4,0x45,0xbc,0xaf,0xe9,
+    0x47,0x81,0x08,0xac,0x39,0xe8,0x40,0x28,0xe3,0x21,0x69,0xe3,0xb1,0xda,0x50,0x72,
+    0x72,0xa5,0xab,0x8a,0x4e,0xf6,0x81,0xe9,0x76,0x65,0x06,0xf6,0x2b,0xc7,0xbb,0x0f,
+    0xa5,0xdd,0x57,0x3b,0x9d,0xe9,0x7e,0xcd,0x58,0x3c,0x33,0xb4,0x67,0x7a,0xd3,0xa4,
+    0xd4,0x13,0x3e,0x96,0xcf,0x94,0x51,0x47,0xe9,0x1d,0xb4,0x62,0x53,0xb4,0x2e,0x5f,
+    0x57,0x69,0xe2,0x4e,0x3d,0x9a,0x47,0xb7,0xd2,0xba,0x50,0xdd,0x60,0xc1,0x2a,0x15,
+    0x42,0x85,0xda,0xed,0xc3,0x84,0x04,0x7e,0x8f,0xfe,0x1d,0xac,0x6d,0x3d,0xa0,0x0c,
+    0x13,0x2d,0xfb,0x07,0xbd,0xfd,0x23,0x3e,0xb5,0xad,0x44,0x73,0xbf,0x9e,0x78,0x4a,
+    0xb6,0xb0,0xb7,0xa8,0xbc,0xec,0x41,0x55,0xf8,0xd2,0x0f,0x68,0x52,0xb5,0xff,0x3b,
+    0x15,0x81,0x42,0xca,0x22,0x8c,0xae,0x16,0x45,0xb3,0xf2,0x47,0x56,0x46,0xea,0xf6,
+    0x3e,0x5d,0xe6,0x47,0x87,0xbc,0x47,0xb0,0xed,0x00,0x0c,0x02,0x86,0x84,0xc8,0x5a,
+    0x54,0x29,0x3f,0x00,0xaa,0x07,0x7c,0xf6,0x19,0xa1,0x7c,0x99,0x95,0xf9,0x81,0x1f,
+    0x94,0x10,0xca,0x2f,0x4d,0x7b,0x8e,0xcc,0x9a,0x70,0x86,0xc7,0x39,0x0d,0x65,0xb4,
+    0xcf,0x99,0xd0,0xe8,0x90,0x96,0x9f,0x68,0x2e,0xab,0xc8,0xd2,0x38,0x47,0x6f,0xa5,
+    0x9d,0x3f,0x58,0x6d,0x86,0x5c,0xad,0x18,0x5c,0x30,0x09,0xc9,0x19,0x51,0x7e,0xc8,
+    0x82,0xb9,0xb1,0xcf,0x50,0x58,0x05,0x79,0x8d,0x18,0x7a,0x4e,0x20,0x0f,0x7a,0xeb,
+    0xab,0x07,0x11,0xe2,0x36,0x6a,0xd3,0x94,0x4e,0xf5,0x30,0xbc,0x0f,0x67,0x87,0x57,
+    0xe6,0x98,0x32,0x48,0xf6,0x8f,0x54,0x53,0x29,0x16,0xc8,0x3e,0xd2,0x8b,0xb4,0x10,
+    0x05,0xf8,0x68,0x82,0xe3,0xd8,0xa9,0x75,0xfa,0x7e,0x75,0xef,0x95,0x39,0x93,0x38,
+    0x7c,0x4a,0xaf,0xae,0x10,0x30,0x51,0xc5,0xa1,0xac,0xa9,0x19,0xce,0xff,0x24,0x32,
+    0xcc,0x5c,0x49,0x3c,0x4e,0xf9,0x83,0xf8,0xd8,0xda,0xe9,0x8a,0xa4,0x74,0xf0,0x2b,
+    0x0f,0x97,0xfb,0x9b,0x5b,0x30,0xee,0x8b,0x39,0xe3,0x2f,0x60,0x7e,0x47,0x57,0x7c,
+    0x02,0xf5,0x22,0xbd,0xaf,0xea,0xa1,0x83,0xfb,0xed,0x89,0xd5,0x7d,0xf9,0x56,0x39,
+    0x99,0xba,0x7f,0x5c,0xb3,0x9b,0xfb,0x75,0x93,0xbc,0xbf,0x62,0x38,0xf7,0x99,0xe1,
+    0xbc,0xc8,0xd2,0xcf,0x61,0xb2,0xdf,0x30,0x9a,0xbb,0x50,0x63,0x33,0x8a,0x7c,0xce,
+    0xfe,0x4b,0xf0,0x53,0xd8,0x43,0x86,0x97,0xd6,0x20,0xca,0x40,0x6e,0xc5,0x73,0xdd,
+    0x97,0x96,0xdd,0x65,0x6b,0x9c,0x39,0x9f,0x5c,0x5b,0xab,0xf4,0x57,0x59,0x7a,0xb3,
+    0x2c,0x39,0x69,0x56,0xba,0xdf,0x0b,0x0f,0xd6,0x35,0x17,0xa6,0x89,0xc6,0x49,0xde,
+    0x45,0xf6,0x24,0x9d,0x4d,0xff,0x60,0xdd,0x7b,0x3c,0x84,0x61,0x02,0xb1,0x7f,0xb4,
+    0xcc,0xd2,0x2b,0x24,0xf0,0xdc,0xf2,0xca,0x87,0x01,0xa8,0x34,0xa0,0x7c,0x64,0x00,
+    0xd1,0x81,0x15,0xcc,0x4a,0x43,0x5c,0x03,0xc3,0x85,0x5b,0x59,0x44,0xf3,0x79,0x98,
+    0xa8,0xca,0x75,0x70,0xef,0x1b,0xba,0xae,0xb0,0xe9,0x17,0x5f,0x07,0xc5,0x24,0xb4,
+    0xe3,0xfd,0x83,0x9a,0x37,0xab,0x4d,0x20,0x8a,0x39,0x16,0x96,0x91,0xd3,0xe4,0xd4,
+    0xbe,0xd4,0xa9,0x77,0xe1,0x9d,0x22,0x56,0x87,0xf1,0xf4,0x82,0x55,0xaf,0xf4,0xac,
+    0x0a,0x3f,0xb7,0x93,0x4a,0xd1,0xd4,0xb2,0x32,0xcf,0xd2,0xe5,0xe0,0xb7,0x34,0x09,
+    0xf7,0x99,0x00,0x89,0x1e,0xd8,0x62,0xc1,0xfe,0x56,0x4e,0x92,0x89,0xab,0xa6,0x49,
+    0x05,0x27,0x37,0x3a,0x4c,0x69,0xf6,0x69,0xf2,0xc2,0x5f,0xe3,0x06,0xb4,0xd0,0xef,
+    0x85,0x35,0x67,0x52,0x68,0x5b,0x41,0xd2,0x7c,0x96,0xda,0x17,0x30,0x9b,0xf2,0x35,
+    0x6d,0x80,0x6a,0xa0,0xff,0x7e,0xc9,0x72,0x91,0x22,0xe3,0xd1,0x86,0x8c,0x33,0xf6,
+    0x8f,0x52,0x56,0x21,0xd8,0x26,0x22,0x0c,0x05,0xd1,0x6a,0x40,0xf3,0x22,0x27,0xfb,
+    0x39,0x72,0x5d,0x32,0x00,0xbe,0x2a,0xbf,0xa9,0x08,0xa3,0x78,0x96,0x70,0x50,0x10,
+    0xa9,0x38,0x80,0x16,0xb5,0x28,0x7d,0x20,0x6a,0x71,0x4e,0xe7,0xb2,0x53,0x31,0x29,
+    0xda,0x2d,0x98,0x24,0xf5,0xd1,0x65,0x2f,0xd9,0x2e,0xf1,0x2a,0xc1,0x4a,0xfc,0x64,
+    0xad,0x88,0x73,0x5c,0x15,0xfe,0x31,0x60,0x71,0x38,0x17,0x77,0x51,0x41,0xc2,0x2e,
+    0x57,0xa6,0x4f,0x59,0x91,0x7a,0xbc,0x2f,0xe6,0x0c,0x77,0x5c,0xf4,0x4e,0xeb,0x8b,
+    0xde,0xc0,0xb9,0x41,0xe3,0x94,0x2f,0x73,0x6b,0x29,0x5f,0xe5,0xd6,0x36,0x4d,0x1f,
+    0xf2,0x71,0x1c,0x72,0xcc,0xea,0xd2,0xc7,0xa6,0xa2,0x37,0x50,0x23,0x4a,0x2e,0x29,
+    0x7c,0xd2,0x36,0xae,0xb8,0x0f,0x17,0x41,0xfe,0xfe,0x2e,0xf9,0x00,0xd1,0x0f,0xb3,
+    0xe2,0xa1,0xb7,0x01,0x93,0x13,0xf4,0xb5,0x79,0xf5,0x7e,0xfd,0xcb,0xe7,0x93,0xd5,
+    0x97,0x6b,0xd5,0x1a,0x4d,0x7b,0xb3,0x48,0x98,0x86,0xb6,0xd5,0x2e,0xf5,0xd7,0x19,
+    0x0c,0x11,0x00,0xcb,0xd5,0x06,0x4d,0x64,0xbd,0x2c,0xfa,0x15,0xd3,0x32,0xaa,0xfc,
+    0x52,0xb3,0x20,0x65,0xcd,0x1a,0x23,0x12,0x54,0x46,0x44,0xc6,0x5c,0xf5,0xd9,0xfa,
+    0x0d,0x3c,0xf8,0x02,0x9c,0xd9,0x82,0x42,0x13,0xe3,0x53,0x5e,0xc4,0xa6,0x7f,0x2a,
+    0x6c,0x45,0xe9,0x5a,0x83,0xd7,0xdf,0x64,0xe8,0xbe,0x18,0x2d,0x31,0x8f,0xda,0x44,
+    0xec,0xa5,0x2c,0x5c,0xfd,0xb2,0x1b,0x5a,0x6d,0x03,0x9a,0x87,0x85,0x94,0x85,0xed,
+    0xc6,0xb3,0xa5,0x99,0xfd,0xe9,0x86,0xb9,0xd3,0x50,0xac,0x1f,0xac,0x9f,0x43,0x2d,
+    0x9b,0xd4,0xa7,0x81,0x36,0xa8,0x01,0xad,0x87,0xd1,0x03,0x99,0x30,0xb2,0xb5,0xad,
+    0xc9,0x99,0x66,0x55,0x33,0x97,0x6a,0xcd,0xc4,0x6a,0xd4,0x77,0x7e,0x73,0x91,0xc3,
+    0x22,0xe8,0x1a,0x5f,0xfd,0x7e,0x9d,0xcc,0xc3,0xfb,0xf7,0x97,0x3d,0x75,0xc8,0x6d,
+    0xf8,0x8e,0xe6,0x9e,0x2d,0x32,0x04,0x62,0x39,0x89,0x65,0x56,0x94,0x74,0xc0,0x22,
+    0x5d,0x37,0xb8,0x4f,0x05,0xdc,0x95,0x5d,0x46,0x61,0x3c,0x07,0xd5,0x9b,0xd5,0xa2,
+    0x70,0xbf,0x3b,0x3c,0xa0,0xb7,0x07,0x94,0xfa,0x76,0xc7,0x8a,0xbc,0x3a,0xb8,0x08,
+    0xe3,0xfd,0x63,0x5a,0xef,0x12,0x4c,0xd6,0x76,0x5f,0xcc,0x2a,0x93,0x41,0x72,0xbf,
+    0x1d,0xcb,0x66,0xfb,0xab,0xfd,0x31,0x94,0x59,0xe6,0x55,0x4a,0xd5,0x84,0x81,0x89,
+    0x92,0xe5,0x8d,0xd8,0xd1,0xb7,0xcf,0xb2,0xb3,0xaf,0x06,0xca,0x20,0x91,0x4f,0x29,
+    0x0d,0x14,0x1b,0xd3,0xd6,0xb5,0x30,0x39,0xeb,0x2a,0x77,0x86,0xc9,0x9d,0x60,0xea,
+    0x13,0x5b,0xf3,0x3b,0xda,0xba,0x2c,0x20,0x17,0xe1,0x68,0xc1,0xb8,0x17,0xd6,0x57,
+    0x8c,0xb7,0xbe,0xda,0xef,0x0f,0x59,0xaf,0x24,0x60,0xf4,0x59,0xce,0x03,0x1e,0x4e,
+    0x0f,0xaf,0x34,0x95,0x4d,0xea,0x92,0xa4,0xa7,0xd4,0x82,0x3e,0x3a,0x1a,0x7c,0xf5,
+    0x0a,0xf4,0x76,0xec,0x56,0x97,0xa7,0x99,0x33,0x5b,0x51,0x94,0xfa,0x0e,0xbb,0xa9,
+    0x98,0x30,0x90,0xc2,0xfd,0x07,0xa4,0xf3,0x94,0x48,0xa2,0x84,0xf7,0x4b,0x0a,0x3f,
+    0xc9,0x10,0xd6,0x73,0x3e,0x12,0x96,0x20,0x0b,0x03,0x19,0x03,0x32,0xfa,0xd1,0xcc,
+    0x28,0x93,0x03,0x56,0xc4,0xde,0x7f,0xc9,0x16,0xe8,0x10,0x54,0xad,0x15,0x20,0x65,
+    0x86,0x3c,0xdd,0xdf,0x77,0xf4,0x7d,0x24,0xc2,0x77,0xf8,0x66,0xf1,0x29,0x02,0x06,
+    0x91,0x24,0x4b,0x76,0x75,0xac,0xae,0x9d,0x64,0xf8,0xd2,0xa1,0xc1,0x13,0xef,0x3c,
+    0x32,0xe2,0x7b,0x73,0x60,0xf4,0xf6,0x57,0x8c,0xcb,0xd0,0xf9,0xc0,0x08,0xe0,0xba,
+    0x71,0x3d,0x55,0x2b,0xe7,0xe1,0xaf,0x5b,0x14,0xa7,0xc6,0xe9,0xae,0x39,0xa2,0x36,
+    0x4d,0x36,0x12,0x44,0x88,0x5d,0xbe,0x8d,0xbc,0x26,0x92,0xd9,0x78,0x1d,0x2c,0x56,
+    0xc5,0xde,0x6d,0xd0,0xb0,0xbe,0xb2,0x5c,0x23,0xe4,0x65,0x25,0xed,0x92,0x98,0x54,
+    0x4b,0xe9,0x05,0xd2,0xd2,0xf0,0x57,0x51,0xf7,0x1d,0x9e,0x7b,0x6c,0x57,0x9f,0xa8,
+    0x0e,0xae,0xd2,0xdb,0x30,0xab,0x37,0x79,0x11,0xc7,0xe9,0x5d,0xa3,0x5d,0x37,0x4b,
+    0x94,0xea,0x59,0x22,0xb8,0x8e,0x4b,0x5b,0x95,0x73,0x0d,0x03,0xd7,0x12,0x86,0xcd,
+    0x46,0x6c,0xa3,0x2e,0xda,0x29,0x2b,0x62,0xb4,0x9a,0x64,0xb5,0xa7,0x41,0x64,0xd0,
+    0x45,0xb2,0xf3,0xf8,0x87,0xd5,0xbe,0x25,0x0a,0x53,0x6e,0x9e,0xb7,0x12,0x84,0x36,
+    0xfb,0xed,0x6a,0xab,0xf7,0xf6,0xe4,0x82,0xf0,0x36,0x67,0x87,0x96,0xb4,0xef,0x78,
+    0xa3,0x22,0xec,0xed,0xf5,0x56,0xf0,0x6b,0xec,0x07,0xa6,0xc9,0xd6,0x60,0x45,0xb5,
+    0xbf,0x44,0x2c,0xbf,0x50,0xc5,0xd7,0x6a,0x37,0xd3,0xea,0x67,0x5b,0x06,0xd3,0xd6,
+    0xeb,0x2f,0xd0,0xf1,0x0d,0x76,0x91,0x33,0x77,0x43,0x25,0x9b,0x33,0x0d,0x00,0x06,
+    0xa9,0x21,0xdb,0x2b,0x1e,0x15,0x0f,0xca,0x8c,0x76,0x39,0x6e,0x13,0xef,0x95,0xd7,
+    0x1b,0xf1,0xb2,0x2a,0x84,0x57,0x2e,0x1a,0xf4,0xfa,0x7c,0x7a,0x82,0x76,0xac,0xdf,
+    0xe0,0x59,0x79,0x97,0xde,0xd5,0x1e,0x29,0x74,0x97,0xcb,0x0b,0x22,0x4e,0x66,0x9d,
+    0xac,0x09,0x93,0x8f,0x58,0xe7,0x6b,0x71,0x22,0xf4,0xd9,0x9c,0xd7,0x8b,0x1b,0x38,
+    0xe2,0xb2,0x0f,0x7a,0x9d,0x87,0x3e,0xab,0x3a,0x28,0x5f,0x11,0x51,0x51,0xf5,0x4c,
+    0x42,0x13,0x00,0xcc,0x20,0x14,0x60,0x6a,0x0b,0x81,0x54,0x4e,0xd0,0x5f,0xd2,0x23,
+    0x1d,0x7b,0xd8,0xe7,0xa4,0x0b,0xe7,0xc7,0x32,0x34,0x6a,0x2c,0x26,0xb6,0xfa,0xbb,
+    0x0e,0xb2,0xcf,0xa4,0xd7,0xd5,0xa4,0xd3,0x21,0x1b,0x40,0x5d,0xd5,0x4b,0xe1,0xa5,
+    0xbd,0x2d,0x69,0x12,0x3f,0x30,0x84,0x6e,0x05,0xa7,0x38,0x9c,0x2f,0x90,0x54,0xea,
+    0xae,0x94,0xd1,0xdd,0xbc,0xea,0x46,0xc9,0xfa,0x29,0x0a,0xef,0x36,0x80,0xa1,0x53,
+    0x27,0x9c,0x84,0xec,0x58,0x02,0x7f,0x3e,0xae,0x2d,0x58,0x88,0x72,0x5e,0xd0,0x1c,
+    0x87,0x28,0x3b,0x2e,0x57,0x1b,0x1a,0x66,0x8f,0xed,0x81,0xe6,0x51,0xa7,0x8c,0xcc,
+    0x05,0x09,0x09,0x3d,0xd9,0x4a,0x6b,0x2c,0x36,0x68,0x6b,0xf6,0xa8,0x6a,0xdb,0xdd,
+    0xee,0xde,0x9e,0xdc,0x2e,0x7a,0xba,0x48,0xef,0x7a,0xcf,0x74,0xed,0x4c,0xfd,0x18,
+    0x2e,0xc3,0xa0,0x78,0xcb,0x8f,0x4c,0xbc,0x4b,0x1b,0x8f,0xa7,0x8b,0x9b,0xcb,0xcb,
+    0x38,0x2c,0x2b,0xeb,0xcf,0xe7,0xf5,0x9d,0x92,0x5d,0xee,0x8c,0x36,0xa4,0x23,0x48,
+    0x21,0xaf,0x26,0x96,0xaa,0x7a,0x9d,0xaf,0x94,0xad,0x7d,0xbe,0x2f,0xfc,0x53,0x16,
+    0x24,0xf9,0x65,0x98,0x51,0x3e,0x44,0xbb,0xb6,0xaa,0xed,0x75,0x48,0x82,0x82,0xf9,
+    0xfc,0x53,0xfa,0x49,0xb0,0xbe,0xb7,0xe3,0x86,0x30,0x0d,0x46,0x8d,0x85,0xbb,0x65,
+    0xef,0x4d,0x30,0xa1,0x26,0xb6,0xf8,0x05,0x2c,0x98,0x8e,0xf9,0xd4,0x1c,0x5b,0x07,
+    0xd6,0x92,0x7a,0xd1,0xab,0x64,0xae,0xa5,0x65,0x36,0x19,0xf9,0xa9,0xc8,0xed,0x10,
+    0x15,0x23,0xbd,0x0b,0xfa,0x68,0x5d,0x2f,0x4a,0x34,0x39,0x45,0x44,0xf3,0x72,0x7c,
+    0x7e,0x2d,0x3a,0x28,0x0e,0x12,0xad,0xdd,0x4d,0xab,0x13,0x58,0x7c,0x79,0xa2,0x02,
+    0x4d,0x2f,0x31,0xca,0xbc,0x49,0xbb,0x4e,0x01,0xd8,0x96,0x54,0x57,0xc2,0xab,0x6e,
+    0xcc,0x3b,0xeb,0xc2,0x0c,0x92,0x43,0x6a,0x68,0x5f,0x4e,0x31,0xe4,0xcb,0x6d,0xe5,
+    0x21,0x94,0xb7,0x41,0x76,0x15,0x25,0xfe,0x50,0xb7,0x9e,0x43,0xc8,0xe2,0x08,0xef,
+    0xb3,0xd5,0xb7,0xda,0x19,0x15,0xbf,0x51,0x31,0x30,0x9f,0xd7,0xdf,0xd4,0x24,0xc4,
+    0xaa,0x3d,0x8a,0xc4,0xba,0x5d,0xa3,0x8c,0xcd,0xde,0x0d,0xaf,0xd9,0x5b,0x9f,0x10,
+    0x61,0xb5,0xa0,0xd4,0xab,0xbf,0x4d,0x61,0x69,0xaf,0x9b,0x2d,0xda,0xfa,0x50,0x3b,
+    0x52,0x03,0xec,0x25,0x52,0xac,0xaf,0xce,0xa6,0x6c,0x24,0xd5,0x57,0x0c,0x63,0x03,
+    0xc4,0xbe,0x3c,0xd4,0xc4,0xdc,0xd0,0xea,0xce,0x0e,0x39,0x79,0x20,0xa6,0x81,0xff,
+    0x7d,0xf3,0xc8,0xd3,0x82,0xcd,0x40,0xb6,0xa7,0x5d,0xc5,0x0c,0xfb,0x9a,0xe9,0x89,
+    0x5d,0x43,0x19,0x4a,0x25,0xd7,0xcd,0x2b,0xd7,0xa6,0xc4,0x77,0x9e,0x07,0xf8,0xfd,
+    0xf7,0x5d,0x7b,0x3e,0xe9,0x75,0x11,0x6d,0x75,0x86,0x46,0x2b,0x16,0x51,0xce,0xf3,
+    0x2e,0x3e,0x69,0xd4,0x93,0x05,0x65,0xce,0xd1,0x9f,0xf4,0x56,0x66,0xf1,0xb5,0xa6,
+    0x41,0x34,0xea,0x1b,0xca,0x68,0x05,0x50,0x56,0xbd,0x66,0x84,0x65,0x89,0xac,0x38,
+    0xcf,0x52,0x6e,0xc2,0xe9,0x15,0x5d,0x81,0x0d,0x2d,0x37,0x30,0xd7,0xa3,0x54,0x8f,
+    0xf9,0x75,0x10,0xc7,0x6b,0x02,0x1d,0xd6,0x80,0x12,0x84,0x2b,0xd2,0x3e,0xb1,0x4e,
+    0xcb,0xbc,0x6e,0x59,0x08,0x37,0x93,0xdd,0x84,0x32,0x91,0x60,0x3b,0x4c,0x78,0xc8,
+    0x47,0xac,0xfc,0x0e,0x45,0xcc,0x94,0xc8,0x3c,0x42,0xc6,0x72,0x35,0xb7,0xbc,0x6e,
+    0x6a,0xae,0x3e,0xd0,0xb7,0x08,0x83,0xe4,0xee,0xa4,0x6a,0xb0,0xe5,0x24,0xd6,0xea,
+    0x14,0xd6,0x81,0xd1,0x1f,0x16,0xe9,0xdf,0x96,0xcb,0x30,0x7b,0x19,0xe4,0xe4,0x87,
+    0x82,0x2d,0x73,0x5e,0xd5,0xc6,0xe8,0xae,0x99,0xd6,0x8d,0x53,0xae,0x25,0x55,0x65,
+    0x9c,0xd6,0x58,0x9a,0x95,0x9b,0x12,0x0f,0x31,0x74,0x0a,0xd3,0x0a,0xbe,0x1e,0xac,
+    0x88,0x45,0x26,0x19,0x92,0x31,0x20,0x54,0x46,0x41,0xd2,0x7a,0x66,0x88,0x05,0x60,
+    0xca,0xab,0xd9,0xa1,0x1c,0xb6,0x05,0x92,0xf3,0xa4,0x49,0xdb,0xc9,0x36,0x3c,0x82,
+    0x6e,0x3c,0x1a,0x53,0xa8,0xfd,0xcd,0x93,0xba,0x0c,0xa3,0x1d,0xe6,0x74,0x45,0x17,
+    0xb4,0x65,0xb3,0x36,0x9f,0xcb,0xb0,0xa0,0xdd,0x4d,0xb5,0x39,0xe6,0x8f,0xac,0xc9,
+    0x86,0xb9,0xdc,0xad,0x3d,0xc8,0xad,0x52,0xb2,0x23,0x6d,0xff,0x00,0xc9,0x8c,0xef,
+    0xaf,0xdb,0xc1,0x89,0x01,0xf6,0xd5,0x1a,0x2e,0x41,0xa1,0x88,0x1a,0x5e,0x50,0xc1,
+    0xeb,0xc0,0x6a,0x13,0xe0,0x5d,0xf0,0x65,0x1b,0xd2,0x56,0x48,0x42,0x4a,0x5d,0xa3,
+    0xc9,0x2b,0xde,0xe8,0xeb,0x26,0xb8,0x1b,0x96,0x24,0x80,0xa1,0x3e,0x3b,0xdf,0xc1,
+    0xb8,0x57,0xb9,0x71,0x79,0x62,0x60,0x87,0x83,0x36,0xb4,0xa5,0x97,0x96,0x8d,0x7e,
+    0xff,0xfd,0xec,0x5c,0x23,0xd9,0x38,0x2d,0xd8,0xb6,0x40,0xb9,0x40,0x55,0xf8,0xfa,
+    0xb4,0x38,0x92,0x29,0x2b,0x5c,0xc3,0x81,0x9c,0xaa,0x4c,0xce,0x8a,0x73,0xbe,0x83,
+    0xa5,0xb1,0x77,0xf0,0x90,0x2d,0xbf,0x76,0x2d,0x24,0xc9,0xd3,0xc8,0xb0,0xff,0xfc,
+    0x0b,0x6c,0x40,0x43,0xdf,0x61,0xcc,0x7b,0x02,0x85,0x03,0x04,0xb3,0x27,0x5d,0x66,
+    0x73,0xb2,0xce,0xc4,0xf4,0x61,0x63,0x60,0x72,0xd7,0x1f,0x26,0x2d,0x21,0x77,0x5a,
+    0x63,0x3a,0x43,0xda,0x5c,0xf3,0x14,0xed,0xb5,0x00,0x58,0x75,0x12,0x3e,0xff,0xf6,
+    0xe1,0x25,0x29,0x16,0x05,0x94,0x3d,0xb5,0x5c,0x10,0xc6,0xe0,0x5f,0x64,0x59,0xf0,
+    0x30,0xbc,0xcc,0xd2,0x6b,0x20,0x85,0xa8,0x2b,0x7b,0x15,0xcc,0x16,0xbd,0x72,0x7b,
+    0x3e,0x62,0xc4,0x33,0x95,0x2c,0x6f,0x48,0x47,0xef,0x68,0x09,0x4a,0x4c,0xe7,0x88,
+    0xaf,0x71,0xc8,0x57,0x6d,0x08,0xa4,0x7a,0x5e,0xbe,0x1f,0xfa,0xc7,0x8f,0xc5,0xea,
+    0x09,0xbb,0x50,0x6b,0xc6,0xc6,0x39,0x3b,0x73,0x59,0xe2,0x4b,0x22,0xb8,0xe3,0x4b,
+    0x4f,0x7d,0x6d,0x0d,0x5e,0x3b,0x20,0xb1,0x40,0xb4,0x15,0x53,0xc4,0xd5,0x80,0xf4,
+    0xa5,0x43,0xb9,0x49,0xda,0x70,0x3a,0x9a,0x71,0x68,0xda,0x82,0x9d,0xb5,0xa3,0xa0,
+    0x9f,0x37,0x6d,0x6d,0x90,0x6e,0xf9,0x32,0x4a,0x22,0x1a,0x49,0x41,0xbe,0x92,0x14,
+    0x68,0xe5,0xb9,0xd7,0x52,0x0a,0x5a,0x30,0xab,0xed,0xec,0x04,0x70,0xc3,0x36,0x7f,
+    0xae,0xff,0xdb,0x37,0xf3,0x93,0xf2,0x6c,0x5f,0xf0,0x59,0xe7,0x2b,0xdf,0xa4,0x77,
+    0x52,0x77,0x36,0xae,0x6b,0x6d,0xd8,0xe9,0xdc,0x94,0x82,0xee,0x5c,0x8b,0x92,0x8c,
+    0x22,0x5d,0xd2,0xba,0x6f,0x70,0x15,0xf0,0x20,0xb1,0x02,0x51,0x32,0x4c,0xa6,0x5e,
+    0xe8,0x3a,0xc3,0xeb,0x9f,0x04,0x29,0xe7,0xd3,0x75,0x46,0x2b,0x5c,0x39,0x89,0x5b,
+    0xc2,0x6a,0x1c,0x13,0x4b,0xfe,0x4d,0x5d,0xc8,0x43,0x9c,0x9d,0xbd,0x54,0xd2,0x44,
+    0x9d,0xf0,0x33,0x23,0x9f,0x52,0xa2,0xe1,0x5b,0xbe,0x6f,0xa5,0xd7,0x92,0x1f,0x66,
+    0x3a,0x1b,0x47,0xe3,0x3a,0x5e,0xe9,0x3f,0x8a,0x2b,0x24,0x10,0xee,0x7f,0x10,0x7b,
+    0x58,0xe8,0xcc,0xf7,0xd9,0x70,0x38,0x84,0xc1,0x91,0xa9,0xd9,0x86,0xdd,0x32,0x7d,
+    0x96,0xb7,0x71,0xb5,0xe1,0x5d,0xbc,0x4f,0x62,0x16,0x14,0xd4,0x03,0xcc,0xd5,0x4e,
+    0x58,0x2a,0xba,0x3e,0x37,0x2b,0x10,0xe6,0x77,0x92,0x86,0xed,0xc0,0x21,0xb5,0x13,
+    0x9b,0x6f,0xda,0x67,0xff,0xea,0x1d,0xd0,0xd6,0x89,0x75,0x1d,0x04,0xe2,0xf4,0x54,
+    0x3d,0xc6,0x6f,0xe2,0xcf,0x51,0xe4,0x65,0xf4,0x7c,0xba,0x0c,0x67,0x7f,0xcb,0xe2,
+    0xde,0xea,0x89,0x9d,0x4d,0xf4,0xd1,0x08,0x4a,0xbb,0x8b,0x3a,0xb8,0xf2,0x68,0x61,
+    0x75,0x8c,0xab,0x75,0xb6,0x2a,0x6a,0x9c,0xed,0x9a,0xa6,0x8d,0xf3,0x43,0x21,0xb9,
+    0x6b,0xa4,0xdf,0x30,0x17,0xa2,0xbd,0xd8,0xfb,0xaa,0xfe,0x63,0x20,0x0a,0xc2,0xf9,
+    0xe0,0xef,0x51,0xb1,0x00,0x9a,0x4d,0xc0,0x2a,0xbd,0xc7,0x11,0xea,0x30,0x62,0x72,
+    0x48,0xcd,0x33,0xf0,0x2d,0x22,0x27,0x9a,0xa1,0xeb,0xcf,0x69,0xb5,0x84,0xee,0x11,
+    0x39,0x24,0x87,0x59,0x04,0xf1,0xef,0xbf,0xb3,0x9b,0x2d,0xc8,0x3c,0xa6,0x9d,0x47,
+    0xae,0x9b,0x07,0xc3,0x9a,0x3d,0xd0,0xd1,0xb0,0xb4,0x71,0x34,0x8c,0x9f,0x0c,0x4b,
+    0xcb,0x93,0x61,0x5d,0x38,0xb0,0xc3,0x00,0xdd,0xe7,0x1c,0x27,0xab,0x10,0x25,0x2c,
+    0x20,0x18,0xb5,0x4e,0xc1,0x05,0x9c,0x98,0x28,0x88,0x6a,0x6c,0x0b,0xd9,0xc5,0x1d,
+    0xcc,0x32,0xde,0x17,0x5c,0x30,0x64,0x48,0x4f,0xac,0x91,0xe8,0xd3,0xc6,0xa1,0x4b,
+    0xd0,0x99,0x1b,0x3b,0x7c,0xe1,0x3b,0x25,0xef,0x40,0x7d,0x96,0xa5,0xf5,0x95,0x47,
+    0x45,0xbc,0xd7,0x63,0x91,0x75,0xff,0x89,0x8e,0x71,0x23,0x59,0xea,0xd5,0x85,0x24,
+    0xbd,0xf8,0xe7,0xcb,0x18,0xae,0x5a,0x1c,0xbe,0x4d,0x6e,0xe2,0xd8,0xf7,0x43,0xa4,
+    0x92,0xa8,0xa0,0x5d,0x02,0xcf,0x7c,0x0a,0xe8,0xd3,0x4b,0x25,0xec,0xcb,0x6d,0xb3,
+    0x6c,0x43,0x4f,0xc1,0x32,0x12,0x5a,0x8f,0x44,0xfe,0x34,0xa3,0xb0,0xa1,0xcf,0x02,
+    0xa5,0x02,0x0a,0x88,0xb6,0x61,0x7b,0x83,0x4c,0x41,0x67,0x52,0x03,0xc4,0x49,0x7e,
+    0x88,0x3f,0x7d,0x99,0xa5,0x04,0xb5,0x71,0xdf,0x17,0x19,0x82,0xf1,0xf2,0x1a,0x98,
+    0x32,0x51,0x9a,0xae,0x84,0xa8,0x6c,0x7f,0xec,0x0f,0x61,0x7a,0xbd,0xb7,0xb7,0xbe,
+    0x6e,0x18,0xdc,0x47,0xb9,0xbe,0xbd,0xc5,0xf0,0x3a,0xb8,0xff,0x29,0x88,0xb7,0x36,
+    0x34,0xb6,0xb7,0xd8,0x01,0xd4,0x89,0x7a,0x8a,0x64,0x3b,0x0e,0x5f,0x64,0xd7,0xa7,
+    0xb3,0x20,0x0b,0xd4,0xae,0x10,0xbc,0x6a,0xdd,0x2b,0xfc,0x1d,0xf1,0x3f,0xd8,0x11,
+    0x39,0xf2,0x60,0x74,0xc9,0x8a,0x6f,0x3e,0x2f,0xc4,0xf7,0x9f,0xc5,0xf7,0x34,0x8b,
+    0xae,0xa2,0xe4,0x1f,0x7e,0xf5,0xfd,0x67,0xbf,0x40,0x82,0x2f,0xdf,0xd8,0x11,0x93,
+    0x12,0xea,0xee,0x18,0xc9,0x9e,0xf5,0x5a,0xcf,0x3a,0x7a,0x5e,0xb9,0x2b,0x65,0xf5,
+    0xae,0xa0,0x72,0x3c,0xd5,0x68,0x1a,0x63,0x39,0x34,0xeb,0xa3,0x39,0x34,0xeb,0x1e,
+    0xbf,0xbc,0xe2,0x86,0xe2,0x5f,0xb9,0xc4,0x51,0x9f,0xb9,0x5c,0x9b,0x63,0x34,0x67,
+    0xd9,0x69,0x0e,0xb5,0x16,0x2e,0x03,0xc0,0xea,0xf5,0x16,0x77,0x41,0x96,0x80,0xf3,
+    0x6b,0x2e,0xb7,0x28,0x6b,0xbb,0xb0,0x7b,0x31,0x9f,0xd3,0x25,0x34,0xf9,0xa7,0xb4,
+    0xb4,0x0a,0x14,0x9b,0xe4,0x51,0xe2,0xb3,0xcb,0x69,0xf0,0x45,0x23,0x5d,0xcc,0xf9,
+    0x23,0xbe,0xb0,0xf0,0x4d,0xd4,0xe2,0x0b,0x5d,0x3b,0x52,0xb6,0x0e,0x78,0xf3,0xa0,
+    0x6c,0x1f,0xf0,0x17,0x82,0xf2,0x8d,0x40,0xbc,0x82,0x0f,0xb3,0x2a,0x31,0x19,0x7d,
+    0x93,0x45,0xd9,0xe7,0x82,0x77,0xba,0x28,0x7b,0x5d,0xf0,0x6e,0x17,0x65,0xbf,0x0b,
+    0xd1,0xf1,0xa2,0xea,0x79,0x21,0xba,0x5e,0x54,0x7d,0x2f,0x44,0x5f,0x8b,0xaa,0x2f,
+    0x56,0x74,0x21,0xf1,0xbb,0x20,0xf4,0x66,0x61,0x14,0x8b,0x9e,0xf0,0x8d,0x22,0x81,
+    0x38,0x4d,0x33,0x5e,0xc2,0xbe,0x6a,0x24,0x5f,0x37,0xc9,0x9c,0x17,0xb1,0xaf,0x84,
+    0x0f,0x72,0xea,0x99,0x40,0x88,0xbe,0xb2,0x41,0x5c,0x95,0x84,0xbb,0xa2,0x81,0x86,
+    0xf7,0x4b,0xfe,0x8c,0x2f,0x78,0x5c,0xa6,0x77,0xfc,0x11,0x5f,0xa8,0xf9,0xaf,0x59,
+    0x21,0x9a,0xe3,0x1b,0x35,0xe7,0x4f,0xaf,0xd8,0x4e,0x90,0x2b,0xfe,0x80,0x2f,0x86,
+    0xce,0x0b,0x0c,0x7d,0xa5,0xc8,0x2c,0x4b,0x88,0x88,0x71,0x52,0x3e,0x52,0x6f,0x91,
+    0x2f,0x6e,0x18,0xd2,0x68,0xbe,0xf5,0x9e,0x3f,0xe1,0x0b,0x3d,0x4a,0x9e,0x5d,0x33,
+    0x96,0x21,0xdc,0x9a,0xa7,0xd7,0x62,0x7c,0xec,0x7b,0xfd,0xb2,0x06,0x5a,0xdc,0x08,
+    0x8a,0x0f,0xb4,0xb5,0xe4,0x63,0x98,0x53,0xb4,0x1a,0x96,0x9e,0x43,0x64,0xf5,0x39,
+    0xf9,0xe6,0x9e,0xfa,0xb7,0x04,0x03,0x65,0x9b,0x4e,0x95,0x82,0xf6,0x8e,0x2b,0x7d,
+    0xb5,0x7f,0xa2,0x2a,0x83,0xda,0x06,0x08,0x58,0xf1,0x59,0x7a,0xbd,0x64,0xfb,0xfb,
+    0x26,0x54,0x05,0x17,0xd2,0xa9,0x38,0x6c,0x4b,0x87,0x90,0x4a,0x16,0x04,0xc1,0x89,
+    0xac,0x58,0xf2,0xa2,0xaf,0x6d,0x92,0x66,0x54,0x3f,0xdb,0xe1,0xf4,0xbb,0x70,0x40,
+    0xc8,0xc8,0xb7,0x4f,0x00,0x34,0x0e,0xcc,0x0f,0x11,0xeb,0x23,0x4d,0x39,0x3c,0xfb,
+    0x25,0xfb,0x25,0x39,0x3f,0x38,0xa4,0x25,0x85,0x5d,0x4f,0xd0,0xaf,0xbe,0x9b,0xfa,
+    0x87,0xbd,0xb3,0x60,0xf0,0xdb,0x8b,0xc1,0xff,0xfc,0xef,0xb9,0xf8,0xa2,0x0f,0xbc,
+    0xff,0x3d,0x7f,0xde,0xff,0x25,0x7f,0xee,0x9f,0xfd,0xbf,0xa9,0x7f,0x7e,0x38,0x25,
+    0x52,0x92,0x86,0xfb,0x67,0xa1,0x96,0x9c,0xb3,0x49,0x88,0x08,0xe6,0x2d,0xa7,0x09,
+    0x05,0xda,0x98,0x44,0xbe,0x12,0x05,0xd3,0xe8,0x48,0xb6,0x94,0x09,0x7a,0x44,0xf3,
+    0x0a,0x34,0xc2,0xd8,0x97,0x55,0x67,0xd1,0x79,0x6b,0x9b,0x6c,0x5c,0x4f,0xe7,0x59,
+    0xeb,0xcc,0x8f,0x91,0xb7,0x43,0x70,0x68,0xf3,0x51,0xda,0x9f,0x92,0x27,0x7f,0xe6,
+    0xfb,0xd9,0xde,0x9e,0x71,0x94,0x55,0xc7,0xa7,0x8a,0xb3,0xec,0xcc,0x38,0x3f,0x07,
+    0x2a,0x06,0x3c,0x4f,0xc4,0xbd,0xb2,0x28,0xea,0x3f,0x3d,0x55,0x9b,0x97,0x80,0xe9,
+    0x2b,0xda,0x65,0x44,0xfe,0x5c,0x3d,0xe8,0x51,0x58,0x14,0xc1,0x79,0x31,0xba,0x4e,
+    0xd4,0x37,0x8c,0x44,0x07,0x6a,0x5d,0x64,0xd8,0xc4,0xac,0xa1,0x1e,0x74,0x8a,0xe2,
+    0xf0,0x1a,0xad,0xe0,0x08,0x5a,0x87,0x62,0x79,0x17,0x88,0xff,0x66,0x04,0x24,0xb9,
+    0x52,0x18,0xe3,0x48,0xda,0xca,0x17,0x9e,0x84,0x0c,0xe7,0x5d,0xf2,0x47,0x4b,0xac,
+    0x0c,0x27,0x19,0x2d,0x24,0xbb,0x88,0x05,0xdb,0x0f,0x5d,0x46,0xc1,0x6b,0x18,0x2d,
+    0x2e,0x20,0xd0,0xb5,0xa0,0xce,0x33,0x3e,0x09,0x94,0x36,0x26,0x81,0x08,0x4e,0xe4,
+    0xa7,0x34,0x09,0xc4,0xe7,0xd7,0xa7,0xfa,0x51,0x54,0x92,0xbc,0x19,0xcf,0x45,0x1a,
+    0x5d,0x2a,0x52,0x52,0x39,0xa8,0x51,0xb9,0xbd,0xbd,0x8a,0x13,0x14,0xb4,0x2f,0x90,
+    0xe2,0x7e,0x05,0x55,0xc5,0xaa,0xf4,0x66,0xaa,0x06,0x4f,0xeb,0xc8,0x4a,0x2c,0xee,
+    0x85,0x72,0x73,0xf9,0xd9,0x79,0xed,0xda,0xa9,0x5d,0x95,0x67,0x9a,0xd0,0x25,0x0b,
+    0x2d,0xba,0x56,0x83,0x17,0x28,0x34,0x50,0xaf,0x36,0xc9,0x01,0xb6,0x22,0xe0,0xc1,
+    0xfe,0x40,0x44,0x2e,0x60,0x4f,0x1e,0x40,0x9f,0x88,0x0c,0x17,0x4d,0x3d,0x2a,0xd7,
+    0xb4,0x66,0xda,0xa7,0x45,0x54,0x05,0x31,0x2c,0x52,0x20,0x16,0x7c,0x96,0x35,0x4f,
+    0xe2,0x8e,0x90,0xa4,0x71,0x2d,0xc7,0x1a,0x96,0x26,0x2b,0x2c,0x4d,0xf9,0xbc,0x5e,
+    0xc9,0xd2,0x74,0x0d,0x4b,0xd3,0xf5,0x2c,0x6d,0x6d,0x2b,0xfb,0x37,0x72,0x74,0x77,
+    0x5e,0x56,0x6b,0x66,0x62,0xe2,0xf4,0xf1,0x49,0x2b,0xf0,0x47,0xec,0x7d,0x5d,0x63,
+    0xcb,0x29,0x08,0x9a,0x56,0x07,0x2f,0x7f,0xff,0x5d,0x3f,0xea,0xd5,0x1b,0xd7,0x15,
+    0x4f,0xe6,0xee,0x27,0x6b,0x02,0xaa,0x80,0xf2,0x46,0x04,0x73,0xed,0x9c,0x40,0xbd,
+    0x57,0x69,0x9e,0x93,0x96,0xea,0xef,0x59,0x9e,0xdd,0xae,0x7f,0x90,0xf5,0xbd,0x0a,
+    0x93,0x13,0x55,0x53,0x54,0x7e,0x54,0xe2,0xa1,0xf3,0x25,0x76,0x8c,0xac,0xeb,0x3d,
+    0x85,0xae,0xb6,0x13,0xaf,0xf2,0x46,0xb5,0x93,0xa5,0x6b,0x71,0xf7,0x99,0xad,0xe3,
+    0x17,0xe1,0xd1,0xc6,0x5f,0xd0,0x30,0x22,0xc7,0xd6,0x43,0x86,0x45,0x57,0x30,0xd0,
+    0xd0,0x3a,0x68,0x23,0xb4,0x67,0x37,0xd2,0xac,0xa9,0x54,0x3f,0x20,0x4c,0x0c,0xe7,
+    0xaa,0xd6,0x5c,0x42,0x5b,0x59,0x0b,0x7d,0x94,0xdb,0x03,0x9f,0x6d,0xde,0x57,0xbb,
+    0xcb,0xee,0xdb,0xbd,0xbd,0x2e,0xc9,0x61,0xba,0xb2,0x56,0xeb,0x1b,0x7b,0x60,0x28,
+    0xc9,0xe4,0x1b,0x5d,0x08,0x54,0x6b,0xa3,0x4f,0xa5,0x25,0x4f,0x4f,0xcd,0xe9,0xc4,
+    0xd6,0x0e,0xab,0xe6,0xe5,0x02,0xd2,0x72,0x8b,0x1c,0x7e,0xe3,0x72,0x70,0x7b,0x9f,
+    0xe9,0x1f,0x82,0x54,0xdf,0xd8,0xb9,0x02,0x88,0x2c,0xd3,0x2e,0x70,0x56,0xb6,0x02,
+    0x3d,0x6e,0xee,0xb4,0x49,0xb2,0x9d,0xb8,0xc6,0xc5,0xab,0x7a,0x69,0x22,0xee,0xeb,
+    0xdc,0xb2,0xb3,0x8c,0x6d,0xa5,0xdb,0xd8,0xe6,0xf7,0xdf,0xc9,0x1a,0xb0,0x39,0xa4,
+    0x8a,0x89,0x4d,0x23,0x53,0x43,0xb5,0x6b,0x1b,0x32,0x93,0x24,0x61,0x55,0xc8,0xea,
+    0x74,0xee,0xec,0x5f,0x69,0x09,0x0b,0xb5,0xd6,0x30,0x3d,0x3e,0x91,0x65,0x2a,0x4a,
+    0xcb,0x14,0x76,0xd9,0x15,0x18,0xe9,0x2e,0x73,0xd2,0x55,0xcc,0x6d,0x01,0x02,0xa1,
+    0x4e,0xeb,0x46,0xb3,0x3d,0xf5,0xde,0xda,0x9b,0xc8,0x23,0x5a,0x20,0x58,0x96,0x57,
+    0xb1,0xfa,0xe2,0x9a,0x55,0x52,0x64,0x39,0xdd,0xce,0x83,0xdf,0xd3,0x22,0x5c,0xb2,
+    0x5b,0x79,0x5a,0xe4,0x63,0xc5,0xc2,0xb1,0x6e,0x23,0x4b,0x2b,0x0a,0x6c,0x35,0xef,
+    0xb8,0x2a,0x96,0xc7,0x87,0x6c,0xdf,0x7c,0x87,0x7d,0x2a,0xca,0x0b,0xab,0xb8,0x07,
+    0xa1,0xb8,0xa8,0xc4,0xfe,0x1d,0xfa,0xfb,0x90,0x62,0x78,0xbd,0xd5,0xeb,0x87,0x5a,
+    0x83,0x3e,0x38,0xd8,0xd2,0xe0,0xd8,0xdf,0x8c,0x2a,0xbb,0xbd,0xb6,0x8e,0x04,0x9b,
+    0x65,0x17,0x05,0x4f,0xd0,0x58,0xba,0xd5,0x30,0xbd,0x29,0x7a,0x25,0xc9,0xb4,0x15,
+    0x52,0x75,0xdc,0x7a,0x5b,0xdf,0x25,0x42,0xfa,0xc0,0xd9,0x9a,0xd1,0xad,0xc6,0xb4,
+    0xf2,0xc4,0x3a,0x22,0x97,0x9c,0x0b,0x32,0x1c,0xf9,0xfc,0xf9,0xf5,0xfc,0x5e,0x26,
+    0x1b,0x73,0x5a,0xc6,0x62,0x42,0x1b,0x68,0xa1,0xa8,0xce,0xcf,0xca,0x66,0xe7,0x74,
+    0x04,0xab,0x7c,0x02,0x1d,0x64,0x1c,0xa9,0x2a,0xb4,0x28,0x8f,0x1e,0x9e,0x25,0x67,
+    0xfa,0x79,0x73,0x81,0xa2,0x5a,0xf5,0x53,0xaf,0x74,0x92,0xbc,0x2d,0x6d,0x8c,0x2a,
+    0xf7,0x41,0xc2,0x9a,0x66,0x21,0x3f,0xd0,0x27,0x91,0xb6,0xda,0x95,0x24,0x20,0xa9,
+    0xff,0xcc,0xd0,0x22,0xfc,0xa9,0x89,0x8c,0x01,0x91,0x49,0x1a,0xe7,0xeb,0x28,0x63,
+    0x10,0x37,0x97,0x35,0x7b,0xaf,0xa7,0x8b,0x4c,0x9b,0xb8,0x83,0xcb,0xc3,0xef,0xe3,
+    0x34,0x28,0x7a,0xf5,0x17,0xc5,0xc2,0x0c,0xdd,0xac,0x19,0xe5,0xef,0x82,0x77,0xbd,
+    0x80,0x9c,0x2f,0xfa,0x87,0x26,0x0c,0xef,0xfd,0x00,0xe5,0xbb,0xf5,0xf3,0xf0,0x35,
+    0xfd,0x44,0xbc,0x9f,0x07,0xea,0x47,0x4e,0x2a,0xa6,0x7b,0x7b,0x11,0xbb,0x7d,0x25,
+    0x4a,0xd8,0x3c,0x4d,0x6d,0x3d,0x19,0x06,0x0f,0x8a,0x3f,0xe3,0x72,0xcd,0x26,0x7a,
+    0x28,0x5f,0x15,0xe2,0x9a,0x92,0x19,0x03,0x1b,0xa1,0xc3,0xcf,0x56,0xcd,0x44,0x22,
+    0xf5,0xa1,0xe4,0x86,0x42,0x07,0xa2,0x44,0xa1,0x5f,0x68,0x25,0xfd,0xf9,0xb2,0x11,
+    0x2f,0xae,0x35,0xd1,0x9a,0xcd,0x69,0x32,0x2b,0x2e,0x02,0x76,0xcf,0x70,0xbd,0x19,
+    0x44,0x61,0x50,0x83,0x40,0xe7,0x1d,0x69,0xfb,0x32,0xbf,0x8d,0xd8,0xd7,0x8f,0xfc,
+    0xfa,0x8b,0x27,0xab,0xdb,0x9c,0xeb,0x77,0x17,0x0f,0x36,0x56,0x4f,0x1b,0xe8,0x21,
+    0x07,0x6c,0xf4,0x6b,0x9c,0x93,0x94,0xc9,0x19,0x98,0x5e,0xbd,0xd7,0xfe,0xd1,0x46,
+    0xb8,0xfd,0x1a,0xbe,0xf5,0xd7,0xb4,0x06,0xa1,0x49,0x8b,0x73,0xdf,0xa0,0x79,0x8d,
+    0x45,0x4a,0x4d,0x0b,0xbe,0x5f,0xbd,0xcd,0x10,0xde,0xae,0x9a,0xe7,0x59,0x83,0xd2,
+    0xe1,0x66,0x94,0x3a,0xfa,0x3e,0x32,0xda,0x8a,0x53,0xa1,0xf2,0x7c,0x23,0xb4,0xc3,
+    0x6e,0x14,0x9e,0x4a,0xb1,0x80,0x07,0x95,0x7c,0x6d,0x31,0x12,0x35,0x1f,0x17,0xa9,
+    0xdf,0x24,0x74,0x33,0xd6,0x67,0x6f,0x22,0xb6,0xe4,0xd9,0xc1,0xf7,0x1f,0x7a,0x4d,
+    0xe1,0xd0,0x5c,0xca,0xbb,0x01,0x64,0x5d,0x13,0x43,0x34,0x79,0x29,0x90,0x68,0xb6,
+    0x93,0xa8,0x95,0x6d,0x56,0x20,0x71,0x14,0x79,0x3d,0x33,0xcc,0x8c,0x5a,0x2c,0xe3,
+    0x68,0x93,0x90,0x5a,0x08,0x9a,0x34,0x61,0x48,0xfe,0x97,0xc8,0xae,0xb4,0xe0,0x94,
+    0xe6,0xf5,0x2f,0x2e,0xf2,0xef,0x4a,0x32,0xd6,0x9b,0x75,0xd3,0x99,0xbf,0x44,0x08,
+    0xbc,0x60,0x99,0x50,0xd9,0x7c,0x23,0xd3,0xf0,0x16,0x6d,0x68,0x63,0xfa,0xcf,0x5c,
+    0x04,0xc5,0xe7,0xdc,0x4c,0x70,0xf6,0xd7,0x02,0xd2,0x12,0xcd,0x6a,0x2a,0x58,0xce,
+    0x08,0xf6,0x0c,0x5a,0x00,0x92,0xa6,0xa6,0x66,0xab,0xc2,0xe7,0xc1,0x61,0x40,0xf6,
+    0xed,0xfb,0xe8,0x3e,0x9c,0x37,0x16,0x59,0xda,0xbd,0x8a,0xcc,0xf7,0xd9,0x8a,0xe5,
+    0x39,0xf6,0x57,0x69,0x4c,0x7b,0x2e,0x5a,0xcd,0x98,0x9f,0xb9,0xf7,0xc5,0xcc,0xf7,
+    0xa1,0xf9,0x5c,0x32,0xed,0xb9,0x9c,0x9b,0xad,0x31,0x9a,0x44,0xff,0x41,0xb4,0xfd,
+    0x79,0xa5,0x2d,0xdd,0xa7,0xde,0x6c,0xcb,0x6b,0x0f,0xfc,0x92,0x45,0x55,0x35,0x15,
+    0x96,0x9c,0x6d,0xc8,0xec,0x0f,0xba,0xf2,0xb7,0x36,0xdf,0xd8,0x14,0x6c,0x03,0x38,
+    0xe3,0xdb,0x4f,0x1b,0xda,0xa1,0xe3,0x3e,0xe3,0x93,0xde,0x6f,0x92,0xaf,0xee,0xb9,
+    0xe5,0xba,0x90,0x16,0x48,0x2e,0x20,0xc9,0x6f,0x93,0x68,0x6f,0xaf,0x8b,0xd5,0x61,
+    0xcb,0xdd,0x87,0xd2,0x73,0x9f,0x70,0x47,0x3f,0xe9,0x05,0xa2,0x2c,0x3f,0x0b,0x2b,
+    0x1f,0x1f,0xd6,0x1c,0x7c,0x50,0xf3,0xcc,0xdf,0xf0,0x3c,0xd3,0x0f,0xea,0x4e,0x5f,
+    0x02,0x37,0x51,0x55,0xd4,0x9d,0x59,0x00,0xe5,0xa5,0x8d,0x7c,0x8d,0x22,0xe3,0x5c,
+    0xba,0xb3,0x82,0x36,0xfd,0x48,0xcf,0x76,0x22,0x85,0x72,0xd2,0xf2,0x58,0x67,0x18,
+    0xf6,0x79,0x83,0x38,0x2b,0xf1,0xb9,0xd8,0x94,0xb4,0xdb,0x8c,0x4d,0xe7,0x2d,0x9f,
+    0x55,0xbc,0xcb,0x8e,0xd2,0xac,0xce,0xe1,0x7c,0xd1,0x24,0x4e,0xbd,0x8b,0xaf,0x9d,
+    0xc9,0xa1,0x69,0x9c,0xb0,0xc2,0xa9,0xad,0xe8,0x82,0x06,0x65,0x9a,0x21,0x8f,0x3a,
+    0x4f,0x36,0x9c,0x9d,0x17,0x2c,0x9d,0xe8,0x5a,0x53,0x72,0x50,0xc0,0x04,0x60,0x42,
+    0x3f,0xd7,0x90,0x2e,0xe9,0x07,0x12,0xa8,0xec,0x61,0xa2,0x3f,0x69,0x2b,0x33,0xdb,
+    0x9b,0x11,0xe9,0xb7,0x73,0x81,0x6d,0xcd,0xb7,0xe7,0x16,0x92,0xdb,0x3c,0x99,0xe8,
+    0x10,0x83,0x0d,0xe9,0x44,0xab,0xbb,0xaf,0x4c,0x26,0xca,0xab,0x6d,0x59,0x56,0x01,
+    0xf1,0xe8,0x89,0x64,0x93,0x5d,0xa9,0x2a,0x29,0x7f,0xd2,0x0e,0xb8,0x27,0x4d,0x2d,
+    0xee,0x93,0xbc,0x97,0xf3,0x72,0x34,0x81,0x21,0x04,0xde,0xe7,0xcb,0xcf,0x32,0x74,
+    0xa3,0x47,0xba,0xf9,0xb8,0x88,0x12,0x08,0xa6,0x10,0x36,0x76,0x89,0x6a,0x43,0xe2,
+    0x3e,0x86,0x39,0xc4,0x2d,0x55,0xf2,0x05,0xfd,0x90,0x49,0xff,0xe9,0xff,0x87,0x44,
+    0xa6,0x03,0x4d,0xb8,0x23,0x85,0x9a,0xf3,0x29,0xe8,0x46,0x96,0xd3,0xd1,0x9a,0x2e,
+    0x3f,0xa2,0x5b,0xb8,0xe9,0x4c,0x71,0x73,0xb0,0xbf,0x2a,0x9f,0x4e,0x55,0x76,0x65,
+    0xbd,0x4c,0x8c,0xea,0xfc,0xff,0xd2,0xdc,0x68,0x25,0x61,0xdd,0x6a,0x34,0x1a,0x87,
+    0x19,0x60,0xd2,0x58,0x13,0x99,0xa1,0xab,0xe6,0x9c,0x2d,0x88,0xce,0xe2,0x94,0x5f,
+    0x56,0x4a,0xdb,0x97,0xf1,0x14,0x06,0xd9,0x47,0xda,0x43,0xae,0x6b,0xba,0x3c,0xa6,
+    0x50,0x9e,0x4d,0x58,0x61,0x4c,0xd7,0x6f,0x95,0x50,0x4a,0x13,0xd0,0x45,0x9c,0xe9,
+    0x67,0x8c,0x93,0x5d,0x02,0x28,0x6f,0xfe,0x43,0x39,0x29,0xed,0xdf,0xe5,0x69,0x8a,
+    0x4d,0x5b,0x06,0xda,0x2b,0xf0,0xcf,0x36,0xad,0xc0,0x93,0x7d,0x1f,0x5e,0x84,0x57,
+    0x51,0x22,0x46,0x42,0x8e,0x57,0x67,0x2e,0x55,0x67,0xe7,0x06,0xc4,0xa9,0x91,0x7f,
+    0xfc,0xdc,0x43,0x48,0x4f,0x03,0x0d,0xb2,0x59,0x8f,0xc5,0x69,0x45,0xd7,0x15,0x25,
+    0xe5,0x89,0x87,0x43,0x13,0x64,0x30,0x9f,0x8b,0xb5,0xbf,0x7e,0x39,0x30,0x41,0xac,
+    0x92,0x74,0xfd,0x95,0x21,0x87,0xd6,0x6c,0xbe,0x32,0x64,0xad,0x81,0x65,0x07,0x6f,
+    0x2b,0x2d,0xa8,0xfc,0xe7,0xce,0xc7,0x55,0xe8,0xb2,0xe2,0x02,0x6e,0xae,0xcd,0x65,
+    0x80,0xa8,0x53,0x20,0xd0,0xc2,0x9d,0x18,0x79,0x22,0x52,0xe6,0x4f,0x29,0x73,0x8a,
+    0x1a,0x77,0x83,0x45,0x49,0x81,0xfe,0xa4,0x18,0xd2,0xba,0x78,0xb3,0x7e,0x27,0x09,
+    0x69,0x5e,0xd0,0x57,0xa1,0x56,0xdb,0x47,0x73,0x86,0xde,0xef,0x0f,0x0a,0xb9,0x45,
+    0xa0,0x7f,0x58,0xf0,0x38,0xea,0xf9,0x5a,0x5e,0x1d,0x6c,0x38,0x9b,0x02,0x51,0xe0,
+    0x22,0x3c,0xe8,0x01,0xee,0x43,0x09,0xf7,0x67,0x09,0xf7,0xe7,0xaf,0x83,0xdb,0x3f,
+    0xaf,0x06,0x52,0x5e,0x55,0x28,0x36,0x9a,0xb1,0x6d,0x37,0x4a,0xd2,0xb1,0x81,0x6b,
+    0x9a,0xec,0x70,0x1b,0x76,0xd2,0x75,0x1b,0x76,0x22,0xf7,0x3c,0x21,0xeb,0x6e,0xde,
+    0x3d,0xdd,0xb8,0xbf,0x3a,0xe8,0x25,0x74,0xb1,0x74,0x22,0x36,0x86,0xfd,0xf0,0x8a,
+    0xf6,0x85,0xe5,0xb3,0x60,0xc9,0xee,0xe3,0xa7,0xfd,0x61,0x09,0xdf,0xd2,0x54,0x9f,
+    0x00,0x5d,0xbd,0x58,0x11,0x98,0x34,0xef,0x98,0x65,0x97,0xe1,0x96,0xfb,0xd3,0xf8,
+    0x00,0xbb,0x76,0xa8,0xd1,0x96,0xb4,0xad,0x03,0x4c,0xbb,0x06,0x58,0x6e,0xea,0x6a,
+    0x0e,0x27,0x5d,0x37,0xd8,0x64,0x6f,0x2f,0xe9,0xa5,0x34,0xd8,0xd6,0x2e,0xb8,0xee,
+    0x2d,0x70,0x62,0x02,0x7b,0x40,0xce,0x8f,0x2e,0xdf,0x5a,0x22,0x64,0xe2,0x3f,0x44,
+    0x75,0x48,0x3f,0x2d,0xa0,0x96,0x7b,0xbd,0x90,0x18,0x90,0x0b,0x6d,0x5d,0xaf,0x48,
+    0x97,0x7c,0x69,0xed,0x5b,0x15,0xa9,0x70,0x5a,0xed,0x6c,0x14,0x3f,0x21,0x20,0xd6,
+    0xe4,0xc4,0xc5,0x94,0x53,0xbe,0xfa,0xd8,0x02,0x07,0xeb,0x92,0xfb,0x6d,0x70,0x87,
+    0x26,0x6b,0x1c,0x6b,0x99,0x36,0xd7,0x66,0xfe,0x86,0x8d,0xa2,0x2b,0xd6,0x7c,0xd6,
+    0xb0,0x81,0xb3,0x9a,0xe5,0x31,0x35,0x5a,0x50,0xa3,0xe9,0x26,0x36,0xef,0x74,0x83,
+    0x58,0x82,0xe2,0x8a,0xe9,0xb3,0x5e,0x0a,0xdb,0x99,0xf9,0x73,0x3f,0xf3,0x63,0x9f,
+    0x53,0x55,0x8b,0x69,0xa7,0x91,0xb4,0x79,0xcf,0x8d,0xa1,0x6e,0x1d,0xd2,0x2f,0x2e,
+    0x65,0xe5,0x9e,0x12,0xf0,0x0a,0x0d,0x4a,0xb3,0x48,0xb5,0x7d,0x6d,0xee,0x1b,0x63,
+    0xfd,0x60,0x60,0x58,0xcf,0x0b,0xd1,0x7c,0x7e,0x60,0xe8,0xcf,0xb3,0xe7,0x3d,0x63,
+    0x30,0x74,0xe9,0x6f,0x6f,0x3e,0x90,0xfb,0x24,0x7a,0x68,0xab,0x19,0xc8,0x1f,0xaa,
+    0x24,0xdd,0x18,0xe1,0x91,0x6c,0x55,0x56,0xe5,0x47,0x71,0xff,0x79,0x9b,0x64,0x36,
+    0x40,0x27,0xb2,0x0d,0xe5,0x45,0x8d,0x36,0x82,0x84,0xd4,0xa8,0x38,0x80,0xbd,0x4d,
+    0xfd,0xf9,0xb1,0xdc,0xaa,0x21,0xfb,0xfc,0xfd,0xf7,0xf9,0x51,0x1b,0x0f,0x8d,0x64,
+    0xef,0xe6,0x64,0x26,0x0d,0x5a,0x74,0x10,0x68,0xf9,0x41,0xd2,0x9f,0xcc,0xa4,0x09,
+    0x94,0x25,0x9a,0x11,0xda,0x47,0x37,0xfd,0xfe,0xb4,0x7f,0x73,0x70,0x00,0x8a,0xb7,
+    0xac,0xbe,0x4e,0xff,0xa9,0xda,0xac,0xb4,0x92,0x8d,0xb3,0x8b,0xd5,0x09,0xad,0x0d,
+    0x7b,0x97,0x9a,0xdb,0xf4,0xeb,0xd7,0x78,0xa9,0xfd,0x56,0x34,0x18,0xd4,0xe7,0x09,
+    0xe5,0x6f,0x2d,0xe0,0x8d,0x57,0xb1,0x1f,0xd0,0xa4,0x5c,0x03,0xe8,0xa7,0xe0,0xaa,
+    0x0e,0x52,0xed,0x53,0xa6,0x33,0xe4,0x37,0x98,0xe5,0x65,0x90,0xd7,0xfa,0xbd,0x87,
+    0x19,0x74,0xb4,0x08,0x05,0x90,0x9e,0x3a,0x8f,0x6e,0x29,0xa2,0xf1,0x7b,0x4c,0xb9,
+    0x5e,0x14,0x45,0x16,0x5d,0xdc,0x20,0x9d,0x51,0xd9,0x66,0x29,0xba,0xe8,0x49,0xa0,
+    0x2b,0xef,0x4b,0x23,0x85,0xaa,0xf6,0x5c,0x31,0xd4,0x64,0x97,0x67,0xfc,0x49,0x36,
+    0x65,0xbb,0xc5,0xcf,0xab,0xc6,0x1a,0x1b,0x01,0xdf,0x8b,0xf9,0x72,0x11,0xc5,0x74,
+    0xfd,0xbd,0xb6,0x11,0xaf,0xfe,0x34,0xdf,0x8c,0x15,0x1d,0xa4,0xc8,0xe5,0xc5,0x68,
+    0x8b,0x68,0xbe,0x4a,0x50,0x8e,0x52,0x7b,0xd7,0x46,0xbc,0x99,0x1e,0xd3,0x78,0xed,
+    0x10,0xc3,0xfa,0x80,0xe2,0x8e,0xad,0xaf,0xec,0x20,0x7a,0x73,0xbf,0x2b,0x0f,0xeb,
+    0xd8,0x19,0x3e,0x24,0xa1,0x68,0xfd,0x0e,0x31,0x7a,0xfd,0xeb,0x56,0xae,0x52,0xac,
+    0xd7,0x7e,0x3d,0x0b,0x6f,0xa3,0xf4,0x06,0x0e,0xed,0x02,0x02,0x7d,0xb5,0xe9,0x47,
+    0xcc,0x58,0xcc,0xdb,0x35,0x00,0x9f,0x43,0xad,0xce,0x1a,0x3c,0x16,0x4d,0xee,0xf9,
+    0xa1,0x56,0xdf,0x61,0xd7,0x6c,0x2d,0x6e,0x98,0x6b,0x23,0xb6,0x56,0xee,0xf1,0x77,
+    0x10,0xe4,0x35,0x49,0x62,0x38,0x23,0xbd,0x9a,0x26,0xd5,0xce,0x0e,0xe4,0x02,0xfd,
+    0xf4,0x2c,0x39,0x17,0x5b,0xf4,0x56,0x58,0xdf,0x9f,0xca,0xb3,0x90,0x5d,0x52,0xb1,
+    0xda,0xc5,0x05,0xd8,0xfb,0xf9,0x89,0x42,0xbb,0x88,0xdc,0xdf,0x13,0x64,0xbd,0x21,
+    0x82,0x31,0x5d,0x5a,0xe8,0xd7,0xa5,0x64,0x60,0xec,0xed,0xc5,0x9b,0xc5,0x8e,0xce,
+    0x42,0x0c,0x38,0x41,0x91,0x24,0xac,0x88,0x75,0xde,0xbd,0x29,0xba,0x43,0x32,0x3a,
+    0x8e,0x35,0x68,0x19,0xdf,0x47,0xcc,0x0f,0x81,0xd2,0xf4,0xa2,0xe0,0x70,0x6d,0xfb,
+    0x62,0xc1,0x6e,0x8b,0x2d,0x4d,0x09,0x17,0x7c,0xfe,0xc2,0xda,0x46,0x41,0x96,0xa5,
+    0x77,0xec,0xd8,0xdd,0x2d,0x6b,0x4c,0xb4,0xa8,0xed,0x63,0xab,0x0c,0xd8,0xd9,0xb9,
+    0x16,0xee,0x6c,0xc5,0x98,0x02,0xaa,0x6b,0x76,0x76,0x75,0xdb,0xbd,0x26,0xfb,0x2b,
+    0x91,0x6d,0x2c,0x91,0x14,0x08,0x04,0x40,0xd6,0x93,0x60,0xb8,0xbc,0xc9,0x69,0xc2,
+    0x63,0xc2,0xd6,0x24,0x56,0x77,0x70,0x76,0x8e,0x6e,0x5a,0xdb,0xe6,0x55,0xdf,0xdf,
+    0x45,0xb2,0xcc,0x4f,0xb0,0xd0,0x0e,0xac,0xf0,0x2c,0x3a,0x6f,0x6f,0x17,0x6d,0x50,
+    0xf4,0xa9,0x7e,0x03,0x76,0x39,0xbe,0xb5,0x8c,0xcd,0xfa,0x4f,0x47,0x87,0xfc,0x57,
+    0x38,0xd9,0xaf,0x74,0x92,0x81,0x3f,0xa6,0xc3,0x4f,0x8f,0x97,0x70,0xea,0x83,0xcb,
+    0xe0,0x3a,0x8a,0x1f,0x26,0x2f,0xf1,0xea,0x4d,0xf6,0xa0,0xfc,0x90,0x82,0x5f,0x33,
+    0xfa,0xf9,0x26,0x92,0xd7,0x2c,0xba,0x9c,0x92,0x5f,0x1a,0xf0,0xa0,0x76,0x62,0x0c,
+    0xed,0xf0,0x7a,0xca,0xde,0xa3,0x60,0x76,0x62,0xd8,0xcb,0x62,0x4a,0x11,0xdc,0x15,
+    0x9b,0xb6,0xa3,0x1b,0x6a,0xd2,0x6c,0x22,0x72,0x92,0x29,0x7f,0xca,0xa3,0xf8,0x36,
+    0xcc,0xa6,0xfc,0xf0,0xf8,0x44,0x7f,0x1a,0x26,0x29,0x1f,0xce,0xe3,0xe0,0x2e,0xbc,
+    0xf8,0x1c,0x15,0x83,0x22,0xbd,0x99,0x2d,0x06,0x14,0xd6,0x22,0x77,0x9d,0x24,0x69,
+    0x12,0x4e,0x65,0x15,0x1d,0x33,0x14,0xbc,0x11,0x15,0x9f,0xe9,0xe7,0x4e,0x3b,0xca,
+    0xaf,0xd3,0xdf,0xba,0x4a,0xf3,0xd5,0xc2,0x76,0xc1,0xd3,0xb0,0x76,0x09,0xf5,0xe3,
+    0x12,0x84,0x84,0x58,0x0f,0x68,0xb2,0xc7,0xd4,0x97,0xf7,0x53,0x59,0x70,0xc1,0xce,
+    0xbd,0xf3,0xb2,0xb5,0x43,0x66,0x79,0x2c,0xfd,0xbc,0xe6,0x7f,0xd5,0xa9,0x34,0x74,
+    0x40,0x35,0xd1,0xf0,0x52,0xa7,0xff,0xa6,0x14,0x4d,0x0d,0x90,0xa4,0x5c,0x25,0x93,
+    0x19,0x3b,0x55,0xd6,0xc0,0x82,0x5d,0x40,0xf4,0xc8,0x49,0xc6,0x30,0x31,0xa8,0xd7,
+    0x06,0xbf,0x52,0x3a,0x1e,0xb8,0xa4,0x59,0x2a,0xad,0xf6,0x5d,0xf0,0x4f,0x79,0xc3,
+    0x0e,0x8a,0x55,0x5c,0x14,0xd0,0x29,0x80,0x79,0xbc,0xe0,0x3f,0x75,0xc9,0x87,0xde,
+    0xb8,0xbe,0xf8,0x91,0xa3,0x3f,0x06,0xf6,0xa2,0xef,0x8c,0xb1,0x9d,0xf6,0x2c,0x4c,
+    0x77,0x22,0x8c,0xb8,0x17,0x78,0x72,0x19,0x87,0xf7,0xd3,0x7f,0xde,0xe4,0x45,0x74,
+    0xc9,0x6f,0xdb,0xa6,0xdf,0xdd,0xcc,0x97,0xc1,0x2c,0x1c,0xd0,0x11,0xaa,0xf8,0x61,
+    0xca,0x8f,0x6b,0x93,0x30,0x0e,0xd8,0x6f,0x04,0x75,0xa0,0x23,0x8e,0x86,0x3e,0xd6,
+    0x29,0x69,0xd6,0x28,0xc9,0x2e,0xf7,0x9f,0xce,0x6e,0xb2,0x1c,0x8f,0xcb,0x34,0xe2,
+    0x64,0x5c,0xb9,0xb9,0xfb,0x91,0x90,0xa1,0xc3,0xa6,0x77,0x13,0xa3,0x5e,0xcd,0x13,
+    0x80,0x5a,0xed,0xd0,0x14,0xd5,0x79,0xb8,0xac,0x17,0xeb,0x46,0x07,0xc3,0xf9,0x54,
+    0x43,0x89,0x31,0xbf,0x4f,0xfc,0xb1,0x3e,0x7e,0x51,0xc7,0x4e,0xb9,0x3e,0x56,0x00,
+    0x26,0x52,0xb6,0x49,0xb1,0x82,0x0c,0xf5,0xc1,0x9c,0x2e,0x70,0xe8,0x81,0xb0,0xda,
+    0x37,0x17,0x5e,0x30,0x1e,0x8f,0x11,0x1c,0x7f,0x33,0xf3,0x2e,0x5c,0xcf,0x52,0x88,
+    0xf3,0x9a,0x10,0x2f,0x85,0x04,0xab,0x5f,0x87,0x2b,0xa5,0xf6,0x0f,0x88,0x86,0x64,
+    0x75,0x1c,0x5e,0x16,0x4d,0xc6,0x96,0x9c,0x16,0x43,0x76,0x6d,0xc7,0xb4,0x66,0xd3,
+    0x16,0x3b,0x1a,0xe8,0x08,0x8e,0x35,0x5f,0x60,0xb2,0x3e,0x0f,0x67,0x29,0x9f,0x18,
+    0xe3,0x5a,0xd8,0xc9,0xb6,0x3a,0x90,0x01,0x65,0x38,0x8f,0x1b,0x9a,0x89,0xb3,0xda,
+    0x8f,0x0d,0x51,0x65,0xf8,0x5e,0xd2,0x74,0xfa,0x84,0x15,0x74,0xe1,0x7e,0xc7,0x8d,
+    0xd9,0x48,0xd7,0x1b,0xf0,0x84,0x55,0xe2,0x2f,0x13,0x35,0x1a,0xb5,0x74,0x11,0x6c,
+    0xc9,0x5e,0xfe,0xe3,0x05,0x6b,0x28,0x41,0x47,0x7f,0xa5,0x19,0xe1,0x8a,0xbb,0x2a,
+    0x3d,0x96,0x4e,0xff,0xed,0x62,0x2e,0x2e,0x2f,0x05,0x58,0x5a,0x26,0x29,0x11,0xb8,
+    0x88,0xd3,0xd9,0xe7,0x29,0x9b,0x45,0x9b,0x40,0xff,0x16,0xb5,0x36,0xfc,0x12,0xb6,
+    0x2e,0x49,0x94,0x97,0x88,0x31,0xd9,0x9e,0x38,0xfa,0x7f,0xb5,0xca,0x49,0xec,0x05,
+    0x46,0xce,0xb2,0xf1,0x12,0x8d,0xb6,0x1c,0x52,0xbb,0x8e,0x2e,0xf8,0x79,0xdc,0x48,
+    0xe6,0x5d,0xcc,0xc2,0x45,0x58,0xdc,0x85,0x61,0x52,0x87,0xcc,0xee,0xeb,0x79,0xac,
+    0xd1,0xa8,0xa6,0x44,0xdf,0x04,0x63,0x4f,0x77,0xcd,0x1a,0x99,0xa6,0x35,0xbb,0xd6,
+    0x72,0x51,0x4f,0xf2,0x26,0xa3,0x15,0xe0,0x17,0xe9,0x3d,0x35,0xa3,0x61,0xf1,0xd7,
+    0xe9,0x0a,0xf4,0xa9,0xf4,0x76,0x7a,0x93,0x44,0xad,0x8b,0xac,0xa4,0xe0,0x09,0xfb,
+    0x67,0x98,0xe0,0xf4,0x7a,0xbf,0xf5,0x47,0xfc,0xd3,0xba,0x7b,0xab,0x5a,0xe2,0xb0,
+    0x4c,0xf3,0x88,0x29,0x58,0x16,0x42,0xe1,0x11,0x72,0x94,0x9a,0xcc,0x74,0xdb,0x02,
+    0xe3,0xa6,0x1d,0x38,0x37,0x55,0xec,0x4f,0x1e,0x82,0xc2,0x6e,0xbf,0x7a,0x2c,0x51,
+    0x47,0x86,0x9e,0xc6,0x08,0x6e,0xa7,0x88,0x3d,0x67,0x51,0xf1,0x30,0xd1,0xdb,0xf8,
+    0x09,0xe6,0x48,0xe5,0xd1,0x1b,0x42,0x2c,0x6f,0xcb,0xea,0x00,0x48,0xd6,0x4c,0x9f,
+    0x32,0x4a,0xe8,0x12,0x88,0x49,0x24,0xe1,0x70,0xd8,0xd7,0x0e,0xbf,0x1e,0x6e,0x40,
+    0x7e,0xb2,0xa0,0x43,0xe0,0x7c,0x08,0xff,0xea,0x44,0x63,0x15,0xe0,0xc8,0xbe,0x70,
+    0x2e,0x8c,0x6d,0x04,0x99,0x88,0x5d,0x93,0xbb,0x42,0x6d,0x78,0xa3,0x66,0xeb,0x49,
+    0x70,0x09,0xb2,0x3d,0x4a,0x6d,0x53,0xd5,0xe9,0x2a,0x6d,0xa4,0x1c,0xed,0xc2,0xab,
+    0x8d,0xa8,0x89,0xce,0x1a,0x72,0xb9,0x01,0xe0,0x06,0x10,0x8c,0x51,0x1e,0x78,0x42,
+    0x7c,0xab,0xd8,0x44,0xdf,0x4a,0xf5,0x24,0x8e,0x71,0xa5,0xc7,0x38,0xa2,0xb9,0x52,
+    0x33,0x03,0x03,0x21,0x1d,0x8a,0xb5,0xbc,0x67,0xff,0xd7,0x4b,0xc1,0x2e,0xd8,0x41,
+    0x65,0xf4,0x39,0xc9,0x52,0x9a,0x13,0xec,0xd9,0xce,0x3c,0xbc,0xea,0x33,0x49,0x5e,
+    0x57,0xb7,0xa6,0x5c,0x0c,0x8d,0x2e,0x7c,0xea,0xb6,0x53,0x92,0x3f,0xc2,0x5a,0x75,
+    0x18,0x65,0x3e,0xcb,0x2b,0x6c,0x09,0x73,0x5f,0x6c,0x8b,0xa8,0x24,0x9a,0xb8,0xb2,
+    0xac,0x23,0x68,0xa3,0x00,0xaa,0x6e,0x93,0x1b,0x7e,0x9c,0x45,0x6c,0xab,0x31,0x5c,
+    0x0d,0xc7,0x6b,0xd4,0x08,0x42,0xda,0x7a,0x69,0xd1,0xcb,0xdb,0x5f,0xda,0xa6,0xa5,
+    0xee,0xce,0x56,0xdc,0x4e,0xf3,0x66,0x9d,0x7a,0xac,0x23,0x04,0x73,0xda,0x74,0x9c,
+    0x83,0x26,0x50,0x1b,0x63,0x1e,0xcb,0xf8,0x96,0x1b,0xed,0x95,0x28,0x4f,0x70,0x95,
+    0x62,0xa5,0x9b,0x7c,0xe2,0x36,0x11,0xa6,0x74,0xef,0x71,0x63,0x17,0x46,0x3d,0xae,
+    0xa9,0x22,0x9d,0x8d,0x91,0x65,0xbd,0x07,0x76,0xaf,0x50,0x87,0x07,0xac,0x5f,0x1a,
+    0xb3,0x25,0x10,0xa9,0x47,0x55,0x46,0x8b,0xe2,0xf2,0xaa,0x9c,0x06,0xe9,0xb8,0xa5,
+    0xd8,0x4c,0x3a,0x92,0x6c,0xb7,0x31,0x90,0xe1,0x78,0x3b,0xed,0x5a,0x39,0x1d,0x8d,
+    0x9c,0xc4,0x41,0x68,0x18,0x9e,0x3a,0xb2,0x93,0x26,0xb5,0x15,0xba,0x97,0xe7,0x71,
+    0x2d,0xb9,0xd8,0x5a,0xfd,0xe6,0x26,0xcd,0x48,0xd1,0xb3,0x2f,0x2d,0xe8,0x6e,0x67,
+    0xb4,0x57,0xfd,0x36,0x89,0x6c,0x3d,0x77,0x2c,0xc7,0xae,0xb2,0x85,0xe4,0x32,0xba,
+    0x2a,0x79,0xc3,0xe8,0x5e,0xcb,0x9c,0x2c,0xbd,0xb4,0x1d,0xdb,0xd3,0x32,0x01,0x32,
+    0x98,0xdf,0xd2,0x4d,0xec,0xf3,0xc7,0x36,0xcf,0xda,0x39,0x8f,0xd1,0xd5,0xd9,0xaa,
+    0xf6,0x9b,0x3a,0xfd,0xb7,0x0e,0x8b,0x9a,0xe0,0xe9,0xba,0xbe,0x96,0xf6,0x12,0x29,
+    0x25,0x78,0xec,0x0e,0xa8,0x19,0x88,0xab,0x2c,0x7c,0xa8,0xc5,0xa1,0x8c,0x13,0x8f,
+    0x0d,0xc5,0x92,0xb5,0x37,0xd7,0x1b,0x2a,0xd7,0xbe,0xca,0x43,0x73,0x0a,0xd9,0x40,
+    0x86,0x92,0x3e,0x5c,0xe4,0x45,0xd4,0x28,0x7e,0x3c,0xaa,0xc3,0x0c,0xf0,0x4a,0xf6,
+    0x3b,0x3a,0x3b,0x27,0x44,0x76,0x88,0x8c,0x68,0x46,0x09,0xd1,0x48,0x0f,0x2e,0xbc,
+    0x4b,0x91,0x10,0x8d,0xc6,0x17,0x97,0x33,0xa3,0x4c,0x88,0xe4,0x8f,0xba,0xec,0x9e,
+    0x67,0xd9,0x5e,0x38,0xb2,0x58,0x9e,0xa5,0x07,0xe3,0x51,0x20,0xc0,0x96,0x0f,0x0d,
+    0xb0,0xd6,0xbf,0x37,0x7d,0x2b,0x6f,0xc4,0x19,0x96,0x17,0x6e,0x34,0x88,0xe5,0xd9,
+    0xa3,0xd0,0xb1,0x9e,0x86,0xfc,0xce,0x89,0xc7,0xdb,0x28,0x8f,0x2e,0xa2,0x98,0x82,
+    0x21,0x5e,0x42,0x53,0x28,0xc2,0x2a,0x74,0x54,0xca,0xeb,0x13,0x3a,0xa2,0x84,0xa6,
+    0x3d,0xd8,0x64,0x24,0x9c,0x2a,0xeb,0x13,0xac,0x93,0x60,0x27,0x25,0x01,0xea,0x57,
+    0x4f,0xac,0x0d,0x49,0x76,0xec,0xac,0x0e,0x9e,0xc2,0xcc,0x2f,0x82,0x5d,0xc3,0xb9,
+    0xab,0xb7,0x4d,0xa8,0xb3,0x1d,0x4e,0x7f,0xb8,0x83,0x61,0xfd,0x97,0x8f,0x9a,0x26,
+    0x6f,0xca,0x7e,0x98,0x50,0x3e,0x70,0x0b,0x60,0x8f,0xab,0x20,0x86,0x7d,0x47,0x10,
+    0x59,0x44,0xb3,0x20,0x16,0x6a,0x7f,0x0d,0x46,0xc6,0x12,0x2a,0x77,0x2e,0xdb,0x81,
+    0x5a,0x66,0x05,0x94,0x7d,0xef,0x04,0xda,0xf4,0x81,0x5c,0x61,0x6b,0x3f,0xc7,0xf7,
+    0xef,0xea,0xe6,0x69,0xc8,0x2c,0xc2,0x63,0xcd,0xff,0x89,0x7e,0x32,0x58,0x55,0x0e,
+    0x96,0x1b,0xf1,0x69,0xcb,0xa4,0x8b,0xa3,0xef,0x6d,0x4b,0x5f,0x5f,0x9d,0x7a,0x5c,
+    0xcd,0x73,0x64,0xd6,0x9a,0x91,0x8d,0xaa,0xb7,0x15,0x8b,0x30,0x8f,0xcd,0x00,0xb7,
+    0x35,0xe7,0xfb,0xb8,0x2e,0x5e,0x5b,0x69,0x29,0x62,0xd3,0xd5,0x00,0xba,0x16,0x5d,
+    0x33,0x5f,0x81,0x90,0x66,0x9a,0x55,0x51,0xaa,0x08,0x46,0xab,0xdc,0x45,0x84,0x73,
+    0xf0,0xc5,0x0a,0x0f,0x5d,0x59,0x80,0xc9,0x97,0x2b,0x5a,0x32,0xc6,0x53,0xea,0x7a,
+    0x83,0x75,0xdf,0x57,0xd0,0x1d,0x76,0x4c,0x43,0x8b,0x21,0x34,0xfa,0x58,0x07,0xbb,
+    0xa3,0x6f,0x36,0xbc,0x11,0x89,0x4d,0x63,0xad,0x6b,0x1e,0xdd,0x6a,0x2b,0x64,0x95,
+    0x2e,0x79,0x5c,0xc5,0xe9,0xc6,0xf6,0x01,0xaf,0x43,0x26,0xbb,0xba,0x08,0xd8,0x6e,
+    0x21,0x5d,0x1b,0x1a,0xfd,0xc6,0xfb,0xad,0x0c,0x71,0x35,0xfb,0xdc,0x81,0x2e,0x8f,
+    0x65,0xfe,0x4f,0x9e,0x9d,0xe9,0x87,0xd4,0x7b,0xc9,0x2e,0x59,0xc7,0x18,0x5b,0x56,
+    0x96,0xd0,0x6b,0xcb,0x2f,0x1b,0x80,0xd5,0x8c,0x48,0x17,0x38,0xa7,0x4d,0xda,0x0e,
+    0x61,0xeb,0x10,0xd7,0x60,0xec,0xda,0x1e,0x17,0x3d,0x0a,0x2f,0x44,0x96,0x9b,0x09,
+    0x69,0xfb,0x6d,0xc0,0x16,0x18,0x26,0x9e,0x37,0xfd,0xb7,0x20,0x46,0xeb,0x10,0x6d,
+    0x95,0x6a,0xad,0x71,0x69,0x2b,0xf2,0xc1,0x93,0xe5,0x55,0x5d,0x6b,0xf2,0x95,0xd6,
+    0x2a,0xd8,0x0a,0xc5,0x5f,0x8f,0x0e,0x69,0x6e,0x13,0x9f,0x14,0x91,0x28,0x69,0x42,
+    0x37,0xfd,0xf0,0xdf,0x46,0x7b,0x9d,0xbf,0x61,0xb7,0xfe,0xf4,0xfa,0xe5,0x4f,0xa6,
+    0xc9,0x35,0x05,0xf5,0xf8,0xaf,0x7f,0xfd,0x0b,0x5d,0xed,0x78,0xfc,0xd7,0xbf,0xfc,
+    0x45,0xfe,0x0a,0x4a,0xfd,0x97,0x35,0xc5,0x85,0xcf,0xed,0xda,0xf2,0xfa,0xd7,0x0d,
+    0xf5,0xec,0x47,0x62,0xca,0xfa,0xf2,0x93,0x7e,0x00,0x0f,0x03,0xa3,0x13,0xbd,0xbe,
+    0x6a,0x0c,0x0d,0x55,0xb9,0xbf,0x8e,0x13,0xe0,0xb4,0x28,0x8a,0xe5,0xe4,0xf0,0xf0,
+    0xee,0xee,0x6e,0x78,0x67,0x0d,0xd3,0xec,0x8a,0xb6,0x2b,0xe8,0xf4,0x4b,0x77,0xa2,
+    0xc9,0x84,0xfd,0x28,0x5e,0x57,0x43,0xc3,0xf3,0xbc,0x43,0x56,0xcb,0x9a,0xf2,0x29,
+    0x32,0xfa,0xe9,0xb8,0x10,0xa2,0x7d,0x1b,0xf2,0x51,0xe6,0x0f,0xd7,0x17,0x69,0xcc,
+    0x50,0x2c,0x7f,0xdf,0x55,0xa1,0x54,0xf4,0xdb,0xf4,0xde,0x57,0x75,0x45,0x57,0x0c,
+    0xcf,0xa0,0xff,0xab,0x6c,0x38,0x57,0xf4,0xf7,0x2f,0x47,0xcb,0xa0,0x58,0x28,0x78,
+    0xe5,0xad,0xe1,0x8c,0x87,0x9e,0x61,0x6a,0xfa,0x8f,0x96,0x31,0x1c,0x8d,0xcd,0x97,
+    0x86,0x3d,0x34,0x2d,0x8f,0x31,0xa2,0xfc,0xca,0xab,0x6e,0x0d,0x73,0x34,0x34,0xac,
+    0x19,0x2a,0x46,0x43,0xc7,0xb6,0x65,0x3d,0xaf,0x6d,0x7e,0x50,0x27,0x0b,0xd1,0x5e,
+    0xb4,0x96,0x60,0x06,0x8d,0xd7,0x06,0xfc,0xe3,0x27,0xd9,0xbb,0xa7,0x0f,0x5d,0xcf,
+    0x91,0xa0,0x8d,0x91,0x3b,0xb4,0x1d,0x97,0x70,0x91,0x78,0xfe,0x46,0xc4,0x27,0xf4,
+    0xd9,0x70,0x0e,0xaf,0x18,0x13,0x38,0x11,0x8e,0x57,0xc9,0xc1,0x7f,0xae,0xb2,0x49,
+    0x0f,0xdb,0xc5,0xbf,0x35,0xd4,0xb0,0x86,0xde,0x78,0xa4,0xe9,0xb3,0x81,0x39,0x1c,
+    0xb9,0xe8,0x6d,0xe0,0x68,0x26,0x61,0x82,0x4f,0xe7,0xd6,0x72,0x86,0xde,0xc8,0xc1,
+    0xf8,0xa9,0xd2,0x62,0x15,0x63,0xcd,0xa1,0xff,0x72,0x67,0x20,0x9e,0x06,0xce,0x4f,
+    0xce,0x4b,0x63,0xcc,0xc0,0xf0,0x22,0xc3,0x1d,0x8e,0x1c,0x1a,0x81,0x80,0xfd,0x9b,
+    0x7a,0xd8,0xea,0x15,0x63,0xdf,0xb5,0x57,0x73,0x43,0xaf,0x96,0x5b,0xf6,0x0a,0xea,
+    0xda,0xc3,0x91,0x2d,0x78,0x27,0xba,0x55,0xf8,0x26,0x91,0x81,0xf8,0x35,0x57,0x9d,
+    0xe3,0xb1,0x9d,0x84,0xf4,0x83,0xd0,0x4d,0x0a,0x9a,0x96,0x45,0xff,0xef,0xa6,0xa1,
+    0xa9,0x5b,0xc3,0x91,0x67,0x68,0x9e,0x37,0x74,0xcd,0xf1,0x1b,0xdb,0x1b,0x5a,0x3a,
+    0xc3,0xca,0xb3,0x67,0x03,0x7b,0xe8,0xb8,0x23,0x1a,0xa6,0xe1,0x0d,0x0c,0x9d,0x90,
+    0xa7,0x21,0xb8,0x2e,0x09,0x85,0x63,0x1a,0xfc,0x81,0xe0,0xcd,0x06,0x06,0x09,0x0f,
+    0x11,0x03,0x5f,0x74,0xc8,0x00,0xe8,0x67,0x9a,0xa3,0xf2,0xc9,0x1d,0x3a,0xa3,0xf1,
+    0xad,0xe1,0x81,0xd4,0x36,0x23,0xce,0xd8,0xb2,0x06,0xfa,0x50,0x07,0xad,0x59,0x1d,
+    0x09,0x4f,0xd5,0xd2,0x9b,0x41,0xa0,0xc6,0x16,0xe8,0xe1,0x0d,0x3d,0x07,0xec,0x80,
+    0x58,0x19,0x5a,0xad,0xd3,0x11,0x75,0x1a,0x1b,0x8e,0x3d,0xb4,0xc7,0xd6,0xc0,0x1b,
+    0x0d,0x2d,0x0b,0x92,0x6b,0x0e,0xdd,0xf1,0x80,0xc4,0x17,0x40,0xf1,0xca,0x18,0x48,
+    0x43,0x20,0x41,0xd7,0xc6,0xd3,0xa9,0x49,0x9f,0x23,0xc0,0xd3,0x81,0xf3,0x08,0x3c,
+    0x6a,0x90,0xe0,0x0f,0x51,0xfe,0x0b,0x05,0x98,0x3a,0xf4,0x34,0xdb,0x06,0xde,0xca,
+    0x4c,0x19,0xc0,0x10,0x39,0xd0,0xd3,0xa1,0xe1,0x2a,0x18,0xe5,0x98,0x14,0x6b,0xe8,
+    0x18,0x0a,0xd8,0x80,0xd0,0x16,0x44,0x18,0x8f,0x1d,0x6a,0xe4,0x18,0x96,0x06,0xda,
+    0xb9,0xa6,0x45,0xcd,0x1c,0x0d,0x7f,0x0c,0xf1,0x0d,0x03,0xb1,0x1c,0xe5,0x27,0xc5,
+    0x1e,0xea,0xb6,0xa5,0x30,0xce,0x20,0xaf,0xc1,0x3b,0xae,0x35,0x52,0x74,0x26,0x5a,
+    0x68,0x63,0x18,0xa6,0x52,0x36,0x47,0x86,0x53,0x41,0x74,0x14,0xb0,0xcd,0x61,0x0f,
+    0xe6,0xc8,0x51,0xea,0x1d,0xc7,0x0a,0x38,0x34,0x86,0x48,0xe3,0xc3,0x03,0x56,0x33,
+    0x80,0xd0,0xc7,0x63,0xb0,0x52,0xf7,0xc6,0xe2,0xbb,0x03,0x32,0x53,0x22,0x05,0x1e,
+    0xe0,0x8d,0x0e,0xd5,0x19,0x03,0xba,0xa9,0xd9,0x4c,0x47,0x68,0xc4,0x5c,0x35,0x75,
+    0x65,0xc0,0x46,0x01,0xf9,0x62,0xdf,0x68,0x04,0x54,0xad,0x6b,0x5c,0xc5,0x14,0xaa,
+    0x1a,0x51,0x39,0xab,0x14,0x6a,0xa7,0x70,0xb5,0x1b,0xe3,0xd3,0x51,0x6e,0x15,0xae,
+    0x78,0xe5,0x98,0xa9,0x11,0xa3,0x0a,0xa9,0x97,0x43,0x60,0x4b,0x84,0xb6,0x72,0x52,
+    0xfc,0x88,0x5e,0x4b,0x8b,0x5c,0xfc,0xeb,0x66,0xa3,0x62,0xa0,0x27,0x08,0xb3,0x65,
+    0x80,0x80,0x2f,0x91,0x31,0x82,0x83,0xb6,0xee,0x5a,0x55,0x21,0xb4,0xca,0xb6,0x80,
+    0x9d,0x4e,0x4a,0x32,0x36,0x2c,0x65,0x3c,0x64,0x4f,0x23,0x63,0x3c,0xa2,0x57,0xc6,
+    0xe0,0x3c,0x51,0xdf,0x80,0xf6,0xd9,0x2e,0x68,0x08,0x1a,0xbb,0x54,0x05,0xd6,0x5a,
+    0x2e,0xd4,0xaf,0x2c,0xb0,0x94,0x37,0x8a,0x8d,0xbf,0x2f,0xc1,0x29,0x08,0xb3,0x89,
+    0x2a,0x8b,0xfe,0xab,0x1e,0x6c,0xb4,0x30,0xc5,0x5f,0x97,0xfe,0xda,0xf2,0x83,0x95,
+    0x51,0x83,0x97,0xf4,0x51,0xbe,0x62,0x42,0x16,0x1c,0x7d,0x34,0x36,0xf0,0xb2,0x69,
+    0xb2,0x1e,0x60,0x12,0x39,0xe2,0xd4,0x51,0xf9,0x50,0x22,0x43,0x92,0xc0,0xc6,0x53,
+    0xe2,0x8b,0x12,0xb3,0x3e,0x20,0xa8,0x98,0xcb,0x46,0x54,0x8e,0xd8,0x70,0xa0,0xf3,
+    0x8e,0x47,0x2c,0x96,0x54,0x31,0x9c,0xea,0xfb,0xff,0x28,0x8c,0x8c,0xa6,0x78,0x7c,
+    0x43,0x95,0x66,0x45,0x52,0x07,0x5a,0x2d,0x08,0x22,0xdf,0x15,0x7d,0x01,0x29,0x57,
+    0x07,0xf5,0x58,0xc9,0x98,0xa3,0x69,0x4a,0x2c,0x1c,0x81,0x27,0x8a,0x46,0x23,0xcb,
+    0xb6,0xa9,0x44,0x12,0xd6,0xb6,0x0d,0x30,0xa9,0x2a,0x61,0xe3,0xd6,0xeb,0xe3,0xd6,
+    0xcb,0x71,0xcb,0xb6,0xba,0xe0,0x53,0x05,0x4f,0x17,0x9d,0xd5,0x3a,0x45,0x91,0xc0,
+    0x43,0x62,0x46,0xf6,0x4b,0x40,0x12,0xd8,0x57,0x23,0xa5,0x81,0xdb,0xca,0x88,0xb1,
+    0xd5,0xa4,0x6e,0xf1,0x01,0x83,0x80,0x18,0x1e,0xe0,0x1d,0xc8,0xcd,0x08,0x84,0x24,
+    0xe9,0x1b,0xd1,0x1f,0xa0,0xe8,0xd1,0x27,0x38,0xa8,0xcb,0x46,0x24,0x99,0x66,0xed,
+    0x25,0x7a,0xa0,0xc1,0xe0,0x73,0xc4,0xc0,0x83,0x3d,0x3a,0x1b,0x5c,0xf9,0x89,0xaa,
+    0x37,0x28,0xc6,0x07,0xa3,0xbb,0x29,0x2a,0xec,0xf2,0x93,0x35,0x20,0x33,0x21,0x5a,
+    0xb8,0xa2,0x66,0x5c,0x7e,0xf2,0x16,0x2e,0x6f,0xf1,0xb5,0x36,0x53,0xfc,0x18,0x7d,
+    0x53,0xd3,0x1c,0xfa,0xb7,0x46,0xd3,0x6c,0xb8,0xe7,0x91,0xed,0xd8,0x70,0x51,0xf0,
+    0x06,0xb0,0x5e,0xa0,0xcd,0x0b,0xc5,0x24,0x9b,0x49,0xff,0xd3,0xca,0x6f,0x0a,0x8b,
+    0xa5,0x14,0xd3,0x19,0xba,0x10,0xed,0xb1,0x43,0x46,0x67,0x64,0xeb,0x16,0x11,0x6b,
+    0x6d,0x6b,0x9b,0x18,0x0d,0x95,0x70,0x6b,0xd0,0x77,0x81,0x0d,0x55,0xd2,0x5d,0xcf,
+    0x73,0x46,0x9b,0x60,0x77,0x60,0xfe,0x3f,0x2a,0xdd,0x9c,0x11,0x53,0x28,0x9c,0x84,
+    0x6d,0x1a,0xba,0xb2,0xc0,0x57,0x45,0x3a,0xdf,0xb6,0xa7,0xd7,0xa4,0xba,0xba,0x61,
+    0x41,0xc2,0xe1,0xc4,0xe0,0xab,0x75,0x67,0x04,0x39,0x21,0x99,0xd7,0x3d,0x4f,0x83,
+    0x51,0x81,0x6b,0x73,0x37,0xf5,0x61,0xef,0xd6,0x87,0x01,0xcc,0x3d,0x84,0x50,0xb0,
+    0x5a,0xb6,0xe5,0x8d,0xa9,0x0f,0x17,0x26,0x0e,0x9e,0x79,0x30,0x26,0xd7,0x6b,0x7d,
+    0x45,0x1f,0x8a,0xa2,0x6c,0x15,0x8f,0xec,0x26,0x19,0x04,0x6c,0xd3,0x47,0x56,0xd4,
+    0x84,0x84,0x7e,0x4d,0x19,0x42,0x82,0xd1,0x41,0x7b,0xbb,0x25,0x05,0x68,0xeb,0x70,
+    0x02,0x68,0x38,0x23,0xff,0x69,0x39,0xe3,0xd1,0x98,0xfc,0xa0,0x61,0x8f,0x3c,0x1b,
+    0xde,0x60,0x68,0x7b,0x50,0x4d,0xe6,0x01,0x3d,0x07,0x05,0x70,0x4c,0x36,0x18,0x39,
+    0x30,0x28,0xfe,0x31,0x3c,0x87,0x3c,0x07,0xe4,0x00,0x11,0xf2,0x00,0x61,0x85,0x65,
+    0x7b,0x63,0xe6,0x6c,0x5d,0xd7,0xd0,0xe1,0x1d,0x11,0xdc,0xc0,0xc0,0xeb,0x23,0x65,
+    0xe0,0x91,0xae,0x8f,0x6d,0x38,0x2a,0x88,0x97,0x07,0x13,0x0a,0x88,0x08,0x6d,0x0c,
+    0x57,0x43,0x20,0xa2,0x5b,0x63,0x0f,0xae,0x1c,0x51,0xc6,0x78,0xa4,0x3b,0x0c,0x92,
+    0x33,0xd6,0x6d,0x93,0x8a,0xc8,0x20,0x18,0x1c,0xb8,0x61,0xc3,0x09,0x93,0xc7,0x75,
+    0x5d,0x1d,0xc1,0x33,0xfb,0xe4,0x08,0x38,0x16,0x5e,0xc3,0xeb,0x8e,0x6e,0xd2,0x28,
+    0x0c,0x0f,0xa4,0x46,0x6c,0x8d,0xe0,0x0c,0x3d,0xc5,0xd4,0xd7,0x48,0xf7,0x9c,0x31,
+    0x45,0x46,0x63,0x0e,0xc5,0x24,0x13,0x4c,0x71,0x18,0x0c,0x94,0xbe,0x5a,0x30,0x22,
+    0xb0,0x36,0x98,0x69,0x68,0xf2,0x4b,0x45,0x20,0x94,0x89,0x2f,0xcc,0x31,0x8f,0x75,
+    0x17,0xe3,0xf2,0x20,0xb5,0xc0,0x14,0xde,0x02,0x35,0x10,0xeb,0x81,0x81,0x70,0xc1,
+    0xb4,0xe0,0xdc,0x0c,0x1a,0x28,0xc4,0x19,0x98,0x3b,0x08,0xf5,0xc6,0x70,0x62,0x63,
+    0xdd,0x42,0xd0,0x82,0x82,0xf1,0x08,0x94,0x22,0xd3,0x8a,0xb0,0xcb,0x63,0x4d,0x46,
+    0x08,0x1d,0xe0,0x38,0x30,0x28,0xdd,0x23,0x6c,0x0c,0x17,0xf0,0xd8,0xb3,0xe3,0x99,
+    0x36,0x15,0xc0,0xc0,0x8f,0xa8,0x60,0x0c,0xa7,0x64,0xb1,0x70,0x00,0x43,0xb3,0xe1,
+    0x40,0x6c,0xb8,0x18,0xea,0x18,0x18,0x58,0x3a,0xf5,0x0b,0x1f,0xe4,0x12,0x17,0x58,
+    0x60,0x32,0x26,0x53,0x3a,0xc6,0xdb,0x1e,0xde,0x01,0x83,0xc7,0x16,0x18,0x1c,0x93,
+    0x79,0x1d,0x21,0x1e,0x40,0x2b,0x08,0x2d,0xa2,0x04,0x42,0xcf,0x00,0x8d,0x3c,0xc6,
+    0x3d,0x44,0x40,0x70,0x49,0x33,0xc5,0x85,0x8a,0x98,0x0e,0x1b,0xe6,0xd8,0xb3,0x6c,
+    0xf2,0xbb,0x88,0x04,0x89,0x7b,0x68,0x84,0x61,0x7b,0x68,0x01,0x30,0xae,0xc9,0x0a,
+    0x3c,0xd3,0xf1,0x58,0x04,0xa6,0xbb,0xba,0xc9,0x46,0xe5,0x3a,0x8e,0x09,0x87,0x46,
+    0xde,0xcf,0x05,0x1f,0x89,0x80,0xba,0x61,0x53,0xfc,0x46,0x82,0xe4,0xa2,0xdb,0x5a,
+    0x91,0x4e,0xce,0x92,0x82,0x7b,0x26,0x49,0x36,0x8d,0x92,0x84,0x45,0x37,0x28,0xea,
+    0x21,0xe6,0x42,0xc5,0xc6,0x88,0xc5,0x0c,0xc7,0x64,0xe1,0x9c,0x63,0x8c,0x35,0x0a,
+    0x0d,0xa1,0xe0,0xd4,0xc0,0x31,0x60,0x34,0x34,0xca,0x55,0x0c,0x18,0xb1,0x01,0xe2,
+    0x64,0x88,0xb0,0x8d,0x08,0xd9,0x71,0x48,0x82,0x41,0x04,0xd3,0x30,0x46,0x14,0x32,
+    0x22,0x20,0x63,0x32,0x0e,0x26,0x8c,0x19,0xe7,0x69,0x20,0xf4,0x82,0x6d,0x9b,0x44,
+    0xd8,0x31,0x1c,0xf1,0x88,0xf0,0x71,0x2c,0x0b,0x12,0x47,0x92,0x66,0x9a,0xe0,0x17,
+    0xc6,0xe3,0x8e,0x49,0xbe,0x1d,0x92,0x41,0x98,0x12,0x32,0x99,0x23,0x97,0x14,0xc7,
+    0x41,0x40,0xe9,0x20,0xce,0xb3,0xf0,0x8e,0x41,0x8a,0x42,0x74,0xf1,0xe0,0x6c,0x90,
+    0xc5,0xe0,0x93,0xcb,0xb6,0xa7,0x7b,0x23,0xa2,0x20,0xe2,0x78,0x2e,0xed,0x10,0x7b,
+    0x28,0x09,0x39,0x4b,0x07,0x71,0x2e,0xc9,0x85,0xe7,0xc1,0xaf,0x23,0xc9,0x71,0x60,
+    0xac,0x46,0x18,0xdd,0x58,0x37,0x6d,0x83,0x62,0x37,0x10,0xd2,0x1b,0x6b,0x80,0x66,
+    0x9a,0xe0,0x15,0xc8,0xe1,0x1a,0x36,0x05,0x97,0x23,0x0b,0x9a,0xe7,0x82,0x72,0x8e,
+    0x8b,0x88,0x7d,0x68,0xbb,0x68,0x00,0x3b,0x0d,0x67,0x6b,0x3a,0x44,0x5b,0x77,0x34,
+    0xe6,0xda,0x0a,0xd1,0x43,0x2c,0x0f,0xbc,0xd0,0x25,0x8f,0x93,0x4d,0x8c,0xca,0x60,
+    0x62,0xe2,0x82,0xb7,0x70,0x9b,0x18,0x9e,0x47,0x6f,0x61,0x34,0x10,0x05,0xf8,0x48,
+    0x84,0x07,0xa6,0x47,0x98,0x21,0x5a,0xb1,0x3c,0x93,0x85,0x10,0xae,0x4e,0x24,0x21,
+    0xea,0x3a,0x94,0x37,0x51,0xe8,0x6c,0x53,0x46,0x88,0x30,0xd7,0x21,0xc3,0x67,0x41,
+    0x8f,0x4c,0xb0,0xc1,0xb2,0x49,0x2b,0xa1,0x81,0x06,0x70,0x62,0xe6,0xd7,0x36,0xc6,
+    0x8c,0x2f,0x18,0x23,0x65,0x15,0x16,0x79,0x07,0xb8,0x52,0x28,0xfb,0xd8,0x1a,0xdb,
+    0x2c,0x5a,0x85,0x7b,0x19,0x91,0xb1,0x01,0x11,0xa1,0x39,0x68,0x01,0x11,0x75,0x49,
+    0x8f,0x6d,0xc3,0xc3,0x70,0x29,0x1f,0x61,0xe1,0x01,0x08,0xe5,0xda,0xc4,0x4b,0x10,
+    0xc3,0xa5,0xe0,0x4f,0x77,0x21,0xa7,0x20,0x0f,0x54,0x10,0xf9,0x04,0x74,0x10,0x76,
+    0x8c,0x52,0x22,0x98,0x0f,0xcf,0x41,0x64,0x82,0x10,0x8d,0xe4,0x89,0x85,0x2c,0x1e,
+    0xd4,0x9c,0x42,0x36,0x0f,0x78,0x52,0x81,0x63,0x21,0x84,0x86,0x89,0x30,0x74,0x47,
+    0x87,0xad,0x80,0x1e,0xd9,0xd0,0x41,0xc4,0xa4,0x40,0xd4,0x22,0x1a,0x93,0x9b,0x40,
+    0x0b,0x12,0x70,0x17,0xa9,0x3f,0x7a,0xd3,0x61,0xa6,0x00,0xc3,0xd1,0x21,0xb1,0x04,
+    0x03,0xc4,0x87,0xb6,0x0e,0x18,0x27,0xc7,0x94,0x96,0xc0,0x70,0x98,0x84,0x37,0x38,
+    0xee,0x12,0x9e,0x40,0x87,0x46,0x86,0xa6,0x23,0x66,0x00,0x0c,0x67,0x04,0x75,0x8f,
+    0x99,0x61,0x1d,0xc3,0x2b,0x91,0xfa,0x8e,0x10,0x3a,0x9a,0x64,0x32,0x01,0x9d,0xc2,
+    0x79,0x0f,0x50,0x60,0x93,0x64,0xc9,0x58,0x96,0x98,0x44,0x44,0x28,0x28,0x75,0x64,
+    0x10,0x72,0x23,0x57,0x96,0xd8,0x55,0x09,0x4c,0x28,0x59,0x47,0x52,0x3d,0x98,0x62,
+    0x8f,0x29,0xf3,0xd8,0x85,0x5b,0x25,0x03,0x09,0x93,0xc2,0x82,0x68,0x77,0x44,0x52,
+    0x05,0x13,0x00,0x79,0xa3,0x75,0x1d,0xb0,0x04,0xc2,0x4f,0xe9,0x36,0xfc,0x19,0x2c,
+    0x80,0x89,0x54,0x66,0x64,0x9a,0x94,0x75,0xea,0xd0,0x64,0x4a,0x7f,0x74,0x77,0x44,
+    0x69,0x28,0xc0,0x9b,0xa6,0x3e,0xa6,0xe4,0x68,0xec,0x1a,0x68,0x81,0x5c,0x0d,0xba,
+    0xca,0x04,0xcb,0xb3,0x20,0x47,0x1a,0xbd,0xeb,0x1a,0x06,0x37,0xcc,0xa6,0x65,0x10,
+    0x3b,0x4d,0x93,0xac,0xfb,0x18,0xd6,0x1d,0x3e,0x18,0x2d,0xe0,0x37,0xbc,0x9d,0xd3,
+    0x0e,0xf6,0x5b,0x1c,0xad,0x50,0xc8,0x62,0xff,0xef,0x0e,0x86,0x10,0x57,0x93,0x2a,
+    0x6b,0x63,0x0f,0x24,0x71,0x62,0x4a,0x67,0x1d,0x8f,0x65,0xb5,0xce,0xd8,0x8b,0x07,
+    0xe6,0x88,0x1c,0x97,0xc6,0x3f,0xde,0x38,0x10,0x71,0xf0,0xd2,0x72,0x49,0x87,0x9c,
+    0x37,0xcd,0x77,0x7f,0x53,0xde,0xc2,0xd8,0x40,0x29,0x2c,0xcd,0xb5,0xc8,0xdb,0xc7,
+    0x03,0x7b,0x44,0x86,0x46,0x7c,0xc0,0x57,0xcf,0xc8,0x90,0x3a,0xb6,0x25,0x3f,0xec,
+    0x31,0x8c,0x5f,0xf9,0xe4,0x52,0xf8,0xef,0x69,0x3a,0xde,0xa3,0x70,0xda,0xd0,0xf8,
+    0x47,0x03,0x27,0x2f,0x76,0x40,0x21,0xc3,0x18,0xf0,0x0f,0xc0,0x7c,0xe9,0x58,0x44,
+    0x22,0xca,0xd6,0x49,0x6e,0x2c,0x4d,0x3e,0x8f,0xd0,0x1c,0xaf,0x35,0x71,0x02,0x92,
+    0xb0,0xa0,0x28,0x84,0x1e,0x7b,0x33,0x62,0x03,0x3c,0x1f,0x46,0x01,0xe6,0xa0,0x33,
+    0x8f,0x4f,0xdd,0xe8,0xc2,0x19,0xf2,0xd9,0x02,0x17,0x54,0x31,0xc8,0xb4,0x1b,0x03,
+    0x13,0x42,0x06,0x4d,0x7a,0x63,0x82,0xb1,0x23,0x48,0x80,0x07,0xa1,0xf6,0x46,0x6f,
+    0x2a,0x88,0xbb,0x72,0x29,0x98,0xcf,0xeb,0xa1,0xc8,0x48,0x57,0x5c,0x9d,0x82,0x8d,
+    0x4d,0xa1,0x88,0xa3,0x6b,0x88,0x57,0x68,0x5a,0x4c,0x57,0xae,0x15,0xd2,0x90,0x11,
+    0x09,0x12,0x8a,0x75,0x0a,0x8e,0xd8,0xf1,0x20,0xb6,0xc0,0xc2,0x16,0x85,0x79,0xb4,
+    0x54,0xae,0xe1,0xd4,0xa3,0xa9,0x89,0x69,0xca,0x67,0x5a,0xfa,0x99,0x05,0xcb,0x09,
+    0x9b,0x96,0xdd,0x11,0xf7,0x7c,0x19,0x65,0x41,0x3c,0x48,0x6f,0xda,0x72,0xe6,0xd2,
+    0xbf,0x75,0xc9,0x2d,0x24,0xc7,0xc4,0x7f,0xc8,0x2d,0x21,0x0c,0xe4,0xc2,0x28,0x81,
+    0x34,0xc8,0x0b,0x7a,0x94,0xe6,0x5b,0x94,0xe7,0xc0,0xae,0x8e,0x48,0xbf,0x60,0xde,
+    0x6d,0x9b,0x92,0x02,0x18,0x52,0xcf,0x33,0x47,0x0a,0xd3,0x2c,0xcf,0x42,0xf6,0x49,
+    0x33,0x3b,0x70,0xe4,0xd0,0xa9,0x97,0x54,0x0f,0x79,0xc1,0x57,0x8f,0xfc,0x0a,0xdc,
+    0x91,0x62,0x91,0x31,0x34,0x48,0xe3,0xa0,0x3d,0xd0,0x26,0x78,0x2e,0xc5,0x46,0x1f,
+    0x70,0x98,0x96,0x41,0xd6,0x0b,0x46,0x04,0xa2,0x4c,0xf9,0x11,0x62,0x2e,0x83,0x0c,
+    0x27,0x19,0x67,0x5b,0x87,0x83,0xb0,0xa9,0x0c,0xed,0x6c,0x58,0x31,0x8b,0xac,0x18,
+    0x4c,0x9e,0x62,0x93,0x71,0xb2,0x28,0xbf,0x05,0x18,0xcf,0x26,0xc4,0xbe,0x90,0xd6,
+    0xf6,0x06,0x52,0xd7,0x09,0x84,0xc1,0xc0,0xce,0x20,0x20,0x56,0x60,0x57,0x2c,0x7d,
+    0x44,0xee,0x98,0x0d,0x11,0x3e,0xc5,0xa5,0xa1,0xd1,0x64,0x96,0x4d,0xf9,0x23,0x95,
+    0xe9,0xe4,0xd0,0x59,0x99,0xab,0x53,0x54,0x49,0xd9,0xf7,0xc8,0x26,0x9f,0x4f,0x65,
+    0xd6,0xc8,0x1c,0x8f,0x78,0xce,0x0d,0xab,0x66,0x31,0x5f,0x69,0xea,0x9e,0x3e,0xb2,
+    0x29,0xc5,0xf6,0xe0,0x89,0x28,0xff,0x83,0xff,0x72,0xa0,0xbd,0x36,0x25,0x81,0x1e,
+    0x92,0x8a,0x91,0x48,0x3c,0x1c,0xd3,0xa1,0x0c,0x92,0x52,0x41,0x10,0xc6,0x31,0x88,
+    0xe6,0xd0,0x74,0x8a,0xf2,0x68,0xc6,0xd6,0x35,0x10,0xcb,0xf0,0xa4,0xd8,0x60,0xb4,
+    0x72,0xc9,0x86,0xea,0xf0,0x5a,0x06,0x59,0x5e,0xe0,0x40,0x89,0x25,0x51,0xdd,0x74,
+    0x69,0x3a,0x00,0x2e,0x4c,0x1f,0x3b,0x2e,0x1c,0xb4,0x0d,0x1e,0xc3,0x6c,0xa0,0x08,
+    0x61,0x8d,0x37,0xc6,0x17,0x8b,0xd4,0xca,0x45,0x84,0xac,0x70,0x63,0x8a,0xe0,0xe0,
+    0x3f,0x45,0x5e,0x87,0xcc,0x05,0x5c,0xb7,0x02,0xdd,0xd5,0xe1,0x48,0x5d,0x92,0x02,
+    0x96,0x7c,0xa1,0x7b,0x4a,0x8d,0x49,0x3e,0x61,0x36,0xa8,0x0c,0xb1,0x87,0xe7,0xb1,
+    0x32,0x92,0x20,0xf8,0x2c,0x94,0x8d,0xc7,0xa0,0x33,0x4b,0xd7,0x46,0x70,0xc4,0x1e,
+    0x91,0x17,0xf5,0xa0,0x25,0x06,0x42,0x63,0x74,0x46,0x18,0x39,0x1b,0x1a,0xfc,0x07,
+    0x22,0x15,0x2a,0xa3,0xa8,0x10,0xb0,0x41,0x35,0xd8,0x12,0x78,0x6d,0xa2,0x29,0x38,
+    0x38,0x22,0xe1,0xc5,0x80,0x5d,0x92,0x3f,0x9b,0x75,0x83,0x9c,0x92,0x26,0x0f,0x1c,
+    0x72,0x20,0x48,0xeb,0x14,0x8b,0xcd,0x6a,0xd2,0x9c,0x08,0x44,0x11,0x7a,0x03,0x87,
+    0x4e,0x2a,0x32,0x32,0x10,0x1d,0x90,0x5c,0x58,0xe4,0x62,0xc6,0x34,0xbb,0x86,0x52,
+    0x98,0x2d,0xb0,0x9c,0xbe,0x81,0xce,0xa0,0x34,0x7f,0x07,0x01,0xef,0x98,0xca,0x10,
+    0x31,0x03,0x77,0x2a,0x43,0x48,0x67,0xdb,0xd6,0x7f,0x8a,0xc0,0x2c,0x84,0xd4,0x69,
+    0x32,0x9a,0xd2,0x19,0x17,0xee,0x55,0xf9,0x89,0x18,0x3c,0x82,0xe1,0x72,0xff,0x33,
+    0xbd,0x52,0x7e,0x06,0xda,0x99,0x14,0xb3,0xb1,0x59,0x41,0x24,0xca,0x0e,0x49,0x3d,
+    0xcd,0xaa,0xd0,0xec,0x1e,0x38,0x4d,0xf3,0xd6,0x94,0x60,0x21,0x97,0x85,0x77,0x05,
+    0x3a,0x88,0x88,0x91,0x9b,0xfc,0xd6,0x44,0xa8,0xbe,0xee,0x3d,0x90,0x1b,0x50,0x8d,
+    0xcd,0x46,0x74,0xe8,0xfc,0x11,0x2b,0x7a,0x41,0x6f,0x26,0x35,0x0b,0x3a,0x40,0x10,
+    0x60,0x28,0x8e,0x83,0x7f,0x6b,0x26,0xd9,0x6d,0x0a,0xa9,0x68,0x4e,0xdc,0xd6,0x8d,
+    0x37,0xc4,0x63,0x84,0xbe,0x64,0xeb,0x68,0x9e,0x7b,0x34,0x1e,0xb0,0xbf,0x14,0xda,
+    0xd4,0x1e,0x28,0x24,0x46,0x36,0x18,0xc3,0x47,0xf0,0x56,0x5a,0xfd,0x2f,0x6f,0xcb,
+    0x56,0x5a,0xa8,0xdd,0x1b,0xa8,0xf2,0xc8,0x72,0xf8,0x2a,0x8d,0x3b,0x1b,0xd4,0x9a,
+    0x0e,0x44,0x53,0xf1,0x50,0x03,0xbb,0x81,0xb1,0x62,0x9d,0x7f,0x07,0xc6,0xca,0xc2,
+    0xeb,0xa8,0x08,0xb3,0x38,0xc2,0xc7,0xc4,0xd0,0x57,0x64,0xcc,0xa4,0x59,0x79,0x4b,
+    0xb3,0xc9,0x5c,0x8d,0x63,0x44,0xc4,0xa3,0x11,0x45,0xbb,0xf8,0xab,0xec,0x88,0xac,
+    0x68,0xd6,0xf8,0x2b,0x89,0x20,0x1a,0xc6,0x14,0xda,0x1a,0xf6,0x80,0x7f,0xec,0x46,
+    0xda,0x3f,0x8f,0x06,0xd7,0xcc,0x35,0xb9,0x34,0x11,0xa5,0xdc,0x2a,0xee,0x9f,0xda,
+    0x31,0x28,0x8d,0x20,0xd7,0xb6,0x28,0x71,0x22,0x36,0xd0,0xdf,0x3f,0x15,0x81,0x31,
+    0x1b,0xb9,0xe5,0x29,0x8b,0x3f,0x73,0xe4,0x6f,0xf9,0xe4,0x2e,0xc5,0x97,0xb4,0x26,
+    0xf2,0xa7,0x76,0x8c,0x00,0x07,0x09,0x2e,0x6c,0x3f,0x4d,0xdc,0x3b,0xba,0x8e,0x5c,
+    0x0c,0x5c,0x70,0x46,0x7f,0x2a,0x12,0x3a,0x1f,0xbd,0xab,0xfc,0x08,0xce,0x0b,0x34,
+    0xfe,0xd3,0x08,0xb4,0xcd,0xe7,0x5f,0x8f,0x68,0xf5,0x9c,0xb6,0x06,0xd0,0x36,0x00,
+    0xb6,0x45,0xa0,0xb8,0x46,0xf9,0xff,0x01,0xd2,0xbc,0x67,0xab,0x13,0xad,0x00,0x00
     };
 
 // Web resource descriptions
 static WebServerResource __webAutogenResources[] = {
-    WebServerResource("index.html", "text/html", "", "", __webAutogenResource_index_html, sizeof(__webAutogenResource_index_html)-1),
-    WebServerResource("cnc.html", "text/html", "", "", __webAutogenResource_cnc_html, sizeof(__webAutogenResource_cnc_html)-1),
-    WebServerResource("sand.html", "text/html", "", "", __webAutogenResource_sand_html, sizeof(__webAutogenResource_sand_html)-1)
+    WebServerResource("cnc.html", "text/html", "gzip", "", __webAutogenResource_cnc_html, sizeof(__webAutogenResource_cnc_html), false, NULL, "\"14cff3625cf1ba96\""),
+    WebServerResource("index.html", "text/html", "gzip", "", __webAutogenResource_index_html, sizeof(__webAutogenResource_index_html), false, NULL, "\"a743e027ebb864d4\""),
+    WebServerResource("sand.html", "text/html", "gzip", "", __webAutogenResource_sand_html, sizeof(__webAutogenResource_sand_html), false, NULL, "\"8430f7be237d02aa\"")
     };
 
 static int __webAutogenResourcesCount = sizeof(__webAutogenResources) / sizeof(WebServerResource);
@@ -101,84 +101,24 @@ void EvaluatorFiles::service()
             return;
     }
 
-    // Get next line from file
-    String filename = "";
-    int fileLen = 0;
-    int chunkPos = 0;
-    int chunkLen = 0;
+    // Get next line from file (line endings are already removed)
+    const char* pLine = NULL;
+    int lineLen = 0;
     bool finalChunk = false;
-    uint8_t* pLine = _fileManager.chunkFileNext(filename, fileLen, chunkPos, chunkLen, finalChunk);
+    bool lineValid = _fileManager.chunkFileNextLine(pLine, lineLen, finalChunk);
 
     // Check if valid
-    if (chunkLen > 0)
+    if (lineValid && (lineLen > 0))
     {
-        // Process the line
-        String newLine = (char*)pLine;
-        newLine.replace("\n", "");
-        newLine.replace("\r", "");
-        newLine.trim();
-
-        // Check for flags (can be in comments or not)
-        if (_fileType == FILE_TYPE_THETA_RHO)
-        {
-            if (newLine.indexOf("_NO_INTERPOLATE_") >= 0)
-            {
-                Log.notice("%sservice THR Interpolation Off\n", MODULE_PREFIX);
-                _interpolate = false;
-            }
-            else if (newLine.indexOf("_INTERPOLATE_") >= 0)
-            {
-                Log.notice("%sservice THR Interpolation On\n", MODULE_PREFIX);
-                _interpolate = true;
-            }
-        }
+        // Skip leading whitespace
+        while (isspace(*pLine))
+            pLine++;
 
-        // Check for comments
-        bool isComment = false;
+        // Process the line
         if (_fileType == FILE_TYPE_THETA_RHO)
-            isComment = newLine.startsWith("#");
-        else if (_fileType == FILE_TYPE_GCODE)
-            isComment = newLine.startsWith(";");
-
-        // Handle non-comments
-        if (!isComment)
-        {
-            bool isValid = true;
-            // Format line if Theta-Rho
-            if (_fileType == FILE_TYPE_THETA_RHO)
-            {
-                int spacePos = newLine.indexOf(" ");
-                if (spacePos > 0)
-                {
-                    newLine = (_interpolate ? (!_firstValidLineProcessed ? "_THRLINE0_/" : "_THRLINEN_/") : "_THRLINE_/") +
-                             newLine.substring(0,spacePos) + "/" + newLine.substring(spacePos+1);
-                }
-                else
-                {
-                    isValid = false;
-                }
-            }
-            // Form the work item if valid
-            if (isValid)
-            {
-                Log.verbose("%sservice new line %s\n", MODULE_PREFIX, newLine.c_str());
-                String retStr;
-                WorkItem workItem(newLine.c_str());
-                _workManager.addWorkItem(workItem, retStr);
-                _firstValidLineProcessed = true;
-            }
-        }
+            processThetaRhoLine(pLine);
         else
-        {
-            if (_fileType == FILE_TYPE_THETA_RHO)
-            {
-                if (newLine.indexOf("Sandify") >= 0)
-                {
-                    Log.notice("%sservice THR Interpolation Off\n", MODULE_PREFIX);
-                    _interpolate = false;
-                }
-            }
-        }
+            processGCodeLine(pLine);
     }
 
     // Check for finished
@@ -191,7 +131,65 @@ void EvaluatorFiles::service()
 
 }
 
+// Theta-rho lines are parsed here and queued as pre-parsed work items
+void EvaluatorFiles::processThetaRhoLine(const char* pLine)
+{
+    // Check for flags (can be in comments or not)
+    if (strstr(pLine, "_NO_INTERPOLATE_"))
+    {
+        Log.notice("%sservice THR Interpolation Off\n", MODULE_PREFIX);
+        _interpolate = false;
+    }
+    else if (strstr(pLine, "_INTERPOLATE_"))
+    {
+        Log.notice("%sservice THR Interpolation On\n", MODULE_PREFIX);
+        _interpolate = true;
+    }
+
+    // Check for comments
+    if (*pLine == '#')
+    {
+        if (strstr(pLine, "Sandify"))
+        {
+            Log.notice("%sservice THR Interpolation Off\n", MODULE_PREFIX);
+            _interpolate = false;
+        }
+        return;
+    }
+
+    // Theta and rho are separated by a space
+    const char* pSpace = strchr(pLine, ' ');
+    if ((pSpace == NULL) || (pSpace == pLine))
+        return;
+    double theta = strtod(pLine, NULL);
+    double rho = strtod(pSpace + 1, NULL);
+    WorkItem::ThetaRhoLineType lineType = WorkItem::THETA_RHO_NO_INTERPOLATE;
+    if (_interpolate)
+        lineType = _firstValidLineProcessed ? WorkItem::THETA_RHO_NEXT : WorkItem::THETA_RHO_FIRST;
+    Log.verbose("%sservice new THR line type %d theta %F rho %F\n", MODULE_PREFIX, lineType, theta, rho);
+    _workManager.queueWorkItem(WorkItem(lineType, theta, rho));
+    _firstValidLineProcessed = true;
+}
+
+// GCode lines are queued as text
+void EvaluatorFiles::processGCodeLine(const char* pLine)
+{
+    // Check for comments
+    if (*pLine == ';')
+        return;
+    String newLine = pLine;
+    newLine.trim();
+    Log.verbose("%sservice new line %s\n", MODULE_PREFIX, newLine.c_str());
+    String retStr;
+    WorkItem workItem(newLine);
+    _workManager.addWorkItem(workItem, retStr);
+    _firstValidLineProcessed = true;
+}
+
 void EvaluatorFiles::stop()
 {
+    // Close the file if still playing
+    if (_inProgress)
+        _fileManager.chunkedFileEnd();
     _inProgress = false;
 }
@@ -58,5 +58,7 @@ private:
 
 private:
     int getFileTypeFromExtension(String& fileName);
+    void processThetaRhoLine(const char* pLine);
+    void processGCodeLine(const char* pLine);
 
 };
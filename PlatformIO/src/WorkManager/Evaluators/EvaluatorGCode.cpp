@@ -66,7 +66,22 @@ bool EvaluatorGCode::getGcodeCmdArgs(const char* pArgStr, RobotCommandArgs& cmdA
                 cmdArgs.setFeedrate(strtod(++pStr, &pEndStr));
                 pStr = pEndStr;
                 break;
+            case 'I':
+                cmdArgs.setArcCentreOffset(0, strtod(++pStr, &pEndStr));
+                pStr = pEndStr;
+                break;
+            case 'J':
+                cmdArgs.setArcCentreOffset(1, strtod(++pStr, &pEndStr));
+                pStr = pEndStr;
+                break;
             case 'R':
+                // Radius for arcs - otherwise relative move
+                if (cmdArgs.isArcMove())
+                {
+                    cmdArgs.setArcRadius(strtod(++pStr, &pEndStr));
+                    pStr = pEndStr;
+                    break;
+                }
                 cmdArgs.setMoveType(RobotMoveTypeArg_Relative);
                 pStr++;
                 break;
@@ -111,6 +126,8 @@ bool EvaluatorGCode::interpG(String& cmdStr, RobotController* pRobotController,
     if (pArgsPos != 0)
         pArgsStr = pArgsPos + 1;
     RobotCommandArgs cmdArgs;
+    if ((cmdNum == 2) || (cmdNum == 3))
+        cmdArgs.setArcMove(cmdNum == 2);
     rslt = getGcodeCmdArgs(pArgsStr, cmdArgs);
 
 #ifdef DEBUG_GCODE_EVALUATOR
@@ -137,6 +154,11 @@ bool EvaluatorGCode::interpG(String& cmdStr, RobotController* pRobotController,
                 pRobotController->moveTo(cmdArgs);
             }
             return true;
+        case 2: // Arc clockwise
+        case 3: // Arc anti-clockwise
+            if (takeAction)
+                pRobotController->moveTo(cmdArgs);
+            return true;
         case 6: // Direct stepper move
             if (takeAction)
             {
@@ -0,0 +1,544 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+#include "EvaluatorPattern_Program.h"
+#include "ArduinoLog.h"
+
+// #define DEBUG_EVALUATOR_PROGRAM 1
+
+static const char* MODULE_PREFIX = "EvaluatorPattern_Program: ";
+
+static double fnE() { return 2.71828182845904523536; }
+static double fnPi() { return 3.14159265358979323846; }
+static double fnRandom() { return rand() / ((double)RAND_MAX); }
+static double fnMin(double a, double b) { return a < b ? a : b; }
+static double fnMax(double a, double b) { return a < b ? b : a; }
+
+// Same functions as tinyexpr - random is not pure so it isn't folded into a constant
+const EvaluatorPattern_Program::BuiltinFn EvaluatorPattern_Program::_builtinFns[] = {
+    { "abs", 1, (const void*)(Fn1)fabs, true },
+    { "acos", 1, (const void*)(Fn1)acos, true },
+    { "acosh", 1, (const void*)(Fn1)acosh, true },
+    { "asin", 1, (const void*)(Fn1)asin, true },
+    { "asinh", 1, (const void*)(Fn1)asinh, true },
+    { "atan", 1, (const void*)(Fn1)atan, true },
+    { "atan2", 2, (const void*)(Fn2)atan2, true },
+    { "atanh", 1, (const void*)(Fn1)atanh, true },
+    { "ceil", 1, (const void*)(Fn1)ceil, true },
+    { "cos", 1, (const void*)(Fn1)cos, true },
+    { "cosh", 1, (const void*)(Fn1)cosh, true },
+    { "e", 0, (const void*)(Fn0)fnE, true },
+    { "exp", 1, (const void*)(Fn1)exp, true },
+    { "floor", 1, (const void*)(Fn1)floor, true },
+    { "ln", 1, (const void*)(Fn1)log, true },
+    { "log", 1, (const void*)(Fn1)log10, true },
+    { "log2", 1, (const void*)(Fn1)log2, true },
+    { "log10", 1, (const void*)(Fn1)log10, true },
+    { "max", 2, (const void*)(Fn2)fnMax, true },
+    { "min", 2, (const void*)(Fn2)fnMin, true },
+    { "pi", 0, (const void*)(Fn0)fnPi, true },
+    { "pow", 2, (const void*)(Fn2)pow, true },
+    { "random", 0, (const void*)(Fn0)fnRandom, false },
+    { "round", 1, (const void*)(Fn1)round, true },
+    { "sin", 1, (const void*)(Fn1)sin, true },
+    { "sinh", 1, (const void*)(Fn1)sinh, true },
+    { "sqrt", 1, (const void*)(Fn1)sqrt, true },
+    { "tan", 1, (const void*)(Fn1)tan, true },
+    { "tanh", 1, (const void*)(Fn1)tanh, true },
+    { "trunc", 1, (const void*)(Fn1)trunc, true },
+    { NULL, 0, NULL, false }
+};
+
+EvaluatorPattern_Program::EvaluatorPattern_Program()
+{
+    _xSlot = -1;
+    _ySlot = -1;
+    _stopSlot = -1;
+}
+
+void EvaluatorPattern_Program::cleanUp()
+{
+    _varNames.clear();
+    _varInitVals.clear();
+    _regs.clear();
+    _regIsConst.clear();
+    _constNames.clear();
+    _constVals.clear();
+    _setupProg.clear();
+    _loopProg.clear();
+    _subExprs.clear();
+    _xSlot = -1;
+    _ySlot = -1;
+    _stopSlot = -1;
+}
+
+void EvaluatorPattern_Program::addConstant(const char* name, double val)
+{
+    for (unsigned int i = 0; i < _constNames.size(); i++)
+        if (_constNames[i].equals(name))
+            return;
+    _constNames.push_back(name);
+    _constVals.push_back(val);
+}
+
+void EvaluatorPattern_Program::splitStatements(const char* exprs, std::vector<String>& statements)
+{
+    const char* pExpr = exprs;
+
+    // Skip initial space
+    while (isspace(*pExpr))
+        ++pExpr;
+
+    // A line can contain many statements
+    while (*pExpr)
+    {
+        const char* pExprStart = pExpr;
+        while ((*pExpr != '\0') && (*pExpr != ';') && (*pExpr != '\n'))
+        {
+            // Catch a backslash followed by n
+            if (*pExpr == '\\' && (*(pExpr+1) == 'n'))
+                break;
+            ++pExpr;
+        }
+        String statement = pExprStart;
+        statements.push_back(statement.substring(0, pExpr - pExprStart));
+
+        // Next statement - skip separator (in case of escaped chars need to skip two chars)
+        if (*pExpr == '\\')
+            ++pExpr;
+        if (*pExpr)
+            ++pExpr;
+    }
+}
+
+void EvaluatorPattern_Program::splitAssignment(const String& statement, String& varName, String& expr)
+{
+    varName = "";
+    expr = "";
+    int eqPos = statement.indexOf('=');
+    if (eqPos < 0)
+        return;
+    varName = statement.substring(0, eqPos);
+    varName.trim();
+    expr = statement.substring(eqPos + 1);
+}
+
+bool EvaluatorPattern_Program::compile(const char* setupExprs, const char* loopExprs)
+{
+    // Clear previous program (constants are retained)
+    _varNames.clear();
+    _varInitVals.clear();
+    _regs.clear();
+    _regIsConst.clear();
+    _setupProg.clear();
+    _loopProg.clear();
+
+    // All assigned variables get slots before compiling so that each name
+    // refers to the same slot in setup and loop
+    std::vector<String> setupStatements, loopStatements;
+    splitStatements(setupExprs, setupStatements);
+    splitStatements(loopExprs, loopStatements);
+    for (int blockIdx = 0; blockIdx < 2; blockIdx++)
+    {
+        for (const String& statement : (blockIdx == 0 ? setupStatements : loopStatements))
+        {
+            String varName, expr;
+            splitAssignment(statement, varName, expr);
+            if ((varName.length() == 0) || (findVar(varName.c_str(), varName.length(), false) >= 0))
+                continue;
+            // A constant which is assigned becomes a variable starting at the constant's value
+            double initVal = 0;
+            for (unsigned int i = 0; i < _constNames.size(); i++)
+                if (_constNames[i].equals(varName))
+                    initVal = _constVals[i];
+            _varNames.push_back(varName);
+            _varInitVals.push_back(initVal);
+        }
+    }
+    for (unsigned int i = 0; i < _varNames.size(); i++)
+        newReg(_varInitVals[i], false);
+
+    // Register 0 must exist for unused operands
+    constSlot(0);
+
+    // Compile
+    compileBlock(setupStatements, _setupProg);
+    int loopCompiled = compileBlock(loopStatements, _loopProg);
+    _subExprs.clear();
+
+    // Point and stop variables
+    _xSlot = findVar("x", 1, true);
+    _ySlot = findVar("y", 1, true);
+    _stopSlot = findVar("stop", 4, true);
+    Log.trace("%scompiled vars %d regs %d setupInstrs %d loopInstrs %d\n", MODULE_PREFIX,
+                _varNames.size(), _regs.size(), _setupProg.size(), _loopProg.size());
+    return loopCompiled > 0;
+}
+
+int EvaluatorPattern_Program::compileBlock(const std::vector<String>& statements, std::vector<Instr>& prog)
+{
+    // Subexpressions are only shared within a block
+    _subExprs.clear();
+    int numCompiled = 0;
+    for (const String& statement : statements)
+    {
+        String varName, expr;
+        splitAssignment(statement, varName, expr);
+        if (varName.length() == 0)
+            continue;
+        int varSlot = findVar(varName.c_str(), varName.length(), false);
+
+        // Parse the expression emitting instructions
+        unsigned int progLen = prog.size();
+        std::vector<SubExpr> prevSubExprs = _subExprs;
+        ParseState s;
+        s._pNext = expr.c_str();
+        nextToken(s);
+        int rsltReg = parseList(s, prog);
+        if ((rsltReg < 0) || (s._type != TOK_END))
+        {
+            Log.notice("%scompile failed %s\n", MODULE_PREFIX, statement.c_str());
+            prog.resize(progLen);
+            _subExprs = prevSubExprs;
+            continue;
+        }
+
+        // Values computed from the variable's previous value are no longer available
+        invalidateSlot(varSlot);
+
+        // Store in the variable - the last instruction writes there directly if it computed the result
+        if ((prog.size() > progLen) && (prog.back()._dst == rsltReg))
+        {
+            prog.back()._dst = varSlot;
+            for (SubExpr& subExpr : _subExprs)
+                if (subExpr._dst == rsltReg)
+                    subExpr._dst = varSlot;
+        }
+        else
+        {
+            Instr instr = { OP_COPY, uint16_t(varSlot), uint16_t(rsltReg), 0, NULL };
+            prog.push_back(instr);
+        }
+        numCompiled++;
+#ifdef DEBUG_EVALUATOR_PROGRAM
+        Log.trace("%scompile %s slot %d instrs %d\n", MODULE_PREFIX, statement.c_str(),
+                    varSlot, prog.size() - progLen);
+#endif
+    }
+    return numCompiled;
+}
+
+void EvaluatorPattern_Program::invalidateSlot(int slot)
+{
+    for (unsigned int i = 0; i < _subExprs.size(); )
+    {
+        if ((_subExprs[i]._a == slot) || (_subExprs[i]._b == slot) || (_subExprs[i]._dst == slot))
+            _subExprs.erase(_subExprs.begin() + i);
+        else
+            i++;
+    }
+}
+
+int EvaluatorPattern_Program::findVar(const char* name, int len, bool caseInsensitive)
+{
+    for (unsigned int i = 0; i < _varNames.size(); i++)
+    {
+        if ((int)_varNames[i].length() != len)
+            continue;
+        if ((caseInsensitive && strncasecmp(name, _varNames[i].c_str(), len) == 0) ||
+            (!caseInsensitive && strncmp(name, _varNames[i].c_str(), len) == 0))
+            return i;
+    }
+    return -1;
+}
+
+const EvaluatorPattern_Program::BuiltinFn* EvaluatorPattern_Program::findBuiltin(const char* name, int len)
+{
+    for (const BuiltinFn* pFn = _builtinFns; pFn->_name; pFn++)
+        if ((strncmp(name, pFn->_name, len) == 0) && (pFn->_name[len] == '\0'))
+            return pFn;
+    return NULL;
+}
+
+int EvaluatorPattern_Program::newReg(double val, bool isConst)
+{
+    if (_regs.size() >= MAX_REGS)
+        return -1;
+    _regs.push_back(val);
+    _regIsConst.push_back(isConst);
+    return _regs.size() - 1;
+}
+
+int EvaluatorPattern_Program::constSlot(double val)
+{
+    // Share registers holding the same value
+    for (unsigned int i = 0; i < _regs.size(); i++)
+        if (_regIsConst[i] && (memcmp(&_regs[i], &val, sizeof(val)) == 0))
+            return i;
+    return newReg(val, true);
+}
+
+int EvaluatorPattern_Program::emit(std::vector<Instr>& prog, uint8_t op, const void* fn, int a, int b, bool isPure)
+{
+    if ((a < 0) || (b < 0))
+        return -1;
+
+    // Fold operations on constants
+    bool usesA = (op != OP_FN0);
+    bool usesB = (op != OP_FN0) && (op != OP_FN1) && (op != OP_NEG) && (op != OP_COPY);
+    if (isPure && (!usesA || _regIsConst[a]) && (!usesB || _regIsConst[b]))
+        return constSlot(execOp(op, fn, _regs[a], _regs[b]));
+
+    // Order operands of commutative operations
+    if (((op == OP_ADD) || (op == OP_MUL) || (op == OP_EQ) || (op == OP_OR) || (op == OP_AND)) && (a > b))
+        std::swap(a, b);
+
+    // Share a subexpression already computed
+    if (isPure)
+    {
+        for (const SubExpr& subExpr : _subExprs)
+            if ((subExpr._op == op) && (subExpr._fn == fn) && (subExpr._a == a) && (subExpr._b == b))
+                return subExpr._dst;
+    }
+
+    // New instruction
+    int dst = newReg(0, false);
+    if (dst < 0)
+        return -1;
+    Instr instr = { op, uint16_t(dst), uint16_t(a), uint16_t(b), fn };
+    prog.push_back(instr);
+    if (isPure)
+    {
+        SubExpr subExpr = { op, fn, uint16_t(a), uint16_t(b), uint16_t(dst) };
+        _subExprs.push_back(subExpr);
+    }
+    return dst;
+}
+
+void EvaluatorPattern_Program::runSetup()
+{
+    for (unsigned int i = 0; i < _varInitVals.size(); i++)
+        _regs[i] = _varInitVals[i];
+    exec(_setupProg, _regs.data());
+}
+
+int EvaluatorPattern_Program::runLoop(PatternPoint* pPoints, int maxPoints, bool& stopReqd)
+{
+    stopReqd = false;
+    if (!hasPointVars())
+        return 0;
+    double* pRegs = _regs.data();
+    int numPoints = 0;
+    while (numPoints < maxPoints)
+    {
+        exec(_loopProg, pRegs);
+        pPoints[numPoints]._x = pRegs[_xSlot];
+        pPoints[numPoints]._y = pRegs[_ySlot];
+        numPoints++;
+        if ((_stopSlot >= 0) && (pRegs[_stopSlot] != 0))
+        {
+            stopReqd = true;
+            break;
+        }
+    }
+    return numPoints;
+}
+
+// Tokenizer - same tokens as tinyexpr
+void EvaluatorPattern_Program::nextToken(ParseState& s)
+{
+    while (true)
+    {
+        char ch = *s._pNext;
+        if (ch == '\0')
+        {
+            s._type = TOK_END;
+            return;
+        }
+
+        // Number
+        if (((ch >= '0') && (ch <= '9')) || (ch == '.'))
+        {
+            s._value = strtod(s._pNext, (char**)&s._pNext);
+            s._type = TOK_NUMBER;
+            return;
+        }
+
+        // Variable, constant or function
+        if (isalpha(ch))
+        {
+            const char* pStart = s._pNext;
+            while (isalnum(*s._pNext) || (*s._pNext == '_'))
+                s._pNext++;
+            int len = s._pNext - pStart;
+            s._slot = findVar(pStart, len, false);
+            if (s._slot >= 0)
+            {
+                s._type = TOK_VAR;
+                return;
+            }
+            for (unsigned int i = 0; i < _constNames.size(); i++)
+            {
+                if (((int)_constNames[i].length() == len) && (strncmp(pStart, _constNames[i].c_str(), len) == 0))
+                {
+                    s._value = _constVals[i];
+                    s._type = TOK_CONST;
+                    return;
+                }
+            }
+            s._pFn = findBuiltin(pStart, len);
+            s._type = s._pFn ? TOK_FN : TOK_ERROR;
+            return;
+        }
+
+        // Operators and separators
+        s._pNext++;
+        s._type = TOK_INFIX;
+        switch (ch)
+        {
+            case '+': s._op = OP_ADD; return;
+            case '-': s._op = OP_SUB; return;
+            case '*': s._op = OP_MUL; return;
+            case '/': s._op = OP_DIV; return;
+            case '^': s._op = OP_POW; return;
+            case '%': s._op = OP_MOD; return;
+            case '=': s._op = OP_EQ; if (*s._pNext == '=') s._pNext++; return;
+            case '>': s._op = OP_GT; if (*s._pNext == '=') { s._op = OP_GE; s._pNext++; } return;
+            case '<': s._op = OP_LT; if (*s._pNext == '=') { s._op = OP_LE; s._pNext++; } return;
+            case '|': s._op = OP_OR; if (*s._pNext == '|') s._pNext++; return;
+            case '&': s._op = OP_AND; if (*s._pNext == '&') s._pNext++; return;
+            case '(': s._type = TOK_OPEN; return;
+            case ')': s._type = TOK_CLOSE; return;
+            case ',': s._type = TOK_SEP; return;
+            case ' ': case '\t': break;
+            case '\n': case '\r': case '\\': case ';': s._type = TOK_END; return;
+            default: s._type = TOK_ERROR; return;
+        }
+    }
+}
+
+// <list> = <expr> {"," <expr>}
+int EvaluatorPattern_Program::parseList(ParseState& s, std::vector<Instr>& prog)
+{
+    int reg = parseExpr(s, prog);
+    while ((reg >= 0) && (s._type == TOK_SEP))
+    {
+        nextToken(s);
+        reg = parseExpr(s, prog);
+    }
+    return reg;
+}
+
+// <expr> = <term> {("+" | "-" | "==" | "=" | ">" | "<" | ">=" | "<=" | "||" | "&&") <term>}
+int EvaluatorPattern_Program::parseExpr(ParseState& s, std::vector<Instr>& prog)
+{
+    int reg = parseTerm(s, prog);
+    while ((reg >= 0) && (s._type == TOK_INFIX) && (s._op != OP_MUL) && (s._op != OP_DIV) &&
+                (s._op != OP_MOD) && (s._op != OP_POW))
+    {
+        uint8_t op = s._op;
+        nextToken(s);
+        reg = emit(prog, op, NULL, reg, parseTerm(s, prog));
+    }
+    return reg;
+}
+
+// <term> = <factor> {("*" | "/" | "%") <factor>}
+int EvaluatorPattern_Program::parseTerm(ParseState& s, std::vector<Instr>& prog)
+{
+    int reg = parseFactor(s, prog);
+    while ((reg >= 0) && (s._type == TOK_INFIX) && ((s._op == OP_MUL) || (s._op == OP_DIV) || (s._op == OP_MOD)))
+    {
+        uint8_t op = s._op;
+        nextToken(s);
+        reg = emit(prog, op, NULL, reg, parseFactor(s, prog));
+    }
+    return reg;
+}
+
+// <factor> = <power> {"^" <power>} (left to right)
+int EvaluatorPattern_Program::parseFactor(ParseState& s, std::vector<Instr>& prog)
+{
+    int reg = parsePower(s, prog);
+    while ((reg >= 0) && (s._type == TOK_INFIX) && (s._op == OP_POW))
+    {
+        nextToken(s);
+        reg = emit(prog, OP_POW, NULL, reg, parsePower(s, prog));
+    }
+    return reg;
+}
+
+// <power> = {("-" | "+")} <base>
+int EvaluatorPattern_Program::parsePower(ParseState& s, std::vector<Instr>& prog)
+{
+    bool negate = false;
+    while ((s._type == TOK_INFIX) && ((s._op == OP_ADD) || (s._op == OP_SUB)))
+    {
+        if (s._op == OP_SUB)
+            negate = !negate;
+        nextToken(s);
+    }
+    int reg = parseBase(s, prog);
+    if (negate)
+        reg = emit(prog, OP_NEG, NULL, reg, 0);
+    return reg;
+}
+
+// <base> = <constant> | <variable> | <function-0> {"(" ")"} | <function-1> <power> |
+//          <function-2> "(" <expr> "," <expr> ")" | "(" <list> ")"
+int EvaluatorPattern_Program::parseBase(ParseState& s, std::vector<Instr>& prog)
+{
+    int reg = -1;
+    switch (s._type)
+    {
+        case TOK_NUMBER:
+        case TOK_CONST:
+            reg = constSlot(s._value);
+            nextToken(s);
+            return reg;
+        case TOK_VAR:
+            reg = s._slot;
+            nextToken(s);
+            return reg;
+        case TOK_OPEN:
+            nextToken(s);
+            reg = parseList(s, prog);
+            if (s._type != TOK_CLOSE)
+                return -1;
+            nextToken(s);
+            return reg;
+        case TOK_FN:
+            break;
+        default:
+            return -1;
+    }
+
+    // Function
+    const BuiltinFn* pFn = s._pFn;
+    nextToken(s);
+    if (pFn->_arity == 0)
+    {
+        if (s._type == TOK_OPEN)
+        {
+            nextToken(s);
+            if (s._type != TOK_CLOSE)
+                return -1;
+            nextToken(s);
+        }
+        return emit(prog, OP_FN0, pFn->_fn, 0, 0, pFn->_isPure);
+    }
+    if (pFn->_arity == 1)
+        return emit(prog, OP_FN1, pFn->_fn, parsePower(s, prog), 0, pFn->_isPure);
+    if (s._type != TOK_OPEN)
+        return -1;
+    nextToken(s);
+    int regA = parseExpr(s, prog);
+    if ((regA < 0) || (s._type != TOK_SEP))
+        return -1;
+    nextToken(s);
+    int regB = parseExpr(s, prog);
+    if ((regB < 0) || (s._type != TOK_CLOSE))
+        return -1;
+    nextToken(s);
+    return emit(prog, OP_FN2, pFn->_fn, regA, regB, pFn->_isPure);
+}
@@ -0,0 +1,199 @@
+// RBotFirmware
+// Rob Dobson 2016-19
+
+// Pattern (.param) expressions compiled to a flat register based program - the setup and loop
+// assignments are parsed once (tinyexpr compatible syntax and functions), constant parts are
+// folded, repeated subexpressions are shared and variables are resolved to register slots so
+// that each iteration of the loop is a single pass over an instruction array
+
+#pragma once
+
+#include <Arduino.h>
+#include <vector>
+
+class EvaluatorPattern_Program
+{
+public:
+    EvaluatorPattern_Program();
+    void cleanUp();
+
+    // Constants (e.g. robot size) - must be added before compiling
+    void addConstant(const char* name, double val);
+
+    // Compile the setup and loop assignments (separated by ; or newlines) - assignments
+    // which fail to compile are logged and skipped - returns false if the loop is empty
+    bool compile(const char* setupExprs, const char* loopExprs);
+
+    // Check the point (x and y) and stop variables are assigned
+    bool hasPointVars()
+    {
+        return (_xSlot >= 0) && (_ySlot >= 0);
+    }
+    bool hasStopVar()
+    {
+        return _stopSlot >= 0;
+    }
+
+    // Set variables to initial values and run the setup assignments
+    void runSetup();
+
+    // Point generated by an iteration of the loop
+    struct PatternPoint
+    {
+        double _x;
+        double _y;
+    };
+
+    // Run the loop up to maxPoints times - stops after the point on which the stop
+    // variable becomes non-zero (stopReqd set) - returns the number of points
+    int runLoop(PatternPoint* pPoints, int maxPoints, bool& stopReqd);
+
+    // Info
+    int getNumVars()
+    {
+        return _varNames.size();
+    }
+    int getNumInstrs(bool loop)
+    {
+        return loop ? _loopProg.size() : _setupProg.size();
+    }
+
+    // Split expressions into statements in the same way as the pattern file
+    static void splitStatements(const char* exprs, std::vector<String>& statements);
+
+private:
+    // Operations
+    enum OpCode : uint8_t
+    {
+        OP_COPY, OP_NEG, OP_ADD, OP_SUB, OP_MUL, OP_DIV, OP_MOD, OP_POW,
+        OP_EQ, OP_LT, OP_GT, OP_LE, OP_GE, OP_OR, OP_AND,
+        OP_FN0, OP_FN1, OP_FN2
+    };
+    typedef double (*Fn0)();
+    typedef double (*Fn1)(double);
+    typedef double (*Fn2)(double, double);
+
+    // Instruction - registers are indices into _regs
+    struct Instr
+    {
+        uint8_t _op;
+        uint16_t _dst;
+        uint16_t _a;
+        uint16_t _b;
+        const void* _fn;
+    };
+
+    // Single operation (used when running and when folding constants)
+    static inline double execOp(uint8_t op, const void* fn, double a, double b)
+    {
+        switch (op)
+        {
+            case OP_COPY: return a;
+            case OP_NEG: return -a;
+            case OP_ADD: return a + b;
+            case OP_SUB: return a - b;
+            case OP_MUL: return a * b;
+            case OP_DIV: return a / b;
+            case OP_MOD: return fmod(a, b);
+            case OP_POW: return pow(a, b);
+            case OP_EQ: return a == b;
+            case OP_LT: return a < b;
+            case OP_GT: return a > b;
+            case OP_LE: return a <= b;
+            case OP_GE: return a >= b;
+            case OP_OR: return a || b;
+            case OP_AND: return a && b;
+            case OP_FN0: return ((Fn0)fn)();
+            case OP_FN1: return ((Fn1)fn)(a);
+            case OP_FN2: return ((Fn2)fn)(a, b);
+        }
+        return NAN;
+    }
+
+    static inline void exec(const std::vector<Instr>& prog, double* pRegs)
+    {
+        for (const Instr& instr : prog)
+            pRegs[instr._dst] = execOp(instr._op, instr._fn, pRegs[instr._a], pRegs[instr._b]);
+    }
+
+    // Built-in functions
+    struct BuiltinFn
+    {
+        const char* _name;
+        int _arity;
+        const void* _fn;
+        bool _isPure;
+    };
+    static const BuiltinFn _builtinFns[];
+    static const BuiltinFn* findBuiltin(const char* name, int len);
+
+    // Tokens
+    enum TokType
+    {
+        TOK_END, TOK_ERROR, TOK_NUMBER, TOK_VAR, TOK_CONST, TOK_FN,
+        TOK_INFIX, TOK_OPEN, TOK_CLOSE, TOK_SEP
+    };
+
+    // Compile state for one expression
+    struct ParseState
+    {
+        const char* _pNext;
+        TokType _type;
+        double _value;
+        int _slot;
+        const BuiltinFn* _pFn;
+        uint8_t _op;
+    };
+
+    // Common subexpression (result of op on registers)
+    struct SubExpr
+    {
+        uint8_t _op;
+        const void* _fn;
+        uint16_t _a;
+        uint16_t _b;
+        uint16_t _dst;
+    };
+
+    // Variables occupy the first slots of the register file, constants and
+    // temporaries follow
+    std::vector<String> _varNames;
+    std::vector<double> _varInitVals;
+    std::vector<double> _regs;
+    std::vector<bool> _regIsConst;
+
+    // Named constants
+    std::vector<String> _constNames;
+    std::vector<double> _constVals;
+
+    // Programs
+    std::vector<Instr> _setupProg;
+    std::vector<Instr> _loopProg;
+
+    // Subexpressions available in the program being compiled
+    std::vector<SubExpr> _subExprs;
+
+    // Slots of point and stop variables
+    int _xSlot;
+    int _ySlot;
+    int _stopSlot;
+
+    // Compile helpers
+    static void splitAssignment(const String& statement, String& varName, String& expr);
+    int findVar(const char* name, int len, bool caseInsensitive);
+    int constSlot(double val);
+    int newReg(double val, bool isConst);
+    int emit(std::vector<Instr>& prog, uint8_t op, const void* fn, int a, int b, bool isPure = true);
+    int compileBlock(const std::vector<String>& statements, std::vector<Instr>& prog);
+    void invalidateSlot(int slot);
+    void nextToken(ParseState& s);
+    int parseList(ParseState& s, std::vector<Instr>& prog);
+    int parseExpr(ParseState& s, std::vector<Instr>& prog);
+    int parseTerm(ParseState& s, std::vector<Instr>& prog);
+    int parseFactor(ParseState& s, std::vector<Instr>& prog);
+    int parsePower(ParseState& s, std::vector<Instr>& prog);
+    int parseBase(ParseState& s, std::vector<Instr>& prog);
+
+    // Register indices are 16 bit
+    static constexpr int MAX_REGS = 65535;
+};
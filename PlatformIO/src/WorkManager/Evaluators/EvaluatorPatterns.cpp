@@ -1,17 +1,22 @@
 // RBotFirmware
 // Rob Dobson 2017
 
-// #define DEBUG_EVALUATOR_PATTERN 1
-
 #include "EvaluatorPatterns.h"
 #include "../WorkManager.h"
+#include "RobotMotion/RobotController.h"
 
 static const char* MODULE_PREFIX = "EvaluatorPatterns: ";
 
-EvaluatorPatterns::EvaluatorPatterns(FileManager& fileManager, WorkManager& WorkManager) :
-    _fileManager(fileManager), _workManager(WorkManager)
+EvaluatorPatterns::EvaluatorPatterns(FileManager& fileManager, WorkManager& WorkManager,
+            RobotController& robotController) :
+    _fileManager(fileManager), _workManager(WorkManager), _robotController(robotController)
 {
     _isRunning = false;
+    _pointBufCount = 0;
+    _pointBufPos = 0;
+    _stopAfterBuf = false;
+    _pointRateCount = 0;
+    _pointRateStartMs = millis();
 }
 
 EvaluatorPatterns::~EvaluatorPatterns()
@@ -47,183 +52,63 @@ bool EvaluatorPatterns::isValid(WorkItem& workItem)
     return fileExt.equalsIgnoreCase("param");
 }
 
-void EvaluatorPatterns::addExpression(const char* exprStr, bool isInitialValue)
-{
-    const char* pExpr = exprStr;
-
-    // Skip initial space
-    while (isspace(*pExpr))
-        ++pExpr;
-
-    // Iterate through the expressions (a single line can contain many)
-    while (*pExpr)
-    {
-        // Extract the variable name and expression
-        String outExpr;
-        const char* pExprStart = pExpr;
-        String inExpr = pExpr;
-        // Find the end of the expression
-        while ((*pExpr != '\0') && (*pExpr != ';') && (*pExpr != '\n'))
-        {
-            // Catch a backslash followed by n
-            if (*pExpr == '\\' && (*(pExpr+1) == 'n'))
-            {
-                break;
-            }
-            ++pExpr;
-        }
-        int exprLen = pExpr - pExprStart;
-        inExpr = inExpr.substring(0, exprLen);
-
-        // Add the assignment
-        int varIdx = _patternVars.addAssignment(inExpr.c_str(), outExpr);
-
-        // Store the compiled expression, variable index and whether an initial value
-        if (varIdx >= 0)
-        {
-            // Compile expression
-            int err = 0;
-            te_variable* vars = _patternVars.getVars();
-            te_expr* compiledExpr = te_compile(outExpr.c_str(), vars, _patternVars.getNumVars(), &err);
-            Log.trace("%scompile %s hex %x %x %x %x %x %x result %s err %d\n", MODULE_PREFIX, outExpr.c_str(),
-                        outExpr.c_str()[0], outExpr.c_str()[1], outExpr.c_str()[2],
-                        outExpr.c_str()[3], outExpr.c_str()[4], outExpr.c_str()[5],
-                        (compiledExpr ? "OK" : "FAIL"), err);
- 
-            // Store the expression and assigned variable index
-            if (compiledExpr)
-            {
-                VarIdxAndCompiledExpr varIdxAndCompExpr;
-                varIdxAndCompExpr._pCompExpr = compiledExpr;
-                varIdxAndCompExpr._varIdx = varIdx;
-                varIdxAndCompExpr._isInitialValue = isInitialValue;
-                _varIdxAndCompiledExprs.push_back(varIdxAndCompExpr);
-                Log.trace("%saddLoop addedCompiledExpr (Count=%d)\n", MODULE_PREFIX, 
-                            _varIdxAndCompiledExprs.size());
-            }
-        }
-
-        // Next expression - skip separator (in case of escaped chars need to skip two chars)
-        if (*pExpr == '\\')
-            ++pExpr;
-        if (*pExpr)
-            ++pExpr;
-    }
-}
-
 void EvaluatorPatterns::cleanUp()
 {
-    _patternVars.cleanUp();
-    for (unsigned int i = 0; i < _varIdxAndCompiledExprs.size(); i++)
-        te_free(_varIdxAndCompiledExprs[i]._pCompExpr);
-    _varIdxAndCompiledExprs.clear();
+    _program.cleanUp();
+    _pointBufCount = 0;
+    _pointBufPos = 0;
+    _stopAfterBuf = false;
     _isRunning = false;
 }
 
-void EvaluatorPatterns::evalExpressions(bool procInitialValues, bool procLoopValues)
-{
-#ifdef DEBUG_EVALUATOR_PATTERN
-    Log.trace("%snumExprs %d\n", MODULE_PREFIX, _varIdxAndCompiledExprs.size());
-#endif
-    // Go through all the expressions and evaluate
-    for (unsigned int i = 0; i < _varIdxAndCompiledExprs.size(); i++)
-    {
-        // Variable index and type
-        int varIdx = _varIdxAndCompiledExprs[i]._varIdx;
-        bool isInitialValue = _varIdxAndCompiledExprs[i]._isInitialValue;
-        // Check if it is an initial value - in which case don't evaluate
-        if (!((isInitialValue && procInitialValues) || (!isInitialValue && procLoopValues)))
-        {
-#ifdef DEBUG_EVALUATOR_PATTERN
-            Log.trace("%sexpr continuing procInit %d procLoop %d isInit %d\n",
-                        MODULE_PREFIX, procInitialValues, procLoopValues, isInitialValue);
-#endif
-            continue;
-        }
-        // Compute value of expression
-        double val = te_eval(_varIdxAndCompiledExprs[i]._pCompExpr);
-        _patternVars.setValByIdx(varIdx, val);
-#ifdef DEBUG_EVALUATOR_PATTERN
-        Log.trace("%sexpr %d: %s varIdx %d exprRslt %F isInitialValue=%d\n", MODULE_PREFIX,
-                             i, _patternVars.getVariableName(varIdx).c_str(), varIdx, val, isInitialValue);
-#endif
-    }
-}
-
-// Get XY coordinates of point
-// Return false if invalid
-bool EvaluatorPatterns::getPoint(AxisFloats &pt)
-{
-    bool xValid = false;
-    bool yValid = false;
-    pt._pt[0] = _patternVars.getVal("x", xValid, true);
-    pt._pt[1] = _patternVars.getVal("y", yValid, true);
-    return xValid && yValid;
-}
-
-bool EvaluatorPatterns::getStopVar(bool& stopVar)
-{
-    bool stopValid = false;
-    stopVar = _patternVars.getVal("stop", stopValid, true) != 0.0;
-    return stopValid;
-}
-
 void EvaluatorPatterns::start()
 {
     _isRunning = true;
+    _pointBufCount = 0;
+    _pointBufPos = 0;
+    _stopAfterBuf = false;
     // Re-evaluate starting conditions
-    evalExpressions(true, false);
+    _program.runSetup();
 }
 
 void EvaluatorPatterns::stop()
 {
-    _isRunning = false;
+    _robotController.stopPointSource(*this, [this]() {
+        _isRunning = false;
+    });
 }
 
-void EvaluatorPatterns::service()
+bool EvaluatorPatterns::nextPoint(AxisFloats& pt)
 {
     // Check running
     if (!_isRunning)
-        return;
-
-    // Check if the work manager can accept new stuff
-    if (!_workManager.canAcceptWorkItem())
-        return;
-
-    // Evaluate expressions
-    evalExpressions(false, true);
+        return false;
 
-    // Get next point
-    AxisFloats pt;
-    bool isValid = getPoint(pt);
-    if (!isValid)
+    // Evaluate the next batch of points when the buffer is used up
+    if (_pointBufPos >= _pointBufCount)
     {
-        Log.notice("%sstopped x and y must be specified\n", MODULE_PREFIX);
-        _isRunning = false;
-        return;
+        _pointBufCount = _program.runLoop(_pointBuf, POINT_BUF_LEN, _stopAfterBuf);
+        _pointBufPos = 0;
+        if (_pointBufCount <= 0)
+        {
+            _isRunning = false;
+            return false;
+        }
     }
-    char cmdStr[100];
-    sprintf(cmdStr, "G0 X%F Y%F", pt._pt[0], pt._pt[1]);
-    // Log.verbose("%scmdInterp %s\n", MODULE_PREFIX, cmdStr);
-    String retStr;
-    WorkItem workItem(cmdStr);
-    _workManager.addWorkItem(workItem, retStr);
+
+    // Next point
+    pt.setVal(0, _pointBuf[_pointBufPos]._x);
+    pt.setVal(1, _pointBuf[_pointBufPos]._y);
+    _pointBufPos++;
+    _pointRateCount++;
 
     // Check if we reached a limit
-    bool stopReqd = 0;
-    isValid = getStopVar(stopReqd);
-    if (!isValid)
-    {
-        Log.notice("%sstopped stop variable not specified\n", MODULE_PREFIX);
-        _isRunning = false;
-        return;
-    }
-    else if (stopReqd)
+    if ((_pointBufPos >= _pointBufCount) && _stopAfterBuf)
     {
         Log.notice("%sPatternEval stopped stop == true\n", MODULE_PREFIX);
         _isRunning = false;
-        return;
     }
+    return true;
 }
 
 // Process WorkItem
@@ -240,8 +125,10 @@ bool EvaluatorPatterns::execWorkItem(WorkItem& workItem)
         return false;
     }
 
-    // Remove existing pattern
-    cleanUp();
+    // Remove existing pattern (once stopped the planner task doesn't use the program)
+    _robotController.stopPointSource(*this, [this]() {
+        cleanUp();
+    });
 
     // Get pattern details
     _curPattern = fileName;
@@ -261,24 +148,48 @@ bool EvaluatorPatterns::execWorkItem(WorkItem& workItem)
 
     // Add assignments for the size and origin of the robot
     double sizeX = RdJson::getDouble("sizeX", 100, _robotAttribStr.c_str());
-    _patternVars.addConstant("sizeX", sizeX);
+    _program.addConstant("sizeX", sizeX);
     double sizeY = RdJson::getDouble("sizeY", 100, _robotAttribStr.c_str());
-    _patternVars.addConstant("sizeY", sizeY);
+    _program.addConstant("sizeY", sizeY);
     double sizeZ = RdJson::getDouble("sizeZ", 100, _robotAttribStr.c_str());
-    _patternVars.addConstant("sizeZ", sizeZ);
+    _program.addConstant("sizeZ", sizeZ);
     double originX = RdJson::getDouble("originX", 0, _robotAttribStr.c_str());
-    _patternVars.addConstant("originX", originX);
+    _program.addConstant("originX", originX);
     double originY = RdJson::getDouble("originY", 0, _robotAttribStr.c_str());
-    _patternVars.addConstant("originY", originY);
+    _program.addConstant("originY", originY);
     double originZ = RdJson::getDouble("originZ", 0, _robotAttribStr.c_str());
-    _patternVars.addConstant("originZ", originZ);
+    _program.addConstant("originZ", originZ);
 
-    // Add to the pattern evaluator expressions
-    addExpression(setupExprs.c_str(), true);
-    addExpression(loopExprs.c_str(), false);
+    // Compile the pattern evaluator expressions
+    if (!_program.compile(setupExprs.c_str(), loopExprs.c_str()))
+    {
+        Log.notice("%sfileName %s no valid loop expressions\n", MODULE_PREFIX, fileName.c_str());
+        return false;
+    }
 
-    // Start the pattern evaluation process
-    start();
-    return true;
+    if (!_program.hasPointVars())
+    {
+        Log.notice("%sfileName %s x and y must be specified\n", MODULE_PREFIX, fileName.c_str());
+        return false;
+    }
+    if (!_program.hasStopVar())
+    {
+        Log.notice("%sfileName %s stop variable not specified\n", MODULE_PREFIX, fileName.c_str());
+        return false;
+    }
+
+    // Start the pattern evaluation process - the MotionHelper pulls points as the pipeline has room
+    return _robotController.movePointSource(*this, [this]() {
+        start();
+    });
+}
+
+String EvaluatorPatterns::getDebugStr()
+{
+    unsigned long nowMs = millis();
+    unsigned long elapsedMs = nowMs - _pointRateStartMs;
+    float pointsPerSec = (elapsedMs > 0) ? _pointRateCount.exchange(0) * 1000.0f / elapsedMs : 0;
+    _pointRateStartMs = nowMs;
+    return " PTS/s:" + String(pointsPerSec, 0);
 }
 
@@ -3,19 +3,22 @@
 
 #pragma once
 
-#include "EvaluatorPattern_Vars.h"
-#include "tinyexpr.h"
-#include <vector>
-#include "AxisValues.h"
+#include "EvaluatorPattern_Program.h"
+#include "RobotMotion/MotionControl/MotionPointSource.h"
+#include <atomic>
 
 class WorkManager;
 class WorkItem;
 class FileManager;
+class RobotController;
 
-class EvaluatorPatterns
+// Points are pulled by the MotionHelper as the motion pipeline has room (from the planner task
+// if it is running) so the pattern is only started and stopped through the RobotController
+// which detaches it with the robot mutex held
+class EvaluatorPatterns : public MotionPointSource
 {
 public:
-    EvaluatorPatterns(FileManager& fileManager, WorkManager& WorkManager);
+    EvaluatorPatterns(FileManager& fileManager, WorkManager& WorkManager, RobotController& robotController);
     ~EvaluatorPatterns();
     void cleanUp();
 
@@ -24,30 +27,24 @@ public:
     const char* getConfig();
 
     // Is Busy
-    bool isBusy();
+    virtual bool isBusy();
     
     // Check valid
     bool isValid(WorkItem& workItem);
 
-    // Expressions
-    void addExpression(const char* exprStr, bool isInitialValue);
-    void evalExpressions(bool procInitialValues, bool procLoopValues);
-
-    // Get XY coordinates of point
-    // Return false if invalid
-    bool getPoint(AxisFloats &pt);
-    bool getStopVar(bool& stopVar);
-
     // Control
     void start();
     void stop();
 
-    // Call frequently
-    void service();
+    // Get the next point (in MM) - returns false if there are no more
+    virtual bool nextPoint(AxisFloats& pt);
 
     // Process WorkItem
     bool execWorkItem(WorkItem& workItem);
 
+    // Debug - includes points per second since last called
+    String getDebugStr();
+
 private:
     // Full configuration JSON
     String _jsonConfigStr;
@@ -56,26 +53,29 @@ private:
     FileManager& _fileManager;
     WorkManager& _workManager;
 
+    // Robot controller (which pulls the points)
+    RobotController& _robotController;
+
     // Robot attributes (size, etc)
     String _robotAttribStr;
 
-    // All variables used in the pattern
-    EvaluatorPattern_Vars _patternVars;
-
-    // Store for a variable index and compiled expression that evaluates to that variable
-    typedef struct VarIdxAndCompiledExpr
-    {
-        te_expr* _pCompExpr;
-        int _varIdx;
-        bool _isInitialValue;
-    } VarIdxAndCompiledExpr;
+    // Compiled setup and loop expressions of the pattern
+    EvaluatorPattern_Program _program;
 
-    // List of variable indices and compiled expressions
-    std::vector<VarIdxAndCompiledExpr> _varIdxAndCompiledExprs;
+    // Points evaluated but not yet pulled - the loop is run for a batch of points at a time
+    static constexpr int POINT_BUF_LEN = 16;
+    EvaluatorPattern_Program::PatternPoint _pointBuf[POINT_BUF_LEN];
+    int _pointBufCount;
+    int _pointBufPos;
+    bool _stopAfterBuf;
 
-    // Indicator that the current pattern is running
-    bool _isRunning;
+    // Indicator that the current pattern is running (the program isn't used when not running)
+    std::atomic<bool> _isRunning;
 
     // Current pattern name
     String _curPattern;
+
+    // Points per second
+    std::atomic<uint32_t> _pointRateCount;
+    unsigned long _pointRateStartMs;
 };
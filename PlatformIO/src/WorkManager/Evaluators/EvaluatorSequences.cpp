@@ -14,6 +14,7 @@ EvaluatorSequences::EvaluatorSequences(FileManager& fileManager, WorkManager& wo
 {
     _inProgress = 0;
     _reqLineIdx = 0;
+    _passIdx = 0;
     _linesDone = 0;
     _defaultShuffleMode = false;
     _defaultRepeatMode = false;
@@ -61,64 +62,73 @@ bool EvaluatorSequences::isValid(WorkItem& workItem)
     return rslt;
 }
 
-// Count lines
-int EvaluatorSequences::countLines(String& lines)
-{
-    int lineCount = 0;
-    bool lineBlank = true;
-    const char* pStr = lines.c_str();
-    while(true)
-    {
-        if ((*pStr == '\n') || (*pStr == 0))
-        {
-            if (!lineBlank)
-                lineCount++;
-            lineBlank = true;
-            if (*pStr == 0)
-                break;
-        }
-        else
-        {
-            if (*pStr != '\r')
-                lineBlank = false;
-        }
-        pStr++;
-    }
-    return lineCount;
-}
-
 // Process WorkItem
 bool EvaluatorSequences::execWorkItem(WorkItem& workItem)
 {
-    // Find the command info
-    String fileName = workItem.getString();
-    _commandList = _fileManager.getFileContents("", fileName, MAX_SEQUENCE_FILE_LEN);
-    if (_commandList.length() > 0)
+    // Index the lines of the file and check for mode settings
+    _fileName = workItem.getString();
+    _linePos.clear();
+    _lineLen.clear();
+    _shuffleOrder.clear();
+    bool shuffleFound = false, noShuffleFound = false, repeatFound = false, noRepeatFound = false;
+    bool readOk = _fileManager.readFileLines("", _fileName, [&](const char* pLine, int lineLen, int filePos)
+        {
+            // Skip blank lines
+            const char* pStart = pLine;
+            const char* pEnd = pLine + lineLen;
+            while ((pStart < pEnd) && isspace(*pStart))
+                pStart++;
+            while ((pEnd > pStart) && isspace(*(pEnd - 1)))
+                pEnd--;
+            if (pStart == pEnd)
+                return;
+            shuffleFound |= (strstr(pLine, "ShuffleMode") != NULL);
+            noShuffleFound |= (strstr(pLine, "NoShuffleMode") != NULL);
+            repeatFound |= (strstr(pLine, "RepeatMode") != NULL);
+            noRepeatFound |= (strstr(pLine, "NoRepeatMode") != NULL);
+            if (int(_linePos.size()) >= MAX_SEQUENCE_LINES)
+                return;
+            _linePos.push_back(filePos + (pStart - pLine));
+            _lineLen.push_back(std::min(int(pEnd - pStart), 0xffff));
+        });
+    _lineCount = _linePos.size();
+    if (readOk && (_lineCount > 0))
     {
         _inProgress = true;
-        _shuffleMode = _defaultShuffleMode;
-        _repeatMode = _defaultRepeatMode;
-        _lineCount = countLines(_commandList);
-        if (_commandList.indexOf("ShuffleMode") >= 0)
-            _shuffleMode = true;
-        if (_commandList.indexOf("NoShuffleMode") >= 0)
-            _shuffleMode = false;
-        if (_commandList.indexOf("RepeatMode") >= 0)
-            _repeatMode = true;
-        if (_commandList.indexOf("NoRepeatMode") >= 0)
-            _repeatMode = false;
+        _shuffleMode = (_defaultShuffleMode || shuffleFound) && !noShuffleFound;
+        _repeatMode = (_defaultRepeatMode || repeatFound) && !noRepeatFound;
         _linesDone = 0;
-        _reqLineIdx = 0;
-        if (_shuffleMode)
-            _reqLineIdx = rand() % _lineCount;
-        Log.trace("%sexecWorkItem len %d lineCount %d reqLineIdx %d shuffleMode %s repeatMode %s\n", MODULE_PREFIX, 
-                _commandList.length(), _lineCount, _reqLineIdx, _shuffleMode ? "Y" : "N",  _repeatMode ? "Y" : "N");
+        startPass();
+        Log.trace("%sexecWorkItem %s lineCount %d reqLineIdx %d shuffleMode %s repeatMode %s\n", MODULE_PREFIX, 
+                _fileName.c_str(), _lineCount, _reqLineIdx, _shuffleMode ? "Y" : "N",  _repeatMode ? "Y" : "N");
         return true;
     }
-    Log.trace("%sexecWorkItem Not Found %s\n", MODULE_PREFIX, _commandList.c_str());
+    Log.trace("%sexecWorkItem Not Found or empty %s\n", MODULE_PREFIX, _fileName.c_str());
     return false;
 }
 
+// Start a pass through the lines - when shuffling the order is a new permutation (which
+// doesn't start with the line that ended the previous pass)
+void EvaluatorSequences::startPass()
+{
+    _passIdx = 0;
+    if (!_shuffleMode)
+    {
+        _shuffleOrder.clear();
+        _reqLineIdx = 0;
+        return;
+    }
+    int prevLineIdx = (int(_shuffleOrder.size()) == _lineCount) ? _shuffleOrder[_lineCount - 1] : -1;
+    _shuffleOrder.resize(_lineCount);
+    for (int i = 0; i < _lineCount; i++)
+        _shuffleOrder[i] = i;
+    for (int i = _lineCount - 1; i > 0; i--)
+        std::swap(_shuffleOrder[i], _shuffleOrder[rand() % (i + 1)]);
+    if ((_lineCount > 1) && (_shuffleOrder[0] == prevLineIdx))
+        std::swap(_shuffleOrder[0], _shuffleOrder[1 + rand() % (_lineCount - 1)]);
+    _reqLineIdx = _shuffleOrder[0];
+}
+
 void EvaluatorSequences::service()
 {
     // Only add process commands at this level if the workitem queue is completely empty
@@ -128,74 +138,40 @@ void EvaluatorSequences::service()
     // Check if operative
     if (!_inProgress)
         return;
-        
+
     // Get required line
-    const char* pCommandList = _commandList.c_str();
-    const char* pStr = pCommandList;
-    int lineStartPos = 0;
-    int sepIdx = 0;
-    bool lineBlank = true;
-    while(true)
-    {
-        if ((*pStr == '\n') || (*pStr == 0))
-        {
-            if (!lineBlank)
-                sepIdx++;
-            if ((sepIdx == _reqLineIdx+1) || (*pStr == 0))
-                break;
-            lineBlank = true;
-            lineStartPos = pStr - pCommandList;
-        }
-        else
-        {
-            if (*pStr != '\r')
-                lineBlank = false;
-        }
-        pStr++;
-    }
-    if (sepIdx == _reqLineIdx+1)
+    String newCmd = _fileManager.getFileSection("", _fileName, _linePos[_reqLineIdx], _lineLen[_reqLineIdx]);
+    if (newCmd.length() == 0)
     {
-        // Line to process
-        String newCmd = _commandList.substring(lineStartPos, pStr-pCommandList);
-        newCmd.trim();
-        // Separator found so add command
-        Log.trace("%sservice reqLineIdx %d cmd %s\n", MODULE_PREFIX, 
-                _reqLineIdx, newCmd.c_str());
-        if (newCmd.length() > 0)
-        {
-            String retStr;
-            WorkItem workItem(newCmd);
-            _workManager.addWorkItem(workItem, retStr, _reqLineIdx);
-        }
-        // Bump
-        _linesDone++;
-        if ((_linesDone == _lineCount) && !_repeatMode)
-        {
-            _inProgress = false;
-            Log.trace("%sservice linesDone %d lineCount %d no repeat so stopping\n", MODULE_PREFIX, 
-                _linesDone, _lineCount);
-        }
-        // Next req item
-        _reqLineIdx++;
-        if (_reqLineIdx >= _lineCount)
-            _reqLineIdx = 0;
-        if (_shuffleMode)
-            _reqLineIdx = rand() % _lineCount;
+        // Line not read so stop
+        _inProgress = false;
+        Log.trace("%sservice reqLineIdx %d not read so stopping\n", MODULE_PREFIX, 
+                _reqLineIdx);
+        return;
     }
-    else
+
+    // Add command
+    Log.trace("%sservice reqLineIdx %d cmd %s\n", MODULE_PREFIX, 
+            _reqLineIdx, newCmd.c_str());
+    String retStr;
+    WorkItem workItem(newCmd);
+    _workManager.addWorkItem(workItem, retStr, _reqLineIdx);
+
+    // Bump
+    _linesDone++;
+    if ((_linesDone == _lineCount) && !_repeatMode)
     {
-        // Separator not found so stop
         _inProgress = false;
-        Log.trace("%sservice reqLineIdx %d not found so stopping\n", MODULE_PREFIX, 
-                _reqLineIdx);
+        Log.trace("%sservice linesDone %d lineCount %d no repeat so stopping\n", MODULE_PREFIX, 
+            _linesDone, _lineCount);
     }
 
-    // if (millis() > _lastMillis + 10000)
-    // {
-    //     _lastMillis = millis();
-    //     Log.trace("%sprocess cmdStr %s cmdIdx %d numToProc %d isEmpty %d\n", MODULE_PREFIX, _commandList.c_str(), _curCmdIdx, _numCmdsToProcess,
-    //                     _workManager.queueIsEmpty());
-    // }
+    // Next req item
+    _passIdx++;
+    if (_passIdx >= _lineCount)
+        startPass();
+    else
+        _reqLineIdx = _shuffleMode ? _shuffleOrder[_passIdx] : _passIdx;
 }
 
 void EvaluatorSequences::stop()
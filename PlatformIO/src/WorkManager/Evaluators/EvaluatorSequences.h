@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <Arduino.h>
+#include <vector>
+
 class WorkManager;
 class WorkItem;
 class FileManager;
@@ -10,7 +13,8 @@ class FileManager;
 class EvaluatorSequences
 {
 public:
-    static const int MAX_SEQUENCE_FILE_LEN = 2000;
+    // Lines in a sequence file (the file is indexed on start and lines read as required)
+    static const int MAX_SEQUENCE_LINES = 2000;
 
     EvaluatorSequences(FileManager& fileManager, WorkManager& workManager);
 
@@ -41,8 +45,8 @@ public:
     void stop();
     
 private:
-    // Count lines
-    int countLines(String& lines);
+    // Start the next pass through the lines
+    void startPass();
 
     // Full configuration JSON
     String _jsonConfigStr;
@@ -51,11 +55,17 @@ private:
     FileManager& _fileManager;
     WorkManager& _workManager;
 
-    // List of commands to add to workflow - delimited string
-    String _commandList;
+    // Sequence file and the position and length of each non-blank line in it
+    String _fileName;
+    std::vector<uint32_t> _linePos;
+    std::vector<uint16_t> _lineLen;
+
+    // Order of lines in the current pass when shuffling (each line once per pass)
+    std::vector<uint16_t> _shuffleOrder;
 
     // Busy and current line
     int _inProgress;
     int _reqLineIdx;
+    int _passIdx;
     int _linesDone;
 };
@@ -4,55 +4,51 @@
 #include <Arduino.h>
 #include <ArduinoLog.h>
 #include "EvaluatorThetaRhoLine.h"
-#include "RdJson.h"
+#include "RdJsonDoc.h"
 #include "Utils.h"
 #include "../WorkManager.h"
+#include "RobotMotion/RobotController.h"
 
 // #define THETA_RHO_DEBUG 1
 
 static const char *MODULE_PREFIX = "EvaluatorThetaRhoLine: ";
 
-EvaluatorThetaRhoLine::EvaluatorThetaRhoLine(WorkManager& workManager) :
-                            _workManager(workManager)
+EvaluatorThetaRhoLine::EvaluatorThetaRhoLine(WorkManager& workManager, RobotController& robotController) :
+                            _workManager(workManager),
+                            _robotController(robotController)
 {
-    _inProgress = false;
-    _curStep = 0;
-    _stepAngle = AxisUtils::r2d(DEFAULT_STEP_ANGLE);
-    _stepAdaptation = true;
-    _curTheta = 0;
-    _curRho = 0;
     _continueFromPrevious = true;
+    _thetaStartOffset = 0;
     _prevTheta = 0;
     _prevRho = 0;
-    _bedRadiusMM = 0;
-    _centreOffsetX = 0;
-    _centreOffsetY = 0;
-    _isInterpolating = false;
 }
 
 void EvaluatorThetaRhoLine::setConfig(const char *configStr, const char* robotAttributes)
 {
     // Set the theta-rho angle step
-    _stepAngle = AxisUtils::d2r(RdJson::getDouble("thrStepDegs", AxisUtils::r2d(DEFAULT_STEP_ANGLE), configStr));
-    _stepAdaptation = RdJson::getLong("thrStepAdaptation", 1, configStr) != 0;
-    _continueFromPrevious = RdJson::getLong("thrContinue", 1, configStr) != 0;
+    RdJsonDoc configDoc(configStr);
+    double stepAngle = AxisUtils::d2r(configDoc.getDouble("thrStepDegs", AxisUtils::r2d(DEFAULT_STEP_ANGLE)));
+    bool stepAdaptation = configDoc.getLong("thrStepAdaptation", 1) != 0;
+    _continueFromPrevious = configDoc.getLong("thrContinue", 1) != 0;
     // Set the size of the max radius
-    double sizeX = RdJson::getDouble("sizeX", 0, robotAttributes);
-    double sizeY = RdJson::getDouble("sizeY", 0, robotAttributes);
-    double originX = RdJson::getDouble("originX", 0, robotAttributes);
-    double originY = RdJson::getDouble("originY", 0, robotAttributes);
-    _bedRadiusMM = std::min(sizeX, sizeY) / 2;
-    _centreOffsetX = sizeX / 2 - originX;
-    _centreOffsetY = sizeY / 2 - originY;
+    RdJsonDoc attributesDoc(robotAttributes);
+    double sizeX = attributesDoc.getDouble("sizeX", 0);
+    double sizeY = attributesDoc.getDouble("sizeY", 0);
+    double originX = attributesDoc.getDouble("originX", 0);
+    double originY = attributesDoc.getDouble("originY", 0);
+    double bedRadiusMM = std::min(sizeX, sizeY) / 2;
+    double centreOffsetX = sizeX / 2 - originX;
+    double centreOffsetY = sizeY / 2 - originY;
+    _motionSource.configure(stepAngle, stepAdaptation, bedRadiusMM, centreOffsetX, centreOffsetY);
     Log.trace("%ssetConfig StepAngleDegrees %F StepAdaptation %s continueFromPrevious %s radiusMM %Fmm offsetX %F offsetY %F\n", MODULE_PREFIX,
-              _stepAngle, _stepAdaptation ? "Y" : "N", _continueFromPrevious ? "Y" : "N",
-              _bedRadiusMM, _centreOffsetX, _centreOffsetY);
+              stepAngle, stepAdaptation ? "Y" : "N", _continueFromPrevious ? "Y" : "N",
+              bedRadiusMM, centreOffsetX, centreOffsetY);
 }
 
 // Is Busy
 bool EvaluatorThetaRhoLine::isBusy()
 {
-    return _inProgress;
+    return _motionSource.isBusy();
 }
 
 const char *EvaluatorThetaRhoLine::getConfig()
@@ -64,6 +60,8 @@ const char *EvaluatorThetaRhoLine::getConfig()
 bool EvaluatorThetaRhoLine::isValid(WorkItem &workItem)
 {
     // Check if theta-rho
+    if (workItem.getType() == WorkItem::WORK_ITEM_THETA_RHO)
+        return true;
     String cmdStr = workItem.getString();
     cmdStr.trim();
     return cmdStr.startsWith("_THRLINE");
@@ -73,36 +71,46 @@ bool EvaluatorThetaRhoLine::isValid(WorkItem &workItem)
 bool EvaluatorThetaRhoLine::execWorkItem(WorkItem &workItem)
 {
     // Extract the details
-    String thetaStr = Utils::getNthField(workItem.getCString(), 1, '/');
-    String rhoStr = Utils::getNthField(workItem.getCString(), 2, '/');
-    double newTheta = atof(thetaStr.c_str());
-    double newRho = atof(rhoStr.c_str());
+    WorkItem::ThetaRhoLineType lineType = WorkItem::THETA_RHO_NEXT;
+    double newTheta = 0;
+    double newRho = 0;
+    if (workItem.getType() == WorkItem::WORK_ITEM_THETA_RHO)
+    {
+        lineType = workItem.getThetaRhoLineType();
+        newTheta = workItem.getTheta();
+        newRho = workItem.getRho();
+    }
+    else
+    {
+        String thetaStr = Utils::getNthField(workItem.getCString(), 1, '/');
+        String rhoStr = Utils::getNthField(workItem.getCString(), 2, '/');
+        newTheta = atof(thetaStr.c_str());
+        newRho = atof(rhoStr.c_str());
+        if (workItem.getString().startsWith("_THRLINE_"))
+            lineType = WorkItem::THETA_RHO_NO_INTERPOLATE;
+        else if (workItem.getString().startsWith("_THRLINE0_"))
+            lineType = WorkItem::THETA_RHO_FIRST;
+    }
 #ifdef THETA_RHO_DEBUG
-    Log.trace("%sexecWorkItem %s\n", MODULE_PREFIX,
-              workItem.getCString());
+    Log.trace("%sexecWorkItem type %d theta %F rho %F\n", MODULE_PREFIX,
+              lineType, newTheta, newRho);
 #endif
 
     // Check for an uninterpolated line
-    if (workItem.getString().startsWith("_THRLINE_"))
+    if (lineType == WorkItem::THETA_RHO_NO_INTERPOLATE)
     {
-        _isInterpolating = false;
-        // Next iteration
-        char lineBuf[100];
-        // Calculate coords
+        // Calculate coords and add the move
         double x,y;
-        calcXYPos(newTheta, newRho, x, y);
-        sprintf(lineBuf, "G0 X%0.3f Y%0.3f", x, y);
-        String retStr;
-        WorkItem workItem(lineBuf);
+        _motionSource.calcXYPos(newTheta, newRho, x, y);
 #ifdef THETA_RHO_DEBUG
-        Log.trace("%sexecWorkItem thrNonInterp %s\n", MODULE_PREFIX, lineBuf);
+        Log.trace("%sexecWorkItem thrNonInterp X%F Y%F\n", MODULE_PREFIX, x, y);
 #endif
-        _workManager.addWorkItem(workItem, retStr);
+        addMove(x, y);
         return true;
     }
 
     // Check for first line of interpolated file
-    if (workItem.getString().startsWith("_THRLINE0_"))
+    if (lineType == WorkItem::THETA_RHO_FIRST)
     {
         if (_continueFromPrevious)
         {
@@ -114,120 +122,36 @@ bool EvaluatorThetaRhoLine::execWorkItem(WorkItem &workItem)
         }
         _prevTheta = newTheta;
         _prevRho = newRho;
-        _isInterpolating = false;
         return true;
     }
 
-    // Must be a _THRLINEN_ then
-    double deltaTheta = newTheta - _thetaStartOffset - _prevTheta;
-    double absDeltaTheta = abs(deltaTheta);
-    double adaptedStepAngle = _stepAngle;
-    if (_stepAdaptation)
-    {
-        double avgRho = std::max(fabs(newRho), fabs(_prevRho));
-        if (avgRho > 1)
-            avgRho = 1;
-        double maxStepAngle = _stepAngle * 16;
-        if (maxStepAngle > M_PI / 2)
-            maxStepAngle = M_PI / 2;
-        double minStepAngle = _stepAngle / 4;
-        if (avgRho > RHO_AT_DEFAULT_STEP_ANGLE)
-        {
-            adaptedStepAngle = ((avgRho - RHO_AT_DEFAULT_STEP_ANGLE) / (1 - RHO_AT_DEFAULT_STEP_ANGLE)) * 
-                    (minStepAngle - _stepAngle) + _stepAngle;
-        }
-        else
-        {
-            adaptedStepAngle = (avgRho / RHO_AT_DEFAULT_STEP_ANGLE) * 
-                    (_stepAngle - maxStepAngle) + maxStepAngle;
-        }
-    }
-    _thetaInc = deltaTheta >= 0 ? adaptedStepAngle : -adaptedStepAngle;
-    double deltaRho = newRho - _prevRho;
-    if (absDeltaTheta < adaptedStepAngle)
-    {
-        _thetaInc = deltaTheta;
-        _interpolateSteps = 1;
-        _rhoInc = deltaRho;
-    }
-    else
-    {
-        _interpolateSteps = int(floor(absDeltaTheta / adaptedStepAngle));
-        if (_interpolateSteps < 1)
-            return true;
-        _rhoInc = deltaRho * adaptedStepAngle / absDeltaTheta;
-    }
-    _curTheta = _prevTheta;
-    _curRho = _prevRho;
+    // Must be a _THRLINEN_ then - the MotionHelper pulls the interpolated points as
+    // the pipeline has room (a rejected line is left for the caller to retry)
+    double startTheta = _prevTheta;
+    double startRho = _prevRho;
+    double endTheta = newTheta - _thetaStartOffset;
+    if (!_robotController.movePointSource(_motionSource, [&]() {
+                _motionSource.start(startTheta, startRho, endTheta, newRho);
+            }))
+        return false;
     _prevTheta = newTheta;
     _prevRho = newRho;
-    _curStep = 0;
-    _inProgress = true;
-    _isInterpolating = true;
-#ifdef THETA_RHO_DEBUG
-    char debugStr[200];
-    sprintf(debugStr, "Theta %8.6f Rho %8.6f CurTheta %8.6f CurRho %8.6f TotalSteps %d ThetaInc %8.6f RhoInc %8.6f AbsDeltaTheta %8.6f StepAng %8.6f AdaptedStepAng %8.6f",
-            newTheta, newRho, _curTheta, _curRho, _interpolateSteps, _thetaInc, _rhoInc, absDeltaTheta, _stepAngle, adaptedStepAngle);
-    Log.trace("%sexecWorkItem %s\n", MODULE_PREFIX, debugStr);
-#endif
     return true;
 }
 
-void EvaluatorThetaRhoLine::service()
-{
-    // Check in progress
-    if (!_inProgress)
-        return;
-
-    // Check if interpolating
-    if (!_isInterpolating)
-        return;
-
-    // Process multiple if possible
-    for (int i = 0; i < PROCESS_STEPS_PER_SERVICE; i++)
-    {
-        if (_curStep >= _interpolateSteps)
-        {
-#ifdef THETA_RHO_DEBUG
-            Log.trace("%sservice finished\n", MODULE_PREFIX);
-#endif
-            _inProgress = false;
-            return;
-        }
-
-        // See if we can add to the queue
-        if (!_workManager.canAcceptWorkItem())
-            return;
-
-        // Step
-        _curStep++;
-
-        // Inc
-        _curTheta += _thetaInc;
-        _curRho += _rhoInc;
-
-        // Next iteration
-        char lineBuf[100];
-        // Calculate coords
-        double x,y;
-        calcXYPos(_curTheta, _curRho, x, y);
-        sprintf(lineBuf, "G0 X%0.3f Y%0.3f", x, y);
-        String retStr;
-        WorkItem workItem(lineBuf);
-#ifdef THETA_RHO_DEBUG
-        Log.trace("%sservice %s\n", MODULE_PREFIX, lineBuf);
-#endif
-        _workManager.addWorkItem(workItem, retStr);
-    }
-}
-
 void EvaluatorThetaRhoLine::stop()
 {
-    _inProgress = false;
+    _robotController.stopPointSource(_motionSource, [this]() {
+        _motionSource.stop();
+    });
 }
 
-void EvaluatorThetaRhoLine::calcXYPos(double theta, double rho, double& x, double& y)
+// Queue a move to X,Y (pre-parsed so there is no G-code formatting and parsing)
+void EvaluatorThetaRhoLine::addMove(double x, double y)
 {
-    x = sin(theta) * rho * _bedRadiusMM + _centreOffsetX;
-    y = cos(theta) * rho * _bedRadiusMM + _centreOffsetY;
+    RobotCommandArgs cmdArgs;
+    cmdArgs.setAxisValMM(0, x, true);
+    cmdArgs.setAxisValMM(1, y, true);
+    cmdArgs.setMoveRapid(true);
+    _workManager.queueWorkItem(WorkItem(cmdArgs));
 }
\ No newline at end of file
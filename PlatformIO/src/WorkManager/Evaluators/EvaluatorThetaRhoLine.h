@@ -3,13 +3,16 @@
 
 #pragma once
 
+#include "RobotMotion/MotionControl/ThetaRhoMotionSource.h"
+
 class WorkManager;
 class WorkItem;
+class RobotController;
 
 class EvaluatorThetaRhoLine
 {
 public:
-    EvaluatorThetaRhoLine(WorkManager& workManager);
+    EvaluatorThetaRhoLine(WorkManager& workManager, RobotController& robotController);
 
     // Config
     void setConfig(const char* configStr, const char* robotAttributes);
@@ -21,47 +24,31 @@ public:
     // Check valid
     bool isValid(WorkItem& workItem);
 
-    // Process WorkItem
+    // Process WorkItem - false if the robot rejected the line (its command queue stayed full)
     bool execWorkItem(WorkItem& workItem);
 
-    // Call frequently
-    void service();
-
     // Control
     void stop();
 
 private:
     // Config
     const double DEFAULT_STEP_ANGLE = M_PI / 64;
-    const double RHO_AT_DEFAULT_STEP_ANGLE = 0.5;
-    double _stepAngle;
-    bool _stepAdaptation;
     bool _continueFromPrevious;
-    double _bedRadiusMM;
-    double _centreOffsetX;
-    double _centreOffsetY;
 
     // Work manager
     WorkManager& _workManager;
 
-    // Pattern in progress
-    bool _inProgress;
+    // Robot controller (to which interpolated lines are sent)
+    RobotController& _robotController;
+
+    // Interpolation of lines (points are pulled by the MotionHelper)
+    ThetaRhoMotionSource _motionSource;
 
     // Pattern vars
-    bool _isInterpolating;
-    double _curTheta;
-    double _curRho;
-    int _interpolateSteps;
-    int _curStep;
-    double _thetaInc;
-    double _rhoInc;
     double _thetaStartOffset;
     double _prevTheta;
     double _prevRho;
 
-    // Process steps per service
-    static const int PROCESS_STEPS_PER_SERVICE = 20;
-
-    void calcXYPos(double theta, double rho, double& x, double& y);
+    void addMove(double x, double y);
 
 };
\ No newline at end of file
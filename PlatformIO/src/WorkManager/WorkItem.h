@@ -3,27 +3,77 @@
 
 #pragma once
 
+#include "RobotCommandArgs.h"
+
 class WorkItem
 {
+public:
+    // Text work items are commands or G-code - the other types are pre-parsed
+    // by evaluators so they don't need to be formatted and re-parsed
+    enum WorkItemType
+    {
+        WORK_ITEM_TEXT,
+        WORK_ITEM_MOVE,
+        WORK_ITEM_THETA_RHO
+    };
+
+    // Theta-rho line types (same as _THRLINE0_, _THRLINEN_ and _THRLINE_ text)
+    enum ThetaRhoLineType
+    {
+        THETA_RHO_FIRST,
+        THETA_RHO_NEXT,
+        THETA_RHO_NO_INTERPOLATE
+    };
+
 private:
+    WorkItemType _type;
     String _str;
 
+    // Move
+    RobotCommandArgs _cmdArgs;
+
+    // Theta-rho
+    ThetaRhoLineType _thetaRhoLineType;
+    double _theta;
+    double _rho;
+
 public:
     WorkItem()
     {
-        _str = "";
+        _type = WORK_ITEM_TEXT;
     }
 
     WorkItem(const char* pCmdStr)
     {
+        _type = WORK_ITEM_TEXT;
         _str = pCmdStr;
     }
 
     WorkItem(const String& cmdStr)
     {
+        _type = WORK_ITEM_TEXT;
         _str = cmdStr;
     }
 
+    WorkItem(const RobotCommandArgs& cmdArgs) : _cmdArgs(cmdArgs)
+    {
+        _type = WORK_ITEM_MOVE;
+    }
+
+    WorkItem(ThetaRhoLineType lineType, double theta, double rho)
+    {
+        _type = WORK_ITEM_THETA_RHO;
+        _thetaRhoLineType = lineType;
+        _theta = theta;
+        _rho = rho;
+    }
+
+    WorkItemType getType()
+    {
+        return _type;
+    }
+
+    // Text - empty for pre-parsed work items
     const char* getCString()
     {
         return _str.c_str();
@@ -33,4 +83,24 @@ public:
     {
         return _str;
     }
+
+    // Move
+    RobotCommandArgs& getMoveArgs()
+    {
+        return _cmdArgs;
+    }
+
+    // Theta-rho
+    ThetaRhoLineType getThetaRhoLineType()
+    {
+        return _thetaRhoLineType;
+    }
+    double getTheta()
+    {
+        return _theta;
+    }
+    double getRho()
+    {
+        return _rho;
+    }
 };
@@ -27,11 +27,11 @@ public:
     // Set configuration
     void init(const char* configStr, const char* queueName)
     {
-        String queueCfg = RdJson::getString(queueName, "{}", configStr);
+        String maxLenPath = String(queueName) + "/maxLen";
 
 //        Log.notice("Configuring WorkItemQueue from %s\n", configStr);
-        _workItemQueueMaxLen = (int) RdJson::getLong("maxLen",
-                                            _workItemQueueMaxLenDefault, queueCfg.c_str());
+        _workItemQueueMaxLen = (int) RdJson::getLong(maxLenPath.c_str(),
+                                            _workItemQueueMaxLenDefault, configStr);
         clear();
 //        Log.notice("MaxLen %d\n", _workItemQueueMaxLen);
     }
@@ -72,6 +72,18 @@ public:
         return true;
     }
 
+    // Add a work item (text or pre-parsed) to queue
+    bool add(const WorkItem& workItem)
+    {
+        // Check if queue is full
+        if (_workItemQueue.size() >= _workItemQueueMaxLen)
+            return false;
+
+        // Queue up the item
+        _workItemQueue.push(workItem);
+        return true;
+    }
+
     // Peek the queue
     bool peek(WorkItem& workItem)
     {
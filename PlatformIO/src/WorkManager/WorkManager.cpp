@@ -7,6 +7,7 @@
 #include "RestAPISystem.h"
 #include "Evaluators/EvaluatorGCode.h"
 #include "RobotConfigurations.h"
+#include "LoopProfiler.h"
 
 static const char* MODULE_PREFIX = "WorkManager: ";
 
@@ -24,13 +25,14 @@ WorkManager::WorkManager(ConfigBase& mainConfig,
             _restAPISystem(restAPISystem),
             _fileManager(fileManager),
             _commandScheduler(commandScheduler),
-            _evaluatorPatterns(fileManager, *this),
+            _evaluatorPatterns(fileManager, *this, robotController),
             _evaluatorSequences(fileManager, *this),
             _evaluatorFiles(fileManager, *this),
-            _evaluatorThetaRhoLine(*this)
+            _evaluatorThetaRhoLine(*this, robotController)
 {
+    _statusSentSeq = 0;
     _statusReportLastCheck = 0;
-    _statusLastHashVal = 0;
+    _statusAlwaysLastCheck = 0;
 #ifdef DEBUG_WORK_ITEM_SERVICE
     _debugLastWorkServiceMs = 0;
 #endif
@@ -38,46 +40,14 @@ WorkManager::WorkManager(ConfigBase& mainConfig,
 
 void WorkManager::queryStatus(String &respStr)
 {
-    String innerJsonStr;
-    int hashUsedBits = 0;
-    // System health
-    String healthStrSystem;
-    hashUsedBits += _restAPISystem.reportHealth(hashUsedBits, NULL, &healthStrSystem);
-    if ((innerJsonStr.length() > 0) && (healthStrSystem.length() > 0))
-        innerJsonStr += ",";
-    innerJsonStr += healthStrSystem;
-    // Robot info
-    RobotCommandArgs cmdArgs;
-    _robotController.getCurStatus(cmdArgs);
-    String healthStrRobot = cmdArgs.toJSON(false);
-    if ((innerJsonStr.length() > 0) && (healthStrRobot.length() > 0))
-        innerJsonStr += ",";
-    innerJsonStr += healthStrRobot;
-    String ledStrip = _ledStrip.getConfigStrPtr();
-    // Log.trace("%squeryStatus innerJsonLen %d ledStripLen %d ledStrip <%s>\n", MODULE_PREFIX, innerJsonStr.length(), ledStrip.length(), ledStrip.c_str());
-    if ((innerJsonStr.length() > 0) && (ledStrip.length() > 2))
-        innerJsonStr += ",";
-    innerJsonStr += ledStrip.substring(1, ledStrip.length() - 1);
-    // Time of Day
-    String timeJsonStr;
-    struct tm timeinfo;
-    const int MAX_LOCAL_TIME_STR_LEN = 40;
-    char localTimeString[MAX_LOCAL_TIME_STR_LEN];
-    if (getLocalTime(&timeinfo, 0)) {
-        strftime(localTimeString, MAX_LOCAL_TIME_STR_LEN, "%Y-%m-%d %H:%M:%S", &timeinfo);
-        timeJsonStr += "\"tod\":\"";
-        timeJsonStr += localTimeString;
-        timeJsonStr += "\"";
-    }
-    if (timeJsonStr.length() > 0)
-    {
-        if (innerJsonStr.length() > 0)
-            innerJsonStr += ",";
-        innerJsonStr += timeJsonStr;
-    }
+    std::lock_guard<std::mutex> lock(_statusMutex);
+    refreshStatus(true);
+    _statusSnapshot.getJSON(respStr, 0);
+}
 
-    // System information
-    respStr = "{" + innerJsonStr + "}";
+void WorkManager::queryPipelineStats(String &respStr, bool clearStats)
+{
+    _robotController.getPipelineStats(respStr, clearStats);
 }
 
 bool WorkManager::canAcceptWorkItem()
@@ -240,15 +210,24 @@ void WorkManager::addWorkItem(WorkItem& workItem, String &retStr, int cmdIdx)
     }
 }
 
+bool WorkManager::queueWorkItem(const WorkItem& workItem)
+{
+    return _workItemQueue.add(workItem);
+}
+
 bool WorkManager::canBeProcessed(WorkItem& workItem)
 {
-    // See if it is a pattern evaluator work item
-    if (_evaluatorPatterns.isValid(workItem))
-        return !_evaluatorPatterns.isBusy();
+    // Pre-parsed moves go straight to the robot
+    if (workItem.getType() == WorkItem::WORK_ITEM_MOVE)
+        return _robotController.canAcceptCommand();
 
-    // See if it is a theta-rho evaluator work item
+    // Theta-rho lines (pre-parsed or text) - the robot must be ready to pull the line's points
     if (_evaluatorThetaRhoLine.isValid(workItem))
-        return !_evaluatorThetaRhoLine.isBusy();
+        return !_evaluatorThetaRhoLine.isBusy() && _robotController.canAcceptCommand();
+
+    // See if it is a pattern evaluator work item (the robot must be ready to pull its points)
+    if (_evaluatorPatterns.isValid(workItem))
+        return !_evaluatorPatterns.isBusy() && _robotController.canAcceptCommand();
 
     // See if it is a file to process
     if (_evaluatorFiles.isValid(workItem))
@@ -273,17 +252,6 @@ bool WorkManager::execWorkItem(WorkItem& workItem)
 #ifdef DEBUG_WORK_ITEM_SERVICE
         Log.trace("%sexecWorkIterm %s isPattern handledOk = %s\n", MODULE_PREFIX, 
                 workItem.getCString(), handledOk ? "YES" : "NO");
-#endif
-        if (handledOk)
-            return handledOk;
-    }
-    // See if it is a theta-rho line
-    if (_evaluatorThetaRhoLine.isValid(workItem))
-    {
-        handledOk = _evaluatorThetaRhoLine.execWorkItem(workItem);
-#ifdef DEBUG_WORK_ITEM_SERVICE
-        Log.trace("%sexecWorkIterm %s isTHR handledOk = %s\n", MODULE_PREFIX, 
-                workItem.getCString(), handledOk ? "YES" : "NO");
 #endif
         if (handledOk)
             return handledOk;
@@ -349,7 +317,7 @@ void WorkManager::service()
     for (int i = 0; i < qSize; i++)
     {
         WorkItem it = newQ.front();
-        _workItemQueue.add(it.getCString());
+        _workItemQueue.add(it);
         newQ.pop();
     }
     }
@@ -364,14 +332,35 @@ void WorkManager::service()
         bool rslt = _workItemQueue.peek(workItem);
         if (rslt)
         {
+            // Theta-rho lines are only removed from the queue once the robot accepts them (a line
+            // rejected because the robot's command queue stayed full is retried on the next service)
+            if (_evaluatorThetaRhoLine.isValid(workItem))
+            {
+                if (canBeProcessed(workItem))
+                {
+                    LOOP_PROFILE_SCOPE("ExecItem");
+                    if (_evaluatorThetaRhoLine.execWorkItem(workItem))
+                        _workItemQueue.get(workItem);
+                }
+            }
             // Check if this work item can be processed
-            if (canBeProcessed(workItem))
+            else if (canBeProcessed(workItem))
             {
                 rslt = _workItemQueue.get(workItem);
                 if (rslt)
                 {
-                    // Check for extended commands
-                    rslt = execWorkItem(workItem);
+                    // Pre-parsed moves don't need evaluating
+                    LOOP_PROFILE_SCOPE("ExecItem");
+                    if (workItem.getType() == WorkItem::WORK_ITEM_MOVE)
+                    {
+                        _robotController.moveTo(workItem.getMoveArgs());
+                        rslt = true;
+                    }
+                    else
+                    {
+                        // Check for extended commands
+                        rslt = execWorkItem(workItem);
+                    }
 
 #ifdef DEBUG_WORK_ITEM_SERVICE
                     Log.trace("%sgetWorkflow execRslt=%d (waiting %d), %s\n", MODULE_PREFIX,
@@ -389,6 +378,10 @@ void WorkManager::service()
 
     // Service evaluators
     evaluatorsService();
+
+    // Motion waiting here counts as pending in the pipeline underrun telemetry
+    _robotController.setWorkQueued(!_workItemQueue.isEmpty() || evaluatorsBusy(true) ||
+                _evaluatorSequences.isBusy());
 }
 
 void WorkManager::reconfigure()
@@ -456,12 +449,16 @@ void WorkManager::evaluatorsStop()
 
 void WorkManager::evaluatorsService()
 {
-    _evaluatorThetaRhoLine.service();
-    _evaluatorPatterns.service();
     if (!evaluatorsBusy(false))
+    {
+        LOOP_PROFILE_SCOPE("Files");
         _evaluatorFiles.service();
+    }
     if (!evaluatorsBusy(true))
+    {
+        LOOP_PROFILE_SCOPE("Sequences");
         _evaluatorSequences.service();
+    }
 }
 
 bool WorkManager::evaluatorsBusy(bool includeFileEvaluator)
@@ -492,45 +489,66 @@ void WorkManager::evaluatorsSetConfig(const char* configJson, const char* jsonPa
     _evaluatorThetaRhoLine.setConfig(evaluatorConfig.c_str(), robotAttributes);
 }
 
-bool WorkManager::checkStatusChanged()
+void WorkManager::refreshStatus(bool refreshSystem)
+{
+    // System health - the JSON is only generated when the hash changes (or a refresh is
+    // needed for values not in the hash)
+    unsigned long systemHash = 0;
+    _restAPISystem.reportHealth(0, &systemHash, NULL);
+    if (refreshSystem || _statusSnapshot.isSystemHashChanged(systemHash))
+    {
+        String healthStrSystem;
+        _restAPISystem.reportHealth(0, NULL, &healthStrSystem);
+        _statusSnapshot.setSystem(systemHash, healthStrSystem.c_str());
+    }
+
+    // Robot and LED strip
+    _robotController.updateStatus(_statusSnapshot);
+    _statusSnapshot.setLed(_ledStrip.getConfigChangeCount(), _ledStrip.getConfigStrPtr());
+
+    // Time of Day
+    struct tm timeinfo;
+    const int MAX_LOCAL_TIME_STR_LEN = 40;
+    char localTimeString[MAX_LOCAL_TIME_STR_LEN];
+    localTimeString[0] = 0;
+    if (getLocalTime(&timeinfo, 0))
+        strftime(localTimeString, MAX_LOCAL_TIME_STR_LEN, "%Y-%m-%d %H:%M:%S", &timeinfo);
+    _statusSnapshot.setTimeOfDay(localTimeString);
+
+    // Encode changed fields
+    _statusSnapshot.update();
+}
+
+const char* WorkManager::getStatusChangeJSON()
 {
     // Check for status change
     if (!Utils::isTimeout(millis(), _statusReportLastCheck, STATUS_CHECK_MS))
-        return false;
+        return NULL;
     _statusReportLastCheck = millis();
 
-    // Check if always update timed out
-    bool statusChanged = false;
+    // Check if always update timed out - then all fields are sent
+    bool sendAll = false;
     if (Utils::isTimeout(millis(), _statusAlwaysLastCheck, STATUS_ALWAYS_UPDATE_MS))
     {
         _statusAlwaysLastCheck = millis();
-        statusChanged = true;
+        sendAll = true;
     }
 
-    // Check for system status changes
-    unsigned long statusNewHash = 0;
-    _restAPISystem.reportHealth(0, &statusNewHash, NULL);
-
-    // Check for robot status changes
-    RobotCommandArgs cmdArgs;
-    _robotController.getCurStatus(cmdArgs);
-
-    // Check if anything changed
-    statusChanged |= (_statusLastHashVal != statusNewHash) | (_statusLastCmdArgs != cmdArgs);
-    if (statusChanged)
-    {
-        _statusLastHashVal = statusNewHash;
-        _statusLastCmdArgs = cmdArgs;
-        Log.verbose("%sstatus changed %d %d\n", MODULE_PREFIX,
-                    (_statusLastHashVal != statusNewHash), (_statusLastCmdArgs != cmdArgs));
-        return true;
-    }
-    return false;
+    // Update and send the fields changed since the last event
+    std::lock_guard<std::mutex> lock(_statusMutex);
+    refreshStatus(sendAll);
+    if (!sendAll && (_statusSnapshot.getSeq() == _statusSentSeq))
+        return NULL;
+    uint32_t sinceSeq = sendAll ? 0 : _statusSentSeq;
+    _statusSentSeq = _statusSnapshot.getSeq();
+    Log.verbose("%sstatus changed seq %d since %d\n", MODULE_PREFIX, _statusSentSeq, sinceSeq);
+    return _statusSnapshot.getJSON(sinceSeq);
 }
 
 String WorkManager::getDebugStr()
 {
     String returnStr = (_workItemQueue.isFull() ? " QFULL:" : " QOK:");
     returnStr += _workItemQueue.size();
+    returnStr += _evaluatorPatterns.getDebugStr();
     return returnStr;
 }
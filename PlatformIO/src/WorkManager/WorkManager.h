@@ -13,6 +13,8 @@
 #include "Evaluators/EvaluatorFiles.h"
 #include "Evaluators/EvaluatorThetaRhoLine.h"
 #include "RobotCommandArgs.h"
+#include "StatusSnapshot.h"
+#include <mutex>
 
 class ConfigBase;
 class RobotController;
@@ -39,9 +41,10 @@ private:
     EvaluatorFiles _evaluatorFiles;
     EvaluatorThetaRhoLine _evaluatorThetaRhoLine;
 
-    // Status updates
-    RobotCommandArgs _statusLastCmdArgs;
-    unsigned long _statusLastHashVal;
+    // Status updates - the snapshot is used from the main loop and REST handlers
+    StatusSnapshot _statusSnapshot;
+    std::mutex _statusMutex;
+    uint32_t _statusSentSeq;
     unsigned long _statusReportLastCheck;
     unsigned long _statusAlwaysLastCheck;
     // Time between status change checks
@@ -87,16 +90,27 @@ public:
     // Get status report
     void queryStatus(String &respStr);
 
+    // Get motion pipeline telemetry (underruns etc)
+    void queryPipelineStats(String &respStr, bool clearStats);
+
     // Add a work item to the queue
     void addWorkItem(WorkItem& workItem, String &retStr, int cmdIdx = -1);
 
-    // Check status changed
-    bool checkStatusChanged();
+    // Add a pre-parsed work item to the queue (no immediate commands or splitting)
+    bool queueWorkItem(const WorkItem& workItem);
+
+    // Check status changed - returns the status event JSON (the fields changed since the last
+    // event or all fields periodically) or NULL if nothing changed - the JSON is valid until
+    // the next call (call only from the main loop)
+    const char* getStatusChangeJSON();
 
     // Get debug string
     String getDebugStr();
 
 private:
+    // Update the status snapshot
+    void refreshStatus(bool refreshSystem);
+
     // Execute an item of work
     bool execWorkItem(WorkItem& workItem);
 
@@ -182,8 +182,8 @@ WorkManager _workManager(hwConfig,
 #include "RestAPIRobot.h"
 RestAPIRobot restAPIRobot(_workManager, fileManager);
 
-// Debug loop used to time main loop
-#include "DebugLoopTimer.h"
+// Profiler used to time main loop (and sections within it)
+#include "LoopProfiler.h"
 
 // built in LED+blink
 const int ledPin = BUILTIN_LED;
@@ -191,7 +191,7 @@ int ledState = LOW;
 unsigned long previousMillis = 0;
 const long interval = 1000;  // interval at which to blink (milliseconds)
 
-// Debug loop timer and callback function
+// Loop profiler and callback function for its periodic summary
 void debugLoopInfoCallback(String &infoStr)
 {
     if (wifiManager.isEnabled())
@@ -201,7 +201,14 @@ void debugLoopInfoCallback(String &infoStr)
     infoStr += _workManager.getDebugStr();
     infoStr += _robotController.getDebugStr();
 }
-DebugLoopTimer debugLoopTimer(10000, debugLoopInfoCallback);
+LoopProfiler loopProfiler("main", 10000, debugLoopInfoCallback);
+
+// Profiles of the main loop and planner task as JSON - profile/clear resets them after reading
+void apiProfile(String &reqStr, String &respStr)
+{
+    String clearStr = RestAPIEndpoints::getNthArgStr(reqStr.c_str(), 1);
+    LoopProfiler::getAllJSON(respStr, clearStr.equalsIgnoreCase("clear"));
+}
 
 // Setup
 void setup()
@@ -210,6 +217,9 @@ void setup()
     Serial.begin(115200);
     Log.begin(LOG_LEVEL_TRACE, &netLog);
 
+    // Sections timed in code called from setup and loop are profiled by the main loop profiler
+    loopProfiler.attachToThisThread();
+
     // Message with uptime for reset detection
     Log.notice("%s %s (built %s %s) - BOOT/RESET at uptime %ums\n", systemType, systemVersion, buildDate, buildTime, (unsigned int)millis());
 
@@ -284,6 +294,10 @@ void setup()
                     std::bind(&RestAPISystem::apiRootPage, &restAPISystem, std::placeholders::_1, std::placeholders::_2), 
                     "Root page", "text/html");
 
+    // Loop profiler
+    restAPIEndpoints.addEndpoint("profile", RestAPIEndpointDef::ENDPOINT_CALLBACK, RestAPIEndpointDef::ENDPOINT_GET,
+                    apiProfile, "Loop profile (main loop and planner task), profile/clear to reset");
+
     // MQTT
     mqttManager.setup(hwConfig, &mqttConfig);
 
@@ -296,29 +310,16 @@ void setup()
     // Led Strip
     ledStrip.setup(&robotConfig, "robotConfig/ledStrip");
 
-    // Add debug blocks
-    debugLoopTimer.blockAdd(0, "LoopTimer");
-    debugLoopTimer.blockAdd(1, "WiFi");
-    debugLoopTimer.blockAdd(2, "Web");
-    debugLoopTimer.blockAdd(3, "SysAPI");
-    debugLoopTimer.blockAdd(4, "Console");
-    debugLoopTimer.blockAdd(5, "MQTT");
-    debugLoopTimer.blockAdd(6, "OTA");
-    debugLoopTimer.blockAdd(7, "NetLog");
-    debugLoopTimer.blockAdd(8, "NTP");
-    debugLoopTimer.blockAdd(9, "Sched");
-    debugLoopTimer.blockAdd(10, "WifiLed");
-    debugLoopTimer.blockAdd(11, "Status");
-    debugLoopTimer.blockAdd(12, "Flow");
-    debugLoopTimer.blockAdd(13, "Robot");
-    debugLoopTimer.blockAdd(14, "LedStrip");
-
     // Reconfigure the robot and other settings
     _workManager.reconfigure();
 
     // Handle statup commands
     _workManager.handleStartupCommands();
 
+    // Planner runs in its own task (on core 1 above the priority of this loop) from here on
+    // so that stalls in network servicing don't starve the motion pipeline
+    _robotController.startPlannerTask();
+
     // Set LED power-on indicator
     pinMode(ledPin, OUTPUT);
 }
@@ -326,24 +327,24 @@ void setup()
 // Loop
 void loop()
 {
-    // Debug loop Timing
-    debugLoopTimer.blockStart(0);
-    debugLoopTimer.service();
-    debugLoopTimer.blockEnd(0);
+    // Loop timing (and periodic summary)
+    loopProfiler.loopStart();
 
     // Service WiFi
-    debugLoopTimer.blockStart(1);
-    wifiManager.service();
-    debugLoopTimer.blockEnd(1);
+    {
+        LOOP_PROFILE_SCOPE("WiFi");
+        wifiManager.service();
+    }
 
     // Service the web server
     unsigned long currentMillis = millis();
     if (wifiManager.isConnected() || wifiManager.isPortalMode())
     {
         // Begin the web server
-        debugLoopTimer.blockStart(2);
-        webServer.begin(true);
-        debugLoopTimer.blockEnd(2);
+        {
+            LOOP_PROFILE_SCOPE("Web");
+            webServer.begin(true);
+        }
         // blink LED
         if (currentMillis - previousMillis >= interval) {
             // save the last time you blinked the LED
@@ -362,71 +363,93 @@ void loop()
         digitalWrite(ledPin, HIGH);
     }
 
+    // Service the file manager (upload timeouts)
+    {
+        LOOP_PROFILE_SCOPE("FileMan");
+        fileManager.service();
+    }
+
     // Service the system API (restart)
-    debugLoopTimer.blockStart(3);
-    restAPISystem.service();
-    debugLoopTimer.blockEnd(3);
+    {
+        LOOP_PROFILE_SCOPE("SysAPI");
+        restAPISystem.service();
+    }
 
     // Serial console
-    debugLoopTimer.blockStart(4);
-    serialConsole.service();
-    debugLoopTimer.blockEnd(4);
+    {
+        LOOP_PROFILE_SCOPE("Console");
+        serialConsole.service();
+    }
 
     // Service MQTT
-    debugLoopTimer.blockStart(5);
-    mqttManager.service();
-    debugLoopTimer.blockEnd(5);
+    {
+        LOOP_PROFILE_SCOPE("MQTT");
+        mqttManager.service();
+    }
 
     // Service OTA Update
-    debugLoopTimer.blockStart(6);
-    otaUpdate.service();
-    debugLoopTimer.blockEnd(6);
+    {
+        LOOP_PROFILE_SCOPE("OTA");
+        otaUpdate.service();
+    }
 
     // Service NetLog
-    debugLoopTimer.blockStart(7);
-    netLog.service(serialConsole.getXonXoff());
-    debugLoopTimer.blockStart(7);
+    {
+        LOOP_PROFILE_SCOPE("NetLog");
+        netLog.service(serialConsole.getXonXoff());
+    }
 
     // Service NTP
-    debugLoopTimer.blockStart(8);
-    ntpClient.service();
-    debugLoopTimer.blockEnd(8);
+    {
+        LOOP_PROFILE_SCOPE("NTP");
+        ntpClient.service();
+    }
 
     // Service command scheduler
-    debugLoopTimer.blockStart(9);
-    commandScheduler.service();
-    debugLoopTimer.blockEnd(9);
+    {
+        LOOP_PROFILE_SCOPE("Sched");
+        commandScheduler.service();
+    }
 
     // Service the status LED
-    debugLoopTimer.blockStart(10);
-    wifiStatusLed.service();
-    debugLoopTimer.blockEnd(10);
+    {
+        LOOP_PROFILE_SCOPE("WifiLed");
+        wifiStatusLed.service();
+    }
 
     // Check for changes to status
-    debugLoopTimer.blockStart(11);
-    if (_workManager.checkStatusChanged())
     {
-        // Send changed status
-        String newStatus;
-        _workManager.queryStatus(newStatus);
-        webServer.sendAsyncEvent(newStatus.c_str(), "status");
+        LOOP_PROFILE_SCOPE("Status");
+        const char* pStatusJson = _workManager.getStatusChangeJSON();
+        if (pStatusJson)
+        {
+            // Send changed status
+            webServer.sendAsyncEvent(pStatusJson, "status");
+        }
+
+        // Notify clients when files are written or deleted so they can refresh lists
+        String fileListChangeJson;
+        if (fileManager.getFileListChangeJSON(fileListChangeJson))
+            webServer.sendAsyncEvent(fileListChangeJson.c_str(), "filelist");
     }
-    debugLoopTimer.blockEnd(11);
 
     // Service the command interface (which pumps the workflow queue)
-    debugLoopTimer.blockStart(12);
-    _workManager.service();
-    debugLoopTimer.blockEnd(12);
+    {
+        LOOP_PROFILE_SCOPE("Flow");
+        _workManager.service();
+    }
 
-    // Service the robot controller
-    debugLoopTimer.blockStart(13);
-    _robotController.service();
-    debugLoopTimer.blockEnd(13);
+    // Service the robot controller (only if the planner task isn't running)
+    {
+        LOOP_PROFILE_SCOPE("Robot");
+        _robotController.service();
+    }
 
     // Service the LED Strip
-    debugLoopTimer.blockStart(14);
-    ledStrip.service();
-    debugLoopTimer.blockEnd(14);
+    {
+        LOOP_PROFILE_SCOPE("LedStrip");
+        ledStrip.service();
+    }
 
 }
 
@@ -1,5 +1,10 @@
 
+import sys
 from RdGenResources import RdGenResources
 
-RdGenResources.generateResourceFile({"DEFAULT_TITLE": "sandBot", 
-            "DEFAULT_UI": "ui", "MINIFY":True})
+settings = {"DEFAULT_TITLE": "sandBot", "DEFAULT_UI": "ui", "MINIFY":True}
+
+# With --check the generated header is checked against the sources
+if "--check" in sys.argv:
+    sys.exit(0 if RdGenResources.checkResourceFile(settings) else 1)
+RdGenResources.generateResourceFile(settings)
@@ -4,9 +4,12 @@
 
 import logging as log
 import os, os.path
+import re
 import shutil
 import subprocess
 import argparse
+import gzip
+import hashlib
 
 log.basicConfig(level=log.DEBUG)
 
@@ -32,7 +35,7 @@ def getMimeTypeFromFileExt(fileExt):
         mimeType = "application/xml"
     return mimeType
 
-def writeFileContentsAsHex(filePath, outFile, minifyHtml, lineHexIndentChars, lineHexBytesLen):
+def getFileContents(filePath, minifyHtml):
     filename, file_extension = os.path.splitext(filePath)
     # print("File", filePath, "name", filename, "ext", file_extension)
     inFileName = filePath
@@ -53,26 +56,28 @@ def writeFileContentsAsHex(filePath, outFile, minifyHtml, lineHexIndentChars, li
         #else:
         #    print("MINIFY FAILED returncode", rslt.returncode)
 
-    # Iterate through file in binary
-    chCount = 0
-    lineChIdx = 0
     with open(inFileName, "rb") as inFile:
-        byte = inFile.read(1)
-        while byte:
-            if chCount != 0:
-                outFile.write(",")
-            if lineChIdx == 0:
-                outFile.write("\n" + " " * lineHexIndentChars)
-            outFile.write("0x" + format(ord(byte), "02x"))
-            byte = inFile.read(1)
-            lineChIdx += 1
-            if lineChIdx >= lineHexBytesLen:
-                lineChIdx = 0
-            chCount += 1
+        contents = inFile.read()
 
     if minifyHtml and file_extension.upper()[:4] == ".HTM":
         print("Removing", inFileName)
         os.remove(inFileName)
+    return contents
+
+# Compressed with a zero timestamp so the output (and ETag) only changes when the contents do
+def compressContents(contents):
+    return gzip.compress(contents, compresslevel=9, mtime=0)
+
+# Strong ETag (including the quotes) from a hash of the data served
+def getETag(data):
+    return "\"" + hashlib.sha256(data).hexdigest()[:16] + "\""
+
+def writeContentsAsHex(contents, outFile, lineHexIndentChars, lineHexBytesLen):
+    for chIdx in range(0, len(contents), lineHexBytesLen):
+        if chIdx != 0:
+            outFile.write(",")
+        outFile.write("\n" + " " * lineHexIndentChars)
+        outFile.write(",".join("0x" + format(byte, "02x") for byte in contents[chIdx:chIdx+lineHexBytesLen]))
 
 def generateResourceFile(settings = None):
     # Defaults
@@ -83,6 +88,8 @@ def generateResourceFile(settings = None):
     # NOTE that if MINIFY_HTML is True then the Node package html-minifier needs to be installed globally
     # npm install html-minifier -g
     MINIFY_HTML = False
+    # Resources are gzip compressed (served with Content-Encoding: gzip) unless this is False
+    COMPRESS = True
     if settings is not None:
         if "DEFAULT_UI" in settings:
             DEFAULT_UI = settings["DEFAULT_UI"]
@@ -92,6 +99,8 @@ def generateResourceFile(settings = None):
             DEFAULT_DESTPATH = settings["DEFAULT_DESTPATH"]
         if "MINIFY" in settings:
             MINIFY_HTML = settings["MINIFY"]
+        if "COMPRESS" in settings:
+            COMPRESS = settings["COMPRESS"]
         uiFolder = "./" + DEFAULT_UI
     else:
         # Get command line argument to determine which UI to generate
@@ -101,7 +110,7 @@ def generateResourceFile(settings = None):
         parser.add_argument('--DESTPATH', type=str, default=DEFAULT_DESTPATH, help=GEN_HELP_TEXT)
         args = parser.parse_args()
         uiFolder = "./" + args.UI + "UI"
-    print("Generating UI from " + uiFolder + " minify = " + str(MINIFY_HTML))
+    print("Generating UI from " + uiFolder + " minify = " + str(MINIFY_HTML) + " compress = " + str(COMPRESS))
 
     resFileInfo = []
     lineNormalIndentChars = 4
@@ -114,7 +123,7 @@ def generateResourceFile(settings = None):
         outFile.write("#include \"WebServerResource.h\"\n\n")
         walkGen = os.walk(uiFolder)
         for root,folders,fileNames in walkGen:
-            for fileName in fileNames:
+            for fileName in sorted(fileNames):
                 filePath = os.path.join(root, fileName)
                 # Get file parts to create variable name
                 fileExtSplit = os.path.splitext(fileName)
@@ -124,17 +133,25 @@ def generateResourceFile(settings = None):
                 fileOnly = fileOnly.replace(".", "_")
                 cIdent = "__webAutogenResource_" + fileOnly + "_" + fileExt[1:]
                 print(cIdent, fileName)
+                # Contents to serve
+                contents = getFileContents(filePath, MINIFY_HTML)
+                data = compressContents(contents) if COMPRESS else contents
+                print("Resource", fileName, "is", len(contents), "bytes, served as", len(data), "bytes")
                 # Write variable def
+                outFile.write("// " + fileName + " " + str(len(contents)) + " bytes" +
+                                (" (gzip " + str(len(data)) + " bytes)" if COMPRESS else "") + "\n")
                 outFile.write("static const uint8_t " + cIdent + "[] PROGMEM {")
                 # Write file contents as hex
-                writeFileContentsAsHex(filePath, outFile, MINIFY_HTML, lineHexIndentChars, lineHexBytesLen)
+                writeContentsAsHex(data, outFile, lineHexIndentChars, lineHexBytesLen)
                 outFile.write("\n" + " " * lineHexIndentChars + "};\n\n")
                 # Form the file info to be added to webUI
                 fileInfoRec = {
                     "fileName": fileName,
                     "filePath": filePath,
                     "fileExt": fileExt,
-                    "fileCIdent": cIdent
+                    "fileCIdent": cIdent,
+                    "contentEncoding": "gzip" if COMPRESS else "",
+                    "eTag": getETag(data)
                 }
                 resFileInfo.append(fileInfoRec)
 
@@ -150,11 +167,47 @@ def generateResourceFile(settings = None):
             outFile.write(" " * lineNormalIndentChars + "WebServerResource(")
             outFile.write("\"" + fileInf["fileName"] + "\", ")
             outFile.write("\"" + mimeType + "\", ")
-            outFile.write("\"\", ")
+            outFile.write("\"" + fileInf["contentEncoding"] + "\", ")
             outFile.write("\"\", ")
             outFile.write(fileInf["fileCIdent"] + ", ")
-            outFile.write("sizeof(" + fileInf["fileCIdent"] + ")-1)")
+            outFile.write("sizeof(" + fileInf["fileCIdent"] + "), ")
+            outFile.write("false, NULL, ")
+            outFile.write("\"" + fileInf["eTag"].replace("\"", "\\\"") + "\")")
         outFile.write("\n" + " " * lineNormalIndentChars + "};\n\n")
 
         # Write the sixe of the resource list
         outFile.write("static int __webAutogenResourcesCount = sizeof(__webAutogenResources) / sizeof(WebServerResource);\n\n");
+
+# Check the generated header against the sources - each array is decoded and compared with the
+# file it was generated from and the ETag checked against the data - returns True if all match
+def checkResourceFile(settings):
+    uiFolder = "./" + settings.get("DEFAULT_UI", "Standard")
+    destPath = settings.get("DEFAULT_DESTPATH", "../PlatformIO/src")
+    minifyHtml = settings.get("MINIFY", False)
+    with open(os.path.join(destPath, "WebAutogenResources.h"), "r") as inFile:
+        resText = inFile.read()
+
+    # Arrays and resource descriptions
+    arrays = {}
+    for match in re.finditer(r"static const uint8_t (\w+)\[\] PROGMEM \{([^}]*)\};", resText):
+        arrays[match.group(1)] = bytes(int(hexStr, 16) for hexStr in re.findall(r"0x([0-9a-fA-F]{2})", match.group(2)))
+    resDescs = re.findall(r'WebServerResource\("([^"]*)", "[^"]*", "([^"]*)", "[^"]*", (\w+), sizeof\(\w+\), \w+, \w+, "((?:[^"\\]|\\.)*)"\)', resText)
+
+    # Sources
+    sourcePaths = {}
+    for root,folders,fileNames in os.walk(uiFolder):
+        for fileName in fileNames:
+            sourcePaths[fileName] = os.path.join(root, fileName)
+
+    allOk = len(resDescs) == len(sourcePaths)
+    if not allOk:
+        print("FAIL", len(resDescs), "resources generated from", len(sourcePaths), "source files")
+    for fileName, contentEncoding, cIdent, eTag in resDescs:
+        data = arrays.get(cIdent, b"")
+        contents = gzip.decompress(data) if contentEncoding == "gzip" else data
+        sourceOk = fileName in sourcePaths and contents == getFileContents(sourcePaths[fileName], minifyHtml)
+        eTagOk = eTag.replace("\\\"", "\"") == getETag(data)
+        print("OK  " if sourceOk and eTagOk else "FAIL", fileName, contentEncoding, len(data), "bytes",
+                    "" if sourceOk else "(differs from source)", "" if eTagOk else "(ETag mismatch)")
+        allOk = allOk and sourceOk and eTagOk
+    return allOk